@@ -34,6 +34,7 @@ sf::Color ColorComponent::getColor( ) const
 void ColorComponent::setColor( sf::Color newColor )
 {
 	mColor = newColor;
+	markDirty( );
 }
 
 /*
@@ -0,0 +1,80 @@
+/**
+ * @file wDecimationComponent.cpp
+ * @brief Implementation of the DecimationComponent class.
+ */
+
+#include "wDecimationComponent.hpp"
+
+#include <stdexcept>
+
+namespace wEngine
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Constructors and destructors.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+DecimationComponent::DecimationComponent( DecimationMode mode, float pointsPerPixel )
+:	mMode{ mode },
+	mPointsPerPixel{ 4.0f }
+{
+	setPointsPerPixel( pointsPerPixel );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods: accessors and mutators.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+DecimationComponent::DecimationMode DecimationComponent::getMode( ) const
+{
+	return mMode;
+}
+
+void DecimationComponent::setMode( DecimationMode mode )
+{
+	mMode = mode;
+	markDirty( );
+}
+
+float DecimationComponent::getPointsPerPixel( ) const
+{
+	return mPointsPerPixel;
+}
+
+void DecimationComponent::setPointsPerPixel( float pointsPerPixel )
+{
+	if (pointsPerPixel <= 0.0f)
+	{
+		throw std::invalid_argument( "DecimationComponent: points per pixel must be > 0." );
+	}
+	mPointsPerPixel = pointsPerPixel;
+	markDirty( );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public method: debug.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void DecimationComponent::debugPrint( ) const
+{
+	const char* modeStr = "None";
+	if (mMode == DecimationMode::M4)
+	{
+		modeStr = "M4";
+	}
+	else if (mMode == DecimationMode::LTTB)
+	{
+		modeStr = "LTTB";
+	}
+
+	std::cout	<< "Decimation: "				<< modeStr
+				<< " | Points per pixel: "		<< mPointsPerPixel << "\n";
+}
+
+}//End of namespace wEngine
\ No newline at end of file
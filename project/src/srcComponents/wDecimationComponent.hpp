@@ -0,0 +1,100 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_DECIMATION_COMPONENT_HPP
+#define W_DECIMATION_COMPONENT_HPP
+
+#include "../srcEntity/wComponent.hpp"
+
+namespace wEngine
+{
+
+	/**
+	 * @class DecimationComponent
+	 * @brief ECS component that defines how a large data series is reduced before rendering.
+	 *
+	 * - `None`: every point is drawn.
+	 * - `M4`: the data extent is split into one bucket per pixel column, and each bucket keeps
+	 *   its first, last, minimum and maximum points (at most 4 points per column, peaks preserved).
+	 * - `LTTB`: Largest-Triangle-Three-Buckets keeps `pointsPerPixel` points per pixel column,
+	 *   choosing in each bucket the point forming the largest triangle with its neighbours.
+	 *
+	 * Both modes assume the points are sorted by increasing x (time series).
+	 *
+	 * ### Usage Example:
+	 *	@code
+	 *		addComponent< wEngine::DecimationComponent >( wEngine::DecimationComponent::DecimationMode::M4 );
+	 *	@endcode
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class DecimationComponent : public Component
+	{
+		public:
+			/**
+			 * @enum DecimationMode
+			 * @brief Available decimation strategies.
+			 */
+			enum class DecimationMode
+			{
+				None,
+				M4,
+				LTTB
+			};
+
+			/**
+			 * @brief Constructs a DecimationComponent.
+			 * @param mode				Decimation strategy (default: None).
+			 * @param pointsPerPixel	Point budget per pixel column (LTTB only, default: 4).
+			 * @throw std::invalid_argument if pointsPerPixel <= 0.
+			 */
+			DecimationComponent( DecimationMode mode = DecimationMode::None, float pointsPerPixel = 4.0f );
+
+			/*
+			 * @brief Virtual destructor.
+			 */
+			virtual ~DecimationComponent( ) = default;
+
+			/**
+			 * @brief Returns the current decimation strategy.
+			 * @return None, M4 or LTTB.
+			 */
+			[[nodiscard]] DecimationMode getMode( ) const;
+
+			/**
+			 * @brief Sets the decimation strategy.
+			 * @param mode New decimation strategy.
+			 */
+			void setMode( DecimationMode mode );
+
+			/**
+			 * @brief Returns the point budget per pixel column used in LTTB mode.
+			 * @return Points per pixel column.
+			 */
+			[[nodiscard]] float getPointsPerPixel( ) const;
+
+			/**
+			 * @brief Sets the point budget per pixel column used in LTTB mode.
+			 * @param pointsPerPixel Points per pixel column (must be > 0).
+			 * @throw std::invalid_argument if pointsPerPixel <= 0.
+			 */
+			void setPointsPerPixel( float pointsPerPixel );
+
+			/*
+			 * @brief Outputs the current decimation settings to the console.
+			 */
+			void debugPrint( ) const;
+		private:
+			DecimationMode mMode;
+			float mPointsPerPixel;
+	};
+
+}//End of namespace wEngine
+
+#endif
\ No newline at end of file
@@ -32,11 +32,13 @@ void DiscontinuityComponent::addExcludedInterval( double min, double max )
 		throw std::invalid_argument( "DiscontinuityComponent::addExcludedInterval : min must be < max" );
 	}
 	mExcludedIntervals.emplace_back( min, max );
+	markDirty( );
 }
 
 void DiscontinuityComponent::clearExcludedIntervals( )
 {
 	mExcludedIntervals.clear( );
+	markDirty( );
 }
 
 bool DiscontinuityComponent::isInExcludedInterval( double x ) const
@@ -34,6 +34,7 @@ const sf::Font& FontComponent::getFont( ) const
 void FontComponent::setFont( const sf::Font& font )
 {
 	mFont = &font;
+	markDirty( );
 }
 
 /*
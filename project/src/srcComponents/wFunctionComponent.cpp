@@ -23,6 +23,15 @@ FunctionComponent::FunctionComponent( std::function< double( double ) > function
 	}
 }
 
+FunctionComponent::FunctionComponent( BatchFunction function )
+:	mBatchFunction{ function }
+{
+	if (!mBatchFunction)
+	{
+		throw std::invalid_argument( "FunctionComponent: provided batch function is empty." );
+	}
+}
+
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 -> Public methods.
@@ -31,6 +40,13 @@ FunctionComponent::FunctionComponent( std::function< double( double ) > function
 
 double FunctionComponent::calculate( double x ) const
 {
+	if (mBatchFunction)
+	{
+		double y = 0.0;
+		mBatchFunction( std::span< const double >( &x, 1 ), std::span< double >( &y, 1 ) );
+		return y;
+	}
+
 	if (!mFunction)
 	{
 		throw std::runtime_error( "FunctionComponent: no function defined." );
@@ -39,6 +55,35 @@ double FunctionComponent::calculate( double x ) const
 	return mFunction( x );
 }
 
+void FunctionComponent::calculateBatch( std::span< const double > xs, std::span< double > ys ) const
+{
+	if (xs.size( ) != ys.size( ))
+	{
+		throw std::invalid_argument( "FunctionComponent::calculateBatch: xs and ys must have the same size." );
+	}
+
+	if (mBatchFunction)
+	{
+		mBatchFunction( xs, ys );
+		return;
+	}
+
+	if (!mFunction)
+	{
+		throw std::runtime_error( "FunctionComponent: no function defined." );
+	}
+
+	for (size_t i = 0; i < xs.size( ); ++i)
+	{
+		ys[ i ] = mFunction( xs[ i ] );
+	}
+}
+
+bool FunctionComponent::hasBatchFunction( ) const
+{
+	return static_cast< bool >( mBatchFunction );
+}
+
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 -> Public method: debug.
@@ -47,7 +92,11 @@ double FunctionComponent::calculate( double x ) const
 
 void FunctionComponent::debugPrint( ) const
 {
-	if (mFunction)
+	if (mBatchFunction)
+	{
+		std::cout << "FunctionComponent: batch function is set and callable.\n";
+	}
+	else if (mFunction)
 	{
 		std::cout << "FunctionComponent: function is set and callable.\n";
 	}
@@ -9,6 +9,7 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #define W_FUNCTION_COMPONENT_HPP
 
 #include <functional>
+#include <span>
 #include <stdexcept>
 
 #include "../srcEntity/wComponent.hpp"
@@ -23,6 +24,11 @@ namespace wEngine
 	 * This component wraps a `std::function< double( double ) >` and provides
 	 * an interface to evaluate the function at any given x-coordinate.
 	 * It is mainly used by FunctionEntity to render mathematical curves.
+	 *
+	 * Alternatively, it can wrap a batch callable that fills a whole span of
+	 * ordinates per call (`void( std::span< const double >, std::span< double > )`).
+	 * A single indirect call then covers the entire grid, which lets users plug in
+	 * SIMD or Eigen-backed kernels.
 	 * 
 	 * @author Wilfried Koch
 	 * @copyright © 2025 Wilfried Koch. All rights reserved.
@@ -31,6 +37,11 @@ namespace wEngine
 	class FunctionComponent : public Component
 	{
 		public:
+			/**
+			 * @brief Batch callable: writes f(xs[i]) into ys[i] for every i (both spans have the same size).
+			 */
+			using BatchFunction = std::function< void( std::span< const double >, std::span< double > ) >;
+
 			/**
 			 * @brief Constructs a FunctionComponent with a given function.
 			 * @param function A callable object of type double( double ).
@@ -38,6 +49,13 @@ namespace wEngine
 			 */
 			FunctionComponent( std::function< double( double ) > function );
 
+			/**
+			 * @brief Constructs a FunctionComponent with a batch function.
+			 * @param function A callable object of type void( std::span< const double >, std::span< double > ).
+			 * @throw std::invalid_argument if the provided function is empty.
+			 */
+			FunctionComponent( BatchFunction function );
+
 			/*
 			 * @brief Virtual destructor.
 			 */
@@ -51,12 +69,32 @@ namespace wEngine
 			 */
 			[[nodiscard]] double calculate( double x ) const;
 
+			/**
+			 * @brief Evaluates the stored function on a whole range of abscissas.
+			 *
+			 * A batch function is called once for the entire range; a scalar function
+			 * is called once per element.
+			 *
+			 * @param xs Input abscissas.
+			 * @param ys Output ordinates (same size as xs).
+			 * @throw std::invalid_argument if xs and ys differ in size.
+			 * @throw std::runtime_error if no function is set.
+			 */
+			void calculateBatch( std::span< const double > xs, std::span< double > ys ) const;
+
+			/**
+			 * @brief Checks whether the component wraps a batch function.
+			 * @return True if constructed from a BatchFunction.
+			 */
+			[[nodiscard]] bool hasBatchFunction( ) const;
+
 			/*
 			 * @brief Prints a message confirming that the function is set.
 			 */
 			void debugPrint( ) const;
 		private:
 			std::function< double( double ) > mFunction;
+			BatchFunction mBatchFunction;
 	};
 
 }//End of namespace wEngine
@@ -39,6 +39,7 @@ void LengthComponent::setLength( float newLength )
 {
 	validatePositive( newLength );
 	mLength = newLength;
+	markDirty( );
 }
 
 /*
@@ -39,6 +39,7 @@ LineStyleComponent::LineStyle LineStyleComponent::getStyle( ) const
 void LineStyleComponent::setStyle( LineStyle style )
 {
 	mStyle = style;
+	markDirty( );
 }
 
 float LineStyleComponent::getDashLength( ) const
@@ -53,6 +54,7 @@ void LineStyleComponent::setDashLength( float dashLength )
 		throw std::invalid_argument( "LineStyleComponent: dash length must be > 0." );
 	}
 	mDashLength = dashLength;
+	markDirty( );
 }
 
 float LineStyleComponent::getGapLength( ) const
@@ -67,6 +69,7 @@ void LineStyleComponent::setGapLength( float gapLength )
 		throw std::invalid_argument( "LineStyleComponent: gap length cannot be negative." );
 	}
 	mGapLength = gapLength;
+	markDirty( );
 }
 
 /*
@@ -38,6 +38,7 @@ void NotchIntervalComponent::setInterval( float newInterval )
 {
 	validateInterval( newInterval );
 	mInterval = newInterval;
+	markDirty( );
 }
 
 /*
@@ -34,6 +34,7 @@ sf::Vector2f OffsetComponent::getOffset( ) const
 void OffsetComponent::setOffset( sf::Vector2f offset )
 {
 	mOffset = offset;
+	markDirty( );
 }
 
 /*
@@ -45,6 +46,7 @@ void OffsetComponent::setOffset( sf::Vector2f offset )
 void OffsetComponent::addOffset( sf::Vector2f delta )
 {
 	mOffset += delta;
+	markDirty( );
 }
 
 /*
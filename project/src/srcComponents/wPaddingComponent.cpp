@@ -32,6 +32,7 @@ void PaddingComponent::setPadding( sf::Vector2f padding )
 {
 	validatePositive( padding );
 	mPadding = padding;
+	markDirty( );
 }
 
 sf::Vector2f PaddingComponent::getPadding( ) const
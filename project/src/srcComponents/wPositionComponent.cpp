@@ -41,6 +41,7 @@ void PositionComponent::setPosition( sf::Vector2f newPosition )
 {
 	mLastPosition = mPosition;
 	mPosition = newPosition;
+	markDirty( );
 }
 
 /*
@@ -53,6 +54,7 @@ void PositionComponent::move( const sf::Vector2f& offset )
 {
 	mLastPosition = mPosition;
 	mPosition += offset;
+	markDirty( );
 }
 
 /*
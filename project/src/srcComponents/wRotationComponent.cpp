@@ -29,6 +29,7 @@ RotationComponent::RotationComponent( float angle )
 void RotationComponent::setAngle( float angle )
 {
 	mAngle = angle;
+	markDirty( );
 }
 
 float RotationComponent::getAngle( ) const
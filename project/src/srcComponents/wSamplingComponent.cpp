@@ -0,0 +1,88 @@
+/**
+ * @file wSamplingComponent.cpp
+ * @brief Implementation of the SamplingComponent class.
+ */
+
+#include "wSamplingComponent.hpp"
+
+#include <stdexcept>
+
+namespace wEngine
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Constructors and destructors.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+SamplingComponent::SamplingComponent( SamplingMode mode, unsigned int maxDepth, float tolerance )
+:	mMode{ mode },
+	mMaxDepth{ 10 },
+	mTolerance{ 0.5f }
+{
+	setMaxDepth( maxDepth );
+	setTolerance( tolerance );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods: accessors and mutators.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+SamplingComponent::SamplingMode SamplingComponent::getMode( ) const
+{
+	return mMode;
+}
+
+void SamplingComponent::setMode( SamplingMode mode )
+{
+	mMode = mode;
+	markDirty( );
+}
+
+unsigned int SamplingComponent::getMaxDepth( ) const
+{
+	return mMaxDepth;
+}
+
+void SamplingComponent::setMaxDepth( unsigned int maxDepth )
+{
+	if (maxDepth > 30)
+	{
+		throw std::invalid_argument( "SamplingComponent: max depth must be <= 30." );
+	}
+	mMaxDepth = maxDepth;
+	markDirty( );
+}
+
+float SamplingComponent::getTolerance( ) const
+{
+	return mTolerance;
+}
+
+void SamplingComponent::setTolerance( float tolerance )
+{
+	if (tolerance <= 0.0f)
+	{
+		throw std::invalid_argument( "SamplingComponent: tolerance must be > 0." );
+	}
+	mTolerance = tolerance;
+	markDirty( );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public method: debug.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void SamplingComponent::debugPrint( ) const
+{
+	std::cout	<< "Sampling: "			<< (mMode == SamplingMode::Adaptive ? "Adaptive" : "Uniform")
+				<< " | Max depth: "		<< mMaxDepth
+				<< " | Tolerance: "		<< mTolerance << " px\n";
+}
+
+}//End of namespace wEngine
\ No newline at end of file
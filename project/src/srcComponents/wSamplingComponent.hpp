@@ -0,0 +1,111 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_SAMPLING_COMPONENT_HPP
+#define W_SAMPLING_COMPONENT_HPP
+
+#include "../srcEntity/wComponent.hpp"
+
+namespace wEngine
+{
+
+	/**
+	 * @class SamplingComponent
+	 * @brief ECS component that defines how a function is sampled before rendering.
+	 *
+	 * - `Uniform`: the function is evaluated on an evenly spaced grid.
+	 * - `Adaptive`: a coarse grid is refined recursively where the curve bends on screen,
+	 *   until the midpoint-to-chord distance drops below a pixel tolerance or the maximum
+	 *   recursion depth is reached (see MathUtils::adaptiveSample( )).
+	 *
+	 * ### Usage Example:
+	 *	@code
+	 *		addComponent< wEngine::SamplingComponent >( wEngine::SamplingComponent::SamplingMode::Adaptive, 10, 0.5f );
+	 *	@endcode
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class SamplingComponent : public Component
+	{
+		public:
+			/**
+			 * @enum SamplingMode
+			 * @brief Available sampling strategies.
+			 */
+			enum class SamplingMode
+			{
+				Uniform,
+				Adaptive
+			};
+
+			/**
+			 * @brief Constructs a SamplingComponent.
+			 * @param mode		Sampling strategy (default: Uniform).
+			 * @param maxDepth	Maximum number of bisections per coarse interval (Adaptive only, default: 10).
+			 * @param tolerance	Maximum screen-space error in pixels (Adaptive only, default: 0.5).
+			 * @throw std::invalid_argument if maxDepth > 30 or tolerance <= 0.
+			 */
+			SamplingComponent( SamplingMode mode = SamplingMode::Uniform, unsigned int maxDepth = 10, float tolerance = 0.5f );
+
+			/*
+			 * @brief Virtual destructor.
+			 */
+			virtual ~SamplingComponent( ) = default;
+
+			/**
+			 * @brief Returns the current sampling strategy.
+			 * @return Uniform or Adaptive.
+			 */
+			[[nodiscard]] SamplingMode getMode( ) const;
+
+			/**
+			 * @brief Sets the sampling strategy.
+			 * @param mode New sampling strategy.
+			 */
+			void setMode( SamplingMode mode );
+
+			/**
+			 * @brief Returns the maximum recursion depth used in Adaptive mode.
+			 * @return Maximum number of bisections per coarse interval.
+			 */
+			[[nodiscard]] unsigned int getMaxDepth( ) const;
+
+			/**
+			 * @brief Sets the maximum recursion depth used in Adaptive mode.
+			 * @param maxDepth Maximum number of bisections per coarse interval (<= 30).
+			 * @throw std::invalid_argument if maxDepth > 30.
+			 */
+			void setMaxDepth( unsigned int maxDepth );
+
+			/**
+			 * @brief Returns the screen-space tolerance used in Adaptive mode.
+			 * @return Tolerance in pixels.
+			 */
+			[[nodiscard]] float getTolerance( ) const;
+
+			/**
+			 * @brief Sets the screen-space tolerance used in Adaptive mode.
+			 * @param tolerance Tolerance in pixels (must be > 0).
+			 * @throw std::invalid_argument if tolerance <= 0.
+			 */
+			void setTolerance( float tolerance );
+
+			/*
+			 * @brief Outputs the current sampling settings to the console.
+			 */
+			void debugPrint( ) const;
+		private:
+			SamplingMode mMode;
+			unsigned int mMaxDepth;
+			float mTolerance;
+	};
+
+}//End of namespace wEngine
+
+#endif
\ No newline at end of file
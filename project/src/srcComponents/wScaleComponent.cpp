@@ -35,6 +35,7 @@ void ScaleComponent::setScale( sf::Vector2f newScale )
 {
 	validatePositive( newScale );
 	mScale = newScale;
+	markDirty( );
 }
 
 /*
@@ -38,6 +38,7 @@ void ThicknessComponent::setThickness( float newThickness )
 {
 	validatePositive( newThickness );
 	mThickness = newThickness;
+	markDirty( );
 }
 
 /*
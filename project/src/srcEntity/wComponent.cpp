@@ -4,6 +4,7 @@
  */
 
 #include "wComponent.hpp"
+#include "wEntity.hpp"
 
 namespace wEngine
 {
@@ -30,11 +31,13 @@ Component::Component( )
 void Component::enable( )
 {
 	mEnabled = true;
+	markDirty( );
 }
 
 void Component::disable( )
 {
 	mEnabled = false;
+	markDirty( );
 }
 
 bool Component::isEnabled( ) const
@@ -52,4 +55,18 @@ Entity* Component::getParent( ) const
 	return mParent;
 }
 
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Protected methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void Component::markDirty( )
+{
+	if (mParent)
+	{
+		mParent->markDirty( );
+	}
+}
+
 }//End of namespace wEngine
\ No newline at end of file
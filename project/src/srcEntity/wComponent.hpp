@@ -71,6 +71,14 @@ namespace wEngine
 			 */
 			Component( );
 
+			/**
+			 * @brief Flags the parent entity as dirty (no-op if the component has no parent).
+			 *
+			 * Derived components call it from every setter that changes their state, so that
+			 * the owning entity knows its cached geometry must be rebuilt.
+			 */
+			void markDirty( );
+
 		private:
 			bool mEnabled;
 			Entity* mParent;
@@ -15,16 +15,23 @@ namespace wEngine
 */
 
 Entity::Entity( )
-:	mEntityID{ generateNextEntityID( ) }
+:	mEntityID{ generateNextEntityID( ) },
+	mDirty{ true }
 {
 
 }
 
 Entity::~Entity( )
 {
-	for (auto& [ typeID, component ] : mComponents)
+	// Components are shared and may outlive the entity: detach them first, so that neither
+	// disable( ) nor a later setter reaches this entity through markDirty( ).
+	for (auto& component : mComponents)
 	{
-		component->disable( );
+		if (component)
+		{
+			component->setParent( nullptr );
+			component->disable( );
+		}
 	}
 }
 
@@ -41,7 +48,54 @@ unsigned int Entity::getEntityID( ) const
 
 void Entity::clearComponents( )
 {
-	mComponents.clear( );
+	for (auto& component : mComponents)
+	{
+		if (component)
+		{
+			component->setParent( nullptr );
+			component.reset( );
+		}
+	}
+	mSignature.reset( );
+	mDirty = true;
+}
+
+void Entity::markDirty( )
+{
+	mDirty = true;
+}
+
+bool Entity::isDirty( ) const
+{
+	return mDirty;
+}
+
+void Entity::clearDirty( )
+{
+	mDirty = false;
+}
+
+const Signature& Entity::getSignature( ) const
+{
+	return mSignature;
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void Entity::throwMissingComponent( const char* typeName, std::string_view context )
+{
+	std::string msg = "Missing required component: ";
+	msg += typeName;
+	if (!context.empty( ))
+	{
+		msg += " in context: ";
+		msg += context;
+	}
+	throw std::runtime_error( msg );
 }
 
 /*
@@ -50,16 +104,33 @@ void Entity::clearComponents( )
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-unsigned int Entity::sEntityIDCounter = 0;
+std::atomic< unsigned int > Entity::sEntityIDCounter{ 0 };
+std::atomic< unsigned int > Entity::sEntityIDGeneration{ 0 };
 
 void Entity::resetEntityIDCounter( )
 {
-	sEntityIDCounter = 0;
+	sEntityIDCounter.store( 0, std::memory_order_relaxed );
+	sEntityIDGeneration.fetch_add( 1, std::memory_order_release );
 }
 
 unsigned int Entity::generateNextEntityID( )
 {
-	return sEntityIDCounter++;
+	// Each thread hands out IDs from its own block and only touches the shared counter once per
+	// block, so building entities concurrently neither races nor contends. IDs stay unique but are
+	// only contiguous within a thread. A reset invalidates the blocks through the generation.
+	thread_local unsigned int next = 0;
+	thread_local unsigned int blockEnd = 0;
+	thread_local unsigned int generation = 0;
+
+	unsigned int currentGeneration = sEntityIDGeneration.load( std::memory_order_acquire );
+	if (next == blockEnd || generation != currentGeneration)
+	{
+		next = sEntityIDCounter.fetch_add( EntityIDBlockSize, std::memory_order_relaxed );
+		blockEnd = next + EntityIDBlockSize;
+		generation = currentGeneration;
+	}
+
+	return next++;
 }
 
 } // namespace wEngine
\ No newline at end of file
@@ -8,9 +8,13 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #ifndef W_ENTITY_HPP
 #define W_ENTITY_HPP
 
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <memory>
-#include <unordered_map>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "wComponent.hpp"
@@ -18,14 +22,22 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 namespace wEngine
 {
 
+	/**
+	 * @brief Maximum number of distinct component types (size of the per-entity component table).
+	 */
+	inline constexpr std::size_t MaxComponentTypes = 32;
+
 	/*
 	 * @brief Generates a new unique component type ID.
+	 *
+	 * Thread-safe: entities (and their components) may be built concurrently.
+	 *
 	 * @return A unique integer for component type identification.
 	 */
 	inline std::size_t getNextComponentTypeID( )
 	{
-		static std::size_t componentTypeCounter = 0;
-		return componentTypeCounter++;
+		static std::atomic< std::size_t > componentTypeCounter{ 0 };
+		return componentTypeCounter.fetch_add( 1, std::memory_order_relaxed );
 	}
 
 	/*
@@ -40,16 +52,39 @@ namespace wEngine
 		return componentTypeID;
 	}
 
+	/**
+	 * @brief Set of component types held by an entity (bit i = component type ID i).
+	 */
+	using Signature = std::bitset< MaxComponentTypes >;
+
+	/**
+	 * @brief Builds the signature made of the given component types.
+	 * @tparam ComponentTypes Component types to include.
+	 * @return Signature with the bits of every given type set.
+	 */
+	template< typename... ComponentTypes >
+	Signature makeSignature( )
+	{
+		Signature signature;
+		( signature.set( getComponentTypeID< ComponentTypes >( ) ), ... );
+		return signature;
+	}
+
 	/**
 	 * @class Entity
 	 * @brief Represents an entity in the ECS (Entity-Component System) architecture.
 	 *
 	 * Each entity is uniquely identified and can dynamically manage a collection of components.
-	 * Components are stored in a type-safe map and accessed by type.
+	 * Components are stored in a fixed-size table indexed by their type ID (see getComponentTypeID( )),
+	 * so that access by type is a single array read, without hashing nor dynamic cast.
 	 * 
 	 * The class provides utility methods to add, remove, retrieve and query components,
 	 * as well as retrieve components through interfaces.
 	 *
+	 * Each entity carries a dirty flag, raised whenever a component is added, removed or
+	 * modified through one of its setters. Drawable entities use it to rebuild their cached
+	 * geometry only when something changed, and replay the cache otherwise.
+	 *
 	 * @note Entities do not define behavior directly: behavior is defined by the components attached to them.
 	 *
 	 * @author Wilfried Koch
@@ -65,7 +100,7 @@ namespace wEngine
 			Entity( );
 
 			/*
-			 * @brief Destructor. Disables all attached components before destruction.
+			 * @brief Destructor. Detaches and disables all attached components before destruction.
 			 */
 			virtual ~Entity( );
 
@@ -77,17 +112,46 @@ namespace wEngine
 
 			/**
 			 * @brief Removes all components currently attached to the entity.
+			 *
+			 * The removed components are detached (their parent is reset), so components still
+			 * referenced elsewhere no longer mark this entity dirty.
 			 */
 			void clearComponents( );
 
 			/**
 			 * @brief Resets the global entity ID counter to zero.
 			 *
-			 * This affects all subsequently created entities.
-			 * Use with caution, especially in multi-entity systems.
+			 * This affects all subsequently created entities, in every thread.
+			 * Use with caution, especially in multi-entity systems: it must not run
+			 * while other threads are creating entities.
 			 */
 			static void resetEntityIDCounter( );
 
+			/**
+			 * @brief Flags the entity as modified since its last rebuild.
+			 *
+			 * Called automatically by component setters. Call it manually when the entity depends
+			 * on external state that changed (e.g. a plotted function that reads global data).
+			 */
+			void markDirty( );
+
+			/**
+			 * @brief Checks whether the entity changed since its cached state was last rebuilt.
+			 * @return True if the entity is dirty (always true for a new entity).
+			 */
+			[[nodiscard]] bool isDirty( ) const;
+
+			/**
+			 * @brief Clears the dirty flag once the cached state has been rebuilt.
+			 */
+			void clearDirty( );
+
+			/**
+			 * @brief Returns the set of component types currently attached to the entity.
+			 * @return Component signature (see makeSignature( )).
+			 */
+			[[nodiscard]] const Signature& getSignature( ) const;
+
 			/**
 			 * @brief Adds a new component of type T to the entity.
 			 * 
@@ -99,6 +163,7 @@ namespace wEngine
 			 * @return Shared pointer to the newly created component.
 			 * 
 			 * @throws std::runtime_error if a component of the same type already exists in the entity.
+			 * @throws std::length_error if more than MaxComponentTypes component types are in use.
 			 */
 			template< typename T, typename... Args >
 			std::shared_ptr< T > addComponent( Args&&... args )
@@ -106,7 +171,11 @@ namespace wEngine
 				static_assert( std::is_base_of< Component, T >::value, "T must be derived from Component" );
 
 				auto typeID = getComponentTypeID< T >( );
-				if (mComponents.contains( typeID ))
+				if (typeID >= MaxComponentTypes)
+				{
+					throw std::length_error( "Too many component types: raise wEngine::MaxComponentTypes" );
+				}
+				if (mComponents[ typeID ])
 				{
 					std::cerr << "Warning: Component " << typeid( T ).name( )
 					          << " already exists in entity " << mEntityID << std::endl;
@@ -116,6 +185,8 @@ namespace wEngine
 				auto component = std::make_shared< T >( std::forward< Args >( args )... );
 				component->setParent( this );
 				mComponents[ typeID ] = component;
+				mSignature.set( typeID );
+				mDirty = true;
 
 				return component;
 			}
@@ -123,7 +194,8 @@ namespace wEngine
 			/**
 			 * @brief Removes the component of type T from the entity.
 			 * 
-			 * If no such component exists, this operation does nothing.
+			 * If no such component exists, this operation does nothing. The removed component
+			 * is detached from the entity (see clearComponents( )).
 			 * 
 			 * @tparam T Component type to remove.
 			 */
@@ -133,7 +205,13 @@ namespace wEngine
 				static_assert( std::is_base_of< Component, T >::value, "T must be derived from Component" );
 
 				auto typeID = getComponentTypeID< T >( );
-				mComponents.erase( typeID );
+				if (typeID < MaxComponentTypes && mComponents[ typeID ])
+				{
+					mComponents[ typeID ]->setParent( nullptr );
+					mComponents[ typeID ].reset( );
+					mSignature.reset( typeID );
+					mDirty = true;
+				}
 			}
 
 			/**
@@ -147,7 +225,8 @@ namespace wEngine
 			{
 				static_assert( std::is_base_of< Component, T >::value, "T must be derived from Component" );
 
-				return mComponents.contains( getComponentTypeID< T >( ) );
+				auto typeID = getComponentTypeID< T >( );
+				return typeID < MaxComponentTypes && mComponents[ typeID ] != nullptr;
 			}
 
 			/**
@@ -162,13 +241,13 @@ namespace wEngine
 				static_assert( std::is_base_of< Component, T >::value, "T must be derived from Component" );
 
 				auto typeID = getComponentTypeID< T >( );
-				auto it = mComponents.find( typeID );
-				if (it != mComponents.end( ))
+				if (typeID >= MaxComponentTypes)
 				{
-					return std::dynamic_pointer_cast< T >( it->second );
+					return nullptr;
 				}
 
-				return nullptr;
+				// The slot of a type ID only ever holds components of that exact type
+				return std::static_pointer_cast< T >( mComponents[ typeID ] );
 			}
 
 			/**
@@ -184,22 +263,63 @@ namespace wEngine
 			 * @throws std::runtime_error if the component is not found.
 			 */
 			template< typename T >
-			[[nodiscard]] std::shared_ptr< T > requireComponent( const std::string& context = "" ) const
+			[[nodiscard]] std::shared_ptr< T > requireComponent( std::string_view context = { } ) const
 			{
 				static_assert( std::is_base_of< Component, T >::value, "T must be derived from Component" );
 
-				if (!hasComponent< T >( ))
+				auto component = getComponent< T >( );
+				if (!component)
 				{
-					std::string msg = "Missing required component: ";
-					msg += typeid( T ).name( );
-					if (!context.empty( ))
-					{
-						msg += " in context: " + context;
-					}
-					throw std::runtime_error( msg );
+					throwMissingComponent( typeid( T ).name( ), context );
+				}
+
+				return component;
+			}
+
+			/**
+			 * @brief Returns a non-owning pointer to the component of type T.
+			 *
+			 * Unlike getComponent( ), no shared_ptr is copied: use it on hot paths (rendering)
+			 * where the entity outlives the access.
+			 *
+			 * @tparam T Component type to retrieve.
+			 * @return Pointer to the component, or nullptr if absent.
+			 */
+			template< typename T >
+			[[nodiscard]] T* tryComponent( ) const noexcept
+			{
+				static_assert( std::is_base_of< Component, T >::value, "T must be derived from Component" );
+
+				auto typeID = getComponentTypeID< T >( );
+				if (typeID >= MaxComponentTypes)
+				{
+					return nullptr;
 				}
 
-				return getComponent< T >( );
+				return static_cast< T* >( mComponents[ typeID ].get( ) );
+			}
+
+			/**
+			 * @brief Returns a reference to the component of type T and throws if it's missing.
+			 *
+			 * Non-owning counterpart of requireComponent( ). The error message is only built
+			 * when the component is missing.
+			 *
+			 * @tparam T Component type to retrieve.
+			 * @param context Optional context of the call (e.g., method name).
+			 * @return Reference to the component, valid while it stays attached to the entity.
+			 * @throws std::runtime_error if the component is not found.
+			 */
+			template< typename T >
+			[[nodiscard]] T& component( std::string_view context = { } ) const
+			{
+				T* component = tryComponent< T >( );
+				if (!component)
+				{
+					throwMissingComponent( typeid( T ).name( ), context );
+				}
+
+				return *component;
 			}
 
 			/**
@@ -214,8 +334,13 @@ namespace wEngine
 			template< typename Interface >
 			[[nodiscard]] std::shared_ptr< Interface > getInterfaceComponent( ) const
 			{
-				for (const auto& [ typeID, component ] : mComponents)
+				for (const auto& component : mComponents)
 				{
+					if (!component)
+					{
+						continue;
+					}
+
 					auto interfaceComponent = std::dynamic_pointer_cast< Interface >( component );
 					if (interfaceComponent)
 					{
@@ -227,9 +352,22 @@ namespace wEngine
 
 		private:
 			unsigned int mEntityID;
-			std::unordered_map< std::size_t, std::shared_ptr< Component > > mComponents;
+			bool mDirty;
+			std::array< std::shared_ptr< Component >, MaxComponentTypes > mComponents;
+			Signature mSignature;
+
+			/**
+			 * @brief Internal: builds the error message of a missing required component and throws it.
+			 */
+			[[noreturn]] static void throwMissingComponent( const char* typeName, std::string_view context );
+
+			/**
+			 * @brief Number of entity IDs a thread reserves at once from the global counter.
+			 */
+			static constexpr unsigned int EntityIDBlockSize = 256;
 
-			static unsigned int sEntityIDCounter;
+			static std::atomic< unsigned int > sEntityIDCounter;
+			static std::atomic< unsigned int > sEntityIDGeneration;
 			static unsigned int generateNextEntityID( );
 	};
 
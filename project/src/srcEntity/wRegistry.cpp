@@ -0,0 +1,51 @@
+/**
+ * @file wRegistry.cpp
+ * @brief Implementation of the Registry class.
+ */
+
+#include "wRegistry.hpp"
+
+#include <algorithm>
+
+namespace wEngine
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void Registry::add( Entity& entity )
+{
+	if (!contains( entity ))
+	{
+		mEntities.push_back( &entity );
+	}
+}
+
+void Registry::remove( Entity& entity )
+{
+	auto it = std::find( mEntities.begin( ), mEntities.end( ), &entity );
+	if (it != mEntities.end( ))
+	{
+		mEntities.erase( it );
+	}
+}
+
+bool Registry::contains( const Entity& entity ) const
+{
+	return std::find( mEntities.begin( ), mEntities.end( ), &entity ) != mEntities.end( );
+}
+
+size_t Registry::size( ) const
+{
+	return mEntities.size( );
+}
+
+void Registry::clear( )
+{
+	mEntities.clear( );
+}
+
+} // namespace wEngine
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_REGISTRY_HPP
+#define W_REGISTRY_HPP
+
+#include "wEntity.hpp"
+
+#include <vector>
+
+namespace wEngine
+{
+
+	/**
+	 * @class Registry
+	 * @brief Non-owning index of entities, queried by component signature.
+	 *
+	 * Systems (see System) use a registry to process, in a single pass, every registered entity
+	 * that holds a given set of components, e.g. all Position + Scale holders.
+	 * Matching is a bitset test against each entity's signature, and components are handed to
+	 * the callback by reference (no shared_ptr copies).
+	 *
+	 * Entities are registered by their owner and must be unregistered (or the registry cleared)
+	 * before they are destroyed.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class Registry
+	{
+		public:
+			/**
+			 * @brief Registers an entity (no-op if it is already registered).
+			 * @param entity Entity to index (not owned).
+			 */
+			void add( Entity& entity );
+
+			/**
+			 * @brief Unregisters an entity (no-op if it is not registered).
+			 * @param entity Entity to remove from the index.
+			 */
+			void remove( Entity& entity );
+
+			/**
+			 * @brief Checks whether an entity is registered.
+			 * @param entity Entity to look for.
+			 * @return True if registered.
+			 */
+			[[nodiscard]] bool contains( const Entity& entity ) const;
+
+			/**
+			 * @brief Returns the number of registered entities.
+			 * @return Entity count.
+			 */
+			[[nodiscard]] size_t size( ) const;
+
+			/**
+			 * @brief Unregisters every entity.
+			 */
+			void clear( );
+
+			/**
+			 * @brief Calls @p function on every registered entity holding all the given component types.
+			 *
+			 * Entities are visited in registration order. The callback receives the entity followed
+			 * by a reference to each requested component:
+			 * `registry.each< PositionComponent, ScaleComponent >( []( Entity& e, PositionComponent& p, ScaleComponent& s ) { ... } );`
+			 *
+			 * @tparam ComponentTypes Required component types.
+			 * @param function Callback invoked as function( Entity&, ComponentTypes&... ).
+			 */
+			template< typename... ComponentTypes, typename Function >
+			void each( Function&& function )
+			{
+				const Signature required = makeSignature< ComponentTypes... >( );
+				for (Entity* entity : mEntities)
+				{
+					if ((entity->getSignature( ) & required) == required)
+					{
+						function( *entity, *entity->template tryComponent< ComponentTypes >( )... );
+					}
+				}
+			}
+
+			/**
+			 * @brief Counts the registered entities holding all the given component types.
+			 * @tparam ComponentTypes Required component types.
+			 * @return Number of matching entities.
+			 */
+			template< typename... ComponentTypes >
+			[[nodiscard]] size_t count( ) const
+			{
+				const Signature required = makeSignature< ComponentTypes... >( );
+				size_t matches = 0;
+				for (const Entity* entity : mEntities)
+				{
+					if ((entity->getSignature( ) & required) == required)
+					{
+						++matches;
+					}
+				}
+				return matches;
+			}
+
+		private:
+			std::vector< Entity* > mEntities;
+	};
+
+}// End of namespace wEngine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_SYSTEM_HPP
+#define W_SYSTEM_HPP
+
+#include "wRegistry.hpp"
+
+namespace wEngine
+{
+
+	/**
+	 * @class System
+	 * @brief Abstract base class for ECS systems.
+	 *
+	 * A system holds the behavior that entities and components do not define: it processes,
+	 * in one pass, every entity of a Registry that holds the components it works on
+	 * (see Registry::each( )).
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class System
+	{
+		public:
+			/**
+			 * @brief Virtual destructor.
+			 */
+			virtual ~System( ) = default;
+
+			/**
+			 * @brief Processes the matching entities of the registry.
+			 * @param registry Registry to iterate.
+			 */
+			virtual void update( Registry& registry ) = 0;
+	};
+
+}// End of namespace wEngine
+
+#endif
\ No newline at end of file
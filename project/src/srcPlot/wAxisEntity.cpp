@@ -13,11 +13,26 @@
 #include "../srcComponents/wNotchIntervalComponent.hpp"
 #include "../srcComponents/wLengthComponent.hpp"
 
+#include "../srcUtils/wMathUtils.hpp"
+
 #include<cmath>
 
 namespace wPlot2D
 {
 
+namespace
+{
+	// Length of the notches when they are created (and reference distance of the labels from the axis).
+	constexpr float DefaultNotchLength = 16.0f;
+
+	// Bounds on the number of notches: at most one every MinNotchSpacing pixels, and never more than MaxNotches.
+	constexpr float MinNotchSpacing = 2.0f;
+	constexpr double MaxNotches = 4096.0;
+
+	// Minimum free space between two drawn labels, in pixels.
+	constexpr float LabelGap = 6.0f;
+}
+
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 -> Constructors and destructors.
@@ -26,13 +41,20 @@ namespace wPlot2D
 
 AxisEntity::AxisEntity( sf::Font& font, sf::Vector2f origin, sf::Vector2f scale, sf::Vector2f offset, AxisType type, sf::Vector2f axisRange )
 :	mTitleFont{ font },
-	mLabelsFont{ font },
 	mAxisType{ type },
 	mAxisRange{ axisRange },
 	mArrowSize{ 4.0f },
+	mNotchInterval{ 0.0 },
+	mAutoNotches{ false },
+	mAutoNotchSpacing{ 60.0f },
 	mNotchPosition{ NotchPosition::Center },
-	mHasLabels{ false }
+	mHasLabels{ false },
+	mLabelAnchorThickness{ 0.0f },
+	mLabelStride{ 1 },
+	mLabelStyle{ }
 {
+	mLabelStyle.mFont = &font;
+
 	addComponent< wEngine::PositionComponent >( origin );
 	addComponent< wEngine::ScaleComponent >( scale );
 	addComponent< wEngine::OffsetComponent >( offset );
@@ -63,6 +85,12 @@ void AxisEntity::setThickness( float thickness )
 void AxisEntity::setArrowSize( float arrowSize )
 {
 	mArrowSize = arrowSize;
+	markDirty( );
+}
+
+sf::Vector2f AxisEntity::getAxisRange( ) const
+{
+	return mAxisRange;
 }
 
 /*
@@ -107,103 +135,140 @@ void AxisEntity::setTitleColor( sf::Color newColor )
 
 void AxisEntity::addNotches( float interval, NotchPosition position, bool hasLabels )
 {
+	if (!(interval > 0.0f))
+	{
+		throw std::invalid_argument( "AxisEntity::addNotches error: interval must be > 0." );
+	}
+
 	addComponent< wEngine::NotchIntervalComponent >( interval );
 	mNotchPosition = position;
+	mAutoNotches = false;
+
+	mHasLabels = hasLabels;
+
+	// A new set of notches starts from the axis style.
+	mNotches.reset( );
+	initNotches( );
+}
+
+void AxisEntity::addAutoNotches( NotchPosition position, bool hasLabels, float minSpacing )
+{
+	if (!(minSpacing > 0.0f))
+	{
+		throw std::invalid_argument( "AxisEntity::addAutoNotches error: minSpacing must be > 0." );
+	}
+
+	mNotchPosition = position;
+	mAutoNotches = true;
+	mAutoNotchSpacing = minSpacing;
 
 	mHasLabels = hasLabels;
 
+	// A new set of notches starts from the axis style.
+	mNotches.reset( );
 	initNotches( );
 }
 
+double AxisEntity::getNotchesInterval( ) const
+{
+	return mNotches ? mNotchInterval : 0.0;
+}
+
 void AxisEntity::setNotchesColor( const sf::Color& color )
 {
-	for (auto& notch : mNotches)
+	if (!mNotches)
 	{
-		auto colorComponent = notch->requireComponent< wEngine::ColorComponent >( "AxisEntity::setNotchesColor( )" );
-		colorComponent->setColor( color );
+		return;
 	}
+
+	auto colorComponent = mNotches->requireComponent< wEngine::ColorComponent >( "AxisEntity::setNotchesColor( )" );
+	colorComponent->setColor( color );
 }
 
 void AxisEntity::setNotchesThickness( float newThickness )
 {
-	for (auto& notch : mNotches)
+	if (!mNotches)
 	{
-		auto thicknessComponent = notch->requireComponent< wEngine::ThicknessComponent >( "AxisEntity::setNotchesThickness( )" );
-		auto positionComponent = notch->requireComponent< wEngine::PositionComponent >( "AxisEntity::setNotchesThickness( )" );
+		return;
+	}
 
-		float oldThickness = thicknessComponent->getThickness( );
-		thicknessComponent->setThickness( newThickness );
+	auto thicknessComponent = mNotches->requireComponent< wEngine::ThicknessComponent >( "AxisEntity::setNotchesThickness( )" );
 
-		sf::Vector2f deltaNotches{ 0.0f, 0.0f };
+	float oldThickness = thicknessComponent->getThickness( );
+	thicknessComponent->setThickness( newThickness );
 
-		if (mAxisType == AxisType::X_AXIS)
-		{
-			deltaNotches.x = ( oldThickness - newThickness ) / 2.0f;
-		}
-		else
-		{
-			deltaNotches.y = ( oldThickness - newThickness ) / 2.0f;
-		}
+	sf::Vector2f deltaNotches{ 0.0f, 0.0f };
 
-		positionComponent->move( deltaNotches );
+	if (mAxisType == AxisType::X_AXIS)
+	{
+		deltaNotches.x = ( oldThickness - newThickness ) / 2.0f;
+	}
+	else
+	{
+		deltaNotches.y = ( oldThickness - newThickness ) / 2.0f;
 	}
+
+	mNotches->move( deltaNotches );
 }
 
 void AxisEntity::setNotchesLength( float newLength )
 {
-	sf::Vector2f deltaLabel{ 0.0f, 0.0f };
-
-	for (auto& notch : mNotches)
+	if (!mNotches)
 	{
-		auto lengthComponent = notch->requireComponent< wEngine::LengthComponent >( "AxisEntity::setNotchesLength( )" );
-		auto positionComponent = notch->requireComponent< wEngine::PositionComponent >( "AxisEntity::setNotchesLength( )" );
+		return;
+	}
 
-		float oldLength = lengthComponent->getLength( );
-		lengthComponent->setLength( newLength );
+	auto lengthComponent = mNotches->requireComponent< wEngine::LengthComponent >( "AxisEntity::setNotchesLength( )" );
 
-		sf::Vector2f deltaNotches{ 0.0f, 0.0f };
-		
-		if (mAxisType == AxisType::X_AXIS)
+	float oldLength = lengthComponent->getLength( );
+	lengthComponent->setLength( newLength );
+
+	sf::Vector2f deltaNotches{ 0.0f, 0.0f };
+	sf::Vector2f deltaLabel{ 0.0f, 0.0f };
+
+	if (mAxisType == AxisType::X_AXIS)
+	{
+		if (mNotchPosition == NotchPosition::Center)
 		{
-			if (mNotchPosition == NotchPosition::Center)
-			{
-				deltaNotches.y = (oldLength - newLength) / 2.0f;
-				deltaLabel.y = -(oldLength - newLength) / 2.0f;
-			}
-			else if (mNotchPosition == NotchPosition::Above)
-			{
-				deltaNotches.y = oldLength - newLength;
-				deltaLabel.y = 0.0f;
-			}
-			else if (mNotchPosition == NotchPosition::Below)
-			{
-				deltaNotches.y = 0.0f;
-				deltaLabel.y = -(oldLength - newLength);
-			}
+			deltaNotches.y = (oldLength - newLength) / 2.0f;
+			deltaLabel.y = -(oldLength - newLength) / 2.0f;
 		}
-		else if (mAxisType == AxisType::Y_AXIS)
+		else if (mNotchPosition == NotchPosition::Above)
 		{
-			if (mNotchPosition == NotchPosition::Center)
-			{
-				deltaNotches.x = (oldLength - newLength) / 2.0f;
-				deltaLabel.x = deltaNotches.x;
-			}
-			else if (mNotchPosition == NotchPosition::Above)
-			{
-				deltaNotches.x = 0.0f;
-				deltaLabel.x = 0.0f;
-			}
-			else if (mNotchPosition == NotchPosition::Below)
-			{
-				deltaNotches.x = (oldLength - newLength);
-				deltaLabel.x = (oldLength - newLength);
-			}
+			deltaNotches.y = oldLength - newLength;
+			deltaLabel.y = 0.0f;
+		}
+		else if (mNotchPosition == NotchPosition::Below)
+		{
+			deltaNotches.y = 0.0f;
+			deltaLabel.y = -(oldLength - newLength);
+		}
+	}
+	else if (mAxisType == AxisType::Y_AXIS)
+	{
+		if (mNotchPosition == NotchPosition::Center)
+		{
+			deltaNotches.x = (oldLength - newLength) / 2.0f;
+			deltaLabel.x = deltaNotches.x;
+		}
+		else if (mNotchPosition == NotchPosition::Above)
+		{
+			deltaNotches.x = 0.0f;
+			deltaLabel.x = 0.0f;
+		}
+		else if (mNotchPosition == NotchPosition::Below)
+		{
+			deltaNotches.x = (oldLength - newLength);
+			deltaLabel.x = (oldLength - newLength);
 		}
-
-		positionComponent->move( deltaNotches );
 	}
 
-	addLabelsOffset( deltaLabel );
+	mNotches->move( deltaNotches );
+
+	if (mNotches->getCount( ) > 0)
+	{
+		addLabelsOffset( deltaLabel );
+	}
 }
 
 /*
@@ -214,6 +279,8 @@ void AxisEntity::setNotchesLength( float newLength )
 
 void AxisEntity::setLabelsFont( const sf::Font& font )
 {
+	mLabelStyle.mFont = &font;
+
 	for (auto& labels : mLabels)
 	{
 		labels->setFont( font );
@@ -222,6 +289,8 @@ void AxisEntity::setLabelsFont( const sf::Font& font )
 
 void AxisEntity::setLabelsColor( const sf::Color& color )
 {
+	mLabelStyle.mColor = color;
+
 	for (auto& labels : mLabels)
 	{
 		auto colorComponent = labels->requireComponent< wEngine::ColorComponent >( "AxisEntity::setLabelsColor( )" );
@@ -244,6 +313,8 @@ std::vector< sf::Vector2f > AxisEntity::getLabelsOffset( ) const
 
 void AxisEntity::setLabelsOffset( sf::Vector2f offset )
 {
+	mLabelStyle.mOffset = offset;
+
 	for (auto& labels : mLabels)
 	{
 		auto offsetComponent = labels->requireComponent< wEngine::OffsetComponent >( "AxisEntity::setLabelsOffset( )" );
@@ -253,6 +324,8 @@ void AxisEntity::setLabelsOffset( sf::Vector2f offset )
 
 void AxisEntity::addLabelsOffset( sf::Vector2f delta )
 {
+	mLabelStyle.mOffset += delta;
+
 	for (auto& labels : mLabels)
 	{
 		auto offsetComponent = labels->requireComponent< wEngine::OffsetComponent >( "AxisEntity::setLabelsOffset( )" );
@@ -262,37 +335,52 @@ void AxisEntity::addLabelsOffset( sf::Vector2f delta )
 
 void AxisEntity::setLabelsCharacterSize( unsigned int newSize )
 {
+	mLabelStyle.mCharacterSize = newSize;
+
 	for (auto& labels : mLabels)
 	{
 		labels->setCharacterSize( newSize );
 	}
+
+	// Wider or narrower labels change how many of them fit.
+	markDirty( );
 }
 
 void AxisEntity::setLabelsDecimalPlaces( int places )
 {
+	mLabelStyle.mDecimalPlaces = places;
+
 	for (auto& labels : mLabels)
 	{
 		labels->setDecimalPlaces( places );
 	}
+
+	markDirty( );
+}
+
+void AxisEntity::setLabelsNotation( wEngine::NumberFormatter::Notation notation )
+{
+	mLabelFormatter.setNotation( notation );
+
+	for (auto& labels : mLabels)
+	{
+		labels->markDirty( );
+	}
+
+	markDirty( );
+}
+
+wEngine::NumberFormatter::Notation AxisEntity::getLabelsNotation( ) const
+{
+	return mLabelFormatter.getNotation( );
 }
 
 void AxisEntity::setCustomLabels( const std::vector< std::string >& labels )
 {
-	mLabels.erase(
-		std::remove_if(
-			mLabels.begin( ),
-			mLabels.end( ),
-			[ & ]( std::unique_ptr< LabelEntity >& label )
-			{
-				size_t index = static_cast< size_t >( label->getValue( ) );
-				if (index < labels.size( ))
-				{
-					label->setCustomLabels( labels[ index ] );
-					return false;
-				}
-				return true;
-			} ),
-		mLabels.end( ) );
+	mCustomLabels = labels;
+	applyCustomLabels( );
+
+	markDirty( );
 }
 
 /*
@@ -301,9 +389,15 @@ void AxisEntity::setCustomLabels( const std::vector< std::string >& labels )
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-void AxisEntity::render( sf::RenderWindow& window )
+void AxisEntity::render( sf::RenderTarget& window )
 {
-	construct( );
+	// The layout (axis line, title, notches, label anchors) is only recomputed after a change of
+	// origin, scale, offset or style; otherwise render is a pure replay of cached geometry.
+	if (isDirty( ) || !mAxisLine)
+	{
+		layout( );
+		clearDirty( );
+	}
 
 	if (mAxisLine)
 	{
@@ -315,15 +409,23 @@ void AxisEntity::render( sf::RenderWindow& window )
 		mTitle->render( window );
 	}
 
-	for (auto& notch : mNotches)
+	if (mNotches)
 	{
-		notch->render( window );
+		mNotches->render( window );
 	}
 
+	mLabelBatch.clear( );
 	for (auto& labels : mLabels)
 	{
-		labels->render( window );
+		// Overlapping labels are culled: only the multiples of mLabelStride notches are labelled.
+		if (mLabelStride > 1 && std::llround( labels->getValue( ) / mNotchInterval ) % static_cast< long long >( mLabelStride ) != 0)
+		{
+			continue;
+		}
+
+		labels->appendTo( mLabelBatch );
 	}
+	mLabelBatch.draw( window );
 }
 
 /*
@@ -334,17 +436,17 @@ void AxisEntity::render( sf::RenderWindow& window )
 
 void AxisEntity::construct( )
 {
-	auto colorComponent = requireComponent< wEngine::ColorComponent >( "AxisEntity::construct( )" );
-	auto positionComponent = requireComponent< wEngine::PositionComponent >( "AxisEntity::construct( )" );
-	auto scaleComponent = requireComponent< wEngine::ScaleComponent >( "AxisEntity::construct( )" );
-	auto offsetComponent = requireComponent< wEngine::OffsetComponent >( "AxisEntity::construct( )" );
-	auto thicknessComponent = requireComponent< wEngine::ThicknessComponent >( "AxisEntity::construct( )" );
-
-	sf::Color color = colorComponent->getColor( );
-	sf::Vector2f origin = positionComponent->getPosition( );
-	sf::Vector2f scale = scaleComponent->getScale( );
-	sf::Vector2f offset = offsetComponent->getOffset( );
-	float thickness = thicknessComponent->getThickness( );
+	auto& colorComponent = component< wEngine::ColorComponent >( "AxisEntity::construct( )" );
+	auto& positionComponent = component< wEngine::PositionComponent >( "AxisEntity::construct( )" );
+	auto& scaleComponent = component< wEngine::ScaleComponent >( "AxisEntity::construct( )" );
+	auto& offsetComponent = component< wEngine::OffsetComponent >( "AxisEntity::construct( )" );
+	auto& thicknessComponent = component< wEngine::ThicknessComponent >( "AxisEntity::construct( )" );
+
+	sf::Color color = colorComponent.getColor( );
+	sf::Vector2f origin = positionComponent.getPosition( );
+	sf::Vector2f scale = scaleComponent.getScale( );
+	sf::Vector2f offset = offsetComponent.getOffset( );
+	float thickness = thicknessComponent.getThickness( );
 
 	sf::Vector2f start, end;
 	if (mAxisType == AxisType::X_AXIS)
@@ -380,6 +482,191 @@ template < typename T >
 void AxisEntity::initTitle( const T& title )
 {
 	mTitle = std::make_unique< TitleEntity >( mTitleFont, title );
+	layoutTitle( );
+}
+
+void AxisEntity::initNotches( )
+{
+	// Clear previous notch values and labels
+	mNotchValues.clear( );
+	mLabels.clear( );
+
+	double interval = chooseNotchInterval( );
+	mNotchInterval = interval;
+
+	// --- Notches share one style and are stored as a compact array of positions ---
+	// The entity is created once from the axis style and kept when the notches are regenerated,
+	// so the notch color, thickness and length set by the user survive interval changes.
+	if (!mNotches)
+	{
+		//--- Optional styling components (inherited from axis)
+		auto* colorComponent = tryComponent< wEngine::ColorComponent >( );
+		auto* thicknessComponent = tryComponent< wEngine::ThicknessComponent >( );
+
+		sf::Color axisColor = colorComponent ? colorComponent->getColor( ) : sf::Color::Black;
+		float axisThickness = thicknessComponent? thicknessComponent->getThickness( ) : 2.0f;
+
+		mNotches = std::make_unique< NotchEntity >( mAxisType, axisColor, axisThickness, DefaultNotchLength );
+
+		// Labels stay anchored where the notches were first placed (later style changes move them through their offset).
+		mLabelAnchorThickness = axisThickness;
+	}
+
+	// Automatic intervals are 1, 2 or 5 times a power of ten: show just enough decimals for them.
+	int decimalPlaces = mLabelStyle.mDecimalPlaces.value_or( 1 );
+	if (mAutoNotches && !mLabelStyle.mDecimalPlaces)
+	{
+		decimalPlaces = std::max( 0, -static_cast< int >( std::floor( std::log10( interval ) ) ) );
+	}
+
+	// --- Logical bounds, as integer multiples of the interval ---
+	// Notches are generated from an integer index (no accumulated floating-point error),
+	// and index 0 is exactly the origin, which is skipped.
+	long long first = static_cast< long long >( std::ceil( mAxisRange.x / interval ) );
+	long long last = static_cast< long long >( std::floor( mAxisRange.y / interval ) );
+
+	for (long long index = first; index <= last; ++index)
+	{
+		if (index == 0)
+		{
+			continue;
+		}
+
+		float unit = static_cast< float >( static_cast< double >( index ) * interval );
+		mNotchValues.push_back( unit );
+
+		if (mHasLabels)
+		{
+			auto labelEntity = std::make_unique< LabelEntity >( *mLabelStyle.mFont, mAxisType, sf::Vector2f( 0.0f, 0.0f ) );
+			labelEntity->setFormatter( &mLabelFormatter );
+			labelEntity->setCharacterSize( mLabelStyle.mCharacterSize );
+			labelEntity->setDecimalPlaces( decimalPlaces );
+			labelEntity->getComponent< wEngine::ColorComponent >( )->setColor( mLabelStyle.mColor );
+			labelEntity->getComponent< wEngine::OffsetComponent >( )->setOffset( mLabelStyle.mOffset );
+			labelEntity->setLabelText( labelEntity->formatLabel( unit ) );
+			mLabels.push_back( std::move( labelEntity ) );
+		}
+	}
+
+	if (!mCustomLabels.empty( ))
+	{
+		applyCustomLabels( );
+	}
+
+	mNotches->reserve( mNotchValues.size( ) );
+
+	layoutNotches( );
+}
+
+void AxisEntity::applyCustomLabels( )
+{
+	mLabels.erase(
+		std::remove_if(
+			mLabels.begin( ),
+			mLabels.end( ),
+			[ & ]( std::unique_ptr< LabelEntity >& label )
+			{
+				size_t index = static_cast< size_t >( label->getValue( ) );
+				if (index < mCustomLabels.size( ))
+				{
+					label->setCustomLabels( mCustomLabels[ index ] );
+					return false;
+				}
+				return true;
+			} ),
+		mLabels.end( ) );
+}
+
+double AxisEntity::chooseNotchInterval( ) const
+{
+	auto& scaleComponent = component< wEngine::ScaleComponent >( "AxisEntity::chooseNotchInterval( )" );
+	sf::Vector2f scale = scaleComponent.getScale( );
+
+	double span = static_cast< double >( mAxisRange.y ) - static_cast< double >( mAxisRange.x );
+	double pixelsPerUnit = std::fabs( static_cast< double >( mAxisType == AxisType::X_AXIS ? scale.x : scale.y ) );
+	double pixelLength = span * pixelsPerUnit;
+
+	if (mAutoNotches)
+	{
+		if (!(span > 0.0) || !(pixelLength > 0.0))
+		{
+			return span > 0.0 ? span : 1.0;
+		}
+
+		double maxTicks = std::clamp( pixelLength / static_cast< double >( mAutoNotchSpacing ) + 1.0, 2.0, MaxNotches );
+		return wEngine::MathUtils::niceTickStep( mAxisRange.x, mAxisRange.y, static_cast< size_t >( maxTicks ) );
+	}
+
+	auto& intervalComponent = component< wEngine::NotchIntervalComponent >( "AxisEntity::chooseNotchInterval( )" );
+	double interval = static_cast< double >( intervalComponent.getInterval( ) );
+
+	// Too dense for the pixel length (or too many): keep only the multiples of a wider step.
+	double maxCount = std::clamp( pixelLength / static_cast< double >( MinNotchSpacing ), 1.0, MaxNotches );
+	double count = span / interval;
+	if (count > maxCount)
+	{
+		interval *= std::ceil( count / maxCount );
+	}
+
+	return interval;
+}
+
+void AxisEntity::cullLabels( )
+{
+	mLabelStride = 1;
+
+	if (mLabels.size( ) < 2 || !(mNotchInterval > 0.0))
+	{
+		return;
+	}
+
+	auto& scaleComponent = component< wEngine::ScaleComponent >( "AxisEntity::cullLabels( )" );
+	sf::Vector2f scale = scaleComponent.getScale( );
+
+	float pixelsPerUnit = std::fabs( mAxisType == AxisType::X_AXIS ? scale.x : scale.y );
+	float spacing = static_cast< float >( mNotchInterval ) * pixelsPerUnit;
+	if (!(spacing > 0.0f))
+	{
+		return;
+	}
+
+	// Labels are laid out side by side along the axis: measure their extent in that direction.
+	float extent = 0.0f;
+	for (auto& label : mLabels)
+	{
+		sf::Vector2f size = label->getTextSize( );
+		extent = std::max( extent, mAxisType == AxisType::X_AXIS ? size.x : size.y );
+	}
+
+	mLabelStride = std::max< size_t >( 1, static_cast< size_t >( std::ceil( (extent + LabelGap) / spacing ) ) );
+}
+
+void AxisEntity::layout( )
+{
+	construct( );
+
+	if (mTitle)
+	{
+		layoutTitle( );
+	}
+
+	if (mNotches)
+	{
+		// The effective interval follows the scale (auto step, or requested step thinned to MinNotchSpacing):
+		// choose it again and regenerate the notches if it changed.
+		if (std::fabs( chooseNotchInterval( ) - mNotchInterval ) > 1e-9 * mNotchInterval)
+		{
+			initNotches( );
+		}
+		else
+		{
+			layoutNotches( );
+		}
+	}
+}
+
+void AxisEntity::layoutTitle( )
+{
 	sf::FloatRect bounds = mTitle->getTextSize( );
 
 	sf::Vector2f end = mAxisLine->getEndPoint( );
@@ -411,120 +698,72 @@ void AxisEntity::initTitle( const T& title )
 		position.y = endScreen.y - bounds.size.y / 2.0f + defaultOffset.y;
 	}
 
-	auto titlePosComp = mTitle->requireComponent< wEngine::PositionComponent >( "AxisEntity::initTitle( )" );
+	auto titlePosComp = mTitle->requireComponent< wEngine::PositionComponent >( "AxisEntity::layoutTitle( )" );
 	titlePosComp->setPosition( position );
 }
 
-void AxisEntity::initNotches( )
+void AxisEntity::layoutNotches( )
 {
-	// Clear previous notches and labels
-	mNotches.clear( );
-	mLabels.clear( );
-
-	//--- Required components
-	auto positionComponent = requireComponent< wEngine::PositionComponent >( "AxisEntity::initNotches( )" );
-	auto offsetComponent = requireComponent< wEngine::OffsetComponent >( "AxisEntity::initNotches( )" );
-	auto scaleComponent = requireComponent< wEngine::ScaleComponent >( "AxisEntity::initNotches( )" );
-	auto intervalComponent = requireComponent< wEngine::NotchIntervalComponent >( "AxisEntity::initNotches( )" );
-
-	//--- Optional styling components (inherited from axis)
-	auto colorComponent = getComponent< wEngine::ColorComponent >( );
-	auto thicknessComponent = getComponent< wEngine::ThicknessComponent >( );
-
-	//--- Extract data
-	sf::Vector2f origin = positionComponent->getPosition( );
-	sf::Vector2f offset = offsetComponent->getOffset( );
-	sf::Vector2f scale = scaleComponent->getScale( );
-	float interval = intervalComponent->getInterval( );
-	sf::Color axisColor = colorComponent ? colorComponent->getColor( ) : sf::Color::Black;
-	float axisThickness = thicknessComponent? thicknessComponent->getThickness( ) : 2.0f;
-	constexpr float notchSize = 16.0f;
-	float NotchOffset = notchSize / 2.0f;
-
-	// --- Logical bounds
-	float logicalStart = std::ceil( mAxisRange.x / interval ) * interval;
-	float logicalEnd = std::floor( mAxisRange.y / interval ) * interval;
-
-	// --- Skip the origin notch ---
-	// Numerical iteration may not give exactly 0.0f (e.g., due to floating-point error).
-	// We therefore use a tolerance of interval/2 to ensure we exclude the origin and only the origin.
-	float EPSILON = interval / 2.0f;
-
-	// Generate notches
-	if (mAxisType == AxisType::X_AXIS)
+	auto& positionComponent = component< wEngine::PositionComponent >( "AxisEntity::layoutNotches( )" );
+	auto& offsetComponent = component< wEngine::OffsetComponent >( "AxisEntity::layoutNotches( )" );
+	auto& scaleComponent = component< wEngine::ScaleComponent >( "AxisEntity::layoutNotches( )" );
+	auto& thicknessComponent = mNotches->component< wEngine::ThicknessComponent >( "AxisEntity::layoutNotches( )" );
+	auto& lengthComponent = mNotches->component< wEngine::LengthComponent >( "AxisEntity::layoutNotches( )" );
+
+	sf::Vector2f origin = positionComponent.getPosition( );
+	sf::Vector2f offset = offsetComponent.getOffset( );
+	sf::Vector2f scale = scaleComponent.getScale( );
+
+	// Top-left corner of the notch of a logical value, for a given notch thickness and length.
+	auto notchPosition = [ & ]( float unit, float thickness, float length )
 	{
-		for (float unit = logicalStart; unit <= logicalEnd; unit += interval)
+		if (mAxisType == AxisType::X_AXIS)
 		{
-
-			if (std::fabs( unit ) < EPSILON)
-			{
-				continue;
-			}
-
-			auto notch = std::make_unique< NotchEntity >( mAxisType  );
-			notch->addComponent< wEngine::ColorComponent >( axisColor );
-			notch->addComponent< wEngine::ThicknessComponent >( axisThickness );
-			notch->addComponent< wEngine::LengthComponent >( notchSize );
-
-			float pixelX = origin.x + (unit + offset.x) * scale.x - axisThickness / 2.0f;
-			float pixelY = origin.y - notchSize / 2.0f;
+			float pixelX = origin.x + (unit + offset.x) * scale.x - thickness / 2.0f;
+			float pixelY = origin.y - length / 2.0f;
 
 			if (mNotchPosition != NotchPosition::Center)
 			{
-				pixelY += (mNotchPosition == NotchPosition::Above) ? -NotchOffset : NotchOffset;
+				pixelY += (mNotchPosition == NotchPosition::Above) ? -length / 2.0f : length / 2.0f;
 			}
 
-			notch->addComponent< wEngine::PositionComponent >( sf::Vector2f( pixelX, pixelY ) );
-
-			mNotches.push_back( std::move( notch ) );
-
-			if (mHasLabels)
-			{
-				sf::Vector2f labelPosition{ pixelX, pixelY + notchSize };
-				auto labelEntity = std::make_unique< LabelEntity >( mLabelsFont, mAxisType, labelPosition );
-				labelEntity->setLabelText( labelEntity->formatLabel( unit ) );
-				mLabels.push_back( std::move( labelEntity ) );
-			}
+			return sf::Vector2f( pixelX, pixelY );
 		}
-	}
-	else
-	{
-		for (float unit = logicalStart; unit <= logicalEnd; unit += interval)
-		{
-			if (std::fabs( unit ) < EPSILON)
-			{
-				continue;
-			}
-
-			auto notch = std::make_unique< NotchEntity >( mAxisType );
-			notch->addComponent< wEngine::ColorComponent >( axisColor );
-			notch->addComponent< wEngine::ThicknessComponent >( axisThickness );
-			notch->addComponent< wEngine::LengthComponent >( notchSize );
 
 // Note: the minus sign is intentional here (-unit).
 // It ensures that Y-axis labels have the correct orientation (SFML's Y grows downward).
-			float pixelY = origin.y + (-unit + offset.y) * scale.y - axisThickness / 2.0f;
-			float pixelX = origin.x - notchSize / 2.0f;
+		float pixelY = origin.y + (-unit + offset.y) * scale.y - thickness / 2.0f;
+		float pixelX = origin.x - length / 2.0f;
 
-			if (mNotchPosition != NotchPosition::Center)
-			{
-				pixelX += (mNotchPosition == NotchPosition::Above) ? NotchOffset : -NotchOffset;
-			}
+		if (mNotchPosition != NotchPosition::Center)
+		{
+			pixelX += (mNotchPosition == NotchPosition::Above) ? length / 2.0f : -length / 2.0f;
+		}
 
-			notch->addComponent< wEngine::PositionComponent >( sf::Vector2f( pixelX, pixelY ) );
+		return sf::Vector2f( pixelX, pixelY );
+	};
 
-			mNotches.push_back( std::move( notch ) );
+	mNotches->clear( );
+	for (float unit : mNotchValues)
+	{
+		mNotches->addNotch( notchPosition( unit, thicknessComponent.getThickness( ), lengthComponent.getLength( ) ) );
+	}
 
-			if (mHasLabels)
-			{
-				sf::Vector2f labelPosition{ pixelX - notchSize, pixelY };
-				auto labelEntity = std::make_unique< LabelEntity >( mLabelsFont, mAxisType, labelPosition );
-				labelEntity->setLabelText( labelEntity->formatLabel( unit ) );
+	for (auto& label : mLabels)
+	{
+		sf::Vector2f anchor = notchPosition( label->getValue( ), mLabelAnchorThickness, DefaultNotchLength );
+		anchor += (mAxisType == AxisType::X_AXIS)
+			? sf::Vector2f( 0.0f, DefaultNotchLength )
+			: sf::Vector2f( -DefaultNotchLength, 0.0f );
 
-				mLabels.push_back( std::move( labelEntity ) );
-			}
+		auto& labelPosition = label->component< wEngine::PositionComponent >( "AxisEntity::layoutNotches( )" );
+		if (labelPosition.getPosition( ) != anchor)
+		{
+			labelPosition.setPosition( anchor );
 		}
 	}
+
+	cullLabels( );
 }
 
 }//End of namespace wPlot2D
\ No newline at end of file
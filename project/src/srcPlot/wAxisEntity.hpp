@@ -22,6 +22,8 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #include <SFML/Graphics.hpp>
 #pragma GCC diagnostic pop
 
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace wPlot2D
@@ -103,6 +105,12 @@ namespace wPlot2D
 			 */
 			void setArrowSize( float arrowSize );
 
+			/**
+			 * @brief Gets the logical range covered by the axis.
+			 * @return Range [min, max] as given at construction, before the axis offset is applied.
+			 */
+			[[nodiscard]] sf::Vector2f getAxisRange( ) const;
+
 			/**
 			 * @brief Adds a title to the axis.
 			 * @param title Title string (narrow string).
@@ -147,12 +155,41 @@ namespace wPlot2D
 
 			/**
 			 * @brief Adds notches along the axis.
+			 *
+			 * Notches are placed on the multiples of @p interval inside the axis range. Their number
+			 * is bounded: if the interval would put notches closer than a couple of pixels (or create
+			 * more than a few thousand of them), only the multiples of a wider step are kept. The bound
+			 * is checked again whenever the scale changes (e.g. zooming out in GraphicsEntity::show( )).
+			 *
 			 * @param interval Logical spacing between notches (> 0).
 			 * @param position Placement relative to axis (Center, Above, Below).
 			 * @param hasLabels If true, labels are displayed for each notch.
+			 * @throws std::invalid_argument if interval <= 0.
 			 */
 			void addNotches( float interval, NotchPosition position, bool hasLabels = false );
 
+			/**
+			 * @brief Adds notches at an automatically chosen "nice" interval (1, 2 or 5 times a power of ten).
+			 *
+			 * The interval is sized to the pixel length of the axis so that notches are about
+			 * @p minSpacing pixels apart, and is chosen again when the scale changes. The number
+			 * of decimal places of the labels follows the interval unless set explicitly.
+			 *
+			 * @param position		Placement relative to axis (Center, Above, Below).
+			 * @param hasLabels		If true, labels are displayed for the notches.
+			 * @param minSpacing	Minimum distance between two notches, in pixels (> 0).
+			 * @throws std::invalid_argument if minSpacing <= 0.
+			 * @note Custom labels (see setCustomLabels( )) are indexed by notch value, so they follow
+			 *       the interval: after a change, each notch shows the string of its new value.
+			 */
+			void addAutoNotches( NotchPosition position, bool hasLabels = false, float minSpacing = 60.0f );
+
+			/**
+			 * @brief Gets the logical spacing between consecutive notches actually drawn.
+			 * @return Interval in logical units (0 if the axis has no notches).
+			 */
+			[[nodiscard]] double getNotchesInterval( ) const;
+
 			/**
 			 * @brief Sets the color of all notches.
 			 * @param color New notch color.
@@ -213,32 +250,76 @@ namespace wPlot2D
 			 */
 			void setLabelsDecimalPlaces( int places );
 
+			/**
+			 * @brief Sets the notation of numeric labels (fixed, scientific, engineering or SI prefixes).
+			 * @param notation New notation.
+			 */
+			void setLabelsNotation( wEngine::NumberFormatter::Notation notation );
+
+			/**
+			 * @brief Gets the notation of numeric labels.
+			 * @return Current notation.
+			 */
+			[[nodiscard]] wEngine::NumberFormatter::Notation getLabelsNotation( ) const;
+
 			/**
 			 * @brief Replaces numeric labels with a custom set of strings.
+			 *
+			 * The label of the notch at value k shows labels[ k ]; notches without a string lose their
+			 * label. The strings are kept and applied again whenever the notches are regenerated
+			 * (e.g. when the scale changes the interval).
+			 *
 			 * @param labels Vector of user-defined label strings.
 			 */
 			void setCustomLabels( const std::vector< std::string >& labels );
 
 			/**
 			 * @brief Renders the axis (line, arrow, title, notches, labels).
-			 * @param window Target render window.
+			 *
+			 * All labels are laid out into one text batch and submitted with a single draw call.
+			 * When labels would overlap, only every n-th label is drawn (n is measured from the
+			 * widest label and the pixel spacing of the notches).
+			 *
+			 * @param window Target render target.
 			 */
-			void render( sf::RenderWindow& window );
+			void render( sf::RenderTarget& window );
 		private:
 			sf::Font& mTitleFont;
-			sf::Font& mLabelsFont;
 			AxisType mAxisType;
 			sf::Vector2f mAxisRange;
 			std::unique_ptr< LineEntity > mAxisLine;
 			float mArrowSize;
 
-			std::vector< std::unique_ptr< NotchEntity > > mNotches;
+			std::unique_ptr< NotchEntity > mNotches;
+			std::vector< float > mNotchValues;
+			double mNotchInterval;
+			bool mAutoNotches;
+			float mAutoNotchSpacing;
 			NotchPosition mNotchPosition;
 
 			std::unique_ptr< TitleEntity > mTitle;
 
 			bool mHasLabels;
 			std::vector< std::unique_ptr< LabelEntity > > mLabels;
+			std::vector< std::string > mCustomLabels;
+			float mLabelAnchorThickness;
+			wEngine::NumberFormatter mLabelFormatter;
+			size_t mLabelStride;
+
+			/**
+			 * @struct LabelStyle
+			 * @brief Style applied to the labels, kept so that regenerated labels look the same.
+			 */
+			struct LabelStyle
+			{
+				const sf::Font* mFont = nullptr;
+				sf::Color mColor = sf::Color::Black;
+				unsigned int mCharacterSize = 25;
+				std::optional< int > mDecimalPlaces;		// unset: derived from the interval of automatic notches
+				sf::Vector2f mOffset{ 0.0f, 0.0f };
+			};
+			LabelStyle mLabelStyle;
+			wEngine::TextBatcher mLabelBatch;
 
 			/**
 			 * @brief Internal: rebuilds the axis geometry.
@@ -252,9 +333,42 @@ namespace wPlot2D
 			void initTitle( const T& title );
 
 			/**
-			 * @brief Internal: generates and positions notches and labels.
+			 * @brief Internal: generates the notches and labels, then positions them.
 			 */
 			void initNotches( );
+
+			/**
+			 * @brief Internal: applies mCustomLabels to the current labels (drops the labels without a string).
+			 */
+			void applyCustomLabels( );
+
+			/**
+			 * @brief Internal: recomputes the whole layout (axis line, title, notches, labels).
+			 *
+			 * Called once per change of origin, scale, offset or style (see Entity::isDirty( )).
+			 */
+			void layout( );
+
+			/**
+			 * @brief Internal: places the title at the end of the axis.
+			 */
+			void layoutTitle( );
+
+			/**
+			 * @brief Internal: computes the pixel positions of the notches and the anchors of the labels.
+			 */
+			void layoutNotches( );
+
+			/**
+			 * @brief Internal: chooses the notch interval (automatic, or requested and bounded).
+			 * @return Logical spacing between notches.
+			 */
+			[[nodiscard]] double chooseNotchInterval( ) const;
+
+			/**
+			 * @brief Internal: measures the labels and chooses how many notches separate two drawn labels.
+			 */
+			void cullLabels( );
 	};
 
 }//End of namespace wPlot2D
@@ -0,0 +1,85 @@
+/**
+ * @file wBatchExporter.cpp
+ * @brief Implementation of the BatchExporter class.
+ */
+
+#include "wBatchExporter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace wPlot2D
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Constructors and destructors.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+BatchExporter::BatchExporter( unsigned int threadCount )
+:	mPool{ threadCount }
+{
+
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+unsigned int BatchExporter::getThreadCount( ) const
+{
+	return mPool.getThreadCount( );
+}
+
+BatchReport BatchExporter::exportAll( const std::vector< BatchFigure >& figures )
+{
+	BatchReport report;
+	std::mutex reportMutex;
+	std::atomic< size_t > nextFigure{ 0 };
+
+	auto start = std::chrono::steady_clock::now( );
+
+	// One slot per worker; each worker pulls figures one at a time so that slow figures do not
+	// leave the other workers idle.
+	const size_t workers = std::min< size_t >( mPool.getThreadCount( ), figures.size( ) );
+	mPool.parallelFor( workers, [ & ]( size_t, size_t )
+	{
+		for (size_t i = nextFigure++; i < figures.size( ); i = nextFigure++)
+		{
+			const BatchFigure& figure = figures[ i ];
+			try
+			{
+				GraphicsEntity graph( figure.filename, figure.size, figure.originFactor, figure.scaleFactor, RenderMode::Headless );
+				if (figure.build)
+				{
+					figure.build( graph );
+				}
+				graph.saveToFile( figure.filename );
+
+				std::lock_guard< std::mutex > lock( reportMutex );
+				++report.exported;
+			}
+			catch (const std::exception& e)
+			{
+				std::lock_guard< std::mutex > lock( reportMutex );
+				++report.failed;
+				report.errors.push_back( figure.filename + ": " + e.what( ) );
+			}
+		}
+
+		// Fonts are shared by every figure this worker built; free them once its share of the batch is done.
+		wEngine::AssetManager::releaseCachedFonts( );
+	} );
+
+	report.seconds = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - start ).count( );
+	report.figuresPerSecond = report.seconds > 0.0 ? static_cast< double >( report.exported ) / report.seconds : 0.0;
+
+	return report;
+}
+
+}//End of namespace wPlot2D
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_BATCH_EXPORTER_HPP
+#define W_BATCH_EXPORTER_HPP
+
+#include "../srcUtils/wThreadPool.hpp"
+
+#include "wGraphicsEntity.hpp"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#include <SFML/System/Vector2.hpp>
+#pragma GCC diagnostic pop
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace wPlot2D
+{
+
+	/**
+	 * @struct BatchFigure
+	 * @brief Description of one figure exported by BatchExporter.
+	 *
+	 * The builder callback receives a fresh headless GraphicsEntity and adds axes, functions,
+	 * data plots, etc. to it; the exporter then renders and saves it to @p filename.
+	 * The builder runs on a worker thread: it must not touch shared state without synchronization.
+	 */
+	struct BatchFigure
+	{
+		std::string filename;									///< Output path, as for GraphicsEntity::saveToFile( ).
+		std::function< void( GraphicsEntity& ) > build;			///< Fills the figure.
+		sf::Vector2u size = { 1600, 1600 };						///< Image size in pixels.
+		sf::Vector2f originFactor = { 0.5f, 0.5f };				///< See GraphicsEntity constructor.
+		sf::Vector2f scaleFactor = { 0.1f, 0.1f };				///< See GraphicsEntity constructor.
+	};
+
+	/**
+	 * @struct BatchReport
+	 * @brief Outcome of BatchExporter::exportAll( ).
+	 */
+	struct BatchReport
+	{
+		size_t exported = 0;						///< Figures rendered and saved successfully.
+		size_t failed = 0;							///< Figures whose build, render or save threw.
+		double seconds = 0.0;						///< Wall-clock duration of the batch.
+		double figuresPerSecond = 0.0;				///< Throughput (exported / seconds).
+		std::vector< std::string > errors;			///< One "filename: message" entry per failure.
+	};
+
+	/**
+	 * @class BatchExporter
+	 * @brief Renders and saves many figures concurrently.
+	 *
+	 * Each worker of the internal ThreadPool takes the next pending figure, builds it into its
+	 * own headless GraphicsEntity (offscreen render texture, no window), renders it and encodes
+	 * the image, all on that worker thread. Failures are collected in the report instead of
+	 * aborting the batch. Figures built by the same worker share its cached fonts and glyph
+	 * atlases; each worker releases them when it has no figure left (see
+	 * wEngine::AssetManager::releaseCachedFonts( )).
+	 *
+	 * @code
+	 * wPlot2D::BatchExporter exporter;
+	 * std::vector< wPlot2D::BatchFigure > figures;
+	 * for (int k = 1; k <= 100; ++k)
+	 * {
+	 *     figures.push_back( { "/sin" + std::to_string( k ) + ".png", [ k ]( wPlot2D::GraphicsEntity& graph )
+	 *     {
+	 *         (void)graph.addAxis( wPlot2D::AxisType::X_AXIS, { -5.0f, 5.0f } );
+	 *         (void)graph.addFunction( [ k ]( double x ) { return std::sin( k * x ); }, -5.0, 5.0 );
+	 *     } } );
+	 * }
+	 * wPlot2D::BatchReport report = exporter.exportAll( figures );
+	 * @endcode
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class BatchExporter
+	{
+		public:
+			/**
+			 * @brief Starts the worker threads.
+			 * @param threadCount Number of workers (0 = hardware concurrency).
+			 */
+			explicit BatchExporter( unsigned int threadCount = 0 );
+
+			/**
+			 * @brief Returns the number of figures processed concurrently.
+			 * @return Worker count.
+			 */
+			[[nodiscard]] unsigned int getThreadCount( ) const;
+
+			/**
+			 * @brief Builds, renders and saves every figure, spread over the workers.
+			 *
+			 * Blocks until all figures are processed.
+			 *
+			 * @param figures Figures to export.
+			 * @return Counts, errors and throughput of the batch.
+			 */
+			BatchReport exportAll( const std::vector< BatchFigure >& figures );
+
+		private:
+			wEngine::ThreadPool mPool;
+	};
+
+}//End of namespace wPlot2D
+
+#endif
\ No newline at end of file
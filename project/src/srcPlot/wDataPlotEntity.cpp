@@ -6,6 +6,7 @@
 #include "wDataPlotEntity.hpp"
 
 #include "../srcUtils/wLineDrawer.hpp"
+#include "../srcUtils/wMathUtils.hpp"
 
 #include "../srcComponents/wColorComponent.hpp"
 #include "../srcComponents/wPositionComponent.hpp"
@@ -22,13 +23,43 @@ namespace wPlot2D
 */
 
 DataPlotEntity::DataPlotEntity( const sf::Vector2f origin, const sf::Vector2f scale, const std::vector< sf::Vector2f >& dataPoints )
-:	mDataPoints{ dataPoints }
+:	DataPlotEntity( origin, scale, std::make_unique< PointDataSource >( dataPoints ) )
 {
+
+}
+
+DataPlotEntity::DataPlotEntity( const sf::Vector2f origin, const sf::Vector2f scale, std::unique_ptr< DataSource > source )
+:	mSource{ std::move( source ) },
+	mGeometry{ sf::PrimitiveType::Triangles },
+	mGeometryClip{ },
+	mDrawnPointCount{ 0 },
+	mVisiblePointCount{ 0 },
+	mVisibleRange{ 0.0, 0.0 },
+	mHasVisibleRange{ false },
+	mSortDeclared{ false },
+	mSortDetected{ false },
+	mStream{ nullptr },
+	mSlidingWindow{ 0.0 },
+	mStreamStart{ 0 },
+	mBuiltAppended{ 0 },
+	mBuiltEvicted{ 0 },
+	mAnchorX{ 0.0 },
+	mPatternOffset{ 0.0f },
+	mScratch{ sf::PrimitiveType::Triangles }
+{
+	if (!mSource)
+	{
+		throw std::invalid_argument( "DataPlotEntity: data source must not be null." );
+	}
+
 	addComponent< wEngine::PositionComponent >( origin );
 	addComponent< wEngine::ScaleComponent >( scale );
 	addComponent< wEngine::ColorComponent >( sf::Color::Black );
 	addComponent< wEngine::ThicknessComponent >( 2.0f );
 	addComponent< wEngine::LineStyleComponent >( wEngine::LineStyleComponent::LineStyle::Solid );
+	addComponent< wEngine::DecimationComponent >( );
+
+	mStream = dynamic_cast< RingBufferDataSource* >( mSource.get( ) );
 }
 
 /*
@@ -97,45 +128,301 @@ void DataPlotEntity::setGapLength( float gapLength )
 	styleComponent->setGapLength( gapLength );
 }
 
+void DataPlotEntity::setDecimation( wEngine::DecimationComponent::DecimationMode mode, float pointsPerPixel )
+{
+	auto decimationComponent = requireComponent< wEngine::DecimationComponent >( "DataPlotEntity::setDecimation( )" );
+	decimationComponent->setPointsPerPixel( pointsPerPixel );
+	decimationComponent->setMode( mode );
+}
+
+wEngine::DecimationComponent::DecimationMode DataPlotEntity::getDecimation( ) const
+{
+	auto decimationComponent = requireComponent< wEngine::DecimationComponent >( "DataPlotEntity::getDecimation( )" );
+	return decimationComponent->getMode( );
+}
+
+size_t DataPlotEntity::getDrawnPointCount( ) const
+{
+	return mDrawnPointCount;
+}
+
+float DataPlotEntity::getReductionRatio( ) const
+{
+	if (mDrawnPointCount == 0)
+	{
+		return 1.0f;
+	}
+
+	return static_cast< float >( mVisiblePointCount ) / static_cast< float >( mDrawnPointCount );
+}
+
+const DataSource& DataPlotEntity::getDataSource( ) const
+{
+	return *mSource;
+}
+
+void DataPlotEntity::setSortedByX( bool sorted )
+{
+	mSource->setSortedByX( sorted );
+	mSortDeclared = true;
+	mSortDetected = false;
+	markDirty( );
+}
+
+void DataPlotEntity::setVisibleRange( sf::Vector2< double > xRange )
+{
+	if (mHasVisibleRange && xRange == mVisibleRange)
+	{
+		return;
+	}
+
+	mVisibleRange = xRange;
+	mHasVisibleRange = true;
+	markDirty( );
+}
+
+void DataPlotEntity::clearVisibleRange( )
+{
+	if (mHasVisibleRange)
+	{
+		mHasVisibleRange = false;
+		markDirty( );
+	}
+}
+
+void DataPlotEntity::setSlidingWindow( double width )
+{
+	if (!mStream)
+	{
+		throw std::runtime_error( "DataPlotEntity::setSlidingWindow( ): the plot is not a streaming plot." );
+	}
+	if (width < 0.0)
+	{
+		throw std::invalid_argument( "DataPlotEntity::setSlidingWindow( ): width must be >= 0." );
+	}
+
+	mSlidingWindow = width;
+	if (mSlidingWindow > 0.0 && mStream->size( ) > 0)
+	{
+		mStream->evictOlderThan( mStream->pointAt( mStream->size( ) - 1 ).x - mSlidingWindow );
+	}
+	markDirty( );
+}
+
+bool DataPlotEntity::isStreaming( ) const
+{
+	return mStream != nullptr;
+}
+
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 -> Public methods.
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-void DataPlotEntity::drawDataPlot( sf::RenderWindow &window )
+void DataPlotEntity::appendPoints( std::span< const double > xs, std::span< const double > ys )
+{
+	if (!mStream)
+	{
+		throw std::runtime_error( "DataPlotEntity::appendPoints( ): the plot is not a streaming plot." );
+	}
+	if (xs.size( ) != ys.size( ))
+	{
+		throw std::invalid_argument( "DataPlotEntity::appendPoints( ): xs and ys must have the same size." );
+	}
+	if (xs.empty( ))
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < xs.size( ); ++i)
+	{
+		mStream->append( { xs[ i ], ys[ i ] } );
+	}
+
+	if (mSlidingWindow > 0.0)
+	{
+		mStream->evictOlderThan( xs.back( ) - mSlidingWindow );
+	}
+
+	// No markDirty( ): drawStream( ) picks the new points up from the stream counters.
+}
+
+void DataPlotEntity::appendPoints( const std::vector< sf::Vector2f >& points )
+{
+	std::vector< double > xs( points.size( ) );
+	std::vector< double > ys( points.size( ) );
+	for (size_t i = 0; i < points.size( ); ++i)
+	{
+		xs[ i ] = static_cast< double >( points[ i ].x );
+		ys[ i ] = static_cast< double >( points[ i ].y );
+	}
+
+	appendPoints( xs, ys );
+}
+
+void DataPlotEntity::drawDataPlot( sf::RenderTarget& window )
 {
-	if (mDataPoints.size( ) < 2)
+	if (mStream)
+	{
+		drawStream( window );
+		return;
+	}
+
+	const DataSource& source = *mSource;
+	const size_t count = source.size( );
+
+	if (count < 2)
 	{
 		return;
 	}
 
-	auto positionComponent	= requireComponent< wEngine::PositionComponent >( "DataPlotEntity::drawDataPlot" );
-	auto scaleComponent		= requireComponent< wEngine::ScaleComponent >( "DataPlotEntity::drawDataPlot" );
-	auto colorComponent		= requireComponent< wEngine::ColorComponent >( "DataPlotEntity::drawDataPlot" );
-	auto thicknessComponent	= requireComponent< wEngine::ThicknessComponent >( "DataPlotEntity::drawDataPlot" );
-	auto styleComponent		= requireComponent< wEngine::LineStyleComponent >( "DataPlotEntity::drawDataPlot" );
+	// Area shown by the target, widened by the thickness so caps at the border are kept
+	const sf::FloatRect clipRect = wEngine::LineDrawer::getClipRect( window,
+		component< wEngine::ThicknessComponent >( "DataPlotEntity::drawDataPlot" ).getThickness( ) );
+
+	// Replay the cached geometry when no component changed since the last rebuild
+	if (!isDirty( ) && clipRect == mGeometryClip)
+	{
+		if (mGeometry.getVertexCount( ) > 0)
+		{
+			window.draw( mGeometry );
+		}
+		return;
+	}
+
+	// Sortedness enables the visible-range binary search. When it was not declared, detect it on
+	// every rebuild: the points may have changed order since the plot was last marked dirty.
+	if (!mSortDeclared && (mSortDetected || !mSource->isSortedByX( )))
+	{
+		mSortDetected = mSource->scanSortedByX( );
+		mSource->setSortedByX( mSortDetected );
+	}
+
+	auto& positionComponent		= component< wEngine::PositionComponent >( "DataPlotEntity::drawDataPlot" );
+	auto& scaleComponent		= component< wEngine::ScaleComponent >( "DataPlotEntity::drawDataPlot" );
+	auto& colorComponent		= component< wEngine::ColorComponent >( "DataPlotEntity::drawDataPlot" );
+	auto& thicknessComponent	= component< wEngine::ThicknessComponent >( "DataPlotEntity::drawDataPlot" );
+	auto& styleComponent		= component< wEngine::LineStyleComponent >( "DataPlotEntity::drawDataPlot" );
+
+	sf::Vector2f origin	= positionComponent.getPosition( );
+	sf::Vector2f scale	= scaleComponent.getScale( );
+	sf::Color color		= colorComponent.getColor( );
+	float thickness		= thicknessComponent.getThickness( );
+	auto style			= styleComponent.getStyle( );
+	float dashLength	= styleComponent.getDashLength( );
+	float gapLength		= styleComponent.getGapLength( );
 
-	sf::Vector2f origin	= positionComponent->getPosition( );
-	sf::Vector2f scale	= scaleComponent->getScale( );
-	sf::Color color		= colorComponent->getColor( );
-	float thickness		= thicknessComponent->getThickness( );
-	auto style			= styleComponent->getStyle( );
-	float dashLength	= styleComponent->getDashLength( );
-	float gapLength		= styleComponent->getGapLength( );
+	auto& decimationComponent	= component< wEngine::DecimationComponent >( "DataPlotEntity::drawDataPlot" );
 
-	// Transform points
+	// Visible window: on x-sorted sources, binary search the visible range (plus one point on each
+	// side so that segments crossing the border are kept) and never read the points outside it.
+	size_t first = 0;
+	size_t last = count;
+	if (mHasVisibleRange && source.isSortedByX( ))
+	{
+		auto lowerBound = [ & ]( double x, bool inclusive )
+		{
+			size_t low = 0, high = count;
+			while (low < high)
+			{
+				size_t mid = low + (high - low) / 2;
+				double value = source.pointAt( mid ).x;
+				if (value < x || (inclusive && !(value > x)))
+				{
+					low = mid + 1;
+				}
+				else
+				{
+					high = mid;
+				}
+			}
+			return low;
+		};
+
+		first = lowerBound( mVisibleRange.x, false );
+		last = lowerBound( mVisibleRange.y, true );
+		first = first > 0 ? first - 1 : 0;
+		last = std::min( last + 1, count );
+	}
+
+	const size_t visibleCount = last > first ? last - first : 0;
+	auto pointAt = [ &source, first ]( size_t i ) { return source.pointAt( first + i ); };
+
+	// Pixel-aware decimation: the budget depends on the number of pixel columns spanned by the data.
+	// Both decimators bucket points by x, so unsorted sources are drawn in full.
+	std::vector< size_t > kept;
+	auto decimation = decimationComponent.getMode( );
+	if (decimation != wEngine::DecimationComponent::DecimationMode::None && visibleCount >= 2 && source.isSortedByX( ))
+	{
+		// Extent between the first and last finite x (missing values may sit at either end)
+		size_t front = 0;
+		size_t back = visibleCount;
+		while (front < back && !std::isfinite( pointAt( front ).x ))
+		{
+			++front;
+		}
+		while (back > front && !std::isfinite( pointAt( back - 1 ).x ))
+		{
+			--back;
+		}
+
+		double extent = front < back
+			? std::fabs( pointAt( back - 1 ).x - pointAt( front ).x ) * static_cast< double >( scale.x )
+			: 0.0;
+
+		// More columns than points cannot reduce anything (and keeps the conversion in range)
+		size_t columns = static_cast< size_t >( std::clamp( std::ceil( extent ), 1.0, static_cast< double >( visibleCount ) ) );
+
+		if (decimation == wEngine::DecimationComponent::DecimationMode::M4)
+		{
+			kept = wEngine::MathUtils::decimateM4( visibleCount, pointAt, columns );
+		}
+		else
+		{
+			size_t threshold = static_cast< size_t >( static_cast< float >( columns ) * decimationComponent.getPointsPerPixel( ) );
+			kept = wEngine::MathUtils::decimateLTTB( visibleCount, pointAt, threshold );
+		}
+	}
+	else
+	{
+		decimation = wEngine::DecimationComponent::DecimationMode::None;
+	}
+
+	// Transform points (in double precision, narrowed to float pixels only at the end)
 	std::vector< sf::Vector2f > transformed;
-	transformed.reserve( mDataPoints.size( ) );
+	auto transform = [ & ]( sf::Vector2< double > p )
+	{
+		transformed.emplace_back(
+			origin.x + static_cast< float >( p.x * static_cast< double >( scale.x ) ),
+			origin.y - static_cast< float >( p.y * static_cast< double >( scale.y ) ) );
+	};
 
-	for (auto& p : mDataPoints)
+	if (decimation != wEngine::DecimationComponent::DecimationMode::None)
 	{
-		transformed.emplace_back( origin.x + p.x * scale.x, origin.y - p.y * scale.y );
+		transformed.reserve( kept.size( ) );
+		for (size_t i : kept)
+		{
+			transform( pointAt( i ) );
+		}
+	}
+	else
+	{
+		transformed.reserve( visibleCount );
+		for (size_t i = 0; i < visibleCount; ++i)
+		{
+			transform( pointAt( i ) );
+		}
 	}
 
-	// Draw as connected line segments
+	mDrawnPointCount = transformed.size( );
+	mVisiblePointCount = visibleCount;
+
+	// Tessellate as connected line segments into a single batch, clipped to the target area
+	mGeometry.clear( );
+
 	float patternOffset = 0.0f;
-	for (size_t i = 0; i < transformed.size( ) - 1; ++i)
+	for (size_t i = 0; i + 1 < transformed.size( ); ++i)
 	{
 		const sf::Vector2f& p1 = transformed[ i ];
 		const sf::Vector2f& p2 = transformed[ i+1 ];
@@ -144,10 +431,17 @@ void DataPlotEntity::drawDataPlot( sf::RenderWindow &window )
 			continue;
 		}
 
-		patternOffset = wEngine::LineDrawer::drawLine(
-			window,
+		// Missing values (NaN, e.g. unparsable CSV fields) break the polyline
+		if (!std::isfinite( p1.y ) || !std::isfinite( p2.y ) || !std::isfinite( p1.x ) || !std::isfinite( p2.x ))
+		{
+			continue;
+		}
+
+		patternOffset = wEngine::LineDrawer::appendClippedLine(
+			mGeometry,
 			p1,
 			p2,
+			clipRect,
 			color,
 			thickness,
 			style,
@@ -156,6 +450,144 @@ void DataPlotEntity::drawDataPlot( sf::RenderWindow &window )
 			patternOffset
 		);
 	}
+
+	mGeometryClip = clipRect;
+	clearDirty( );
+
+	// Submit the whole plot with one draw call
+	if (mGeometry.getVertexCount( ) > 0)
+	{
+		window.draw( mGeometry );
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void DataPlotEntity::drawStream( sf::RenderTarget& window )
+{
+	auto& positionComponent	= component< wEngine::PositionComponent >( "DataPlotEntity::drawStream" );
+	auto& scaleComponent	= component< wEngine::ScaleComponent >( "DataPlotEntity::drawStream" );
+
+	auto& colorComponent		= component< wEngine::ColorComponent >( "DataPlotEntity::drawStream" );
+	auto& thicknessComponent	= component< wEngine::ThicknessComponent >( "DataPlotEntity::drawStream" );
+	auto& styleComponent		= component< wEngine::LineStyleComponent >( "DataPlotEntity::drawStream" );
+
+	sf::Vector2f origin	= positionComponent.getPosition( );
+	sf::Vector2f scale	= scaleComponent.getScale( );
+	sf::Color color		= colorComponent.getColor( );
+	float thickness		= thicknessComponent.getThickness( );
+	auto style			= styleComponent.getStyle( );
+	float dashLength	= styleComponent.getDashLength( );
+	float gapLength		= styleComponent.getGapLength( );
+
+	auto toPixel = [ & ]( sf::Vector2< double > p )
+	{
+		return sf::Vector2f(
+			origin.x + static_cast< float >( (p.x - mAnchorX) * static_cast< double >( scale.x ) ),
+			origin.y - static_cast< float >( p.y * static_cast< double >( scale.y ) ) );
+	};
+
+	// Tessellates the segment [index, index + 1]. Every segment records its vertex count (possibly 0)
+	// so that evicting a point is always one pop.
+	auto appendSegment = [ & ]( size_t index )
+	{
+		const sf::Vector2f p1 = toPixel( mStream->pointAt( index ) );
+		const sf::Vector2f p2 = toPixel( mStream->pointAt( index + 1 ) );
+		if (p1 == p2 || !std::isfinite( p1.y ) || !std::isfinite( p2.y ) || !std::isfinite( p1.x ) || !std::isfinite( p2.x ))
+		{
+			mSegmentVertexCounts.push_back( 0 );
+			return;
+		}
+
+		mScratch.clear( );
+		mPatternOffset = wEngine::LineDrawer::appendLine(
+			mScratch,
+			p1,
+			p2,
+			color,
+			thickness,
+			style,
+			dashLength,
+			gapLength,
+			mPatternOffset
+		);
+
+		for (size_t i = 0; i < mScratch.getVertexCount( ); ++i)
+		{
+			mStreamVertices.push_back( mScratch[ i ] );
+		}
+		mSegmentVertexCounts.push_back( mScratch.getVertexCount( ) );
+	};
+
+	const size_t count = mStream->size( );
+	const std::uint64_t appended = mStream->getTotalAppended( ) - mBuiltAppended;
+	const std::uint64_t evicted = mStream->getTotalEvicted( ) - mBuiltEvicted;
+
+	// Full rebuild after a style change, when new points were already evicted before being drawn
+	// (the previous last point is gone), or when the dead prefix of the vertex buffer outgrew the
+	// live part (compaction).
+	bool rebuild = isDirty( )
+		|| appended > count
+		|| mStreamStart > mStreamVertices.size( ) / 2;
+
+	if (rebuild)
+	{
+		mStreamVertices.clear( );
+		mSegmentVertexCounts.clear( );
+		mStreamStart = 0;
+		mPatternOffset = 0.0f;
+		mAnchorX = count > 0 ? mStream->pointAt( 0 ).x : 0.0;
+
+		for (size_t i = 0; i + 1 < count; ++i)
+		{
+			appendSegment( i );
+		}
+
+		clearDirty( );
+	}
+	else
+	{
+		// Drop the segments starting at evicted points from the front of the buffer
+		for (std::uint64_t k = 0; k < evicted && !mSegmentVertexCounts.empty( ); ++k)
+		{
+			mStreamStart += mSegmentVertexCounts.front( );
+			mSegmentVertexCounts.pop_front( );
+		}
+
+		// Tessellate the segments ending at new points (the first one joins the previous last point)
+		size_t firstNew = count - static_cast< size_t >( appended );
+		for (size_t i = firstNew > 0 ? firstNew - 1 : 0; i + 1 < count; ++i)
+		{
+			appendSegment( i );
+		}
+	}
+
+	mBuiltAppended = mStream->getTotalAppended( );
+	mBuiltEvicted = mStream->getTotalEvicted( );
+	mDrawnPointCount = count;
+	mVisiblePointCount = count;
+
+	const size_t vertexCount = mStreamVertices.size( ) - mStreamStart;
+	if (vertexCount == 0)
+	{
+		return;
+	}
+
+	// Geometry is built relative to the anchor; the sliding window scrolls it with a translation
+	// instead of re-tessellating every point.
+	double viewStart = 0.0;
+	if (mSlidingWindow > 0.0 && count > 0)
+	{
+		viewStart = mStream->pointAt( count - 1 ).x - mSlidingWindow;
+	}
+
+	sf::RenderStates states;
+	states.transform.translate( { static_cast< float >( (mAnchorX - viewStart) * static_cast< double >( scale.x ) ), 0.0f } );
+	window.draw( mStreamVertices.data( ) + mStreamStart, vertexCount, sf::PrimitiveType::Triangles, states );
 }
 
 }//End of namespace wPlot2D
\ No newline at end of file
@@ -18,6 +18,14 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #pragma GCC diagnostic pop
 
 #include "../srcComponents/wLineStyleComponent.hpp"
+#include "../srcComponents/wDecimationComponent.hpp"
+
+#include "wDataSource.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <span>
 
 namespace wPlot2D
 {
@@ -26,10 +34,19 @@ namespace wPlot2D
 	 * @class DataPlotEntity
 	 * @brief Entity for plotting raw data points as a connected polyline.
 	 *
-	 * Stores a vector of raw (x,y) points and draws straight line segments between them.
+	 * Reads raw (x,y) points from a DataSource and draws straight line segments between them.
+	 * The source either owns a copy of the points or views caller-owned memory without copying
+	 * (see StridedDataSource and its lifetime contract).
 	 * Each segment is rendered using the current line style (Solid, Dashed, Dotted),
 	 * with configurable color, thickness, dash length, and gap length.
 	 *
+	 * Live plots use a RingBufferDataSource (see GraphicsEntity::addStreamingPlot( )): points are
+	 * pushed with appendPoints( ) and only the segments they add are tessellated, while the segments
+	 * of evicted points are dropped from the front of the retained vertex buffer.
+	 *
+	 * Large series can be decimated before tessellation (see setDecimation( )): the number of
+	 * drawn points is then bounded by the pixel width of the data rather than by its size.
+	 *
 	 * @note Unlike FunctionEntity, this class does not evaluate a function — 
 	 * it directly uses the provided data points. The points are still transformed 
 	 * by the entity's origin and scale before rendering.
@@ -46,10 +63,20 @@ namespace wPlot2D
 			 *
 			 * @param origin		Origin of the plot in window coordinates.
 			 * @param scale			Scaling factors applied to x and y values.
-			 * @param dataPoints	Vector of raw (x,y) points to plot.
+			 * @param dataPoints	Vector of raw (x,y) points to plot (copied).
 			 */
 			DataPlotEntity( const sf::Vector2f origin, const sf::Vector2f scale, const std::vector< sf::Vector2f >& dataPoints );
 
+			/**
+			 * @brief Constructs a DataPlotEntity reading its points from the given source.
+			 *
+			 * @param origin		Origin of the plot in window coordinates.
+			 * @param scale			Scaling factors applied to x and y values.
+			 * @param source		Point source (must not be null).
+			 * @throw std::invalid_argument if source is null.
+			 */
+			DataPlotEntity( const sf::Vector2f origin, const sf::Vector2f scale, std::unique_ptr< DataSource > source );
+
 			/**
 			 * @brief Virtual destructor.
 			 */
@@ -117,18 +144,166 @@ namespace wPlot2D
 			 */
 			void setGapLength( float gapLength );
 
+			/**
+			 * @brief Enables pixel-aware decimation of the data points.
+			 *
+			 * - `M4` keeps the first, last, min and max point of every pixel column (<= 4 per column).
+			 * - `LTTB` keeps @p pointsPerPixel points per pixel column, chosen by Largest-Triangle-Three-Buckets.
+			 *
+			 * The pixel width is the x-extent of the data multiplied by the x scale. Decimation only
+			 * applies to sources sorted by increasing x (see setSortedByX( )); other sources are
+			 * drawn in full.
+			 *
+			 * @param mode				Decimation strategy (None disables decimation).
+			 * @param pointsPerPixel	Point budget per pixel column (LTTB only, default 4).
+			 * @throw std::invalid_argument if pointsPerPixel <= 0.
+			 */
+			void setDecimation( wEngine::DecimationComponent::DecimationMode mode, float pointsPerPixel = 4.0f );
+
+			/**
+			 * @brief Get the current decimation strategy.
+			 * @return None, M4 or LTTB.
+			 */
+			[[nodiscard]] wEngine::DecimationComponent::DecimationMode getDecimation( ) const;
+
+			/**
+			 * @brief Get the number of points drawn by the last rebuild of the geometry.
+			 * @return Number of points actually tessellated.
+			 */
+			[[nodiscard]] size_t getDrawnPointCount( ) const;
+
+			/**
+			 * @brief Get the reduction ratio achieved by decimation.
+			 *
+			 * Points culled by the visible range (see setVisibleRange( )) are not counted: the ratio
+			 * only measures decimation.
+			 *
+			 * @return Number of visible points divided by the number of drawn points (1 without decimation).
+			 */
+			[[nodiscard]] float getReductionRatio( ) const;
+
+			/**
+			 * @brief Get the source the points are read from.
+			 * @return Reference to the data source.
+			 */
+			[[nodiscard]] const DataSource& getDataSource( ) const;
+
+			/**
+			 * @brief Declares whether the points are sorted by increasing x (see DataSource::isSortedByX( )).
+			 *
+			 * Without a declaration, a source that is not flagged sorted is scanned whenever the
+			 * geometry is rebuilt (see DataSource::scanSortedByX( )) and flagged accordingly, so
+			 * caller-owned data that changes order is picked up once the plot is marked dirty.
+			 * Declaring it skips the scan; the declaration then holds until it is changed.
+			 *
+			 * @param sorted True if x is non-decreasing with the index.
+			 */
+			void setSortedByX( bool sorted );
+
+			/**
+			 * @brief Restricts drawing to a logical x-range (typically the range of the X axis).
+			 *
+			 * On sources sorted by x, the first and last visible points are found by binary search
+			 * and only the points in between (plus one on each side) are read, decimated and drawn.
+			 * Memory-mapped sources therefore only touch the pages holding visible data.
+			 * Unsorted sources ignore the range.
+			 *
+			 * The range is kept in double precision, like the points returned by the source, so
+			 * large x values (e.g. epoch timestamps) are searched without rounding.
+			 *
+			 * @param xRange Visible logical range [xRange.x, xRange.y].
+			 */
+			void setVisibleRange( sf::Vector2< double > xRange );
+
+			/**
+			 * @brief Removes the visible range: every point is drawn again.
+			 */
+			void clearVisibleRange( );
+
+			/**
+			 * @brief Appends points to a streaming plot (backed by a RingBufferDataSource).
+			 *
+			 * The oldest points are evicted once the capacity is reached, or once they leave the
+			 * sliding window. The next draw only tessellates the new segments.
+			 *
+			 * @param xs Abscissas (expected increasing).
+			 * @param ys Ordinates (same size as xs).
+			 * @throw std::runtime_error if the plot is not a streaming plot.
+			 * @throw std::invalid_argument if xs and ys differ in size.
+			 */
+			void appendPoints( std::span< const double > xs, std::span< const double > ys );
+
+			/**
+			 * @brief Appends points to a streaming plot (backed by a RingBufferDataSource).
+			 * @param points Points to append (x expected increasing).
+			 * @throw std::runtime_error if the plot is not a streaming plot.
+			 */
+			void appendPoints( const std::vector< sf::Vector2f >& points );
+
+			/**
+			 * @brief Sets the width of the sliding x-window of a streaming plot.
+			 *
+			 * Points older than (newest x - width) are evicted, and the plot is drawn shifted so that
+			 * the window maps to the logical range [0, width].
+			 *
+			 * @param width Window width in logical units (0 disables the window).
+			 * @throw std::runtime_error if the plot is not a streaming plot.
+			 * @throw std::invalid_argument if width < 0.
+			 */
+			void setSlidingWindow( double width );
+
+			/**
+			 * @brief Checks whether the plot is a streaming plot.
+			 * @return True if the source is a RingBufferDataSource.
+			 */
+			[[nodiscard]] bool isStreaming( ) const;
+
 			/**
 			 * @brief Draws the connected data points to the window.
 			 *
 			 * The data points are transformed by scale and origin, then connected
-			 * with styled line segments using LineDrawer::drawLine.
+			 * with styled line segments using LineDrawer::appendLine, then submitted
+			 * to the window with a single draw call. The geometry is cached and only
+			 * rebuilt after a component changed (see Entity::isDirty( )) or when the
+			 * render target shows another area.
+			 *
+			 * Segments are clipped to the area shown by @p window before tessellation
+			 * (see wEngine::LineDrawer::appendClippedLine( )). Streaming plots are not
+			 * clipped: their geometry is scrolled by a translation, and the sliding window
+			 * already bounds it to the visible span.
 			 *
-			 * @param window Target SFML render window.
+			 * @param window Target SFML render target.
 			 */
-			void drawDataPlot( sf::RenderWindow &window );
+			void drawDataPlot( sf::RenderTarget& window );
 
 		private:
-			std::vector< sf::Vector2f > mDataPoints;
+			std::unique_ptr< DataSource > mSource;
+			sf::VertexArray mGeometry;
+			sf::FloatRect mGeometryClip;
+			size_t mDrawnPointCount;
+			size_t mVisiblePointCount;
+			sf::Vector2< double > mVisibleRange;
+			bool mHasVisibleRange;
+			bool mSortDeclared;		// sortedness set through setSortedByX( ), never scanned
+			bool mSortDetected;		// the source was flagged sorted by a scan (re-checked on rebuild)
+
+			// Streaming state (only used when the source is a RingBufferDataSource)
+			RingBufferDataSource* mStream;
+			double mSlidingWindow;
+			std::vector< sf::Vertex > mStreamVertices;
+			size_t mStreamStart;
+			std::deque< size_t > mSegmentVertexCounts;
+			std::uint64_t mBuiltAppended;
+			std::uint64_t mBuiltEvicted;
+			double mAnchorX;
+			float mPatternOffset;
+			sf::VertexArray mScratch;
+
+			/**
+			 * @brief Internal: draws a streaming plot, tessellating only what changed since the last draw.
+			 * @param window Target SFML render target.
+			 */
+			void drawStream( sf::RenderTarget& window );
 	};
 
 }//End of namespace wPlot2D
@@ -0,0 +1,215 @@
+/**
+ * @file wDataSource.cpp
+ * @brief Implementation of the DataSource classes.
+ */
+
+#include "wDataSource.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace wPlot2D
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> DataSource.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+DataSource::DataSource( )
+:	mSortedByX{ false }
+{
+
+}
+
+bool DataSource::isSortedByX( ) const
+{
+	return mSortedByX;
+}
+
+void DataSource::setSortedByX( bool sorted )
+{
+	mSortedByX = sorted;
+}
+
+bool DataSource::scanSortedByX( ) const
+{
+	const size_t count = size( );
+	if (count == 0)
+	{
+		return true;
+	}
+
+	double previous = pointAt( 0 ).x;
+	if (std::isnan( previous ))
+	{
+		return false;
+	}
+
+	for (size_t i = 1; i < count; ++i)
+	{
+		const double x = pointAt( i ).x;
+
+		// Written so that a NaN x fails the test
+		if (!(x >= previous))
+		{
+			return false;
+		}
+		previous = x;
+	}
+
+	return true;
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> PointDataSource.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+PointDataSource::PointDataSource( const std::vector< sf::Vector2f >& points )
+:	mPoints{ points }
+{
+
+}
+
+size_t PointDataSource::size( ) const
+{
+	return mPoints.size( );
+}
+
+sf::Vector2< double > PointDataSource::pointAt( size_t index ) const
+{
+	const sf::Vector2f& point = mPoints[ index ];
+	return { static_cast< double >( point.x ), static_cast< double >( point.y ) };
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> StridedDataSource.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+StridedDataSource::StridedDataSource( StridedView xs, StridedView ys )
+:	mXs{ xs },
+	mYs{ ys }
+{
+	if (mXs.count != mYs.count)
+	{
+		throw std::invalid_argument( "StridedDataSource: x and y views must have the same number of elements." );
+	}
+}
+
+size_t StridedDataSource::size( ) const
+{
+	return mXs.count;
+}
+
+sf::Vector2< double > StridedDataSource::pointAt( size_t index ) const
+{
+	return { mXs[ index ], mYs[ index ] };
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> RingBufferDataSource.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+RingBufferDataSource::RingBufferDataSource( size_t capacity )
+:	mHead{ 0 },
+	mSize{ 0 },
+	mTotalAppended{ 0 },
+	mTotalEvicted{ 0 },
+	mSortedFrom{ 0 }
+{
+	if (capacity == 0)
+	{
+		throw std::invalid_argument( "RingBufferDataSource: capacity must be > 0." );
+	}
+
+	mBuffer.resize( capacity );
+	setSortedByX( true );
+}
+
+size_t RingBufferDataSource::size( ) const
+{
+	return mSize;
+}
+
+sf::Vector2< double > RingBufferDataSource::pointAt( size_t index ) const
+{
+	size_t position = mHead + index;
+	if (position >= mBuffer.size( ))
+	{
+		position -= mBuffer.size( );
+	}
+	return mBuffer[ position ];
+}
+
+size_t RingBufferDataSource::getCapacity( ) const
+{
+	return mBuffer.size( );
+}
+
+void RingBufferDataSource::append( sf::Vector2< double > point )
+{
+	// Written so that a NaN x breaks the order: the points stay unsorted until the one before the break is evicted
+	if (mSize > 0 && !(point.x >= pointAt( mSize - 1 ).x))
+	{
+		mSortedFrom = mTotalAppended;
+	}
+
+	if (mSize == mBuffer.size( ))
+	{
+		// Full: the new point takes the slot of the oldest one.
+		mBuffer[ mHead ] = point;
+		mHead = (mHead + 1) % mBuffer.size( );
+		++mTotalEvicted;
+	}
+	else
+	{
+		mBuffer[ (mHead + mSize) % mBuffer.size( ) ] = point;
+		++mSize;
+	}
+
+	++mTotalAppended;
+	updateSortedByX( );
+}
+
+void RingBufferDataSource::evictOlderThan( double xMin )
+{
+	while (mSize > 0 && mBuffer[ mHead ].x < xMin)
+	{
+		mHead = (mHead + 1) % mBuffer.size( );
+		--mSize;
+		++mTotalEvicted;
+	}
+	updateSortedByX( );
+}
+
+void RingBufferDataSource::clear( )
+{
+	mTotalEvicted += mSize;
+	mHead = 0;
+	mSize = 0;
+	updateSortedByX( );
+}
+
+std::uint64_t RingBufferDataSource::getTotalAppended( ) const
+{
+	return mTotalAppended;
+}
+
+std::uint64_t RingBufferDataSource::getTotalEvicted( ) const
+{
+	return mTotalEvicted;
+}
+
+void RingBufferDataSource::updateSortedByX( )
+{
+	setSortedByX( mTotalEvicted >= mSortedFrom );
+}
+
+}//End of namespace wPlot2D
\ No newline at end of file
@@ -0,0 +1,296 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_DATA_SOURCE_HPP
+#define W_DATA_SOURCE_HPP
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#include <SFML/System/Vector2.hpp>
+#pragma GCC diagnostic pop
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace wPlot2D
+{
+
+	/**
+	 * @class DataSource
+	 * @brief Read-only, random-access sequence of (x, y) points consumed by DataPlotEntity.
+	 *
+	 * DataPlotEntity never assumes how its points are stored: it only asks the source for
+	 * its size and for the point at a given index, in double precision. This allows plotting
+	 * data that already lives elsewhere (caller-owned columns, interleaved records) without
+	 * copying it.
+	 *
+	 * @see PointDataSource, StridedDataSource
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class DataSource
+	{
+		public:
+			/**
+			 * @brief Virtual destructor.
+			 */
+			virtual ~DataSource( ) = default;
+
+			/**
+			 * @brief Returns the number of points.
+			 * @return Point count.
+			 */
+			[[nodiscard]] virtual size_t size( ) const = 0;
+
+			/**
+			 * @brief Returns the point at the given index.
+			 * @param index Point index (< size( )).
+			 * @return Logical (x, y) coordinates.
+			 */
+			[[nodiscard]] virtual sf::Vector2< double > pointAt( size_t index ) const = 0;
+
+			/**
+			 * @brief Tells whether the points are sorted by increasing x.
+			 *
+			 * Sorted sources let DataPlotEntity locate the visible x-range by binary search and
+			 * read only the points inside it.
+			 *
+			 * @return True if x is non-decreasing with the index (false by default).
+			 */
+			[[nodiscard]] bool isSortedByX( ) const;
+
+			/**
+			 * @brief Declares whether the points are sorted by increasing x.
+			 * @param sorted True if x is non-decreasing with the index.
+			 */
+			void setSortedByX( bool sorted );
+
+			/**
+			 * @brief Reads every point once and tells whether x is non-decreasing with the index.
+			 *
+			 * The declared flag (isSortedByX( )) is left unchanged.
+			 *
+			 * @return True if the points are sorted by x (a NaN x makes the source unsorted).
+			 */
+			[[nodiscard]] bool scanSortedByX( ) const;
+		protected:
+			/**
+			 * @brief Protected constructor to restrict instantiation to derived classes.
+			 */
+			DataSource( );
+		private:
+			bool mSortedByX;
+	};
+
+	/**
+	 * @class PointDataSource
+	 * @brief DataSource owning a copy of its points (the historical DataPlotEntity storage).
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class PointDataSource : public DataSource
+	{
+		public:
+			/**
+			 * @brief Constructs the source by copying the given points.
+			 * @param points Vector of (x, y) points.
+			 */
+			explicit PointDataSource( const std::vector< sf::Vector2f >& points );
+
+			[[nodiscard]] size_t size( ) const override;
+			[[nodiscard]] sf::Vector2< double > pointAt( size_t index ) const override;
+		private:
+			std::vector< sf::Vector2f > mPoints;
+	};
+
+	/**
+	 * @struct StridedView
+	 * @brief Non-owning view over a sequence of doubles separated by a constant stride.
+	 *
+	 * Covers contiguous columns (stride = sizeof( double )) as well as one field of an array
+	 * of records (stride = sizeof( Record )).
+	 *
+	 * ### Usage Example:
+	 *	@code
+	 *		struct Sample { double time; double value; int flags; };
+	 *		std::vector< Sample > samples = ...;
+	 *		auto xs = wPlot2D::StridedView::fromMember( std::span< const Sample >( samples ), &Sample::time );
+	 *		auto ys = wPlot2D::StridedView::fromMember( std::span< const Sample >( samples ), &Sample::value );
+	 *	@endcode
+	 */
+	struct StridedView
+	{
+		const std::byte* data;	///< Address of the first element.
+		size_t count;			///< Number of elements.
+		size_t stride;			///< Distance between two consecutive elements, in bytes.
+
+		/**
+		 * @brief Reads the element at the given index.
+		 * @param index Element index (< count).
+		 * @return Element value.
+		 */
+		[[nodiscard]] double operator[]( size_t index ) const
+		{
+			// memcpy keeps the read well-defined for packed or unaligned records.
+			double value;
+			std::memcpy( &value, data + index * stride, sizeof( double ) );
+			return value;
+		}
+
+		/**
+		 * @brief Builds a view over a contiguous column.
+		 * @param values Column values.
+		 * @return View with stride sizeof( double ).
+		 */
+		[[nodiscard]] static StridedView fromSpan( std::span< const double > values )
+		{
+			return StridedView{ reinterpret_cast< const std::byte* >( values.data( ) ), values.size( ), sizeof( double ) };
+		}
+
+		/**
+		 * @brief Builds a view over one double field of an array of records.
+		 * @tparam Record Record type.
+		 * @param records Array of records.
+		 * @param member Pointer to the double member to view.
+		 * @return View with stride sizeof( Record ).
+		 */
+		template< typename Record >
+		[[nodiscard]] static StridedView fromMember( std::span< const Record > records, double Record::* member )
+		{
+			if (records.empty( ))
+			{
+				return StridedView{ nullptr, 0, sizeof( Record ) };
+			}
+
+			return StridedView{ reinterpret_cast< const std::byte* >( &(records.front( ).*member) ), records.size( ), sizeof( Record ) };
+		}
+	};
+
+	/**
+	 * @class StridedDataSource
+	 * @brief Non-owning DataSource reading x and y from two caller-owned strided views.
+	 *
+	 * No data is copied or narrowed to float: points are read in place, in double precision,
+	 * each time the plot geometry is rebuilt.
+	 *
+	 * @warning Lifetime contract: the viewed memory is owned by the caller. It must stay valid
+	 *          and must not be reallocated for as long as the owning DataPlotEntity (hence its
+	 *          GraphicsEntity) may be rendered. If the values are modified in place, call
+	 *          DataPlotEntity::markDirty( ) so that the cached geometry is rebuilt.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class StridedDataSource : public DataSource
+	{
+		public:
+			/**
+			 * @brief Constructs the source from two views.
+			 * @param xs View over the abscissas.
+			 * @param ys View over the ordinates.
+			 * @throw std::invalid_argument if both views do not have the same count.
+			 */
+			StridedDataSource( StridedView xs, StridedView ys );
+
+			[[nodiscard]] size_t size( ) const override;
+			[[nodiscard]] sf::Vector2< double > pointAt( size_t index ) const override;
+		private:
+			StridedView mXs;
+			StridedView mYs;
+	};
+
+	/**
+	 * @class RingBufferDataSource
+	 * @brief Fixed-capacity DataSource for live data: new points are appended, the oldest are evicted.
+	 *
+	 * Storage is allocated once at construction. Appending to a full buffer overwrites the oldest
+	 * point, so memory stays bounded however long the stream runs. Indices are logical: 0 is always
+	 * the oldest point still held.
+	 *
+	 * Two monotonic counters (total appended, total evicted) let consumers find out which points
+	 * are new since they last looked, and tessellate only those.
+	 *
+	 * The source keeps isSortedByX( ) up to date by itself: appending a point whose x is lower
+	 * than the previous one (or NaN) clears the flag, which comes back once the point before
+	 * that break has been evicted.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class RingBufferDataSource : public DataSource
+	{
+		public:
+			/**
+			 * @brief Allocates the buffer.
+			 * @param capacity Maximum number of points held (> 0).
+			 * @throw std::invalid_argument if capacity is 0.
+			 */
+			explicit RingBufferDataSource( size_t capacity );
+
+			[[nodiscard]] size_t size( ) const override;
+			[[nodiscard]] sf::Vector2< double > pointAt( size_t index ) const override;
+
+			/**
+			 * @brief Returns the maximum number of points held.
+			 * @return Capacity.
+			 */
+			[[nodiscard]] size_t getCapacity( ) const;
+
+			/**
+			 * @brief Appends a point, evicting the oldest one if the buffer is full.
+			 * @param point Logical (x, y) coordinates.
+			 */
+			void append( sf::Vector2< double > point );
+
+			/**
+			 * @brief Evicts the oldest points while their x is lower than @p xMin.
+			 * @param xMin Smallest x kept.
+			 */
+			void evictOlderThan( double xMin );
+
+			/**
+			 * @brief Evicts every point (the counters keep running).
+			 */
+			void clear( );
+
+			/**
+			 * @brief Returns the number of points appended since construction.
+			 * @return Monotonic append counter.
+			 */
+			[[nodiscard]] std::uint64_t getTotalAppended( ) const;
+
+			/**
+			 * @brief Returns the number of points evicted since construction.
+			 * @return Monotonic eviction counter.
+			 */
+			[[nodiscard]] std::uint64_t getTotalEvicted( ) const;
+		private:
+			/**
+			 * @brief Internal: flags the source sorted when the last break of the x order has been evicted.
+			 */
+			void updateSortedByX( );
+
+			std::vector< sf::Vector2< double > > mBuffer;
+			size_t mHead;
+			size_t mSize;
+			std::uint64_t mTotalAppended;
+			std::uint64_t mTotalEvicted;
+			std::uint64_t mSortedFrom;		// sorted once the points appended before this count are evicted
+	};
+
+}//End of namespace wPlot2D
+
+#endif
\ No newline at end of file
@@ -115,11 +115,11 @@ void FrameEntity::update( const sf::FloatRect& contentBounds, const sf::Vector2f
 	mFrame.setPosition( position );
 }
 
-void FrameEntity::render( sf::RenderWindow& window )
+void FrameEntity::render( sf::RenderTarget& window, const sf::RenderStates& states )
 {
 	if (mEnabled)
 	{
-		window.draw( mFrame );
+		window.draw( mFrame, states );
 	}
 }
 
@@ -121,10 +121,11 @@ namespace wPlot2D
 			void update( const sf::FloatRect& contentBounds, const sf::Vector2f& position );
 
 			/**
-			 * @brief Renders the frame to the given render window.
-			 * @param window Target render window.
+			 * @brief Renders the frame to the given render target.
+			 * @param window Target render target.
+			 * @param states Render states (e.g. a translation applied to this draw only).
 			 */
-			void render( sf::RenderWindow& window );
+			void render( sf::RenderTarget& window, const sf::RenderStates& states = sf::RenderStates::Default );
 		private:
 			bool mEnabled;
 			sf::RectangleShape mFrame;
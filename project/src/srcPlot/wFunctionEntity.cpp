@@ -16,8 +16,11 @@
 #include "../srcComponents/wFunctionComponent.hpp"
 #include "../srcComponents/wDiscontinuityComponent.hpp"
 #include "../srcComponents/wRotationComponent.hpp"
+#include "../srcComponents/wSamplingComponent.hpp"
 
-#include <numbers>
+#include <atomic>
+#include <limits>
+#include <span>
 
 namespace wPlot2D
 {
@@ -29,6 +32,10 @@ namespace wPlot2D
 */
 
 FunctionEntity::FunctionEntity( const sf::Vector2f origin, const sf::Vector2f scale, std::function< double( double ) > func )
+:	mEvaluationCount{ 0 },
+	mGeometry{ sf::PrimitiveType::Triangles },
+	mGeometryDomain{ 0.0, 0.0, 0 },
+	mGeometryClip{ }
 {
 	addComponent< wEngine::PositionComponent >( origin );
 	addComponent< wEngine::ScaleComponent >( scale );
@@ -39,6 +46,25 @@ FunctionEntity::FunctionEntity( const sf::Vector2f origin, const sf::Vector2f sc
 	addComponent< wEngine::OffsetComponent >( );
 	addComponent< wEngine::RotationComponent >( );
 	addComponent< wEngine::LineStyleComponent >( wEngine::LineStyleComponent::LineStyle::Solid );
+	addComponent< wEngine::SamplingComponent >( );
+}
+
+FunctionEntity::FunctionEntity( const sf::Vector2f origin, const sf::Vector2f scale, wEngine::FunctionComponent::BatchFunction func )
+:	mEvaluationCount{ 0 },
+	mGeometry{ sf::PrimitiveType::Triangles },
+	mGeometryDomain{ 0.0, 0.0, 0 },
+	mGeometryClip{ }
+{
+	addComponent< wEngine::PositionComponent >( origin );
+	addComponent< wEngine::ScaleComponent >( scale );
+	addComponent< wEngine::ColorComponent >( sf::Color::Black );
+	addComponent< wEngine::ThicknessComponent >( 3.0f );
+	addComponent< wEngine::FunctionComponent >( func );
+	addComponent< wEngine::DiscontinuityComponent >( );
+	addComponent< wEngine::OffsetComponent >( );
+	addComponent< wEngine::RotationComponent >( );
+	addComponent< wEngine::LineStyleComponent >( wEngine::LineStyleComponent::LineStyle::Solid );
+	addComponent< wEngine::SamplingComponent >( );
 }
 
 /*
@@ -95,6 +121,16 @@ float FunctionEntity::getRotation( ) const
 	return rotationComponent->getAngle( );
 }
 
+size_t FunctionEntity::getEvaluationCount( ) const
+{
+	return mEvaluationCount;
+}
+
+unsigned int FunctionEntity::getEvaluationThreads( ) const
+{
+	return mEvaluationPool ? mEvaluationPool->getThreadCount( ) : 1;
+}
+
 void FunctionEntity::setPosition( sf::Vector2f position )
 {
 	auto positionComponent = requireComponent< wEngine::PositionComponent >( "FunctionEntity::setPosition( )" );
@@ -149,6 +185,31 @@ void FunctionEntity::setScale( sf::Vector2f scale )
 	scaleComponent->setScale( scale );
 }
 
+void FunctionEntity::setAdaptiveSampling( unsigned int maxDepth, float tolerance )
+{
+	auto samplingComponent = requireComponent< wEngine::SamplingComponent >( "FunctionEntity::setAdaptiveSampling( )" );
+	samplingComponent->setMaxDepth( maxDepth );
+	samplingComponent->setTolerance( tolerance );
+	samplingComponent->setMode( wEngine::SamplingComponent::SamplingMode::Adaptive );
+}
+
+void FunctionEntity::setUniformSampling( )
+{
+	auto samplingComponent = requireComponent< wEngine::SamplingComponent >( "FunctionEntity::setUniformSampling( )" );
+	samplingComponent->setMode( wEngine::SamplingComponent::SamplingMode::Uniform );
+}
+
+void FunctionEntity::setEvaluationThreads( unsigned int threadCount )
+{
+	if (threadCount == 1)
+	{
+		mEvaluationPool.reset( );
+		return;
+	}
+
+	mEvaluationPool = std::make_unique< wEngine::ThreadPool >( threadCount );
+}
+
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 -> Public methods.
@@ -188,43 +249,146 @@ void FunctionEntity::alignToYAxis(float normalizedOffsetX, float normalizedOffse
 	});
 }
 
-void FunctionEntity::drawFunction( sf::RenderWindow& window, double startX, double endX, size_t nbPoints )
+void FunctionEntity::drawFunction( sf::RenderTarget& window, double startX, double endX, size_t nbPoints )
 {
+	// --- Area shown by the target, widened by the thickness so caps and joins at the border are kept ---
+	const sf::FloatRect clipRect = wEngine::LineDrawer::getClipRect( window,
+		component< wEngine::ThicknessComponent >( "FunctionEntity::drawFunction( )" ).getThickness( ) );
+
+	// --- Replay the cached curve when nothing changed since the last rebuild ---
+	if (!isDirty( ) && std::tie( startX, endX, nbPoints ) == mGeometryDomain && clipRect == mGeometryClip)
+	{
+		mEvaluationCount = 0;
+		if (mGeometry.getVertexCount( ) > 0)
+		{
+			window.draw( mGeometry );
+		}
+		return;
+	}
+
 	// --- Retrieve required components ---
-	auto positionComponent		= requireComponent< wEngine::PositionComponent >( "FunctionEntity::drawFunction( )" );
-	auto colorComponent			= requireComponent< wEngine::ColorComponent >( "FunctionEntity::drawFunction( )" );
-	auto thicknessComponent		= requireComponent< wEngine::ThicknessComponent >( "FunctionEntity::drawFunction( )" );
-	auto scaleComponent			= requireComponent< wEngine::ScaleComponent >( "FunctionEntity::drawFunction( )" );
-	auto functionComponent		= requireComponent< wEngine::FunctionComponent >( "FunctionEntity::drawFunction( )" );
-	auto discontinuityComponent	= requireComponent< wEngine::DiscontinuityComponent >( "FunctionEntity::drawFunction( )" );
-	auto lineStyleComponent		= requireComponent< wEngine::LineStyleComponent >( "FunctionEntity::drawFunction( )" );
-	auto offsetComponent		= requireComponent< wEngine::OffsetComponent >( "FunctionEntity::drawFunction( )" );
-	auto rotationComponent		= requireComponent< wEngine::RotationComponent >( "FunctionEntity::drawFunction( )" );
-
-	sf::Vector2f origin	= positionComponent->getPosition( );
-	sf::Color color		= colorComponent->getColor( );
-	float thickness		= thicknessComponent->getThickness( );
-	sf::Vector2f scale	= scaleComponent->getScale( );
-	sf::Vector2f offset	= offsetComponent->getOffset( );
-	float rotationAngle	= rotationComponent->getAngle( );
+	auto& positionComponent			= component< wEngine::PositionComponent >( "FunctionEntity::drawFunction( )" );
+	auto& colorComponent			= component< wEngine::ColorComponent >( "FunctionEntity::drawFunction( )" );
+	auto& thicknessComponent		= component< wEngine::ThicknessComponent >( "FunctionEntity::drawFunction( )" );
+	auto& scaleComponent			= component< wEngine::ScaleComponent >( "FunctionEntity::drawFunction( )" );
+	auto& functionComponent			= component< wEngine::FunctionComponent >( "FunctionEntity::drawFunction( )" );
+	auto& discontinuityComponent	= component< wEngine::DiscontinuityComponent >( "FunctionEntity::drawFunction( )" );
+	auto& lineStyleComponent		= component< wEngine::LineStyleComponent >( "FunctionEntity::drawFunction( )" );
+	auto& offsetComponent			= component< wEngine::OffsetComponent >( "FunctionEntity::drawFunction( )" );
+	auto& rotationComponent			= component< wEngine::RotationComponent >( "FunctionEntity::drawFunction( )" );
+	auto& samplingComponent			= component< wEngine::SamplingComponent >( "FunctionEntity::drawFunction( )" );
+
+	sf::Vector2f origin	= positionComponent.getPosition( );
+	sf::Color color		= colorComponent.getColor( );
+	float thickness		= thicknessComponent.getThickness( );
+	sf::Vector2f scale	= scaleComponent.getScale( );
+	sf::Vector2f offset	= offsetComponent.getOffset( );
+	float rotationAngle	= rotationComponent.getAngle( );
 
 	// --- Sample the function in the user-defined domain ---
-	std::vector< double > xPoints = wEngine::MathUtils::linspace( startX, endX, nbPoints );
+	// Points inside excluded intervals are never evaluated, and undefined
+	// results (NaN or Inf) are normalized to NaN: both break the curve.
+	// The evaluator may run on several threads, hence the atomic counter.
+	std::atomic< size_t > evaluationCount{ 0 };
+	auto evaluate = [ & ]( double x ) -> double
+	{
+		if (discontinuityComponent.isInExcludedInterval( x ))
+		{
+			return std::numeric_limits< double >::quiet_NaN( );
+		}
+
+		evaluationCount.fetch_add( 1, std::memory_order_relaxed );
+		double y = functionComponent.calculate( x );
+		return std::isfinite( y ) ? y : std::numeric_limits< double >::quiet_NaN( );
+	};
+
+	std::vector< double > xPoints;
+	std::vector< double > yPoints;
+
+	if (samplingComponent.getMode( ) == wEngine::SamplingComponent::SamplingMode::Adaptive)
+	{
+		// Coarse grid of nbPoints samples, refined where the curve bends on screen.
+		wEngine::MathUtils::adaptiveSample( evaluate, startX, endX, nbPoints,
+			samplingComponent.getMaxDepth( ), samplingComponent.getTolerance( ), scale, xPoints, yPoints,
+			mEvaluationPool.get( ) );
+	}
+	else
+	{
+		xPoints = wEngine::MathUtils::linspace( startX, endX, nbPoints );
+		yPoints.resize( xPoints.size( ) );
 
-	// --- Rotation (in radians)
-	float rad	= rotationAngle * static_cast< float >( std::numbers::pi ) / 180.0f;
-	float cosA	= std::cos( rad );
-	float sinA	= std::sin( rad );
+		// Each index is written by exactly one chunk, so the buffer needs no locking.
+		auto evaluateRange = [ & ]( size_t begin, size_t end )
+		{
+			if (!functionComponent.hasBatchFunction( ))
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					yPoints[ i ] = evaluate( xPoints[ i ] );
+				}
+				return;
+			}
+
+			// One call per run of non-excluded points, then apply the same rules as evaluate( ).
+			size_t i = begin;
+			while (i < end)
+			{
+				if (discontinuityComponent.isInExcludedInterval( xPoints[ i ] ))
+				{
+					yPoints[ i++ ] = std::numeric_limits< double >::quiet_NaN( );
+					continue;
+				}
+
+				size_t runEnd = i + 1;
+				while (runEnd < end && !discontinuityComponent.isInExcludedInterval( xPoints[ runEnd ] ))
+				{
+					++runEnd;
+				}
+
+				std::span< const double > xs( xPoints.data( ) + i, runEnd - i );
+				std::span< double > ys( yPoints.data( ) + i, runEnd - i );
+				functionComponent.calculateBatch( xs, ys );
+				evaluationCount.fetch_add( runEnd - i, std::memory_order_relaxed );
+
+				for (; i < runEnd; ++i)
+				{
+					if (!std::isfinite( yPoints[ i ] ))
+					{
+						yPoints[ i ] = std::numeric_limits< double >::quiet_NaN( );
+					}
+				}
+			}
+		};
+
+		if (mEvaluationPool)
+		{
+			mEvaluationPool->parallelFor( xPoints.size( ), evaluateRange );
+		}
+		else
+		{
+			evaluateRange( 0, xPoints.size( ) );
+		}
+	}
+
+	mEvaluationCount = evaluationCount.load( );
+
+	// --- Map every sample to pixel space at once ---
+	// Scale (y inverted, SFML's y-axis grows downward), rotation around the logical origin,
+	// offset applied AFTER rotation and translation to the entity's origin, computed on
+	// contiguous arrays (see MathUtils::transformPoints( )).
+	std::vector< float > pixelX( xPoints.size( ) );
+	std::vector< float > pixelY( xPoints.size( ) );
+	wEngine::MathUtils::transformPoints( xPoints, yPoints, scale, rotationAngle, offset, origin, pixelX, pixelY );
 
 	// --- Split the curve into continuous segments ---
 	// Each segment represents a part of the function without discontinuity.
 	std::vector< std::vector< sf::Vector2f > > segments;
 	segments.emplace_back( );
 
-	for (double x : xPoints)
+	for (size_t i = 0; i < xPoints.size( ); ++i)
 	{
-		// (1) Skip points inside excluded intervals.
-		if (discontinuityComponent->isInExcludedInterval( x ))
+		// Excluded intervals and undefined results are discontinuities.
+		if (std::isnan( yPoints[ i ] ))
 		{
 			// Close current segment if it has points and start a new one.
 			if (!segments.back( ).empty( ))
@@ -234,66 +398,42 @@ void FunctionEntity::drawFunction( sf::RenderWindow& window, double startX, doub
 			continue;
 		}
 
-		// (2) Evaluate the function at x.
-		double y = functionComponent->calculate( x );
-
-		// (3) Handle undefined results (NaN or Inf) as discontinuities.
-		if (std::isnan( y ) || std::isinf( y ))
-		{
-			if (!segments.back( ).empty( ))
-			{
-				segments.emplace_back( );// start new segment
-			}
-			continue;
-		}
-		
-		// (4) Compute point.
-
-		// --- Compute point with scale ---
-		// Convert logical coordinates (x, y) into scaled pixel space.
-		// Note: y is inverted because in SFML the y-axis grows downward.
-		float px = static_cast< float >( x ) * scale.x;
-		float py = -static_cast <float >( y ) * scale.y;
-
-		// --- Apply rotation around origin ---
-		// Rotate the scaled point using the standard 2D rotation matrix:
-		// [ cosA -sinA ] [px]
-		// [ sinA  cosA ] [py]
-		// The rotation is always performed around the logical origin (0,0).
-		float rx = px * cosA - py * sinA;
-		float ry = px * sinA + py * cosA;
-
-		// --- Apply offset AFTER rotation ---
-		// Offset is applied after rotation to avoid "rotating the offset" itself. This allows a clean translation of the entire rotated curve.
-		rx += offset.x * scale.x;
-		ry -= offset.y * scale.y;
-
-		// --- Translate to window origin ---
-		// Finally, shift everything by the entity's origin, which acts as the anchor point of the whole plot in the window coordinate system.
-		sf::Vector2f point(origin.x + rx, origin.y + ry);
-
-		// (5) Add point to the current continuous segment.
-		segments.back( ).push_back( point );
+		// Add point to the current continuous segment.
+		segments.back( ).emplace_back( pixelX[ i ], pixelY[ i ] );
 	}
 
-	// --- Render each valid continuous segment ---
-	// At least 2 points are required to draw a polyline.
+	// --- Tessellate each valid continuous segment into a single batch ---
+	// At least 2 points are required to draw a polyline. All segments share
+	// the same style, so the whole curve is submitted with one draw call.
+	// Each segment is clipped to the target area first: off-screen parts emit nothing.
+	mGeometry.clear( );
+
 	for (auto& segment : segments)
 	{
 		if (segment.size( ) >= 2)
 		{
-			wEngine::LineDrawer::drawPolylineRound(
-				window,
+			wEngine::LineDrawer::appendClippedPolylineRound(
+				mGeometry,
 				segment,
+				clipRect,
 				color,
 				thickness,
-				lineStyleComponent->getStyle( ),
-				lineStyleComponent->getDashLength( ),
-				lineStyleComponent->getGapLength( ),
+				lineStyleComponent.getStyle( ),
+				lineStyleComponent.getDashLength( ),
+				lineStyleComponent.getGapLength( ),
 				12 // arcResolution (default for rounded joins)
 			);
 		}
 	}
+
+	mGeometryDomain = { startX, endX, nbPoints };
+	mGeometryClip = clipRect;
+	clearDirty( );
+
+	if (mGeometry.getVertexCount( ) > 0)
+	{
+		window.draw( mGeometry );
+	}
 }
 
 }//End of namespace wPlot2D
\ No newline at end of file
@@ -9,6 +9,7 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #define W_FUNCTION_ENTITY_HPP
 
 #include "../srcEntity/wEntity.hpp"
+#include "../srcUtils/wThreadPool.hpp"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wfloat-equal"
@@ -18,8 +19,11 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #pragma GCC diagnostic pop
 
 #include <functional>
+#include <memory>
+#include <tuple>
 
 #include "../srcComponents/wLineStyleComponent.hpp"
+#include "../srcComponents/wFunctionComponent.hpp"
 
 namespace wPlot2D
 {
@@ -34,7 +38,8 @@ namespace wPlot2D
 	 * - Offset and rotation of the curve.
 	 * - Discontinuities handled by excluded intervals.
 	 *
-	 * The function is sampled at evenly spaced x-values and rendered as a polyline.
+	 * The function is sampled at evenly spaced x-values (default) or adaptively, refining only
+	 * where the curve bends on screen (see setAdaptiveSampling( )), and rendered as a polyline.
 	 * Excluded intervals and invalid values (NaN, Inf) split the curve into separate segments.
 	 *
 	 * @author Wilfried Koch
@@ -52,6 +57,19 @@ namespace wPlot2D
 			 */
 			FunctionEntity( const sf::Vector2f origin, const sf::Vector2f scale, std::function< double( double ) > func );
 
+			/**
+			 * @brief Construct a new FunctionEntity from a batch function.
+			 *
+			 * With uniform sampling the whole grid (or one chunk per thread, see setEvaluationThreads( ))
+			 * is evaluated in a single call, split around excluded intervals. Adaptive refinement
+			 * evaluates one point per call.
+			 *
+			 * @param origin Logical origin of the coordinate system (pixels).
+			 * @param scale Scale factors for x and y (pixels per unit).
+			 * @param func Batch function filling ys[i] = f(xs[i]).
+			 */
+			FunctionEntity( const sf::Vector2f origin, const sf::Vector2f scale, wEngine::FunctionComponent::BatchFunction func );
+
 			/**
 			 * @brief Virtual destructor.
 			 */
@@ -107,6 +125,19 @@ namespace wPlot2D
 			 */
 			[[nodiscard]] float getRotation( ) const;
 
+			/**
+			 * @brief Get the number of function evaluations performed by the last drawFunction( ) call.
+			 * @return Number of points passed to the user function (points in excluded intervals are never
+			 *         evaluated).
+			 */
+			[[nodiscard]] size_t getEvaluationCount( ) const;
+
+			/**
+			 * @brief Get the number of threads used to evaluate the function.
+			 * @return 1 when evaluation is serial (default), otherwise the size of the evaluation pool.
+			 */
+			[[nodiscard]] unsigned int getEvaluationThreads( ) const;
+
 			/**
 			 * @brief Set the position (origin) of the function in pixel space.
 			 * @param position The new origin as an sf::Vector2f.
@@ -180,6 +211,37 @@ namespace wPlot2D
 			 */
 			void setScale( sf::Vector2f scale );
 
+			/**
+			 * @brief Enable adaptive sampling of the function.
+			 *
+			 * The `nbPoints` passed to drawFunction( ) becomes the size of a coarse uniform grid.
+			 * Each grid interval is bisected recursively while the curve deviates from its chord by
+			 * more than @p tolerance pixels on screen, up to @p maxDepth bisections. Flat regions are
+			 * therefore evaluated only a few times, while steep or strongly curved regions (and the
+			 * neighborhood of excluded intervals) are refined.
+			 *
+			 * @param maxDepth	Maximum number of bisections per coarse interval (<= 30).
+			 * @param tolerance	Maximum screen-space error in pixels (must be > 0).
+			 * @throw std::invalid_argument if maxDepth > 30 or tolerance <= 0.
+			 */
+			void setAdaptiveSampling( unsigned int maxDepth, float tolerance );
+
+			/**
+			 * @brief Restore uniform sampling (evenly spaced x-values, the default).
+			 */
+			void setUniformSampling( );
+
+			/**
+			 * @brief Evaluate the function on several threads (opt-in, for expensive callbacks).
+			 *
+			 * Only the evaluation stage runs in parallel: y-values are written into a preallocated
+			 * buffer, then segmentation and tessellation run serially, so the drawn curve is identical
+			 * to the serial one. The user function must be safe to call concurrently.
+			 *
+			 * @param threadCount Number of threads (1 = serial, 0 = hardware concurrency).
+			 */
+			void setEvaluationThreads( unsigned int threadCount );
+
 			/**
 			 * @brief Add an excluded interval where the function should not be drawn.
 			 *
@@ -211,13 +273,29 @@ namespace wPlot2D
 
 			/**
 			 * @brief Draw the function on the target window.
+			 *
+			 * The tessellated curve is cached: as long as no component changed (see Entity::isDirty( )),
+			 * the sampling range is the same and the render target shows the same area, the cached
+			 * vertices are drawn again without evaluating the function. Call markDirty( ) if the
+			 * function itself depends on state that changed.
+			 *
+			 * The curve is clipped to the area shown by @p window before tessellation
+			 * (see wEngine::LineDrawer::appendClippedPolylineRound( )): parts leaving the screen,
+			 * such as `tan( x )` near its poles, emit no triangles.
+			 *
 			 * @param window Render target.
 			 * @param startX Start of the logical x-range.
 			 * @param endX End of the logical x-range.
-			 * @param nbPoints Number of points to sample (default: 1000).
+			 * @param nbPoints Number of points to sample (default: 1000). In adaptive mode, size of the initial coarse grid.
 			 */
-			void drawFunction( sf::RenderWindow &window, double startX, double endX, size_t nbPoints = 1000 );
+			void drawFunction( sf::RenderTarget& window, double startX, double endX, size_t nbPoints = 1000 );
 		private:
+			size_t mEvaluationCount;
+			std::unique_ptr< wEngine::ThreadPool > mEvaluationPool;
+
+			sf::VertexArray mGeometry;
+			std::tuple< double, double, size_t > mGeometryDomain;
+			sf::FloatRect mGeometryClip;
 	};
 
 }//End of namespace wPlot2D
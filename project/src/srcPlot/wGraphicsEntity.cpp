@@ -5,8 +5,15 @@
 
 #include "wGraphicsEntity.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <filesystem>
 #include <string>
+#include "../srcUtils/wEmbeddedFonts.hpp"
 #include "../srcUtils/wPathUtils.hpp"
+#include "../srcUtils/wThreadPool.hpp"
+#include "wTransformSystem.hpp"
 
 #include "../srcComponents/wColorComponent.hpp"
 #include "../srcComponents/wPositionComponent.hpp"
@@ -24,9 +31,16 @@ namespace wPlot2D
 */
 
 GraphicsEntity::GraphicsEntity( const std::string& windowTitle, const sf::Vector2u& windowSize,
-	const sf::Vector2f& originFactor, const sf::Vector2f& scaleFactor )
+	const sf::Vector2f& originFactor, const sf::Vector2f& scaleFactor, RenderMode renderMode )
+:	mRenderMode{ renderMode },
+	mInteractive{ false }
 {
 
+#ifdef WPLOT2D_EMBED_FONTS
+	// Fonts compiled into the binary: no path lookup nor file access.
+	mAssets.LoadFontFromMemory( "Courier", wEngine::EmbeddedFonts::CourierPrimeCode, wEngine::EmbeddedFonts::CourierPrimeCodeSize );
+	mAssets.LoadFontFromMemory( "Inconsolata", wEngine::EmbeddedFonts::Inconsolata, wEngine::EmbeddedFonts::InconsolataSize );
+#else
 	std::string baseDir = wEngine::PathUtils::getExecutableDir( );
 	std::vector< std::string > fontPathsCourier =
 	{
@@ -41,6 +55,7 @@ GraphicsEntity::GraphicsEntity( const std::string& windowTitle, const sf::Vector
 
 	mAssets.LoadFont( "Courier", fontPathsCourier );
 	mAssets.LoadFont( "Inconsolata", fontPathsInconsolata );
+#endif
 
 	// mAssets.LoadFont( "Courier", wEngine::PathUtils::getExecutableDir( ) + "/../Resources/Fonts/CourierPrimeCode/CourierPrimeCode.ttf" );
 	// mAssets.LoadFont( "Inconsolata", wEngine::PathUtils::getExecutableDir( ) + "/../Resources/Fonts/Inconsolata/Inconsolata.otf" );
@@ -50,14 +65,25 @@ GraphicsEntity::GraphicsEntity( const std::string& windowTitle, const sf::Vector
 	sf::ContextSettings settings;
 	settings.antiAliasingLevel = 8;
 
-	mWindow.create( sf::VideoMode( windowSize ), windowTitle, sf::Style::None, sf::State::Windowed, settings );
+	if (mRenderMode == RenderMode::Headless)
+	{
+		// Offscreen target only: no window, no display connection required.
+		if (!mRenderTexture.resize( windowSize, settings ))
+		{
+			throw std::runtime_error( "GraphicsEntity: unable to create the offscreen render texture." );
+		}
+	}
+	else
+	{
+		mWindow.create( sf::VideoMode( windowSize ), windowTitle, sf::Style::None, sf::State::Windowed, settings );
+	}
 
 	addComponent< wEngine::PositionComponent >( convertNormalizedToPixels( originFactor ) );
 	addComponent< wEngine::ScaleComponent >( convertNormalizedToPixels( scaleFactor ) );
 	addComponent< wEngine::OffsetComponent >( );
 
 	auto colorComponent = addComponent< wEngine::ColorComponent >( sf::Color::White );
-	mWindow.clear( colorComponent->getColor( ) );
+	getRenderTarget( ).clear( colorComponent->getColor( ) );
 }
 
 /*
@@ -71,13 +97,43 @@ sf::RenderWindow& GraphicsEntity::getWindow( )
 	return mWindow;
 }
 
+sf::RenderTarget& GraphicsEntity::getRenderTarget( )
+{
+	if (mRenderMode == RenderMode::Headless)
+	{
+		return mRenderTexture;
+	}
+	return mWindow;
+}
+
+RenderMode GraphicsEntity::getRenderMode( ) const
+{
+	return mRenderMode;
+}
+
 sf::Vector2u GraphicsEntity::getWindowSize( ) const
 {
+	if (mRenderMode == RenderMode::Headless)
+	{
+		return mRenderTexture.getSize( );
+	}
 	return mWindow.getSize( );
 }
 
 void GraphicsEntity::setWindowSize( const sf::Vector2u& newSize )
 {
+	if (mRenderMode == RenderMode::Headless)
+	{
+		sf::ContextSettings settings;
+		settings.antiAliasingLevel = 8;
+
+		if (!mRenderTexture.resize( newSize, settings ))
+		{
+			throw std::runtime_error( "GraphicsEntity: unable to resize the offscreen render texture." );
+		}
+		return;
+	}
+
 	mWindow.setSize( newSize );
 	sf::View view(sf::FloatRect({0.f, 0.f}, {static_cast<float>(newSize.x), static_cast<float>(newSize.y)}));
 	mWindow.setView(view);
@@ -85,12 +141,18 @@ void GraphicsEntity::setWindowSize( const sf::Vector2u& newSize )
 
 void GraphicsEntity::setWindowTitle( const std::string& title )
 {
-	mWindow.setTitle( title );
+	if (mRenderMode == RenderMode::Windowed)
+	{
+		mWindow.setTitle( title );
+	}
 }
 
 void GraphicsEntity::setBackgroundColor( const sf::Color& color )
 {
-	mWindow.clear( color );
+	auto colorComponent = requireComponent< wEngine::ColorComponent >( "GraphicsEntity::setBackgroundColor( )" );
+	colorComponent->setColor( color );
+
+	getRenderTarget( ).clear( color );
 }
 
 void GraphicsEntity::addFont( const std::string& name, const std::string& fileName )
@@ -115,6 +177,8 @@ void GraphicsEntity::setOrigin( sf::Vector2f originFactor )
 
 	auto positionComponent = requireComponent< wEngine::PositionComponent >( "GraphicsEntity::setOrigin( )" );
 	positionComponent->setPosition( convertNormalizedToPixels( originFactor ) );
+
+	TransformSystem( getOrigin( ), getScale( ) ).update( mPlotRegistry );
 }
 
 [[nodiscard]] sf::Vector2f GraphicsEntity::getScale( ) const
@@ -127,6 +191,8 @@ void GraphicsEntity::setScale( sf::Vector2f scaleFactor )
 {
 	auto scaleComponent = requireComponent< wEngine::ScaleComponent >( "GraphicsEntity::setScale( )" );
 	scaleComponent->setScale( convertNormalizedToPixels( scaleFactor ) );
+
+	TransformSystem( getOrigin( ), getScale( ) ).update( mPlotRegistry );
 }
 
 sf::Vector2f GraphicsEntity::getOffset( ) const
@@ -149,16 +215,17 @@ void GraphicsEntity::setOffset( sf::Vector2f offset )
 
 AxisEntity* GraphicsEntity::addAxis( AxisType type, sf::Vector2f axisRange )
 {
-	if (type == AxisType::X_AXIS)
-	{
-		mAxisX = std::make_unique< AxisEntity >( mAssets.getFont( "Courier" ), getOrigin( ), getScale( ), getOffset( ), type, axisRange );
-		return mAxisX ? mAxisX.get( ) : nullptr;
-	}
-	else
+	auto& axis = (type == AxisType::X_AXIS) ? mAxisX : mAxisY;
+
+	if (axis)
 	{
-		mAxisY = std::make_unique< AxisEntity >( mAssets.getFont( "Courier" ), getOrigin( ), getScale( ), getOffset( ), type, axisRange );
-		return mAxisY ? mAxisY.get( ) : nullptr;
+		mPlotRegistry.remove( *axis );
 	}
+
+	axis = std::make_unique< AxisEntity >( mAssets.getFont( "Courier" ), getOrigin( ), getScale( ), getOffset( ), type, axisRange );
+	mPlotRegistry.add( *axis );
+
+	return axis.get( );
 }
 
 /*
@@ -189,8 +256,8 @@ TitleEntity* GraphicsEntity::addTitleImpl( const T& title, TitleAlignment titleA
 	auto positionComponent = mTitle->requireComponent< wEngine::PositionComponent >( "GraphicsEntity::addTitleImpl( )" );
 	auto offsetComponent = mTitle->requireComponent< wEngine::OffsetComponent >( "GraphicsEntity::addTitleImpl( )" );
 
-	const float windowWidth = static_cast< float >( mWindow.getSize( ).x );
-	const float windowHeight = static_cast< float >( mWindow.getSize( ).y );
+	const float windowWidth = static_cast< float >( getWindowSize( ).x );
+	const float windowHeight = static_cast< float >( getWindowSize( ).y );
 
 	sf::Vector2f basePosition;
 	if (titleAlignment == TitleAlignment::Bottom)
@@ -221,6 +288,28 @@ FunctionEntity* GraphicsEntity::addFunction( std::function< double( double ) > f
 	sf::Vector2f scale  = getScale( );
 
 	auto functionEntity = std::make_unique< FunctionEntity >( origin, scale, func );
+	mPlotRegistry.add( *functionEntity );
+	mFunctions.push_back( FunctionData{ std::move( functionEntity ), startX, endX, nbPoints } );
+
+	return mFunctions.back( ).entity.get( );
+}
+
+FunctionEntity* GraphicsEntity::addFunction( std::function< double( double ) > func, double startX, double endX,
+	unsigned int maxDepth, float tolerance, size_t initialPoints )
+{
+	FunctionEntity* functionEntity = addFunction( func, startX, endX, initialPoints );
+	functionEntity->setAdaptiveSampling( maxDepth, tolerance );
+
+	return functionEntity;
+}
+
+FunctionEntity* GraphicsEntity::addFunction( wEngine::FunctionComponent::BatchFunction func, double startX, double endX, size_t nbPoints )
+{
+	sf::Vector2f origin = getOrigin( );
+	sf::Vector2f scale  = getScale( );
+
+	auto functionEntity = std::make_unique< FunctionEntity >( origin, scale, func );
+	mPlotRegistry.add( *functionEntity );
 	mFunctions.push_back( FunctionData{ std::move( functionEntity ), startX, endX, nbPoints } );
 
 	return mFunctions.back( ).entity.get( );
@@ -238,11 +327,47 @@ DataPlotEntity* GraphicsEntity::addDataPlot( const std::vector< sf::Vector2f >&
 	sf::Vector2f scale  = getScale( );
 
 	auto dataPlotEntity = std::make_unique< DataPlotEntity >( origin, scale, dataPoints );
+	mPlotRegistry.add( *dataPlotEntity );
 	mDataPlots.push_back( DataPlotData{ std::move( dataPlotEntity ) } );
 
 	return mDataPlots.back( ).entity.get( );
 }
 
+DataPlotEntity* GraphicsEntity::addDataPlot( std::span< const double > xs, std::span< const double > ys )
+{
+	return addDataPlot( StridedView::fromSpan( xs ), StridedView::fromSpan( ys ) );
+}
+
+DataPlotEntity* GraphicsEntity::addDataPlot( StridedView xs, StridedView ys )
+{
+	return addDataPlot( std::make_unique< StridedDataSource >( xs, ys ) );
+}
+
+DataPlotEntity* GraphicsEntity::addDataPlot( std::unique_ptr< DataSource > source )
+{
+	sf::Vector2f origin = getOrigin( );
+	sf::Vector2f scale  = getScale( );
+
+	auto dataPlotEntity = std::make_unique< DataPlotEntity >( origin, scale, std::move( source ) );
+	mPlotRegistry.add( *dataPlotEntity );
+	mDataPlots.push_back( DataPlotData{ std::move( dataPlotEntity ) } );
+
+	return mDataPlots.back( ).entity.get( );
+}
+
+DataPlotEntity* GraphicsEntity::addStreamingPlot( size_t capacity, double slidingWindow )
+{
+	if (slidingWindow < 0.0)
+	{
+		throw std::invalid_argument( "GraphicsEntity::addStreamingPlot( ): slidingWindow must be >= 0." );
+	}
+
+	DataPlotEntity* plot = addDataPlot( std::make_unique< RingBufferDataSource >( capacity ) );
+	plot->setSlidingWindow( slidingWindow );
+
+	return plot;
+}
+
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 -> Public methods (Legend): accessors and mutators.
@@ -251,7 +376,7 @@ DataPlotEntity* GraphicsEntity::addDataPlot( const std::vector< sf::Vector2f >&
 
 LegendEntity* GraphicsEntity::addLegend( const sf::Vector2f& position, bool hasFrame )
 {
-	sf::Vector2f windowSize = static_cast< sf::Vector2f >( mWindow.getSize( ) );
+	sf::Vector2f windowSize = static_cast< sf::Vector2f >( getWindowSize( ) );
 	sf::Vector2f pixelPos( position.x * windowSize.x, position.y * windowSize.y );
 
 	mLegend = std::make_unique< LegendEntity >( mAssets.getFont( "Courier" ), pixelPos, hasFrame );
@@ -281,7 +406,7 @@ TitleEntity* GraphicsEntity::initText( const T& text, sf::Vector2f position )
 	auto textEntity = std::make_unique< TitleEntity >( mAssets.getFont( "Courier" ), text, true );
 
 	auto positionComponent = textEntity->template requireComponent< wEngine::PositionComponent >( "GraphicsEntity::addText( )" );
-	sf::Vector2f windowSize = static_cast< sf::Vector2f >( mWindow.getSize( ) );
+	sf::Vector2f windowSize = static_cast< sf::Vector2f >( getWindowSize( ) );
 	sf::Vector2f pixelPos( position.x * windowSize.x, position.y * windowSize.y );
 	positionComponent->setPosition( pixelPos );
 
@@ -303,6 +428,7 @@ LineEntity* GraphicsEntity::addLine( const sf::Vector2f& start, const sf::Vector
 
 	auto lineEntity = std::make_unique< LineEntity >( origin, scale, start, end, withArrow );
 
+	mPlotRegistry.add( *lineEntity );
 	mLines.push_back( LineData{ std::move( lineEntity ) } );
 
 	return mLines.back( ).entity.get( );
@@ -316,18 +442,163 @@ LineEntity* GraphicsEntity::addLine( const sf::Vector2f& start, const sf::Vector
 
 void GraphicsEntity::saveToFile( const std::string& filename )
 {
-	render( );
+	writeImage( captureImage( ), wEngine::PathUtils::getExecutableDir( ) + filename, mPngOptions );
+}
 
-	sf::Texture texture( sf::Vector2u( mWindow.getSize( ).x, mWindow.getSize( ).y ) );
-	texture.update( mWindow );
+void GraphicsEntity::show( unsigned int frameRateLimit )
+{
+	if (mRenderMode == RenderMode::Headless)
+	{
+		throw std::runtime_error( "GraphicsEntity::show( ) error: the interactive viewer requires RenderMode::Windowed." );
+	}
+
+	constexpr float ZoomStep = 1.1f;
+
+	const sf::Vector2f homeOrigin = getOrigin( );
+	const sf::Vector2f homeScale = getScale( );
 
-	sf::Image screenshot = texture.copyToImage( );
-	if( !screenshot.saveToFile( wEngine::PathUtils::getExecutableDir( ) + filename ) )
+	bool dragging = false;
+	sf::Vector2i lastMouse{ 0, 0 };
+
+	// Zooms by a factor while keeping the logical point under the pixel anchor in place.
+	auto zoom = [ this ]( sf::Vector2f anchor, float factor )
+	{
+		sf::Vector2f origin = getOrigin( );
+		applyView( anchor - (anchor - origin) * factor, getScale( ) * factor );
+	};
+
+	// Full-resolution plots would be re-tessellated point by point on every pan or zoom frame:
+	// they are decimated per pixel column (M4) while the viewer runs.
+	std::vector< std::shared_ptr< wEngine::DecimationComponent > > interactiveDecimation;
+	for (auto& data : mDataPlots)
+	{
+		auto decimationComponent = data.entity->requireComponent< wEngine::DecimationComponent >( "GraphicsEntity::show( )" );
+		if (decimationComponent->getMode( ) == wEngine::DecimationComponent::DecimationMode::None)
+		{
+			decimationComponent->setMode( wEngine::DecimationComponent::DecimationMode::M4 );
+			interactiveDecimation.push_back( decimationComponent );
+		}
+	}
+
+	mWindow.setFramerateLimit( frameRateLimit );
+	mInteractive = true;
+
+	while (mWindow.isOpen( ))
+	{
+		while (const std::optional event = mWindow.pollEvent( ))
+		{
+			if (event->is< sf::Event::Closed >( ))
+			{
+				mWindow.close( );
+			}
+			else if (const auto* key = event->getIf< sf::Event::KeyPressed >( ))
+			{
+				sf::Vector2f center = static_cast< sf::Vector2f >( getWindowSize( ) ) / 2.0f;
+
+				if (key->code == sf::Keyboard::Key::Escape || key->code == sf::Keyboard::Key::Q)
+				{
+					mWindow.close( );
+				}
+				else if (key->code == sf::Keyboard::Key::R)
+				{
+					applyView( homeOrigin, homeScale );
+				}
+				else if (key->code == sf::Keyboard::Key::Add || key->code == sf::Keyboard::Key::Equal)
+				{
+					zoom( center, ZoomStep );
+				}
+				else if (key->code == sf::Keyboard::Key::Subtract || key->code == sf::Keyboard::Key::Hyphen)
+				{
+					zoom( center, 1.0f / ZoomStep );
+				}
+			}
+			else if (const auto* wheel = event->getIf< sf::Event::MouseWheelScrolled >( ))
+			{
+				if (wheel->wheel == sf::Mouse::Wheel::Vertical)
+				{
+					zoom( static_cast< sf::Vector2f >( wheel->position ), std::pow( ZoomStep, wheel->delta ) );
+				}
+			}
+			else if (const auto* pressed = event->getIf< sf::Event::MouseButtonPressed >( ))
+			{
+				if (pressed->button == sf::Mouse::Button::Left)
+				{
+					dragging = true;
+					lastMouse = pressed->position;
+				}
+			}
+			else if (const auto* released = event->getIf< sf::Event::MouseButtonReleased >( ))
+			{
+				if (released->button == sf::Mouse::Button::Left)
+				{
+					dragging = false;
+				}
+			}
+			else if (const auto* moved = event->getIf< sf::Event::MouseMoved >( ))
+			{
+				if (dragging)
+				{
+					sf::Vector2f delta = static_cast< sf::Vector2f >( moved->position - lastMouse );
+					lastMouse = moved->position;
+					applyView( getOrigin( ) + delta, getScale( ) );
+				}
+			}
+			else if (const auto* resized = event->getIf< sf::Event::Resized >( ))
+			{
+				sf::Vector2f size = static_cast< sf::Vector2f >( resized->size );
+				mWindow.setView( sf::View( sf::FloatRect( { 0.0f, 0.0f }, size ) ) );
+			}
+		}
+
+		if (!mWindow.isOpen( ))
+		{
+			break;
+		}
+
+		// Entities whose view did not change replay their cached geometry.
+		auto& colorComponent = component< wEngine::ColorComponent >( "GraphicsEntity::show( )" );
+		mWindow.clear( colorComponent.getColor( ) );
+		render( );
+		mWindow.display( );
+	}
+
+	mInteractive = false;
+
+	for (auto& decimationComponent : interactiveDecimation)
 	{
-		throw std::runtime_error( "Failed to save window screenshot to " + filename );
+		decimationComponent->setMode( wEngine::DecimationComponent::DecimationMode::None );
 	}
 }
 
+std::future< void > GraphicsEntity::saveToFileAsync( const std::string& filename )
+{
+	// Shared by every GraphicsEntity; drained (not dropped) at program exit.
+	static wEngine::ThreadPool encoderPool;
+
+	sf::Image screenshot = captureImage( );
+	std::string path = wEngine::PathUtils::getExecutableDir( ) + filename;
+	wEngine::PngOptions options = mPngOptions;
+
+	return encoderPool.submit( [ screenshot = std::move( screenshot ), path, options ]( )
+	{
+		writeImage( screenshot, path, options );
+	} );
+}
+
+void GraphicsEntity::setPngOptions( const wEngine::PngOptions& options )
+{
+	if (options.compressionLevel < 0 || options.compressionLevel > 9)
+	{
+		throw std::invalid_argument( "GraphicsEntity::setPngOptions( ): compression level must be in [0, 9]." );
+	}
+	mPngOptions = options;
+}
+
+wEngine::PngOptions GraphicsEntity::getPngOptions( ) const
+{
+	return mPngOptions;
+}
+
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 -> Private methods.
@@ -336,58 +607,161 @@ void GraphicsEntity::saveToFile( const std::string& filename )
 
 void GraphicsEntity::render( )
 {
+	sf::RenderTarget& target = getRenderTarget( );
+
+	// In the interactive viewer, only what the window shows is sampled and read.
+	sf::Vector2< double > visible = mInteractive ? getVisibleRangeX( ) : sf::Vector2< double >( 0.0, 0.0 );
+
 	for (auto& f : mFunctions)
 	{
-		f.entity->drawFunction( mWindow, f.startX, f.endX, f.nbPoints );
+		double startX = f.startX;
+		double endX = f.endX;
+
+		// Rotated curves do not map x to a screen column: they keep their full domain.
+		if (mInteractive && !(std::fabs( f.entity->getRotation( ) ) > 0.0f))
+		{
+			double offsetX = static_cast< double >( f.entity->getOffset( ).x );
+			double margin = 0.01 * (visible.y - visible.x);
+			startX = std::max( startX, visible.x - offsetX - margin );
+			endX = std::min( endX, visible.y - offsetX + margin );
+
+			if (startX >= endX)
+			{
+				continue;
+			}
+		}
+
+		f.entity->drawFunction( target, startX, endX, f.nbPoints );
 	}
 
 	for (auto& data : mDataPlots)
 	{
-		data.entity->drawDataPlot( mWindow );
+		// Only the part of the data inside the X axis range (and the window, in the viewer) is read and drawn.
+		sf::Vector2< double > range = visible;
+		bool hasRange = mInteractive;
+
+		if (mAxisX)
+		{
+			sf::Vector2f axisRange = mAxisX->getAxisRange( );
+			double offsetX = static_cast< double >( getOffset( ).x );
+			sf::Vector2< double > axisVisible( static_cast< double >( axisRange.x ) + offsetX, static_cast< double >( axisRange.y ) + offsetX );
+
+			range = hasRange
+				? sf::Vector2< double >( std::max( range.x, axisVisible.x ), std::min( range.y, axisVisible.y ) )
+				: axisVisible;
+			hasRange = true;
+		}
+
+		if (hasRange)
+		{
+			data.entity->setVisibleRange( range );
+		}
+
+		data.entity->drawDataPlot( target );
 	}
 
 	for (auto& line : mLines)
 	{
-		line.entity->render( mWindow );
+		line.entity->render( target );
 	}
 
 	if (mAxisX)
 	{
-		mAxisX->render( mWindow );
+		mAxisX->render( target );
 	}
 
 	if (mAxisY)
 	{
-		mAxisY->render( mWindow );
+		mAxisY->render( target );
 	}
 
 	if (mTitle)
 	{
+		// The frame shift is a translation of this draw only: the title components (and dirty flag) are left untouched.
+		sf::RenderStates titleStates;
 		if (mTitle->isFrameEnabled( ))
 		{
-			auto positionComponent = mTitle->requireComponent< wEngine::PositionComponent >( "GraphicsEntity::addTitle( )" );
-			sf::Vector2f basePosition = positionComponent->getPosition( );
-			(mAlignment == TitleAlignment::Bottom
-				? basePosition.y -= mTitle->getFrameThickness( )
-				: basePosition.y += mTitle->getFrameThickness( ));
-
-			positionComponent->setPosition( basePosition );
+			float shift = mAlignment == TitleAlignment::Bottom ? -mTitle->getFrameThickness( ) : mTitle->getFrameThickness( );
+			titleStates.transform.translate( { 0.0f, shift } );
 		}
 
-		mTitle->render( mWindow );
+		mTitle->render( target, titleStates );
 	}
 
 	if (mLegend)
 	{
-		mLegend->render( mWindow );
+		mLegend->render( target );
 	}
 
 	for (auto& text : mTexts)
 	{
-		text.entity->render( mWindow );
+		text.entity->render( target );
 	}
 }
 
+sf::Image GraphicsEntity::captureImage( )
+{
+	render( );
+
+	if (mRenderMode == RenderMode::Headless)
+	{
+		// Offscreen: the texture already holds the pixels, read them back directly.
+		mRenderTexture.display( );
+		return mRenderTexture.getTexture( ).copyToImage( );
+	}
+
+	sf::Texture texture( sf::Vector2u( mWindow.getSize( ).x, mWindow.getSize( ).y ) );
+	texture.update( mWindow );
+	return texture.copyToImage( );
+}
+
+void GraphicsEntity::writeImage( const sf::Image& image, const std::string& path, const wEngine::PngOptions& options )
+{
+	std::string extension = std::filesystem::path( path ).extension( ).string( );
+	std::transform( extension.begin( ), extension.end( ), extension.begin( ), [ ]( unsigned char c ) { return static_cast< char >( std::tolower( c ) ); } );
+
+	if (extension == ".png")
+	{
+		try
+		{
+			wEngine::PngEncoder::saveToFile( path, image.getPixelsPtr( ), image.getSize( ).x, image.getSize( ).y, options );
+		}
+		catch (const std::exception& e)
+		{
+			throw std::runtime_error( "Failed to save window screenshot to " + path + ": " + e.what( ) );
+		}
+		return;
+	}
+
+	if (!image.saveToFile( path ))
+	{
+		throw std::runtime_error( "Failed to save window screenshot to " + path );
+	}
+}
+
+void GraphicsEntity::applyView( sf::Vector2f origin, sf::Vector2f scale )
+{
+	auto positionComponent = requireComponent< wEngine::PositionComponent >( "GraphicsEntity::applyView( )" );
+	auto scaleComponent = requireComponent< wEngine::ScaleComponent >( "GraphicsEntity::applyView( )" );
+
+	positionComponent->setPosition( origin );
+	scaleComponent->setScale( scale );
+
+	TransformSystem( origin, scale ).update( mPlotRegistry );
+}
+
+sf::Vector2< double > GraphicsEntity::getVisibleRangeX( ) const
+{
+	double originX = static_cast< double >( getOrigin( ).x );
+	double scaleX = static_cast< double >( getScale( ).x );
+	double width = static_cast< double >( getWindowSize( ).x );
+
+	double left = (0.0 - originX) / scaleX;
+	double right = (width - originX) / scaleX;
+
+	return sf::Vector2< double >( std::min( left, right ), std::max( left, right ) );
+}
+
 void GraphicsEntity::validateNormalizedFactor( const sf::Vector2f& factor ) const
 {
 	if (factor.x < 0.0f || factor.x > 1.0f || factor.y < 0.0f || factor.y > 1.0f)
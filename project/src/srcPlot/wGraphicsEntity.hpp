@@ -9,14 +9,17 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #define W_GRAPHICS_ENTITY_HPP
 
 #include "../srcEntity/wEntity.hpp"
+#include "../srcEntity/wRegistry.hpp"
 
 #include "../srcUtils/wAssetManager.hpp"
 #include "../srcUtils/wPathUtils.hpp"
+#include "../srcUtils/wPngEncoder.hpp"
 
 #include "wAxisEntity.hpp"
 #include "wTitleEntity.hpp"
 #include "wFunctionEntity.hpp"
 #include "wDataPlotEntity.hpp"
+#include "wMappedDataSource.hpp"
 #include "wLegendEntity.hpp"
 #include "wLineEntity.hpp"
 
@@ -26,6 +29,8 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #include <SFML/Graphics.hpp>
 #pragma GCC diagnostic pop
 
+#include <future>
+
 namespace wPlot2D
 {
 
@@ -39,6 +44,20 @@ namespace wPlot2D
 		Bottom
 	};
 
+	/**
+	 * @enum RenderMode
+	 * @brief Selects the render target backing a GraphicsEntity.
+	 *
+	 * - `Windowed`: rendering goes to an `sf::RenderWindow` (requires a display).
+	 * - `Headless`: rendering goes to an offscreen `sf::RenderTexture`; no window is ever
+	 *   opened, which makes the entity usable on display-less machines (CI, cron, batch jobs).
+	 */
+	enum class RenderMode
+	{
+		Windowed,
+		Headless
+	};
+
 	/**
 	 * @class GraphicsEntity
 	 * @brief Central entity responsible for graphical rendering in wPlot2D.
@@ -54,6 +73,11 @@ namespace wPlot2D
 	 * It also handles window configuration (title, size, background color) and
 	 * allows exporting the final rendering to an image file.
 	 *
+	 * In `RenderMode::Headless`, the scene is rendered into an offscreen `sf::RenderTexture`
+	 * instead of a window and `saveToFile( )` reads the pixels straight from that texture.
+	 *
+	 * In `RenderMode::Windowed`, `show( )` opens an interactive viewer (mouse pan and zoom).
+	 *
 	 * @note This class is intended to be the main entry point for user interaction
 	 * with the rendering system.
 	 *
@@ -72,13 +96,16 @@ namespace wPlot2D
 			 *						(default: ( 0.5f, 0.5f ).
 			 * @param scaleFactor	Normalized factor specifying the size of one logical unit
 			 *						relative to window dimensions (default: ( 0.1f, 0.1f )).
+			 * @param renderMode	Windowed (default) or Headless offscreen rendering.
 			 * @throws std::invalid_argument if originFactor not in [0,1].
+			 * @throws std::runtime_error if the offscreen render texture cannot be created (Headless).
 			 */
 			GraphicsEntity(
 				const std::string& windowTitle  = "wPlot2D",
 				const sf::Vector2u& windowSize = { 1600, 1600 },
 				const sf::Vector2f& originFactor = { 0.5f, 0.5f },
-				const sf::Vector2f& scaleFactor  = { 0.1f, 0.1f } );
+				const sf::Vector2f& scaleFactor  = { 0.1f, 0.1f },
+				RenderMode renderMode = RenderMode::Windowed );
 
 			/**
 			 * @brief Virtual destructor.
@@ -88,9 +115,22 @@ namespace wPlot2D
 			/** 
 			 * @brief Gives access to the internal SFML window.
 			 * @return Reference to the internal `sf::RenderWindow`.
+			 * @note In `RenderMode::Headless` the window is never created; use getRenderTarget( ) instead.
 			 */
 			[[nodiscard]] sf::RenderWindow& getWindow( );
 
+			/**
+			 * @brief Gives access to the target the scene is rendered into.
+			 * @return The window (Windowed) or the offscreen render texture (Headless).
+			 */
+			[[nodiscard]] sf::RenderTarget& getRenderTarget( );
+
+			/**
+			 * @brief Returns the rendering mode selected at construction.
+			 * @return RenderMode::Windowed or RenderMode::Headless.
+			 */
+			[[nodiscard]] RenderMode getRenderMode( ) const;
+
 			/**
 			 * @brief Retrieves the current window size.
 			 * @return Window size in pixels.
@@ -100,17 +140,22 @@ namespace wPlot2D
 			/**
 			 * @brief Sets a new window size.
 			 * @param newSize Window dimensions in pixels.
+			 * @throws std::runtime_error if the offscreen render texture cannot be resized (Headless).
 			 */
 			void setWindowSize( const sf::Vector2u& newSize );
 
 			/**
 			 * @brief Updates the window title.
 			 * @param title New window title.
+			 * @note Has no effect in `RenderMode::Headless`.
 			 */
 			void setWindowTitle( const std::string& title );
 
 			/**
 			 * @brief Clears the window with a background color.
+			 *
+			 * The color is kept and used to clear every frame of the interactive viewer (see show( )).
+			 *
 			 * @param color Background fill color.
 			 */
 			void setBackgroundColor( const sf::Color& color );
@@ -139,6 +184,9 @@ namespace wPlot2D
 
 			/**
 			 * @brief Sets a new logical origin (normalized).
+			 *
+			 * Axes, functions, data plots and lines already added follow the new origin (see TransformSystem).
+			 *
 			 * @param originFactor in [0,1]×[0,1] new relative origin.
 			 * @throws std::invalid_argument if originFactor is outside [0,1].
 			 */
@@ -153,6 +201,9 @@ namespace wPlot2D
 
 			/**
 			 * @brief Sets new scale factors (normalized).
+			 *
+			 * Axes, functions, data plots and lines already added follow the new scale (see TransformSystem).
+			 *
 			 * @param scaleFactor new scaling factor
 			 */
 			void setScale( sf::Vector2f scaleFactor );
@@ -205,6 +256,41 @@ namespace wPlot2D
 			[[nodiscard]] FunctionEntity* addFunction( std::function< double( double )> func, 
 				double startX, double endX, size_t nbPoints = 1000 );
 
+			/**
+			 * @brief Adds a mathematical function sampled adaptively.
+			 *
+			 * The domain is split into @p initialPoints evenly spaced samples, then each interval is
+			 * refined recursively where the curve bends on screen (see FunctionEntity::setAdaptiveSampling( )).
+			 *
+			 * @param func Function of type double(double).
+			 * @param startX Domain start (logical).
+			 * @param endX Domain end (logical).
+			 * @param maxDepth Maximum number of bisections per coarse interval (<= 30).
+			 * @param tolerance Maximum screen-space error in pixels (> 0).
+			 * @param initialPoints Size of the initial coarse grid (default 33).
+			 * @return Pointer to the created FunctionEntity.
+			 * @throw std::invalid_argument if maxDepth > 30 or tolerance <= 0.
+			 */
+			[[nodiscard]] FunctionEntity* addFunction( std::function< double( double )> func,
+				double startX, double endX, unsigned int maxDepth, float tolerance, size_t initialPoints = 33 );
+
+			/**
+			 * @brief Adds a mathematical function given as a batch callable.
+			 *
+			 * The callable fills a whole span of ordinates per call, e.g.
+			 * `[]( std::span< const double > xs, std::span< double > ys ) { ... }`,
+			 * which amortizes the call overhead and allows SIMD or Eigen-backed kernels.
+			 * The grid is split around excluded intervals, so the callable never sees an excluded x.
+			 *
+			 * @param func Batch function filling ys[i] = f(xs[i]).
+			 * @param startX Domain start (logical).
+			 * @param endX Domain end (logical).
+			 * @param nbPoints Sampling resolution (default 1000).
+			 * @return Pointer to the created FunctionEntity.
+			 */
+			[[nodiscard]] FunctionEntity* addFunction( wEngine::FunctionComponent::BatchFunction func,
+				double startX, double endX, size_t nbPoints = 1000 );
+
 			/**
 			 * @brief Adds a raw data plot (connected points).
 			 * @param dataPoints Vector of (x,y) coordinates.
@@ -212,6 +298,58 @@ namespace wPlot2D
 			 */
 			[[nodiscard]] DataPlotEntity* addDataPlot( const std::vector< sf::Vector2f >& dataPoints );
 
+			/**
+			 * @brief Adds a raw data plot viewing two caller-owned columns, without copying them.
+			 *
+			 * The points are read in place, in double precision. The columns must outlive this
+			 * GraphicsEntity and must not be reallocated; if their values change, call markDirty( )
+			 * on the returned entity.
+			 *
+			 * @param xs Abscissas.
+			 * @param ys Ordinates (same size as xs).
+			 * @return Pointer to the created DataPlotEntity.
+			 * @throw std::invalid_argument if xs and ys differ in size.
+			 */
+			[[nodiscard]] DataPlotEntity* addDataPlot( std::span< const double > xs, std::span< const double > ys );
+
+			/**
+			 * @brief Adds a raw data plot viewing caller-owned strided data (e.g. interleaved records), without copying it.
+			 *
+			 * Same lifetime contract as the span overload.
+			 *
+			 * @param xs View over the abscissas (see StridedView::fromMember( )).
+			 * @param ys View over the ordinates (same count as xs).
+			 * @return Pointer to the created DataPlotEntity.
+			 * @throw std::invalid_argument if xs and ys differ in count.
+			 */
+			[[nodiscard]] DataPlotEntity* addDataPlot( StridedView xs, StridedView ys );
+
+			/**
+			 * @brief Adds a raw data plot reading its points from any DataSource.
+			 *
+			 * Typically used with file-backed sources, e.g.
+			 * `addDataPlot( std::make_unique< MappedColumnDataSource >( "log.bin" ) )`.
+			 * When an X axis exists, the plot is restricted to its range (see DataPlotEntity::setVisibleRange( )).
+			 *
+			 * @param source Point source (must not be null).
+			 * @return Pointer to the created DataPlotEntity.
+			 * @throw std::invalid_argument if source is null.
+			 */
+			[[nodiscard]] DataPlotEntity* addDataPlot( std::unique_ptr< DataSource > source );
+
+			/**
+			 * @brief Adds a live data plot backed by a fixed-capacity ring buffer.
+			 *
+			 * Points are pushed with DataPlotEntity::appendPoints( ); each frame only tessellates
+			 * the segments added since the previous one.
+			 *
+			 * @param capacity		Maximum number of points held (> 0).
+			 * @param slidingWindow	Width of the scrolling x-window in logical units (0 disables it).
+			 * @return Pointer to the created DataPlotEntity.
+			 * @throw std::invalid_argument if capacity is 0 or slidingWindow < 0.
+			 */
+			[[nodiscard]] DataPlotEntity* addStreamingPlot( size_t capacity, double slidingWindow = 0.0 );
+
 			/**
 			 * @brief Adds a legend box at a given position.
 			 * @param position Normalized position inside window [0,1]x[0,1].
@@ -246,13 +384,67 @@ namespace wPlot2D
 			[[nodiscard]] LineEntity* addLine( const sf::Vector2f& start, const sf::Vector2f& end, bool withArrow = false );
 
 			/**
-			 * @brief Saves a screenshot of the current window.
+			 * @brief Saves a screenshot of the current window (or offscreen texture in Headless mode).
+			 *
+			 * PNG files are written by wEngine::PngEncoder with the options of setPngOptions( ).
+			 *
 			 * @param filename Output file path (supported: png, bmp, tga, jpg).
 			 * @throws std::runtime_error if saving fails.
 			 */
 			void saveToFile( const std::string& filename );
+
+			/**
+			 * @brief Runs an interactive viewer in the window until it is closed.
+			 *
+			 * Controls:
+			 * - Left mouse drag: pan.
+			 * - Mouse wheel, `+` / `-`: zoom (around the cursor for the wheel, around the window center for the keys).
+			 * - `R`: back to the origin and scale the viewer started with.
+			 * - `Escape` / `Q`: close the window.
+			 *
+			 * Panning and zooming update the origin and scale (Position and Scale components) of the
+			 * axes, functions, data plots and lines through TransformSystem. While the viewer runs,
+			 * functions are only sampled over the visible part of their domain, data plots only read
+			 * the visible x-range when their points are sorted by x (see DataPlotEntity::setVisibleRange( )),
+			 * and data plots without decimation are drawn with M4 decimation (restored on return);
+			 * unchanged entities replay their cached geometry.
+			 *
+			 * @param frameRateLimit Maximum number of frames per second (0 for no limit).
+			 * @throws std::runtime_error in `RenderMode::Headless`.
+			 * @note The window is closed when the function returns.
+			 */
+			void show( unsigned int frameRateLimit = 60 );
+
+			/**
+			 * @brief Renders and captures the scene now, then encodes and writes it in the background.
+			 *
+			 * Only rendering and the pixel read-back happen on the calling thread: the caller can
+			 * build the next figure while the previous one is being compressed. The returned future
+			 * becomes ready once the file is written, and rethrows the error if writing failed.
+			 *
+			 * @param filename Output file path (supported: png, bmp, tga, jpg).
+			 * @return Future completed when the file is written.
+			 */
+			[[nodiscard]] std::future< void > saveToFileAsync( const std::string& filename );
+
+			/**
+			 * @brief Sets the PNG compression level and row filter used by saveToFile( ) and saveToFileAsync( ).
+			 * @param options Compression level in [0, 9] and filter strategy.
+			 * @throws std::invalid_argument if the compression level is outside [0, 9].
+			 */
+			void setPngOptions( const wEngine::PngOptions& options );
+
+			/**
+			 * @brief Returns the PNG encoding options.
+			 * @return Current compression level and filter strategy.
+			 */
+			[[nodiscard]] wEngine::PngOptions getPngOptions( ) const;
 		private:
+			RenderMode mRenderMode;
+			bool mInteractive;
+			wEngine::PngOptions mPngOptions;
 			sf::RenderWindow mWindow;
+			sf::RenderTexture mRenderTexture;
 			wEngine::AssetManager mAssets;
 			std::unique_ptr< AxisEntity > mAxisX;
 			std::unique_ptr< AxisEntity > mAxisY;
@@ -294,6 +486,20 @@ namespace wPlot2D
 			};
 			std::vector< LineData > mLines;
 
+			// Plot-space entities (axes, functions, data plots, lines), processed by TransformSystem
+			wEngine::Registry mPlotRegistry;
+
+			/**
+			 * @brief Internal: renders the scene and reads its pixels back.
+			 * @return Captured image.
+			 */
+			[[nodiscard]] sf::Image captureImage( );
+
+			/**
+			 * @brief Internal: encodes and writes a captured image (PNG through PngEncoder, other formats through SFML).
+			 */
+			static void writeImage( const sf::Image& image, const std::string& path, const wEngine::PngOptions& options );
+
 			/**
 			 * @brief Renders all visual elements managed by the `GraphicsEntity`.
 			 *
@@ -304,14 +510,27 @@ namespace wPlot2D
 			 * - the legend (if present),
 			 * - any additional text entities.
 			 *
-			 * It uses SFML’s rendering system and is called internally before exporting
+			 * It draws into getRenderTarget( ) and is called internally before exporting
 			 * the scene with `saveToFile( )`.
 			 *
-			 * @note The `GraphicsEntity` does not maintain its own event/rendering loop. This
-			 * method must be invoked explicitly each time a redraw is required.
+			 * @note Outside of show( ), the `GraphicsEntity` does not run its own event/rendering
+			 * loop. This method must be invoked explicitly each time a redraw is required.
 			 */
 			void render( );
 
+			/**
+			 * @brief Internal: moves and scales the plot (pixels) and propagates it through TransformSystem.
+			 * @param origin	New origin in pixels.
+			 * @param scale		New scale in pixels per logical unit.
+			 */
+			void applyView( sf::Vector2f origin, sf::Vector2f scale );
+
+			/**
+			 * @brief Internal: logical x-range covered by the render target at the current origin and scale.
+			 * @return [left, right] in logical units (offset not applied).
+			 */
+			[[nodiscard]] sf::Vector2< double > getVisibleRangeX( ) const;
+
 			/**
 			 * @brief Validates that a normalized factor lies in the [0,1] interval.
 			 *
@@ -28,14 +28,15 @@ LabelEntity::LabelEntity( const sf::Font& font, AxisType type, sf::Vector2f init
 	mOffset{ sf::Vector2f( 0.0f, 0.0f ) },
 	mCustomLabels{ "" },
 	mUseCustomLabels{ false },
-	mLabel{ font }
+	mFormatter{ nullptr },
+	mText{ },
+	mTextPosition{ initialPosition },
+	mTextSize{ 0.0f, 0.0f }
 {
 	addComponent< wEngine::PositionComponent >( initialPosition );
 	addComponent< wEngine::OffsetComponent >( );
 	addComponent< wEngine::ColorComponent >( sf::Color::Black );
 	addComponent< wEngine::FontComponent >( font );
-
-	mLabel.setCharacterSize( getCharacterSize( ) );
 }
 
 /*
@@ -59,14 +60,27 @@ int LabelEntity::getDecimalPlaces( ) const
 	return mDecimalPlaces;
 }
 
+sf::Vector2f LabelEntity::getTextSize( )
+{
+	if (isDirty( ))
+	{
+		layout( );
+		clearDirty( );
+	}
+
+	return mTextSize;
+}
+
 void LabelEntity::setCharacterSize( unsigned int newSize )
 {
 	mCharacterSize = newSize;
+	markDirty( );
 }
 
 void LabelEntity::setLabelText( std::string text )
 {
-	mLabel.setString( text );
+	mText = text;
+	markDirty( );
 }
 
 void LabelEntity::setFont( const sf::Font& font )
@@ -78,12 +92,20 @@ void LabelEntity::setFont( const sf::Font& font )
 void LabelEntity::setDecimalPlaces( int places )
 {
 	mDecimalPlaces = std::max( 0, places );
+	markDirty( );
+}
+
+void LabelEntity::setFormatter( wEngine::NumberFormatter* formatter )
+{
+	mFormatter = formatter;
+	markDirty( );
 }
 
 void LabelEntity::setCustomLabels( const std::string& labels )
 {
 	mCustomLabels = labels;
 	mUseCustomLabels = true;
+	markDirty( );
 }
 
 /*
@@ -107,43 +129,83 @@ std::string LabelEntity::formatLabel( float value )
 	}
 	else
 	{
-		std::ostringstream oss;
-		oss << std::fixed << std::setprecision( mDecimalPlaces ) << value;
-		return oss.str( );
+		wEngine::NumberFormatter::Buffer buffer;
+		return std::string( formatNumber( value, buffer ) );
 	}
 }
 
-void LabelEntity::render( sf::RenderWindow& window )
+void LabelEntity::appendTo( wEngine::TextBatcher& batcher )
+{
+	// Text formatting and layout are only redone after a change; otherwise the glyphs are replayed as is.
+	if (isDirty( ))
+	{
+		layout( );
+		clearDirty( );
+	}
+
+	auto& colorComponent = component< wEngine::ColorComponent >( "LabelEntity::appendTo( )" );
+	auto& fontComponent = component< wEngine::FontComponent >( "LabelEntity::appendTo( )" );
+
+	batcher.append( fontComponent.getFont( ), getCharacterSize( ), mText, mTextPosition, colorComponent.getColor( ) );
+}
+
+void LabelEntity::render( sf::RenderTarget& window )
+{
+	wEngine::TextBatcher batcher;
+	appendTo( batcher );
+	batcher.draw( window );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void LabelEntity::layout( )
 {
-	auto positionComponent = requireComponent< wEngine::PositionComponent >( "LabelEntity::render( )" );
-	auto offsetComponent = requireComponent< wEngine::OffsetComponent >( "LabelEntity::render( )" );
-	auto colorComponent = requireComponent< wEngine::ColorComponent >( "LabelEntity::render( )" );
-	auto fontComponent = requireComponent< wEngine::FontComponent >( "LabelEntity::render( )" );
+	auto& positionComponent = component< wEngine::PositionComponent >( "LabelEntity::layout( )" );
+	auto& offsetComponent = component< wEngine::OffsetComponent >( "LabelEntity::layout( )" );
+	auto& fontComponent = component< wEngine::FontComponent >( "LabelEntity::layout( )" );
 
-	sf::Vector2f position = positionComponent->getPosition( );
-	sf::Color color = colorComponent->getColor( );
+	sf::Vector2f position = positionComponent.getPosition( );
+	sf::Vector2f offset = offsetComponent.getOffset( );
 
-	mLabel.setFont( fontComponent->getFont( ) );
-	mLabel.setCharacterSize( getCharacterSize( ) );
-	mLabel.setFillColor( color );
+	if (mUseCustomLabels)
+	{
+		mText = mCustomLabels;
+	}
+	else
+	{
+		wEngine::NumberFormatter::Buffer buffer;
+		std::string_view digits = formatNumber( mValue, buffer );
+		mText = sf::String::fromUtf8( digits.begin( ), digits.end( ) );
+	}
+	sf::Vector2f size = wEngine::TextBatcher::measure( fontComponent.getFont( ), getCharacterSize( ), mText ).size;
+	mTextSize = size;
 
-	setLabelText( formatLabel( mValue ) );
-	
 	if (mAlignment == AxisType::X_AXIS)
 	{
-		offsetComponent->addOffset( { 0.0f, 5.0f } );
-		sf::Vector2f offset = offsetComponent->getOffset( );
-		sf::Vector2f center = sf::Vector2f( - mLabel.getGlobalBounds( ).size.x / 2.0f, - mLabel.getGlobalBounds( ).size.y / 2.0f );
-		mLabel.setPosition( position + center + offset );
+		// Fixed gap below the notch (it used to be accumulated into the offset on every render).
+		const sf::Vector2f gap( 0.0f, 5.0f );
+		sf::Vector2f center = sf::Vector2f( - size.x / 2.0f, - size.y / 2.0f );
+		mTextPosition = position + center + offset + gap;
 	}
 	else
 	{
-		sf::Vector2f offset = offsetComponent->getOffset( );
-		sf::Vector2f center = sf::Vector2f( - mLabel.getGlobalBounds( ).size.x, - mLabel.getGlobalBounds( ).size.y );
-		mLabel.setPosition( position + center + offset );
+		sf::Vector2f center = sf::Vector2f( - size.x, - size.y );
+		mTextPosition = position + center + offset;
+	}
+}
+
+std::string_view LabelEntity::formatNumber( float value, wEngine::NumberFormatter::Buffer& buffer ) const
+{
+	if (mFormatter)
+	{
+		return mFormatter->format( value, mDecimalPlaces );
 	}
 
-	window.draw( mLabel );
+	return wEngine::NumberFormatter::format( value, mDecimalPlaces, wEngine::NumberFormatter::Notation::Fixed, buffer );
 }
 
 }// End of namespace wPlot2D
\ No newline at end of file
@@ -9,6 +9,8 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #define W_LABEL_ENTITY_HPP
 
 #include "../srcEntity/wEntity.hpp"
+#include "../srcUtils/wTextBatcher.hpp"
+#include "../srcUtils/wNumberFormatter.hpp"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wfloat-equal"
@@ -29,7 +31,8 @@ namespace wPlot2D
 	 * Labels can be generated dynamically (from numeric values, with controlled precision)
 	 * or defined manually via custom strings.
 	 *
-	 * The class relies on SFML's `sf::Text` for rendering and provides customization
+	 * The glyphs are laid out by a `wEngine::TextBatcher`, so that the owning AxisEntity can submit
+	 * all of its labels in a single draw call (see appendTo( )). The class provides customization
 	 * of style (font, color, character size) and placement (axis orientation, offset relative to the axis).
 	 *
 	 * @note Typically, a LabelEntity is aggregated inside an `AxisEntity` to display labels alongside axis notches.
@@ -74,6 +77,15 @@ namespace wPlot2D
 			 */
 			[[nodiscard]] int getDecimalPlaces( ) const;
 
+			/**
+			 * @brief Returns the size of the laid out text, in pixels.
+			 *
+			 * Lays the text out first if the label changed since the last layout.
+			 *
+			 * @return Width and height of the text bounds.
+			 */
+			[[nodiscard]] sf::Vector2f getTextSize( );
+
 			/**
 			 * @brief Sets a new font for the label.
 			 * @param font Reference to an SFML font (must remain valid during the lifetime of the entity).
@@ -102,6 +114,16 @@ namespace wPlot2D
 			 */
 			void setDecimalPlaces( int places );
 
+			/**
+			 * @brief Shares a number formatter (and its cache) with the label.
+			 *
+			 * Axes pass one formatter to all their labels. Without a formatter, values are written
+			 * in fixed notation.
+			 *
+			 * @param formatter Formatter to use (must outlive the label), or nullptr.
+			 */
+			void setFormatter( wEngine::NumberFormatter* formatter );
+
 			/**
 			 * @brief Sets a custom label string.
 			 *
@@ -122,18 +144,31 @@ namespace wPlot2D
 			 * @brief Formats a numeric value into a label string.
 			 *
 			 * If custom labels are active, the stored custom string is returned.
-			 * Otherwise, the numeric value is converted using the current number of decimal places.
+			 * Otherwise, the numeric value is converted using the current number of decimal places
+			 * and the notation of the label's formatter (see setFormatter( )).
 			 *
 			 * @param value Numeric value to format.
 			 * @return A string ready to be displayed as a label.
 			 */
 			std::string formatLabel( float value );
 
+			/**
+			 * @brief Appends the glyphs of the label to a text batch (no draw call).
+			 *
+			 * The text is formatted and aligned only when the label is dirty (see Entity::isDirty( )).
+			 *
+			 * @param batcher Destination batch, drawn later by the caller.
+			 */
+			void appendTo( wEngine::TextBatcher& batcher );
+
 			/**
 			 * @brief Renders the label on the given SFML window.
-			 * @param window Reference to the render window.
+			 *
+			 * Draws the label on its own. Axes batch their labels through appendTo( ) instead.
+			 *
+			 * @param window Reference to the render target.
 			 */
-			void render( sf::RenderWindow& window );
+			void render( sf::RenderTarget& window );
 		private:
 			AxisType mAlignment;
 			unsigned int mCharacterSize;
@@ -143,8 +178,24 @@ namespace wPlot2D
 
 			std::string mCustomLabels;
 			bool mUseCustomLabels;
+			wEngine::NumberFormatter* mFormatter;
+
+			sf::String mText;
+			sf::Vector2f mTextPosition;
+			sf::Vector2f mTextSize;
 
-			sf::Text mLabel;
+			/**
+			 * @brief Internal: formats the text and aligns it on the notch.
+			 */
+			void layout( );
+
+			/**
+			 * @brief Internal: writes a numeric value without allocating.
+			 * @param value		Value to format.
+			 * @param buffer	Scratch buffer (used when the label has no formatter).
+			 * @return View on the formatted text.
+			 */
+			std::string_view formatNumber( float value, wEngine::NumberFormatter::Buffer& buffer ) const;
 	};
 
 } // namespace wPlot2D
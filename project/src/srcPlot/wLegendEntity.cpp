@@ -117,10 +117,6 @@ void LegendEntity::setFont( const sf::Font& font )
 void LegendEntity::setCharacterSize( unsigned int size )
 {
 	mCharacterSize = size;
-	for (auto& item : mItems)
-	{
-		item.mLabelText.setCharacterSize( size );
-	}
 }
 
 void LegendEntity::setTextColor( const sf::Color& color )
@@ -138,24 +134,18 @@ void LegendEntity::setTextColor( const sf::Color& color )
 template< typename T >
 void LegendEntity::createItem( const T& label, std::unique_ptr< LineEntity > line )
 {
-	auto colorComponent = requireComponent< wEngine::ColorComponent >( "LegendEntity::addItem( )" );
-	sf::Color textColor = colorComponent->getColor( );
-
-	sf::Text text( mFont, label, mCharacterSize );
-	text.setFillColor( textColor );
-
-	mItems.emplace_back( std::move( line ), std::move( text ) );
+	mItems.emplace_back( std::move( line ), sf::String( label ) );
 }
 
-void LegendEntity::render( sf::RenderWindow& window )
+void LegendEntity::render( sf::RenderTarget& window )
 {
 	// --- Required ECS components ---
-	auto positionComponent = requireComponent< wEngine::PositionComponent >( "LegendEntity::render( )" );
-	auto colorComponent = requireComponent< wEngine::ColorComponent >( "LegendEntity::render( )" );
-	auto fontComponent = requireComponent< wEngine::FontComponent >( "LegendEntity::render( )" );
+	auto& positionComponent = component< wEngine::PositionComponent >( "LegendEntity::render( )" );
+	auto& colorComponent = component< wEngine::ColorComponent >( "LegendEntity::render( )" );
+	auto& fontComponent = component< wEngine::FontComponent >( "LegendEntity::render( )" );
 
-	sf::Vector2f position = positionComponent->getPosition( );
-	sf::Color color = colorComponent->getColor( );
+	sf::Vector2f position = positionComponent.getPosition( );
+	sf::Color color = colorComponent.getColor( );
 
 	// --- Layout parameters ---
 	float spacing = static_cast< float >( mCharacterSize ) + 10.0f;	// vertical gap between items
@@ -164,13 +154,15 @@ void LegendEntity::render( sf::RenderWindow& window )
 	float maxTextWidth = 0.0f;										// widest label text
 	float maxTextHeight = 0.0f;										// tallest label text (usually tied to font size)
 
+	const sf::Font& font = fontComponent.getFont( );
+
 	// Compute max text dimensions across all items
+	std::vector< sf::FloatRect > textBounds;
+	textBounds.reserve( mItems.size( ) );
 	for (auto& item : mItems)
 	{
-		item.mLabelText.setFont( fontComponent->getFont( ) );
-		item.mLabelText.setFillColor( color );
-
-		sf::FloatRect bounds = item.mLabelText.getLocalBounds( );
+		sf::FloatRect bounds = wEngine::TextBatcher::measure( font, mCharacterSize, item.mLabel );
+		textBounds.push_back( bounds );
 		maxTextWidth = std::max( maxTextWidth, bounds.size.x );
 		maxTextHeight = std::max( maxTextHeight, bounds.size.y );
 	}
@@ -187,19 +179,17 @@ void LegendEntity::render( sf::RenderWindow& window )
 	float yOffset = position.y - legendHeight / 2.0f;
 
 	// --- Place each legend item (line + text) ---
+	mTextBatch.clear( );
 	for (size_t i = 0; i < mItems.size( ); ++i)
 	{
 		auto& item = mItems[ i ];
 
 		// Vertical center of this row
-		sf::FloatRect bounds = item.mLabelText.getLocalBounds( );
+		sf::FloatRect bounds = textBounds[ i ];
 		float yBase = yOffset + static_cast< float >( i ) * spacing;
 
-		// Center origin of the text on its visual bounds
-		item.mLabelText.setOrigin( {
-			bounds.position.x + bounds.size.x / 2.0f,
-			bounds.position.y + bounds.size.y / 2.0f
-		} );
+		// Center of the text on its visual bounds
+		sf::Vector2f textOrigin( bounds.position.x + bounds.size.x / 2.0f, bounds.position.y + bounds.size.y / 2.0f );
 
 		// (1) Line: left column, vertically centered
 		sf::Vector2f linePos( lineColumnX, yBase + maxTextHeight / 2.0f );
@@ -207,7 +197,7 @@ void LegendEntity::render( sf::RenderWindow& window )
 
 		// (2) Text: right of the line, vertically aligned
 		sf::Vector2f textPos( lineColumnX + lineLength + margin + bounds.size.x / 2.0f, yBase + bounds.size.y / 2.0f );
-		item.mLabelText.setPosition( textPos );
+		mTextBatch.append( font, mCharacterSize, item.mLabel, textPos - textOrigin, color );
 	}
 
 	// --- Draw frame if enabled ---
@@ -222,12 +212,12 @@ void LegendEntity::render( sf::RenderWindow& window )
 		mFrame.render( window );
 	}
 
-	// --- Draw all items (line + label) ---
+	// --- Draw all items (lines, then every label in one draw call) ---
 	for (auto& item : mItems)
 	{
 		item.mLine->render( window );
-		window.draw( item.mLabelText );
 	}
+	mTextBatch.draw( window );
 }
 
 } // namespace wPlot2D
\ No newline at end of file
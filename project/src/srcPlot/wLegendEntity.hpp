@@ -9,6 +9,7 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #define W_LEGEND_ENTITY_HPP
 
 #include "../srcEntity/wEntity.hpp"
+#include "../srcUtils/wTextBatcher.hpp"
 #include "wLineEntity.hpp"
 #include "wFrameEntity.hpp"
 
@@ -32,7 +33,8 @@ namespace wPlot2D
 	 * A `LegendEntity` provides a visual legend for plotted entities such as
 	 * `FunctionEntity` and `DataPlotEntity`. Each legend item is composed of:
 	 * - A sample line (`LineEntity`) with the same style, thickness, and color as the source entity.
-	 * - A text label (`sf::Text`) describing the entity.
+	 * - A text label describing the entity. The labels of all items are laid out into one
+	 *   `wEngine::TextBatcher` and drawn with a single draw call.
 	 *
 	 * The legend can optionally be surrounded by a frame (`FrameEntity`) with
 	 * configurable padding, outline color, thickness, and fill color.
@@ -160,9 +162,9 @@ namespace wPlot2D
 			 * Each item is drawn with its sample line and label text, aligned inside
 			 * the legend box. The optional frame is drawn behind all items.
 			 *
-			 * @param window The target SFML render window.
+			 * @param window The target SFML render target.
 			 */
-			void render( sf::RenderWindow& window );
+			void render( sf::RenderTarget& window );
 		private:
 			/**
 			 * @struct LegendItem
@@ -170,13 +172,12 @@ namespace wPlot2D
 			 */
 			struct LegendItem
 			{
-				std::string mLabel;
 				std::unique_ptr< LineEntity > mLine;
-				sf::Text mLabelText;
+				sf::String mLabel;
 
-				LegendItem( std::unique_ptr< LineEntity > line, sf::Text&& txt )
+				LegendItem( std::unique_ptr< LineEntity > line, sf::String label )
 				:	mLine{ std::move( line ) },
-					mLabelText{ std::move( txt ) }
+					mLabel{ std::move( label ) }
 					{
 
 					}
@@ -215,6 +216,7 @@ namespace wPlot2D
 			const sf::Font& mFont;
 			unsigned int mCharacterSize = 30;
 			FrameEntity mFrame;
+			wEngine::TextBatcher mTextBatch;
 	};
 
 } // namespace wPlot2D
@@ -24,7 +24,9 @@ LineEntity::LineEntity( const sf::Vector2f& origin, const sf::Vector2f& scale, c
 :   mStart{ start },
 	mEnd{ end },
 	mWithArrow{ withArrow },
-	mArrowSize{ 4.0f }
+	mArrowSize{ 4.0f },
+	mGeometry{ sf::PrimitiveType::Triangles },
+	mGeometryClip{ }
 {
 	addComponent< wEngine::PositionComponent >( origin );
 	addComponent< wEngine::ScaleComponent >( scale );
@@ -92,6 +94,7 @@ bool LineEntity::hasArrow( ) const
 void LineEntity::setArrowSize( float arrowSize )
 {
 	mArrowSize = arrowSize;
+	markDirty( );
 }
 
 /*
@@ -100,41 +103,62 @@ void LineEntity::setArrowSize( float arrowSize )
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-void LineEntity::render( sf::RenderWindow& window )
+void LineEntity::render( sf::RenderTarget& window )
 {
-	auto positionComponent	= requireComponent< wEngine::PositionComponent >( "LineEntity::render( )" );
-	auto colorComponent		= requireComponent< wEngine::ColorComponent >( "LineEntity::render( )" );
-	auto thicknessComponent	= requireComponent< wEngine::ThicknessComponent >( "LineEntity::render( )" );
-	auto scaleComponent		= requireComponent< wEngine::ScaleComponent >( "LineEntity::render( )" );
-	auto lineStyleComponent	= requireComponent< wEngine::LineStyleComponent >( "LineEntity::render( )" );
-
-	sf::Vector2f origin	= positionComponent->getPosition( );
-	sf::Color color		= colorComponent->getColor( );
-	float thickness		= thicknessComponent->getThickness( );
-	sf::Vector2f scale	= scaleComponent->getScale( );
-
-	// Scale and origin transform
-	sf::Vector2f p1( origin.x + mStart.x * scale.x, origin.y - mStart.y * scale.y );
-	sf::Vector2f p2( origin.x + mEnd.x   * scale.x, origin.y - mEnd.y   * scale.y );
-
-	// Draw arrowhead
-	if (mWithArrow)
+	// Area shown by the target, widened by the thickness so caps at the border are kept
+	const sf::FloatRect clipRect = wEngine::LineDrawer::getClipRect( window,
+		component< wEngine::ThicknessComponent >( "LineEntity::render( )" ).getThickness( ) );
+
+	if (isDirty( ) || clipRect != mGeometryClip)
 	{
-		sf::Vector2f dir = (p2 - p1).normalized( );
-		float arrowSize = thickness * mArrowSize;
-		p2 -= dir * arrowSize;
+		auto& positionComponent		= component< wEngine::PositionComponent >( "LineEntity::render( )" );
+		auto& colorComponent		= component< wEngine::ColorComponent >( "LineEntity::render( )" );
+		auto& thicknessComponent	= component< wEngine::ThicknessComponent >( "LineEntity::render( )" );
+		auto& scaleComponent		= component< wEngine::ScaleComponent >( "LineEntity::render( )" );
+		auto& lineStyleComponent	= component< wEngine::LineStyleComponent >( "LineEntity::render( )" );
+
+		sf::Vector2f origin	= positionComponent.getPosition( );
+		sf::Color color		= colorComponent.getColor( );
+		float thickness		= thicknessComponent.getThickness( );
+		sf::Vector2f scale	= scaleComponent.getScale( );
+
+		// Scale and origin transform
+		sf::Vector2f p1( origin.x + mStart.x * scale.x, origin.y - mStart.y * scale.y );
+		sf::Vector2f p2( origin.x + mEnd.x   * scale.x, origin.y - mEnd.y   * scale.y );
+
+		// Build arrowhead
+		if (mWithArrow)
+		{
+			sf::Vector2f dir = (p2 - p1).normalized( );
+			float arrowSize = thickness * mArrowSize;
+			p2 -= dir * arrowSize;
+
+			initArrowHead( p2, dir, arrowSize, color );
+		}
+
+		// Build main line (only its visible part)
+		mGeometry.clear( );
+		wEngine::LineDrawer::appendClippedLine(
+			mGeometry, p1, p2, clipRect, color, thickness,
+			lineStyleComponent.getStyle( ),
+			lineStyleComponent.getDashLength( ),
+			lineStyleComponent.getGapLength( )
+		);
+
+		mGeometryClip = clipRect;
+		clearDirty( );
+	}
 
-		initArrowHead( p2, dir, arrowSize, color );
+	// Replay cached geometry
+	if (mWithArrow)
+	{
 		window.draw( mArrowHead );
 	}
 
-	// Draw main line
-	wEngine::LineDrawer::drawLine(
-		window, p1, p2, color, thickness,
-		lineStyleComponent->getStyle( ),
-		lineStyleComponent->getDashLength( ),
-		lineStyleComponent->getGapLength( )
-	);
+	if (mGeometry.getVertexCount( ) > 0)
+	{
+		window.draw( mGeometry );
+	}
 }
 
 /*
@@ -127,9 +127,14 @@ namespace wPlot2D
 
 			/**
 			 * @brief Renders the line (and optional arrowhead).
-			 * @param window Target render window.
+			 *
+			 * The geometry is cached and only rebuilt after a component changed (see Entity::isDirty( ))
+			 * or when the render target shows another area. The line is clipped to that area before
+			 * tessellation (see wEngine::LineDrawer::appendClippedLine( )).
+			 *
+			 * @param window Target render target.
 			 */
-			void render( sf::RenderWindow& window );
+			void render( sf::RenderTarget& window );
 
 		private:
 			sf::Vector2f mStart;
@@ -137,6 +142,8 @@ namespace wPlot2D
 			bool mWithArrow;
 			sf::ConvexShape mArrowHead;
 			float mArrowSize;
+			sf::VertexArray mGeometry;
+			sf::FloatRect mGeometryClip;
 
 			/**
 			 * @brief Initializes the arrowhead geometry at the end of the line.
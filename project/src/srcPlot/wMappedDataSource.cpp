@@ -0,0 +1,195 @@
+/**
+ * @file wMappedDataSource.cpp
+ * @brief Implementation of the MappedColumnDataSource and CsvDataSource classes.
+ */
+
+#include "wMappedDataSource.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace wPlot2D
+{
+
+namespace
+{
+	/**
+	 * @brief Reads a little-endian IEEE-754 double from unaligned memory.
+	 */
+	double readFloat64LE( const std::byte* bytes )
+	{
+		std::uint64_t bits;
+		std::memcpy( &bits, bytes, sizeof( bits ) );
+
+		if constexpr (std::endian::native == std::endian::big)
+		{
+			std::uint64_t swapped = 0;
+			for (int i = 0; i < 8; ++i)
+			{
+				swapped = (swapped << 8) | ((bits >> (8 * i)) & 0xFFu);
+			}
+			bits = swapped;
+		}
+
+		double value;
+		std::memcpy( &value, &bits, sizeof( value ) );
+		return value;
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> MappedColumnDataSource.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+MappedColumnDataSource::MappedColumnDataSource( const std::string& path, size_t columnCount, size_t xColumn, size_t yColumn,
+	ColumnLayout layout, bool sortedByX )
+:	mFile{ path },
+	mRows{ 0 },
+	mX{ nullptr },
+	mY{ nullptr },
+	mStride{ 0 }
+{
+	if (columnCount == 0 || xColumn >= columnCount || yColumn >= columnCount)
+	{
+		throw std::invalid_argument( "MappedColumnDataSource: column index out of range." );
+	}
+
+	const size_t rowSize = columnCount * sizeof( double );
+	if (mFile.size( ) % rowSize != 0)
+	{
+		throw std::invalid_argument( "MappedColumnDataSource: file size is not a multiple of the row size in " + path );
+	}
+
+	mRows = mFile.size( ) / rowSize;
+
+	if (layout == ColumnLayout::Interleaved)
+	{
+		mX = mFile.data( ) + xColumn * sizeof( double );
+		mY = mFile.data( ) + yColumn * sizeof( double );
+		mStride = rowSize;
+	}
+	else
+	{
+		mX = mFile.data( ) + xColumn * mRows * sizeof( double );
+		mY = mFile.data( ) + yColumn * mRows * sizeof( double );
+		mStride = sizeof( double );
+	}
+
+	setSortedByX( sortedByX );
+}
+
+size_t MappedColumnDataSource::size( ) const
+{
+	return mRows;
+}
+
+sf::Vector2< double > MappedColumnDataSource::pointAt( size_t index ) const
+{
+	return { readFloat64LE( mX + index * mStride ), readFloat64LE( mY + index * mStride ) };
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> CsvDataSource.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+CsvDataSource::CsvDataSource( const std::string& path, size_t xColumn, size_t yColumn, char delimiter, bool hasHeader, bool sortedByX )
+:	mFile{ path },
+	mXColumn{ xColumn },
+	mYColumn{ yColumn },
+	mDelimiter{ delimiter },
+	mHasHeader{ hasHeader }
+{
+	setSortedByX( sortedByX );
+}
+
+size_t CsvDataSource::size( ) const
+{
+	ensureIndex( );
+	return mLineOffsets.size( );
+}
+
+sf::Vector2< double > CsvDataSource::pointAt( size_t index ) const
+{
+	ensureIndex( );
+
+	const char* text = reinterpret_cast< const char* >( mFile.data( ) );
+	const char* begin = text + mLineOffsets[ index ];
+	const char* fileEnd = text + mFile.size( );
+
+	const char* end = static_cast< const char* >( std::memchr( begin, '\n', static_cast< size_t >( fileEnd - begin ) ) );
+	if (end == nullptr)
+	{
+		end = fileEnd;
+	}
+
+	return { parseField( begin, end, mXColumn ), parseField( begin, end, mYColumn ) };
+}
+
+void CsvDataSource::ensureIndex( ) const
+{
+	std::call_once( mIndexFlag, [ this ]( )
+	{
+		const char* text = reinterpret_cast< const char* >( mFile.data( ) );
+		const size_t length = mFile.size( );
+
+		bool skipLine = mHasHeader;
+		size_t lineStart = 0;
+		while (lineStart < length)
+		{
+			const void* newline = std::memchr( text + lineStart, '\n', length - lineStart );
+			size_t lineEnd = newline ? static_cast< size_t >( static_cast< const char* >( newline ) - text ) : length;
+
+			// Blank lines (including a lone '\r') carry no point.
+			bool blank = lineEnd == lineStart || (lineEnd == lineStart + 1 && text[ lineStart ] == '\r');
+			if (skipLine)
+			{
+				skipLine = false;
+			}
+			else if (!blank)
+			{
+				mLineOffsets.push_back( lineStart );
+			}
+
+			lineStart = lineEnd + 1;
+		}
+	});
+}
+
+double CsvDataSource::parseField( const char* begin, const char* end, size_t column ) const
+{
+	// Move to the requested field.
+	for (size_t field = 0; field < column; ++field)
+	{
+		const char* delimiter = static_cast< const char* >( std::memchr( begin, mDelimiter, static_cast< size_t >( end - begin ) ) );
+		if (delimiter == nullptr)
+		{
+			return std::numeric_limits< double >::quiet_NaN( );
+		}
+		begin = delimiter + 1;
+	}
+
+	// std::from_chars accepts neither leading blanks nor a '+' sign.
+	while (begin < end && (*begin == ' ' || *begin == '\t' || *begin == '+'))
+	{
+		++begin;
+	}
+
+	double value;
+	auto result = std::from_chars( begin, end, value );
+	if (result.ec != std::errc( ))
+	{
+		return std::numeric_limits< double >::quiet_NaN( );
+	}
+
+	return value;
+}
+
+}//End of namespace wPlot2D
\ No newline at end of file
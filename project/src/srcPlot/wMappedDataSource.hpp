@@ -0,0 +1,133 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_MAPPED_DATA_SOURCE_HPP
+#define W_MAPPED_DATA_SOURCE_HPP
+
+#include "../srcUtils/wMappedFile.hpp"
+
+#include "wDataSource.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace wPlot2D
+{
+
+	/**
+	 * @class MappedColumnDataSource
+	 * @brief DataSource reading raw little-endian float64 columns from a memory-mapped file.
+	 *
+	 * The file holds `columnCount` columns of IEEE-754 doubles, with no header:
+	 * - `Interleaved`: row by row (x0 y0 x1 y1 ...), as written by an array of records.
+	 * - `Planar`: column by column (x0 x1 ... y0 y1 ...), as written by separate arrays.
+	 *
+	 * Nothing is loaded up front: each point is read from the mapping when the plot geometry is
+	 * rebuilt. With sorted x (the default) and a visible range set on the DataPlotEntity, only
+	 * the pages holding visible rows are touched.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class MappedColumnDataSource : public DataSource
+	{
+		public:
+			/**
+			 * @enum ColumnLayout
+			 * @brief Arrangement of the columns in the file.
+			 */
+			enum class ColumnLayout
+			{
+				Interleaved,
+				Planar
+			};
+
+			/**
+			 * @brief Maps the file and locates the x and y columns.
+			 * @param path			Path to the binary file.
+			 * @param columnCount	Number of float64 columns in the file (default 2).
+			 * @param xColumn		Index of the x column (default 0).
+			 * @param yColumn		Index of the y column (default 1).
+			 * @param layout		Column arrangement (default Interleaved).
+			 * @param sortedByX		Whether x increases with the row index (default true).
+			 * @throw std::runtime_error if the file cannot be mapped.
+			 * @throw std::invalid_argument if a column index is out of range or the file size is not a whole number of rows.
+			 */
+			MappedColumnDataSource( const std::string& path, size_t columnCount = 2, size_t xColumn = 0, size_t yColumn = 1,
+				ColumnLayout layout = ColumnLayout::Interleaved, bool sortedByX = true );
+
+			[[nodiscard]] size_t size( ) const override;
+			[[nodiscard]] sf::Vector2< double > pointAt( size_t index ) const override;
+		private:
+			wEngine::MappedFile mFile;
+			size_t mRows;
+			const std::byte* mX;
+			const std::byte* mY;
+			size_t mStride;
+	};
+
+	/**
+	 * @class CsvDataSource
+	 * @brief DataSource reading two columns of a memory-mapped CSV file through a lazy line index.
+	 *
+	 * The first call to size( ) or pointAt( ) scans the mapping once for line breaks and stores
+	 * one offset per data line (8 bytes per line, instead of the parsed values). Fields are then
+	 * parsed on demand with `std::from_chars` each time a point is read. Unparsable fields yield NaN,
+	 * and the segments touching them are not drawn.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class CsvDataSource : public DataSource
+	{
+		public:
+			/**
+			 * @brief Maps the CSV file (the index is built lazily).
+			 * @param path			Path to the CSV file.
+			 * @param xColumn		Index of the x field (default 0).
+			 * @param yColumn		Index of the y field (default 1).
+			 * @param delimiter		Field separator (default ',').
+			 * @param hasHeader		Whether the first line holds column names (default true).
+			 * @param sortedByX		Whether x increases with the line index (default true).
+			 * @throw std::runtime_error if the file cannot be mapped.
+			 */
+			CsvDataSource( const std::string& path, size_t xColumn = 0, size_t yColumn = 1, char delimiter = ',',
+				bool hasHeader = true, bool sortedByX = true );
+
+			[[nodiscard]] size_t size( ) const override;
+			[[nodiscard]] sf::Vector2< double > pointAt( size_t index ) const override;
+		private:
+			wEngine::MappedFile mFile;
+			size_t mXColumn;
+			size_t mYColumn;
+			char mDelimiter;
+			bool mHasHeader;
+
+			mutable std::once_flag mIndexFlag;
+			mutable std::vector< size_t > mLineOffsets;
+
+			/**
+			 * @brief Internal: builds the line index on first use (thread-safe).
+			 */
+			void ensureIndex( ) const;
+
+			/**
+			 * @brief Internal: parses one field of a line.
+			 * @param begin First character of the line.
+			 * @param end One past the last character of the line.
+			 * @param column Field index.
+			 * @return Parsed value, or NaN if missing or invalid.
+			 */
+			[[nodiscard]] double parseField( const char* begin, const char* end, size_t column ) const;
+	};
+
+}//End of namespace wPlot2D
+
+#endif
\ No newline at end of file
@@ -6,7 +6,6 @@
 #include "wNotchEntity.hpp"
 #include "wAxisEntity.hpp"
 
-#include "../srcComponents/wPositionComponent.hpp"
 #include "../srcComponents/wColorComponent.hpp"
 #include "../srcComponents/wThicknessComponent.hpp"
 #include "../srcComponents/wLengthComponent.hpp"
@@ -20,44 +19,102 @@ namespace wPlot2D
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-NotchEntity::NotchEntity( AxisType type )
-:	mAlignment{ type }
+NotchEntity::NotchEntity( AxisType type, sf::Color color, float thickness, float length )
+:	mAlignment{ type },
+	mGeometry{ sf::PrimitiveType::Triangles }
 {
-
+	addComponent< wEngine::ColorComponent >( color );
+	addComponent< wEngine::ThicknessComponent >( thickness );
+	addComponent< wEngine::LengthComponent >( length );
 }
 
 /*
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
--> Public methods.
+-> Public methods: accessors and mutators.
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-void NotchEntity::render( sf::RenderWindow& window )
+void NotchEntity::addNotch( sf::Vector2f position )
 {
-	auto positionComponent	= requireComponent< wEngine::PositionComponent >( "NotchEntity::render( )" );
-	auto thicknessComponent	= requireComponent< wEngine::ThicknessComponent >( "NotchEntity::render( )" );
-	auto lengthComponent	= requireComponent< wEngine::LengthComponent >( "NotchEntity::render( )" );
-	auto colorComponent		= requireComponent< wEngine::ColorComponent >( "NotchEntity::render( )" );
+	mPositions.push_back( position );
+	markDirty( );
+}
 
-	sf::Vector2f pos	= positionComponent->getPosition( );
-	sf::Color color		= colorComponent->getColor( );
-	float thickness		= thicknessComponent->getThickness( );
-	float length		= lengthComponent->getLength( );
+void NotchEntity::reserve( size_t count )
+{
+	mPositions.reserve( count );
+}
 
-	sf::RectangleShape shape;
-	shape.setFillColor( color );
-	shape.setPosition( pos );
+void NotchEntity::clear( )
+{
+	mPositions.clear( );
+	markDirty( );
+}
 
-	if (mAlignment == AxisType::X_AXIS)
+void NotchEntity::move( sf::Vector2f delta )
+{
+	for (auto& position : mPositions)
 	{
-		shape.setSize( { thickness, length } );
+		position += delta;
 	}
-	else
+	markDirty( );
+}
+
+size_t NotchEntity::getCount( ) const
+{
+	return mPositions.size( );
+}
+
+const std::vector< sf::Vector2f >& NotchEntity::getPositions( ) const
+{
+	return mPositions;
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void NotchEntity::render( sf::RenderTarget& window )
+{
+	if (isDirty( ))
 	{
-		shape.setSize( { length, thickness } );
+		auto& thicknessComponent	= component< wEngine::ThicknessComponent >( "NotchEntity::render( )" );
+		auto& lengthComponent		= component< wEngine::LengthComponent >( "NotchEntity::render( )" );
+		auto& colorComponent		= component< wEngine::ColorComponent >( "NotchEntity::render( )" );
+
+		sf::Color color		= colorComponent.getColor( );
+		float thickness		= thicknessComponent.getThickness( );
+		float length		= lengthComponent.getLength( );
+
+		sf::Vector2f size = (mAlignment == AxisType::X_AXIS)
+			? sf::Vector2f( thickness, length )
+			: sf::Vector2f( length, thickness );
+
+		// Two triangles per notch, all in one batch.
+		mGeometry.resize( mPositions.size( ) * 6 );
+		for (size_t i = 0; i < mPositions.size( ); ++i)
+		{
+			sf::Vector2f topLeft = mPositions[ i ];
+			sf::Vector2f bottomRight = topLeft + size;
+			sf::Vertex* quad = &mGeometry[ i * 6 ];
+
+			quad[ 0 ] = { topLeft, color };
+			quad[ 1 ] = { { bottomRight.x, topLeft.y }, color };
+			quad[ 2 ] = { { topLeft.x, bottomRight.y }, color };
+			quad[ 3 ] = { { topLeft.x, bottomRight.y }, color };
+			quad[ 4 ] = { { bottomRight.x, topLeft.y }, color };
+			quad[ 5 ] = { bottomRight, color };
+		}
+
+		clearDirty( );
 	}
 
-	window.draw( shape );
+	if (mGeometry.getVertexCount( ) > 0)
+	{
+		window.draw( mGeometry );
+	}
 }
 
 }// End of namespace wPlot2D
\ No newline at end of file
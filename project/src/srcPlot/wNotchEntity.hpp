@@ -23,26 +23,25 @@ namespace wPlot2D
 
 	/**
 	 * @class NotchEntity
-	 * @brief Represents a single tick mark ("notch") on a 2D axis.
+	 * @brief Represents the tick marks ("notches") of a 2D axis.
 	 *
-	 * A `NotchEntity` is a visual element used to mark intervals along a coordinate axis,
-	 * helping users interpret scale in a plot. It is rendered as a small filled rectangle,
-	 * oriented perpendicularly to its associated axis (`X_AXIS` or `Y_AXIS`).
+	 * A `NotchEntity` holds every notch of one axis as a compact array of positions sharing a
+	 * single style. Notches are small filled rectangles, oriented perpendicularly to their
+	 * associated axis (`X_AXIS` or `Y_AXIS`), and are emitted as one quad batch: building and
+	 * drawing N notches costs N positions and one draw call rather than N entities.
 	 *
-	 * ### Components required:
-	 * - `PositionComponent`: specifies the top-left pixel position.
+	 * ### Components (shared by all notches):
 	 * - `ColorComponent`: defines the notch color.
 	 * - `ThicknessComponent`: defines the thickness (along the axis).
 	 * - `LengthComponent`: defines the length (perpendicular to the axis).
 	 *
 	 * ### Orientation:
-	 * - `AxisType::X_AXIS` : vertical notch (aligned with Y),
-	 * - `AxisType::Y_AXIS` : horizontal notch (aligned with X).
+	 * - `AxisType::X_AXIS` : vertical notches (aligned with Y),
+	 * - `AxisType::Y_AXIS` : horizontal notches (aligned with X).
 	 *
-	 * The actual rendering logic is handled internally using `sf::RectangleShape`.
+	 * The quads are cached and only rebuilt after a change (see Entity::isDirty( )).
 	 *
-	 * @note Components must be added externally (typically by `AxisEntity::addNotches( )`).
-	 * @see AxisEntity, AxisType, PositionComponent, LengthComponent, ThicknessComponent
+	 * @see AxisEntity, AxisType, LengthComponent, ThicknessComponent
 	 *
 	 * @author Wilfried Koch
 	 * @copyright © 2025 Wilfried Koch. All rights reserved.
@@ -52,10 +51,13 @@ namespace wPlot2D
 	{
 		public:
 			/**
-			 * @brief Constructs a `NotchEntity` aligned to a given axis.
-			 * @param type The axis type (X or Y) which determines notch orientation.
+			 * @brief Constructs an empty set of notches aligned to a given axis.
+			 * @param type		The axis type (X or Y) which determines notch orientation.
+			 * @param color		Color of the notches.
+			 * @param thickness	Thickness of the notches (along the axis) in pixels.
+			 * @param length	Length of the notches (perpendicular to the axis) in pixels.
 			 */
-			NotchEntity( AxisType type );
+			NotchEntity( AxisType type, sf::Color color, float thickness, float length );
 
 			/**
 			 * @brief Virtual destructor.
@@ -63,18 +65,55 @@ namespace wPlot2D
 			virtual ~NotchEntity( ) = default;
 
 			/**
-			 * @brief Renders the notch using SFML.
+			 * @brief Adds a notch.
+			 * @param position Top-left pixel position of the notch.
+			 */
+			void addNotch( sf::Vector2f position );
+
+			/**
+			 * @brief Reserves room for a number of notches.
+			 * @param count Expected number of notches.
+			 */
+			void reserve( size_t count );
+
+			/**
+			 * @brief Removes every notch (the style is kept).
+			 */
+			void clear( );
+
+			/**
+			 * @brief Moves every notch by the same amount.
+			 * @param delta Displacement in pixels.
+			 */
+			void move( sf::Vector2f delta );
+
+			/**
+			 * @brief Get the number of notches.
+			 * @return Number of notches.
+			 */
+			[[nodiscard]] size_t getCount( ) const;
+
+			/**
+			 * @brief Get the top-left pixel positions of the notches.
+			 * @return Positions, in insertion order.
+			 */
+			[[nodiscard]] const std::vector< sf::Vector2f >& getPositions( ) const;
+
+			/**
+			 * @brief Renders all notches with a single draw call.
 			 *
-			 * Builds a rectangle from ECS components (position, thickness, length, color)
-			 * and draws it in the render window.
+			 * Rebuilds the quad batch from the positions and the shared style (color, thickness,
+			 * length) when needed, then draws it in the render target.
 			 *
 			 * @throws std::runtime_error if any required component is missing.
-			 * @param window The render window to draw onto.
+			 * @param window The render target to draw onto.
 			 */
-			void render( sf::RenderWindow& window );
+			void render( sf::RenderTarget& window );
 
 		private:
 			AxisType mAlignment;
+			std::vector< sf::Vector2f > mPositions;
+			sf::VertexArray mGeometry;
 	};
 
 } // namespace wPlot2D
@@ -152,16 +152,16 @@ sf::Vector2f TitleEntity::getPadding( ) const
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-void TitleEntity::render( sf::RenderWindow& window )
+void TitleEntity::render( sf::RenderTarget& window, const sf::RenderStates& states )
 {
-	auto positionComponent = requireComponent< wEngine::PositionComponent >( "TitleEntity::render( )" );
-	auto offsetComponent = requireComponent< wEngine::OffsetComponent >( "TitleEntity::render( )" );
-	auto colorComponent = requireComponent< wEngine::ColorComponent >( "TitleEntity::render( )" );
-	auto fontComponent = requireComponent< wEngine::FontComponent >( "TitleEntity::render( )" );
+	auto& positionComponent = component< wEngine::PositionComponent >( "TitleEntity::render( )" );
+	auto& offsetComponent = component< wEngine::OffsetComponent >( "TitleEntity::render( )" );
+	auto& colorComponent = component< wEngine::ColorComponent >( "TitleEntity::render( )" );
+	auto& fontComponent = component< wEngine::FontComponent >( "TitleEntity::render( )" );
 
-	mTitleText.setFont( fontComponent->getFont( ) );
+	mTitleText.setFont( fontComponent.getFont( ) );
 
-	sf::Vector2f finalPosition = positionComponent->getPosition( ) + offsetComponent->getOffset( );
+	sf::Vector2f finalPosition = positionComponent.getPosition( ) + offsetComponent.getOffset( );
 
 	sf::FloatRect bounds = mTitleText.getLocalBounds( );
 
@@ -171,13 +171,13 @@ void TitleEntity::render( sf::RenderWindow& window )
 		bounds.position.y + bounds.size.y / 2.0f
 	} );
 
-	mTitleText.setFillColor( colorComponent->getColor( ) );
+	mTitleText.setFillColor( colorComponent.getColor( ) );
 	mTitleText.setPosition( finalPosition );
 
 	mFrame.update( bounds, finalPosition );
-	mFrame.render( window );
+	mFrame.render( window, states );
 
-	window.draw( mTitleText );
+	window.draw( mTitleText, states );
 }
 
 }// End of namespace wPlot2D
\ No newline at end of file
@@ -177,9 +177,11 @@ namespace wPlot2D
 			 * If the frame is enabled, it is rendered behind the text, centered
 			 * with the same anchor point and adjusted using the specified padding.
 			 *
-			 * @param window The target SFML render window.
+			 * @param window The target SFML render target.
+			 * @param states Render states applied to the text and the frame (e.g. a translation
+			 *               applied to this draw only, without touching the components).
 			 */
-			void render( sf::RenderWindow& window );
+			void render( sf::RenderTarget& window, const sf::RenderStates& states = sf::RenderStates::Default );
 
 		private:
 			sf::Text mTitleText;
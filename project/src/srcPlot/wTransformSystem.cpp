@@ -0,0 +1,43 @@
+/**
+ * @file wTransformSystem.cpp
+ * @brief Implementation of the TransformSystem class.
+ */
+
+#include "wTransformSystem.hpp"
+
+#include "../srcComponents/wPositionComponent.hpp"
+#include "../srcComponents/wScaleComponent.hpp"
+
+namespace wPlot2D
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Constructors and destructors.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+TransformSystem::TransformSystem( sf::Vector2f origin, sf::Vector2f scale )
+:	mOrigin{ origin },
+	mScale{ scale }
+{
+
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void TransformSystem::update( wEngine::Registry& registry )
+{
+	registry.each< wEngine::PositionComponent, wEngine::ScaleComponent >(
+		[ this ]( wEngine::Entity&, wEngine::PositionComponent& position, wEngine::ScaleComponent& scale )
+		{
+			position.setPosition( mOrigin );
+			scale.setScale( mScale );
+		} );
+}
+
+}//End of namespace wPlot2D
\ No newline at end of file
@@ -0,0 +1,58 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_TRANSFORM_SYSTEM_HPP
+#define W_TRANSFORM_SYSTEM_HPP
+
+#include "../srcEntity/wSystem.hpp"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#include <SFML/System/Vector2.hpp>
+#pragma GCC diagnostic pop
+
+namespace wPlot2D
+{
+
+	/**
+	 * @class TransformSystem
+	 * @brief Applies the plot origin and scale to every plot-space entity of a registry.
+	 *
+	 * Functions, data plots and lines keep their own copy of the plot origin (PositionComponent)
+	 * and scale (ScaleComponent). When the plot transform changes, this system updates every
+	 * Position + Scale holder in one pass; each updated entity is flagged dirty and rebuilds
+	 * its geometry on the next draw.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class TransformSystem : public wEngine::System
+	{
+		public:
+			/**
+			 * @brief Constructs the system with the transform to apply.
+			 * @param origin	Pixel position of the logical origin.
+			 * @param scale		Scaling factors (pixels per logical unit).
+			 */
+			TransformSystem( sf::Vector2f origin, sf::Vector2f scale );
+
+			/**
+			 * @brief Sets the origin and scale of every Position + Scale holder of the registry.
+			 * @param registry Registry to iterate.
+			 */
+			void update( wEngine::Registry& registry ) override;
+
+		private:
+			sf::Vector2f mOrigin;
+			sf::Vector2f mScale;
+	};
+
+}//End of namespace wPlot2D
+
+#endif
\ No newline at end of file
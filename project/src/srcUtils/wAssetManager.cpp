@@ -5,7 +5,11 @@
 
 #include "wAssetManager.hpp"
 
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <mutex>
 
 namespace wEngine
 {
@@ -18,8 +22,8 @@ namespace wEngine
 
 void AssetManager::LoadFont( const std::string& name, const std::string& fileName )
 {
-	sf::Font font;
-	if( !font.openFromFile( fileName ) )
+	auto font = acquireFont( fileName );
+	if (!font)
 	{
 		throw std::runtime_error( "AssetManager error: unable to load font '" + name + "' at '" + fileName + "'" );
 	}
@@ -28,67 +32,51 @@ void AssetManager::LoadFont( const std::string& name, const std::string& fileNam
 
 void AssetManager::LoadFont( const std::string& name, const std::vector< std::string >& possiblePaths )
 {
-	sf::Font font;
-	bool loaded = false;
-
-#if defined(_WIN32)
-	// On Windows, we cannot reassign stderr, so just skip silencing.
+	// Try all possible paths until one succeeds (missing files are skipped without SFML errors).
 	for (const auto& path : possiblePaths)
 	{
-		if (font.openFromFile( path ))
+		if (auto font = acquireFont( path ))
 		{
-			loaded = true;
-			break;
+			// Store the loaded font in the internal map.
+			mFont.emplace( name, std::move( font ) );
+			return;
 		}
 	}
-#else
-	// On Unix/macOS, temporarily silence SFML error output.
-	FILE* old_stderr = stderr;
-	FILE* nullout = fopen( "/dev/null", "w" );
-	if (nullout)
-	{
-		stderr = nullout;
-	}
 
-	// Try all possible paths until one succeeds.
-	for (const auto& path : possiblePaths)
-	{
-		if (font.openFromFile( path ))
-		{
-			loaded = true;
-			break;
-		}
-	}
+	// If no path succeeded, build a detailed error message.
+	std::string msg = "AssetManager error: unable to load font '" + name + "' from any of the following paths:\n";
 
-	if (nullout)
+	for (const auto& p : possiblePaths)
 	{
-		// Restore normal stderr output.
-		fclose( stderr );
-		stderr = old_stderr;
+		msg += "  - " + p + "\n";
 	}
-#endif
 
-	// If no path succeeded, build a detailed error message.
-	if (!loaded)
-	{
-		std::string msg = "AssetManager error: unable to load font '" + name + "' from any of the following paths:\n";
+	throw std::runtime_error( msg );
+}
 
-		for (const auto& p : possiblePaths)
+void AssetManager::LoadFontFromMemory( const std::string& name, const void* data, std::size_t size )
+{
+	auto& fonts = threadFontCache( );
+	std::string key = "memory:" + std::to_string( reinterpret_cast< std::uintptr_t >( data ) );
+
+	auto it = fonts.find( key );
+	if (it == fonts.end( ))
+	{
+		auto font = std::make_shared< sf::Font >( );
+		if (!font->openFromMemory( data, size ))
 		{
-			msg += "  - " + p + "\n";
+			throw std::runtime_error( "AssetManager error: unable to load font '" + name + "' from memory" );
 		}
-
-		throw std::runtime_error( msg );
+		it = fonts.emplace( key, std::move( font ) ).first;
 	}
 
-	// Store the loaded font in the internal map.
-	mFont.emplace( name, std::move( font ) );
+	mFont.emplace( name, it->second );
 }
 
 sf::Font& AssetManager::getFont( const std::string& name )
 {
 	EnsureExists( mFont, name, "Font" );
-	return mFont.at( name );
+	return *mFont.at( name );
 }
 
 void AssetManager::RemoveFont( const std::string& name )
@@ -113,12 +101,99 @@ void AssetManager::debugPrintFonts( ) const
 	}
 }
 
+/*
++----------------------------------------------------------------------------------------------------------------------+
+-> Public static methods. Font cache.
++----------------------------------------------------------------------------------------------------------------------+
+*/
+
+void AssetManager::releaseCachedFonts( )
+{
+	threadFontCache( ).clear( );
+}
+
 /*
 +----------------------------------------------------------------------------------------------------------------------+
 -> Private methods.
 +----------------------------------------------------------------------------------------------------------------------+
 */
 
+std::map< std::string, std::shared_ptr< sf::Font > >& AssetManager::threadFontCache( )
+{
+	thread_local std::map< std::string, std::shared_ptr< sf::Font > > fonts;
+	return fonts;
+}
+
+std::shared_ptr< const std::vector< std::byte > > AssetManager::acquireFontData( const std::string& path )
+{
+	static std::mutex mutex;
+	static std::map< std::string, std::weak_ptr< const std::vector< std::byte > > > cache;
+
+	std::lock_guard< std::mutex > lock( mutex );
+
+	if (auto it = cache.find( path ); it != cache.end( ))
+	{
+		if (auto data = it->second.lock( ))
+		{
+			return data;
+		}
+	}
+
+	std::error_code error;
+	if (!std::filesystem::is_regular_file( path, error ))
+	{
+		return nullptr;
+	}
+
+	std::ifstream file( path, std::ios::binary | std::ios::ate );
+	if (!file)
+	{
+		return nullptr;
+	}
+
+	auto data = std::make_shared< std::vector< std::byte > >( static_cast< size_t >( file.tellg( ) ) );
+	file.seekg( 0 );
+	if (!file.read( reinterpret_cast< char* >( data->data( ) ), static_cast< std::streamsize >( data->size( ) ) ))
+	{
+		return nullptr;
+	}
+
+	cache[ path ] = data;
+	return data;
+}
+
+std::shared_ptr< sf::Font > AssetManager::acquireFont( const std::string& path )
+{
+	auto& fonts = threadFontCache( );
+	if (auto it = fonts.find( path ); it != fonts.end( ))
+	{
+		return it->second;
+	}
+
+	auto data = acquireFontData( path );
+	if (!data)
+	{
+		return nullptr;
+	}
+
+	// sf::Font reads its memory buffer lazily: tie the bytes' lifetime to the font's.
+	struct FontHolder
+	{
+		std::shared_ptr< const std::vector< std::byte > > data;
+		sf::Font font;
+	};
+	auto holder = std::make_shared< FontHolder >( );
+	holder->data = std::move( data );
+	if (!holder->font.openFromMemory( holder->data->data( ), holder->data->size( ) ))
+	{
+		return nullptr;
+	}
+
+	std::shared_ptr< sf::Font > font( holder, &holder->font );
+	fonts.emplace( path, font );
+	return font;
+}
+
 template < typename Map >
 void AssetManager::EnsureExists( const Map& map, const std::string& name, const std::string& type )
 {
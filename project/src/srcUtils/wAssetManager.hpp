@@ -14,8 +14,11 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #include <SFML/Graphics.hpp>
 #pragma GCC diagnostic pop
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <stdexcept>
 #include <iostream>
 
@@ -36,6 +39,15 @@ namespace wEngine
 	 * - Remove fonts from memory when no longer needed.
 	 * - Debug printing of loaded assets.
 	 *
+	 * Fonts are shared, not reloaded: the file bytes are cached process-wide (keyed by path and
+	 * released once no font uses them), and each thread remembers the fonts it parsed so that every
+	 * live manager on that thread reuses the same sf::Font, glyph textures included.
+	 * sf::Font is not thread-safe, hence one parsed font per thread rather than per process.
+	 * The thread cache owns its fonts, so figures built one after another on the same thread
+	 * reuse the parsed font and its glyph atlases even when no manager survives in between;
+	 * they are only freed by releaseCachedFonts( ) (BatchExporter calls it on each worker at the
+	 * end of a batch) or when the thread exits.
+	 *
 	 * This manager is non-copyable to ensure centralized ownership and avoid
 	 * accidental duplication of resources.
 	 * 
@@ -72,7 +84,7 @@ namespace wEngine
 			 *
 			 * This function attempts to load the specified font (`name`) by iterating through
 			 * several possible paths provided in `possiblePaths`.  
-			 * It silences SFML's internal error messages during the process to avoid clutter.
+			 * Missing files are skipped before SFML tries to open them, so no error is printed for them.
 			 *
 			 * - The function stops at the first successful load.
 			 * - If none of the paths work, it throws a std::runtime_error with the list of paths tested.
@@ -88,6 +100,21 @@ namespace wEngine
 			 */
 			void LoadFont( const std::string& name, const std::vector< std::string >& possiblePaths );
 
+			/**
+			 * @brief Loads a font from a memory buffer and stores it under a given name.
+			 *
+			 * No file is accessed. The buffer is not copied: it must stay valid as long as the
+			 * font is used (typically static data, see wEmbeddedFonts.hpp). Fonts are cached per
+			 * thread by buffer address, like file fonts are by path.
+			 *
+			 * @param name The unique name used to identify the font.
+			 * @param data Font file contents (TTF/OTF).
+			 * @param size Size of the buffer in bytes.
+			 *
+			 * @throws std::runtime_error if the font cannot be parsed.
+			 */
+			void LoadFontFromMemory( const std::string& name, const void* data, std::size_t size );
+
 			/**
 			 * @brief Retrieves a reference to a previously loaded font.
 			 * @param name The name of the font previously loaded.
@@ -107,8 +134,34 @@ namespace wEngine
 			 * @brief Prints the list of loaded fonts to standard output.
 			 */
 			void debugPrintFonts( ) const;
+
+			/**
+			 * @brief Drops the fonts cached by the calling thread.
+			 *
+			 * Managers that already hold a font keep it alive; later loads parse the font again.
+			 * Call it on long-lived threads that no longer build figures to free their fonts and
+			 * glyph atlases.
+			 */
+			static void releaseCachedFonts( );
 		private:
-			std::map< std::string, sf::Font > mFont;
+			std::map< std::string, std::shared_ptr< sf::Font > > mFont;
+
+			/**
+			 * @brief Returns the fonts parsed by the calling thread, keyed by path.
+			 */
+			static std::map< std::string, std::shared_ptr< sf::Font > >& threadFontCache( );
+
+			/**
+			 * @brief Returns the bytes of a font file from the process-wide cache, reading it on first use.
+			 * @return The file contents, or nullptr if the file does not exist or cannot be read.
+			 */
+			static std::shared_ptr< const std::vector< std::byte > > acquireFontData( const std::string& path );
+
+			/**
+			 * @brief Returns the calling thread's font for @p path, parsing it on first use.
+			 * @return The font, or nullptr if it cannot be loaded.
+			 */
+			static std::shared_ptr< sf::Font > acquireFont( const std::string& path );
 
 			/**
 			 * @brief Checks whether a given key exists in a map and throws if not.
@@ -0,0 +1,8305 @@
+/**
+ * @file wEmbeddedFonts.cpp
+ * @brief Bundled font files embedded as byte arrays (compiled only with WPLOT2D_EMBED_FONTS).
+ *
+ * Generated from Resources/Fonts/CourierPrimeCode/CourierPrimeCode.ttf and
+ * Resources/Fonts/Inconsolata/Inconsolata.otf (SIL Open Font License 1.1, which permits embedding).
+ * Regenerate the arrays (e.g. with `xxd -i`) whenever those files change.
+ */
+
+#include "wEmbeddedFonts.hpp"
+
+#ifdef WPLOT2D_EMBED_FONTS
+
+namespace wEngine
+{
+
+namespace EmbeddedFonts
+{
+	const unsigned char CourierPrimeCode[ ] =
+	{
+		0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x44, 0x53, 0x49, 0x47,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x20, 0x48, 0x00, 0x00, 0x00, 0x08, 0x47, 0x53, 0x55, 0x42,
+		0x1a, 0x6f, 0x0b, 0xcc, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x04, 0x6e, 0x4f, 0x53, 0x2f, 0x32,
+		0x71, 0x18, 0x89, 0x8e, 0x00, 0x00, 0x05, 0x7c, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+		0xd7, 0xce, 0xb9, 0xf9, 0x00, 0x00, 0x05, 0xdc, 0x00, 0x00, 0x06, 0x46, 0x63, 0x76, 0x74, 0x20,
+		0x22, 0xd6, 0xfe, 0xb8, 0x00, 0x01, 0x13, 0x98, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x70, 0x67, 0x6d,
+		0x3f, 0xae, 0x1b, 0x9f, 0x00, 0x01, 0x13, 0xd4, 0x00, 0x00, 0x0b, 0xe2, 0x67, 0x61, 0x73, 0x70,
+		0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x13, 0x90, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66,
+		0xcf, 0x99, 0x79, 0xec, 0x00, 0x00, 0x0c, 0x24, 0x00, 0x00, 0xbc, 0xce, 0x68, 0x65, 0x61, 0x64,
+		0x0d, 0x2f, 0xe1, 0xd2, 0x00, 0x00, 0xc8, 0xf4, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+		0x0f, 0x24, 0x0b, 0x9c, 0x00, 0x00, 0xc9, 0x2c, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+		0x59, 0x11, 0x10, 0xfa, 0x00, 0x00, 0xc9, 0x50, 0x00, 0x00, 0x06, 0x38, 0x6c, 0x6f, 0x63, 0x61,
+		0x6d, 0x14, 0x9f, 0x01, 0x00, 0x00, 0xcf, 0x88, 0x00, 0x00, 0x03, 0x38, 0x6d, 0x61, 0x78, 0x70,
+		0x02, 0xe9, 0x0c, 0xe7, 0x00, 0x00, 0xd2, 0xc0, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+		0xb8, 0x46, 0xea, 0xc9, 0x00, 0x00, 0xd2, 0xe0, 0x00, 0x00, 0x37, 0x6b, 0x70, 0x6f, 0x73, 0x74,
+		0xae, 0xc8, 0xe9, 0xb5, 0x00, 0x01, 0x0a, 0x4c, 0x00, 0x00, 0x09, 0x44, 0x70, 0x72, 0x65, 0x70,
+		0x19, 0x50, 0x02, 0x10, 0x00, 0x01, 0x1f, 0xb8, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x01, 0x00, 0x00,
+		0x00, 0x0a, 0x00, 0xa2, 0x02, 0x30, 0x00, 0x03, 0x44, 0x46, 0x4c, 0x54, 0x00, 0x14, 0x67, 0x72,
+		0x65, 0x6b, 0x00, 0x28, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x3c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x05, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x16,
+		0x00, 0x1c, 0x00, 0x16, 0x00, 0x03, 0x43, 0x41, 0x54, 0x20, 0x00, 0x26, 0x4d, 0x4f, 0x4c, 0x20,
+		0x00, 0x38, 0x52, 0x4f, 0x4d, 0x20, 0x00, 0x4a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x05, 0x00, 0x02,
+		0x00, 0x08, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x06, 0x00, 0x03,
+		0x00, 0x09, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x06,
+		0x00, 0x04, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x13, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x00, 0xff, 0xff,
+		0x00, 0x06, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x21,
+		0x61, 0x61, 0x6c, 0x74, 0x00, 0xc8, 0x61, 0x61, 0x6c, 0x74, 0x00, 0xce, 0x61, 0x61, 0x6c, 0x74,
+		0x00, 0xd4, 0x61, 0x61, 0x6c, 0x74, 0x00, 0xda, 0x61, 0x61, 0x6c, 0x74, 0x00, 0xe0, 0x61, 0x61,
+		0x6c, 0x74, 0x00, 0xe6, 0x63, 0x61, 0x73, 0x65, 0x00, 0xec, 0x63, 0x61, 0x73, 0x65, 0x00, 0xf2,
+		0x63, 0x61, 0x73, 0x65, 0x00, 0xf8, 0x63, 0x61, 0x73, 0x65, 0x00, 0xfe, 0x63, 0x61, 0x73, 0x65,
+		0x01, 0x04, 0x63, 0x61, 0x73, 0x65, 0x01, 0x0a, 0x66, 0x72, 0x61, 0x63, 0x01, 0x10, 0x66, 0x72,
+		0x61, 0x63, 0x01, 0x16, 0x66, 0x72, 0x61, 0x63, 0x01, 0x1c, 0x66, 0x72, 0x61, 0x63, 0x01, 0x22,
+		0x66, 0x72, 0x61, 0x63, 0x01, 0x28, 0x66, 0x72, 0x61, 0x63, 0x01, 0x2e, 0x6c, 0x6f, 0x63, 0x6c,
+		0x01, 0x34, 0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x3a, 0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x40, 0x6f, 0x72,
+		0x64, 0x6e, 0x01, 0x46, 0x6f, 0x72, 0x64, 0x6e, 0x01, 0x4c, 0x6f, 0x72, 0x64, 0x6e, 0x01, 0x52,
+		0x6f, 0x72, 0x64, 0x6e, 0x01, 0x58, 0x6f, 0x72, 0x64, 0x6e, 0x01, 0x5e, 0x6f, 0x72, 0x64, 0x6e,
+		0x01, 0x64, 0x73, 0x75, 0x70, 0x73, 0x01, 0x6a, 0x73, 0x75, 0x70, 0x73, 0x01, 0x70, 0x73, 0x75,
+		0x70, 0x73, 0x01, 0x76, 0x73, 0x75, 0x70, 0x73, 0x01, 0x7c, 0x73, 0x75, 0x70, 0x73, 0x01, 0x82,
+		0x73, 0x75, 0x70, 0x73, 0x01, 0x88, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x16,
+		0x00, 0x1e, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x52, 0x00, 0x5a,
+		0x00, 0x62, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x52, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02,
+		0x00, 0x58, 0x00, 0x6c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x76, 0x00, 0x04, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x74, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x98, 0x00, 0xaa, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0xb2, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x06, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x01, 0x01, 0x1c, 0x00, 0x02, 0x01, 0x22, 0x00, 0x04, 0x00, 0x5e, 0x00, 0x63,
+		0x00, 0xdd, 0x00, 0xe3, 0x00, 0x02, 0x01, 0x14, 0x00, 0x04, 0x00, 0x5e, 0x00, 0x63, 0x00, 0xdd,
+		0x00, 0xe3, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x01, 0x12, 0x01, 0x18, 0x00, 0x01, 0x01, 0x12,
+		0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x01, 0x0a, 0x01, 0x04,
+		0x00, 0x01, 0x01, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0xfc, 0x00, 0x0d,
+		0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x20, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0e,
+		0x01, 0x12, 0x00, 0x03, 0x01, 0x32, 0x01, 0x09, 0x01, 0x13, 0x00, 0x03, 0x01, 0x32, 0x01, 0x0b,
+		0x00, 0x01, 0x00, 0x04, 0x01, 0x14, 0x00, 0x03, 0x01, 0x32, 0x01, 0x0b, 0x00, 0x03, 0x00, 0x01,
+		0x00, 0xdc, 0x00, 0x01, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x03,
+		0x00, 0x01, 0x00, 0xca, 0x00, 0x01, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+		0x00, 0x02, 0x00, 0xd2, 0x00, 0x0e, 0x01, 0x7f, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87,
+		0x01, 0x88, 0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f,
+		0x01, 0x90, 0x00, 0x02, 0x00, 0xcc, 0x00, 0x1a, 0x01, 0x01, 0x01, 0x02, 0x00, 0x5e, 0x00, 0x63,
+		0x01, 0x01, 0x01, 0x02, 0x00, 0xdd, 0x00, 0xe3, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18,
+		0x01, 0x7f, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a,
+		0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x01, 0x90, 0x00, 0x01, 0x00, 0xca,
+		0x00, 0x02, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x01, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x02, 0x01, 0x24,
+		0x00, 0x01, 0x00, 0x04, 0x00, 0xbd, 0x00, 0x02, 0x01, 0x24, 0x00, 0x02, 0x00, 0xb4, 0x00, 0x04,
+		0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x5c, 0x00, 0x62,
+		0x00, 0xdb, 0x00, 0xe2, 0x00, 0x01, 0x00, 0x01, 0x00, 0xb9, 0x00, 0x01, 0x00, 0x01, 0x01, 0x24,
+		0x00, 0x01, 0x00, 0x01, 0x00, 0x3a, 0x00, 0x02, 0x00, 0x01, 0x01, 0x08, 0x01, 0x0b, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x02, 0x01, 0x08, 0x01, 0x0a, 0x00, 0x02, 0x00, 0x01, 0x01, 0x07, 0x01, 0x10,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x7f, 0x00, 0x01, 0x00, 0x02, 0x00, 0x47,
+		0x00, 0xc6, 0x00, 0x02, 0x00, 0x04, 0x01, 0x7e, 0x01, 0x7e, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80,
+		0x00, 0x01, 0x01, 0x82, 0x01, 0x83, 0x00, 0x02, 0x01, 0x91, 0x01, 0x9a, 0x00, 0x04, 0x00, 0x01,
+		0x00, 0x1a, 0x00, 0x02, 0x00, 0x47, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x7f, 0x00, 0xc6, 0x00, 0xdb,
+		0x00, 0xe2, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x7e, 0x01, 0x80, 0x01, 0x82,
+		0x01, 0x83, 0x01, 0x91, 0x01, 0x92, 0x01, 0x93, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97,
+		0x01, 0x98, 0x01, 0x99, 0x01, 0x9a, 0x00, 0x01, 0x00, 0x02, 0x00, 0x3a, 0x00, 0xb9, 0x00, 0x01,
+		0x00, 0x04, 0x00, 0x02, 0x00, 0x47, 0x00, 0x7f, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x03, 0x04, 0xe0,
+		0x01, 0x90, 0x00, 0x05, 0x00, 0x08, 0x05, 0x33, 0x04, 0xcc, 0x00, 0x00, 0x00, 0x99, 0x05, 0x33,
+		0x04, 0xcc, 0x00, 0x00, 0x02, 0xcc, 0x00, 0x82, 0x02, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x09,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x55, 0x51, 0x41, 0x00, 0x40, 0x00, 0x20, 0xfb, 0x02,
+		0x05, 0x8d, 0xfd, 0x7d, 0x00, 0xc2, 0x07, 0x05, 0x03, 0x47, 0x20, 0x00, 0x00, 0x93, 0x00, 0x00,
+		0x00, 0x00, 0x03, 0x9c, 0x04, 0xa3, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+		0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+		0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x14, 0x00, 0x06, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x09,
+		0x00, 0xf7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x29, 0x01, 0x2f, 0x01, 0x2b, 0x01, 0x51, 0x01, 0x67, 0x01, 0x72, 0x01, 0x30,
+		0x01, 0x38, 0x01, 0x39, 0x01, 0x22, 0x01, 0x69, 0x01, 0x27, 0x01, 0x41, 0x01, 0x2c, 0x01, 0x32,
+		0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e,
+		0x01, 0x0f, 0x01, 0x10, 0x01, 0x26, 0x01, 0x31, 0x01, 0x60, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x2d,
+		0x01, 0x71, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x18, 0x00, 0x22, 0x00, 0x23,
+		0x00, 0x28, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x41, 0x00, 0x47,
+		0x00, 0x52, 0x00, 0x54, 0x00, 0x55, 0x00, 0x59, 0x00, 0x5f, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x70,
+		0x00, 0x75, 0x00, 0x76, 0x00, 0x7b, 0x01, 0x36, 0x01, 0x23, 0x01, 0x37, 0x01, 0x79, 0x01, 0x33,
+		0x01, 0x95, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa0,
+		0x00, 0xa5, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xb7, 0x00, 0xb9, 0x00, 0xbf, 0x00, 0xc0, 0x00, 0xc6,
+		0x00, 0xd1, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd8, 0x00, 0xdf, 0x00, 0xe4, 0x00, 0xef, 0x00, 0xf0,
+		0x00, 0xf5, 0x00, 0xf6, 0x00, 0xfb, 0x01, 0x34, 0x01, 0x6f, 0x01, 0x35, 0x01, 0x59, 0x00, 0x00,
+		0x00, 0x06, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x19, 0x00, 0x46, 0x00, 0x4b, 0x00, 0x68, 0x00, 0x80,
+		0x00, 0x84, 0x00, 0x82, 0x00, 0x83, 0x00, 0x88, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x96, 0x00, 0x9c,
+		0x00, 0x99, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0xaf, 0x00, 0xac, 0x00, 0xad, 0x00, 0xc5, 0x00, 0xc7,
+		0x00, 0xcb, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xcf, 0x00, 0xe5, 0x00, 0xe9, 0x00, 0xe7, 0x00, 0xe8,
+		0x01, 0x7a, 0x01, 0x78, 0x01, 0x4f, 0x01, 0x55, 0x01, 0x76, 0x01, 0x25, 0x01, 0x73, 0x00, 0xde,
+		0x01, 0x75, 0x01, 0x74, 0x01, 0x77, 0x01, 0x80, 0x01, 0x93, 0x01, 0x65, 0x00, 0x0c, 0x00, 0x4f,
+		0x01, 0x5e, 0x01, 0x6a, 0x01, 0x61, 0x01, 0x5d, 0x01, 0x57, 0x00, 0x00, 0x01, 0x66, 0x01, 0x6d,
+		0x01, 0x6b, 0x01, 0x06, 0x01, 0x5f, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x00, 0x89, 0x00, 0xce,
+		0x01, 0x2e, 0x01, 0x2a, 0x01, 0x62, 0x01, 0x6c, 0x01, 0x53, 0x01, 0x58, 0x00, 0x00, 0x01, 0x44,
+		0x01, 0x45, 0x01, 0x28, 0x01, 0x4e, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x50, 0x00, 0x51, 0x00, 0xd0,
+		0x01, 0x40, 0x01, 0x3f, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x5a, 0x01, 0x6e,
+		0x00, 0xf9, 0x00, 0x79, 0x01, 0x11, 0x01, 0x52, 0x01, 0x46, 0x01, 0x47, 0x00, 0xff, 0x01, 0x00,
+		0x01, 0x7b, 0x01, 0x24, 0x01, 0x4d, 0x01, 0x48, 0x01, 0x68, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x03,
+		0x00, 0x1d, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x32, 0x00, 0x48, 0x00, 0x4a,
+		0x00, 0x00, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x67, 0x00, 0x69, 0x00, 0xa9, 0x01, 0x92, 0x01, 0x9a,
+		0x01, 0x97, 0x01, 0x82, 0x01, 0x94, 0x01, 0x99, 0x01, 0x91, 0x01, 0x96, 0x01, 0x98, 0x01, 0x83,
+		0x00, 0x04, 0x04, 0x32, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x40, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x2f,
+		0x00, 0x7e, 0x00, 0xb4, 0x01, 0x37, 0x01, 0x48, 0x01, 0x7e, 0x01, 0x92, 0x02, 0x1b, 0x02, 0x37,
+		0x02, 0xc7, 0x02, 0xdd, 0x03, 0x26, 0x03, 0x94, 0x03, 0xa9, 0x03, 0xbc, 0x03, 0xc0, 0x1e, 0x85,
+		0x1e, 0xf3, 0x20, 0x11, 0x20, 0x14, 0x20, 0x1a, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30,
+		0x20, 0x33, 0x20, 0x3a, 0x20, 0x44, 0x20, 0x74, 0x20, 0xa3, 0x20, 0xa9, 0x20, 0xac, 0x21, 0x22,
+		0x22, 0x02, 0x22, 0x0f, 0x22, 0x12, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60,
+		0x22, 0x65, 0x25, 0xca, 0xfb, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0xa0,
+		0x00, 0xb6, 0x01, 0x39, 0x01, 0x4a, 0x01, 0x92, 0x02, 0x18, 0x02, 0x37, 0x02, 0xc6, 0x02, 0xd8,
+		0x03, 0x26, 0x03, 0x94, 0x03, 0xa9, 0x03, 0xbc, 0x03, 0xc0, 0x1e, 0x80, 0x1e, 0xf2, 0x20, 0x11,
+		0x20, 0x13, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x20, 0x20, 0x26, 0x20, 0x30, 0x20, 0x32, 0x20, 0x39,
+		0x20, 0x44, 0x20, 0x74, 0x20, 0xa3, 0x20, 0xa9, 0x20, 0xac, 0x21, 0x22, 0x22, 0x02, 0x22, 0x0f,
+		0x22, 0x11, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xca,
+		0xfb, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xff, 0xc1, 0x00, 0x00, 0xfe, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x58, 0xfd, 0x6f, 0xfd, 0x5b,
+		0xfd, 0x49, 0xfd, 0x46, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x31, 0x00, 0x00, 0xe1, 0x33, 0x00, 0x00,
+		0x00, 0x00, 0xe1, 0x02, 0xe1, 0x38, 0xe1, 0x4a, 0xe1, 0x0d, 0xe0, 0xcd, 0xe0, 0xa4, 0xe0, 0xb1,
+		0xe0, 0xad, 0xe0, 0xa6, 0xe0, 0x55, 0xdf, 0x64, 0xdf, 0x5c, 0x00, 0x00, 0xdf, 0x52, 0xdf, 0x40,
+		0xdf, 0x34, 0xdf, 0x10, 0xdf, 0x05, 0x00, 0x00, 0xdb, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a,
+		0x00, 0x78, 0x01, 0x14, 0x01, 0x3c, 0x02, 0x3e, 0x02, 0x5c, 0x00, 0x00, 0x02, 0xc2, 0x00, 0x00,
+		0x02, 0xc6, 0x02, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8,
+		0x02, 0xd2, 0x00, 0x00, 0x02, 0xd2, 0x00, 0x00, 0x02, 0xd2, 0x02, 0xd6, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0xba, 0x00, 0x00, 0x02, 0xba, 0x00, 0x00, 0x00, 0x01, 0x01, 0x29, 0x01, 0x2f, 0x01, 0x2b,
+		0x01, 0x51, 0x01, 0x67, 0x01, 0x72, 0x01, 0x30, 0x01, 0x38, 0x01, 0x39, 0x01, 0x22, 0x01, 0x69,
+		0x01, 0x27, 0x01, 0x41, 0x01, 0x2c, 0x01, 0x32, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0a,
+		0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x10, 0x01, 0x26, 0x01, 0x31,
+		0x01, 0x60, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x2d, 0x01, 0x71, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x0e,
+		0x00, 0x14, 0x00, 0x18, 0x00, 0x22, 0x00, 0x23, 0x00, 0x28, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x38,
+		0x00, 0x3a, 0x00, 0x40, 0x00, 0x41, 0x00, 0x47, 0x00, 0x52, 0x00, 0x54, 0x00, 0x55, 0x00, 0x59,
+		0x00, 0x5f, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x75, 0x00, 0x76, 0x00, 0x7b, 0x01, 0x36,
+		0x01, 0x23, 0x01, 0x37, 0x01, 0x79, 0x01, 0x33, 0x01, 0x95, 0x00, 0x7f, 0x00, 0x8a, 0x00, 0x8b,
+		0x00, 0x91, 0x00, 0x95, 0x00, 0x9f, 0x00, 0xa0, 0x00, 0xa5, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xb7,
+		0x00, 0xb9, 0x00, 0xbf, 0x00, 0xc0, 0x00, 0xc6, 0x00, 0xd1, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd8,
+		0x00, 0xdf, 0x00, 0xe4, 0x00, 0xef, 0x00, 0xf0, 0x00, 0xf5, 0x00, 0xf6, 0x00, 0xfb, 0x01, 0x34,
+		0x01, 0x6f, 0x01, 0x35, 0x01, 0x59, 0x01, 0x4e, 0x01, 0x2a, 0x01, 0x4f, 0x01, 0x55, 0x01, 0x50,
+		0x01, 0x57, 0x01, 0x70, 0x01, 0x76, 0x01, 0x93, 0x01, 0x74, 0x01, 0x01, 0x01, 0x44, 0x01, 0x62,
+		0x01, 0x43, 0x01, 0x75, 0x01, 0x97, 0x01, 0x78, 0x01, 0x6a, 0x01, 0x16, 0x01, 0x17, 0x01, 0x80,
+		0x01, 0x73, 0x01, 0x24, 0x01, 0x91, 0x01, 0x15, 0x01, 0x02, 0x01, 0x45, 0x01, 0x13, 0x01, 0x12,
+		0x01, 0x14, 0x01, 0x2e, 0x00, 0x07, 0x00, 0x03, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x0a,
+		0x00, 0x0c, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x19, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x32, 0x00, 0x2d,
+		0x00, 0x2f, 0x00, 0x30, 0x00, 0x15, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x50,
+		0x00, 0x4b, 0x01, 0x64, 0x00, 0x4f, 0x00, 0x69, 0x00, 0x65, 0x00, 0x67, 0x00, 0x68, 0x00, 0x77,
+		0x00, 0x53, 0x00, 0xde, 0x00, 0x84, 0x00, 0x80, 0x00, 0x82, 0x00, 0x88, 0x00, 0x83, 0x00, 0x87,
+		0x00, 0x89, 0x00, 0x8e, 0x00, 0x9c, 0x00, 0x96, 0x00, 0x99, 0x00, 0x9a, 0x00, 0xaf, 0x00, 0xaa,
+		0x00, 0xac, 0x00, 0xad, 0x00, 0x92, 0x00, 0xc5, 0x00, 0xcb, 0x00, 0xc7, 0x00, 0xc9, 0x00, 0xcf,
+		0x00, 0xca, 0x01, 0x5a, 0x00, 0xce, 0x00, 0xe9, 0x00, 0xe5, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xf7,
+		0x00, 0xd2, 0x00, 0xf9, 0x00, 0x08, 0x00, 0x85, 0x00, 0x04, 0x00, 0x81, 0x00, 0x09, 0x00, 0x86,
+		0x00, 0x0f, 0x00, 0x8c, 0x00, 0x12, 0x00, 0x8f, 0x00, 0x13, 0x00, 0x90, 0x00, 0x10, 0x00, 0x8d,
+		0x00, 0x16, 0x00, 0x93, 0x00, 0x17, 0x00, 0x94, 0x00, 0x20, 0x00, 0x9d, 0x00, 0x1a, 0x00, 0x97,
+		0x00, 0x1e, 0x00, 0x9b, 0x00, 0x21, 0x00, 0x9e, 0x00, 0x1b, 0x00, 0x98, 0x00, 0x25, 0x00, 0xa2,
+		0x00, 0x24, 0x00, 0xa1, 0x00, 0x27, 0x00, 0xa4, 0x00, 0x26, 0x00, 0xa3, 0x00, 0x2a, 0x00, 0xa7,
+		0x00, 0x29, 0x00, 0xa6, 0x00, 0x35, 0x00, 0xb3, 0x00, 0x33, 0x00, 0xb1, 0x00, 0x2e, 0x00, 0xab,
+		0x00, 0x34, 0x00, 0xb2, 0x00, 0x31, 0x00, 0xa9, 0x00, 0x2c, 0x00, 0xb0, 0x00, 0x37, 0x00, 0xb6,
+		0x00, 0x39, 0x00, 0xb8, 0x00, 0x3b, 0x00, 0xba, 0x00, 0x3d, 0x00, 0xbc, 0x00, 0x3c, 0x00, 0xbb,
+		0x00, 0x3e, 0x00, 0xbd, 0x00, 0x3f, 0x00, 0xbe, 0x00, 0x42, 0x00, 0xc1, 0x00, 0x44, 0x00, 0xc3,
+		0x00, 0x43, 0x00, 0xc2, 0x00, 0x45, 0x00, 0xc4, 0x00, 0x4e, 0x00, 0xcd, 0x00, 0x49, 0x00, 0xc8,
+		0x00, 0x4d, 0x00, 0xcc, 0x00, 0x51, 0x00, 0xd0, 0x00, 0x56, 0x00, 0xd5, 0x00, 0x58, 0x00, 0xd7,
+		0x00, 0x57, 0x00, 0xd6, 0x00, 0x5a, 0x00, 0xd9, 0x00, 0x5d, 0x00, 0xdc, 0x00, 0x5c, 0x00, 0xdb,
+		0x00, 0x5b, 0x00, 0xda, 0x00, 0x62, 0x00, 0xe2, 0x00, 0x61, 0x00, 0xe1, 0x00, 0x60, 0x00, 0xe0,
+		0x00, 0x6e, 0x00, 0xee, 0x00, 0x6b, 0x00, 0xeb, 0x00, 0x66, 0x00, 0xe6, 0x00, 0x6d, 0x00, 0xed,
+		0x00, 0x6a, 0x00, 0xea, 0x00, 0x6c, 0x00, 0xec, 0x00, 0x72, 0x00, 0xf2, 0x00, 0x78, 0x00, 0xf8,
+		0x00, 0x79, 0x00, 0x7c, 0x00, 0xfc, 0x00, 0x7e, 0x00, 0xfe, 0x00, 0x7d, 0x00, 0xfd, 0x00, 0x5e,
+		0x00, 0xdd, 0x00, 0x63, 0x00, 0xe3, 0x01, 0x92, 0x01, 0x83, 0x01, 0x82, 0x01, 0x94, 0x01, 0x99,
+		0x01, 0x98, 0x01, 0x9a, 0x01, 0x96, 0x00, 0x74, 0x00, 0xf4, 0x00, 0x71, 0x00, 0xf1, 0x00, 0x73,
+		0x00, 0xf3, 0x00, 0x7a, 0x00, 0xfa, 0x01, 0x40, 0x01, 0x3f, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x48,
+		0x01, 0x7a, 0x01, 0x7b, 0x01, 0x25, 0x01, 0x6d, 0x01, 0x63, 0x01, 0x61, 0x01, 0x5d, 0x00, 0xff,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xd3, 0xfd, 0x7d, 0x03, 0xa0, 0x06, 0x55, 0x00, 0x03,
+		0x00, 0x0f, 0x00, 0x15, 0x00, 0x19, 0x00, 0x23, 0x00, 0x29, 0x00, 0x35, 0x00, 0x39, 0x00, 0x3d,
+		0x00, 0x48, 0x00, 0x19, 0x40, 0x16, 0x42, 0x3e, 0x3c, 0x3a, 0x37, 0x36, 0x33, 0x2a, 0x27, 0x24,
+		0x1f, 0x1a, 0x18, 0x16, 0x11, 0x10, 0x09, 0x04, 0x02, 0x00, 0x0a, 0x30, 0x2b, 0x01, 0x21, 0x11,
+		0x21, 0x05, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x01, 0x15, 0x21,
+		0x35, 0x23, 0x35, 0x07, 0x23, 0x35, 0x33, 0x07, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x35, 0x33,
+		0x35, 0x07, 0x15, 0x21, 0x15, 0x21, 0x35, 0x03, 0x15, 0x33, 0x35, 0x33, 0x15, 0x23, 0x35, 0x23,
+		0x11, 0x21, 0x11, 0x01, 0x11, 0x21, 0x11, 0x07, 0x23, 0x35, 0x33, 0x05, 0x15, 0x33, 0x07, 0x15,
+		0x21, 0x35, 0x23, 0x37, 0x33, 0x35, 0x03, 0xa0, 0xfd, 0x33, 0x02, 0xcd, 0xfd, 0xdc, 0x94, 0x96,
+		0x01, 0x78, 0x96, 0x96, 0xfe, 0x88, 0x01, 0x78, 0x96, 0x4c, 0x4b, 0x4b, 0x96, 0x96, 0x96, 0xe2,
+		0x96, 0x4b, 0xfe, 0xd3, 0x01, 0x78, 0xe2, 0x4c, 0x4b, 0xe2, 0x4b, 0x01, 0x78, 0xfe, 0x88, 0x01,
+		0x78, 0x4b, 0xe2, 0xe2, 0xfe, 0xd3, 0x9f, 0x9f, 0x01, 0x78, 0xe7, 0x9e, 0x49, 0xfd, 0x7d, 0x08,
+		0xd8, 0x98, 0x4a, 0x54, 0x4b, 0x4b, 0x54, 0x4a, 0xfe, 0xdc, 0xeb, 0x4d, 0x9e, 0x9e, 0x51, 0xdb,
+		0x4b, 0x54, 0x4b, 0x9f, 0x4b, 0x88, 0x96, 0x4d, 0xe3, 0xfe, 0xec, 0x7f, 0x34, 0x6a, 0xb5, 0xff,
+		0x00, 0x01, 0x00, 0xfe, 0x78, 0xff, 0x00, 0x01, 0x00, 0xb5, 0x6a, 0xe9, 0x4b, 0x6a, 0x4b, 0x4b,
+		0x6a, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0xff, 0xf6, 0x04, 0x64, 0x04, 0xb9, 0x00, 0x1e,
+		0x00, 0x22, 0x00, 0x25, 0x40, 0x22, 0x21, 0x01, 0x04, 0x03, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x01,
+		0x00, 0x04, 0x01, 0x62, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c,
+		0x14, 0x2a, 0x13, 0x13, 0x25, 0x05, 0x07, 0x19, 0x2b, 0x24, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23,
+		0x22, 0x26, 0x27, 0x03, 0x21, 0x03, 0x06, 0x06, 0x23, 0x22, 0x27, 0x26, 0x26, 0x35, 0x34, 0x37,
+		0x01, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x01, 0x01, 0x21, 0x03, 0x23, 0x04, 0x64, 0x1b, 0x1e,
+		0x1a, 0x0e, 0x14, 0x1a, 0x08, 0x6d, 0xfe, 0x08, 0x6d, 0x08, 0x1a, 0x14, 0x0e, 0x1a, 0x1e, 0x1b,
+		0x06, 0x01, 0x8a, 0x0d, 0x34, 0x2f, 0x2f, 0x34, 0x0d, 0x01, 0x8a, 0xfd, 0x3e, 0x01, 0x8f, 0xc5,
+		0x04, 0x42, 0x0d, 0x13, 0x1a, 0x0a, 0x08, 0x16, 0x18, 0x01, 0x26, 0xfe, 0xda, 0x18, 0x16, 0x08,
+		0x0a, 0x1a, 0x13, 0x0d, 0x12, 0x04, 0x24, 0x23, 0x1e, 0x1e, 0x23, 0xfb, 0xdc, 0x01, 0x86, 0x02,
+		0x39, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0xf6, 0x04, 0x64, 0x06, 0x95, 0x00, 0x27,
+		0x01, 0x80, 0x00, 0x1c, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0xf6, 0x04, 0x64,
+		0x06, 0x6a, 0x00, 0x27, 0x01, 0x82, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00,
+		0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x64,
+		0xff, 0xf6, 0x04, 0x64, 0x06, 0x82, 0x00, 0x27, 0x01, 0x92, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0x64, 0xff, 0xf6, 0x04, 0x64, 0x06, 0x61, 0x00, 0x22, 0x00, 0x02, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x93, 0xff, 0xfe, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0xf6, 0x04, 0x64, 0x06, 0x95, 0x00, 0x27,
+		0x01, 0x95, 0xff, 0xe4, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0xf6, 0x04, 0x64,
+		0x05, 0xf0, 0x00, 0x27, 0x01, 0x97, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00,
+		0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x64,
+		0xfe, 0x28, 0x04, 0x8c, 0x04, 0xb9, 0x00, 0x34, 0x00, 0x38, 0x00, 0x6d, 0xb5, 0x37, 0x01, 0x07,
+		0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x23, 0x00, 0x01, 0x02, 0x03, 0x02, 0x01,
+		0x03, 0x70, 0x00, 0x07, 0x00, 0x02, 0x01, 0x07, 0x02, 0x62, 0x06, 0x01, 0x05, 0x00, 0x00, 0x05,
+		0x00, 0x60, 0x00, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x0f, 0x03, 0x4c, 0x1b, 0x40, 0x2a,
+		0x00, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x70, 0x00, 0x06, 0x03, 0x05, 0x03, 0x06, 0x05, 0x70,
+		0x00, 0x07, 0x00, 0x02, 0x01, 0x07, 0x02, 0x62, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x60, 0x00,
+		0x04, 0x04, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x0f, 0x03, 0x4c, 0x59, 0x40, 0x0b, 0x12, 0x31, 0x2d,
+		0x2a, 0x13, 0x12, 0x15, 0x25, 0x08, 0x07, 0x1c, 0x2b, 0x00, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23,
+		0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x33, 0x27, 0x03, 0x21, 0x03, 0x06, 0x06, 0x23, 0x22, 0x27,
+		0x26, 0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x01, 0x16, 0x15, 0x14,
+		0x07, 0x33, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x01, 0x21,
+		0x03, 0x23, 0x04, 0x8c, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b, 0x61, 0x5b, 0x16, 0x03, 0x6d, 0xfe,
+		0x08, 0x6d, 0x08, 0x1a, 0x14, 0x0e, 0x1a, 0x1e, 0x1b, 0x06, 0x01, 0x8a, 0x0d, 0x34, 0x2f, 0x2f,
+		0x34, 0x0d, 0x01, 0x8a, 0x07, 0x08, 0x02, 0x6a, 0x5b, 0x2a, 0x23, 0x34, 0x3d, 0x08, 0x03, 0x1e,
+		0x09, 0xfd, 0x12, 0x01, 0x8f, 0xc5, 0x04, 0xfe, 0x7e, 0x07, 0x16, 0x19, 0x06, 0x1a, 0x68, 0x57,
+		0x51, 0x96, 0x4e, 0x08, 0x01, 0x26, 0xfe, 0xda, 0x18, 0x16, 0x08, 0x0a, 0x1a, 0x13, 0x0d, 0x12,
+		0x04, 0x24, 0x23, 0x1e, 0x1e, 0x23, 0xfb, 0xdc, 0x15, 0x0a, 0x0e, 0x0b, 0x5e, 0x86, 0x3c, 0x23,
+		0x26, 0x11, 0x02, 0x36, 0x03, 0x4a, 0x02, 0x39, 0xff, 0xff, 0x00, 0x64, 0xff, 0xf6, 0x04, 0x64,
+		0x07, 0x05, 0x00, 0x27, 0x01, 0x99, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00,
+		0x00, 0x08, 0xb1, 0x00, 0x02, 0xb0, 0xf0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64,
+		0xff, 0xf6, 0x04, 0x64, 0x06, 0x3b, 0x00, 0x27, 0x01, 0x9a, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0x00, 0x02, 0x00, 0x14, 0xff, 0xf6, 0x04, 0x92, 0x04, 0xa3, 0x00, 0x30, 0x00, 0x34, 0x00, 0x7c,
+		0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x29, 0x00, 0x05, 0x00, 0x06, 0x09, 0x05, 0x06, 0x61, 0x0b,
+		0x01, 0x09, 0x00, 0x01, 0x07, 0x09, 0x01, 0x61, 0x08, 0x01, 0x04, 0x04, 0x03, 0x59, 0x00, 0x03,
+		0x03, 0x0e, 0x4b, 0x0a, 0x01, 0x07, 0x07, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c,
+		0x1b, 0x40, 0x2d, 0x00, 0x05, 0x00, 0x06, 0x09, 0x05, 0x06, 0x61, 0x0b, 0x01, 0x09, 0x00, 0x01,
+		0x07, 0x09, 0x01, 0x61, 0x08, 0x01, 0x04, 0x04, 0x03, 0x59, 0x00, 0x03, 0x03, 0x0e, 0x4b, 0x0a,
+		0x01, 0x07, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x4b, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x4c,
+		0x59, 0x40, 0x18, 0x31, 0x31, 0x00, 0x00, 0x31, 0x34, 0x31, 0x34, 0x33, 0x32, 0x00, 0x30, 0x00,
+		0x2f, 0x24, 0x21, 0x24, 0x5a, 0x13, 0x13, 0x44, 0x0c, 0x07, 0x1b, 0x2b, 0x24, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x23, 0x22, 0x26, 0x35, 0x11, 0x21, 0x03, 0x06, 0x06, 0x23, 0x22, 0x27, 0x26,
+		0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x36, 0x3b, 0x02, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+		0x21, 0x11, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x01, 0x11, 0x23, 0x03,
+		0x04, 0x75, 0x1d, 0x1d, 0x22, 0xfe, 0x54, 0x29, 0x22, 0x1d, 0xfe, 0xee, 0x82, 0x09, 0x1a, 0x14,
+		0x0e, 0x1a, 0x1d, 0x1b, 0x07, 0x01, 0x93, 0x0e, 0x29, 0x22, 0x69, 0x65, 0x01, 0x6a, 0x22, 0x1d,
+		0x1d, 0x22, 0xfe, 0x96, 0x01, 0x3d, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xc3, 0x01, 0x7e, 0xfd, 0xec,
+		0x19, 0xc3, 0x90, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x01, 0x2e, 0xfe, 0xb2, 0x18, 0x16, 0x08,
+		0x09, 0x1a, 0x13, 0x0f, 0x11, 0x04, 0x0b, 0x25, 0x1f, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x99, 0x21,
+		0x27, 0x27, 0x21, 0xfe, 0x74, 0x01, 0x72, 0x02, 0x11, 0xfd, 0xef, 0x00, 0x00, 0x03, 0x00, 0xcd,
+		0x00, 0x00, 0x04, 0x32, 0x04, 0xa3, 0x00, 0x16, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x43, 0x40, 0x40,
+		0x06, 0x01, 0x05, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x08, 0x01, 0x05, 0x04, 0x02, 0x05, 0x61, 0x07,
+		0x01, 0x03, 0x03, 0x01, 0x59, 0x06, 0x01, 0x01, 0x01, 0x0e, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59,
+		0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1f, 0x1f, 0x17, 0x17, 0x00, 0x00, 0x1f, 0x27, 0x1f, 0x26,
+		0x22, 0x20, 0x17, 0x1e, 0x17, 0x1d, 0x1a, 0x18, 0x00, 0x16, 0x00, 0x14, 0x3c, 0x09, 0x07, 0x15,
+		0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21,
+		0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x21, 0x05, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x23,
+		0x01, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x02, 0xf9, 0xa4, 0x53, 0x46, 0x40, 0x60,
+		0x68, 0x5a, 0xac, 0x7a, 0xfe, 0x5a, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x78, 0xfe, 0xdf, 0x01, 0x0b,
+		0x73, 0x75, 0xe8, 0xfe, 0xf5, 0x01, 0x3b, 0x77, 0x83, 0x81, 0x7e, 0x04, 0xa3, 0x53, 0x94, 0x62,
+		0x4f, 0x77, 0x25, 0x24, 0x91, 0x6a, 0x69, 0x97, 0x50, 0x1f, 0x25, 0x04, 0x1b, 0x25, 0x1f, 0x90,
+		0xfe, 0x90, 0x5f, 0x58, 0xb9, 0xfe, 0x00, 0xfe, 0x7d, 0x61, 0x5f, 0x62, 0x61, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x96, 0xff, 0xea, 0x04, 0x32, 0x04, 0xb9, 0x00, 0x29, 0x00, 0x3c, 0x40, 0x39,
+		0x04, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x03, 0x70, 0x00, 0x03,
+		0x02, 0x01, 0x03, 0x02, 0x6e, 0x00, 0x01, 0x01, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x16, 0x4b,
+		0x00, 0x02, 0x02, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x17, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x29, 0x00,
+		0x28, 0x27, 0x22, 0x26, 0x23, 0x17, 0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x17, 0x16, 0x15, 0x14,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x02, 0x35,
+		0x34, 0x12, 0x36, 0x33, 0x02, 0xfc, 0xb6, 0x5b, 0x25, 0x0d, 0x15, 0x20, 0x0e, 0x14, 0x97, 0x9f,
+		0x6c, 0xa3, 0x59, 0x59, 0xa3, 0x6c, 0x9f, 0x97, 0x14, 0x0e, 0x20, 0x15, 0x0d, 0x25, 0x5b, 0xb6,
+		0x64, 0x99, 0xe9, 0x80, 0x80, 0xe9, 0x99, 0x04, 0xb9, 0x31, 0x34, 0x16, 0x22, 0x13, 0x1d, 0x2c,
+		0x0b, 0x5a, 0x72, 0xd3, 0x8e, 0x8e, 0xd4, 0x72, 0x5a, 0x0b, 0x2c, 0x1d, 0x13, 0x22, 0x16, 0x34,
+		0x31, 0x99, 0x01, 0x18, 0xb7, 0xb7, 0x01, 0x17, 0x99, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x96,
+		0xff, 0xea, 0x04, 0x32, 0x06, 0x95, 0x00, 0x27, 0x01, 0x80, 0x00, 0x1c, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0x96, 0xff, 0xea, 0x04, 0x32, 0x06, 0x84, 0x00, 0x22, 0x00, 0x0e, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x83, 0x00, 0x32, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x96, 0xfe, 0x28, 0x04, 0x32, 0x04, 0xb9, 0x00, 0x48,
+		0x00, 0x9e, 0x40, 0x0f, 0x36, 0x01, 0x07, 0x08, 0x29, 0x09, 0x02, 0x01, 0x09, 0x15, 0x01, 0x02,
+		0x04, 0x03, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x38, 0x00, 0x07, 0x08, 0x00, 0x08, 0x07,
+		0x00, 0x70, 0x00, 0x00, 0x09, 0x08, 0x00, 0x09, 0x6e, 0x00, 0x01, 0x09, 0x05, 0x04, 0x01, 0x68,
+		0x00, 0x03, 0x05, 0x04, 0x05, 0x03, 0x04, 0x70, 0x00, 0x09, 0x00, 0x05, 0x03, 0x09, 0x05, 0x63,
+		0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x00, 0x08, 0x08, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x16,
+		0x08, 0x4c, 0x1b, 0x40, 0x39, 0x00, 0x07, 0x08, 0x00, 0x08, 0x07, 0x00, 0x70, 0x00, 0x00, 0x09,
+		0x08, 0x00, 0x09, 0x6e, 0x00, 0x01, 0x09, 0x05, 0x09, 0x01, 0x05, 0x70, 0x00, 0x03, 0x05, 0x04,
+		0x05, 0x03, 0x04, 0x70, 0x00, 0x09, 0x00, 0x05, 0x03, 0x09, 0x05, 0x63, 0x00, 0x04, 0x00, 0x02,
+		0x04, 0x02, 0x60, 0x00, 0x08, 0x08, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x16, 0x08, 0x4c, 0x59, 0x40,
+		0x0e, 0x47, 0x45, 0x23, 0x17, 0x2b, 0x24, 0x24, 0x17, 0x24, 0x18, 0x20, 0x0a, 0x07, 0x1d, 0x2b,
+		0x24, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x15, 0x36, 0x16, 0x15, 0x14, 0x06,
+		0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32,
+		0x36, 0x35, 0x34, 0x26, 0x23, 0x07, 0x22, 0x26, 0x35, 0x35, 0x26, 0x26, 0x02, 0x35, 0x34, 0x12,
+		0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22,
+		0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x37, 0x03, 0xe2, 0x0e, 0x20, 0x15, 0x0d, 0x25,
+		0x9c, 0xa8, 0x65, 0x66, 0x7c, 0x79, 0x44, 0x80, 0x33, 0x17, 0x08, 0x11, 0x1d, 0x08, 0x05, 0x2b,
+		0x67, 0x2f, 0x33, 0x3a, 0x36, 0x3e, 0x27, 0x0f, 0x13, 0x82, 0xc3, 0x6a, 0x80, 0xe9, 0x99, 0x64,
+		0xb6, 0x5b, 0x25, 0x0d, 0x15, 0x20, 0x0e, 0x14, 0x97, 0x9f, 0x6c, 0xa3, 0x59, 0x59, 0xa3, 0x6c,
+		0x9f, 0x97, 0xe3, 0x2c, 0x1d, 0x13, 0x22, 0x16, 0x58, 0x0c, 0x5c, 0x01, 0x5e, 0x4b, 0x57, 0x68,
+		0x18, 0x18, 0x0a, 0x19, 0x0e, 0x15, 0x2d, 0x02, 0x10, 0x16, 0x21, 0x1f, 0x21, 0x20, 0x01, 0x15,
+		0x17, 0xa1, 0x14, 0xa2, 0x01, 0x06, 0xa6, 0xb7, 0x01, 0x17, 0x99, 0x31, 0x34, 0x16, 0x22, 0x13,
+		0x1d, 0x2c, 0x0b, 0x5a, 0x72, 0xd3, 0x8e, 0x8e, 0xd4, 0x72, 0x5a, 0x00, 0xff, 0xff, 0x00, 0x96,
+		0xff, 0xea, 0x04, 0x32, 0x06, 0x82, 0x00, 0x27, 0x01, 0x92, 0x00, 0x3c, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0x96, 0xff, 0xea, 0x04, 0x32, 0x06, 0x61, 0x00, 0x27, 0x01, 0x94, 0x00, 0x32,
+		0x01, 0x0e, 0x01, 0x02, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0xaf, 0x00, 0x00, 0x04, 0x4c, 0x04, 0xa3, 0x00, 0x10,
+		0x00, 0x1b, 0x00, 0x2c, 0x40, 0x29, 0x05, 0x01, 0x03, 0x03, 0x01, 0x59, 0x04, 0x01, 0x01, 0x01,
+		0x0e, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x11, 0x11, 0x00,
+		0x00, 0x11, 0x1b, 0x11, 0x1a, 0x14, 0x12, 0x00, 0x10, 0x00, 0x0e, 0x36, 0x06, 0x07, 0x15, 0x2b,
+		0x00, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33,
+		0x21, 0x07, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x02, 0xdb, 0xee, 0x83,
+		0x83, 0xee, 0x9d, 0xfe, 0xb0, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x50, 0xf9, 0xe6, 0x78, 0xaf, 0x60,
+		0x60, 0xaf, 0x78, 0x04, 0xa3, 0x8f, 0xfe, 0xf3, 0xb6, 0xb6, 0xfe, 0xf4, 0x8f, 0x1f, 0x25, 0x04,
+		0x1b, 0x25, 0x1f, 0x90, 0xfc, 0x7d, 0x65, 0xca, 0x92, 0x92, 0xca, 0x66, 0x00, 0x02, 0x00, 0x32,
+		0x00, 0x00, 0x04, 0x60, 0x04, 0xa3, 0x00, 0x19, 0x00, 0x2d, 0x00, 0x3c, 0x40, 0x39, 0x05, 0x01,
+		0x02, 0x06, 0x01, 0x01, 0x07, 0x02, 0x01, 0x63, 0x00, 0x04, 0x04, 0x03, 0x59, 0x08, 0x01, 0x03,
+		0x03, 0x0e, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1a,
+		0x1a, 0x00, 0x00, 0x1a, 0x2d, 0x1a, 0x2c, 0x2b, 0x29, 0x25, 0x23, 0x22, 0x20, 0x00, 0x19, 0x00,
+		0x17, 0x24, 0x23, 0x36, 0x0a, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x23,
+		0x21, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11, 0x34, 0x36,
+		0x33, 0x21, 0x12, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11, 0x33, 0x32, 0x16, 0x15,
+		0x14, 0x06, 0x23, 0x23, 0x11, 0x33, 0x02, 0xef, 0xee, 0x83, 0x83, 0xee, 0x9d, 0xfe, 0xce, 0x22,
+		0x1d, 0x70, 0x22, 0x1d, 0x1d, 0x22, 0x70, 0x1d, 0x22, 0x01, 0x32, 0x65, 0xaf, 0x60, 0x60, 0xaf,
+		0x78, 0xc8, 0xdc, 0x22, 0x1d, 0x1d, 0x22, 0xdc, 0xc8, 0x04, 0xa3, 0x8f, 0xfe, 0xf3, 0xb6, 0xb6,
+		0xfe, 0xf4, 0x8f, 0x1f, 0x25, 0x01, 0xd8, 0x21, 0x27, 0x27, 0x21, 0x01, 0xb3, 0x25, 0x1f, 0xfb,
+		0xed, 0x65, 0xca, 0x92, 0x92, 0xca, 0x66, 0xfe, 0x99, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x74, 0x00,
+		0xff, 0xff, 0x00, 0xaf, 0x00, 0x00, 0x04, 0x4c, 0x06, 0x84, 0x00, 0x22, 0x00, 0x14, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x83, 0xff, 0xe2, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0x00, 0x00, 0x04, 0x4c, 0x05, 0xf0, 0x00, 0x22,
+		0x00, 0x14, 0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0xff, 0xe2, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x10,
+		0x04, 0xa3, 0x00, 0x22, 0x00, 0x2f, 0x40, 0x2c, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x61,
+		0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x01, 0x0e, 0x4b, 0x06, 0x01, 0x05, 0x05, 0x00, 0x59,
+		0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x21, 0x24, 0x21, 0x24, 0x45,
+		0x44, 0x07, 0x07, 0x19, 0x2b, 0x24, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x23, 0x22, 0x26, 0x35,
+		0x11, 0x34, 0x36, 0x33, 0x33, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x32,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x03, 0xf3, 0x1d, 0x1d, 0x22, 0xfd, 0x78, 0x29,
+		0x22, 0x1d, 0x1d, 0x22, 0x57, 0x02, 0x46, 0x22, 0x1d, 0x1d, 0x22, 0xfd, 0xba, 0x01, 0xc9, 0x22,
+		0x1d, 0x1d, 0x22, 0xfe, 0x37, 0x02, 0x5a, 0x90, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x04, 0x1b,
+		0x25, 0x1f, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x99, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x74, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x10, 0x06, 0x95, 0x00, 0x22, 0x00, 0x18, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x80, 0xff, 0xe0, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x10, 0x06, 0x6a, 0x00, 0x22,
+		0x00, 0x18, 0x00, 0x00, 0x01, 0x07, 0x01, 0x82, 0x00, 0x0a, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x10,
+		0x06, 0x84, 0x00, 0x22, 0x00, 0x18, 0x00, 0x00, 0x01, 0x07, 0x01, 0x83, 0x00, 0x0a, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xe1,
+		0x00, 0x00, 0x04, 0x10, 0x06, 0x82, 0x00, 0x22, 0x00, 0x18, 0x00, 0x00, 0x01, 0x07, 0x01, 0x92,
+		0x00, 0x1e, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x10, 0x06, 0x61, 0x00, 0x22, 0x00, 0x18, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x93, 0x00, 0x14, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x10, 0x06, 0x61, 0x00, 0x27,
+		0x01, 0x94, 0x00, 0x14, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x18, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x10,
+		0x06, 0x95, 0x00, 0x22, 0x00, 0x18, 0x00, 0x00, 0x01, 0x07, 0x01, 0x95, 0x00, 0x20, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xe1,
+		0x00, 0x00, 0x04, 0x10, 0x05, 0xf0, 0x00, 0x27, 0x01, 0x97, 0x00, 0x0a, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x18, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0x00, 0x01, 0x00, 0xe1, 0xfe, 0x28, 0x04, 0x19, 0x04, 0xa3, 0x00, 0x3c, 0x00, 0x6f, 0x4b, 0xb0,
+		0x1b, 0x50, 0x58, 0x40, 0x26, 0x00, 0x04, 0x00, 0x05, 0x06, 0x04, 0x05, 0x61, 0x09, 0x01, 0x08,
+		0x00, 0x00, 0x08, 0x00, 0x5f, 0x00, 0x03, 0x03, 0x02, 0x59, 0x00, 0x02, 0x02, 0x0e, 0x4b, 0x00,
+		0x06, 0x06, 0x01, 0x5b, 0x07, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x4c, 0x1b, 0x40, 0x2d, 0x00, 0x09,
+		0x01, 0x08, 0x01, 0x09, 0x08, 0x70, 0x00, 0x04, 0x00, 0x05, 0x06, 0x04, 0x05, 0x61, 0x00, 0x08,
+		0x00, 0x00, 0x08, 0x00, 0x5f, 0x00, 0x03, 0x03, 0x02, 0x59, 0x00, 0x02, 0x02, 0x0e, 0x4b, 0x00,
+		0x06, 0x06, 0x01, 0x5b, 0x07, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x4c, 0x59, 0x40, 0x0e, 0x3b, 0x38,
+		0x26, 0x14, 0x21, 0x24, 0x21, 0x24, 0x45, 0x35, 0x25, 0x0a, 0x07, 0x1d, 0x2b, 0x00, 0x15, 0x14,
+		0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x21, 0x23, 0x22, 0x26, 0x35, 0x11,
+		0x34, 0x36, 0x33, 0x33, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x32, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x06, 0x06,
+		0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x04, 0x19, 0x11, 0x11, 0x4b, 0x59,
+		0x5d, 0x6b, 0x50, 0x4c, 0xfe, 0x22, 0x29, 0x22, 0x1d, 0x1d, 0x22, 0x57, 0x02, 0x46, 0x22, 0x1d,
+		0x1d, 0x22, 0xfd, 0xba, 0x01, 0xc9, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0x37, 0x02, 0x5a, 0x22, 0x1d,
+		0x1d, 0x22, 0x04, 0x59, 0x4d, 0x2a, 0x23, 0x34, 0x3d, 0x08, 0x03, 0x1e, 0x09, 0xfe, 0x7e, 0x07,
+		0x16, 0x19, 0x06, 0x1a, 0x68, 0x57, 0x49, 0x8a, 0x46, 0x1f, 0x25, 0x04, 0x1b, 0x25, 0x1f, 0x21,
+		0x27, 0x27, 0x21, 0xfe, 0x99, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x74, 0x21, 0x27, 0x27, 0x21, 0x53,
+		0x7a, 0x37, 0x23, 0x26, 0x11, 0x02, 0x36, 0x00, 0x00, 0x01, 0x00, 0xf5, 0xff, 0xf6, 0x04, 0x10,
+		0x04, 0xa3, 0x00, 0x1d, 0x00, 0x29, 0x40, 0x26, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x61,
+		0x00, 0x00, 0x00, 0x04, 0x59, 0x05, 0x01, 0x04, 0x04, 0x0e, 0x4b, 0x00, 0x03, 0x03, 0x0f, 0x03,
+		0x4c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1a, 0x33, 0x24, 0x21, 0x24, 0x06, 0x07, 0x18, 0x2b, 0x00,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11,
+		0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x21, 0x03, 0xf3, 0x1d,
+		0x1d, 0x22, 0xfd, 0xba, 0x01, 0xd3, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0x2d, 0x21, 0x29, 0x02, 0x29,
+		0x21, 0x1f, 0x20, 0x57, 0x02, 0x46, 0x04, 0xa3, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x71, 0x21, 0x27,
+		0x27, 0x21, 0xfe, 0x43, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x28, 0x25, 0x1f, 0x00, 0x01, 0x00, 0x6e,
+		0xff, 0xea, 0x04, 0x3b, 0x04, 0xb9, 0x00, 0x31, 0x00, 0x43, 0x40, 0x40, 0x27, 0x01, 0x04, 0x05,
+		0x01, 0x4a, 0x15, 0x01, 0x03, 0x01, 0x49, 0x00, 0x02, 0x03, 0x06, 0x03, 0x02, 0x06, 0x70, 0x07,
+		0x01, 0x06, 0x00, 0x05, 0x04, 0x06, 0x05, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01,
+		0x16, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00,
+		0x31, 0x00, 0x2e, 0x22, 0x26, 0x23, 0x17, 0x26, 0x27, 0x08, 0x07, 0x1a, 0x2b, 0x00, 0x16, 0x15,
+		0x11, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x33, 0x32, 0x16,
+		0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+		0x16, 0x16, 0x33, 0x32, 0x37, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x33, 0x04,
+		0x1e, 0x1d, 0x24, 0x52, 0xd6, 0x75, 0x9c, 0xee, 0x82, 0x89, 0xf3, 0x9a, 0x67, 0xb3, 0x59, 0x26,
+		0x0b, 0x14, 0x21, 0x10, 0x12, 0x8e, 0xa9, 0x6d, 0xac, 0x63, 0x5c, 0xa8, 0x6e, 0xaf, 0x7c, 0xfe,
+		0xf5, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x46, 0x1c, 0x02, 0x52, 0x1f, 0x25, 0xfe, 0x81, 0x31, 0x14,
+		0x2f, 0x31, 0x99, 0x01, 0x18, 0xb7, 0xb6, 0x01, 0x17, 0x9a, 0x2b, 0x30, 0x15, 0x24, 0x13, 0x1b,
+		0x2d, 0x0a, 0x51, 0x72, 0xd4, 0x8d, 0x8e, 0xd4, 0x72, 0x39, 0x01, 0x0b, 0x21, 0x27, 0x27, 0x21,
+		0xff, 0xff, 0x00, 0x6e, 0xff, 0xea, 0x04, 0x3b, 0x06, 0x6a, 0x00, 0x22, 0x00, 0x23, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x82, 0x00, 0x1e, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xea, 0x04, 0x3b, 0x06, 0x82, 0x00, 0x27,
+		0x01, 0x92, 0x00, 0x28, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x23, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xfd, 0xf2, 0x04, 0x3b,
+		0x04, 0xb9, 0x00, 0x22, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xdc, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0x6e, 0xff, 0xea, 0x04, 0x3b, 0x06, 0x61, 0x00, 0x27, 0x01, 0x94, 0x00, 0x1e,
+		0x01, 0x0e, 0x01, 0x02, 0x00, 0x23, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xaf, 0xff, 0xf6, 0x04, 0x1d, 0x04, 0xad, 0x00, 0x23,
+		0x00, 0x27, 0x40, 0x24, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x61, 0x06, 0x05, 0x02, 0x03,
+		0x03, 0x0e, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x21,
+		0x13, 0x35, 0x33, 0x13, 0x35, 0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23,
+		0x23, 0x22, 0x26, 0x35, 0x11, 0x21, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34,
+		0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x21, 0x11, 0x34, 0x36, 0x33, 0x33, 0x03, 0xfc, 0x21,
+		0x21, 0x29, 0x02, 0x29, 0x21, 0xfd, 0xbe, 0x21, 0x29, 0x02, 0x29, 0x21, 0x21, 0x29, 0x02, 0x29,
+		0x21, 0x02, 0x42, 0x21, 0x29, 0x02, 0x04, 0xad, 0x1e, 0x23, 0xfb, 0xcb, 0x23, 0x1e, 0x1e, 0x23,
+		0x01, 0xe5, 0xfe, 0x1b, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x35, 0x23, 0x1e, 0x1e, 0x23, 0xfe, 0x40,
+		0x01, 0xc0, 0x23, 0x1e, 0x00, 0x02, 0x00, 0x1e, 0xff, 0xf6, 0x04, 0xae, 0x04, 0xad, 0x00, 0x35,
+		0x00, 0x39, 0x00, 0x6a, 0x4b, 0xb0, 0x24, 0x50, 0x58, 0x40, 0x24, 0x00, 0x0b, 0x00, 0x02, 0x01,
+		0x0b, 0x02, 0x61, 0x08, 0x01, 0x06, 0x06, 0x0e, 0x4b, 0x0a, 0x04, 0x02, 0x00, 0x00, 0x05, 0x5b,
+		0x0c, 0x09, 0x07, 0x03, 0x05, 0x05, 0x19, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x4c, 0x1b,
+		0x40, 0x22, 0x0c, 0x09, 0x07, 0x03, 0x05, 0x0a, 0x04, 0x02, 0x00, 0x0b, 0x05, 0x00, 0x63, 0x00,
+		0x0b, 0x00, 0x02, 0x01, 0x0b, 0x02, 0x61, 0x08, 0x01, 0x06, 0x06, 0x0e, 0x4b, 0x03, 0x01, 0x01,
+		0x01, 0x0f, 0x01, 0x4c, 0x59, 0x40, 0x16, 0x00, 0x00, 0x39, 0x38, 0x37, 0x36, 0x00, 0x35, 0x00,
+		0x34, 0x33, 0x13, 0x33, 0x24, 0x23, 0x33, 0x13, 0x33, 0x24, 0x0d, 0x07, 0x1d, 0x2b, 0x00, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x23, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x21, 0x11,
+		0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33,
+		0x35, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x15, 0x21, 0x35, 0x34, 0x36, 0x33, 0x33, 0x32,
+		0x16, 0x15, 0x15, 0x33, 0x07, 0x21, 0x15, 0x21, 0x04, 0x91, 0x1d, 0x1d, 0x22, 0x52, 0x21, 0x29,
+		0x02, 0x29, 0x21, 0xfd, 0xbe, 0x21, 0x29, 0x02, 0x29, 0x21, 0x52, 0x22, 0x1d, 0x1d, 0x22, 0x52,
+		0x21, 0x29, 0x02, 0x29, 0x21, 0x02, 0x42, 0x21, 0x29, 0x02, 0x29, 0x21, 0x52, 0xe8, 0xfd, 0xbe,
+		0x02, 0x42, 0x03, 0xce, 0x21, 0x27, 0x27, 0x21, 0xfc, 0xf9, 0x23, 0x1e, 0x1e, 0x23, 0x01, 0xe5,
+		0xfe, 0x1b, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x07, 0x21, 0x27, 0x27, 0x21, 0x9e, 0x23, 0x1e, 0x1e,
+		0x23, 0x9e, 0x9e, 0x23, 0x1e, 0x1e, 0x23, 0x9e, 0x90, 0x92, 0x00, 0x00, 0xff, 0xff, 0x00, 0xaf,
+		0xff, 0xf6, 0x04, 0x1d, 0x06, 0x82, 0x00, 0x22, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x01, 0x92,
+		0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0x00, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x04, 0x04, 0xa3, 0x00, 0x1f, 0x00, 0x29, 0x40, 0x26,
+		0x04, 0x01, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x0e, 0x4b, 0x06, 0x05, 0x02, 0x01, 0x01,
+		0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x24, 0x34,
+		0x21, 0x24, 0x34, 0x07, 0x07, 0x19, 0x2b, 0x24, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26,
+		0x35, 0x34, 0x36, 0x33, 0x21, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x32, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x03, 0xe7, 0x1d, 0x1d, 0x22, 0xfd, 0x42, 0x22, 0x1d,
+		0x1d, 0x22, 0x01, 0x14, 0xff, 0x00, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0x96, 0x22, 0x1d, 0x1d, 0x22,
+		0xff, 0x00, 0x01, 0x14, 0x90, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x03, 0x83, 0x21,
+		0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0xfc, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xb3,
+		0xff, 0xea, 0x04, 0x1e, 0x04, 0xad, 0x00, 0x0f, 0x00, 0x2c, 0x00, 0x67, 0xb5, 0x1b, 0x01, 0x00,
+		0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x03, 0x01, 0x04, 0x01, 0x03,
+		0x04, 0x70, 0x07, 0x05, 0x06, 0x03, 0x01, 0x01, 0x0e, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x02,
+		0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x03, 0x01, 0x04, 0x01, 0x03, 0x04,
+		0x70, 0x07, 0x05, 0x06, 0x03, 0x01, 0x01, 0x0e, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x4b, 0x00, 0x04,
+		0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0x40, 0x16, 0x10, 0x10, 0x00, 0x00,
+		0x10, 0x2c, 0x10, 0x2a, 0x25, 0x23, 0x1f, 0x1e, 0x17, 0x15, 0x00, 0x0f, 0x00, 0x0d, 0x35, 0x08,
+		0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34,
+		0x36, 0x33, 0x33, 0x20, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33,
+		0x01, 0x28, 0x21, 0x21, 0x29, 0x02, 0x29, 0x21, 0x21, 0x29, 0x02, 0x02, 0xfe, 0x21, 0x8d, 0x84,
+		0x37, 0x80, 0x30, 0x27, 0x0b, 0x15, 0x24, 0x0c, 0x10, 0x27, 0x5c, 0x2c, 0x3f, 0x3b, 0x21, 0x29,
+		0x02, 0x04, 0xad, 0x1e, 0x23, 0xfb, 0xcb, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x35, 0x23, 0x1e, 0x1e,
+		0x23, 0xfc, 0x91, 0x86, 0x8d, 0x1a, 0x18, 0x14, 0x21, 0x11, 0x1b, 0x31, 0x07, 0x13, 0x16, 0x4a,
+		0x53, 0x03, 0x51, 0x23, 0x1e, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x04,
+		0x06, 0x95, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x80, 0x00, 0x00, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc8,
+		0x00, 0x00, 0x04, 0x04, 0x06, 0x6a, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x82,
+		0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x04, 0x06, 0x82, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x92, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x04, 0x06, 0x61, 0x00, 0x22,
+		0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x93, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x02, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x04,
+		0x06, 0x61, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x94, 0x00, 0x00, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc8,
+		0x00, 0x00, 0x04, 0x04, 0x06, 0x95, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x95,
+		0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x04, 0x05, 0xf0, 0x00, 0x22, 0x00, 0x2b, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x97, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xc8, 0xfe, 0x28, 0x04, 0x04, 0x04, 0xa3, 0x00, 0x39,
+		0x00, 0x69, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x21, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x03,
+		0x5f, 0x08, 0x01, 0x06, 0x06, 0x07, 0x59, 0x00, 0x07, 0x07, 0x0e, 0x4b, 0x0a, 0x09, 0x02, 0x05,
+		0x05, 0x00, 0x59, 0x04, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x28, 0x00, 0x02, 0x00,
+		0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0x01, 0x00, 0x03, 0x01, 0x03, 0x5f, 0x08, 0x01, 0x06, 0x06,
+		0x07, 0x59, 0x00, 0x07, 0x07, 0x0e, 0x4b, 0x0a, 0x09, 0x02, 0x05, 0x05, 0x00, 0x59, 0x04, 0x01,
+		0x00, 0x00, 0x0f, 0x00, 0x4c, 0x59, 0x40, 0x12, 0x00, 0x00, 0x00, 0x39, 0x00, 0x38, 0x24, 0x34,
+		0x21, 0x24, 0x25, 0x27, 0x31, 0x25, 0x24, 0x0b, 0x07, 0x1d, 0x2b, 0x24, 0x16, 0x15, 0x14, 0x06,
+		0x23, 0x21, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15,
+		0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x21, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x33, 0x21, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x32, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x11, 0x21, 0x03, 0xe7, 0x1d, 0x1d, 0x22, 0xfe, 0xf0, 0x59, 0x4d, 0x2a, 0x23,
+		0x34, 0x3d, 0x08, 0x03, 0x1e, 0x09, 0x02, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b, 0x50, 0x4c, 0xfe,
+		0xf8, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x14, 0xff, 0x00, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0x96, 0x22,
+		0x1d, 0x1d, 0x22, 0xff, 0x00, 0x01, 0x14, 0x90, 0x21, 0x27, 0x27, 0x21, 0x53, 0x7a, 0x37, 0x23,
+		0x26, 0x11, 0x02, 0x36, 0x12, 0x07, 0x16, 0x19, 0x06, 0x1a, 0x68, 0x57, 0x49, 0x8a, 0x46, 0x21,
+		0x27, 0x27, 0x21, 0x03, 0x83, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0xfc, 0x7d, 0x00,
+		0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x04, 0x06, 0x3b, 0x00, 0x27, 0x01, 0x9a, 0x00, 0x00,
+		0x01, 0x0e, 0x01, 0x02, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xb8, 0xff, 0xea, 0x03, 0xba, 0x04, 0xa3, 0x00, 0x20,
+		0x00, 0x2e, 0x40, 0x2b, 0x00, 0x01, 0x03, 0x02, 0x03, 0x01, 0x02, 0x70, 0x00, 0x03, 0x03, 0x04,
+		0x59, 0x05, 0x01, 0x04, 0x04, 0x0e, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17,
+		0x00, 0x4c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x1d, 0x22, 0x24, 0x17, 0x25, 0x06, 0x07, 0x18, 0x2b,
+		0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33,
+		0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x35, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21,
+		0x33, 0x03, 0x9b, 0x1f, 0xc3, 0xb2, 0x65, 0xbf, 0x4b, 0x1e, 0x12, 0x1a, 0x1e, 0x11, 0x13, 0x3e,
+		0x94, 0x4e, 0xde, 0xfe, 0x97, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0xa2, 0x1e, 0x04, 0xa3, 0x1f, 0x25,
+		0xfc, 0xee, 0xab, 0xb8, 0x3b, 0x37, 0x17, 0x1d, 0x17, 0x1e, 0x27, 0x0e, 0x2f, 0x31, 0xed, 0x02,
+		0xa8, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xea, 0x04, 0x45,
+		0x06, 0x82, 0x00, 0x27, 0x01, 0x92, 0x00, 0xa0, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x36, 0x00, 0x00,
+		0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xd7,
+		0xff, 0xed, 0x04, 0x47, 0x04, 0xb8, 0x00, 0x25, 0x00, 0x3d, 0x40, 0x09, 0x24, 0x1a, 0x09, 0x08,
+		0x04, 0x00, 0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x2d, 0x50, 0x58, 0x40, 0x0d, 0x03, 0x01, 0x02, 0x02,
+		0x0e, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x11, 0x00, 0x03, 0x03, 0x16,
+		0x4b, 0x00, 0x02, 0x02, 0x0e, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59, 0xb6, 0x25,
+		0x35, 0x36, 0x24, 0x04, 0x07, 0x18, 0x2b, 0x24, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x01,
+		0x07, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16,
+		0x15, 0x11, 0x01, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x01, 0x04, 0x47, 0x2b,
+		0x21, 0x16, 0x19, 0x13, 0xfe, 0x62, 0xae, 0x21, 0x29, 0x02, 0x29, 0x21, 0x21, 0x29, 0x02, 0x29,
+		0x21, 0x02, 0x3b, 0x10, 0x18, 0x1c, 0x20, 0x27, 0x16, 0xfe, 0x67, 0x01, 0xb2, 0x45, 0x11, 0x1c,
+		0x18, 0x13, 0x19, 0x02, 0x20, 0xb8, 0xfe, 0xc9, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x35, 0x23, 0x1e,
+		0x1e, 0x23, 0xfd, 0xdc, 0x02, 0x5f, 0x11, 0x15, 0x19, 0x1a, 0x14, 0x16, 0xfe, 0x4f, 0xfd, 0xc7,
+		0xff, 0xff, 0x00, 0xd7, 0xfd, 0xf2, 0x04, 0x47, 0x04, 0xb8, 0x00, 0x22, 0x00, 0x38, 0x00, 0x00,
+		0x00, 0x03, 0x01, 0x7e, 0x04, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf5, 0x00, 0x00, 0x04, 0x10,
+		0x04, 0xad, 0x00, 0x14, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x01, 0x01, 0x0e, 0x4b, 0x03, 0x01, 0x02,
+		0x02, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x13, 0x35,
+		0x44, 0x04, 0x07, 0x16, 0x2b, 0x24, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x23, 0x22, 0x26, 0x35,
+		0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x21, 0x03, 0xf3, 0x1d, 0x1d, 0x22, 0xfd,
+		0x8c, 0x29, 0x23, 0x1c, 0x21, 0x29, 0x02, 0x29, 0x21, 0x02, 0x46, 0x90, 0x21, 0x27, 0x27, 0x21,
+		0x1f, 0x25, 0x04, 0x28, 0x23, 0x1e, 0x1e, 0x23, 0xfc, 0x24, 0x00, 0x00, 0xff, 0xff, 0x00, 0xe1,
+		0x00, 0x00, 0x04, 0x10, 0x06, 0x95, 0x00, 0x27, 0x01, 0x80, 0xff, 0x40, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x3a, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0xf5, 0x00, 0x00, 0x04, 0x10, 0x04, 0xad, 0x00, 0x22, 0x00, 0x3a, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x81, 0x01, 0xcc, 0xff, 0x83, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x83,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xf5, 0xfd, 0xf2, 0x04, 0x10, 0x04, 0xad, 0x00, 0x22,
+		0x00, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xc8, 0x00, 0x00, 0xff, 0xff, 0x00, 0xf5,
+		0x00, 0x00, 0x04, 0x10, 0x04, 0xad, 0x00, 0x22, 0x00, 0x3a, 0x00, 0x00, 0x01, 0x07, 0x01, 0x94,
+		0x00, 0x82, 0xfe, 0x02, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0x02, 0xb0, 0x33, 0x2b, 0x00,
+		0x00, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x10, 0x04, 0xad, 0x00, 0x2a, 0x00, 0x39, 0x40, 0x36,
+		0x28, 0x1e, 0x15, 0x0b, 0x04, 0x01, 0x03, 0x01, 0x4a, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01,
+		0x70, 0x00, 0x01, 0x04, 0x02, 0x01, 0x04, 0x6e, 0x00, 0x02, 0x02, 0x0e, 0x4b, 0x05, 0x01, 0x04,
+		0x04, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x29, 0x25,
+		0x39, 0x25, 0x44, 0x06, 0x07, 0x18, 0x2b, 0x24, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x23, 0x22,
+		0x26, 0x35, 0x11, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x11, 0x34, 0x36,
+		0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x05,
+		0x11, 0x21, 0x03, 0xf3, 0x1d, 0x1d, 0x22, 0xfd, 0xc8, 0x29, 0x23, 0x1c, 0x88, 0x18, 0x10, 0x1a,
+		0x19, 0x12, 0x20, 0xd5, 0x21, 0x29, 0x02, 0x29, 0x21, 0xce, 0x18, 0x10, 0x1a, 0x19, 0x12, 0x20,
+		0xfe, 0xe5, 0x02, 0x0a, 0x90, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x01, 0x7c, 0x5c, 0x10, 0x25,
+		0x1b, 0x12, 0x19, 0x15, 0x91, 0x02, 0x07, 0x23, 0x1e, 0x1e, 0x23, 0xfe, 0x5f, 0x8c, 0x10, 0x25,
+		0x1b, 0x12, 0x19, 0x15, 0xc0, 0xfe, 0x69, 0x00, 0x00, 0x01, 0x00, 0x90, 0xff, 0xf6, 0x04, 0x3c,
+		0x04, 0xad, 0x00, 0x29, 0x00, 0x2e, 0x40, 0x2b, 0x24, 0x13, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x4a,
+		0x00, 0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x70, 0x05, 0x04, 0x02, 0x03, 0x03, 0x0e, 0x4b, 0x02,
+		0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x27, 0x35, 0x36, 0x26, 0x35,
+		0x06, 0x07, 0x18, 0x2b, 0x00, 0x16, 0x17, 0x13, 0x16, 0x06, 0x23, 0x23, 0x22, 0x26, 0x27, 0x03,
+		0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x03, 0x06, 0x06, 0x23, 0x23, 0x22, 0x26, 0x37,
+		0x13, 0x36, 0x36, 0x33, 0x33, 0x32, 0x16, 0x17, 0x01, 0x01, 0x36, 0x36, 0x33, 0x33, 0x03, 0xf7,
+		0x25, 0x01, 0x1e, 0x01, 0x21, 0x29, 0x02, 0x29, 0x20, 0x01, 0x15, 0xcf, 0x10, 0x2a, 0x22, 0x22,
+		0x2a, 0x10, 0xcf, 0x15, 0x01, 0x20, 0x29, 0x02, 0x29, 0x21, 0x01, 0x1e, 0x01, 0x26, 0x25, 0x02,
+		0x23, 0x2d, 0x10, 0x01, 0x09, 0x01, 0x09, 0x10, 0x2e, 0x23, 0x02, 0x04, 0xad, 0x1d, 0x24, 0xfb,
+		0xcb, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x2d, 0xfe, 0x42, 0x23, 0x1d, 0x1d, 0x23, 0x01, 0xbe, 0xfc,
+		0xd3, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x35, 0x24, 0x1d, 0x1f, 0x22, 0xfd, 0xc6, 0x02, 0x3a, 0x22,
+		0x1f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x04, 0xad, 0x00, 0x21,
+		0x00, 0x51, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0xb6, 0x1b, 0x0a, 0x02, 0x00, 0x02, 0x01, 0x4a, 0x1b,
+		0xb6, 0x1b, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x4a, 0x59, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x0e,
+		0x04, 0x03, 0x02, 0x02, 0x02, 0x0e, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40,
+		0x12, 0x04, 0x03, 0x02, 0x02, 0x02, 0x0e, 0x4b, 0x00, 0x01, 0x01, 0x0f, 0x4b, 0x00, 0x00, 0x00,
+		0x17, 0x00, 0x4c, 0x59, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x1f, 0x35, 0x37, 0x25, 0x05,
+		0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x01, 0x23, 0x11,
+		0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x17, 0x01, 0x33,
+		0x11, 0x34, 0x36, 0x33, 0x33, 0x03, 0xfd, 0x20, 0x25, 0x26, 0x1b, 0x27, 0x12, 0xfd, 0xc7, 0x04,
+		0x20, 0x28, 0x02, 0x28, 0x20, 0x22, 0x29, 0x1b, 0x2b, 0x13, 0x02, 0x34, 0x04, 0x20, 0x28, 0x02,
+		0x04, 0xad, 0x1e, 0x23, 0xfb, 0xb9, 0x1b, 0x20, 0x1c, 0x1b, 0x03, 0x78, 0xfc, 0x9e, 0x23, 0x1e,
+		0x1e, 0x23, 0x04, 0x35, 0x23, 0x1e, 0x1c, 0xfc, 0x8e, 0x03, 0x4d, 0x23, 0x1e, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x06, 0x95, 0x00, 0x27, 0x01, 0x80, 0xff, 0xfe,
+		0x01, 0x0e, 0x01, 0x02, 0x00, 0x41, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x06, 0x84, 0x00, 0x22,
+		0x00, 0x41, 0x00, 0x00, 0x01, 0x07, 0x01, 0x83, 0x00, 0x0a, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xfd, 0xf2, 0x04, 0x1d,
+		0x04, 0xad, 0x00, 0x22, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xd2, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xaf, 0xfe, 0x66, 0x04, 0x1d, 0x04, 0xad, 0x00, 0x2f, 0x00, 0x3c, 0x40, 0x39,
+		0x29, 0x18, 0x17, 0x03, 0x03, 0x04, 0x0b, 0x01, 0x00, 0x02, 0x02, 0x4a, 0x00, 0x01, 0x03, 0x02,
+		0x03, 0x01, 0x02, 0x70, 0x06, 0x05, 0x02, 0x04, 0x04, 0x0e, 0x4b, 0x00, 0x03, 0x03, 0x0f, 0x4b,
+		0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2f, 0x00,
+		0x2d, 0x35, 0x38, 0x23, 0x17, 0x25, 0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06,
+		0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x33, 0x32, 0x36,
+		0x35, 0x35, 0x01, 0x23, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33,
+		0x33, 0x32, 0x17, 0x01, 0x33, 0x11, 0x34, 0x36, 0x33, 0x33, 0x03, 0xfd, 0x20, 0x8d, 0x84, 0x3a,
+		0x78, 0x35, 0x27, 0x0b, 0x15, 0x22, 0x0f, 0x0d, 0x60, 0x51, 0x3f, 0x3b, 0xfd, 0xbe, 0x04, 0x20,
+		0x28, 0x02, 0x28, 0x20, 0x22, 0x29, 0x1b, 0x2b, 0x13, 0x02, 0x34, 0x04, 0x20, 0x28, 0x02, 0x04,
+		0xad, 0x1e, 0x23, 0xfb, 0x0d, 0x86, 0x8d, 0x1b, 0x17, 0x11, 0x23, 0x10, 0x1b, 0x2f, 0x06, 0x28,
+		0x4a, 0x53, 0x7e, 0x03, 0x86, 0xfc, 0x9e, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x35, 0x23, 0x1e, 0x1c,
+		0xfc, 0x8e, 0x03, 0x4d, 0x23, 0x1e, 0x00, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d,
+		0x06, 0x3b, 0x00, 0x22, 0x00, 0x41, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0x00, 0x00, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x5a,
+		0xff, 0xea, 0x04, 0x72, 0x04, 0xb9, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2c, 0x40, 0x29, 0x05, 0x01,
+		0x03, 0x03, 0x01, 0x5b, 0x04, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00,
+		0x00, 0x00, 0x17, 0x00, 0x4c, 0x10, 0x10, 0x00, 0x00, 0x10, 0x1f, 0x10, 0x1e, 0x18, 0x16, 0x00,
+		0x0f, 0x00, 0x0e, 0x26, 0x06, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x23,
+		0x22, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+		0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x03, 0x02, 0xee, 0x82, 0x82, 0xee, 0x9c, 0x9c, 0xee,
+		0x82, 0x82, 0xee, 0x9c, 0x6f, 0xa8, 0x5b, 0x5b, 0xa7, 0x70, 0x70, 0xa7, 0x5b, 0x5b, 0xa8, 0x6f,
+		0x04, 0xb9, 0x99, 0xfe, 0xe8, 0xb7, 0xb7, 0xfe, 0xe9, 0x99, 0x99, 0x01, 0x17, 0xb7, 0xb7, 0x01,
+		0x18, 0x99, 0x94, 0x71, 0xd4, 0x8f, 0x8f, 0xd3, 0x71, 0x71, 0xd3, 0x8f, 0x8f, 0xd4, 0x71, 0x00,
+		0xff, 0xff, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x72, 0x06, 0x95, 0x00, 0x22, 0x00, 0x47, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x80, 0xff, 0xea, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x72, 0x06, 0x6a, 0x00, 0x22,
+		0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x01, 0x82, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x72,
+		0x06, 0x82, 0x00, 0x22, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x01, 0x92, 0x00, 0x00, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
+		0xff, 0xea, 0x04, 0x72, 0x06, 0x61, 0x00, 0x22, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x01, 0x93,
+		0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x72, 0x06, 0x95, 0x00, 0x22, 0x00, 0x47, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x95, 0x00, 0x16, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x72, 0x06, 0x84, 0x00, 0x22,
+		0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x01, 0x96, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02,
+		0x02, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x72,
+		0x05, 0xf0, 0x00, 0x22, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0x00, 0x00, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x03, 0x00, 0x5a,
+		0xff, 0xae, 0x04, 0x72, 0x04, 0xf7, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x46, 0x40, 0x43,
+		0x22, 0x1b, 0x02, 0x04, 0x02, 0x35, 0x34, 0x28, 0x27, 0x25, 0x12, 0x06, 0x05, 0x04, 0x0f, 0x08,
+		0x02, 0x00, 0x05, 0x03, 0x4a, 0x00, 0x03, 0x02, 0x03, 0x72, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00,
+		0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x06, 0x01, 0x05, 0x05, 0x00, 0x5b, 0x00,
+		0x00, 0x00, 0x17, 0x00, 0x4c, 0x2f, 0x2f, 0x2f, 0x37, 0x2f, 0x36, 0x2b, 0x13, 0x2d, 0x13, 0x25,
+		0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x02, 0x06, 0x23, 0x22, 0x27, 0x07, 0x06, 0x23,
+		0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x26, 0x26, 0x35, 0x34, 0x12, 0x36, 0x33, 0x32, 0x17,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x07, 0x00, 0x17, 0x01, 0x26, 0x23, 0x22,
+		0x06, 0x06, 0x15, 0x00, 0x36, 0x36, 0x35, 0x34, 0x27, 0x01, 0x16, 0x33, 0x04, 0x2c, 0x46, 0x82,
+		0xee, 0x9c, 0xa2, 0x7b, 0x4d, 0x17, 0x18, 0x12, 0x1d, 0x25, 0x10, 0x58, 0x41, 0x46, 0x82, 0xee,
+		0x9c, 0xa3, 0x79, 0x4e, 0x17, 0x19, 0x13, 0x1c, 0x23, 0x0f, 0x59, 0xfd, 0x0a, 0x49, 0x01, 0xef,
+		0x53, 0x73, 0x6f, 0xa8, 0x5b, 0x01, 0xe2, 0xa7, 0x5b, 0x4a, 0xfe, 0x11, 0x57, 0x70, 0x03, 0xb5,
+		0xde, 0x86, 0xb7, 0xfe, 0xe9, 0x99, 0x53, 0x6f, 0x20, 0x13, 0x19, 0x1b, 0x11, 0x18, 0x7f, 0x51,
+		0xde, 0x85, 0xb7, 0x01, 0x18, 0x99, 0x53, 0x71, 0x20, 0x13, 0x19, 0x1b, 0x12, 0x17, 0x81, 0xfd,
+		0x95, 0x79, 0x02, 0xc8, 0x3b, 0x71, 0xd4, 0x8f, 0xfe, 0x2d, 0x71, 0xd3, 0x8f, 0xb6, 0x7b, 0xfd,
+		0x37, 0x3b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x72, 0x06, 0x3b, 0x00, 0x22,
+		0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x54, 0xff, 0xfc, 0x04, 0x75,
+		0x04, 0xa7, 0x00, 0x23, 0x00, 0x2c, 0x00, 0x35, 0x40, 0x32, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03,
+		0x04, 0x61, 0x07, 0x01, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x01, 0x0e, 0x4b, 0x06, 0x08, 0x02,
+		0x05, 0x05, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x29, 0x28, 0x27, 0x26,
+		0x00, 0x23, 0x00, 0x22, 0x24, 0x21, 0x24, 0x46, 0x44, 0x09, 0x07, 0x19, 0x2b, 0x24, 0x16, 0x15,
+		0x14, 0x06, 0x23, 0x21, 0x23, 0x06, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x17, 0x33, 0x21, 0x32,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x11,
+		0x21, 0x00, 0x16, 0x16, 0x17, 0x11, 0x0e, 0x02, 0x15, 0x04, 0x58, 0x1d, 0x1d, 0x22, 0xfe, 0x72,
+		0x45, 0x9f, 0xee, 0x82, 0x82, 0xee, 0x9f, 0x7d, 0x01, 0x42, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xbe,
+		0xf7, 0x22, 0x1d, 0x1d, 0x22, 0xf7, 0x01, 0x56, 0xfc, 0xb8, 0x56, 0x9d, 0x69, 0x69, 0x9d, 0x56,
+		0x90, 0x21, 0x27, 0x27, 0x21, 0x04, 0x8c, 0x01, 0x0f, 0xba, 0xba, 0x01, 0x0f, 0x8d, 0x04, 0x21,
+		0x27, 0x27, 0x21, 0xfe, 0x99, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x74, 0x01, 0x32, 0xca, 0x6c, 0x04,
+		0x03, 0x92, 0x04, 0x6b, 0xcb, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0xeb, 0xff, 0xf6, 0x04, 0x30,
+		0x04, 0xa3, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x30, 0x40, 0x2d, 0x06, 0x01, 0x04, 0x00, 0x00, 0x01,
+		0x04, 0x00, 0x61, 0x00, 0x03, 0x03, 0x02, 0x59, 0x05, 0x01, 0x02, 0x02, 0x0e, 0x4b, 0x00, 0x01,
+		0x01, 0x0f, 0x01, 0x4c, 0x17, 0x17, 0x00, 0x00, 0x17, 0x1f, 0x17, 0x1e, 0x1d, 0x1b, 0x00, 0x16,
+		0x00, 0x13, 0x33, 0x26, 0x07, 0x07, 0x16, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+		0x21, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x21, 0x12,
+		0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x11, 0x33, 0x03, 0x09, 0xc3, 0x64, 0x64, 0xc3, 0x89, 0xff,
+		0x01, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1d, 0x22, 0x57, 0x00, 0xff, 0x7d, 0x99, 0x99, 0x92, 0xea,
+		0xea, 0x04, 0xa3, 0x64, 0xb4, 0x77, 0x76, 0xb3, 0x62, 0xfe, 0xae, 0x23, 0x1e, 0x1e, 0x23, 0x04,
+		0x28, 0x25, 0x1f, 0xfd, 0x76, 0x83, 0x78, 0x7a, 0x85, 0xfe, 0x06, 0x00, 0x00, 0x02, 0x00, 0xeb,
+		0xff, 0xf6, 0x04, 0x26, 0x04, 0xad, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x5e, 0x4b, 0xb0, 0x2f, 0x50,
+		0x58, 0x40, 0x1f, 0x07, 0x01, 0x05, 0x00, 0x00, 0x01, 0x05, 0x00, 0x61, 0x00, 0x02, 0x02, 0x0e,
+		0x4b, 0x00, 0x04, 0x04, 0x03, 0x59, 0x06, 0x01, 0x03, 0x03, 0x11, 0x4b, 0x00, 0x01, 0x01, 0x0f,
+		0x01, 0x4c, 0x1b, 0x40, 0x1d, 0x06, 0x01, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x61, 0x07, 0x01,
+		0x05, 0x00, 0x00, 0x01, 0x05, 0x00, 0x61, 0x00, 0x02, 0x02, 0x0e, 0x4b, 0x00, 0x01, 0x01, 0x0f,
+		0x01, 0x4c, 0x59, 0x40, 0x14, 0x1b, 0x1b, 0x00, 0x00, 0x1b, 0x23, 0x1b, 0x22, 0x21, 0x1f, 0x00,
+		0x1a, 0x00, 0x19, 0x35, 0x33, 0x26, 0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06,
+		0x06, 0x23, 0x21, 0x15, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33,
+		0x32, 0x16, 0x15, 0x15, 0x21, 0x12, 0x36, 0x35, 0x34, 0x26, 0x23, 0x21, 0x11, 0x21, 0x03, 0x21,
+		0xad, 0x58, 0x58, 0xac, 0x7a, 0xfe, 0xd9, 0x21, 0x29, 0x02, 0x29, 0x21, 0x21, 0x29, 0x02, 0x29,
+		0x21, 0x01, 0x27, 0x61, 0x7f, 0x7c, 0x79, 0xfe, 0xee, 0x01, 0x12, 0x03, 0xb2, 0x5b, 0x9d, 0x64,
+		0x63, 0x9c, 0x59, 0xc7, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x35, 0x23, 0x1e, 0x1e, 0x23, 0xba, 0xfd,
+		0xdc, 0x67, 0x61, 0x5e, 0x6e, 0xfe, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x5a, 0xff, 0x58, 0x04, 0x72,
+		0x04, 0xb9, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x68, 0x40, 0x0c, 0x2a, 0x20, 0x02, 0x03, 0x04, 0x1a,
+		0x09, 0x02, 0x01, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x21, 0x00, 0x04, 0x05,
+		0x03, 0x03, 0x04, 0x68, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02,
+		0x02, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40,
+		0x22, 0x00, 0x04, 0x05, 0x03, 0x05, 0x04, 0x03, 0x70, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x05,
+		0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5c, 0x00, 0x01, 0x01,
+		0x17, 0x01, 0x4c, 0x59, 0x40, 0x09, 0x28, 0x27, 0x29, 0x26, 0x23, 0x25, 0x06, 0x07, 0x1a, 0x2b,
+		0x05, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x27, 0x06, 0x23, 0x22, 0x26, 0x02, 0x35,
+		0x34, 0x12, 0x36, 0x33, 0x32, 0x16, 0x12, 0x15, 0x14, 0x02, 0x07, 0x00, 0x16, 0x16, 0x33, 0x32,
+		0x37, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x17, 0x36, 0x36, 0x35, 0x34, 0x26,
+		0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x03, 0xea, 0x0f, 0x2b, 0x1d, 0x15, 0x1b, 0x15, 0x5a, 0x4f,
+		0x5d, 0x9c, 0xee, 0x82, 0x82, 0xee, 0x9c, 0x9c, 0xee, 0x82, 0x72, 0x69, 0xfd, 0x5d, 0x5b, 0xa7,
+		0x70, 0x30, 0x28, 0x69, 0x0f, 0x2b, 0x1d, 0x15, 0x1a, 0x16, 0x72, 0x47, 0x4c, 0x5b, 0xa8, 0x6f,
+		0x6f, 0xa8, 0x5b, 0x36, 0x17, 0x11, 0x1d, 0x1a, 0x13, 0x21, 0x8c, 0x1b, 0x99, 0x01, 0x17, 0xb7,
+		0xb7, 0x01, 0x18, 0x99, 0x99, 0xfe, 0xe8, 0xb7, 0xac, 0xfe, 0xf6, 0x4f, 0x01, 0x76, 0xd3, 0x71,
+		0x0a, 0xa4, 0x19, 0x0f, 0x1c, 0x1c, 0x13, 0x22, 0xb2, 0x3c, 0xc7, 0x83, 0x8f, 0xd4, 0x71, 0x71,
+		0xd4, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0xeb, 0xff, 0xf1, 0x04, 0x19, 0x04, 0xa3, 0x00, 0x20,
+		0x00, 0x28, 0x00, 0x2b, 0x40, 0x28, 0x1f, 0x01, 0x01, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x01,
+		0x00, 0x04, 0x01, 0x61, 0x00, 0x05, 0x05, 0x03, 0x59, 0x00, 0x03, 0x03, 0x0e, 0x4b, 0x02, 0x01,
+		0x00, 0x00, 0x17, 0x00, 0x4c, 0x23, 0x28, 0x45, 0x33, 0x12, 0x25, 0x06, 0x07, 0x1a, 0x2b, 0x24,
+		0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x01, 0x23, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22,
+		0x26, 0x35, 0x11, 0x34, 0x36, 0x3b, 0x02, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x01, 0x01,
+		0x33, 0x20, 0x35, 0x34, 0x26, 0x23, 0x23, 0x04, 0x19, 0x17, 0x18, 0x23, 0x11, 0x1b, 0x12, 0xfe,
+		0xd6, 0xde, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1d, 0x22, 0x57, 0xeb, 0x85, 0xb9, 0x5e, 0x85, 0x80,
+		0x01, 0x08, 0xfd, 0x76, 0xd6, 0x01, 0x17, 0x8b, 0x8c, 0xd6, 0x42, 0x10, 0x0f, 0x18, 0x0b, 0x0f,
+		0x1c, 0x01, 0xcc, 0xfe, 0x5e, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x28, 0x25, 0x1f, 0x59, 0xa1, 0x6d,
+		0x82, 0xaf, 0x21, 0xfe, 0x6e, 0x02, 0x11, 0xd3, 0x6a, 0x6d, 0x00, 0x00, 0xff, 0xff, 0x00, 0xeb,
+		0xff, 0xf1, 0x04, 0x19, 0x06, 0x95, 0x00, 0x27, 0x01, 0x80, 0xff, 0xf6, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x55, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0xeb, 0xff, 0xf1, 0x04, 0x19, 0x06, 0x84, 0x00, 0x22, 0x00, 0x55, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x83, 0xff, 0xf6, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xeb, 0xfd, 0xf2, 0x04, 0x19, 0x04, 0xa3, 0x00, 0x22,
+		0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xd2, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa7,
+		0xff, 0xea, 0x04, 0x26, 0x04, 0xb9, 0x00, 0x3f, 0x00, 0x39, 0x40, 0x36, 0x00, 0x00, 0x01, 0x03,
+		0x01, 0x00, 0x03, 0x70, 0x00, 0x03, 0x04, 0x01, 0x03, 0x04, 0x6e, 0x00, 0x01, 0x01, 0x05, 0x5b,
+		0x06, 0x01, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02,
+		0x4c, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3e, 0x2d, 0x2b, 0x27, 0x26, 0x1f, 0x1d, 0x23, 0x16, 0x07,
+		0x07, 0x16, 0x2b, 0x00, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22,
+		0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06,
+		0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33,
+		0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34,
+		0x36, 0x36, 0x33, 0x03, 0x2d, 0xaf, 0x24, 0x0d, 0x14, 0x23, 0x0f, 0x12, 0x9a, 0xbf, 0x77, 0x85,
+		0x27, 0x26, 0x23, 0x5b, 0x55, 0x52, 0x6e, 0x32, 0x61, 0x6d, 0x63, 0xc5, 0x90, 0x72, 0xda, 0x59,
+		0x22, 0x0e, 0x17, 0x20, 0x11, 0x11, 0x4b, 0xb7, 0x5e, 0x8d, 0x91, 0x3f, 0x3a, 0x27, 0x5a, 0x4e,
+		0x54, 0x70, 0x30, 0x4e, 0x56, 0x66, 0xb8, 0x78, 0x04, 0xb9, 0x64, 0x15, 0x23, 0x16, 0x1b, 0x2d,
+		0x0a, 0x5c, 0x6a, 0x5c, 0x28, 0x38, 0x13, 0x12, 0x16, 0x0f, 0x0e, 0x19, 0x14, 0x27, 0x90, 0x7c,
+		0x69, 0x9d, 0x57, 0x3d, 0x37, 0x15, 0x22, 0x17, 0x1b, 0x2c, 0x0b, 0x30, 0x3a, 0x6d, 0x5c, 0x3e,
+		0x4e, 0x19, 0x11, 0x15, 0x0e, 0x0f, 0x1b, 0x16, 0x23, 0x7a, 0x62, 0x6b, 0x9c, 0x53, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xa7, 0xff, 0xea, 0x04, 0x26, 0x06, 0x95, 0x00, 0x22, 0x00, 0x59, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x80, 0xff, 0xea, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xea, 0x04, 0x26, 0x06, 0x84, 0x00, 0x22,
+		0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x01, 0x83, 0xff, 0xfb, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xa7, 0xfe, 0x28, 0x04, 0x26,
+		0x04, 0xb9, 0x00, 0x5f, 0x00, 0xf4, 0x40, 0x0a, 0x23, 0x01, 0x01, 0x00, 0x0f, 0x01, 0x02, 0x04,
+		0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x3f, 0x00, 0x09, 0x0a, 0x06, 0x0a, 0x09, 0x06,
+		0x70, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x07, 0x6e, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x68, 0x00,
+		0x05, 0x03, 0x00, 0x05, 0x66, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x02,
+		0x04, 0x02, 0x60, 0x00, 0x0a, 0x0a, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x16, 0x4b, 0x00, 0x07, 0x07,
+		0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x40,
+		0x00, 0x09, 0x0a, 0x06, 0x0a, 0x09, 0x06, 0x70, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x07, 0x6e, 0x00,
+		0x01, 0x00, 0x05, 0x00, 0x01, 0x05, 0x70, 0x00, 0x05, 0x03, 0x00, 0x05, 0x66, 0x00, 0x03, 0x04,
+		0x00, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x00, 0x0a, 0x0a, 0x08, 0x5b,
+		0x00, 0x08, 0x08, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c,
+		0x1b, 0x40, 0x41, 0x00, 0x09, 0x0a, 0x06, 0x0a, 0x09, 0x06, 0x70, 0x00, 0x06, 0x07, 0x0a, 0x06,
+		0x07, 0x6e, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x05, 0x70, 0x00, 0x05, 0x03, 0x00, 0x05, 0x03,
+		0x6e, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x00,
+		0x0a, 0x0a, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00,
+		0x00, 0x17, 0x00, 0x4c, 0x59, 0x59, 0x40, 0x11, 0x51, 0x4f, 0x4c, 0x4b, 0x45, 0x43, 0x24, 0x1c,
+		0x24, 0x24, 0x17, 0x24, 0x11, 0x12, 0x0b, 0x07, 0x1c, 0x2b, 0x24, 0x06, 0x06, 0x07, 0x15, 0x36,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17,
+		0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x07, 0x22, 0x26, 0x35, 0x35, 0x26, 0x26,
+		0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
+		0x26, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+		0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+		0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x04, 0x26, 0x57, 0xaf, 0x7f, 0x65,
+		0x66, 0x7c, 0x79, 0x44, 0x80, 0x33, 0x17, 0x08, 0x11, 0x1d, 0x08, 0x05, 0x2b, 0x67, 0x2f, 0x33,
+		0x3a, 0x36, 0x3e, 0x27, 0x0f, 0x13, 0x5c, 0xaf, 0x49, 0x22, 0x0e, 0x17, 0x20, 0x11, 0x11, 0x4b,
+		0xb7, 0x5e, 0x8d, 0x91, 0x3f, 0x3a, 0x27, 0x5a, 0x4e, 0x54, 0x70, 0x30, 0x4e, 0x56, 0x66, 0xb8,
+		0x78, 0xeb, 0xaf, 0x24, 0x0d, 0x14, 0x23, 0x0f, 0x12, 0x9a, 0xbf, 0x77, 0x85, 0x27, 0x26, 0x23,
+		0x5b, 0x55, 0x52, 0x6e, 0x32, 0x61, 0x6d, 0xe5, 0x97, 0x5b, 0x07, 0x5d, 0x01, 0x5e, 0x4b, 0x57,
+		0x68, 0x18, 0x18, 0x0a, 0x19, 0x0e, 0x15, 0x2d, 0x02, 0x10, 0x16, 0x21, 0x1f, 0x21, 0x20, 0x01,
+		0x15, 0x17, 0x9f, 0x09, 0x3a, 0x2d, 0x15, 0x22, 0x17, 0x1b, 0x2c, 0x0b, 0x30, 0x3a, 0x6d, 0x5c,
+		0x3e, 0x4e, 0x19, 0x11, 0x15, 0x0e, 0x0f, 0x1b, 0x16, 0x23, 0x7a, 0x62, 0x6b, 0x9c, 0x53, 0x64,
+		0x15, 0x23, 0x16, 0x1b, 0x2d, 0x0a, 0x5c, 0x6a, 0x5c, 0x28, 0x38, 0x13, 0x12, 0x16, 0x0f, 0x0e,
+		0x19, 0x14, 0x27, 0x90, 0x7c, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xea, 0x04, 0x26,
+		0x06, 0x82, 0x00, 0x27, 0x01, 0x92, 0x00, 0x06, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x59, 0x00, 0x00,
+		0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa7,
+		0xfd, 0xf2, 0x04, 0x26, 0x04, 0xb9, 0x00, 0x22, 0x00, 0x59, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e,
+		0x04, 0xc2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7a, 0xff, 0xf6, 0x04, 0x52, 0x04, 0xa3, 0x00, 0x17,
+		0x00, 0x21, 0x40, 0x1e, 0x02, 0x01, 0x00, 0x00, 0x03, 0x59, 0x04, 0x01, 0x03, 0x03, 0x0e, 0x4b,
+		0x00, 0x01, 0x01, 0x0f, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x15, 0x23, 0x33, 0x24, 0x05,
+		0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22,
+		0x26, 0x35, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0x35, 0x1d, 0x1d, 0x22,
+		0xfe, 0x9e, 0x21, 0x29, 0x02, 0x29, 0x21, 0xfe, 0x9e, 0x22, 0x1d, 0x1d, 0x22, 0x03, 0x5a, 0x04,
+		0xa3, 0x21, 0x27, 0x27, 0x21, 0xfc, 0x24, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0xdc, 0x21, 0x27, 0x27,
+		0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7a, 0xff, 0xf6, 0x04, 0x52, 0x04, 0xa3, 0x00, 0x29,
+		0x00, 0x2f, 0x40, 0x2c, 0x05, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x61, 0x06, 0x01,
+		0x00, 0x00, 0x07, 0x59, 0x08, 0x01, 0x07, 0x07, 0x0e, 0x4b, 0x00, 0x03, 0x03, 0x0f, 0x03, 0x4c,
+		0x00, 0x00, 0x00, 0x29, 0x00, 0x27, 0x21, 0x24, 0x23, 0x33, 0x24, 0x21, 0x24, 0x09, 0x07, 0x1b,
+		0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+		0x23, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
+		0x33, 0x33, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0x35, 0x1d, 0x1d, 0x22,
+		0xfe, 0x9e, 0xce, 0x22, 0x1d, 0x1d, 0x22, 0xce, 0x21, 0x29, 0x02, 0x29, 0x21, 0xce, 0x22, 0x1d,
+		0x1d, 0x22, 0xce, 0xfe, 0x9e, 0x22, 0x1d, 0x1d, 0x22, 0x03, 0x5a, 0x04, 0xa3, 0x21, 0x27, 0x27,
+		0x21, 0xfe, 0x3b, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x79, 0x23, 0x1e, 0x1e, 0x23, 0x01, 0x87, 0x21,
+		0x27, 0x27, 0x21, 0x01, 0xc5, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7a,
+		0xff, 0xf6, 0x04, 0x52, 0x06, 0x84, 0x00, 0x22, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x07, 0x01, 0x83,
+		0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0x00, 0x01, 0x00, 0x7a, 0xfe, 0x28, 0x04, 0x52, 0x04, 0xa3, 0x00, 0x34, 0x00, 0x7e, 0x40, 0x0b,
+		0x29, 0x09, 0x02, 0x01, 0x00, 0x15, 0x01, 0x02, 0x04, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58,
+		0x40, 0x29, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x68, 0x00, 0x05, 0x03, 0x00, 0x05, 0x03, 0x6e,
+		0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x06, 0x01,
+		0x00, 0x00, 0x07, 0x59, 0x08, 0x01, 0x07, 0x07, 0x0e, 0x00, 0x4c, 0x1b, 0x40, 0x2a, 0x00, 0x01,
+		0x00, 0x05, 0x00, 0x01, 0x05, 0x70, 0x00, 0x05, 0x03, 0x00, 0x05, 0x03, 0x6e, 0x00, 0x03, 0x04,
+		0x00, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x06, 0x01, 0x00, 0x00, 0x07,
+		0x59, 0x08, 0x01, 0x07, 0x07, 0x0e, 0x00, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00, 0x00, 0x34, 0x00,
+		0x32, 0x27, 0x24, 0x24, 0x17, 0x24, 0x14, 0x24, 0x09, 0x07, 0x1b, 0x2b, 0x00, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x11, 0x14, 0x07, 0x15, 0x36, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27,
+		0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
+		0x23, 0x07, 0x22, 0x26, 0x35, 0x35, 0x26, 0x35, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+		0x21, 0x04, 0x35, 0x1d, 0x1d, 0x22, 0xfe, 0x9e, 0x09, 0x65, 0x66, 0x7c, 0x79, 0x44, 0x80, 0x33,
+		0x17, 0x08, 0x11, 0x1d, 0x08, 0x05, 0x2b, 0x67, 0x2f, 0x33, 0x3a, 0x36, 0x3e, 0x27, 0x0f, 0x13,
+		0x09, 0xfe, 0x9e, 0x22, 0x1d, 0x1d, 0x22, 0x03, 0x5a, 0x04, 0xa3, 0x21, 0x27, 0x27, 0x21, 0xfc,
+		0x24, 0x1a, 0x0f, 0x7f, 0x01, 0x5e, 0x4b, 0x57, 0x68, 0x18, 0x18, 0x0a, 0x19, 0x0e, 0x15, 0x2d,
+		0x02, 0x10, 0x16, 0x21, 0x1f, 0x21, 0x20, 0x01, 0x15, 0x17, 0xbf, 0x0f, 0x1a, 0x03, 0xdc, 0x21,
+		0x27, 0x27, 0x21, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xfd, 0xf2, 0x04, 0x52, 0x04, 0xa3, 0x00, 0x22,
+		0x00, 0x5f, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaf,
+		0xff, 0xea, 0x04, 0x1d, 0x04, 0xad, 0x00, 0x1f, 0x00, 0x21, 0x40, 0x1e, 0x04, 0x03, 0x02, 0x01,
+		0x01, 0x0e, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00,
+		0x00, 0x1f, 0x00, 0x1d, 0x25, 0x36, 0x26, 0x05, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14,
+		0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11,
+		0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x03, 0xfc, 0x21, 0x6e, 0xc6,
+		0x83, 0x83, 0xc6, 0x6e, 0x21, 0x29, 0x02, 0x29, 0x21, 0x96, 0x8b, 0x8b, 0x96, 0x21, 0x29, 0x02,
+		0x04, 0xad, 0x1e, 0x23, 0xfd, 0x31, 0x8c, 0xc3, 0x64, 0x64, 0xc3, 0x8c, 0x02, 0xcf, 0x23, 0x1e,
+		0x1e, 0x23, 0xfd, 0x45, 0x99, 0x9a, 0x9a, 0x99, 0x02, 0xbb, 0x23, 0x1e, 0xff, 0xff, 0x00, 0xaf,
+		0xff, 0xea, 0x04, 0x1d, 0x06, 0x95, 0x00, 0x22, 0x00, 0x64, 0x00, 0x00, 0x01, 0x07, 0x01, 0x80,
+		0x00, 0x1c, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x06, 0x6a, 0x00, 0x22, 0x00, 0x64, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x82, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x06, 0x82, 0x00, 0x22,
+		0x00, 0x64, 0x00, 0x00, 0x01, 0x07, 0x01, 0x92, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d,
+		0x06, 0x61, 0x00, 0x22, 0x00, 0x64, 0x00, 0x00, 0x01, 0x07, 0x01, 0x93, 0x00, 0x00, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf,
+		0xff, 0xea, 0x04, 0x1d, 0x06, 0x95, 0x00, 0x22, 0x00, 0x64, 0x00, 0x00, 0x01, 0x07, 0x01, 0x95,
+		0xff, 0xe4, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x4f, 0x06, 0x84, 0x00, 0x22, 0x00, 0x64, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x96, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x05, 0xf0, 0x00, 0x27,
+		0x01, 0x97, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xaf, 0xfe, 0x28, 0x04, 0x1d,
+		0x04, 0xad, 0x00, 0x38, 0x00, 0x58, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x1a, 0x01, 0x01, 0x00,
+		0x00, 0x02, 0x00, 0x02, 0x5f, 0x07, 0x06, 0x02, 0x04, 0x04, 0x0e, 0x4b, 0x00, 0x05, 0x05, 0x03,
+		0x5b, 0x00, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x1b, 0x40, 0x21, 0x00, 0x01, 0x03, 0x00, 0x03, 0x01,
+		0x00, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x5f, 0x07, 0x06, 0x02, 0x04, 0x04, 0x0e, 0x4b,
+		0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x59, 0x40, 0x0f, 0x00, 0x00,
+		0x00, 0x38, 0x00, 0x36, 0x25, 0x36, 0x25, 0x27, 0x31, 0x2b, 0x08, 0x07, 0x1a, 0x2b, 0x00, 0x16,
+		0x15, 0x11, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x33, 0x32,
+		0x17, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x23, 0x22,
+		0x26, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14, 0x16, 0x33, 0x32,
+		0x36, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x03, 0xfc, 0x21, 0x6e, 0x64, 0x69, 0x5b, 0x2a, 0x23,
+		0x34, 0x3d, 0x08, 0x03, 0x1e, 0x09, 0x02, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b, 0x44, 0x41, 0x0a,
+		0x83, 0xc6, 0x6e, 0x21, 0x29, 0x02, 0x29, 0x21, 0x96, 0x8b, 0x8b, 0x96, 0x21, 0x29, 0x02, 0x04,
+		0xad, 0x1e, 0x23, 0xfd, 0x31, 0x8b, 0xc4, 0x33, 0x5d, 0x86, 0x3c, 0x23, 0x26, 0x11, 0x02, 0x36,
+		0x12, 0x07, 0x16, 0x19, 0x06, 0x1a, 0x68, 0x57, 0x44, 0x7f, 0x40, 0x64, 0xc3, 0x8c, 0x02, 0xcf,
+		0x23, 0x1e, 0x1e, 0x23, 0xfd, 0x45, 0x99, 0x9a, 0x9a, 0x99, 0x02, 0xbb, 0x23, 0x1e, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x07, 0x05, 0x00, 0x22, 0x00, 0x64, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x99, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0xf0, 0xb0,
+		0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xea, 0x04, 0x1d, 0x06, 0x3b, 0x00, 0x27,
+		0x01, 0x9a, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x63, 0xff, 0xea, 0x04, 0x65,
+		0x04, 0xad, 0x00, 0x1d, 0x00, 0x1b, 0x40, 0x18, 0x17, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01,
+		0x01, 0x01, 0x0e, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x16, 0x29, 0x27, 0x03, 0x07, 0x17,
+		0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x01, 0x26, 0x35,
+		0x34, 0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x17, 0x01, 0x01, 0x36, 0x36, 0x33, 0x32, 0x17, 0x04,
+		0x49, 0x1c, 0x07, 0xfe, 0x71, 0x0d, 0x33, 0x2b, 0x2b, 0x33, 0x0d, 0xfe, 0x71, 0x07, 0x1c, 0x1e,
+		0x1a, 0x0e, 0x14, 0x1a, 0x08, 0x01, 0x69, 0x01, 0x69, 0x08, 0x1a, 0x14, 0x0e, 0x1a, 0x04, 0x9b,
+		0x1a, 0x13, 0x0a, 0x15, 0xfb, 0xdc, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0x24, 0x15, 0x0a, 0x13, 0x1a,
+		0x0a, 0x08, 0x16, 0x18, 0xfc, 0x37, 0x03, 0xc9, 0x18, 0x16, 0x08, 0x00, 0x00, 0x01, 0x00, 0x43,
+		0xff, 0xea, 0x04, 0x81, 0x04, 0xad, 0x00, 0x2b, 0x00, 0x4b, 0x40, 0x0d, 0x12, 0x02, 0x02, 0x03,
+		0x02, 0x25, 0x1d, 0x0b, 0x03, 0x00, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x12,
+		0x04, 0x01, 0x02, 0x02, 0x0e, 0x4b, 0x00, 0x03, 0x03, 0x11, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17,
+		0x00, 0x4c, 0x1b, 0x40, 0x15, 0x00, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00, 0x70, 0x04, 0x01, 0x02,
+		0x02, 0x0e, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59, 0xb7, 0x36, 0x26, 0x38, 0x24,
+		0x27, 0x05, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x06, 0x23, 0x22, 0x27,
+		0x03, 0x03, 0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x33, 0x32,
+		0x16, 0x17, 0x13, 0x13, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x13, 0x13, 0x36, 0x36, 0x33, 0x32,
+		0x17, 0x04, 0x61, 0x20, 0x01, 0x95, 0x05, 0x29, 0x28, 0x4d, 0x17, 0xcf, 0xcf, 0x17, 0x4d, 0x28,
+		0x29, 0x05, 0x95, 0x01, 0x20, 0x24, 0x07, 0x0d, 0x1e, 0x1c, 0x04, 0x70, 0xcf, 0x07, 0x23, 0x20,
+		0x20, 0x23, 0x07, 0xcf, 0x70, 0x04, 0x1c, 0x1e, 0x0d, 0x07, 0x04, 0xa7, 0x1a, 0x19, 0x0c, 0x06,
+		0xfb, 0xc9, 0x24, 0x1d, 0x41, 0x02, 0x4a, 0xfd, 0xb6, 0x41, 0x1d, 0x24, 0x04, 0x37, 0x06, 0x0c,
+		0x19, 0x1a, 0x05, 0x01, 0x1b, 0x1f, 0xfc, 0x8f, 0x02, 0x4b, 0x14, 0x14, 0x14, 0x14, 0xfd, 0xb5,
+		0x03, 0x71, 0x1f, 0x1b, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x43, 0xff, 0xea, 0x04, 0x81,
+		0x06, 0x95, 0x00, 0x22, 0x00, 0x70, 0x00, 0x00, 0x01, 0x07, 0x01, 0x80, 0x00, 0x1e, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x43,
+		0xff, 0xea, 0x04, 0x81, 0x06, 0x82, 0x00, 0x22, 0x00, 0x70, 0x00, 0x00, 0x01, 0x07, 0x01, 0x92,
+		0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0x43, 0xff, 0xea, 0x04, 0x81, 0x06, 0x61, 0x00, 0x22, 0x00, 0x70, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x93, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x43, 0xff, 0xea, 0x04, 0x81, 0x06, 0x95, 0x00, 0x22,
+		0x00, 0x70, 0x00, 0x00, 0x01, 0x07, 0x01, 0x95, 0xff, 0xe2, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x95, 0xff, 0xf0, 0x04, 0x43,
+		0x04, 0xb3, 0x00, 0x28, 0x00, 0x22, 0x40, 0x1f, 0x27, 0x24, 0x1d, 0x13, 0x10, 0x08, 0x06, 0x00,
+		0x02, 0x01, 0x4a, 0x03, 0x01, 0x02, 0x02, 0x16, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c,
+		0x24, 0x2c, 0x25, 0x24, 0x04, 0x07, 0x18, 0x2b, 0x24, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27,
+		0x01, 0x01, 0x06, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x01, 0x26, 0x35, 0x34,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x01, 0x01, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x01,
+		0x01, 0x04, 0x43, 0x2d, 0x25, 0x14, 0x1e, 0x14, 0xfe, 0xbf, 0xfe, 0xc3, 0x0b, 0x18, 0x0f, 0x14,
+		0x25, 0x2d, 0x0f, 0x01, 0x6a, 0xfe, 0xad, 0x0f, 0x2d, 0x25, 0x14, 0x1d, 0x15, 0x01, 0x29, 0x01,
+		0x27, 0x15, 0x1d, 0x14, 0x25, 0x2d, 0x0f, 0xfe, 0xac, 0x01, 0x6b, 0x44, 0x11, 0x1f, 0x14, 0x10,
+		0x1f, 0x01, 0xd8, 0xfe, 0x28, 0x10, 0x0f, 0x10, 0x14, 0x1e, 0x12, 0x15, 0x02, 0x04, 0x01, 0xed,
+		0x15, 0x12, 0x1e, 0x14, 0x10, 0x1f, 0xfe, 0x41, 0x01, 0xbf, 0x1f, 0x10, 0x14, 0x1e, 0x12, 0x15,
+		0xfe, 0x12, 0xfd, 0xfd, 0x00, 0x01, 0x00, 0x7d, 0xff, 0xf6, 0x04, 0x4f, 0x04, 0xb1, 0x00, 0x1e,
+		0x00, 0x1d, 0x40, 0x1a, 0x19, 0x0e, 0x05, 0x03, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01,
+		0x16, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x14, 0x2a, 0x38, 0x03, 0x07, 0x17, 0x2b, 0x00,
+		0x16, 0x15, 0x14, 0x07, 0x01, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x01, 0x26,
+		0x35, 0x34, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x01, 0x01, 0x36, 0x33, 0x32, 0x17, 0x04, 0x38,
+		0x17, 0x0f, 0xfe, 0x71, 0x21, 0x29, 0x02, 0x29, 0x21, 0xfe, 0x71, 0x0f, 0x17, 0x19, 0x21, 0x13,
+		0x1e, 0x12, 0x01, 0x55, 0x01, 0x55, 0x14, 0x1c, 0x13, 0x21, 0x04, 0x98, 0x19, 0x10, 0x10, 0x17,
+		0xfd, 0x9f, 0xfe, 0x50, 0x23, 0x1e, 0x1e, 0x23, 0x01, 0xb0, 0x02, 0x61, 0x17, 0x10, 0x10, 0x19,
+		0x0b, 0x0e, 0x1d, 0xfd, 0xf2, 0x02, 0x0e, 0x1d, 0x0e, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7d,
+		0xff, 0xf6, 0x04, 0x4f, 0x06, 0x95, 0x00, 0x27, 0x01, 0x80, 0x00, 0x1c, 0x01, 0x0e, 0x01, 0x02,
+		0x00, 0x76, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0x7d, 0xff, 0xf6, 0x04, 0x4f, 0x06, 0x82, 0x00, 0x22, 0x00, 0x76, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x92, 0x00, 0x01, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xf6, 0x04, 0x4f, 0x06, 0x61, 0x00, 0x22,
+		0x00, 0x76, 0x00, 0x00, 0x01, 0x07, 0x01, 0x93, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x02, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xf6, 0x04, 0x4f,
+		0x06, 0x95, 0x00, 0x22, 0x00, 0x76, 0x00, 0x00, 0x01, 0x07, 0x01, 0x95, 0xff, 0xe4, 0x01, 0x0e,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xa7,
+		0x00, 0x00, 0x04, 0x23, 0x04, 0xa3, 0x00, 0x1d, 0x00, 0x25, 0x40, 0x22, 0x00, 0x01, 0x01, 0x02,
+		0x59, 0x00, 0x02, 0x02, 0x0e, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f,
+		0x00, 0x4c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1c, 0x44, 0x25, 0x44, 0x05, 0x07, 0x17, 0x2b, 0x24,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x01, 0x21, 0x22, 0x26,
+		0x35, 0x34, 0x36, 0x33, 0x21, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0x01, 0x21, 0x04, 0x06, 0x1d,
+		0x1d, 0x22, 0xfd, 0x52, 0x50, 0x22, 0x1d, 0x0e, 0x02, 0x81, 0xfd, 0xca, 0x22, 0x1d, 0x1d, 0x22,
+		0x02, 0x7b, 0x57, 0x22, 0x1d, 0x0a, 0xfd, 0x7d, 0x02, 0x60, 0x90, 0x21, 0x27, 0x27, 0x21, 0x1f,
+		0x25, 0x16, 0x15, 0x03, 0xa4, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x19, 0x0e, 0xfc, 0x58, 0x00,
+		0xff, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x04, 0x23, 0x06, 0x95, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00,
+		0x01, 0x07, 0x01, 0x80, 0xff, 0xfe, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x0e,
+		0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x04, 0x23, 0x06, 0x84, 0x00, 0x22,
+		0x00, 0x7b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x83, 0x00, 0x08, 0x01, 0x0e, 0x00, 0x09, 0xb1, 0x01,
+		0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x04, 0x23,
+		0x06, 0x61, 0x00, 0x27, 0x01, 0x94, 0x00, 0x0a, 0x01, 0x0e, 0x01, 0x02, 0x00, 0x7b, 0x00, 0x00,
+		0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x9f,
+		0xff, 0xea, 0x03, 0xf6, 0x03, 0xb2, 0x00, 0x29, 0x00, 0x35, 0x00, 0x86, 0x40, 0x0c, 0x17, 0x01,
+		0x06, 0x02, 0x2c, 0x2b, 0x0b, 0x03, 0x07, 0x06, 0x02, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40,
+		0x28, 0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x70, 0x00, 0x02, 0x00, 0x06, 0x07, 0x02, 0x06,
+		0x63, 0x00, 0x03, 0x03, 0x05, 0x5b, 0x08, 0x01, 0x05, 0x05, 0x19, 0x4b, 0x09, 0x01, 0x07, 0x07,
+		0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x2c, 0x00, 0x04, 0x03, 0x02,
+		0x03, 0x04, 0x02, 0x70, 0x00, 0x02, 0x00, 0x06, 0x07, 0x02, 0x06, 0x63, 0x00, 0x03, 0x03, 0x05,
+		0x5b, 0x08, 0x01, 0x05, 0x05, 0x19, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x4b, 0x09, 0x01, 0x07, 0x07,
+		0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x59, 0x40, 0x16, 0x2a, 0x2a, 0x00, 0x00, 0x2a,
+		0x35, 0x2a, 0x34, 0x30, 0x2e, 0x00, 0x29, 0x00, 0x28, 0x23, 0x24, 0x25, 0x25, 0x35, 0x0a, 0x07,
+		0x19, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35, 0x06, 0x06,
+		0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x17, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x12, 0x37, 0x35, 0x26,
+		0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x03, 0x3a, 0xbc, 0x1e, 0x27, 0x02, 0x27, 0x1e,
+		0x51, 0xbd, 0x69, 0x64, 0x9a, 0x56, 0xdf, 0xb2, 0x9f, 0x91, 0x6d, 0x79, 0x4b, 0xa2, 0x49, 0x10,
+		0x0f, 0x20, 0x17, 0x0b, 0x25, 0x54, 0xc1, 0x61, 0x42, 0xa0, 0x44, 0x9c, 0x4f, 0x73, 0x85, 0x65,
+		0x5b, 0x03, 0xb2, 0xa8, 0xa5, 0xfd, 0xd2, 0x23, 0x1e, 0x1e, 0x23, 0x44, 0x45, 0x4c, 0x45, 0x84,
+		0x5b, 0x9f, 0x96, 0x33, 0x55, 0x61, 0x5b, 0x2a, 0x25, 0x09, 0x30, 0x18, 0x10, 0x23, 0x13, 0x2c,
+		0x2f, 0xfc, 0xc5, 0xa5, 0x6d, 0x16, 0x17, 0x4f, 0x56, 0x49, 0x51, 0x00, 0xff, 0xff, 0x00, 0x9f,
+		0xff, 0xea, 0x03, 0xf6, 0x05, 0x87, 0x00, 0x22, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xea, 0x03, 0xf6, 0x05, 0x5c, 0x00, 0x22,
+		0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x82, 0x0d, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9f,
+		0xff, 0xea, 0x03, 0xf6, 0x05, 0x74, 0x00, 0x22, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x92,
+		0x0a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xea, 0x03, 0xf6, 0x05, 0x53, 0x00, 0x22,
+		0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x93, 0x0a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9f,
+		0xff, 0xea, 0x03, 0xf6, 0x05, 0x87, 0x00, 0x22, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x95,
+		0x32, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xea, 0x03, 0xf6, 0x04, 0xe2, 0x00, 0x22,
+		0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x9f,
+		0xfe, 0x28, 0x04, 0x2d, 0x03, 0xb2, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x59, 0x40, 0x56, 0x29, 0x01,
+		0x08, 0x03, 0x44, 0x43, 0x1d, 0x03, 0x07, 0x08, 0x1c, 0x03, 0x02, 0x02, 0x07, 0x03, 0x4a, 0x00,
+		0x05, 0x04, 0x03, 0x04, 0x05, 0x03, 0x70, 0x00, 0x03, 0x0a, 0x01, 0x08, 0x07, 0x03, 0x08, 0x63,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x5f, 0x00, 0x04, 0x04, 0x06, 0x5b, 0x09, 0x01, 0x06, 0x06,
+		0x19, 0x4b, 0x00, 0x07, 0x07, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x3c, 0x3c, 0x00,
+		0x00, 0x3c, 0x47, 0x3c, 0x46, 0x42, 0x40, 0x00, 0x3b, 0x00, 0x3a, 0x23, 0x24, 0x25, 0x28, 0x28,
+		0x2b, 0x0b, 0x07, 0x1a, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14,
+		0x16, 0x33, 0x32, 0x37, 0x36, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x37, 0x35, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x17, 0x35,
+		0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36,
+		0x33, 0x02, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x35, 0x26, 0x26, 0x23, 0x03, 0x3a, 0xbc,
+		0x07, 0x09, 0x5b, 0x50, 0x2a, 0x23, 0x37, 0x3a, 0x18, 0x1c, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b,
+		0x67, 0x64, 0x51, 0xbd, 0x69, 0x64, 0x9a, 0x56, 0xdf, 0xb2, 0x9f, 0x91, 0x6d, 0x79, 0x4b, 0xa2,
+		0x49, 0x10, 0x0f, 0x20, 0x17, 0x0b, 0x25, 0x54, 0xc1, 0x61, 0xc0, 0x85, 0x65, 0x5b, 0xc7, 0xa0,
+		0x44, 0x9c, 0x4f, 0x03, 0xb2, 0xa8, 0xa5, 0xfd, 0xd2, 0x13, 0x18, 0x08, 0x54, 0x7d, 0x38, 0x24,
+		0x27, 0x0a, 0x04, 0x23, 0x27, 0x14, 0x18, 0x06, 0x1a, 0x68, 0x57, 0x51, 0x98, 0x50, 0x5b, 0x45,
+		0x4c, 0x45, 0x84, 0x5b, 0x9f, 0x96, 0x33, 0x55, 0x61, 0x5b, 0x2a, 0x25, 0x09, 0x30, 0x18, 0x10,
+		0x23, 0x13, 0x2c, 0x2f, 0xfe, 0x04, 0x4f, 0x56, 0x49, 0x51, 0xa5, 0x6d, 0x16, 0x17, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0x9f, 0xff, 0xea, 0x03, 0xf6, 0x06, 0x15, 0x00, 0x22, 0x00, 0x7f, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x99, 0x0a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xea, 0x03, 0xf6,
+		0x05, 0x2d, 0x00, 0x22, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x9a, 0x0a, 0x00, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x4b, 0xff, 0xea, 0x04, 0x80, 0x03, 0xb2, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x4a,
+		0x00, 0x65, 0x40, 0x62, 0x35, 0x01, 0x06, 0x08, 0x18, 0x01, 0x03, 0x01, 0x02, 0x4a, 0x00, 0x07,
+		0x06, 0x05, 0x06, 0x07, 0x05, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x0a, 0x01,
+		0x05, 0x10, 0x0d, 0x02, 0x00, 0x02, 0x05, 0x00, 0x63, 0x0f, 0x0b, 0x02, 0x06, 0x06, 0x08, 0x5b,
+		0x0e, 0x09, 0x02, 0x08, 0x08, 0x19, 0x4b, 0x0c, 0x01, 0x01, 0x01, 0x03, 0x5b, 0x04, 0x01, 0x03,
+		0x03, 0x17, 0x03, 0x4c, 0x40, 0x40, 0x39, 0x39, 0x00, 0x00, 0x40, 0x4a, 0x40, 0x4a, 0x46, 0x44,
+		0x39, 0x3f, 0x39, 0x3e, 0x3c, 0x3b, 0x00, 0x38, 0x00, 0x37, 0x26, 0x23, 0x23, 0x15, 0x23, 0x27,
+		0x23, 0x21, 0x24, 0x11, 0x07, 0x1d, 0x2b, 0x00, 0x16, 0x17, 0x16, 0x06, 0x23, 0x21, 0x12, 0x33,
+		0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x27,
+		0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x36, 0x36, 0x33,
+		0x06, 0x06, 0x07, 0x21, 0x26, 0x26, 0x23, 0x00, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36,
+		0x35, 0x35, 0x03, 0xed, 0x8c, 0x06, 0x01, 0x1e, 0x22, 0xfe, 0x71, 0x05, 0x9f, 0x30, 0x50, 0x2a,
+		0x11, 0x16, 0x1f, 0x19, 0x15, 0x1b, 0x37, 0x84, 0x48, 0xa3, 0x51, 0x30, 0x91, 0x51, 0x4e, 0x76,
+		0x40, 0xf9, 0xd7, 0x38, 0x4b, 0x2d, 0x56, 0x2e, 0x13, 0x17, 0x1c, 0x18, 0x15, 0x17, 0x7b, 0x92,
+		0x99, 0x44, 0x28, 0x71, 0x47, 0x45, 0x4e, 0x0c, 0x01, 0x2c, 0x07, 0x42, 0x42, 0xfe, 0x24, 0x97,
+		0x3c, 0x33, 0x38, 0x5b, 0x35, 0x03, 0xb2, 0xe8, 0xd4, 0x21, 0x1d, 0xfe, 0xc3, 0x25, 0x29, 0x11,
+		0x1f, 0x19, 0x19, 0x1c, 0x19, 0x34, 0x36, 0x90, 0x43, 0x4d, 0x40, 0x76, 0x50, 0xa7, 0xad, 0x16,
+		0x65, 0x62, 0x22, 0x23, 0x0f, 0x19, 0x18, 0x1a, 0x1c, 0x14, 0x6a, 0x74, 0x39, 0x3b, 0x91, 0x68,
+		0x75, 0x6c, 0x71, 0xfe, 0x97, 0x64, 0x64, 0x39, 0x40, 0x39, 0x65, 0x3f, 0x64, 0x00, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0xc0, 0xff, 0xea, 0x04, 0x41, 0x05, 0x2a, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x68,
+		0xb6, 0x10, 0x03, 0x02, 0x04, 0x05, 0x01, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1d, 0x06,
+		0x01, 0x03, 0x03, 0x10, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x19, 0x4b,
+		0x00, 0x04, 0x04, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40, 0x21, 0x06,
+		0x01, 0x03, 0x03, 0x10, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x19, 0x4b,
+		0x00, 0x02, 0x02, 0x0f, 0x4b, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c,
+		0x59, 0x40, 0x14, 0x1e, 0x1e, 0x00, 0x00, 0x1e, 0x2d, 0x1e, 0x2c, 0x26, 0x24, 0x00, 0x1d, 0x00,
+		0x1b, 0x35, 0x26, 0x24, 0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x36, 0x33, 0x32, 0x16,
+		0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x15, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26,
+		0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x00, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
+		0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x01, 0x35, 0x21, 0x81, 0xbc, 0x7c, 0xc3, 0x6f, 0x6f, 0xc3,
+		0x7c, 0x62, 0xa6, 0x3f, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x21, 0x29, 0x02, 0x01, 0x24, 0x8b, 0x4f,
+		0x4f, 0x8b, 0x59, 0x59, 0x81, 0x44, 0x44, 0x81, 0x59, 0x05, 0x2a, 0x1e, 0x23, 0xfe, 0x24, 0xa5,
+		0x75, 0xdb, 0x94, 0x94, 0xdb, 0x75, 0x58, 0x52, 0x5d, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0xb2, 0x23,
+		0x1e, 0xfd, 0xf4, 0x50, 0x98, 0x68, 0x68, 0x98, 0x50, 0x55, 0x99, 0x62, 0x62, 0x99, 0x55, 0x00,
+		0x00, 0x01, 0x00, 0x93, 0xff, 0xea, 0x04, 0x31, 0x03, 0xb2, 0x00, 0x2a, 0x00, 0x36, 0x40, 0x33,
+		0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x03, 0x70, 0x00, 0x03, 0x02, 0x01, 0x03, 0x02, 0x6e, 0x00,
+		0x01, 0x01, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x19, 0x4b, 0x00, 0x02, 0x02, 0x04, 0x5b, 0x00,
+		0x04, 0x04, 0x17, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x29, 0x27, 0x23, 0x26, 0x23, 0x17,
+		0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
+		0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
+		0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x02,
+		0xe0, 0xc5, 0x54, 0x23, 0x0f, 0x14, 0x20, 0x13, 0x12, 0x8d, 0xb2, 0x60, 0x93, 0x51, 0x51, 0x93,
+		0x60, 0x5c, 0xad, 0x47, 0x14, 0x12, 0x1f, 0x16, 0x11, 0x20, 0x52, 0xd9, 0x71, 0x8f, 0xdb, 0x78,
+		0x78, 0xdb, 0x8f, 0x03, 0xb2, 0x38, 0x36, 0x16, 0x23, 0x17, 0x1b, 0x29, 0x0d, 0x61, 0x56, 0x99,
+		0x61, 0x61, 0x99, 0x56, 0x39, 0x36, 0x0f, 0x26, 0x1d, 0x17, 0x21, 0x17, 0x3c, 0x44, 0x7e, 0xdc,
+		0x8a, 0x8a, 0xdc, 0x7e, 0xff, 0xff, 0x00, 0x93, 0xff, 0xea, 0x04, 0x31, 0x05, 0x87, 0x00, 0x22,
+		0x00, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x93,
+		0xff, 0xea, 0x04, 0x31, 0x05, 0x76, 0x00, 0x22, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x01, 0x83,
+		0x1e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0xfe, 0x28, 0x04, 0x31, 0x03, 0xb2, 0x00, 0x4a,
+		0x00, 0x9a, 0x40, 0x0b, 0x26, 0x06, 0x02, 0x00, 0x08, 0x12, 0x01, 0x01, 0x03, 0x02, 0x4a, 0x4b,
+		0xb0, 0x0a, 0x50, 0x58, 0x40, 0x38, 0x00, 0x06, 0x07, 0x09, 0x07, 0x06, 0x09, 0x70, 0x00, 0x09,
+		0x08, 0x07, 0x09, 0x08, 0x6e, 0x00, 0x00, 0x08, 0x04, 0x03, 0x00, 0x68, 0x00, 0x02, 0x04, 0x03,
+		0x04, 0x02, 0x03, 0x70, 0x00, 0x08, 0x00, 0x04, 0x02, 0x08, 0x04, 0x63, 0x00, 0x03, 0x00, 0x01,
+		0x03, 0x01, 0x60, 0x00, 0x07, 0x07, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x19, 0x07, 0x4c, 0x1b, 0x40,
+		0x39, 0x00, 0x06, 0x07, 0x09, 0x07, 0x06, 0x09, 0x70, 0x00, 0x09, 0x08, 0x07, 0x09, 0x08, 0x6e,
+		0x00, 0x00, 0x08, 0x04, 0x08, 0x00, 0x04, 0x70, 0x00, 0x02, 0x04, 0x03, 0x04, 0x02, 0x03, 0x70,
+		0x00, 0x08, 0x00, 0x04, 0x02, 0x08, 0x04, 0x63, 0x00, 0x03, 0x00, 0x01, 0x03, 0x01, 0x60, 0x00,
+		0x07, 0x07, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x19, 0x07, 0x4c, 0x59, 0x40, 0x0e, 0x49, 0x47, 0x26,
+		0x23, 0x17, 0x2b, 0x24, 0x24, 0x17, 0x24, 0x17, 0x0a, 0x07, 0x1d, 0x2b, 0x24, 0x15, 0x14, 0x07,
+		0x06, 0x06, 0x07, 0x15, 0x36, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x07, 0x22,
+		0x26, 0x35, 0x35, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15, 0x14,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+		0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x04, 0x31, 0x20, 0x46, 0xb5, 0x61, 0x65, 0x66, 0x7c, 0x79,
+		0x44, 0x80, 0x33, 0x17, 0x08, 0x11, 0x1d, 0x08, 0x05, 0x2b, 0x67, 0x2f, 0x33, 0x3a, 0x36, 0x3e,
+		0x27, 0x0f, 0x13, 0x7d, 0xbb, 0x66, 0x78, 0xdb, 0x8f, 0x6b, 0xc5, 0x54, 0x23, 0x0f, 0x14, 0x20,
+		0x13, 0x12, 0x8d, 0xb2, 0x60, 0x93, 0x51, 0x51, 0x93, 0x60, 0x5c, 0xad, 0x47, 0x14, 0x12, 0x1f,
+		0x16, 0xb9, 0x17, 0x21, 0x17, 0x33, 0x42, 0x08, 0x5e, 0x01, 0x5e, 0x4b, 0x57, 0x68, 0x18, 0x18,
+		0x0a, 0x19, 0x0e, 0x15, 0x2d, 0x02, 0x10, 0x16, 0x21, 0x1f, 0x21, 0x20, 0x01, 0x15, 0x17, 0x9f,
+		0x0f, 0x83, 0xcf, 0x7f, 0x8a, 0xdc, 0x7e, 0x38, 0x36, 0x16, 0x23, 0x17, 0x1b, 0x29, 0x0d, 0x61,
+		0x56, 0x99, 0x61, 0x61, 0x99, 0x56, 0x39, 0x36, 0x0f, 0x26, 0x00, 0x00, 0xff, 0xff, 0x00, 0x93,
+		0xff, 0xea, 0x04, 0x31, 0x05, 0x74, 0x00, 0x22, 0x01, 0x92, 0x1e, 0x00, 0x00, 0x02, 0x00, 0x8b,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x93, 0xff, 0xea, 0x04, 0x31, 0x05, 0x53, 0x00, 0x22,
+		0x00, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x01, 0x94, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x8b,
+		0xff, 0xea, 0x04, 0x0c, 0x05, 0x2a, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x68, 0xb6, 0x18, 0x0b, 0x02,
+		0x04, 0x05, 0x01, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1d, 0x06, 0x01, 0x03, 0x03, 0x10,
+		0x4b, 0x07, 0x01, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b, 0x00, 0x04, 0x04, 0x00,
+		0x5b, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x21, 0x06, 0x01, 0x03, 0x03, 0x10,
+		0x4b, 0x07, 0x01, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b, 0x00, 0x00, 0x00, 0x0f,
+		0x4b, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x59, 0x40, 0x14, 0x1e,
+		0x1e, 0x00, 0x00, 0x1e, 0x2d, 0x1e, 0x2c, 0x26, 0x24, 0x00, 0x1d, 0x00, 0x1b, 0x26, 0x25, 0x35,
+		0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35,
+		0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x11, 0x34, 0x36,
+		0x33, 0x33, 0x00, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+		0x26, 0x23, 0x03, 0xeb, 0x21, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x3f, 0xa6, 0x62, 0x7c, 0xc3, 0x6f,
+		0x6f, 0xc3, 0x7c, 0xbc, 0x81, 0x21, 0x29, 0x02, 0xfe, 0x28, 0x81, 0x44, 0x44, 0x81, 0x59, 0x59,
+		0x8b, 0x4f, 0x4f, 0x8b, 0x59, 0x05, 0x2a, 0x1e, 0x23, 0xfb, 0x4e, 0x23, 0x1e, 0x1e, 0x23, 0x5d,
+		0x52, 0x58, 0x75, 0xdb, 0x94, 0x94, 0xdb, 0x75, 0xa5, 0x01, 0xdc, 0x23, 0x1e, 0xfd, 0xf4, 0x55,
+		0x99, 0x62, 0x62, 0x99, 0x55, 0x50, 0x98, 0x68, 0x68, 0x98, 0x50, 0x00, 0x00, 0x02, 0x00, 0x8c,
+		0xff, 0xea, 0x04, 0x40, 0x05, 0x34, 0x00, 0x33, 0x00, 0x43, 0x00, 0xac, 0x40, 0x0e, 0x33, 0x28,
+		0x20, 0x1c, 0x11, 0x05, 0x02, 0x04, 0x0f, 0x01, 0x05, 0x01, 0x02, 0x4a, 0x4b, 0xb0, 0x1b, 0x50,
+		0x58, 0x40, 0x28, 0x00, 0x02, 0x04, 0x01, 0x04, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x10, 0x4b,
+		0x00, 0x04, 0x04, 0x10, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x11, 0x4b, 0x07,
+		0x01, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x20, 0x50,
+		0x58, 0x40, 0x26, 0x00, 0x02, 0x04, 0x01, 0x04, 0x02, 0x01, 0x70, 0x00, 0x01, 0x00, 0x05, 0x06,
+		0x01, 0x05, 0x63, 0x00, 0x03, 0x03, 0x10, 0x4b, 0x00, 0x04, 0x04, 0x10, 0x4b, 0x07, 0x01, 0x06,
+		0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x28, 0x00, 0x04, 0x03, 0x02,
+		0x03, 0x04, 0x02, 0x70, 0x00, 0x02, 0x01, 0x03, 0x02, 0x01, 0x6e, 0x00, 0x01, 0x00, 0x05, 0x06,
+		0x01, 0x05, 0x63, 0x00, 0x03, 0x03, 0x10, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00,
+		0x00, 0x17, 0x00, 0x4c, 0x59, 0x59, 0x40, 0x0f, 0x34, 0x34, 0x34, 0x43, 0x34, 0x42, 0x2e, 0x26,
+		0x1e, 0x25, 0x26, 0x24, 0x08, 0x07, 0x1a, 0x2b, 0x00, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
+		0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x26, 0x27, 0x07, 0x06, 0x23, 0x22, 0x26, 0x27,
+		0x26, 0x35, 0x34, 0x37, 0x37, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16,
+		0x17, 0x37, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x07, 0x02, 0x36, 0x36, 0x35,
+		0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x04, 0x40, 0x7b, 0xd8,
+		0x87, 0x87, 0xd8, 0x7b, 0x7b, 0xd8, 0x87, 0x79, 0x76, 0x49, 0x88, 0xf0, 0x11, 0x0e, 0x12, 0x18,
+		0x0a, 0x08, 0x2b, 0x95, 0x2d, 0x4d, 0x25, 0x0e, 0x18, 0x22, 0x11, 0x12, 0x7d, 0x60, 0xed, 0x11,
+		0x0e, 0x12, 0x18, 0x0a, 0x08, 0x2b, 0xa1, 0x5a, 0x8f, 0x4f, 0x4f, 0x8f, 0x5e, 0x5e, 0x8f, 0x4f,
+		0x4f, 0x8f, 0x5e, 0x03, 0x3b, 0xfe, 0x75, 0x86, 0xce, 0x72, 0x72, 0xce, 0x86, 0x86, 0xce, 0x72,
+		0x4d, 0x78, 0x6b, 0x5a, 0x07, 0x17, 0x1a, 0x13, 0x12, 0x21, 0x10, 0x38, 0x1a, 0x27, 0x12, 0x1d,
+		0x13, 0x1a, 0x2d, 0x09, 0x3d, 0x45, 0x59, 0x07, 0x17, 0x1a, 0x13, 0x12, 0x21, 0x10, 0x3c, 0xfc,
+		0x38, 0x4c, 0x8a, 0x5c, 0x5c, 0x8a, 0x4c, 0x4c, 0x8a, 0x5c, 0x5c, 0x8a, 0x4c, 0x00, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x89, 0xff, 0xea, 0x05, 0x29, 0x05, 0x2a, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x3d,
+		0x00, 0xb1, 0x40, 0x0b, 0x29, 0x01, 0x04, 0x02, 0x19, 0x0b, 0x02, 0x06, 0x07, 0x02, 0x4a, 0x4b,
+		0xb0, 0x28, 0x50, 0x58, 0x40, 0x23, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x05, 0x08, 0x02, 0x03, 0x03,
+		0x10, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b, 0x00, 0x06, 0x06,
+		0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
+		0x27, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x05, 0x08, 0x02, 0x03, 0x03, 0x10, 0x4b, 0x09, 0x01, 0x07,
+		0x07, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x4b, 0x00, 0x06, 0x06,
+		0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40, 0x2b, 0x08, 0x01, 0x03, 0x03, 0x10,
+		0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x10, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x02,
+		0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b, 0x00, 0x00, 0x00, 0x0f, 0x4b, 0x00, 0x06, 0x06, 0x01, 0x5b,
+		0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x59, 0x59, 0x40, 0x18, 0x30, 0x30, 0x00, 0x00, 0x30, 0x3d,
+		0x30, 0x3c, 0x36, 0x34, 0x2f, 0x2d, 0x27, 0x25, 0x00, 0x1e, 0x00, 0x1c, 0x26, 0x25, 0x35, 0x0a,
+		0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35, 0x06,
+		0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x11, 0x34, 0x36,
+		0x33, 0x33, 0x04, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x13,
+		0x36, 0x33, 0x33, 0x00, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+		0x23, 0x03, 0x85, 0x21, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x37, 0x85, 0x59, 0x71, 0xac, 0x5f, 0x5f,
+		0xac, 0x71, 0x58, 0x7d, 0x36, 0x21, 0x29, 0x02, 0x01, 0xbf, 0x0e, 0x05, 0x86, 0x0d, 0x3d, 0x1c,
+		0x1e, 0x02, 0x52, 0x08, 0x22, 0x76, 0xfc, 0x8c, 0x77, 0x77, 0x75, 0x4e, 0x74, 0x3f, 0x3f, 0x74,
+		0x4e, 0x05, 0x2a, 0x1e, 0x23, 0xfb, 0x4e, 0x23, 0x1e, 0x1e, 0x23, 0x53, 0x50, 0x50, 0x75, 0xda,
+		0x95, 0x95, 0xda, 0x75, 0x4d, 0x4e, 0x01, 0xd2, 0x23, 0x1e, 0x0a, 0x0f, 0x0c, 0x09, 0x0f, 0xfe,
+		0x95, 0x24, 0x16, 0x14, 0x04, 0x0a, 0x01, 0x6a, 0x20, 0xfd, 0xfe, 0xb7, 0x99, 0x99, 0xb7, 0x50,
+		0x97, 0x69, 0x69, 0x97, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x9f, 0xff, 0xea, 0x04, 0xc2,
+		0x05, 0x2a, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0xb2, 0x40, 0x0a, 0x1c, 0x01, 0x08, 0x03, 0x0f, 0x01,
+		0x09, 0x08, 0x02, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x29, 0x00, 0x06, 0x06, 0x10, 0x4b,
+		0x04, 0x01, 0x00, 0x00, 0x05, 0x5b, 0x0a, 0x07, 0x02, 0x05, 0x05, 0x0e, 0x4b, 0x00, 0x08, 0x08,
+		0x03, 0x5b, 0x00, 0x03, 0x03, 0x11, 0x4b, 0x0b, 0x01, 0x09, 0x09, 0x01, 0x5b, 0x02, 0x01, 0x01,
+		0x01, 0x0f, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x25, 0x0a, 0x07, 0x02, 0x05,
+		0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x63, 0x00, 0x03, 0x00, 0x08, 0x09, 0x03, 0x08, 0x63, 0x00,
+		0x06, 0x06, 0x10, 0x4b, 0x0b, 0x01, 0x09, 0x09, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x0f, 0x01,
+		0x4c, 0x1b, 0x40, 0x29, 0x0a, 0x07, 0x02, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x63, 0x00,
+		0x03, 0x00, 0x08, 0x09, 0x03, 0x08, 0x63, 0x00, 0x06, 0x06, 0x10, 0x4b, 0x00, 0x01, 0x01, 0x0f,
+		0x4b, 0x0b, 0x01, 0x09, 0x09, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0x59, 0x40,
+		0x18, 0x30, 0x30, 0x00, 0x00, 0x30, 0x3f, 0x30, 0x3e, 0x38, 0x36, 0x00, 0x2f, 0x00, 0x2e, 0x33,
+		0x24, 0x22, 0x26, 0x25, 0x33, 0x24, 0x0c, 0x07, 0x1b, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23,
+		0x23, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
+		0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33,
+		0x35, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x15, 0x33, 0x00, 0x36, 0x36, 0x35, 0x34, 0x26,
+		0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x04, 0xa5, 0x1d, 0x1d, 0x22, 0x8b,
+		0x1e, 0x27, 0x02, 0x27, 0x1e, 0x3c, 0x9b, 0x5c, 0x76, 0xba, 0x6a, 0x6a, 0xba, 0x76, 0xb0, 0x79,
+		0xfd, 0x22, 0x1d, 0x1d, 0x22, 0xfd, 0x21, 0x29, 0x02, 0x29, 0x21, 0x8b, 0xfe, 0x13, 0x82, 0x4a,
+		0x4a, 0x82, 0x53, 0x53, 0x78, 0x3f, 0x3f, 0x78, 0x53, 0x04, 0x7e, 0x21, 0x27, 0x27, 0x21, 0xfc,
+		0x49, 0x23, 0x1e, 0x1e, 0x23, 0x53, 0x4d, 0x53, 0x6d, 0xce, 0x8b, 0x8b, 0xce, 0x6d, 0x93, 0x01,
+		0x0b, 0x21, 0x27, 0x27, 0x21, 0x6b, 0x23, 0x1e, 0x1e, 0x23, 0x6b, 0xfc, 0x00, 0x49, 0x8a, 0x5f,
+		0x5f, 0x8a, 0x49, 0x4e, 0x8b, 0x59, 0x59, 0x8b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x94,
+		0xff, 0xea, 0x04, 0x43, 0x03, 0xb2, 0x00, 0x21, 0x00, 0x28, 0x00, 0x3f, 0x40, 0x3c, 0x00, 0x02,
+		0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0x05, 0x00, 0x00, 0x02, 0x05, 0x00, 0x61, 0x08, 0x01,
+		0x06, 0x06, 0x04, 0x5b, 0x07, 0x01, 0x04, 0x04, 0x19, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00,
+		0x03, 0x03, 0x17, 0x03, 0x4c, 0x22, 0x22, 0x00, 0x00, 0x22, 0x28, 0x22, 0x27, 0x25, 0x24, 0x00,
+		0x21, 0x00, 0x20, 0x28, 0x23, 0x22, 0x25, 0x09, 0x07, 0x18, 0x2b, 0x00, 0x16, 0x16, 0x17, 0x16,
+		0x06, 0x23, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15,
+		0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x06, 0x06, 0x07,
+		0x21, 0x26, 0x26, 0x23, 0x03, 0x00, 0xcc, 0x6d, 0x08, 0x02, 0x1f, 0x22, 0xfd, 0x2c, 0x07, 0x9a,
+		0x8c, 0x64, 0xbf, 0x45, 0x11, 0x0e, 0x13, 0x1f, 0x09, 0x07, 0x2c, 0x51, 0xdc, 0x70, 0x91, 0xcc,
+		0x6a, 0x79, 0xd8, 0x8a, 0x7c, 0xa2, 0x19, 0x02, 0x67, 0x15, 0x99, 0x82, 0x03, 0xb2, 0x75, 0xce,
+		0x88, 0x21, 0x1d, 0x95, 0x99, 0x2e, 0x28, 0x09, 0x1d, 0x1b, 0x12, 0x12, 0x28, 0x15, 0x27, 0x30,
+		0x74, 0xda, 0x96, 0x8f, 0xdc, 0x79, 0x91, 0x7d, 0x6f, 0x72, 0x7a, 0x00, 0xff, 0xff, 0x00, 0x94,
+		0xff, 0xea, 0x04, 0x43, 0x05, 0x87, 0x00, 0x22, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0xff, 0xea, 0x04, 0x43, 0x05, 0x5c, 0x00, 0x22,
+		0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x01, 0x82, 0x14, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94,
+		0xff, 0xea, 0x04, 0x43, 0x05, 0x76, 0x00, 0x22, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x01, 0x83,
+		0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0xff, 0xea, 0x04, 0x43, 0x05, 0x74, 0x00, 0x22,
+		0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x01, 0x92, 0x14, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94,
+		0xff, 0xea, 0x04, 0x43, 0x05, 0x53, 0x00, 0x22, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x01, 0x93,
+		0x0a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0xff, 0xea, 0x04, 0x43, 0x05, 0x53, 0x00, 0x22,
+		0x01, 0x94, 0x14, 0x00, 0x00, 0x02, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94,
+		0xff, 0xea, 0x04, 0x43, 0x05, 0x87, 0x00, 0x22, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x01, 0x95,
+		0x28, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0xff, 0xea, 0x04, 0x43, 0x04, 0xe2, 0x00, 0x22,
+		0x01, 0x97, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x94,
+		0xfe, 0x28, 0x04, 0x43, 0x03, 0xb2, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x4e, 0x40, 0x4b, 0x2d, 0x01,
+		0x05, 0x01, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0x07, 0x00, 0x00,
+		0x02, 0x07, 0x00, 0x61, 0x00, 0x03, 0x00, 0x04, 0x03, 0x04, 0x5f, 0x0a, 0x01, 0x08, 0x08, 0x06,
+		0x5b, 0x09, 0x01, 0x06, 0x06, 0x19, 0x4b, 0x00, 0x01, 0x01, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x17,
+		0x05, 0x4c, 0x38, 0x38, 0x00, 0x00, 0x38, 0x3e, 0x38, 0x3d, 0x3b, 0x3a, 0x00, 0x37, 0x00, 0x36,
+		0x26, 0x28, 0x2c, 0x23, 0x22, 0x25, 0x0b, 0x07, 0x1a, 0x2b, 0x00, 0x16, 0x16, 0x17, 0x16, 0x06,
+		0x23, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07,
+		0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x16, 0x15, 0x14, 0x06, 0x07,
+		0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
+		0x36, 0x33, 0x06, 0x06, 0x07, 0x21, 0x26, 0x26, 0x23, 0x03, 0x00, 0xcc, 0x6d, 0x08, 0x02, 0x1f,
+		0x22, 0xfd, 0x2c, 0x07, 0x9a, 0x8c, 0x64, 0xbf, 0x45, 0x11, 0x0e, 0x23, 0x16, 0x09, 0x2c, 0x1b,
+		0x3d, 0x56, 0x4b, 0x2a, 0x23, 0x37, 0x3a, 0x18, 0x1c, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b, 0x4f,
+		0x4b, 0x54, 0x4e, 0x91, 0xcc, 0x6a, 0x79, 0xd8, 0x8a, 0x7c, 0xa2, 0x19, 0x02, 0x67, 0x15, 0x99,
+		0x82, 0x03, 0xb2, 0x75, 0xce, 0x88, 0x21, 0x1d, 0x95, 0x99, 0x2e, 0x28, 0x09, 0x35, 0x15, 0x11,
+		0x28, 0x16, 0x0d, 0x39, 0x51, 0x7a, 0x35, 0x24, 0x27, 0x0a, 0x04, 0x23, 0x27, 0x14, 0x18, 0x06,
+		0x1a, 0x68, 0x57, 0x47, 0x85, 0x44, 0x0d, 0x74, 0xda, 0x96, 0x8f, 0xdc, 0x79, 0x91, 0x7d, 0x6f,
+		0x72, 0x7a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xbb, 0xff, 0xf6, 0x04, 0x5b, 0x05, 0x25, 0x00, 0x2b,
+		0x00, 0x36, 0x40, 0x33, 0x01, 0x01, 0x01, 0x07, 0x01, 0x4a, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+		0x02, 0x70, 0x06, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x02, 0x03, 0x61, 0x00, 0x01, 0x01, 0x07,
+		0x5b, 0x00, 0x07, 0x07, 0x10, 0x4b, 0x00, 0x04, 0x04, 0x0f, 0x04, 0x4c, 0x23, 0x24, 0x23, 0x33,
+		0x24, 0x22, 0x23, 0x14, 0x08, 0x07, 0x1c, 0x2b, 0x00, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27,
+		0x26, 0x23, 0x22, 0x15, 0x15, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x14, 0x06,
+		0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x35, 0x34,
+		0x36, 0x33, 0x32, 0x17, 0x04, 0x5b, 0x04, 0x0e, 0x26, 0x09, 0x0d, 0x7f, 0x6e, 0xca, 0x01, 0x5a,
+		0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xa6, 0x21, 0x29, 0x02, 0x29, 0x21, 0xc6, 0x22, 0x1d, 0x1d, 0x22,
+		0xc6, 0xb9, 0xa7, 0x86, 0x84, 0x04, 0xdf, 0x2e, 0x08, 0x14, 0x38, 0x05, 0x31, 0xd9, 0x6e, 0x21,
+		0x27, 0x27, 0x21, 0xfd, 0x7b, 0x23, 0x1e, 0x1e, 0x23, 0x02, 0x85, 0x21, 0x27, 0x27, 0x21, 0x7b,
+		0xa5, 0xb9, 0x33, 0x00, 0x00, 0x02, 0x00, 0x8b, 0xfe, 0x66, 0x04, 0x0c, 0x03, 0xb2, 0x00, 0x2b,
+		0x00, 0x3b, 0x00, 0xb8, 0x40, 0x0b, 0x21, 0x02, 0x02, 0x06, 0x07, 0x14, 0x01, 0x01, 0x03, 0x02,
+		0x4a, 0x4b, 0xb0, 0x24, 0x50, 0x58, 0x40, 0x2a, 0x00, 0x02, 0x04, 0x03, 0x04, 0x02, 0x03, 0x70,
+		0x09, 0x01, 0x07, 0x07, 0x00, 0x5b, 0x08, 0x05, 0x02, 0x00, 0x00, 0x11, 0x4b, 0x00, 0x06, 0x06,
+		0x04, 0x5b, 0x00, 0x04, 0x04, 0x0f, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x13,
+		0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x28, 0x00, 0x02, 0x04, 0x03, 0x04, 0x02,
+		0x03, 0x70, 0x00, 0x06, 0x00, 0x04, 0x02, 0x06, 0x04, 0x63, 0x09, 0x01, 0x07, 0x07, 0x00, 0x5b,
+		0x08, 0x05, 0x02, 0x00, 0x00, 0x11, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x13,
+		0x01, 0x4c, 0x1b, 0x40, 0x2c, 0x00, 0x02, 0x04, 0x03, 0x04, 0x02, 0x03, 0x70, 0x00, 0x06, 0x00,
+		0x04, 0x02, 0x06, 0x04, 0x63, 0x00, 0x00, 0x00, 0x11, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x05, 0x5b,
+		0x08, 0x01, 0x05, 0x05, 0x19, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x13, 0x01,
+		0x4c, 0x59, 0x59, 0x40, 0x16, 0x2c, 0x2c, 0x00, 0x00, 0x2c, 0x3b, 0x2c, 0x3a, 0x34, 0x32, 0x00,
+		0x2b, 0x00, 0x2a, 0x24, 0x24, 0x17, 0x26, 0x35, 0x0a, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x17, 0x35,
+		0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26,
+		0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x35, 0x06, 0x23,
+		0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+		0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x02, 0x9b, 0xa6, 0x3f, 0x1e, 0x27, 0x02, 0x27, 0x1e,
+		0x65, 0xc0, 0x87, 0x60, 0xc4, 0x55, 0x27, 0x08, 0x12, 0x27, 0x0b, 0x0b, 0x4e, 0xac, 0x4f, 0x8a,
+		0x8c, 0x7c, 0xc1, 0x7c, 0xc3, 0x6f, 0x6f, 0xc3, 0x7c, 0x4f, 0x81, 0x44, 0x44, 0x81, 0x59, 0x59,
+		0x8b, 0x4f, 0x4f, 0x8b, 0x59, 0x03, 0xb2, 0x58, 0x52, 0x5d, 0x23, 0x1e, 0x1e, 0x23, 0xfc, 0x7d,
+		0x77, 0xab, 0x5a, 0x21, 0x1f, 0x0e, 0x27, 0x10, 0x18, 0x37, 0x04, 0x1c, 0x20, 0x83, 0x72, 0xc9,
+		0x9c, 0x6f, 0xd0, 0x8c, 0x8c, 0xd0, 0x6f, 0x94, 0x4f, 0x8d, 0x5b, 0x5b, 0x8d, 0x4f, 0x4a, 0x8d,
+		0x60, 0x60, 0x8d, 0x4a, 0xff, 0xff, 0x00, 0x8b, 0xfe, 0x66, 0x04, 0x0c, 0x05, 0x5c, 0x00, 0x22,
+		0x00, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x82, 0x0a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8b,
+		0xfe, 0x66, 0x04, 0x0c, 0x05, 0x74, 0x00, 0x22, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x92,
+		0x0a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x8b, 0xfe, 0x66, 0x04, 0x0c, 0x05, 0xa4, 0x00, 0x10,
+		0x00, 0x3c, 0x00, 0x4c, 0x00, 0xe4, 0x40, 0x10, 0x0a, 0x01, 0x02, 0x01, 0x00, 0x32, 0x13, 0x02,
+		0x08, 0x09, 0x25, 0x01, 0x03, 0x05, 0x03, 0x4a, 0x4b, 0xb0, 0x24, 0x50, 0x58, 0x40, 0x33, 0x00,
+		0x04, 0x06, 0x05, 0x06, 0x04, 0x05, 0x70, 0x00, 0x00, 0x0a, 0x01, 0x01, 0x02, 0x00, 0x01, 0x63,
+		0x0c, 0x01, 0x09, 0x09, 0x02, 0x5b, 0x0b, 0x07, 0x02, 0x02, 0x02, 0x11, 0x4b, 0x00, 0x08, 0x08,
+		0x06, 0x5b, 0x00, 0x06, 0x06, 0x0f, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x13,
+		0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x31, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04,
+		0x05, 0x70, 0x00, 0x00, 0x0a, 0x01, 0x01, 0x02, 0x00, 0x01, 0x63, 0x00, 0x08, 0x00, 0x06, 0x04,
+		0x08, 0x06, 0x63, 0x0c, 0x01, 0x09, 0x09, 0x02, 0x5b, 0x0b, 0x07, 0x02, 0x02, 0x02, 0x11, 0x4b,
+		0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4c, 0x1b, 0x40, 0x35, 0x00, 0x04,
+		0x06, 0x05, 0x06, 0x04, 0x05, 0x70, 0x00, 0x00, 0x0a, 0x01, 0x01, 0x07, 0x00, 0x01, 0x63, 0x00,
+		0x08, 0x00, 0x06, 0x04, 0x08, 0x06, 0x63, 0x00, 0x02, 0x02, 0x11, 0x4b, 0x0c, 0x01, 0x09, 0x09,
+		0x07, 0x5b, 0x0b, 0x01, 0x07, 0x07, 0x19, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03,
+		0x13, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x22, 0x3d, 0x3d, 0x11, 0x11, 0x00, 0x00, 0x3d, 0x4c, 0x3d,
+		0x4b, 0x45, 0x43, 0x11, 0x3c, 0x11, 0x3b, 0x35, 0x33, 0x2f, 0x2d, 0x29, 0x28, 0x21, 0x1f, 0x19,
+		0x16, 0x00, 0x10, 0x00, 0x0e, 0x15, 0x0d, 0x07, 0x15, 0x2b, 0x00, 0x35, 0x34, 0x37, 0x13, 0x36,
+		0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x23, 0x16, 0x16, 0x17, 0x35, 0x34,
+		0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35,
+		0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x35, 0x06, 0x23, 0x22,
+		0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
+		0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x02, 0x0f, 0x06, 0x75, 0x0f, 0x2c, 0x0b, 0x06, 0x34, 0x02,
+		0x3f, 0x08, 0x22, 0x74, 0x70, 0xa6, 0x3f, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x65, 0xc0, 0x87, 0x60,
+		0xc4, 0x55, 0x27, 0x08, 0x12, 0x27, 0x0b, 0x0b, 0x4e, 0xac, 0x4f, 0x8a, 0x8c, 0x7c, 0xc1, 0x7c,
+		0xc3, 0x6f, 0x6f, 0xc3, 0x7c, 0x4f, 0x81, 0x44, 0x44, 0x81, 0x59, 0x59, 0x8b, 0x4f, 0x4f, 0x8b,
+		0x59, 0x04, 0x28, 0x1a, 0x0c, 0x0d, 0x01, 0x23, 0x26, 0x01, 0x07, 0x25, 0x04, 0x0c, 0xfe, 0xe1,
+		0x20, 0x76, 0x58, 0x52, 0x5d, 0x23, 0x1e, 0x1e, 0x23, 0xfc, 0x7d, 0x77, 0xab, 0x5a, 0x21, 0x1f,
+		0x0e, 0x27, 0x10, 0x18, 0x37, 0x04, 0x1c, 0x20, 0x83, 0x72, 0xc9, 0x9c, 0x6f, 0xd0, 0x8c, 0x8c,
+		0xd0, 0x6f, 0x94, 0x4f, 0x8d, 0x5b, 0x5b, 0x8d, 0x4f, 0x4a, 0x8d, 0x60, 0x60, 0x8d, 0x4a, 0x00,
+		0xff, 0xff, 0x00, 0x8b, 0xfe, 0x66, 0x04, 0x0c, 0x05, 0x53, 0x00, 0x22, 0x00, 0xa0, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x94, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xca, 0xff, 0xf6, 0x04, 0x14,
+		0x05, 0x2a, 0x00, 0x26, 0x00, 0x2d, 0x40, 0x2a, 0x03, 0x01, 0x01, 0x02, 0x01, 0x4a, 0x05, 0x01,
+		0x04, 0x04, 0x10, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x19, 0x4b, 0x03, 0x01,
+		0x01, 0x01, 0x0f, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x24, 0x36, 0x25, 0x35, 0x25, 0x06,
+		0x07, 0x18, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14, 0x06,
+		0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x14, 0x06,
+		0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x01, 0x3f, 0x21, 0x45, 0xcd, 0x65,
+		0x97, 0xa6, 0x21, 0x29, 0x02, 0x29, 0x21, 0x59, 0x5d, 0x56, 0xa7, 0x6b, 0x21, 0x29, 0x02, 0x29,
+		0x21, 0x21, 0x29, 0x02, 0x05, 0x2a, 0x1e, 0x23, 0xfd, 0xe7, 0x66, 0x7c, 0xae, 0x98, 0xfd, 0xcb,
+		0x23, 0x1e, 0x1e, 0x23, 0x02, 0x26, 0x5a, 0x67, 0x6d, 0xbb, 0x6e, 0xfe, 0xaf, 0x23, 0x1e, 0x1e,
+		0x23, 0x04, 0xb2, 0x23, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0xff, 0xf6, 0x04, 0x00,
+		0x05, 0x2a, 0x00, 0x38, 0x00, 0x68, 0xb5, 0x35, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x1b,
+		0x50, 0x58, 0x40, 0x23, 0x00, 0x05, 0x05, 0x10, 0x4b, 0x07, 0x01, 0x03, 0x03, 0x04, 0x5b, 0x06,
+		0x01, 0x04, 0x04, 0x0e, 0x4b, 0x00, 0x01, 0x01, 0x08, 0x5b, 0x09, 0x01, 0x08, 0x08, 0x11, 0x4b,
+		0x02, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x1f, 0x06, 0x01, 0x04, 0x07, 0x01, 0x03,
+		0x08, 0x04, 0x03, 0x63, 0x09, 0x01, 0x08, 0x00, 0x01, 0x00, 0x08, 0x01, 0x63, 0x00, 0x05, 0x05,
+		0x10, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x59, 0x40, 0x11, 0x00, 0x00, 0x00, 0x38,
+		0x00, 0x37, 0x24, 0x23, 0x33, 0x24, 0x23, 0x36, 0x25, 0x35, 0x0a, 0x07, 0x1c, 0x2b, 0x00, 0x16,
+		0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06,
+		0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
+		0x33, 0x33, 0x35, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x15, 0x33, 0x32, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x23, 0x11, 0x36, 0x36, 0x33, 0x03, 0x60, 0xa0, 0x21, 0x29, 0x02, 0x29, 0x21, 0x54,
+		0x58, 0x4e, 0x9a, 0x62, 0x21, 0x29, 0x02, 0x29, 0x21, 0x8b, 0x22, 0x1d, 0x1d, 0x22, 0x8b, 0x21,
+		0x29, 0x02, 0x29, 0x21, 0xfd, 0x22, 0x1d, 0x1d, 0x22, 0xfd, 0x42, 0xb9, 0x5e, 0x03, 0x76, 0xae,
+		0x98, 0xfe, 0x07, 0x23, 0x1e, 0x1e, 0x23, 0x01, 0xea, 0x5a, 0x67, 0x68, 0xb2, 0x68, 0xfe, 0xd7,
+		0x23, 0x1e, 0x1e, 0x23, 0x03, 0xb7, 0x21, 0x27, 0x27, 0x21, 0x6b, 0x23, 0x1e, 0x1e, 0x23, 0x6b,
+		0x21, 0x27, 0x27, 0x21, 0xfe, 0xba, 0x5e, 0x70, 0xff, 0xff, 0x00, 0xca, 0xff, 0xf6, 0x04, 0x14,
+		0x06, 0xe6, 0x00, 0x27, 0x01, 0x92, 0xff, 0xf6, 0x01, 0x72, 0x01, 0x02, 0x00, 0xa5, 0x00, 0x00,
+		0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x72, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xbb,
+		0x00, 0x00, 0x04, 0x49, 0x05, 0x53, 0x00, 0x22, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x94,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xbb, 0x00, 0x00, 0x04, 0x49, 0x03, 0x9c, 0x00, 0x1b,
+		0x00, 0x27, 0x40, 0x24, 0x00, 0x03, 0x03, 0x04, 0x59, 0x05, 0x01, 0x04, 0x04, 0x11, 0x4b, 0x02,
+		0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x1b, 0x00,
+		0x19, 0x21, 0x24, 0x34, 0x23, 0x06, 0x07, 0x18, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x21, 0x32, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x11, 0x23, 0x22, 0x26,
+		0x35, 0x34, 0x36, 0x33, 0x21, 0x02, 0xac, 0x1d, 0x01, 0x41, 0x22, 0x1d, 0x1d, 0x22, 0xfc, 0xf0,
+		0x22, 0x1d, 0x1d, 0x22, 0x01, 0x39, 0xfd, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x54, 0x03, 0x9c, 0x1f,
+		0x25, 0xfd, 0x38, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x02, 0x7c, 0x21, 0x27, 0x27,
+		0x21, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb, 0x00, 0x00, 0x04, 0x49, 0x05, 0x87, 0x00, 0x22,
+		0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb,
+		0x00, 0x00, 0x04, 0x49, 0x05, 0x5c, 0x00, 0x22, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x82,
+		0xf6, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb, 0x00, 0x00, 0x04, 0x49, 0x05, 0x74, 0x00, 0x22,
+		0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x92, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb,
+		0x00, 0x00, 0x04, 0x49, 0x05, 0x53, 0x00, 0x22, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x93,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb, 0x00, 0x00, 0x04, 0x49, 0x05, 0x53, 0x00, 0x22,
+		0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x94, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb,
+		0x00, 0x00, 0x04, 0x49, 0x05, 0x87, 0x00, 0x22, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x95,
+		0xda, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xde, 0xfe, 0x66, 0x03, 0xee, 0x05, 0x53, 0x00, 0x0d,
+		0x00, 0x1b, 0x00, 0x2b, 0x00, 0x48, 0x00, 0x85, 0xb5, 0x37, 0x01, 0x06, 0x08, 0x01, 0x4a, 0x4b,
+		0xb0, 0x19, 0x50, 0x58, 0x40, 0x2c, 0x00, 0x07, 0x04, 0x08, 0x04, 0x07, 0x08, 0x70, 0x02, 0x01,
+		0x00, 0x00, 0x01, 0x5b, 0x03, 0x01, 0x01, 0x01, 0x10, 0x4b, 0x0b, 0x09, 0x0a, 0x03, 0x05, 0x05,
+		0x11, 0x4b, 0x00, 0x04, 0x04, 0x0f, 0x4b, 0x00, 0x08, 0x08, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x13,
+		0x06, 0x4c, 0x1b, 0x40, 0x2a, 0x00, 0x07, 0x04, 0x08, 0x04, 0x07, 0x08, 0x70, 0x03, 0x01, 0x01,
+		0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x63, 0x0b, 0x09, 0x0a, 0x03, 0x05, 0x05, 0x11, 0x4b, 0x00,
+		0x04, 0x04, 0x0f, 0x4b, 0x00, 0x08, 0x08, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4c, 0x59,
+		0x40, 0x1a, 0x2c, 0x2c, 0x1c, 0x1c, 0x2c, 0x48, 0x2c, 0x46, 0x41, 0x3f, 0x3b, 0x3a, 0x33, 0x31,
+		0x1c, 0x2b, 0x1c, 0x29, 0x39, 0x25, 0x25, 0x25, 0x21, 0x0c, 0x07, 0x19, 0x2b, 0x00, 0x06, 0x23,
+		0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x04, 0x06, 0x23, 0x22, 0x26,
+		0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x04, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23,
+		0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x20, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23,
+		0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+		0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x01, 0x9c, 0x28, 0x37, 0x37, 0x28, 0x28, 0x37, 0x37, 0x28,
+		0x02, 0x52, 0x28, 0x37, 0x37, 0x28, 0x28, 0x37, 0x37, 0x28, 0xfd, 0x79, 0x21, 0x21, 0x29, 0x02,
+		0x29, 0x21, 0x21, 0x29, 0x02, 0x02, 0x7b, 0x21, 0x8d, 0x84, 0x37, 0x80, 0x30, 0x27, 0x0b, 0x15,
+		0x24, 0x0c, 0x10, 0x27, 0x5c, 0x2c, 0x3f, 0x3b, 0x21, 0x29, 0x02, 0x04, 0x6c, 0x1d, 0x1d, 0x24,
+		0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82,
+		0xea, 0x1e, 0x23, 0xfc, 0xd2, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x2e, 0x23, 0x1e, 0x1e, 0x23, 0xfc,
+		0x14, 0x86, 0x8d, 0x1a, 0x18, 0x14, 0x21, 0x11, 0x1b, 0x31, 0x07, 0x13, 0x16, 0x4a, 0x53, 0x03,
+		0xce, 0x23, 0x1e, 0x00, 0xff, 0xff, 0x00, 0xbb, 0x00, 0x00, 0x04, 0x49, 0x04, 0xe2, 0x00, 0x22,
+		0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x97, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xbb,
+		0xfe, 0x28, 0x04, 0x49, 0x05, 0x53, 0x00, 0x0d, 0x00, 0x43, 0x00, 0xbb, 0x4b, 0xb0, 0x19, 0x50,
+		0x58, 0x40, 0x2b, 0x04, 0x01, 0x03, 0x00, 0x05, 0x03, 0x05, 0x5f, 0x0b, 0x01, 0x01, 0x01, 0x00,
+		0x5b, 0x00, 0x00, 0x00, 0x10, 0x4b, 0x00, 0x08, 0x08, 0x09, 0x59, 0x00, 0x09, 0x09, 0x11, 0x4b,
+		0x0c, 0x0a, 0x02, 0x07, 0x07, 0x02, 0x59, 0x06, 0x01, 0x02, 0x02, 0x0f, 0x02, 0x4c, 0x1b, 0x4b,
+		0xb0, 0x1b, 0x50, 0x58, 0x40, 0x29, 0x00, 0x00, 0x0b, 0x01, 0x01, 0x09, 0x00, 0x01, 0x63, 0x04,
+		0x01, 0x03, 0x00, 0x05, 0x03, 0x05, 0x5f, 0x00, 0x08, 0x08, 0x09, 0x59, 0x00, 0x09, 0x09, 0x11,
+		0x4b, 0x0c, 0x0a, 0x02, 0x07, 0x07, 0x02, 0x59, 0x06, 0x01, 0x02, 0x02, 0x0f, 0x02, 0x4c, 0x1b,
+		0x40, 0x30, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x70, 0x00, 0x00, 0x0b, 0x01, 0x01, 0x09,
+		0x00, 0x01, 0x63, 0x00, 0x03, 0x00, 0x05, 0x03, 0x05, 0x5f, 0x00, 0x08, 0x08, 0x09, 0x59, 0x00,
+		0x09, 0x09, 0x11, 0x4b, 0x0c, 0x0a, 0x02, 0x07, 0x07, 0x02, 0x59, 0x06, 0x01, 0x02, 0x02, 0x0f,
+		0x02, 0x4c, 0x59, 0x59, 0x40, 0x20, 0x0e, 0x0e, 0x00, 0x00, 0x0e, 0x43, 0x0e, 0x42, 0x3f, 0x3c,
+		0x38, 0x36, 0x35, 0x33, 0x2f, 0x2d, 0x28, 0x26, 0x1f, 0x1c, 0x1b, 0x19, 0x14, 0x12, 0x00, 0x0d,
+		0x00, 0x0c, 0x25, 0x0d, 0x07, 0x15, 0x2b, 0x00, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+		0x15, 0x15, 0x14, 0x06, 0x23, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x06, 0x06, 0x15, 0x14,
+		0x16, 0x33, 0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22,
+		0x26, 0x35, 0x34, 0x36, 0x37, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x11, 0x23, 0x22,
+		0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x32, 0x16, 0x15, 0x11, 0x21, 0x02, 0x33, 0x28, 0x28, 0x37,
+		0x37, 0x28, 0x28, 0x37, 0x01, 0xc2, 0x1d, 0x1d, 0x22, 0xfe, 0xbf, 0x59, 0x4d, 0x2a, 0x23, 0x34,
+		0x3d, 0x08, 0x03, 0x1e, 0x09, 0x02, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b, 0x50, 0x4c, 0xfe, 0xd7,
+		0x22, 0x1d, 0x1d, 0x22, 0x01, 0x39, 0xfd, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x54, 0x22, 0x1d, 0x01,
+		0x41, 0x04, 0x4f, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0xfc, 0x41, 0x21,
+		0x27, 0x27, 0x21, 0x53, 0x7a, 0x37, 0x23, 0x26, 0x11, 0x02, 0x36, 0x12, 0x07, 0x16, 0x19, 0x06,
+		0x1a, 0x68, 0x57, 0x49, 0x8a, 0x46, 0x21, 0x27, 0x27, 0x21, 0x02, 0x7c, 0x21, 0x27, 0x27, 0x21,
+		0x1f, 0x25, 0xfd, 0x38, 0xff, 0xff, 0x00, 0xbb, 0x00, 0x00, 0x04, 0x49, 0x05, 0x2d, 0x00, 0x22,
+		0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x01, 0x9a, 0xec, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbe,
+		0xfe, 0x66, 0x03, 0x87, 0x05, 0x53, 0x00, 0x22, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x03, 0x01, 0x94,
+		0x00, 0xc2, 0x00, 0x00, 0x00, 0x01, 0x00, 0xbe, 0xfe, 0x66, 0x03, 0x87, 0x03, 0x9c, 0x00, 0x21,
+		0x00, 0x34, 0x40, 0x31, 0x0b, 0x01, 0x02, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x03, 0x02, 0x03, 0x01,
+		0x02, 0x70, 0x00, 0x03, 0x03, 0x04, 0x59, 0x05, 0x01, 0x04, 0x04, 0x11, 0x4b, 0x00, 0x02, 0x02,
+		0x00, 0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x1e, 0x23, 0x24,
+		0x17, 0x25, 0x06, 0x07, 0x18, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27,
+		0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x21,
+		0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x33, 0x03, 0x6a, 0x1d, 0x9d, 0xaa, 0x53, 0xc0, 0x4e,
+		0x21, 0x0d, 0x18, 0x22, 0x11, 0x0e, 0x45, 0x94, 0x43, 0x62, 0x4f, 0xfe, 0x59, 0x22, 0x1d, 0x1d,
+		0x22, 0x01, 0xd0, 0x2e, 0x03, 0x9c, 0x1f, 0x25, 0xfc, 0x6f, 0xb0, 0xb1, 0x3f, 0x31, 0x14, 0x20,
+		0x13, 0x1a, 0x2e, 0x0a, 0x2d, 0x36, 0x6a, 0x72, 0x03, 0x38, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xbe, 0xfe, 0x66, 0x04, 0x13, 0x05, 0x74, 0x00, 0x22, 0x01, 0x92, 0x6e, 0x00,
+		0x00, 0x02, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe8, 0xff, 0xf0, 0x04, 0x38,
+		0x05, 0x2a, 0x00, 0x25, 0x00, 0x24, 0x40, 0x21, 0x24, 0x1a, 0x09, 0x08, 0x04, 0x00, 0x03, 0x01,
+		0x4a, 0x00, 0x02, 0x02, 0x10, 0x4b, 0x00, 0x03, 0x03, 0x19, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17,
+		0x00, 0x4c, 0x25, 0x35, 0x36, 0x24, 0x04, 0x07, 0x18, 0x2b, 0x24, 0x15, 0x14, 0x07, 0x06, 0x23,
+		0x22, 0x27, 0x01, 0x07, 0x15, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33,
+		0x33, 0x32, 0x16, 0x15, 0x11, 0x01, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x01,
+		0x04, 0x38, 0x2a, 0x24, 0x18, 0x16, 0x12, 0xfe, 0x88, 0xb4, 0x21, 0x29, 0x02, 0x29, 0x21, 0x21,
+		0x29, 0x02, 0x29, 0x21, 0x02, 0x11, 0x15, 0x1a, 0x1a, 0x1e, 0x2a, 0x15, 0xfe, 0x98, 0x01, 0x81,
+		0x49, 0x12, 0x1b, 0x17, 0x15, 0x13, 0x01, 0x9e, 0x9e, 0xcc, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0xb2,
+		0x23, 0x1e, 0x1e, 0x23, 0xfc, 0xdc, 0x01, 0xd7, 0x12, 0x12, 0x19, 0x1c, 0x14, 0x12, 0xfe, 0xc3,
+		0xfe, 0x5b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xe8, 0xfd, 0xf2, 0x04, 0x38, 0x05, 0x2a, 0x00, 0x22,
+		0x00, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xd2, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb1,
+		0x00, 0x00, 0x04, 0x3f, 0x05, 0x20, 0x00, 0x1c, 0x00, 0x27, 0x40, 0x24, 0x00, 0x02, 0x02, 0x03,
+		0x59, 0x00, 0x03, 0x03, 0x10, 0x4b, 0x05, 0x04, 0x02, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00,
+		0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x1b, 0x44, 0x21, 0x24, 0x34, 0x06, 0x07, 0x18,
+		0x2b, 0x24, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x11,
+		0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x33, 0x32, 0x16, 0x15, 0x11, 0x21, 0x04, 0x22,
+		0x1d, 0x1d, 0x22, 0xfc, 0xf0, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x39, 0xfe, 0xef, 0x22, 0x1d, 0x1d,
+		0x22, 0x01, 0x4e, 0x1a, 0x22, 0x1d, 0x01, 0x41, 0x90, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27,
+		0x21, 0x04, 0x00, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0xfb, 0xb4, 0x00, 0xff, 0xff, 0x00, 0xb1,
+		0x00, 0x00, 0x04, 0x3f, 0x06, 0xf9, 0x00, 0x27, 0x01, 0x80, 0xff, 0xe0, 0x01, 0x72, 0x01, 0x02,
+		0x00, 0xb9, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x72, 0xb0, 0x33, 0x2b, 0x00,
+		0xff, 0xff, 0x00, 0x93, 0x00, 0x00, 0x04, 0x68, 0x05, 0x20, 0x00, 0x22, 0x00, 0xb9, 0xe2, 0x00,
+		0x00, 0x03, 0x01, 0x81, 0x02, 0x5f, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb1, 0xfd, 0xf2, 0x04, 0x3f,
+		0x05, 0x20, 0x00, 0x22, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xcc, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0x93, 0x00, 0x00, 0x04, 0x2d, 0x05, 0x20, 0x00, 0x22, 0x00, 0xb9, 0xe2, 0x00,
+		0x01, 0x07, 0x01, 0x94, 0x01, 0x68, 0xfe, 0x0c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0x0c,
+		0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x00, 0x04, 0x3f, 0x05, 0x20, 0x00, 0x32,
+		0x00, 0x3f, 0x40, 0x3c, 0x30, 0x26, 0x18, 0x0e, 0x04, 0x02, 0x05, 0x01, 0x4a, 0x00, 0x02, 0x05,
+		0x01, 0x05, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x04, 0x59, 0x00, 0x04, 0x04, 0x10, 0x4b, 0x00,
+		0x05, 0x05, 0x19, 0x4b, 0x07, 0x06, 0x02, 0x01, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0f, 0x00,
+		0x4c, 0x00, 0x00, 0x00, 0x32, 0x00, 0x31, 0x25, 0x44, 0x27, 0x23, 0x24, 0x34, 0x08, 0x07, 0x1a,
+		0x2b, 0x24, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x11,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x11, 0x21, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x33, 0x21, 0x33, 0x32, 0x16, 0x15, 0x11, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14,
+		0x07, 0x07, 0x11, 0x21, 0x04, 0x22, 0x1d, 0x1d, 0x22, 0xfc, 0xf0, 0x22, 0x1d, 0x1d, 0x22, 0x01,
+		0x39, 0xaf, 0x18, 0x10, 0x1a, 0x19, 0x12, 0x20, 0xfc, 0xfe, 0xef, 0x22, 0x1d, 0x1d, 0x22, 0x01,
+		0x4e, 0x1a, 0x22, 0x1d, 0xa7, 0x18, 0x10, 0x1a, 0x19, 0x12, 0x20, 0xf4, 0x01, 0x41, 0x90, 0x21,
+		0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x01, 0x9d, 0x77, 0x10, 0x25, 0x1b, 0x12, 0x19, 0x15,
+		0xab, 0x01, 0xbf, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0xfe, 0x5b, 0x72, 0x10, 0x25, 0x1b, 0x12,
+		0x19, 0x15, 0xa6, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x79, 0xff, 0xf6, 0x04, 0x55,
+		0x03, 0xb2, 0x00, 0x3c, 0x00, 0x56, 0xb6, 0x3a, 0x34, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0,
+		0x28, 0x50, 0x58, 0x40, 0x16, 0x03, 0x01, 0x01, 0x01, 0x05, 0x5b, 0x08, 0x07, 0x06, 0x03, 0x05,
+		0x05, 0x11, 0x4b, 0x04, 0x02, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x1a, 0x00, 0x05,
+		0x05, 0x11, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x06, 0x5b, 0x08, 0x07, 0x02, 0x06, 0x06, 0x19, 0x4b,
+		0x04, 0x02, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00, 0x00, 0x3c, 0x00,
+		0x3b, 0x25, 0x35, 0x36, 0x25, 0x36, 0x25, 0x36, 0x09, 0x07, 0x1b, 0x2b, 0x00, 0x16, 0x16, 0x15,
+		0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
+		0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
+		0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15,
+		0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x33, 0x03, 0xc1, 0x5d, 0x37, 0x21, 0x29, 0x02,
+		0x29, 0x21, 0x2d, 0x32, 0x2f, 0x50, 0x2f, 0x21, 0x29, 0x02, 0x29, 0x21, 0x2d, 0x32, 0x2f, 0x50,
+		0x2f, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1b, 0x25, 0x02, 0x25, 0x1b, 0x2b, 0x78, 0x46, 0x44, 0x66,
+		0x12, 0x59, 0x8d, 0x03, 0xb2, 0x3b, 0x79, 0x58, 0xfd, 0x91, 0x23, 0x1e, 0x1e, 0x23, 0x02, 0x5d,
+		0x45, 0x45, 0x57, 0x9b, 0x63, 0xfe, 0x6e, 0x23, 0x1e, 0x1e, 0x23, 0x02, 0x5d, 0x45, 0x45, 0x57,
+		0x9b, 0x63, 0xfe, 0x6e, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x2e, 0x23, 0x1e, 0x1e, 0x23, 0x70, 0x5e,
+		0x5f, 0x5c, 0x59, 0xb5, 0x00, 0x01, 0x00, 0xca, 0xff, 0xf6, 0x04, 0x14, 0x03, 0xb2, 0x00, 0x26,
+		0x00, 0x4c, 0xb5, 0x23, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x13,
+		0x00, 0x01, 0x01, 0x03, 0x5b, 0x05, 0x04, 0x02, 0x03, 0x03, 0x11, 0x4b, 0x02, 0x01, 0x00, 0x00,
+		0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x17, 0x00, 0x03, 0x03, 0x11, 0x4b, 0x00, 0x01, 0x01, 0x04, 0x5b,
+		0x05, 0x01, 0x04, 0x04, 0x19, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x59, 0x40, 0x0d,
+		0x00, 0x00, 0x00, 0x26, 0x00, 0x25, 0x35, 0x36, 0x25, 0x35, 0x06, 0x07, 0x18, 0x2b, 0x00, 0x16,
+		0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06,
+		0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16,
+		0x15, 0x15, 0x36, 0x36, 0x33, 0x03, 0x6e, 0xa6, 0x21, 0x29, 0x02, 0x29, 0x21, 0x59, 0x5d, 0x56,
+		0xa7, 0x6b, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x44, 0xd2, 0x6b, 0x03,
+		0xb2, 0xae, 0x98, 0xfd, 0xcb, 0x23, 0x1e, 0x1e, 0x23, 0x02, 0x26, 0x5a, 0x67, 0x6d, 0xbb, 0x6e,
+		0xfe, 0xaf, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x2e, 0x23, 0x1e, 0x1e, 0x23, 0xa3, 0x69, 0x87, 0x00,
+		0xff, 0xff, 0x00, 0xca, 0xff, 0xf6, 0x04, 0x14, 0x05, 0x87, 0x00, 0x22, 0x00, 0xc0, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x80, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xca, 0xff, 0xf6, 0x04, 0x14,
+		0x05, 0x76, 0x00, 0x22, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x83, 0x0a, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xca, 0xfd, 0xf2, 0x04, 0x14, 0x03, 0xb2, 0x00, 0x22, 0x00, 0xc0, 0x00, 0x00,
+		0x00, 0x03, 0x01, 0x7e, 0x04, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0xca, 0xfe, 0x66, 0x04, 0x14,
+		0x03, 0xb2, 0x00, 0x32, 0x00, 0x75, 0x40, 0x0a, 0x2f, 0x01, 0x04, 0x03, 0x0b, 0x01, 0x00, 0x02,
+		0x02, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x24, 0x00, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02,
+		0x70, 0x00, 0x03, 0x03, 0x05, 0x5b, 0x07, 0x06, 0x02, 0x05, 0x05, 0x11, 0x4b, 0x00, 0x04, 0x04,
+		0x0f, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x1b, 0x40, 0x28,
+		0x00, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x70, 0x00, 0x05, 0x05, 0x11, 0x4b, 0x00, 0x03, 0x03,
+		0x06, 0x5b, 0x07, 0x01, 0x06, 0x06, 0x19, 0x4b, 0x00, 0x04, 0x04, 0x0f, 0x4b, 0x00, 0x02, 0x02,
+		0x00, 0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x59, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x32, 0x00,
+		0x31, 0x35, 0x36, 0x25, 0x23, 0x17, 0x25, 0x08, 0x07, 0x1a, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14,
+		0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x33, 0x32,
+		0x36, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22,
+		0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x15, 0x36, 0x36, 0x33, 0x03, 0x6e,
+		0xa6, 0x8d, 0x84, 0x3a, 0x78, 0x35, 0x27, 0x0b, 0x15, 0x22, 0x0f, 0x0d, 0x60, 0x51, 0x3f, 0x3b,
+		0x59, 0x5d, 0x56, 0xa7, 0x6b, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x44,
+		0xd2, 0x6b, 0x03, 0xb2, 0xae, 0x98, 0xfd, 0x0d, 0x86, 0x8d, 0x1b, 0x17, 0x11, 0x23, 0x10, 0x1b,
+		0x2f, 0x06, 0x28, 0x4a, 0x53, 0x02, 0xc8, 0x5a, 0x67, 0x6d, 0xbb, 0x6e, 0xfe, 0xaf, 0x23, 0x1e,
+		0x1e, 0x23, 0x03, 0x2e, 0x23, 0x1e, 0x1e, 0x23, 0xa3, 0x69, 0x87, 0x00, 0xff, 0xff, 0x00, 0xca,
+		0xff, 0xf6, 0x04, 0x14, 0x05, 0x2d, 0x00, 0x22, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x9a,
+		0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x86, 0xff, 0xea, 0x04, 0x46, 0x03, 0xb2, 0x00, 0x0f,
+		0x00, 0x1f, 0x00, 0x2c, 0x40, 0x29, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5b, 0x04, 0x01, 0x01, 0x01,
+		0x19, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x10, 0x10, 0x00,
+		0x00, 0x10, 0x1f, 0x10, 0x1e, 0x18, 0x16, 0x00, 0x0f, 0x00, 0x0e, 0x26, 0x06, 0x07, 0x15, 0x2b,
+		0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+		0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x02,
+		0xee, 0xdb, 0x7d, 0x7d, 0xdb, 0x88, 0x88, 0xdb, 0x7d, 0x7d, 0xdb, 0x88, 0x61, 0x94, 0x51, 0x51,
+		0x94, 0x61, 0x61, 0x94, 0x51, 0x51, 0x94, 0x61, 0x03, 0xb2, 0x7c, 0xdd, 0x8b, 0x8b, 0xdd, 0x7c,
+		0x7c, 0xdd, 0x8b, 0x8b, 0xdd, 0x7c, 0x94, 0x55, 0x99, 0x62, 0x62, 0x99, 0x55, 0x55, 0x99, 0x62,
+		0x62, 0x99, 0x55, 0x00, 0xff, 0xff, 0x00, 0x86, 0xff, 0xea, 0x04, 0x46, 0x05, 0x87, 0x00, 0x22,
+		0x00, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0xea, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86,
+		0xff, 0xea, 0x04, 0x46, 0x05, 0x5c, 0x00, 0x22, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x82,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86, 0xff, 0xea, 0x04, 0x46, 0x05, 0x74, 0x00, 0x22,
+		0x00, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x92, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86,
+		0xff, 0xea, 0x04, 0x46, 0x05, 0x53, 0x00, 0x22, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x93,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86, 0xff, 0xea, 0x04, 0x46, 0x05, 0x87, 0x00, 0x22,
+		0x00, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x95, 0x16, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86,
+		0xff, 0xea, 0x04, 0x4f, 0x05, 0x76, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc6,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86, 0xff, 0xea, 0x04, 0x46, 0x04, 0xe2, 0x00, 0x22,
+		0x01, 0x97, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x54,
+		0xff, 0xcc, 0x04, 0x78, 0x03, 0xd0, 0x00, 0x27, 0x00, 0x30, 0x00, 0x39, 0x00, 0x6a, 0x40, 0x13,
+		0x22, 0x01, 0x04, 0x02, 0x33, 0x32, 0x2a, 0x29, 0x18, 0x04, 0x06, 0x05, 0x04, 0x0e, 0x01, 0x00,
+		0x05, 0x03, 0x4a, 0x4b, 0xb0, 0x22, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x03, 0x03, 0x19, 0x4b, 0x00,
+		0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00,
+		0x00, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40, 0x1f, 0x00, 0x03, 0x02, 0x03,
+		0x72, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b,
+		0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59, 0x40, 0x09, 0x27, 0x25,
+		0x24, 0x2c, 0x24, 0x2a, 0x06, 0x07, 0x1a, 0x2b, 0x00, 0x15, 0x14, 0x07, 0x07, 0x16, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37,
+		0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37, 0x36, 0x33, 0x32, 0x17,
+		0x00, 0x17, 0x01, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x24, 0x27, 0x01, 0x16, 0x33, 0x32, 0x36,
+		0x36, 0x35, 0x04, 0x78, 0x19, 0x6d, 0x28, 0x2c, 0x7d, 0xdb, 0x88, 0x56, 0x98, 0x3e, 0x6d, 0x19,
+		0x14, 0x16, 0x1c, 0x1a, 0x18, 0x6e, 0x28, 0x2c, 0x7d, 0xdb, 0x88, 0x56, 0x98, 0x3e, 0x6c, 0x19,
+		0x14, 0x17, 0x1c, 0xfc, 0xc2, 0x2a, 0x01, 0xda, 0x50, 0x6e, 0x61, 0x94, 0x51, 0x02, 0x8c, 0x2a,
+		0xfe, 0x25, 0x52, 0x6d, 0x61, 0x94, 0x51, 0x03, 0x98, 0x16, 0x16, 0x18, 0x69, 0x3c, 0x91, 0x50,
+		0x8b, 0xdd, 0x7c, 0x33, 0x2f, 0x69, 0x17, 0x1c, 0x1c, 0x16, 0x15, 0x18, 0x6a, 0x3c, 0x91, 0x50,
+		0x8b, 0xdd, 0x7c, 0x33, 0x2f, 0x69, 0x17, 0x1c, 0xfd, 0xb7, 0x4e, 0x01, 0xca, 0x37, 0x55, 0x99,
+		0x62, 0x63, 0x4e, 0xfe, 0x36, 0x37, 0x55, 0x99, 0x62, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86,
+		0xff, 0xea, 0x04, 0x46, 0x05, 0x2d, 0x00, 0x22, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x9a,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x46, 0xff, 0xea, 0x04, 0x80, 0x03, 0xb2, 0x00, 0x26,
+		0x00, 0x2d, 0x00, 0x39, 0x00, 0x58, 0x40, 0x55, 0x23, 0x01, 0x08, 0x05, 0x19, 0x01, 0x03, 0x01,
+		0x02, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0x07, 0x00, 0x00, 0x02, 0x07,
+		0x00, 0x61, 0x0d, 0x0a, 0x0c, 0x03, 0x08, 0x08, 0x05, 0x5b, 0x0b, 0x06, 0x02, 0x05, 0x05, 0x19,
+		0x4b, 0x09, 0x01, 0x01, 0x01, 0x03, 0x5b, 0x04, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x2e, 0x2e,
+		0x27, 0x27, 0x00, 0x00, 0x2e, 0x39, 0x2e, 0x38, 0x34, 0x32, 0x27, 0x2d, 0x27, 0x2c, 0x2a, 0x29,
+		0x00, 0x26, 0x00, 0x25, 0x24, 0x23, 0x27, 0x23, 0x21, 0x24, 0x0e, 0x07, 0x1a, 0x2b, 0x00, 0x16,
+		0x17, 0x16, 0x06, 0x23, 0x21, 0x12, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15,
+		0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+		0x32, 0x17, 0x36, 0x36, 0x33, 0x06, 0x06, 0x07, 0x21, 0x26, 0x26, 0x23, 0x04, 0x06, 0x15, 0x14,
+		0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x03, 0xed, 0x8c, 0x06, 0x01, 0x1e, 0x22, 0xfe,
+		0x71, 0x05, 0x9f, 0x30, 0x50, 0x2a, 0x11, 0x16, 0x1f, 0x19, 0x15, 0x1b, 0x37, 0x84, 0x48, 0x4e,
+		0x7a, 0x28, 0x4b, 0x9c, 0x9a, 0x9e, 0x9e, 0x9a, 0x9c, 0x4b, 0x28, 0x7a, 0x4e, 0x45, 0x4e, 0x0c,
+		0x01, 0x2c, 0x07, 0x42, 0x42, 0xfd, 0xd8, 0x4b, 0x4b, 0x4f, 0x4f, 0x4b, 0x4b, 0x4f, 0x03, 0xb2,
+		0xe8, 0xd4, 0x21, 0x1d, 0xfe, 0xc3, 0x25, 0x29, 0x11, 0x1f, 0x19, 0x19, 0x1c, 0x19, 0x34, 0x36,
+		0x45, 0x45, 0x8a, 0xfb, 0xe9, 0xe9, 0xfb, 0x8c, 0x46, 0x46, 0x91, 0x68, 0x75, 0x6c, 0x71, 0x03,
+		0xa1, 0xaf, 0xaf, 0xa1, 0xa1, 0xaf, 0xaf, 0xa1, 0x00, 0x02, 0x00, 0xc0, 0xfe, 0x72, 0x04, 0x41,
+		0x03, 0xb2, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x68, 0xb6, 0x1a, 0x09, 0x02, 0x04, 0x05, 0x01, 0x4a,
+		0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1d, 0x07, 0x01, 0x05, 0x05, 0x02, 0x5b, 0x06, 0x03, 0x02,
+		0x02, 0x02, 0x11, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x01,
+		0x01, 0x13, 0x01, 0x4c, 0x1b, 0x40, 0x21, 0x00, 0x02, 0x02, 0x11, 0x4b, 0x07, 0x01, 0x05, 0x05,
+		0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x19, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00,
+		0x17, 0x4b, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4c, 0x59, 0x40, 0x14, 0x1e, 0x1e, 0x00, 0x00, 0x1e,
+		0x2d, 0x1e, 0x2c, 0x26, 0x24, 0x00, 0x1d, 0x00, 0x1c, 0x35, 0x34, 0x26, 0x08, 0x07, 0x17, 0x2b,
+		0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x27, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22,
+		0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x15, 0x36, 0x36, 0x33, 0x0e, 0x02,
+		0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x03, 0x0f, 0xc3,
+		0x6f, 0x6f, 0xc3, 0x7c, 0xbc, 0x81, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1e, 0x27, 0x02, 0x27, 0x1e,
+		0x3f, 0xa6, 0x62, 0x63, 0x8b, 0x4f, 0x4f, 0x8b, 0x59, 0x59, 0x81, 0x44, 0x44, 0x81, 0x59, 0x03,
+		0xb2, 0x75, 0xdb, 0x94, 0x94, 0xdb, 0x75, 0xa5, 0xfe, 0x24, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0xb2,
+		0x23, 0x1e, 0x1e, 0x23, 0x5d, 0x52, 0x58, 0x94, 0x50, 0x98, 0x68, 0x68, 0x98, 0x50, 0x55, 0x99,
+		0x62, 0x62, 0x99, 0x55, 0x00, 0x02, 0x00, 0xc0, 0xfe, 0x72, 0x04, 0x41, 0x05, 0x2a, 0x00, 0x1d,
+		0x00, 0x2d, 0x00, 0x3f, 0x40, 0x3c, 0x10, 0x03, 0x02, 0x04, 0x05, 0x01, 0x4a, 0x06, 0x01, 0x03,
+		0x03, 0x10, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x19, 0x4b, 0x00, 0x04,
+		0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x4b, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4c, 0x1e, 0x1e,
+		0x00, 0x00, 0x1e, 0x2d, 0x1e, 0x2c, 0x26, 0x24, 0x00, 0x1d, 0x00, 0x1b, 0x34, 0x26, 0x25, 0x08,
+		0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
+		0x06, 0x23, 0x22, 0x27, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33,
+		0x33, 0x00, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+		0x23, 0x01, 0x35, 0x21, 0x3e, 0xa1, 0x5e, 0x7c, 0xc3, 0x6f, 0x6f, 0xc3, 0x7c, 0xbc, 0x81, 0x21,
+		0x29, 0x02, 0x29, 0x21, 0x21, 0x29, 0x02, 0x01, 0x24, 0x8b, 0x4f, 0x4f, 0x8b, 0x59, 0x59, 0x81,
+		0x44, 0x44, 0x81, 0x59, 0x05, 0x2a, 0x1e, 0x23, 0xfe, 0x2a, 0x4c, 0x53, 0x75, 0xdb, 0x94, 0x94,
+		0xdb, 0x75, 0xa5, 0xfe, 0x24, 0x23, 0x1e, 0x1e, 0x23, 0x06, 0x36, 0x23, 0x1e, 0xfd, 0xf4, 0x50,
+		0x98, 0x68, 0x68, 0x98, 0x50, 0x55, 0x99, 0x62, 0x62, 0x99, 0x55, 0x00, 0x00, 0x02, 0x00, 0x8b,
+		0xfe, 0x72, 0x04, 0x0c, 0x03, 0xb2, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x68, 0xb6, 0x13, 0x02, 0x02,
+		0x04, 0x05, 0x01, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1d, 0x07, 0x01, 0x05, 0x05, 0x00,
+		0x5b, 0x06, 0x03, 0x02, 0x00, 0x00, 0x11, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02,
+		0x17, 0x4b, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4c, 0x1b, 0x40, 0x21, 0x00, 0x00, 0x00, 0x11, 0x4b,
+		0x07, 0x01, 0x05, 0x05, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x19, 0x4b, 0x00, 0x04, 0x04, 0x02,
+		0x5b, 0x00, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4c, 0x59, 0x40, 0x14, 0x1e,
+		0x1e, 0x00, 0x00, 0x1e, 0x2d, 0x1e, 0x2c, 0x26, 0x24, 0x00, 0x1d, 0x00, 0x1c, 0x24, 0x35, 0x35,
+		0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x17, 0x35, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11,
+		0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
+		0x36, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+		0x23, 0x02, 0x9b, 0xa6, 0x3f, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x21, 0x29, 0x02, 0x29, 0x21, 0x81,
+		0xbc, 0x7c, 0xc3, 0x6f, 0x6f, 0xc3, 0x7c, 0x4f, 0x81, 0x44, 0x44, 0x81, 0x59, 0x59, 0x8b, 0x4f,
+		0x4f, 0x8b, 0x59, 0x03, 0xb2, 0x58, 0x52, 0x5d, 0x23, 0x1e, 0x1e, 0x23, 0xfb, 0x4e, 0x23, 0x1e,
+		0x1e, 0x23, 0x01, 0xdc, 0xa5, 0x75, 0xdb, 0x94, 0x94, 0xdb, 0x75, 0x94, 0x55, 0x99, 0x62, 0x62,
+		0x99, 0x55, 0x50, 0x98, 0x68, 0x68, 0x98, 0x50, 0x00, 0x01, 0x01, 0x33, 0xff, 0xf6, 0x04, 0x3d,
+		0x03, 0xb2, 0x00, 0x24, 0x00, 0x8e, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0a, 0x03, 0x01, 0x00,
+		0x03, 0x21, 0x01, 0x02, 0x00, 0x02, 0x4a, 0x1b, 0x40, 0x0a, 0x03, 0x01, 0x01, 0x03, 0x21, 0x01,
+		0x02, 0x00, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x13, 0x01, 0x01, 0x00, 0x00,
+		0x03, 0x5b, 0x05, 0x04, 0x02, 0x03, 0x03, 0x11, 0x4b, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x4c, 0x1b,
+		0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x70, 0x00,
+		0x01, 0x01, 0x03, 0x5b, 0x05, 0x04, 0x02, 0x03, 0x03, 0x11, 0x4b, 0x00, 0x02, 0x02, 0x0f, 0x02,
+		0x4c, 0x1b, 0x40, 0x1e, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x70, 0x00, 0x03, 0x03, 0x11,
+		0x4b, 0x00, 0x01, 0x01, 0x04, 0x5b, 0x05, 0x01, 0x04, 0x04, 0x19, 0x4b, 0x00, 0x02, 0x02, 0x0f,
+		0x02, 0x4c, 0x59, 0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x23, 0x35, 0x36, 0x22, 0x27,
+		0x06, 0x07, 0x18, 0x2b, 0x00, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x27, 0x26,
+		0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36,
+		0x33, 0x33, 0x32, 0x16, 0x15, 0x15, 0x36, 0x36, 0x33, 0x03, 0xca, 0x42, 0x31, 0x04, 0x09, 0x19,
+		0x13, 0x0b, 0x0b, 0x38, 0x36, 0x73, 0xca, 0x7a, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1e, 0x27, 0x02,
+		0x27, 0x1e, 0x57, 0xee, 0x85, 0x03, 0xb2, 0x15, 0x10, 0x30, 0x10, 0x0f, 0x21, 0x21, 0x04, 0x12,
+		0x8c, 0xed, 0x8b, 0xd7, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x2e, 0x23, 0x1e, 0x1e, 0x23, 0xeb, 0x93,
+		0xa5, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x33, 0xff, 0xf6, 0x04, 0x3d, 0x05, 0x87, 0x00, 0x22,
+		0x01, 0x80, 0x50, 0x00, 0x00, 0x02, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x33,
+		0xff, 0xf6, 0x04, 0x3d, 0x05, 0x76, 0x00, 0x22, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x83,
+		0x46, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x33, 0xfd, 0xf2, 0x04, 0x3d, 0x03, 0xb2, 0x00, 0x22,
+		0x00, 0xd4, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb2,
+		0xff, 0xea, 0x04, 0x18, 0x03, 0xb2, 0x00, 0x3e, 0x00, 0x3f, 0x40, 0x3c, 0x03, 0x01, 0x01, 0x00,
+		0x01, 0x4a, 0x00, 0x03, 0x04, 0x00, 0x04, 0x03, 0x00, 0x70, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01,
+		0x6e, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x19, 0x4b, 0x00, 0x01, 0x01, 0x05, 0x5b,
+		0x06, 0x01, 0x05, 0x05, 0x17, 0x05, 0x4c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3d, 0x2c, 0x2a, 0x27,
+		0x26, 0x20, 0x1e, 0x24, 0x16, 0x07, 0x07, 0x16, 0x2b, 0x04, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36,
+		0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x27, 0x26,
+		0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06,
+		0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16,
+		0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x01, 0x90, 0xb7, 0x27, 0x0c, 0x18, 0x1e, 0x0f,
+		0x10, 0x52, 0xbc, 0x63, 0x7b, 0x7f, 0x29, 0x28, 0x22, 0x5c, 0x48, 0x62, 0x7c, 0x35, 0x47, 0x4f,
+		0x61, 0xa9, 0x6c, 0xe5, 0xad, 0x28, 0x0a, 0x17, 0x1f, 0x0a, 0x14, 0xa3, 0xb3, 0x6a, 0x78, 0x28,
+		0x25, 0x21, 0x52, 0x4b, 0x5d, 0x7e, 0x36, 0x4d, 0x57, 0x5a, 0xb1, 0x7f, 0x16, 0x64, 0x16, 0x23,
+		0x13, 0x19, 0x2f, 0x09, 0x2e, 0x30, 0x53, 0x47, 0x22, 0x2b, 0x0d, 0x0b, 0x0d, 0x07, 0x09, 0x14,
+		0x15, 0x1c, 0x66, 0x52, 0x5c, 0x81, 0x41, 0x57, 0x14, 0x25, 0x14, 0x17, 0x32, 0x09, 0x53, 0x48,
+		0x45, 0x1f, 0x27, 0x0c, 0x0b, 0x0b, 0x07, 0x08, 0x13, 0x14, 0x1d, 0x6b, 0x59, 0x5a, 0x87, 0x4a,
+		0xff, 0xff, 0x00, 0xb2, 0xff, 0xea, 0x04, 0x18, 0x05, 0x87, 0x00, 0x22, 0x00, 0xd8, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x80, 0xea, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xea, 0x04, 0x18,
+		0x05, 0x76, 0x00, 0x22, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x02, 0x01, 0x83, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xb2, 0xfe, 0x28, 0x04, 0x18, 0x03, 0xb2, 0x00, 0x5e, 0x00, 0xf8, 0x40, 0x0e,
+		0x27, 0x01, 0x07, 0x06, 0x23, 0x01, 0x00, 0x07, 0x0f, 0x01, 0x02, 0x04, 0x03, 0x4a, 0x4b, 0xb0,
+		0x0a, 0x50, 0x58, 0x40, 0x3f, 0x00, 0x09, 0x0a, 0x06, 0x0a, 0x09, 0x06, 0x70, 0x00, 0x06, 0x07,
+		0x0a, 0x06, 0x07, 0x6e, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x68, 0x00, 0x05, 0x03, 0x00, 0x05,
+		0x66, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x00,
+		0x0a, 0x0a, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x19, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00,
+		0x00, 0x17, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x40, 0x00, 0x09, 0x0a, 0x06,
+		0x0a, 0x09, 0x06, 0x70, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x07, 0x6e, 0x00, 0x01, 0x00, 0x05, 0x00,
+		0x01, 0x05, 0x70, 0x00, 0x05, 0x03, 0x00, 0x05, 0x66, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e,
+		0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x00, 0x0a, 0x0a, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x19,
+		0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x41, 0x00,
+		0x09, 0x0a, 0x06, 0x0a, 0x09, 0x06, 0x70, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x07, 0x6e, 0x00, 0x01,
+		0x00, 0x05, 0x00, 0x01, 0x05, 0x70, 0x00, 0x05, 0x03, 0x00, 0x05, 0x03, 0x6e, 0x00, 0x03, 0x04,
+		0x00, 0x03, 0x04, 0x6e, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x00, 0x0a, 0x0a, 0x08, 0x5b,
+		0x00, 0x08, 0x08, 0x19, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c,
+		0x59, 0x59, 0x40, 0x11, 0x50, 0x4e, 0x4b, 0x4a, 0x44, 0x42, 0x24, 0x1b, 0x24, 0x24, 0x17, 0x24,
+		0x11, 0x12, 0x0b, 0x07, 0x1c, 0x2b, 0x24, 0x06, 0x06, 0x07, 0x15, 0x36, 0x16, 0x15, 0x14, 0x06,
+		0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32,
+		0x36, 0x35, 0x34, 0x26, 0x23, 0x07, 0x22, 0x26, 0x35, 0x35, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37,
+		0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x27,
+		0x26, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07,
+		0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16,
+		0x16, 0x17, 0x16, 0x16, 0x15, 0x04, 0x18, 0x53, 0xa4, 0x76, 0x65, 0x66, 0x7c, 0x79, 0x44, 0x80,
+		0x33, 0x17, 0x08, 0x11, 0x1d, 0x08, 0x05, 0x2b, 0x67, 0x2f, 0x33, 0x3a, 0x36, 0x3e, 0x27, 0x0f,
+		0x13, 0xbf, 0x8f, 0x27, 0x0c, 0x18, 0x1e, 0x0f, 0x10, 0x52, 0xbc, 0x63, 0x7b, 0x7f, 0x29, 0x28,
+		0x22, 0x5c, 0x48, 0x62, 0x7c, 0x35, 0x47, 0x4f, 0x61, 0xa9, 0x6c, 0xe5, 0xad, 0x28, 0x0a, 0x17,
+		0x1f, 0x0a, 0x14, 0xa3, 0xb3, 0x6a, 0x78, 0x28, 0x25, 0x21, 0x52, 0x4b, 0x5d, 0x7e, 0x36, 0x4d,
+		0x57, 0xbe, 0x83, 0x4c, 0x04, 0x5c, 0x01, 0x5e, 0x4b, 0x57, 0x68, 0x18, 0x18, 0x0a, 0x19, 0x0e,
+		0x15, 0x2d, 0x02, 0x10, 0x16, 0x21, 0x1f, 0x21, 0x20, 0x01, 0x15, 0x17, 0x9f, 0x11, 0x4f, 0x16,
+		0x23, 0x13, 0x19, 0x2f, 0x09, 0x2e, 0x30, 0x53, 0x47, 0x22, 0x2b, 0x0d, 0x0b, 0x0d, 0x07, 0x09,
+		0x14, 0x15, 0x1c, 0x66, 0x52, 0x5c, 0x81, 0x41, 0x57, 0x14, 0x25, 0x14, 0x17, 0x32, 0x09, 0x53,
+		0x48, 0x45, 0x1f, 0x27, 0x0c, 0x0b, 0x0b, 0x07, 0x08, 0x13, 0x14, 0x1d, 0x6b, 0x59, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xb2, 0xff, 0xea, 0x04, 0x18, 0x05, 0x74, 0x00, 0x22, 0x01, 0x92, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb2, 0xfd, 0xf2, 0x04, 0x18,
+		0x03, 0xb2, 0x00, 0x22, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7e, 0x04, 0xbe, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xeb, 0xff, 0xea, 0x04, 0x0d, 0x05, 0x25, 0x00, 0x35, 0x00, 0x65, 0xb5, 0x06,
+		0x01, 0x02, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x02, 0x03, 0x01,
+		0x03, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x10, 0x4b, 0x00,
+		0x01, 0x01, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x23, 0x00, 0x02,
+		0x03, 0x01, 0x03, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x10,
+		0x4b, 0x00, 0x04, 0x04, 0x0f, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00,
+		0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x35, 0x00, 0x34, 0x35, 0x2a, 0x24, 0x24, 0x2c, 0x07,
+		0x07, 0x19, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+		0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x26, 0x35,
+		0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x14, 0x06, 0x23,
+		0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x36, 0x33, 0x02, 0xd7, 0xaa, 0x55, 0x5a, 0x52, 0x6b,
+		0x78, 0x64, 0xb6, 0x79, 0x32, 0x21, 0x1e, 0x22, 0x7e, 0x8e, 0x8a, 0x76, 0x22, 0x1d, 0x1d, 0x22,
+		0x62, 0x67, 0x75, 0x6d, 0x67, 0x72, 0x21, 0x29, 0x02, 0x29, 0x21, 0x59, 0xa8, 0x72, 0x05, 0x25,
+		0x5b, 0x9c, 0x63, 0x5b, 0x87, 0x2b, 0x29, 0xb2, 0x7b, 0x76, 0xad, 0x5b, 0x21, 0x2c, 0x25, 0x22,
+		0x7a, 0x72, 0x7a, 0x87, 0x21, 0x24, 0x24, 0x20, 0x03, 0x0a, 0x70, 0x5a, 0x5d, 0x69, 0x7f, 0x6e,
+		0xfc, 0x93, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x78, 0x6e, 0xa9, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x75,
+		0xff, 0xea, 0x04, 0x48, 0x04, 0xb9, 0x00, 0x2d, 0x00, 0x30, 0x40, 0x2d, 0x00, 0x07, 0x01, 0x06,
+		0x01, 0x07, 0x06, 0x70, 0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x07, 0x02, 0x01, 0x61, 0x00, 0x03,
+		0x03, 0x16, 0x4b, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x23, 0x23,
+		0x24, 0x23, 0x23, 0x24, 0x23, 0x25, 0x08, 0x07, 0x1c, 0x2b, 0x24, 0x15, 0x14, 0x07, 0x06, 0x06,
+		0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11, 0x34, 0x36,
+		0x33, 0x32, 0x16, 0x15, 0x11, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x14, 0x16,
+		0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x04, 0x48, 0x21, 0x4e, 0xc0, 0x53, 0xaa, 0x9d,
+		0xcb, 0x22, 0x1d, 0x1d, 0x22, 0xcb, 0x22, 0x29, 0x29, 0x22, 0x01, 0x9b, 0x22, 0x1d, 0x1d, 0x22,
+		0xfe, 0x65, 0x50, 0x61, 0x43, 0x94, 0x45, 0x0e, 0x11, 0x22, 0x18, 0xa1, 0x13, 0x20, 0x14, 0x31,
+		0x3f, 0xb1, 0xb0, 0x01, 0x71, 0x21, 0x27, 0x27, 0x21, 0x01, 0x2c, 0x23, 0x1e, 0x1e, 0x23, 0xfe,
+		0xd4, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x9c, 0x72, 0x6a, 0x36, 0x2d, 0x0a, 0x2e, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x75, 0xff, 0xea, 0x04, 0x48, 0x04, 0xb9, 0x00, 0x3f, 0x00, 0x41, 0x40, 0x3e,
+		0x00, 0x0b, 0x01, 0x0a, 0x01, 0x0b, 0x0a, 0x70, 0x06, 0x01, 0x04, 0x07, 0x01, 0x03, 0x02, 0x04,
+		0x03, 0x61, 0x08, 0x01, 0x02, 0x09, 0x01, 0x01, 0x0b, 0x02, 0x01, 0x63, 0x00, 0x05, 0x05, 0x16,
+		0x4b, 0x00, 0x0a, 0x0a, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x3e, 0x3c, 0x39, 0x37,
+		0x34, 0x32, 0x21, 0x24, 0x23, 0x23, 0x24, 0x21, 0x24, 0x23, 0x25, 0x0c, 0x07, 0x1d, 0x2b, 0x24,
+		0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
+		0x33, 0x33, 0x35, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11, 0x34, 0x36, 0x33, 0x32,
+		0x16, 0x15, 0x11, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x15, 0x33, 0x32, 0x16, 0x15,
+		0x14, 0x06, 0x23, 0x23, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x04,
+		0x48, 0x21, 0x4e, 0xc0, 0x53, 0xaa, 0x9d, 0x78, 0x22, 0x1d, 0x1d, 0x22, 0x78, 0xcb, 0x22, 0x1d,
+		0x1d, 0x22, 0xcb, 0x22, 0x29, 0x29, 0x22, 0x01, 0x9b, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0x65, 0xfc,
+		0x22, 0x1d, 0x1d, 0x22, 0xfc, 0x50, 0x61, 0x43, 0x94, 0x45, 0x0e, 0x11, 0x22, 0x18, 0xa1, 0x13,
+		0x20, 0x14, 0x31, 0x3f, 0xb1, 0xb0, 0x4b, 0x21, 0x27, 0x27, 0x21, 0x96, 0x21, 0x27, 0x27, 0x21,
+		0x01, 0x2c, 0x23, 0x1e, 0x1e, 0x23, 0xfe, 0xd4, 0x21, 0x27, 0x27, 0x21, 0x96, 0x21, 0x27, 0x27,
+		0x21, 0x3e, 0x72, 0x6a, 0x36, 0x2d, 0x0a, 0x2e, 0xff, 0xff, 0x00, 0x75, 0xff, 0xea, 0x04, 0x48,
+		0x05, 0x78, 0x00, 0x22, 0x00, 0xdf, 0x00, 0x00, 0x01, 0x07, 0x01, 0x7e, 0x05, 0xe4, 0x06, 0x0a,
+		0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x06, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x75,
+		0xfe, 0x28, 0x04, 0x48, 0x04, 0xb9, 0x00, 0x4e, 0x00, 0xf1, 0x40, 0x0a, 0x27, 0x01, 0x00, 0x0b,
+		0x13, 0x01, 0x02, 0x04, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x3d, 0x00, 0x0c, 0x06,
+		0x0b, 0x06, 0x0c, 0x0b, 0x70, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x68, 0x00, 0x05, 0x03, 0x00,
+		0x05, 0x66, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x09, 0x01, 0x07, 0x0a, 0x01, 0x06, 0x0c,
+		0x07, 0x06, 0x61, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60, 0x00, 0x08, 0x08, 0x16, 0x4b, 0x00,
+		0x0b, 0x0b, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58,
+		0x40, 0x3e, 0x00, 0x0c, 0x06, 0x0b, 0x06, 0x0c, 0x0b, 0x70, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01,
+		0x05, 0x70, 0x00, 0x05, 0x03, 0x00, 0x05, 0x66, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x09,
+		0x01, 0x07, 0x0a, 0x01, 0x06, 0x0c, 0x07, 0x06, 0x61, 0x00, 0x04, 0x00, 0x02, 0x04, 0x02, 0x60,
+		0x00, 0x08, 0x08, 0x16, 0x4b, 0x00, 0x0b, 0x0b, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c,
+		0x1b, 0x40, 0x3f, 0x00, 0x0c, 0x06, 0x0b, 0x06, 0x0c, 0x0b, 0x70, 0x00, 0x01, 0x00, 0x05, 0x00,
+		0x01, 0x05, 0x70, 0x00, 0x05, 0x03, 0x00, 0x05, 0x03, 0x6e, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04,
+		0x6e, 0x09, 0x01, 0x07, 0x0a, 0x01, 0x06, 0x0c, 0x07, 0x06, 0x61, 0x00, 0x04, 0x00, 0x02, 0x04,
+		0x02, 0x60, 0x00, 0x08, 0x08, 0x16, 0x4b, 0x00, 0x0b, 0x0b, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17,
+		0x00, 0x4c, 0x59, 0x59, 0x40, 0x14, 0x4d, 0x4b, 0x48, 0x46, 0x43, 0x41, 0x3d, 0x3b, 0x23, 0x24,
+		0x28, 0x24, 0x24, 0x17, 0x24, 0x12, 0x15, 0x0d, 0x07, 0x1d, 0x2b, 0x24, 0x15, 0x14, 0x07, 0x06,
+		0x06, 0x23, 0x23, 0x15, 0x36, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x07, 0x22,
+		0x26, 0x35, 0x35, 0x26, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11,
+		0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11,
+		0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x04, 0x48, 0x21, 0x4e, 0xc0, 0x53,
+		0x07, 0x65, 0x66, 0x7c, 0x79, 0x44, 0x80, 0x33, 0x17, 0x08, 0x11, 0x1d, 0x08, 0x05, 0x2b, 0x67,
+		0x2f, 0x33, 0x3a, 0x36, 0x3e, 0x27, 0x0f, 0x13, 0x61, 0x5b, 0xcb, 0x22, 0x1d, 0x1d, 0x22, 0xcb,
+		0x22, 0x29, 0x29, 0x22, 0x01, 0x9b, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0x65, 0x50, 0x61, 0x43, 0x94,
+		0x45, 0x0e, 0x11, 0x22, 0x18, 0xa1, 0x13, 0x20, 0x14, 0x31, 0x3f, 0x5b, 0x01, 0x5e, 0x4b, 0x57,
+		0x68, 0x18, 0x18, 0x0a, 0x19, 0x0e, 0x15, 0x2d, 0x02, 0x10, 0x16, 0x21, 0x1f, 0x21, 0x20, 0x01,
+		0x15, 0x17, 0xae, 0x20, 0xa7, 0x87, 0x01, 0x71, 0x21, 0x27, 0x27, 0x21, 0x01, 0x2c, 0x23, 0x1e,
+		0x1e, 0x23, 0xfe, 0xd4, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x9c, 0x72, 0x6a, 0x36, 0x2d, 0x0a, 0x2e,
+		0xff, 0xff, 0x00, 0x75, 0xfd, 0xf2, 0x04, 0x48, 0x04, 0xb9, 0x00, 0x22, 0x00, 0xdf, 0x00, 0x00,
+		0x00, 0x03, 0x01, 0x7e, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0xff, 0xea, 0x04, 0x02,
+		0x03, 0xa6, 0x00, 0x26, 0x00, 0x4c, 0xb5, 0x0b, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x28,
+		0x50, 0x58, 0x40, 0x13, 0x05, 0x04, 0x02, 0x02, 0x02, 0x11, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b,
+		0x01, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1b, 0x40, 0x17, 0x05, 0x04, 0x02, 0x02, 0x02, 0x11,
+		0x4b, 0x00, 0x00, 0x00, 0x0f, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x01,
+		0x4c, 0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x24, 0x25, 0x35, 0x25, 0x35, 0x06, 0x07,
+		0x18, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35, 0x06, 0x06,
+		0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14, 0x16, 0x33,
+		0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x03, 0xe1, 0x21, 0x1e, 0x27, 0x02, 0x27,
+		0x1e, 0x44, 0xd2, 0x6b, 0x97, 0xa6, 0x21, 0x29, 0x02, 0x29, 0x21, 0x59, 0x5d, 0x56, 0xa7, 0x6b,
+		0x21, 0x29, 0x02, 0x03, 0xa6, 0x1e, 0x23, 0xfc, 0xd2, 0x23, 0x1e, 0x1e, 0x23, 0xa3, 0x69, 0x87,
+		0xae, 0x98, 0x02, 0x35, 0x23, 0x1e, 0x1e, 0x23, 0xfd, 0xda, 0x5a, 0x67, 0x6d, 0xbb, 0x6e, 0x01,
+		0x51, 0x23, 0x1e, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xea, 0x04, 0x02, 0x05, 0x87, 0x00, 0x22,
+		0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8,
+		0xff, 0xea, 0x04, 0x02, 0x05, 0x5c, 0x00, 0x22, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x82,
+		0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xea, 0x04, 0x02, 0x05, 0x74, 0x00, 0x22,
+		0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x92, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8,
+		0xff, 0xea, 0x04, 0x02, 0x05, 0x53, 0x00, 0x22, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x93,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xea, 0x04, 0x02, 0x05, 0x87, 0x00, 0x22,
+		0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x95, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8,
+		0xff, 0xea, 0x04, 0x3b, 0x05, 0x76, 0x00, 0x22, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x96,
+		0xec, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xea, 0x04, 0x05, 0x04, 0xe2, 0x00, 0x22,
+		0x01, 0x97, 0x00, 0x00, 0x00, 0x02, 0x00, 0xe4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8,
+		0xfe, 0x28, 0x04, 0x39, 0x03, 0xa6, 0x00, 0x38, 0x00, 0x35, 0x40, 0x32, 0x1d, 0x01, 0x04, 0x03,
+		0x1c, 0x03, 0x02, 0x02, 0x04, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x60, 0x06, 0x05,
+		0x02, 0x03, 0x03, 0x11, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c,
+		0x00, 0x00, 0x00, 0x38, 0x00, 0x36, 0x25, 0x35, 0x28, 0x28, 0x2b, 0x07, 0x07, 0x19, 0x2b, 0x00,
+		0x16, 0x15, 0x11, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x16,
+		0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x35, 0x06, 0x06, 0x23,
+		0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14, 0x16, 0x33, 0x32,
+		0x36, 0x36, 0x35, 0x11, 0x34, 0x36, 0x33, 0x33, 0x03, 0xe1, 0x21, 0x07, 0x09, 0x5b, 0x50, 0x2a,
+		0x23, 0x37, 0x3a, 0x18, 0x1c, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b, 0x67, 0x64, 0x44, 0xd2, 0x6b,
+		0x97, 0xa6, 0x21, 0x29, 0x02, 0x29, 0x21, 0x59, 0x5d, 0x56, 0xa7, 0x6b, 0x21, 0x29, 0x02, 0x03,
+		0xa6, 0x1e, 0x23, 0xfc, 0xd2, 0x13, 0x18, 0x08, 0x54, 0x7d, 0x38, 0x24, 0x27, 0x0a, 0x04, 0x23,
+		0x27, 0x14, 0x18, 0x06, 0x1a, 0x68, 0x57, 0x51, 0x98, 0x50, 0xba, 0x69, 0x87, 0xae, 0x98, 0x02,
+		0x35, 0x23, 0x1e, 0x1e, 0x23, 0xfd, 0xda, 0x5a, 0x67, 0x6d, 0xbb, 0x6e, 0x01, 0x51, 0x23, 0x1e,
+		0xff, 0xff, 0x00, 0xb8, 0xff, 0xea, 0x04, 0x02, 0x06, 0x15, 0x00, 0x22, 0x00, 0xe4, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x99, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xea, 0x04, 0x02,
+		0x05, 0x2d, 0x00, 0x22, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x01, 0x9a, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x7c, 0xff, 0xea, 0x04, 0x50, 0x03, 0xa8, 0x00, 0x1d, 0x00, 0x32, 0xb5, 0x17,
+		0x01, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x0c, 0x02, 0x01, 0x01, 0x01,
+		0x11, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x0c, 0x02, 0x01, 0x01, 0x01, 0x19,
+		0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59, 0xb5, 0x26, 0x29, 0x27, 0x03, 0x07, 0x17, 0x2b,
+		0x00, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x01, 0x26, 0x35, 0x34,
+		0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x17, 0x01, 0x01, 0x36, 0x36, 0x33, 0x32, 0x17, 0x04, 0x36,
+		0x1a, 0x09, 0xfe, 0x95, 0x0f, 0x36, 0x31, 0x31, 0x36, 0x0f, 0xfe, 0x95, 0x09, 0x1a, 0x1b, 0x1b,
+		0x13, 0x11, 0x18, 0x0a, 0x01, 0x54, 0x01, 0x54, 0x0a, 0x18, 0x11, 0x13, 0x1b, 0x03, 0x91, 0x1b,
+		0x12, 0x0f, 0x14, 0xfc, 0xe7, 0x21, 0x1d, 0x1d, 0x21, 0x03, 0x19, 0x13, 0x10, 0x12, 0x1b, 0x0b,
+		0x0c, 0x14, 0x16, 0xfd, 0x11, 0x02, 0xef, 0x16, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3a,
+		0xff, 0xea, 0x04, 0x92, 0x03, 0xa6, 0x00, 0x2b, 0x00, 0x2d, 0x40, 0x2a, 0x16, 0x02, 0x02, 0x03,
+		0x02, 0x25, 0x1f, 0x0c, 0x03, 0x00, 0x03, 0x02, 0x4a, 0x00, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00,
+		0x70, 0x04, 0x01, 0x02, 0x02, 0x11, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x15, 0x25,
+		0x29, 0x26, 0x27, 0x05, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x06, 0x23,
+		0x22, 0x26, 0x27, 0x03, 0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x26, 0x35, 0x34, 0x36,
+		0x37, 0x36, 0x33, 0x32, 0x16, 0x17, 0x13, 0x13, 0x36, 0x33, 0x32, 0x17, 0x13, 0x13, 0x36, 0x36,
+		0x33, 0x32, 0x17, 0x04, 0x76, 0x1c, 0x04, 0xc7, 0x09, 0x23, 0x26, 0x2b, 0x30, 0x0b, 0xa9, 0xa9,
+		0x0b, 0x30, 0x2b, 0x26, 0x23, 0x09, 0xc7, 0x04, 0x1c, 0x20, 0x11, 0x10, 0x17, 0x19, 0x06, 0x9f,
+		0xaf, 0x10, 0x3b, 0x3b, 0x10, 0xaf, 0x9f, 0x06, 0x19, 0x17, 0x10, 0x11, 0x03, 0x9c, 0x19, 0x15,
+		0x0e, 0x0f, 0xfc, 0xda, 0x24, 0x1d, 0x1f, 0x22, 0x02, 0x00, 0xfe, 0x00, 0x22, 0x1f, 0x1d, 0x24,
+		0x03, 0x26, 0x0f, 0x0e, 0x15, 0x19, 0x06, 0x04, 0x18, 0x1b, 0xfd, 0x5f, 0x02, 0x15, 0x2f, 0x2f,
+		0xfd, 0xeb, 0x02, 0xa1, 0x1b, 0x18, 0x04, 0x00, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xea, 0x04, 0x92,
+		0x05, 0x87, 0x00, 0x22, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0x14, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0x3a, 0xff, 0xea, 0x04, 0x92, 0x05, 0x74, 0x00, 0x22, 0x00, 0xf0, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x92, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xea, 0x04, 0x92,
+		0x05, 0x53, 0x00, 0x22, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0x3a, 0xff, 0xea, 0x04, 0x92, 0x05, 0x87, 0x00, 0x22, 0x00, 0xf0, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x95, 0xec, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa7, 0xff, 0xf1, 0x04, 0x31,
+		0x03, 0xab, 0x00, 0x27, 0x00, 0x22, 0x40, 0x1f, 0x26, 0x23, 0x1c, 0x12, 0x0f, 0x08, 0x06, 0x00,
+		0x02, 0x01, 0x4a, 0x03, 0x01, 0x02, 0x02, 0x19, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c,
+		0x24, 0x2c, 0x24, 0x24, 0x04, 0x07, 0x18, 0x2b, 0x24, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27,
+		0x01, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x01, 0x26, 0x35, 0x34, 0x37,
+		0x36, 0x33, 0x32, 0x17, 0x01, 0x01, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x01,
+		0x04, 0x31, 0x2c, 0x21, 0x16, 0x1d, 0x1a, 0xfe, 0xd5, 0xfe, 0xd5, 0x1a, 0x1d, 0x16, 0x21, 0x2c,
+		0x11, 0x01, 0x48, 0xfe, 0xc5, 0x12, 0x2d, 0x21, 0x16, 0x1d, 0x1a, 0x01, 0x1e, 0x01, 0x1e, 0x1a,
+		0x1d, 0x16, 0x21, 0x2d, 0x12, 0xfe, 0xc5, 0x01, 0x48, 0x45, 0x13, 0x1e, 0x14, 0x0f, 0x1e, 0x01,
+		0x60, 0xfe, 0xa0, 0x1e, 0x0f, 0x14, 0x1e, 0x13, 0x14, 0x01, 0x7e, 0x01, 0x6c, 0x15, 0x12, 0x1e,
+		0x14, 0x0f, 0x1e, 0xfe, 0xb4, 0x01, 0x4c, 0x1e, 0x0f, 0x14, 0x1e, 0x12, 0x15, 0xfe, 0x94, 0xfe,
+		0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7b, 0xfe, 0x70, 0x04, 0x50, 0x03, 0xa8, 0x00, 0x21,
+		0x00, 0x33, 0xb6, 0x1b, 0x10, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40,
+		0x0c, 0x02, 0x01, 0x01, 0x01, 0x11, 0x4b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x1b, 0x40, 0x0c,
+		0x02, 0x01, 0x01, 0x01, 0x19, 0x4b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x59, 0xb5, 0x26, 0x2d,
+		0x27, 0x03, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x06, 0x23, 0x22, 0x27,
+		0x26, 0x26, 0x35, 0x34, 0x37, 0x13, 0x01, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x16, 0x17,
+		0x01, 0x01, 0x36, 0x36, 0x33, 0x32, 0x17, 0x04, 0x36, 0x1a, 0x0a, 0xfd, 0xab, 0x0b, 0x18, 0x10,
+		0x12, 0x1b, 0x1b, 0x19, 0x0a, 0xab, 0xfe, 0x73, 0x0a, 0x36, 0x1b, 0x12, 0x11, 0x18, 0x0b, 0x01,
+		0x55, 0x01, 0x53, 0x0b, 0x18, 0x11, 0x12, 0x1b, 0x03, 0x91, 0x1b, 0x12, 0x10, 0x13, 0xfb, 0x59,
+		0x16, 0x14, 0x0c, 0x0b, 0x1b, 0x11, 0x10, 0x14, 0x01, 0x54, 0x03, 0x16, 0x13, 0x10, 0x22, 0x16,
+		0x0c, 0x14, 0x16, 0xfd, 0x55, 0x02, 0xab, 0x16, 0x14, 0x0c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7b,
+		0xfe, 0x70, 0x04, 0x50, 0x05, 0x87, 0x00, 0x22, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7b, 0xfe, 0x70, 0x04, 0x50, 0x05, 0x74, 0x00, 0x22,
+		0x00, 0xf6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x92, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7b,
+		0xfe, 0x70, 0x04, 0x50, 0x05, 0x53, 0x00, 0x22, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x93,
+		0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7b, 0xfe, 0x70, 0x04, 0x50, 0x05, 0x87, 0x00, 0x22,
+		0x00, 0xf6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb2,
+		0x00, 0x00, 0x04, 0x1a, 0x03, 0x9c, 0x00, 0x1d, 0x00, 0x25, 0x40, 0x22, 0x00, 0x01, 0x01, 0x02,
+		0x59, 0x00, 0x02, 0x02, 0x11, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f,
+		0x00, 0x4c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1c, 0x44, 0x25, 0x44, 0x05, 0x07, 0x17, 0x2b, 0x24,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x01, 0x21, 0x22, 0x26,
+		0x35, 0x34, 0x36, 0x33, 0x21, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0x01, 0x21, 0x03, 0xfd, 0x1d,
+		0x1d, 0x22, 0xfd, 0x70, 0x5a, 0x22, 0x1d, 0x0e, 0x02, 0x5c, 0xfd, 0xe9, 0x22, 0x1d, 0x1d, 0x22,
+		0x02, 0x74, 0x58, 0x22, 0x1d, 0x0f, 0xfd, 0xa5, 0x02, 0x35, 0x90, 0x21, 0x27, 0x27, 0x21, 0x1f,
+		0x25, 0x1e, 0x0f, 0x02, 0x9b, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x1d, 0x11, 0xfd, 0x66, 0x00,
+		0xff, 0xff, 0x00, 0xb2, 0x00, 0x00, 0x04, 0x1a, 0x05, 0x87, 0x00, 0x22, 0x00, 0xfb, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x80, 0xf4, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb2, 0x00, 0x00, 0x04, 0x1a,
+		0x05, 0x76, 0x00, 0x22, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x02, 0x01, 0x83, 0x0a, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xb2, 0x00, 0x00, 0x04, 0x1a, 0x05, 0x53, 0x00, 0x22, 0x00, 0xfb, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0x94, 0x0a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xf6, 0x09, 0x15,
+		0x05, 0x53, 0x00, 0x22, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x23, 0x00, 0xa9, 0x04, 0xcc, 0x00, 0x00,
+		0x00, 0x03, 0x01, 0x94, 0x04, 0xd0, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xf6, 0x09, 0x0b,
+		0x05, 0x25, 0x00, 0x22, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb9, 0x04, 0xcc, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0xfc, 0x01, 0xd1, 0x03, 0x9f, 0x04, 0xb9, 0x00, 0x26, 0x00, 0x30, 0x00, 0x08,
+		0xb5, 0x2a, 0x27, 0x0c, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23,
+		0x22, 0x26, 0x35, 0x35, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x17, 0x35,
+		0x34, 0x23, 0x22, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x02,
+		0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x35, 0x26, 0x23, 0x03, 0x0f, 0x90, 0x1c, 0x1f, 0x02, 0x1f,
+		0x1c, 0x85, 0x98, 0x4e, 0x7a, 0x46, 0xaa, 0x88, 0x84, 0x66, 0x94, 0x78, 0x70, 0x0e, 0x0c, 0x1c,
+		0x14, 0x10, 0x17, 0x3d, 0x9f, 0x4f, 0xfb, 0x47, 0x3e, 0x93, 0x77, 0x6d, 0x72, 0x04, 0xb9, 0x85,
+		0x7a, 0xfe, 0x52, 0x1a, 0x18, 0x18, 0x1a, 0x36, 0x71, 0x33, 0x64, 0x47, 0x7a, 0x76, 0x1c, 0x33,
+		0x82, 0x41, 0x08, 0x23, 0x1c, 0x13, 0x18, 0x0f, 0x26, 0x2b, 0xfe, 0x68, 0x6f, 0x30, 0x34, 0x75,
+		0x45, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0xeb, 0x01, 0xd1, 0x03, 0xe1, 0x04, 0xb9, 0x00, 0x0f,
+		0x00, 0x1f, 0x00, 0x08, 0xb5, 0x16, 0x10, 0x06, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x0e, 0x02, 0x15, 0x14,
+		0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x02, 0xd1, 0xad, 0x63, 0x63,
+		0xad, 0x6b, 0x6b, 0xad, 0x63, 0x63, 0xad, 0x6b, 0x46, 0x6d, 0x3c, 0x3c, 0x6d, 0x46, 0x47, 0x6c,
+		0x3c, 0x3c, 0x6c, 0x47, 0x04, 0xb9, 0x60, 0xaa, 0x6a, 0x6b, 0xa9, 0x60, 0x60, 0xa9, 0x6b, 0x6a,
+		0xaa, 0x60, 0x84, 0x3e, 0x6d, 0x45, 0x45, 0x6e, 0x3d, 0x3d, 0x6d, 0x46, 0x45, 0x6d, 0x3e, 0x00,
+		0x00, 0x02, 0x00, 0x93, 0x00, 0x00, 0x04, 0x38, 0x04, 0xb9, 0x00, 0x12, 0x00, 0x16, 0x00, 0x08,
+		0xb5, 0x14, 0x13, 0x07, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x17, 0x01, 0x16, 0x15, 0x14, 0x06,
+		0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x36, 0x33, 0x07, 0x01, 0x21, 0x01, 0x02,
+		0x91, 0x31, 0x0c, 0x01, 0x65, 0x05, 0x1d, 0x22, 0xfc, 0xd9, 0x22, 0x1d, 0x06, 0x01, 0x69, 0x0c,
+		0x32, 0x29, 0x02, 0xfe, 0xda, 0x02, 0x4a, 0xfe, 0xde, 0x04, 0xb9, 0x1f, 0x22, 0xfb, 0xf2, 0x0f,
+		0x17, 0x25, 0x1f, 0x1f, 0x25, 0x14, 0x12, 0x04, 0x0e, 0x22, 0x1f, 0xbb, 0xfc, 0x8a, 0x03, 0x76,
+		0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x04, 0x7b, 0x04, 0xb9, 0x00, 0x35, 0x00, 0x06, 0xb3, 0x0c,
+		0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x12, 0x15, 0x14, 0x06, 0x07, 0x33, 0x32, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+		0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x33, 0x33, 0x26, 0x26, 0x35, 0x34, 0x12, 0x36, 0x33, 0x03, 0x02, 0xef, 0x83, 0x82, 0x67,
+		0xb1, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xb2, 0x22, 0x1d, 0x11, 0x87, 0x8f, 0x5b, 0xa7, 0x6e, 0x6e,
+		0xa7, 0x5b, 0x8f, 0x87, 0x11, 0x1d, 0x22, 0xfe, 0xb2, 0x22, 0x1d, 0x1d, 0x22, 0xb1, 0x67, 0x82,
+		0x83, 0xef, 0x9c, 0x04, 0xb9, 0x92, 0xfe, 0xf6, 0xae, 0x94, 0xfb, 0x50, 0x21, 0x27, 0x27, 0x21,
+		0x24, 0x2a, 0x34, 0x0c, 0x56, 0xf1, 0x9a, 0x85, 0xc6, 0x6b, 0x6b, 0xc6, 0x85, 0x9a, 0xf1, 0x56,
+		0x0c, 0x34, 0x2a, 0x24, 0x21, 0x27, 0x27, 0x21, 0x50, 0xfb, 0x94, 0xae, 0x01, 0x0a, 0x92, 0x00,
+		0x00, 0x01, 0x00, 0xda, 0xfe, 0x72, 0x03, 0xfc, 0x03, 0xa6, 0x00, 0x2d, 0x00, 0x06, 0xb3, 0x13,
+		0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35,
+		0x06, 0x06, 0x23, 0x22, 0x27, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36,
+		0x33, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x36,
+		0x33, 0x33, 0x03, 0xdb, 0x21, 0x1e, 0x27, 0x02, 0x27, 0x1e, 0x3f, 0xb5, 0x65, 0x64, 0x43, 0x21,
+		0x29, 0x02, 0x29, 0x21, 0x21, 0x29, 0x02, 0x29, 0x21, 0x59, 0x5d, 0x4c, 0x95, 0x5f, 0x21, 0x29,
+		0x02, 0x03, 0xa6, 0x1e, 0x23, 0xfc, 0xd2, 0x23, 0x1e, 0x1e, 0x23, 0x8f, 0x62, 0x7a, 0x2f, 0xfe,
+		0x9a, 0x23, 0x1e, 0x1e, 0x23, 0x04, 0xb2, 0x23, 0x1e, 0x1e, 0x23, 0xfd, 0xda, 0x5a, 0x67, 0x66,
+		0xad, 0x65, 0x01, 0x6f, 0x23, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x62, 0xff, 0xf6, 0x04, 0x6a,
+		0x03, 0x9c, 0x00, 0x21, 0x00, 0x06, 0xb3, 0x09, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x23, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x21, 0x11, 0x14, 0x06,
+		0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0x4d,
+		0x1d, 0x1d, 0x22, 0x57, 0x21, 0x29, 0x02, 0x29, 0x21, 0xfe, 0x50, 0x21, 0x29, 0x02, 0x29, 0x21,
+		0x57, 0x22, 0x1d, 0x1d, 0x22, 0x03, 0x8a, 0x03, 0x9c, 0x21, 0x27, 0x27, 0x21, 0xfd, 0x2b, 0x23,
+		0x1e, 0x1e, 0x23, 0x02, 0xd5, 0xfd, 0x2b, 0x23, 0x1e, 0x1e, 0x23, 0x02, 0xd5, 0x21, 0x27, 0x27,
+		0x21, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xbe, 0xff, 0xea, 0x04, 0x0e, 0x04, 0xb9, 0x00, 0x0f,
+		0x00, 0x19, 0x00, 0x23, 0x00, 0x3a, 0x40, 0x37, 0x20, 0x1f, 0x16, 0x15, 0x04, 0x03, 0x02, 0x01,
+		0x4a, 0x05, 0x01, 0x02, 0x02, 0x01, 0x5b, 0x04, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x06, 0x01, 0x03,
+		0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1a, 0x1a, 0x10, 0x10, 0x00, 0x00, 0x1a,
+		0x23, 0x1a, 0x22, 0x10, 0x19, 0x10, 0x18, 0x00, 0x0f, 0x00, 0x0e, 0x26, 0x07, 0x07, 0x15, 0x2b,
+		0x00, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x23, 0x22, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x33,
+		0x0e, 0x02, 0x15, 0x14, 0x17, 0x01, 0x26, 0x26, 0x23, 0x12, 0x36, 0x36, 0x35, 0x34, 0x27, 0x01,
+		0x16, 0x16, 0x33, 0x02, 0xe6, 0xc0, 0x68, 0x68, 0xc0, 0x80, 0x80, 0xc0, 0x68, 0x68, 0xc0, 0x80,
+		0x4f, 0x7a, 0x45, 0x10, 0x01, 0xc9, 0x25, 0x68, 0x3e, 0x4f, 0x7a, 0x45, 0x10, 0xfe, 0x38, 0x24,
+		0x68, 0x3e, 0x04, 0xb9, 0x99, 0xfe, 0xe9, 0xb8, 0xb8, 0xfe, 0xea, 0x99, 0x99, 0x01, 0x16, 0xb8,
+		0xb8, 0x01, 0x17, 0x99, 0x94, 0x6f, 0xd3, 0x92, 0x5f, 0x55, 0x01, 0xff, 0x43, 0x46, 0xfc, 0x59,
+		0x6e, 0xd3, 0x92, 0x5f, 0x55, 0xfe, 0x01, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xdc,
+		0x00, 0x00, 0x04, 0x0d, 0x04, 0xbc, 0x00, 0x1f, 0x00, 0x30, 0x40, 0x2d, 0x0e, 0x01, 0x02, 0x03,
+		0x01, 0x4a, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x05,
+		0x04, 0x02, 0x01, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1f,
+		0x00, 0x1e, 0x27, 0x23, 0x24, 0x34, 0x06, 0x07, 0x18, 0x2b, 0x24, 0x16, 0x15, 0x14, 0x06, 0x23,
+		0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x11, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35,
+		0x34, 0x37, 0x25, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x21, 0x03, 0xf0, 0x1d, 0x1d, 0x22, 0xfd,
+		0x5e, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x0d, 0xf9, 0x11, 0x0e, 0x20, 0x17, 0x0e, 0x1f, 0x01, 0x79,
+		0x14, 0x14, 0x16, 0x1d, 0x00, 0xff, 0x90, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x03,
+		0x52, 0x9b, 0x0a, 0x29, 0x18, 0x16, 0x22, 0x12, 0xe8, 0x0c, 0x1d, 0x1a, 0xfc, 0x0b, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xc5, 0x00, 0x00, 0x03, 0xf9, 0x04, 0xb9, 0x00, 0x2a, 0x00, 0x2e, 0x40, 0x2b,
+		0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03,
+		0x16, 0x4b, 0x05, 0x01, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00,
+		0x00, 0x2a, 0x00, 0x29, 0x27, 0x23, 0x2a, 0x44, 0x06, 0x07, 0x18, 0x2b, 0x24, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23,
+		0x22, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x32, 0x16,
+		0x16, 0x15, 0x14, 0x06, 0x07, 0x01, 0x21, 0x03, 0xdc, 0x1d, 0x1d, 0x22, 0xfd, 0xa3, 0x59, 0x22,
+		0x1d, 0x0f, 0x01, 0xb8, 0x5c, 0x4b, 0x77, 0x6d, 0x42, 0x8e, 0x3f, 0x10, 0x12, 0x21, 0x19, 0x11,
+		0x1e, 0x4c, 0xb8, 0x59, 0x74, 0xad, 0x5e, 0x63, 0x69, 0xfe, 0xb8, 0x02, 0x01, 0x90, 0x21, 0x27,
+		0x27, 0x21, 0x1f, 0x25, 0x26, 0x10, 0x01, 0xbe, 0x5d, 0x7e, 0x48, 0x5d, 0x6d, 0x32, 0x2c, 0x0c,
+		0x29, 0x1d, 0x14, 0x1c, 0x16, 0x36, 0x3c, 0x53, 0x9e, 0x6d, 0x66, 0xad, 0x6b, 0xfe, 0xb3, 0x00,
+		0x00, 0x01, 0x00, 0xb5, 0xff, 0xea, 0x03, 0xe6, 0x04, 0xb9, 0x00, 0x3b, 0x00, 0x47, 0x40, 0x44,
+		0x06, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x00, 0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x70, 0x00, 0x01,
+		0x03, 0x02, 0x03, 0x01, 0x02, 0x70, 0x00, 0x04, 0x00, 0x03, 0x01, 0x04, 0x03, 0x63, 0x00, 0x05,
+		0x05, 0x07, 0x5b, 0x08, 0x01, 0x07, 0x07, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00,
+		0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3a, 0x22, 0x24, 0x34, 0x34, 0x24, 0x17,
+		0x2c, 0x09, 0x07, 0x1b, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14,
+		0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16,
+		0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x32,
+		0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36,
+		0x33, 0x02, 0xb7, 0xac, 0x5e, 0x50, 0x49, 0x5a, 0x64, 0x61, 0xb8, 0x81, 0x62, 0xc8, 0x4f, 0x1e,
+		0x11, 0x1a, 0x20, 0x10, 0x12, 0x42, 0x9a, 0x4e, 0x7c, 0x84, 0x85, 0x76, 0x49, 0x22, 0x1d, 0x1d,
+		0x22, 0x37, 0x72, 0x76, 0x76, 0x6c, 0x84, 0x84, 0x12, 0x0e, 0x20, 0x18, 0x0e, 0x20, 0xa3, 0xaa,
+		0x04, 0xb9, 0x51, 0x95, 0x64, 0x56, 0x7d, 0x25, 0x25, 0x93, 0x66, 0x6d, 0xa6, 0x5c, 0x44, 0x3a,
+		0x16, 0x1c, 0x14, 0x1d, 0x2a, 0x0d, 0x31, 0x39, 0x76, 0x65, 0x67, 0x6b, 0x1f, 0x25, 0x25, 0x1f,
+		0x60, 0x5c, 0x55, 0x61, 0x50, 0x0a, 0x2b, 0x1b, 0x15, 0x20, 0x13, 0x60, 0x00, 0x02, 0x00, 0x91,
+		0xff, 0xf6, 0x04, 0x27, 0x04, 0xb9, 0x00, 0x1d, 0x00, 0x20, 0x00, 0x2e, 0x40, 0x2b, 0x20, 0x01,
+		0x04, 0x03, 0x01, 0x4a, 0x05, 0x06, 0x02, 0x04, 0x02, 0x01, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00,
+		0x03, 0x03, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x4c, 0x00, 0x00, 0x1f, 0x1e, 0x00, 0x1d,
+		0x00, 0x1c, 0x27, 0x23, 0x33, 0x24, 0x07, 0x07, 0x18, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23,
+		0x23, 0x15, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35, 0x21, 0x22, 0x26, 0x35, 0x34, 0x37,
+		0x01, 0x36, 0x36, 0x33, 0x32, 0x15, 0x11, 0x33, 0x21, 0x21, 0x13, 0x04, 0x0a, 0x1d, 0x1d, 0x22,
+		0xa2, 0x21, 0x29, 0x02, 0x29, 0x21, 0xfe, 0x22, 0x22, 0x1f, 0x0c, 0x01, 0xe4, 0x15, 0x33, 0x26,
+		0x57, 0xa2, 0xfd, 0x6e, 0x01, 0x5a, 0x08, 0x01, 0xbe, 0x21, 0x27, 0x27, 0x21, 0xf7, 0x23, 0x1e,
+		0x1e, 0x23, 0xf7, 0x24, 0x26, 0x20, 0x11, 0x02, 0xd3, 0x20, 0x1d, 0x4e, 0xfd, 0x53, 0x02, 0x22,
+		0x00, 0x01, 0x00, 0xbc, 0xff, 0xea, 0x03, 0xf0, 0x04, 0xa3, 0x00, 0x35, 0x00, 0x46, 0x40, 0x43,
+		0x33, 0x01, 0x03, 0x07, 0x01, 0x4a, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x70, 0x00, 0x01,
+		0x02, 0x03, 0x01, 0x02, 0x6e, 0x08, 0x01, 0x07, 0x00, 0x03, 0x04, 0x07, 0x03, 0x63, 0x00, 0x06,
+		0x06, 0x05, 0x59, 0x00, 0x05, 0x05, 0x0e, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00,
+		0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x35, 0x00, 0x34, 0x24, 0x45, 0x23, 0x26, 0x24, 0x17, 0x26,
+		0x09, 0x07, 0x1b, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26,
+		0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+		0x26, 0x23, 0x22, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x37, 0x13, 0x36, 0x36, 0x33, 0x33, 0x21,
+		0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x03, 0x36, 0x33, 0x02, 0xe5, 0xaf, 0x5c, 0x67, 0xbf,
+		0x7e, 0x60, 0xc2, 0x4f, 0x1f, 0x10, 0x1a, 0x20, 0x10, 0x12, 0x41, 0x98, 0x4b, 0x51, 0x79, 0x40,
+		0x3c, 0x70, 0x4a, 0x44, 0x6c, 0x33, 0x10, 0x22, 0x2a, 0x23, 0x02, 0x14, 0x02, 0x20, 0x29, 0x86,
+		0x01, 0x90, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0x2e, 0x0d, 0x64, 0x73, 0x03, 0x12, 0x66, 0xb5, 0x75,
+		0x75, 0xba, 0x69, 0x40, 0x37, 0x17, 0x1d, 0x16, 0x1a, 0x2a, 0x0d, 0x2e, 0x36, 0x41, 0x75, 0x4e,
+		0x4a, 0x72, 0x40, 0x23, 0x24, 0x0a, 0x1e, 0x23, 0x01, 0xf4, 0x23, 0x1e, 0x21, 0x27, 0x27, 0x21,
+		0xfe, 0xc7, 0x38, 0x00, 0x00, 0x02, 0x00, 0xcb, 0xff, 0xea, 0x04, 0x0a, 0x04, 0xba, 0x00, 0x1c,
+		0x00, 0x2c, 0x00, 0x3c, 0x40, 0x39, 0x08, 0x01, 0x05, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x07, 0x01,
+		0x05, 0x04, 0x01, 0x05, 0x63, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x16, 0x4b,
+		0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1d, 0x1d, 0x00, 0x00, 0x1d,
+		0x2c, 0x1d, 0x2b, 0x25, 0x23, 0x00, 0x1c, 0x00, 0x1b, 0x26, 0x24, 0x24, 0x08, 0x07, 0x17, 0x2b,
+		0x00, 0x16, 0x15, 0x14, 0x06, 0x07, 0x04, 0x04, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x12, 0x24, 0x37, 0x00, 0x06, 0x06,
+		0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x03, 0xb0, 0x1f,
+		0x13, 0x12, 0xfe, 0xf6, 0xfe, 0xe2, 0x1c, 0x34, 0x98, 0x56, 0x6e, 0xb0, 0x64, 0x65, 0xba, 0x79,
+		0x6d, 0xb6, 0x38, 0x4c, 0x92, 0x01, 0x40, 0xf8, 0xfe, 0x94, 0x74, 0x41, 0x3f, 0x73, 0x4c, 0x4c,
+		0x73, 0x3f, 0x3e, 0x72, 0x4e, 0x04, 0xba, 0x26, 0x33, 0x1f, 0x1b, 0x01, 0x0e, 0xf7, 0xd4, 0x44,
+		0x4a, 0x5e, 0xac, 0x70, 0x6c, 0xab, 0x60, 0x64, 0x5f, 0x83, 0xd0, 0xad, 0x01, 0x34, 0xcd, 0x0b,
+		0xfd, 0x8e, 0x37, 0x61, 0x3f, 0x46, 0x6e, 0x3e, 0x38, 0x67, 0x44, 0x45, 0x68, 0x39, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xc7, 0xff, 0xea, 0x04, 0x05, 0x04, 0xa3, 0x00, 0x17, 0x00, 0x25, 0x40, 0x22,
+		0x0b, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x02, 0x59, 0x03, 0x01, 0x02, 0x02, 0x0e,
+		0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x14, 0x25, 0x27, 0x04,
+		0x07, 0x16, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
+		0x37, 0x01, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x33, 0x03, 0xe8, 0x1d, 0x06, 0xfe,
+		0x56, 0x09, 0x27, 0x1b, 0x25, 0x2c, 0x05, 0x01, 0x94, 0xfd, 0xb4, 0x22, 0x1d, 0x1d, 0x22, 0x02,
+		0x88, 0x38, 0x04, 0xa3, 0x1f, 0x25, 0x18, 0x10, 0xfb, 0xe1, 0x17, 0x17, 0x1d, 0x19, 0x09, 0x0f,
+		0x03, 0xdb, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd2, 0xff, 0xea, 0x03, 0xfa,
+		0x04, 0xb9, 0x00, 0x1b, 0x00, 0x2b, 0x00, 0x3b, 0x00, 0x44, 0x40, 0x41, 0x14, 0x06, 0x02, 0x05,
+		0x02, 0x01, 0x4a, 0x00, 0x02, 0x08, 0x01, 0x05, 0x04, 0x02, 0x05, 0x63, 0x07, 0x01, 0x03, 0x03,
+		0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00,
+		0x17, 0x00, 0x4c, 0x2c, 0x2c, 0x1c, 0x1c, 0x00, 0x00, 0x2c, 0x3b, 0x2c, 0x3a, 0x34, 0x32, 0x1c,
+		0x2b, 0x1c, 0x2a, 0x24, 0x22, 0x00, 0x1b, 0x00, 0x1a, 0x2c, 0x09, 0x07, 0x15, 0x2b, 0x00, 0x16,
+		0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x34, 0x36, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16,
+		0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x02, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+		0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x02, 0xce, 0xa8, 0x5f, 0x5a, 0x4a, 0x5c,
+		0x6d, 0x68, 0xb9, 0x73, 0x73, 0xb9, 0x68, 0x6d, 0x5b, 0x4a, 0x59, 0x5f, 0xa8, 0x68, 0x3e, 0x61,
+		0x38, 0x38, 0x63, 0x3c, 0x3c, 0x63, 0x38, 0x38, 0x61, 0x3e, 0x49, 0x71, 0x40, 0x40, 0x71, 0x49,
+		0x49, 0x71, 0x40, 0x40, 0x71, 0x49, 0x04, 0xb9, 0x57, 0x97, 0x5c, 0x51, 0x80, 0x28, 0x29, 0x96,
+		0x63, 0x67, 0xa5, 0x5e, 0x5e, 0xa5, 0x67, 0x63, 0x96, 0x29, 0x28, 0x80, 0x51, 0x5c, 0x97, 0x57,
+		0x94, 0x2d, 0x54, 0x38, 0x33, 0x54, 0x30, 0x30, 0x54, 0x33, 0x38, 0x54, 0x2d, 0xfe, 0x05, 0x36,
+		0x61, 0x3e, 0x3e, 0x62, 0x37, 0x37, 0x62, 0x3e, 0x3e, 0x61, 0x36, 0x00, 0x00, 0x02, 0x00, 0xc2,
+		0xff, 0xe9, 0x04, 0x01, 0x04, 0xb9, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x3c, 0x40, 0x39, 0x11, 0x01,
+		0x02, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x63, 0x07, 0x01, 0x05, 0x05,
+		0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00,
+		0x17, 0x00, 0x4c, 0x1d, 0x1d, 0x00, 0x00, 0x1d, 0x2c, 0x1d, 0x2b, 0x25, 0x23, 0x00, 0x1c, 0x00,
+		0x1b, 0x24, 0x24, 0x27, 0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x17, 0x16, 0x15, 0x14, 0x02, 0x04,
+		0x07, 0x06, 0x26, 0x35, 0x34, 0x36, 0x37, 0x24, 0x24, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
+		0x35, 0x34, 0x36, 0x36, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
+		0x34, 0x26, 0x26, 0x23, 0x02, 0xc7, 0xb6, 0x38, 0x4c, 0x92, 0xfe, 0xc0, 0xf8, 0x1b, 0x1f, 0x13,
+		0x12, 0x01, 0x0a, 0x01, 0x1e, 0x1c, 0x34, 0x98, 0x56, 0x6e, 0xb0, 0x64, 0x65, 0xba, 0x79, 0x4c,
+		0x73, 0x3f, 0x3e, 0x72, 0x4e, 0x49, 0x74, 0x41, 0x3f, 0x73, 0x4c, 0x04, 0xb9, 0x64, 0x5f, 0x83,
+		0xd0, 0xad, 0xfe, 0xcc, 0xcd, 0x0b, 0x01, 0x26, 0x33, 0x1f, 0x1b, 0x01, 0x0e, 0xf7, 0xd4, 0x44,
+		0x4a, 0x5e, 0xac, 0x70, 0x6c, 0xab, 0x60, 0x94, 0x38, 0x67, 0x44, 0x45, 0x68, 0x39, 0x37, 0x61,
+		0x3f, 0x46, 0x6e, 0x3e, 0x00, 0x01, 0x00, 0x6f, 0x00, 0xc4, 0x04, 0x5d, 0x03, 0x56, 0x00, 0x11,
+		0x00, 0x17, 0x40, 0x14, 0x05, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00,
+		0x01, 0x01, 0x69, 0x18, 0x11, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14,
+		0x07, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x04, 0x1a, 0x09, 0x17, 0x15,
+		0x0e, 0x0e, 0xfc, 0x6a, 0x07, 0x09, 0x17, 0x15, 0x0e, 0x0e, 0x03, 0x96, 0x03, 0x56, 0x1c, 0x12,
+		0x14, 0x13, 0x08, 0xfd, 0xcf, 0x04, 0x1c, 0x14, 0x12, 0x12, 0x09, 0x02, 0x31, 0x00, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x01, 0xff, 0x28, 0x04, 0xba, 0x05, 0x71, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x58,
+		0x00, 0x5c, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x51, 0x24, 0x01, 0x01, 0x04, 0x01, 0x4a, 0x1e, 0x0b,
+		0x02, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00, 0x72, 0x00, 0x04, 0x01, 0x04, 0x72, 0x00, 0x05, 0x08,
+		0x06, 0x08, 0x05, 0x06, 0x70, 0x03, 0x01, 0x01, 0x00, 0x02, 0x09, 0x01, 0x02, 0x61, 0x0a, 0x01,
+		0x09, 0x00, 0x08, 0x05, 0x09, 0x08, 0x63, 0x00, 0x06, 0x07, 0x07, 0x06, 0x55, 0x00, 0x06, 0x06,
+		0x07, 0x5a, 0x00, 0x07, 0x06, 0x07, 0x4e, 0x31, 0x31, 0x31, 0x58, 0x31, 0x57, 0x29, 0x34, 0x2d,
+		0x18, 0x13, 0x23, 0x34, 0x2c, 0x12, 0x0b, 0x07, 0x1d, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x06,
+		0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x32,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11, 0x00, 0x33, 0x32,
+		0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x12,
+		0x16, 0x15, 0x14, 0x06, 0x07, 0x07, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x35,
+		0x34, 0x37, 0x25, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
+		0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x44, 0x0e, 0x05, 0x1a, 0x0e, 0x05, 0x1e, 0xed, 0x0a,
+		0x0a, 0x10, 0x13, 0xa2, 0x15, 0x14, 0x14, 0x15, 0xfe, 0x43, 0x2a, 0x15, 0x15, 0xaa, 0x03, 0x45,
+		0x09, 0x17, 0x15, 0x0e, 0x0e, 0xfc, 0x6a, 0x07, 0x09, 0x17, 0x15, 0x0e, 0x0e, 0x03, 0x96, 0x0b,
+		0x7f, 0x42, 0x46, 0xc7, 0x01, 0x43, 0x15, 0x14, 0x14, 0x15, 0xfe, 0x34, 0x28, 0x1a, 0x01, 0x16,
+		0x2f, 0x2c, 0x42, 0x3e, 0x2b, 0x62, 0x2c, 0x07, 0x08, 0x19, 0x10, 0x07, 0x12, 0x34, 0x7e, 0x3b,
+		0x04, 0xc1, 0x04, 0x26, 0x11, 0x0a, 0x1a, 0x0a, 0x4c, 0x03, 0x11, 0x11, 0xfd, 0xc5, 0x18, 0x1c,
+		0x1b, 0x19, 0x34, 0x1c, 0x18, 0x01, 0xdc, 0xfe, 0x8e, 0x1c, 0x12, 0x14, 0x13, 0x08, 0xfd, 0xcf,
+		0x04, 0x1c, 0x14, 0x12, 0x12, 0x09, 0x02, 0x31, 0xfe, 0x74, 0x74, 0x62, 0x40, 0x69, 0x3a, 0xa5,
+		0x18, 0x1c, 0x1b, 0x19, 0x3c, 0x21, 0x15, 0xea, 0x28, 0x43, 0x29, 0x30, 0x3a, 0x1c, 0x17, 0x04,
+		0x25, 0x13, 0x0e, 0x18, 0x0a, 0x1c, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x01, 0xff, 0x22, 0x04, 0xd1,
+		0x05, 0x71, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x6f, 0xb1, 0x06, 0x64, 0x44,
+		0x40, 0x64, 0x20, 0x01, 0x00, 0x01, 0x51, 0x01, 0x04, 0x09, 0x43, 0x01, 0x06, 0x0a, 0x03, 0x4a,
+		0x16, 0x0a, 0x02, 0x02, 0x48, 0x00, 0x02, 0x05, 0x02, 0x72, 0x00, 0x05, 0x01, 0x05, 0x72, 0x00,
+		0x04, 0x09, 0x0a, 0x09, 0x04, 0x0a, 0x70, 0x03, 0x01, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x61,
+		0x00, 0x09, 0x04, 0x07, 0x09, 0x57, 0x0d, 0x0b, 0x0c, 0x03, 0x0a, 0x08, 0x01, 0x06, 0x07, 0x0a,
+		0x06, 0x63, 0x00, 0x09, 0x09, 0x07, 0x5c, 0x00, 0x07, 0x09, 0x07, 0x50, 0x50, 0x50, 0x31, 0x31,
+		0x50, 0x52, 0x50, 0x52, 0x31, 0x4f, 0x31, 0x4e, 0x4b, 0x49, 0x23, 0x23, 0x26, 0x18, 0x19, 0x2c,
+		0x14, 0x23, 0x31, 0x0e, 0x07, 0x1d, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x06, 0x23, 0x21, 0x22,
+		0x35, 0x34, 0x36, 0x33, 0x33, 0x11, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37,
+		0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x32, 0x16, 0x15, 0x24, 0x15, 0x14, 0x07, 0x01, 0x06,
+		0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x33, 0x32, 0x17, 0x12, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x23, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x21, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x37, 0x01, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x23, 0x13, 0x03, 0x02, 0x11,
+		0x14, 0x15, 0xfe, 0x43, 0x2a, 0x15, 0x15, 0xaa, 0x91, 0x0e, 0x05, 0x1a, 0x0e, 0x05, 0x1e, 0xed,
+		0x0a, 0x0a, 0x10, 0x13, 0xa2, 0x15, 0x14, 0x02, 0x4c, 0x0e, 0xfc, 0x6a, 0x07, 0x09, 0x17, 0x15,
+		0x0e, 0x0e, 0x03, 0x96, 0x07, 0x09, 0x17, 0x15, 0x6e, 0x14, 0x14, 0x14, 0x5b, 0x1a, 0x1e, 0x1e,
+		0x1b, 0xfe, 0xc6, 0x14, 0x19, 0x06, 0x08, 0x01, 0x3d, 0x0f, 0x1f, 0x15, 0x1d, 0x2d, 0x5b, 0xcc,
+		0x05, 0xdd, 0x02, 0xc5, 0x19, 0x34, 0x1c, 0x18, 0x01, 0xdc, 0x2f, 0x04, 0x26, 0x11, 0x0a, 0x1a,
+		0x0a, 0x4c, 0x03, 0x11, 0x11, 0xfd, 0xc5, 0x18, 0x1c, 0x3e, 0x14, 0x13, 0x08, 0xfd, 0xcf, 0x04,
+		0x1c, 0x14, 0x12, 0x12, 0x09, 0x02, 0x31, 0x04, 0x1c, 0xfd, 0x1c, 0x18, 0x1c, 0x1c, 0x19, 0x99,
+		0x14, 0x14, 0x14, 0x14, 0x99, 0x21, 0x20, 0x0f, 0x13, 0x0b, 0x01, 0x79, 0x13, 0x12, 0x1b, 0x14,
+		0xfe, 0x8c, 0x01, 0x0a, 0xfe, 0xf6, 0x00, 0x00, 0x00, 0x04, 0x00, 0x15, 0xff, 0x22, 0x04, 0xd1,
+		0x05, 0x72, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x6a, 0x00, 0x6d, 0x00, 0xf0, 0xb1, 0x06, 0x64, 0x44,
+		0x40, 0x16, 0x36, 0x01, 0x03, 0x04, 0x3b, 0x01, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x6c, 0x01,
+		0x08, 0x0d, 0x5e, 0x01, 0x0a, 0x0e, 0x05, 0x4a, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x4d, 0x00,
+		0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x70, 0x09, 0x01, 0x01, 0x03, 0x02, 0x03, 0x01, 0x02, 0x70,
+		0x00, 0x08, 0x0d, 0x0e, 0x0d, 0x08, 0x0e, 0x70, 0x00, 0x07, 0x00, 0x05, 0x06, 0x07, 0x05, 0x63,
+		0x00, 0x04, 0x00, 0x03, 0x01, 0x04, 0x03, 0x63, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x63,
+		0x00, 0x0d, 0x08, 0x0b, 0x0d, 0x57, 0x11, 0x0f, 0x10, 0x03, 0x0e, 0x0c, 0x01, 0x0a, 0x0b, 0x0e,
+		0x0a, 0x63, 0x00, 0x0d, 0x0d, 0x0b, 0x5c, 0x00, 0x0b, 0x0d, 0x0b, 0x50, 0x1b, 0x40, 0x53, 0x00,
+		0x06, 0x05, 0x04, 0x05, 0x06, 0x04, 0x70, 0x00, 0x09, 0x03, 0x01, 0x03, 0x09, 0x01, 0x70, 0x00,
+		0x01, 0x02, 0x03, 0x01, 0x02, 0x6e, 0x00, 0x08, 0x0d, 0x0e, 0x0d, 0x08, 0x0e, 0x70, 0x00, 0x07,
+		0x00, 0x05, 0x06, 0x07, 0x05, 0x63, 0x00, 0x04, 0x00, 0x03, 0x09, 0x04, 0x03, 0x63, 0x00, 0x02,
+		0x00, 0x00, 0x0d, 0x02, 0x00, 0x63, 0x00, 0x0d, 0x08, 0x0b, 0x0d, 0x57, 0x11, 0x0f, 0x10, 0x03,
+		0x0e, 0x0c, 0x01, 0x0a, 0x0b, 0x0e, 0x0a, 0x63, 0x00, 0x0d, 0x0d, 0x0b, 0x5c, 0x00, 0x0b, 0x0d,
+		0x0b, 0x50, 0x59, 0x40, 0x22, 0x6b, 0x6b, 0x4c, 0x4c, 0x6b, 0x6d, 0x6b, 0x6d, 0x4c, 0x6a, 0x4c,
+		0x69, 0x66, 0x64, 0x5c, 0x5a, 0x57, 0x55, 0x52, 0x50, 0x4a, 0x49, 0x1f, 0x27, 0x13, 0x24, 0x33,
+		0x34, 0x24, 0x17, 0x21, 0x12, 0x07, 0x1d, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x06, 0x23, 0x22,
+		0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35,
+		0x34, 0x26, 0x23, 0x23, 0x22, 0x35, 0x34, 0x36, 0x33, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
+		0x22, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+		0x15, 0x14, 0x07, 0x16, 0x16, 0x15, 0x04, 0x15, 0x14, 0x07, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26,
+		0x35, 0x34, 0x37, 0x01, 0x36, 0x33, 0x32, 0x17, 0x12, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x15,
+		0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x01, 0x36,
+		0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x23, 0x13, 0x03, 0x02, 0x1e, 0x88, 0x84, 0x3e, 0x7b,
+		0x31, 0x13, 0x07, 0x0f, 0x1a, 0x08, 0x08, 0x2b, 0x5f, 0x2d, 0x4b, 0x52, 0x4f, 0x4a, 0x2c, 0x24,
+		0x12, 0x12, 0x21, 0x46, 0x48, 0x4a, 0x41, 0x53, 0x59, 0x07, 0x09, 0x19, 0x10, 0x06, 0x12, 0x30,
+		0x77, 0x3b, 0x4c, 0x6f, 0x3c, 0x5e, 0x37, 0x3d, 0x02, 0x3f, 0x0e, 0xfc, 0x6a, 0x07, 0x09, 0x17,
+		0x15, 0x0e, 0x0e, 0x03, 0x96, 0x07, 0x09, 0x17, 0x15, 0x6e, 0x14, 0x14, 0x14, 0x5b, 0x1a, 0x1e,
+		0x1e, 0x1b, 0xfe, 0xc6, 0x14, 0x19, 0x06, 0x08, 0x01, 0x3d, 0x0f, 0x1f, 0x15, 0x1d, 0x2d, 0x5b,
+		0xcc, 0x05, 0xdd, 0x03, 0x0e, 0x71, 0x1b, 0x1b, 0x0a, 0x17, 0x0d, 0x13, 0x27, 0x04, 0x15, 0x1a,
+		0x37, 0x32, 0x37, 0x2e, 0x33, 0x18, 0x1d, 0x30, 0x35, 0x31, 0x32, 0x2e, 0x04, 0x27, 0x11, 0x0f,
+		0x17, 0x0a, 0x1a, 0x1c, 0x32, 0x5b, 0x3a, 0x64, 0x33, 0x12, 0x53, 0x3e, 0x49, 0x14, 0x13, 0x08,
+		0xfd, 0xcf, 0x04, 0x1c, 0x14, 0x12, 0x12, 0x09, 0x02, 0x31, 0x04, 0x1c, 0xfd, 0x12, 0x18, 0x1c,
+		0x1c, 0x19, 0x99, 0x14, 0x14, 0x14, 0x14, 0x99, 0x21, 0x20, 0x0f, 0x13, 0x0b, 0x01, 0x79, 0x13,
+		0x12, 0x1b, 0x14, 0xfe, 0x8c, 0x01, 0x0a, 0xfe, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3b,
+		0x01, 0xe3, 0x03, 0xb3, 0x05, 0x36, 0x00, 0x1f, 0x00, 0x06, 0xb3, 0x16, 0x0b, 0x01, 0x30, 0x2b,
+		0x01, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x25, 0x36, 0x33, 0x32, 0x16, 0x15,
+		0x11, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11,
+		0x01, 0x8b, 0x0b, 0x0c, 0x10, 0x17, 0x08, 0x06, 0x23, 0x01, 0x1c, 0x0b, 0x0d, 0x13, 0x17, 0xc2,
+		0x19, 0x18, 0x18, 0x19, 0xfd, 0xeb, 0x32, 0x19, 0x19, 0xcc, 0x04, 0x62, 0x04, 0x16, 0x17, 0x12,
+		0x0f, 0x20, 0x0b, 0x5b, 0x04, 0x15, 0x15, 0xfd, 0x54, 0x1d, 0x21, 0x21, 0x1e, 0x3f, 0x21, 0x1d,
+		0x02, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x01, 0xe3, 0x03, 0xa7, 0x05, 0x36, 0x00, 0x29,
+		0x00, 0x06, 0xb3, 0x0d, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x07,
+		0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x35, 0x34, 0x37, 0x01, 0x36, 0x36, 0x35,
+		0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36,
+		0x36, 0x33, 0x02, 0xc0, 0x81, 0x44, 0x4f, 0x54, 0xef, 0x01, 0x83, 0x19, 0x18, 0x18, 0x19, 0xfd,
+		0xd9, 0x2f, 0x1f, 0x01, 0x4c, 0x39, 0x35, 0x50, 0x4a, 0x33, 0x75, 0x35, 0x0c, 0x07, 0x0f, 0x19,
+		0x08, 0x09, 0x16, 0x3d, 0x97, 0x48, 0x05, 0x36, 0x3f, 0x74, 0x4d, 0x4d, 0x7d, 0x46, 0xc6, 0x1d,
+		0x21, 0x21, 0x1e, 0x48, 0x27, 0x1a, 0x01, 0x18, 0x31, 0x50, 0x31, 0x3a, 0x45, 0x22, 0x1b, 0x05,
+		0x19, 0x14, 0x19, 0x0f, 0x1c, 0x0c, 0x21, 0x25, 0x00, 0x01, 0x01, 0x2e, 0x01, 0xd1, 0x03, 0x9e,
+		0x05, 0x36, 0x00, 0x3a, 0x00, 0x06, 0xb3, 0x0a, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x16, 0x15,
+		0x14, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36,
+		0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x22, 0x35,
+		0x34, 0x36, 0x33, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x23, 0x22, 0x27,
+		0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x02, 0xb6, 0x86, 0x47, 0x70, 0x42, 0x49, 0xa3, 0x9e,
+		0x4a, 0x94, 0x3b, 0x16, 0x08, 0x09, 0x19, 0x0f, 0x09, 0x0a, 0x33, 0x73, 0x36, 0x5a, 0x62, 0x5f,
+		0x59, 0x34, 0x2c, 0x15, 0x17, 0x27, 0x54, 0x56, 0x58, 0x4e, 0x62, 0x6c, 0x0a, 0x09, 0x1e, 0x13,
+		0x08, 0x16, 0x3a, 0x8d, 0x48, 0x05, 0x36, 0x3c, 0x6c, 0x46, 0x79, 0x3c, 0x16, 0x64, 0x4a, 0x77,
+		0x87, 0x21, 0x20, 0x0c, 0x1b, 0x11, 0x16, 0x16, 0x19, 0x05, 0x1a, 0x1e, 0x41, 0x3d, 0x42, 0x36,
+		0x3e, 0x1c, 0x23, 0x3a, 0x3f, 0x3a, 0x3d, 0x37, 0x05, 0x2f, 0x15, 0x10, 0x1e, 0x0b, 0x1f, 0x21,
+		0x00, 0x02, 0x00, 0xf2, 0x01, 0xdb, 0x03, 0xc4, 0x05, 0x36, 0x00, 0x1e, 0x00, 0x21, 0x00, 0x08,
+		0xb5, 0x20, 0x1f, 0x18, 0x09, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x15,
+		0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x01, 0x36,
+		0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x33, 0x23, 0x13, 0x01, 0x03, 0xac, 0x18, 0x18, 0x18, 0x6d,
+		0x1f, 0x24, 0x24, 0x20, 0xfe, 0x88, 0x19, 0x1d, 0x08, 0x09, 0x01, 0x7b, 0x13, 0x24, 0x1a, 0x22,
+		0x36, 0x6d, 0xf4, 0x06, 0xfe, 0xf7, 0x03, 0x40, 0x1d, 0x21, 0x21, 0x1e, 0xb8, 0x18, 0x18, 0x18,
+		0x18, 0xb8, 0x27, 0x27, 0x11, 0x18, 0x0c, 0x01, 0xc4, 0x17, 0x15, 0x20, 0x18, 0xfe, 0x42, 0x01,
+		0x3f, 0xfe, 0xc1, 0x00, 0x00, 0x02, 0x03, 0x0b, 0xff, 0xf6, 0x04, 0x19, 0x03, 0xa6, 0x00, 0x0d,
+		0x00, 0x1b, 0x00, 0x08, 0xb5, 0x13, 0x0e, 0x05, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x15,
+		0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x12, 0x16, 0x15, 0x15, 0x14, 0x06,
+		0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x03, 0xda, 0x3f, 0x3f, 0x48, 0x48, 0x3f, 0x3f,
+		0x48, 0x48, 0x3f, 0x3f, 0x48, 0x48, 0x3f, 0x3f, 0x48, 0x03, 0xa6, 0x1d, 0x22, 0xb8, 0x22, 0x1d,
+		0x1d, 0x22, 0xb8, 0x22, 0x1d, 0xfd, 0x86, 0x1d, 0x22, 0xb8, 0x22, 0x1d, 0x1d, 0x22, 0xb8, 0x22,
+		0x1d, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xa0, 0xfe, 0xda, 0x04, 0x19, 0x01, 0x26, 0x00, 0x03,
+		0x01, 0x27, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x0b, 0xff, 0xf6, 0x04, 0x19,
+		0x01, 0x2c, 0x00, 0x03, 0x01, 0x2c, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0xb4,
+		0xfe, 0xda, 0x04, 0x2d, 0x03, 0xa6, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x08, 0xb5, 0x14, 0x0e, 0x05,
+		0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34,
+		0x36, 0x33, 0x12, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22, 0x35, 0x34, 0x37, 0x13, 0x36,
+		0x36, 0x33, 0x33, 0x03, 0xda, 0x3f, 0x3f, 0x48, 0x48, 0x3f, 0x3f, 0x48, 0x89, 0x12, 0x07, 0xd4,
+		0x12, 0x44, 0x48, 0x02, 0x5e, 0x04, 0x1b, 0x15, 0xc2, 0x03, 0xa6, 0x1d, 0x22, 0xb8, 0x22, 0x1d,
+		0x1d, 0x22, 0xb8, 0x22, 0x1d, 0xfd, 0x80, 0x13, 0x0f, 0x0e, 0x0f, 0xfe, 0x1c, 0x29, 0x32, 0x04,
+		0x0c, 0x01, 0xe2, 0x13, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x39, 0xff, 0xea, 0x06, 0x93,
+		0x01, 0x3c, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x0a, 0xb7, 0x2a, 0x22, 0x1a, 0x12, 0x0a,
+		0x02, 0x03, 0x30, 0x2b, 0x24, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+		0x22, 0x26, 0x26, 0x35, 0x24, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+		0x22, 0x26, 0x26, 0x35, 0x24, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+		0x22, 0x26, 0x26, 0x35, 0xfe, 0x39, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e,
+		0x4d, 0x2e, 0x03, 0x84, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e,
+		0x03, 0x84, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0xc1, 0x4d,
+		0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e,
+		0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e,
+		0x4d, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05, 0xff, 0xea, 0x0b, 0x5f, 0x01, 0x3c, 0x00, 0x0f,
+		0x00, 0x1f, 0x00, 0x2f, 0x00, 0x0a, 0xb7, 0x2a, 0x22, 0x1a, 0x12, 0x0a, 0x02, 0x03, 0x30, 0x2b,
+		0x24, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x24, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x24, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x03, 0x05, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x03, 0x84,
+		0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x03, 0x84, 0x2e, 0x4d,
+		0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0xc1, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e,
+		0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e,
+		0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x00, 0x00,
+		0x00, 0x03, 0x01, 0x18, 0xff, 0xea, 0x06, 0x5c, 0x00, 0xf4, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f,
+		0x00, 0x0a, 0xb7, 0x26, 0x20, 0x16, 0x10, 0x06, 0x00, 0x03, 0x30, 0x2b, 0x24, 0x16, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x20, 0x16, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x20, 0x16, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x01, 0xc1, 0x3d, 0x24,
+		0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x02, 0x41, 0x3d, 0x24, 0x24, 0x3d, 0x24,
+		0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x02, 0x41, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24,
+		0x24, 0x3d, 0x24, 0xf4, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24,
+		0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24,
+		0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x00, 0x03, 0xfe, 0x20, 0xff, 0xea, 0x04, 0x7c,
+		0x00, 0xf4, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x0a, 0xb7, 0x26, 0x20, 0x16, 0x10, 0x06,
+		0x00, 0x03, 0x30, 0x2b, 0x24, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x34, 0x36, 0x36, 0x33, 0x20, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x34, 0x36, 0x36, 0x33, 0x20, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x34, 0x36, 0x36, 0x33, 0xfe, 0xc9, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d,
+		0x24, 0x02, 0xcd, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x02, 0xcd,
+		0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0xf4, 0x24, 0x3d, 0x24, 0x24,
+		0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d,
+		0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24, 0x24, 0x3d, 0x24,
+		0x00, 0x03, 0x03, 0x05, 0xff, 0xea, 0x0c, 0x8b, 0x01, 0x3c, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f,
+		0x00, 0x0a, 0xb7, 0x2a, 0x22, 0x1a, 0x12, 0x0a, 0x02, 0x03, 0x30, 0x2b, 0x24, 0x36, 0x36, 0x33,
+		0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x24, 0x36, 0x36, 0x33,
+		0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x24, 0x36, 0x36, 0x33,
+		0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x03, 0x05, 0x2e, 0x4d,
+		0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x04, 0x1a, 0x2e, 0x4d, 0x2e, 0x2e,
+		0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x04, 0x1a, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e,
+		0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0xc1, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e,
+		0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d,
+		0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6a,
+		0x00, 0x91, 0x04, 0x62, 0x04, 0x67, 0x00, 0x37, 0x00, 0x2b, 0x40, 0x28, 0x2f, 0x27, 0x02, 0x02,
+		0x03, 0x31, 0x26, 0x1e, 0x1a, 0x10, 0x05, 0x06, 0x00, 0x02, 0x02, 0x4a, 0x00, 0x03, 0x02, 0x03,
+		0x72, 0x04, 0x01, 0x02, 0x00, 0x02, 0x72, 0x01, 0x01, 0x00, 0x00, 0x69, 0x26, 0x27, 0x2e, 0x25,
+		0x2b, 0x05, 0x07, 0x19, 0x2b, 0x00, 0x15, 0x14, 0x06, 0x07, 0x05, 0x13, 0x16, 0x15, 0x14, 0x07,
+		0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x03, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x13,
+		0x25, 0x26, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x32, 0x17, 0x05, 0x03, 0x26, 0x35, 0x34,
+		0x36, 0x33, 0x32, 0x16, 0x15, 0x07, 0x03, 0x25, 0x36, 0x33, 0x32, 0x16, 0x17, 0x04, 0x62, 0x26,
+		0x22, 0xfe, 0x9f, 0xfb, 0x1b, 0x2d, 0x1f, 0x1d, 0x16, 0x25, 0x0e, 0xb7, 0xb7, 0x1e, 0x2b, 0x1d,
+		0x1f, 0x2e, 0x1b, 0xfb, 0xfe, 0x9f, 0x22, 0x25, 0x07, 0x0a, 0x28, 0x1b, 0x16, 0x15, 0x01, 0x49,
+		0x29, 0x01, 0x31, 0x2d, 0x2e, 0x30, 0x01, 0x2a, 0x01, 0x4a, 0x15, 0x16, 0x1a, 0x28, 0x0b, 0x02,
+		0xe5, 0x0f, 0x1f, 0x28, 0x08, 0x48, 0xfe, 0xeb, 0x1c, 0x1f, 0x27, 0x21, 0x16, 0x1a, 0x17, 0x01,
+		0x40, 0xfe, 0xc0, 0x31, 0x16, 0x21, 0x27, 0x1f, 0x1c, 0x01, 0x15, 0x48, 0x08, 0x28, 0x1e, 0x13,
+		0x15, 0x22, 0x23, 0x0a, 0x96, 0x01, 0x64, 0x05, 0x0a, 0x26, 0x2c, 0x2c, 0x27, 0x0e, 0xfe, 0x9c,
+		0x96, 0x0a, 0x23, 0x22, 0x00, 0x01, 0x00, 0xc6, 0xfe, 0x9d, 0x04, 0x06, 0x05, 0x72, 0x00, 0x11,
+		0x00, 0x36, 0xb6, 0x0e, 0x05, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+		0x0c, 0x02, 0x01, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x1b, 0x40, 0x0a,
+		0x02, 0x01, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x59, 0x40, 0x0a, 0x00, 0x00, 0x00,
+		0x11, 0x00, 0x10, 0x27, 0x03, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x17, 0x01, 0x16, 0x15, 0x14, 0x06,
+		0x23, 0x22, 0x26, 0x27, 0x01, 0x26, 0x35, 0x34, 0x36, 0x33, 0x01, 0x39, 0x23, 0x07, 0x02, 0xa0,
+		0x03, 0x34, 0x28, 0x17, 0x23, 0x07, 0xfd, 0x60, 0x03, 0x34, 0x28, 0x05, 0x72, 0x14, 0x10, 0xf9,
+		0x95, 0x09, 0x08, 0x17, 0x1e, 0x14, 0x10, 0x06, 0x6b, 0x09, 0x08, 0x17, 0x1e, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0x01, 0xdf, 0x01, 0xa9, 0x02, 0xed, 0x02, 0xdf, 0x01, 0x07, 0x01, 0x2c, 0x00, 0x00,
+		0x01, 0xb3, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0xb3, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x7e, 0x01, 0x63, 0x03, 0x4e, 0x03, 0x55, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x1c,
+		0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x01,
+		0x00, 0x4f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0c, 0x25, 0x03, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15,
+		0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x02, 0xe1, 0x6d, 0x6d, 0x7b,
+		0x7b, 0x6d, 0x6d, 0x7b, 0x03, 0x55, 0x2e, 0x34, 0xfe, 0xd2, 0x34, 0x2e, 0x2e, 0x34, 0x01, 0x2e,
+		0x34, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x01, 0xdf, 0xff, 0xf6, 0x02, 0xed, 0x03, 0xa6, 0x00, 0x0d,
+		0x00, 0x1b, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x04, 0x01, 0x01, 0x01, 0x11,
+		0x4b, 0x05, 0x01, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x4c, 0x0e, 0x0e, 0x00,
+		0x00, 0x0e, 0x1b, 0x0e, 0x1a, 0x15, 0x13, 0x00, 0x0d, 0x00, 0x0c, 0x25, 0x06, 0x07, 0x15, 0x2b,
+		0x00, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x12, 0x16,
+		0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x02, 0xae, 0x3f, 0x3f,
+		0x48, 0x48, 0x3f, 0x3f, 0x48, 0x48, 0x3f, 0x3f, 0x48, 0x48, 0x3f, 0x3f, 0x48, 0x03, 0xa6, 0x1d,
+		0x22, 0xb8, 0x22, 0x1d, 0x1d, 0x22, 0xb8, 0x22, 0x1d, 0xfd, 0x86, 0x1d, 0x22, 0xb8, 0x22, 0x1d,
+		0x1d, 0x22, 0xb8, 0x22, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x74, 0xfe, 0xda, 0x02, 0xed,
+		0x01, 0x26, 0x00, 0x10, 0x00, 0x1e, 0x40, 0x1b, 0x09, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01,
+		0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x26, 0x26,
+		0x02, 0x07, 0x16, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22, 0x35, 0x34, 0x37,
+		0x13, 0x36, 0x36, 0x33, 0x33, 0x02, 0xdb, 0x12, 0x07, 0xd4, 0x12, 0x44, 0x48, 0x02, 0x5e, 0x04,
+		0x1b, 0x15, 0xc2, 0x01, 0x26, 0x13, 0x0f, 0x0e, 0x0f, 0xfe, 0x1c, 0x29, 0x32, 0x04, 0x0c, 0x01,
+		0xe2, 0x13, 0x15, 0x00, 0x00, 0x03, 0x00, 0x6d, 0xff, 0xf6, 0x04, 0x5f, 0x00, 0xe6, 0x00, 0x0d,
+		0x00, 0x1b, 0x00, 0x29, 0x00, 0x2f, 0x40, 0x2c, 0x08, 0x05, 0x07, 0x03, 0x06, 0x05, 0x01, 0x01,
+		0x00, 0x5b, 0x04, 0x02, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x1c, 0x1c, 0x0e, 0x0e, 0x00, 0x00,
+		0x1c, 0x29, 0x1c, 0x28, 0x23, 0x21, 0x0e, 0x1b, 0x0e, 0x1a, 0x15, 0x13, 0x00, 0x0d, 0x00, 0x0c,
+		0x25, 0x09, 0x07, 0x15, 0x2b, 0x24, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35,
+		0x34, 0x36, 0x33, 0x20, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36,
+		0x33, 0x20, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x01,
+		0x0e, 0x31, 0x31, 0x38, 0x38, 0x31, 0x31, 0x38, 0x01, 0xc8, 0x31, 0x31, 0x38, 0x38, 0x31, 0x31,
+		0x38, 0x01, 0xc8, 0x31, 0x31, 0x38, 0x38, 0x31, 0x31, 0x38, 0xe6, 0x19, 0x1c, 0x86, 0x1c, 0x19,
+		0x19, 0x1c, 0x86, 0x1c, 0x19, 0x19, 0x1c, 0x86, 0x1c, 0x19, 0x19, 0x1c, 0x86, 0x1c, 0x19, 0x19,
+		0x1c, 0x86, 0x1c, 0x19, 0x19, 0x1c, 0x86, 0x1c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xe9,
+		0xff, 0xf6, 0x02, 0xe3, 0x04, 0xf5, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x32, 0x40, 0x2f, 0x0a, 0x03,
+		0x02, 0x03, 0x00, 0x01, 0x01, 0x4a, 0x04, 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x63, 0x05,
+		0x01, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x4c, 0x0f, 0x0f, 0x00, 0x00, 0x0f,
+		0x1c, 0x0f, 0x1b, 0x16, 0x14, 0x00, 0x0e, 0x00, 0x0c, 0x25, 0x06, 0x07, 0x15, 0x2b, 0x00, 0x16,
+		0x07, 0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x26, 0x36, 0x33, 0x33, 0x12, 0x16, 0x15,
+		0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x02, 0xbe, 0x14, 0x02, 0x31,
+		0x02, 0x1d, 0x1a, 0x1a, 0x1f, 0x01, 0x30, 0x02, 0x14, 0x17, 0x82, 0x01, 0x3b, 0x3b, 0x42, 0x42,
+		0x3b, 0x3b, 0x42, 0x04, 0xf5, 0x18, 0x1a, 0xfd, 0x3d, 0x17, 0x19, 0x19, 0x17, 0x02, 0xc3, 0x1a,
+		0x18, 0xfc, 0x19, 0x1d, 0x22, 0x9a, 0x22, 0x1d, 0x1d, 0x22, 0x9a, 0x22, 0x1d, 0x00, 0x00, 0x00,
+		0x00, 0x02, 0x01, 0xe9, 0xfe, 0xa7, 0x02, 0xe3, 0x03, 0xa6, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x31,
+		0x40, 0x2e, 0x18, 0x11, 0x10, 0x03, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x05, 0x01, 0x03, 0x02,
+		0x03, 0x5f, 0x04, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x11, 0x01, 0x4c, 0x0e, 0x0e,
+		0x00, 0x00, 0x0e, 0x1c, 0x0e, 0x1a, 0x15, 0x13, 0x00, 0x0d, 0x00, 0x0c, 0x25, 0x06, 0x07, 0x15,
+		0x2b, 0x00, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x02,
+		0x26, 0x37, 0x13, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x13, 0x16, 0x06, 0x23, 0x23, 0x02, 0x24,
+		0x3b, 0x3b, 0x42, 0x42, 0x3b, 0x3b, 0x42, 0x58, 0x14, 0x02, 0x31, 0x02, 0x1d, 0x1a, 0x1a, 0x1f,
+		0x01, 0x30, 0x02, 0x14, 0x17, 0x82, 0x02, 0x8e, 0x1d, 0x22, 0x9a, 0x22, 0x1d, 0x1d, 0x22, 0x9a,
+		0x22, 0x1d, 0xfc, 0x19, 0x18, 0x1a, 0x02, 0xc3, 0x17, 0x19, 0x19, 0x17, 0xfd, 0x3d, 0x1a, 0x18,
+		0x00, 0x02, 0x00, 0x3c, 0xff, 0xea, 0x04, 0x90, 0x04, 0xb9, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53,
+		0x40, 0x50, 0x47, 0x3c, 0x02, 0x09, 0x0a, 0x21, 0x16, 0x02, 0x03, 0x02, 0x02, 0x4a, 0x10, 0x0d,
+		0x0b, 0x03, 0x09, 0x0e, 0x08, 0x02, 0x00, 0x01, 0x09, 0x00, 0x62, 0x0f, 0x07, 0x02, 0x01, 0x06,
+		0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x61, 0x0c, 0x01, 0x0a, 0x0a, 0x16, 0x4b, 0x05, 0x01, 0x03,
+		0x03, 0x17, 0x03, 0x4c, 0x00, 0x00, 0x4f, 0x4e, 0x4d, 0x4c, 0x00, 0x4b, 0x00, 0x4a, 0x45, 0x43,
+		0x40, 0x3f, 0x3a, 0x38, 0x35, 0x33, 0x21, 0x24, 0x25, 0x23, 0x15, 0x23, 0x24, 0x21, 0x24, 0x11,
+		0x07, 0x1d, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x07, 0x33, 0x32, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x23, 0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x13, 0x21, 0x03, 0x06,
+		0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x13, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33,
+		0x37, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x13, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
+		0x14, 0x07, 0x03, 0x21, 0x13, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0x03, 0x33, 0x05,
+		0x21, 0x07, 0x21, 0x04, 0x73, 0x1d, 0x1d, 0x22, 0xc2, 0x40, 0xbc, 0x22, 0x1d, 0x1d, 0x22, 0xe2,
+		0x53, 0x04, 0x1f, 0x13, 0x1c, 0x2c, 0x02, 0x4b, 0xfe, 0xfa, 0x53, 0x04, 0x1f, 0x13, 0x1c, 0x2c,
+		0x02, 0x4b, 0xa0, 0x22, 0x1d, 0x1d, 0x22, 0xc5, 0x40, 0xbf, 0x22, 0x1d, 0x1d, 0x22, 0xe4, 0x51,
+		0x04, 0x1f, 0x13, 0x1c, 0x2c, 0x02, 0x48, 0x01, 0x05, 0x51, 0x04, 0x1f, 0x13, 0x1c, 0x2c, 0x02,
+		0x48, 0x9d, 0xfe, 0xb9, 0xfe, 0xfb, 0x40, 0x01, 0x05, 0x03, 0x61, 0x21, 0x27, 0x27, 0x21, 0xf5,
+		0x21, 0x27, 0x27, 0x21, 0xfe, 0xbf, 0x10, 0x11, 0x1e, 0x18, 0x03, 0x0a, 0x01, 0x1f, 0xfe, 0xbf,
+		0x10, 0x11, 0x1e, 0x18, 0x03, 0x0a, 0x01, 0x1f, 0x21, 0x27, 0x27, 0x21, 0xf5, 0x21, 0x27, 0x27,
+		0x21, 0x01, 0x37, 0x10, 0x11, 0x1e, 0x18, 0x03, 0x0a, 0xfe, 0xeb, 0x01, 0x37, 0x10, 0x11, 0x1e,
+		0x18, 0x03, 0x0a, 0xfe, 0xeb, 0x90, 0xf5, 0x00, 0x00, 0x01, 0x01, 0xdf, 0xff, 0xf6, 0x02, 0xed,
+		0x01, 0x2c, 0x00, 0x0d, 0x00, 0x19, 0x40, 0x16, 0x02, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00,
+		0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0c, 0x25, 0x03, 0x07, 0x15, 0x2b, 0x00,
+		0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x02, 0xae, 0x3f,
+		0x3f, 0x48, 0x48, 0x3f, 0x3f, 0x48, 0x01, 0x2c, 0x1d, 0x22, 0xb8, 0x22, 0x1d, 0x1d, 0x22, 0xb8,
+		0x22, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x01, 0x06, 0xff, 0xf6, 0x03, 0xc6, 0x04, 0xf5, 0x00, 0x26,
+		0x00, 0x34, 0x00, 0x43, 0x40, 0x40, 0x0e, 0x08, 0x07, 0x03, 0x00, 0x02, 0x01, 0x4a, 0x00, 0x02,
+		0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x00, 0x00, 0x05, 0x01, 0x00, 0x05, 0x6e, 0x06, 0x01, 0x03,
+		0x00, 0x01, 0x02, 0x03, 0x01, 0x63, 0x07, 0x01, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x0f,
+		0x04, 0x4c, 0x27, 0x27, 0x00, 0x00, 0x27, 0x34, 0x27, 0x33, 0x2e, 0x2c, 0x00, 0x26, 0x00, 0x25,
+		0x22, 0x2d, 0x2a, 0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07,
+		0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x27, 0x26, 0x36, 0x37, 0x37, 0x3e, 0x02, 0x35, 0x34, 0x26,
+		0x23, 0x22, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x12, 0x16, 0x15,
+		0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x02, 0xd6, 0x9d, 0x53, 0x45,
+		0x87, 0x6d, 0x0a, 0x02, 0x24, 0x1f, 0x1f, 0x24, 0x02, 0x0a, 0x01, 0x0e, 0x11, 0x45, 0x50, 0x5d,
+		0x2d, 0x65, 0x5c, 0x85, 0x80, 0x0f, 0x10, 0x21, 0x14, 0x0c, 0x26, 0x90, 0xae, 0x11, 0x36, 0x36,
+		0x3d, 0x3d, 0x36, 0x36, 0x3d, 0x04, 0xf5, 0x4f, 0x8d, 0x5d, 0x56, 0x7b, 0x5b, 0x2d, 0xab, 0x18,
+		0x1b, 0x1b, 0x18, 0xe1, 0x14, 0x18, 0x07, 0x1c, 0x21, 0x3a, 0x48, 0x31, 0x4b, 0x5a, 0x43, 0x09,
+		0x2e, 0x1b, 0x13, 0x21, 0x15, 0x4e, 0xfb, 0xf1, 0x1d, 0x22, 0x72, 0x22, 0x1d, 0x1d, 0x22, 0x72,
+		0x22, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x01, 0x06, 0xfe, 0xa7, 0x03, 0xc6, 0x03, 0xa6, 0x00, 0x0d,
+		0x00, 0x34, 0x00, 0x44, 0x40, 0x41, 0x1c, 0x16, 0x15, 0x03, 0x04, 0x02, 0x01, 0x4a, 0x00, 0x02,
+		0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00, 0x04, 0x03, 0x01, 0x04, 0x03, 0x6e, 0x00, 0x03, 0x07,
+		0x01, 0x05, 0x03, 0x05, 0x60, 0x06, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x11, 0x01,
+		0x4c, 0x0e, 0x0e, 0x00, 0x00, 0x0e, 0x34, 0x0e, 0x33, 0x2d, 0x2b, 0x29, 0x27, 0x1a, 0x18, 0x00,
+		0x0d, 0x00, 0x0c, 0x25, 0x08, 0x07, 0x15, 0x2b, 0x00, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32,
+		0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x02, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x37, 0x36,
+		0x36, 0x33, 0x32, 0x16, 0x17, 0x17, 0x16, 0x06, 0x07, 0x07, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33,
+		0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x02, 0x51, 0x36, 0x36,
+		0x3d, 0x3d, 0x36, 0x36, 0x3d, 0x98, 0x9d, 0x53, 0x45, 0x87, 0x6d, 0x0a, 0x02, 0x24, 0x1f, 0x1f,
+		0x24, 0x02, 0x0a, 0x01, 0x0e, 0x11, 0x45, 0x50, 0x5d, 0x2d, 0x65, 0x5c, 0x85, 0x80, 0x0f, 0x10,
+		0x21, 0x14, 0x0c, 0x26, 0x90, 0xae, 0x02, 0xb6, 0x1d, 0x22, 0x72, 0x22, 0x1d, 0x1d, 0x22, 0x72,
+		0x22, 0x1d, 0xfb, 0xf1, 0x4f, 0x8d, 0x5d, 0x56, 0x7b, 0x5b, 0x2d, 0xab, 0x18, 0x1b, 0x1b, 0x18,
+		0xe1, 0x14, 0x18, 0x07, 0x1c, 0x21, 0x3a, 0x48, 0x31, 0x4b, 0x5a, 0x43, 0x09, 0x2e, 0x1b, 0x13,
+		0x21, 0x15, 0x4e, 0x00, 0xff, 0xff, 0x00, 0xff, 0x02, 0xcb, 0x03, 0xc8, 0x04, 0xf5, 0x00, 0x23,
+		0x01, 0x30, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x03, 0x01, 0x30, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0xe5, 0x02, 0xcb, 0x02, 0xe2, 0x04, 0xf5, 0x00, 0x0d, 0x00, 0x25, 0x40, 0x22,
+		0x01, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02, 0x01, 0x01,
+		0x01, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0b, 0x25, 0x03,
+		0x07, 0x15, 0x2b, 0x00, 0x15, 0x07, 0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x26, 0x33,
+		0x33, 0x02, 0xe2, 0x01, 0x37, 0x03, 0x23, 0x1e, 0x1d, 0x24, 0x03, 0x37, 0x06, 0x2f, 0xa4, 0x04,
+		0xf5, 0x27, 0x0b, 0xfe, 0x3e, 0x1a, 0x1c, 0x1c, 0x1a, 0x01, 0xc2, 0x32, 0x00, 0x02, 0x01, 0x88,
+		0xfe, 0xda, 0x03, 0x01, 0x03, 0xa6, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x2a, 0x40, 0x27, 0x17, 0x01,
+		0x02, 0x03, 0x01, 0x4a, 0x00, 0x03, 0x00, 0x02, 0x03, 0x02, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x5b,
+		0x04, 0x01, 0x01, 0x01, 0x11, 0x00, 0x4c, 0x00, 0x00, 0x1e, 0x1c, 0x16, 0x14, 0x00, 0x0d, 0x00,
+		0x0c, 0x25, 0x05, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35,
+		0x35, 0x34, 0x36, 0x33, 0x12, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22, 0x35, 0x34, 0x37,
+		0x13, 0x36, 0x36, 0x33, 0x33, 0x02, 0xae, 0x3f, 0x3f, 0x48, 0x48, 0x3f, 0x3f, 0x48, 0x89, 0x12,
+		0x07, 0xd4, 0x12, 0x44, 0x48, 0x02, 0x5e, 0x04, 0x1b, 0x15, 0xc2, 0x03, 0xa6, 0x1d, 0x22, 0xb8,
+		0x22, 0x1d, 0x1d, 0x22, 0xb8, 0x22, 0x1d, 0xfd, 0x80, 0x13, 0x0f, 0x0e, 0x0f, 0xfe, 0x1c, 0x29,
+		0x32, 0x04, 0x0c, 0x01, 0xe2, 0x13, 0x15, 0x00, 0x00, 0x01, 0x00, 0xc6, 0xfe, 0x9d, 0x04, 0x06,
+		0x05, 0x72, 0x00, 0x11, 0x00, 0x36, 0xb6, 0x0b, 0x02, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0,
+		0x17, 0x50, 0x58, 0x40, 0x0c, 0x02, 0x01, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00,
+		0x4c, 0x1b, 0x40, 0x0a, 0x02, 0x01, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x59, 0x40,
+		0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x27, 0x03, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x14,
+		0x07, 0x01, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x36, 0x33, 0x03, 0xd2,
+		0x34, 0x03, 0xfd, 0x60, 0x07, 0x23, 0x17, 0x28, 0x34, 0x03, 0x02, 0xa0, 0x07, 0x23, 0x17, 0x05,
+		0x72, 0x1e, 0x17, 0x08, 0x09, 0xf9, 0x95, 0x10, 0x14, 0x1e, 0x17, 0x08, 0x09, 0x06, 0x6b, 0x10,
+		0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0xfe, 0x77, 0x04, 0x86, 0xff, 0x07, 0x00, 0x0d,
+		0x00, 0x27, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02,
+		0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0b,
+		0x34, 0x03, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x04, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21,
+		0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0x69, 0x1d, 0x1d, 0x22, 0xfc, 0x3e, 0x22, 0x1d,
+		0x1d, 0x22, 0x03, 0xc2, 0xf9, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xb1, 0xfe, 0xb3, 0x03, 0xde, 0x05, 0x5c, 0x00, 0x3c, 0x00, 0xe0, 0x40, 0x0a,
+		0x37, 0x01, 0x04, 0x00, 0x0e, 0x01, 0x03, 0x04, 0x02, 0x4a, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40,
+		0x21, 0x06, 0x01, 0x05, 0x00, 0x00, 0x04, 0x05, 0x00, 0x63, 0x00, 0x04, 0x00, 0x03, 0x01, 0x04,
+		0x03, 0x63, 0x00, 0x01, 0x02, 0x02, 0x01, 0x57, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x01,
+		0x02, 0x4f, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04, 0x00, 0x03, 0x01, 0x04,
+		0x03, 0x63, 0x00, 0x01, 0x00, 0x02, 0x01, 0x02, 0x5f, 0x00, 0x00, 0x00, 0x05, 0x5b, 0x06, 0x01,
+		0x05, 0x05, 0x10, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x21, 0x06, 0x01, 0x05,
+		0x00, 0x00, 0x04, 0x05, 0x00, 0x63, 0x00, 0x04, 0x00, 0x03, 0x01, 0x04, 0x03, 0x63, 0x00, 0x01,
+		0x02, 0x02, 0x01, 0x57, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x01, 0x02, 0x4f, 0x1b, 0x4b,
+		0xb0, 0x15, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04, 0x00, 0x03, 0x01, 0x04, 0x03, 0x63, 0x00, 0x01,
+		0x00, 0x02, 0x01, 0x02, 0x5f, 0x00, 0x00, 0x00, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x10, 0x00,
+		0x4c, 0x1b, 0x40, 0x21, 0x06, 0x01, 0x05, 0x00, 0x00, 0x04, 0x05, 0x00, 0x63, 0x00, 0x04, 0x00,
+		0x03, 0x01, 0x04, 0x03, 0x63, 0x00, 0x01, 0x02, 0x02, 0x01, 0x57, 0x00, 0x01, 0x01, 0x02, 0x5b,
+		0x00, 0x02, 0x01, 0x02, 0x4f, 0x59, 0x59, 0x59, 0x59, 0x40, 0x12, 0x00, 0x00, 0x00, 0x3c, 0x00,
+		0x3b, 0x32, 0x30, 0x2c, 0x2a, 0x21, 0x1f, 0x1b, 0x19, 0x24, 0x07, 0x07, 0x15, 0x2b, 0x00, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x22, 0x06, 0x06, 0x15, 0x17, 0x17, 0x16, 0x06, 0x07, 0x15, 0x16, 0x16,
+		0x15, 0x14, 0x07, 0x07, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
+		0x26, 0x35, 0x34, 0x37, 0x37, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+		0x32, 0x36, 0x35, 0x34, 0x27, 0x27, 0x26, 0x35, 0x34, 0x36, 0x33, 0x03, 0xc1, 0x1d, 0x1d, 0x22,
+		0x64, 0x78, 0x35, 0x01, 0x03, 0x05, 0x6f, 0x7f, 0x7e, 0x71, 0x01, 0x08, 0x01, 0x83, 0x8e, 0x22,
+		0x1d, 0x1d, 0x22, 0xc9, 0xdf, 0x02, 0x0b, 0x02, 0x86, 0x90, 0x22, 0x1d, 0x1d, 0x22, 0x8b, 0x84,
+		0x01, 0x05, 0x02, 0xdd, 0xcb, 0x05, 0x5c, 0x21, 0x27, 0x27, 0x21, 0x34, 0x6e, 0x5a, 0x1d, 0x48,
+		0x78, 0x9d, 0x34, 0x0a, 0x25, 0x8f, 0x6e, 0x16, 0x0b, 0x79, 0x0d, 0x19, 0x7f, 0x74, 0x21, 0x27,
+		0x27, 0x21, 0xb4, 0xb4, 0x23, 0x12, 0x7b, 0x1c, 0x0c, 0x71, 0x71, 0x21, 0x27, 0x27, 0x21, 0x7e,
+		0x74, 0x14, 0x0a, 0x4a, 0x1e, 0x0d, 0xb9, 0xb9, 0x00, 0x01, 0x00, 0xee, 0xfe, 0xb3, 0x04, 0x1b,
+		0x05, 0x5c, 0x00, 0x3b, 0x00, 0xdd, 0x40, 0x0a, 0x2c, 0x01, 0x01, 0x00, 0x15, 0x01, 0x03, 0x01,
+		0x02, 0x4a, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x21, 0x06, 0x01, 0x05, 0x00, 0x04, 0x00, 0x05,
+		0x04, 0x63, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x63, 0x00, 0x03, 0x02, 0x02, 0x03, 0x57,
+		0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x03, 0x02, 0x4f, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58,
+		0x40, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x63, 0x00, 0x03, 0x00, 0x02, 0x03, 0x02,
+		0x5f, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x10, 0x04, 0x4c, 0x1b, 0x4b, 0xb0,
+		0x10, 0x50, 0x58, 0x40, 0x21, 0x06, 0x01, 0x05, 0x00, 0x04, 0x00, 0x05, 0x04, 0x63, 0x00, 0x00,
+		0x00, 0x01, 0x03, 0x00, 0x01, 0x63, 0x00, 0x03, 0x02, 0x02, 0x03, 0x57, 0x00, 0x03, 0x03, 0x02,
+		0x5b, 0x00, 0x02, 0x03, 0x02, 0x4f, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x00,
+		0x00, 0x01, 0x03, 0x00, 0x01, 0x63, 0x00, 0x03, 0x00, 0x02, 0x03, 0x02, 0x5f, 0x00, 0x04, 0x04,
+		0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x10, 0x04, 0x4c, 0x1b, 0x40, 0x21, 0x06, 0x01, 0x05, 0x00,
+		0x04, 0x00, 0x05, 0x04, 0x63, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x63, 0x00, 0x03, 0x02,
+		0x02, 0x03, 0x57, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x03, 0x02, 0x4f, 0x59, 0x59, 0x59,
+		0x59, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3a, 0x36, 0x34, 0x24, 0x29, 0x24, 0x29, 0x07,
+		0x07, 0x18, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x07, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x22, 0x06, 0x15, 0x14, 0x17, 0x17, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
+		0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x36, 0x35, 0x34, 0x27, 0x27, 0x26, 0x35, 0x34, 0x36, 0x37,
+		0x35, 0x26, 0x26, 0x37, 0x37, 0x36, 0x26, 0x26, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x01,
+		0xf8, 0xdd, 0x02, 0x05, 0x01, 0x84, 0x8b, 0x22, 0x1d, 0x1d, 0x22, 0x90, 0x86, 0x02, 0x0b, 0x02,
+		0xdf, 0xc9, 0x22, 0x1d, 0x1d, 0x22, 0x8e, 0x83, 0x01, 0x08, 0x01, 0x71, 0x7e, 0x7f, 0x6f, 0x05,
+		0x03, 0x04, 0x31, 0x79, 0x6a, 0x22, 0x1d, 0x1d, 0x22, 0x05, 0x5c, 0xb9, 0xb9, 0x0d, 0x1e, 0x4a,
+		0x0a, 0x14, 0x74, 0x7e, 0x21, 0x27, 0x27, 0x21, 0x71, 0x71, 0x0c, 0x1c, 0x7b, 0x12, 0x23, 0xb4,
+		0xb4, 0x21, 0x27, 0x27, 0x21, 0x74, 0x7f, 0x19, 0x0d, 0x79, 0x0b, 0x16, 0x6e, 0x8f, 0x25, 0x0a,
+		0x34, 0x9d, 0x78, 0x48, 0x64, 0x7b, 0x3a, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x01, 0x01, 0x4a,
+		0xfe, 0xb3, 0x03, 0x66, 0x05, 0x5c, 0x00, 0x19, 0x00, 0xa9, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40,
+		0x1a, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x61, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x55,
+		0x04, 0x01, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x03, 0x00, 0x4d, 0x1b, 0x4b, 0xb0, 0x0e, 0x50,
+		0x58, 0x40, 0x13, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x5d, 0x00, 0x02, 0x02, 0x01, 0x59,
+		0x00, 0x01, 0x01, 0x10, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x01,
+		0x00, 0x02, 0x03, 0x01, 0x02, 0x61, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x55, 0x04, 0x01, 0x03,
+		0x03, 0x00, 0x59, 0x00, 0x00, 0x03, 0x00, 0x4d, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x13,
+		0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x5d, 0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x01,
+		0x10, 0x02, 0x4c, 0x1b, 0x40, 0x1a, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x61, 0x04, 0x01,
+		0x03, 0x00, 0x00, 0x03, 0x55, 0x04, 0x01, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x03, 0x00, 0x4d,
+		0x59, 0x59, 0x59, 0x59, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x18, 0x24, 0x45, 0x44, 0x05,
+		0x07, 0x17, 0x2b, 0x04, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34,
+		0x36, 0x33, 0x33, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x03, 0x49, 0x1d,
+		0x1d, 0x22, 0xfe, 0xa0, 0x3e, 0x22, 0x1d, 0x1d, 0x22, 0x57, 0x01, 0x47, 0x22, 0x1d, 0x1d, 0x22,
+		0xfe, 0xb9, 0x01, 0x47, 0xbd, 0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x06, 0x21, 0x25, 0x1f, 0x21,
+		0x27, 0x27, 0x21, 0xfa, 0x77, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x66, 0xfe, 0xb3, 0x03, 0x82,
+		0x05, 0x5c, 0x00, 0x19, 0x00, 0xa6, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x19, 0x04, 0x01, 0x03,
+		0x00, 0x02, 0x01, 0x03, 0x02, 0x61, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00,
+		0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x13, 0x00, 0x01,
+		0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x02, 0x02, 0x03, 0x59, 0x04, 0x01, 0x03, 0x03, 0x10, 0x02,
+		0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x19, 0x04, 0x01, 0x03, 0x00, 0x02, 0x01, 0x03,
+		0x02, 0x61, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01,
+		0x00, 0x4d, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x13, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+		0x5d, 0x00, 0x02, 0x02, 0x03, 0x59, 0x04, 0x01, 0x03, 0x03, 0x10, 0x02, 0x4c, 0x1b, 0x40, 0x19,
+		0x04, 0x01, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x61, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00,
+		0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x59, 0x59, 0x59, 0x59, 0x40, 0x0c, 0x00,
+		0x00, 0x00, 0x19, 0x00, 0x16, 0x21, 0x24, 0x45, 0x05, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x11,
+		0x14, 0x06, 0x23, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x11, 0x21, 0x22, 0x26,
+		0x35, 0x34, 0x36, 0x33, 0x21, 0x33, 0x03, 0x65, 0x1d, 0x1d, 0x22, 0x57, 0xfe, 0xb9, 0x22, 0x1d,
+		0x1d, 0x22, 0x01, 0x47, 0xfe, 0xb9, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x60, 0x3e, 0x05, 0x5c, 0x1f,
+		0x25, 0xf9, 0xdf, 0x25, 0x1f, 0x21, 0x27, 0x27, 0x21, 0x05, 0x89, 0x21, 0x27, 0x27, 0x21, 0x00,
+		0x00, 0x01, 0x01, 0x29, 0xfe, 0xa9, 0x03, 0x61, 0x05, 0x65, 0x00, 0x1f, 0x00, 0x10, 0x40, 0x0d,
+		0x01, 0x01, 0x00, 0x48, 0x00, 0x00, 0x00, 0x69, 0x16, 0x14, 0x01, 0x07, 0x14, 0x2b, 0x00, 0x33,
+		0x32, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x02, 0x15, 0x14, 0x12, 0x17, 0x16, 0x15, 0x14,
+		0x07, 0x06, 0x06, 0x23, 0x22, 0x27, 0x26, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x37, 0x03, 0x0e,
+		0x0a, 0x10, 0x1d, 0x0b, 0x11, 0x0d, 0xad, 0xea, 0xe9, 0xae, 0x0d, 0x11, 0x0b, 0x1d, 0x10, 0x0a,
+		0x0b, 0x7a, 0xd7, 0x89, 0x89, 0xd8, 0x79, 0x05, 0x65, 0x16, 0x12, 0x1d, 0x19, 0x14, 0x09, 0x72,
+		0xfe, 0x8c, 0xff, 0xff, 0xfe, 0x90, 0x72, 0x09, 0x14, 0x19, 0x1d, 0x12, 0x16, 0x06, 0x49, 0xf3,
+		0x01, 0x52, 0xc8, 0xc8, 0x01, 0x54, 0xf5, 0x49, 0x00, 0x01, 0x01, 0x6b, 0xfe, 0xa9, 0x03, 0xa3,
+		0x05, 0x65, 0x00, 0x1f, 0x00, 0x10, 0x40, 0x0d, 0x09, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69,
+		0x1e, 0x1c, 0x01, 0x07, 0x14, 0x2b, 0x00, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x07, 0x06, 0x23,
+		0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x12, 0x35, 0x34, 0x02, 0x27, 0x26, 0x35, 0x34,
+		0x37, 0x36, 0x36, 0x33, 0x32, 0x17, 0x02, 0x42, 0xd8, 0x89, 0x89, 0xd7, 0x7a, 0x0b, 0x0a, 0x10,
+		0x1d, 0x0b, 0x11, 0x0d, 0xae, 0xe9, 0xea, 0xad, 0x0d, 0x11, 0x0b, 0x1d, 0x10, 0x0a, 0x0b, 0x05,
+		0x16, 0xf5, 0xfe, 0xac, 0xc8, 0xc8, 0xfe, 0xae, 0xf3, 0x49, 0x06, 0x16, 0x12, 0x1d, 0x19, 0x14,
+		0x09, 0x72, 0x01, 0x70, 0xff, 0xff, 0x01, 0x74, 0x72, 0x09, 0x14, 0x19, 0x1d, 0x12, 0x16, 0x06,
+		0x00, 0x01, 0x01, 0x0e, 0x01, 0xf8, 0x03, 0xbe, 0x02, 0x94, 0x00, 0x0d, 0x00, 0x06, 0xb3, 0x04,
+		0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36,
+		0x33, 0x21, 0x03, 0xa1, 0x1d, 0x1d, 0x22, 0xfd, 0xce, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0x32, 0x02,
+		0x94, 0x22, 0x2c, 0x2c, 0x22, 0x22, 0x2c, 0x2c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x52,
+		0x01, 0xfe, 0x06, 0x7a, 0x02, 0x8e, 0x00, 0x0d, 0x00, 0x06, 0xb3, 0x04, 0x00, 0x01, 0x30, 0x2b,
+		0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x06, 0x5d,
+		0x1d, 0x1d, 0x22, 0xf8, 0x56, 0x22, 0x1d, 0x1d, 0x22, 0x07, 0xaa, 0x02, 0x8e, 0x21, 0x27, 0x27,
+		0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x01, 0xfe, 0x09, 0xa8,
+		0x02, 0x8e, 0x00, 0x0d, 0x00, 0x06, 0xb3, 0x04, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x09, 0x8b, 0x1d, 0x1d, 0x22, 0xf6,
+		0xc6, 0x22, 0x1d, 0x1d, 0x22, 0x09, 0x3a, 0x02, 0x8e, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27,
+		0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1c, 0x01, 0xfe, 0x08, 0x7c, 0x02, 0x8e, 0x00, 0x0d,
+		0x00, 0x06, 0xb3, 0x04, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22,
+		0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x08, 0x5f, 0x1d, 0x1d, 0x22, 0xf9, 0x1e, 0x22, 0x1d, 0x1d,
+		0x22, 0x06, 0xe2, 0x02, 0x8e, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0xff, 0x1a, 0x01, 0xfe, 0x05, 0xb2, 0x02, 0x8e, 0x00, 0x0d, 0x00, 0x06, 0xb3, 0x04,
+		0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36,
+		0x33, 0x21, 0x05, 0x95, 0x1d, 0x1d, 0x22, 0xf9, 0xe6, 0x22, 0x1d, 0x1d, 0x22, 0x06, 0x1a, 0x02,
+		0x8e, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe2,
+		0x01, 0xfe, 0x04, 0xea, 0x02, 0x8e, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00,
+		0x00, 0x01, 0x55, 0x02, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x00,
+		0x00, 0x0d, 0x00, 0x0b, 0x34, 0x03, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21,
+		0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0xcd, 0x1d, 0x1d, 0x22, 0xfb, 0x76, 0x22, 0x1d,
+		0x1d, 0x22, 0x04, 0x8a, 0x02, 0x8e, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xaa, 0x01, 0xfe, 0x04, 0x22, 0x02, 0x8e, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x1c,
+		0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01,
+		0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0b, 0x34, 0x03, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15,
+		0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0x05, 0x1d, 0x1d, 0x22,
+		0xfd, 0x06, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0xfa, 0x02, 0x8e, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27,
+		0x27, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaa, 0x01, 0xfe, 0x04, 0x22, 0x02, 0x8e, 0x00, 0x0d,
+		0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02, 0x01, 0x01, 0x01, 0x00,
+		0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0b, 0x34, 0x03, 0x07, 0x15,
+		0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04,
+		0x05, 0x1d, 0x1d, 0x22, 0xfd, 0x06, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0xfa, 0x02, 0x8e, 0x21, 0x27,
+		0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0xff, 0xff, 0x00, 0xaa, 0x01, 0xfe, 0x04, 0x22,
+		0x02, 0x8e, 0x00, 0x02, 0x01, 0x41, 0x00, 0x00, 0xff, 0xff, 0x00, 0x99, 0x00, 0xb6, 0x04, 0x2f,
+		0x03, 0xb2, 0x00, 0x23, 0x01, 0x46, 0xff, 0x10, 0x00, 0x00, 0x00, 0x03, 0x01, 0x46, 0x00, 0xf0,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x00, 0xb6, 0x04, 0x33, 0x03, 0xb2, 0x00, 0x23,
+		0x01, 0x47, 0xff, 0x10, 0x00, 0x00, 0x00, 0x03, 0x01, 0x47, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x89, 0x00, 0xb6, 0x03, 0x3f, 0x03, 0xb2, 0x00, 0x17, 0x00, 0x1a, 0x40, 0x17,
+		0x04, 0x01, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x19,
+		0x00, 0x4c, 0x28, 0x2a, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x15, 0x14, 0x07, 0x03, 0x13, 0x16, 0x15,
+		0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x01, 0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x33, 0x32, 0x17,
+		0x03, 0x3f, 0x0e, 0xf6, 0xf6, 0x0e, 0x1f, 0x20, 0x1c, 0x14, 0x0c, 0xfe, 0xce, 0x09, 0x09, 0x01,
+		0x32, 0x0c, 0x14, 0x1c, 0x20, 0x03, 0x7b, 0x18, 0x10, 0x10, 0xfe, 0xf1, 0xfe, 0xf1, 0x10, 0x10,
+		0x18, 0x1b, 0x1c, 0x0f, 0x01, 0x57, 0x0b, 0x0d, 0x0f, 0x09, 0x01, 0x57, 0x0f, 0x1c, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x8d, 0x00, 0xb6, 0x03, 0x43, 0x03, 0xb2, 0x00, 0x17, 0x00, 0x1b, 0x40, 0x18,
+		0x12, 0x0f, 0x06, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00,
+		0x19, 0x01, 0x4c, 0x28, 0x20, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x33, 0x32, 0x17, 0x01, 0x16, 0x15,
+		0x14, 0x07, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x13, 0x03, 0x26, 0x35, 0x34,
+		0x37, 0x01, 0xcc, 0x1c, 0x14, 0x0c, 0x01, 0x32, 0x09, 0x09, 0xfe, 0xce, 0x0c, 0x14, 0x1c, 0x20,
+		0x1f, 0x0e, 0xf6, 0xf6, 0x0e, 0x1f, 0x03, 0xb2, 0x0f, 0xfe, 0xa9, 0x09, 0x0f, 0x0d, 0x0b, 0xfe,
+		0xa9, 0x0f, 0x1c, 0x1b, 0x18, 0x10, 0x10, 0x01, 0x0f, 0x01, 0x0f, 0x10, 0x10, 0x18, 0x1b, 0x00,
+		0xff, 0xff, 0x00, 0xc0, 0xfe, 0xfb, 0x04, 0x18, 0x01, 0x26, 0x00, 0x23, 0x01, 0x4d, 0x00, 0xf5,
+		0x00, 0x00, 0x00, 0x03, 0x01, 0x4d, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb1,
+		0x02, 0xf0, 0x04, 0x09, 0x05, 0x1b, 0x00, 0x23, 0x01, 0x4b, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x03,
+		0x01, 0x4b, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc0, 0x02, 0xca, 0x04, 0x18,
+		0x04, 0xf5, 0x00, 0x23, 0x01, 0x4c, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x01, 0x4c, 0x00, 0xf5,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xa6, 0x02, 0xf0, 0x03, 0x14, 0x05, 0x1b, 0x00, 0x10,
+		0x00, 0x19, 0x40, 0x16, 0x0a, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00,
+		0x00, 0x00, 0x10, 0x00, 0x4c, 0x26, 0x26, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x26, 0x35, 0x34, 0x37,
+		0x13, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x23, 0x01, 0xb9, 0x13, 0x08,
+		0xdc, 0x16, 0x34, 0x1d, 0x23, 0x02, 0x65, 0x09, 0x2b, 0xaf, 0x02, 0xf0, 0x12, 0x0f, 0x0c, 0x12,
+		0x01, 0xc1, 0x2b, 0x1c, 0x18, 0x05, 0x0c, 0xfe, 0x42, 0x28, 0x00, 0x00, 0x00, 0x01, 0x01, 0xb5,
+		0x02, 0xca, 0x03, 0x23, 0x04, 0xf5, 0x00, 0x10, 0x00, 0x17, 0x40, 0x14, 0x0a, 0x01, 0x00, 0x01,
+		0x01, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x26, 0x26, 0x02, 0x07, 0x16,
+		0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x13, 0x36,
+		0x33, 0x33, 0x03, 0x10, 0x13, 0x08, 0xdc, 0x15, 0x35, 0x1d, 0x23, 0x02, 0x65, 0x09, 0x2b, 0xaf,
+		0x04, 0xf5, 0x12, 0x0f, 0x0c, 0x12, 0xfe, 0x3f, 0x2b, 0x1c, 0x18, 0x05, 0x0c, 0x01, 0xbe, 0x28,
+		0x00, 0x01, 0x01, 0xb5, 0xfe, 0xfb, 0x03, 0x23, 0x01, 0x26, 0x00, 0x10, 0x00, 0x17, 0x40, 0x14,
+		0x0a, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x26,
+		0x26, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22, 0x26, 0x35,
+		0x34, 0x37, 0x13, 0x36, 0x33, 0x33, 0x03, 0x10, 0x13, 0x08, 0xdc, 0x15, 0x35, 0x1d, 0x23, 0x02,
+		0x65, 0x09, 0x2b, 0xaf, 0x01, 0x26, 0x12, 0x0f, 0x0c, 0x12, 0xfe, 0x3f, 0x2b, 0x1c, 0x18, 0x05,
+		0x0c, 0x01, 0xbe, 0x28, 0x00, 0x02, 0x00, 0x93, 0xff, 0x83, 0x04, 0x31, 0x05, 0x20, 0x00, 0x31,
+		0x00, 0x3a, 0x00, 0x34, 0x40, 0x31, 0x36, 0x2a, 0x1e, 0x16, 0x04, 0x02, 0x01, 0x35, 0x2b, 0x0e,
+		0x06, 0x04, 0x00, 0x03, 0x02, 0x4a, 0x00, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x70, 0x00, 0x03,
+		0x00, 0x01, 0x03, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x10, 0x00, 0x4c,
+		0x28, 0x1a, 0x2e, 0x29, 0x04, 0x07, 0x18, 0x2b, 0x00, 0x15, 0x14, 0x07, 0x06, 0x06, 0x07, 0x15,
+		0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x37, 0x35, 0x34,
+		0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27,
+		0x26, 0x27, 0x11, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x24, 0x16, 0x16, 0x17, 0x11, 0x0e, 0x02,
+		0x15, 0x04, 0x31, 0x20, 0x43, 0xa9, 0x5b, 0x21, 0x25, 0x25, 0x21, 0x80, 0xc2, 0x69, 0x69, 0xc2,
+		0x80, 0x21, 0x25, 0x25, 0x21, 0xa8, 0x87, 0x23, 0x0f, 0x14, 0x20, 0x13, 0x12, 0x6b, 0x7f, 0x8f,
+		0x6c, 0x14, 0x12, 0x1f, 0x16, 0xfd, 0x11, 0x42, 0x7a, 0x51, 0x51, 0x7a, 0x42, 0x01, 0x45, 0x17,
+		0x21, 0x17, 0x30, 0x41, 0x0a, 0xb7, 0x22, 0x1f, 0x1f, 0x22, 0xb5, 0x0c, 0x82, 0xd2, 0x81, 0x81,
+		0xd2, 0x82, 0x0c, 0xa4, 0x22, 0x1f, 0x1f, 0x22, 0xa6, 0x11, 0x58, 0x16, 0x23, 0x17, 0x1b, 0x29,
+		0x0d, 0x4a, 0x11, 0xfd, 0x6c, 0x16, 0x53, 0x0f, 0x26, 0xa1, 0x8f, 0x5a, 0x0c, 0x02, 0x98, 0x0c,
+		0x5a, 0x8f, 0x57, 0x00, 0x00, 0x02, 0x00, 0x6f, 0x00, 0x63, 0x04, 0x5d, 0x04, 0x51, 0x00, 0x37,
+		0x00, 0x47, 0x00, 0x49, 0x40, 0x46, 0x29, 0x25, 0x02, 0x07, 0x04, 0x37, 0x33, 0x1b, 0x17, 0x04,
+		0x06, 0x07, 0x0d, 0x09, 0x02, 0x01, 0x06, 0x03, 0x4a, 0x05, 0x01, 0x03, 0x04, 0x00, 0x03, 0x57,
+		0x00, 0x04, 0x00, 0x07, 0x06, 0x04, 0x07, 0x63, 0x00, 0x06, 0x00, 0x01, 0x00, 0x06, 0x01, 0x63,
+		0x05, 0x01, 0x03, 0x03, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x03, 0x00, 0x4f, 0x44, 0x42, 0x3c, 0x3a,
+		0x2d, 0x2b, 0x28, 0x26, 0x23, 0x21, 0x23, 0x23, 0x25, 0x08, 0x07, 0x17, 0x2b, 0x25, 0x16, 0x15,
+		0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x27, 0x06, 0x23, 0x22, 0x27, 0x07, 0x06, 0x23, 0x22, 0x27,
+		0x26, 0x35, 0x34, 0x37, 0x37, 0x26, 0x35, 0x34, 0x37, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33,
+		0x32, 0x17, 0x17, 0x36, 0x33, 0x32, 0x17, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07,
+		0x07, 0x16, 0x15, 0x14, 0x07, 0x24, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+		0x23, 0x22, 0x06, 0x06, 0x15, 0x04, 0x46, 0x17, 0x1d, 0x1d, 0x17, 0x15, 0x17, 0x8f, 0x67, 0x84,
+		0x84, 0x67, 0x8f, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17, 0x8e, 0x48, 0x48, 0x8e, 0x17, 0x1d, 0x1d,
+		0x17, 0x15, 0x17, 0x8f, 0x67, 0x84, 0x84, 0x67, 0x8f, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17, 0x8e,
+		0x48, 0x48, 0xfd, 0xa8, 0x42, 0x77, 0x4d, 0x4d, 0x77, 0x42, 0x42, 0x77, 0x4d, 0x4d, 0x77, 0x42,
+		0xe0, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17, 0x8f, 0x43, 0x43, 0x8f, 0x17, 0x1d, 0x1d, 0x17, 0x15,
+		0x17, 0x8e, 0x66, 0x86, 0x86, 0x66, 0x8e, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17, 0x8f, 0x43, 0x43,
+		0x8f, 0x17, 0x1d, 0x1d, 0x17, 0x15, 0x17, 0x8e, 0x66, 0x86, 0x86, 0x66, 0xa1, 0x78, 0x43, 0x43,
+		0x78, 0x4b, 0x4b, 0x78, 0x43, 0x43, 0x78, 0x4b, 0x00, 0x01, 0x00, 0xae, 0xff, 0x1f, 0x04, 0x1c,
+		0x05, 0x84, 0x00, 0x4e, 0x00, 0x90, 0x40, 0x0e, 0x33, 0x01, 0x07, 0x04, 0x37, 0x01, 0x06, 0x07,
+		0x0b, 0x01, 0x00, 0x03, 0x03, 0x4a, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40, 0x32, 0x00, 0x05, 0x04,
+		0x04, 0x05, 0x66, 0x00, 0x06, 0x07, 0x02, 0x07, 0x06, 0x02, 0x70, 0x00, 0x02, 0x03, 0x07, 0x02,
+		0x03, 0x6e, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00, 0x04, 0x00, 0x07, 0x06, 0x04, 0x07, 0x64, 0x00,
+		0x03, 0x00, 0x00, 0x03, 0x57, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x1b,
+		0x40, 0x31, 0x00, 0x05, 0x04, 0x05, 0x72, 0x00, 0x06, 0x07, 0x02, 0x07, 0x06, 0x02, 0x70, 0x00,
+		0x02, 0x03, 0x07, 0x02, 0x03, 0x6e, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00, 0x04, 0x00, 0x07, 0x06,
+		0x04, 0x07, 0x64, 0x00, 0x03, 0x00, 0x00, 0x03, 0x57, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00,
+		0x03, 0x00, 0x4f, 0x59, 0x40, 0x0f, 0x40, 0x3e, 0x3b, 0x3a, 0x30, 0x2e, 0x2b, 0x2a, 0x24, 0x1a,
+		0x23, 0x12, 0x08, 0x07, 0x18, 0x2b, 0x00, 0x06, 0x06, 0x07, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
+		0x35, 0x35, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32,
+		0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36,
+		0x36, 0x37, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07,
+		0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16,
+		0x16, 0x17, 0x16, 0x16, 0x15, 0x04, 0x1c, 0x55, 0xa7, 0x7a, 0x21, 0x25, 0x25, 0x21, 0xb6, 0x90,
+		0x26, 0x0d, 0x18, 0x1f, 0x0e, 0x11, 0x50, 0xbb, 0x61, 0x81, 0x84, 0x30, 0x2d, 0x23, 0x57, 0x4e,
+		0x5b, 0x7b, 0x34, 0x49, 0x51, 0x5a, 0x9f, 0x68, 0x21, 0x25, 0x25, 0x21, 0xa5, 0x82, 0x27, 0x0c,
+		0x15, 0x21, 0x0f, 0x10, 0xa1, 0xb6, 0x6e, 0x7b, 0x27, 0x26, 0x21, 0x57, 0x4c, 0x5a, 0x79, 0x35,
+		0x53, 0x5d, 0x01, 0x2a, 0x8a, 0x50, 0x05, 0xeb, 0x22, 0x1f, 0x1f, 0x22, 0xef, 0x12, 0x52, 0x15,
+		0x23, 0x14, 0x1a, 0x2e, 0x0a, 0x2e, 0x33, 0x5b, 0x4d, 0x2a, 0x35, 0x11, 0x0d, 0x0f, 0x09, 0x0b,
+		0x17, 0x15, 0x1e, 0x6c, 0x57, 0x5c, 0x85, 0x49, 0x05, 0xe3, 0x22, 0x1f, 0x1f, 0x22, 0xe8, 0x11,
+		0x44, 0x14, 0x25, 0x13, 0x1a, 0x30, 0x09, 0x56, 0x52, 0x4c, 0x22, 0x2c, 0x0e, 0x0d, 0x0e, 0x09,
+		0x0a, 0x15, 0x14, 0x20, 0x77, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a, 0xff, 0xea, 0x04, 0x5a,
+		0x04, 0xb9, 0x00, 0x4f, 0x00, 0x58, 0x40, 0x55, 0x29, 0x01, 0x07, 0x08, 0x01, 0x4a, 0x00, 0x07,
+		0x08, 0x05, 0x08, 0x07, 0x05, 0x70, 0x00, 0x00, 0x02, 0x0d, 0x02, 0x00, 0x0d, 0x70, 0x09, 0x01,
+		0x05, 0x0a, 0x01, 0x04, 0x03, 0x05, 0x04, 0x63, 0x0b, 0x01, 0x03, 0x0c, 0x01, 0x02, 0x00, 0x03,
+		0x02, 0x63, 0x00, 0x08, 0x08, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x16, 0x4b, 0x00, 0x0d, 0x0d, 0x01,
+		0x5b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x4d, 0x4b, 0x49, 0x47, 0x43, 0x41, 0x3d, 0x3b, 0x37,
+		0x35, 0x24, 0x17, 0x22, 0x24, 0x24, 0x24, 0x22, 0x27, 0x20, 0x0e, 0x07, 0x1d, 0x2b, 0x24, 0x33,
+		0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x23, 0x22, 0x26, 0x35,
+		0x34, 0x36, 0x33, 0x33, 0x26, 0x35, 0x34, 0x37, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33,
+		0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x26,
+		0x23, 0x22, 0x06, 0x07, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x06, 0x15, 0x14, 0x17,
+		0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x04, 0x0a,
+		0x0e, 0x20, 0x15, 0x0d, 0x25, 0x5a, 0xac, 0x65, 0xb2, 0xed, 0x2c, 0x66, 0x22, 0x1d, 0x1d, 0x22,
+		0x50, 0x03, 0x03, 0x50, 0x22, 0x1d, 0x1d, 0x22, 0x67, 0x2e, 0xec, 0xb0, 0x65, 0xac, 0x5a, 0x25,
+		0x0d, 0x15, 0x20, 0x0e, 0x14, 0x49, 0x90, 0x53, 0x70, 0x97, 0x24, 0x01, 0x5e, 0x22, 0x1d, 0x1d,
+		0x22, 0xfe, 0x87, 0x04, 0x03, 0x01, 0x7a, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xa0, 0x23, 0x99, 0x71,
+		0x53, 0x90, 0x49, 0xde, 0x2c, 0x1d, 0x13, 0x22, 0x16, 0x33, 0x2d, 0xcf, 0xb9, 0x21, 0x27, 0x27,
+		0x21, 0x27, 0x29, 0x2c, 0x2a, 0x21, 0x27, 0x27, 0x21, 0xb6, 0xcb, 0x2d, 0x33, 0x16, 0x22, 0x13,
+		0x1d, 0x2c, 0x0b, 0x2c, 0x29, 0x7b, 0x72, 0x21, 0x27, 0x27, 0x21, 0x24, 0x32, 0x29, 0x27, 0x21,
+		0x27, 0x27, 0x21, 0x75, 0x7f, 0x29, 0x2c, 0x00, 0x00, 0x01, 0x00, 0x21, 0xfe, 0xe9, 0x04, 0x80,
+		0x05, 0x25, 0x00, 0x37, 0x00, 0x47, 0x40, 0x44, 0x01, 0x01, 0x01, 0x09, 0x1d, 0x01, 0x04, 0x06,
+		0x02, 0x4a, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x70, 0x00, 0x05, 0x03, 0x06, 0x03, 0x05,
+		0x06, 0x70, 0x08, 0x01, 0x02, 0x07, 0x01, 0x03, 0x05, 0x02, 0x03, 0x61, 0x00, 0x06, 0x00, 0x04,
+		0x06, 0x04, 0x5f, 0x00, 0x01, 0x01, 0x09, 0x5b, 0x00, 0x09, 0x09, 0x10, 0x01, 0x4c, 0x36, 0x34,
+		0x24, 0x23, 0x23, 0x16, 0x23, 0x24, 0x23, 0x23, 0x14, 0x0a, 0x07, 0x1d, 0x2b, 0x00, 0x15, 0x14,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x07, 0x07, 0x33, 0x32, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x23, 0x03, 0x06, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32,
+		0x17, 0x16, 0x33, 0x32, 0x36, 0x37, 0x13, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x37,
+		0x36, 0x36, 0x33, 0x32, 0x17, 0x04, 0x80, 0x06, 0x10, 0x29, 0x0b, 0x0b, 0x5b, 0x51, 0x4d, 0x5e,
+		0x0a, 0x0e, 0xea, 0x22, 0x1d, 0x1d, 0x22, 0xf8, 0x43, 0x10, 0xb0, 0x8e, 0x72, 0x61, 0x29, 0x06,
+		0x10, 0x29, 0x0b, 0x0b, 0x5b, 0x51, 0x4d, 0x5e, 0x0a, 0x41, 0xc4, 0x22, 0x1d, 0x1d, 0x22, 0xd3,
+		0x0f, 0x10, 0xb0, 0x8e, 0x72, 0x61, 0x04, 0xf9, 0x26, 0x11, 0x15, 0x3b, 0x04, 0x1d, 0x5d, 0x5e,
+		0x88, 0x21, 0x27, 0x27, 0x21, 0xfd, 0x69, 0x99, 0xa7, 0x1f, 0x0d, 0x26, 0x11, 0x15, 0x3b, 0x04,
+		0x1d, 0x5d, 0x5e, 0x02, 0x8a, 0x21, 0x27, 0x27, 0x21, 0x95, 0x99, 0xa7, 0x1f, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x32, 0xff, 0xf6, 0x04, 0x10, 0x04, 0xa3, 0x00, 0x2f, 0x00, 0x37, 0x40, 0x34,
+		0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x61, 0x07, 0x01, 0x03, 0x06, 0x01, 0x04, 0x05, 0x03,
+		0x04, 0x63, 0x00, 0x00, 0x00, 0x08, 0x59, 0x09, 0x01, 0x08, 0x08, 0x0e, 0x4b, 0x00, 0x05, 0x05,
+		0x0f, 0x05, 0x4c, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2c, 0x24, 0x23, 0x33, 0x24, 0x21, 0x24, 0x21,
+		0x24, 0x0a, 0x07, 0x1c, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x21, 0x32, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x21, 0x15, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x15, 0x14,
+		0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x35, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11,
+		0x34, 0x36, 0x33, 0x33, 0x21, 0x03, 0xf3, 0x1d, 0x1d, 0x22, 0xfd, 0xba, 0x01, 0xd3, 0x22, 0x1d,
+		0x1d, 0x22, 0xfe, 0x2d, 0x01, 0x22, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xde, 0x21, 0x29, 0x02, 0x29,
+		0x21, 0x84, 0x22, 0x1d, 0x1d, 0x22, 0x84, 0x1f, 0x20, 0x57, 0x02, 0x46, 0x04, 0xa3, 0x21, 0x27,
+		0x27, 0x21, 0xfe, 0xad, 0x21, 0x27, 0x27, 0x21, 0xba, 0x21, 0x27, 0x27, 0x21, 0xaf, 0x23, 0x1e,
+		0x1e, 0x23, 0xaf, 0x21, 0x27, 0x27, 0x21, 0x02, 0xe9, 0x25, 0x1f, 0x00, 0x00, 0x01, 0x00, 0xdc,
+		0x00, 0x00, 0x03, 0xd2, 0x04, 0xb9, 0x00, 0x41, 0x00, 0x42, 0x40, 0x3f, 0x09, 0x01, 0x00, 0x08,
+		0x01, 0x4a, 0x00, 0x04, 0x05, 0x02, 0x05, 0x04, 0x02, 0x70, 0x06, 0x01, 0x02, 0x07, 0x01, 0x01,
+		0x08, 0x02, 0x01, 0x63, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x09, 0x01,
+		0x08, 0x08, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x40,
+		0x24, 0x27, 0x23, 0x16, 0x26, 0x24, 0x2a, 0x34, 0x0a, 0x07, 0x1c, 0x2b, 0x24, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x27, 0x23, 0x22,
+		0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x16,
+		0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17,
+		0x17, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x16, 0x15, 0x14, 0x07, 0x21, 0x03, 0xb5,
+		0x1d, 0x1d, 0x22, 0xfd, 0xa1, 0x16, 0x20, 0x09, 0x0a, 0x56, 0x46, 0x06, 0x8c, 0x22, 0x1d, 0x1d,
+		0x22, 0x52, 0x27, 0x24, 0x54, 0x9a, 0x64, 0x9e, 0x8b, 0x22, 0x10, 0x18, 0x1d, 0x0f, 0x13, 0x6b,
+		0x7a, 0x37, 0x54, 0x2c, 0x1e, 0x1e, 0x1d, 0x01, 0x1a, 0x22, 0x1d, 0x1d, 0x22, 0xee, 0x04, 0x7d,
+		0x01, 0xcb, 0x90, 0x21, 0x27, 0x27, 0x21, 0x3d, 0x22, 0x0d, 0x14, 0x0a, 0x55, 0x8e, 0x50, 0x1f,
+		0x1c, 0x21, 0x27, 0x27, 0x21, 0x4d, 0x63, 0x3c, 0x5c, 0x94, 0x55, 0x57, 0x15, 0x1e, 0x15, 0x1d,
+		0x2b, 0x0c, 0x47, 0x2f, 0x51, 0x31, 0x2a, 0x4f, 0x39, 0x3a, 0x21, 0x27, 0x27, 0x21, 0x18, 0x22,
+		0xa0, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe2, 0xff, 0xea, 0x04, 0xea, 0x04, 0xad, 0x00, 0x3f,
+		0x00, 0x42, 0x00, 0x45, 0x00, 0x7d, 0x40, 0x10, 0x3b, 0x1d, 0x02, 0x07, 0x05, 0x0d, 0x01, 0x00,
+		0x04, 0x45, 0x42, 0x02, 0x01, 0x00, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x21, 0x0d,
+		0x0a, 0x08, 0x06, 0x04, 0x04, 0x0c, 0x0b, 0x03, 0x03, 0x00, 0x01, 0x04, 0x00, 0x63, 0x09, 0x01,
+		0x05, 0x05, 0x0e, 0x4b, 0x00, 0x07, 0x07, 0x11, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c,
+		0x1b, 0x40, 0x24, 0x00, 0x07, 0x05, 0x04, 0x05, 0x07, 0x04, 0x70, 0x0d, 0x0a, 0x08, 0x06, 0x04,
+		0x04, 0x0c, 0x0b, 0x03, 0x03, 0x00, 0x01, 0x04, 0x00, 0x63, 0x09, 0x01, 0x05, 0x05, 0x0e, 0x4b,
+		0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x59, 0x40, 0x18, 0x00, 0x00, 0x44, 0x43, 0x41, 0x40,
+		0x00, 0x3f, 0x00, 0x3e, 0x38, 0x35, 0x13, 0x23, 0x13, 0x36, 0x24, 0x23, 0x24, 0x23, 0x24, 0x0e,
+		0x07, 0x1d, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x03, 0x06, 0x06, 0x23, 0x22, 0x27,
+		0x03, 0x03, 0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33,
+		0x03, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x17, 0x13, 0x33, 0x37, 0x36, 0x36,
+		0x33, 0x32, 0x16, 0x17, 0x17, 0x33, 0x13, 0x36, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x15, 0x14,
+		0x07, 0x03, 0x33, 0x05, 0x23, 0x13, 0x01, 0x23, 0x13, 0x04, 0xcd, 0x1d, 0x1d, 0x22, 0x72, 0x4e,
+		0x05, 0x29, 0x28, 0x4d, 0x17, 0xcf, 0xcf, 0x17, 0x4d, 0x28, 0x29, 0x05, 0x4e, 0x6a, 0x22, 0x1d,
+		0x1d, 0x22, 0x56, 0x33, 0x01, 0x20, 0x24, 0x07, 0x0d, 0x1e, 0x1c, 0x04, 0x31, 0xee, 0x20, 0x07,
+		0x23, 0x20, 0x20, 0x23, 0x07, 0x20, 0xee, 0x31, 0x04, 0x1c, 0x1e, 0x0d, 0x07, 0x24, 0x20, 0x01,
+		0x33, 0x5e, 0xfd, 0x1a, 0xa9, 0x2d, 0x02, 0x5f, 0xa9, 0x7c, 0x02, 0xf2, 0x21, 0x27, 0x27, 0x21,
+		0xfd, 0xc9, 0x24, 0x1d, 0x41, 0x02, 0x4a, 0xfd, 0xb6, 0x41, 0x1d, 0x24, 0x02, 0x37, 0x21, 0x27,
+		0x27, 0x21, 0x01, 0x70, 0x06, 0x0c, 0x19, 0x1a, 0x05, 0x01, 0x1b, 0x1f, 0xfe, 0x7f, 0x5b, 0x14,
+		0x14, 0x14, 0x14, 0x5b, 0x01, 0x81, 0x1f, 0x1b, 0x01, 0x05, 0x1a, 0x19, 0x0c, 0x06, 0xfe, 0x90,
+		0x90, 0xfe, 0xa0, 0x01, 0x60, 0xfe, 0xa0, 0x00, 0x00, 0x01, 0x00, 0x7d, 0xff, 0xf6, 0x04, 0x4f,
+		0x04, 0xb1, 0x00, 0x42, 0x00, 0x3e, 0x40, 0x3b, 0x3d, 0x01, 0x01, 0x00, 0x29, 0x0e, 0x02, 0x02,
+		0x01, 0x02, 0x4a, 0x08, 0x01, 0x00, 0x07, 0x01, 0x01, 0x02, 0x00, 0x01, 0x62, 0x06, 0x01, 0x02,
+		0x05, 0x01, 0x03, 0x04, 0x02, 0x03, 0x61, 0x0a, 0x01, 0x09, 0x09, 0x16, 0x4b, 0x00, 0x04, 0x04,
+		0x0f, 0x04, 0x4c, 0x40, 0x3f, 0x3b, 0x39, 0x24, 0x22, 0x24, 0x23, 0x33, 0x24, 0x22, 0x24, 0x25,
+		0x0b, 0x07, 0x1d, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x03, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+		0x23, 0x23, 0x07, 0x15, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x15, 0x14, 0x06, 0x23,
+		0x23, 0x22, 0x26, 0x35, 0x35, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x35, 0x27, 0x23,
+		0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x03, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x33, 0x32,
+		0x17, 0x01, 0x01, 0x36, 0x33, 0x32, 0x17, 0x04, 0x38, 0x17, 0x0f, 0xe7, 0x9e, 0x22, 0x1d, 0x1d,
+		0x22, 0xfc, 0x4a, 0x01, 0x32, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xce, 0x21, 0x29, 0x02, 0x29, 0x21,
+		0xfe, 0xce, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x32, 0x4a, 0xfc, 0x22, 0x1d, 0x1d, 0x22, 0x9e, 0xe7,
+		0x0f, 0x17, 0x19, 0x21, 0x13, 0x1e, 0x12, 0x01, 0x55, 0x01, 0x55, 0x14, 0x1c, 0x13, 0x21, 0x04,
+		0x98, 0x19, 0x10, 0x10, 0x17, 0xfe, 0xa0, 0x21, 0x27, 0x27, 0x21, 0x71, 0x35, 0x21, 0x27, 0x27,
+		0x21, 0xeb, 0x23, 0x1e, 0x1e, 0x23, 0xeb, 0x21, 0x27, 0x27, 0x21, 0x35, 0x71, 0x21, 0x27, 0x27,
+		0x21, 0x01, 0x60, 0x17, 0x10, 0x10, 0x19, 0x0b, 0x0e, 0x1d, 0xfd, 0xf2, 0x02, 0x0e, 0x1d, 0x0e,
+		0xff, 0xff, 0x00, 0x96, 0x00, 0xe5, 0x04, 0x36, 0x03, 0xa7, 0x00, 0x27, 0x01, 0x59, 0x00, 0x00,
+		0x00, 0xc8, 0x01, 0x07, 0x01, 0x59, 0x00, 0x00, 0xff, 0x38, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0,
+		0xc8, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x38, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x96, 0x01, 0xad, 0x04, 0x36, 0x02, 0xdf, 0x00, 0x25, 0x00, 0x4c, 0xb1, 0x06,
+		0x64, 0x44, 0x40, 0x41, 0x0d, 0x01, 0x00, 0x01, 0x20, 0x01, 0x04, 0x03, 0x02, 0x4a, 0x00, 0x01,
+		0x05, 0x00, 0x05, 0x01, 0x00, 0x70, 0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x70, 0x00, 0x00,
+		0x03, 0x02, 0x00, 0x57, 0x06, 0x01, 0x05, 0x00, 0x03, 0x04, 0x05, 0x03, 0x63, 0x00, 0x00, 0x00,
+		0x02, 0x5b, 0x00, 0x02, 0x00, 0x02, 0x4f, 0x00, 0x00, 0x00, 0x25, 0x00, 0x24, 0x22, 0x24, 0x27,
+		0x22, 0x24, 0x07, 0x07, 0x19, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x16, 0x17, 0x16, 0x16, 0x33,
+		0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
+		0x26, 0x26, 0x23, 0x22, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33,
+		0x01, 0xdc, 0x65, 0x40, 0x3a, 0x48, 0x27, 0x55, 0x46, 0x10, 0x16, 0x16, 0x15, 0x20, 0x07, 0x2f,
+		0x88, 0x4e, 0x3a, 0x64, 0x42, 0x38, 0x4a, 0x26, 0x55, 0x46, 0x10, 0x16, 0x16, 0x15, 0x20, 0x07,
+		0x2f, 0x88, 0x4e, 0x02, 0xdf, 0x2a, 0x28, 0x22, 0x20, 0x54, 0x13, 0x11, 0x18, 0x1c, 0x0e, 0x0b,
+		0x4c, 0x5b, 0x2a, 0x28, 0x21, 0x21, 0x54, 0x13, 0x11, 0x18, 0x1c, 0x0e, 0x0b, 0x4c, 0x5b, 0x00,
+		0x00, 0x03, 0x00, 0xaa, 0x00, 0x6e, 0x04, 0x22, 0x04, 0x1f, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x29,
+		0x00, 0x41, 0x40, 0x3e, 0x06, 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x63, 0x07, 0x01, 0x03,
+		0x00, 0x02, 0x05, 0x03, 0x02, 0x61, 0x08, 0x01, 0x05, 0x04, 0x04, 0x05, 0x57, 0x08, 0x01, 0x05,
+		0x05, 0x04, 0x5b, 0x00, 0x04, 0x05, 0x04, 0x4f, 0x1c, 0x1c, 0x0e, 0x0e, 0x00, 0x00, 0x1c, 0x29,
+		0x1c, 0x28, 0x23, 0x21, 0x0e, 0x1b, 0x0e, 0x19, 0x15, 0x12, 0x00, 0x0d, 0x00, 0x0c, 0x25, 0x09,
+		0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36,
+		0x33, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x00,
+		0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x02, 0x9e, 0x31,
+		0x31, 0x38, 0x38, 0x31, 0x31, 0x38, 0x01, 0x9f, 0x1d, 0x1d, 0x22, 0xfd, 0x06, 0x22, 0x1d, 0x1d,
+		0x22, 0x02, 0xfa, 0xfe, 0xbb, 0x31, 0x31, 0x38, 0x38, 0x31, 0x31, 0x38, 0x04, 0x1f, 0x1d, 0x22,
+		0x68, 0x22, 0x1d, 0x1d, 0x22, 0x68, 0x22, 0x1d, 0xfe, 0x6f, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27,
+		0x27, 0x21, 0xfe, 0xc6, 0x1d, 0x22, 0x68, 0x22, 0x1d, 0x1d, 0x22, 0x68, 0x22, 0x1d, 0x00, 0x00,
+		0xff, 0xff, 0x00, 0xaa, 0x01, 0x36, 0x04, 0x22, 0x03, 0x56, 0x00, 0x27, 0x01, 0x63, 0x00, 0x00,
+		0x00, 0xc8, 0x01, 0x07, 0x01, 0x63, 0x00, 0x00, 0xff, 0x38, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0,
+		0xc8, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x38, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0xaf, 0x00, 0x77, 0x04, 0x4f, 0x04, 0x17, 0x00, 0x19, 0x00, 0x1f, 0x40, 0x1c,
+		0x18, 0x01, 0x02, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00,
+		0x01, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x2b, 0x14, 0x02, 0x07, 0x16, 0x2b, 0x12, 0x35, 0x34,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x01, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x01, 0x06, 0x23, 0x22,
+		0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x01, 0xaf, 0x0c, 0x17, 0x23, 0x10, 0x12, 0x03, 0x09, 0x19,
+		0x16, 0x16, 0x19, 0xfc, 0xf7, 0x12, 0x10, 0x23, 0x17, 0x0c, 0x29, 0x02, 0xa0, 0xfd, 0x60, 0x03,
+		0x9d, 0x21, 0x12, 0x18, 0x2f, 0x09, 0xfe, 0x83, 0x0d, 0x20, 0x1d, 0x1d, 0x20, 0x0d, 0xfe, 0x83,
+		0x09, 0x2f, 0x18, 0x12, 0x21, 0x14, 0x01, 0x42, 0x01, 0x42, 0x00, 0x00, 0x00, 0x02, 0x00, 0xaa,
+		0x00, 0x6e, 0x04, 0x22, 0x04, 0x6b, 0x00, 0x17, 0x00, 0x25, 0x00, 0x08, 0xb5, 0x1c, 0x18, 0x14,
+		0x06, 0x02, 0x30, 0x2b, 0x01, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35,
+		0x34, 0x37, 0x25, 0x25, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x00, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x03, 0xee, 0x34, 0x34, 0xfd, 0x1e,
+		0x11, 0x0e, 0x26, 0x14, 0x08, 0x30, 0x02, 0x65, 0xfd, 0x9b, 0x30, 0x08, 0x14, 0x26, 0x0f, 0x10,
+		0x02, 0xf9, 0x1d, 0x1d, 0x22, 0xfd, 0x06, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0xfa, 0x03, 0x43, 0x14,
+		0x3c, 0x3c, 0x14, 0xfe, 0xde, 0x06, 0x34, 0x13, 0x12, 0x26, 0x11, 0xe8, 0xe8, 0x11, 0x26, 0x12,
+		0x13, 0x34, 0x06, 0xfc, 0x99, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x1c, 0x01, 0x25, 0x04, 0xb0, 0x03, 0x67, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x33,
+		0x00, 0x0a, 0xb7, 0x2c, 0x28, 0x20, 0x1c, 0x06, 0x00, 0x03, 0x30, 0x2b, 0x00, 0x16, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
+		0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x04, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
+		0x37, 0x26, 0x26, 0x23, 0x20, 0x06, 0x07, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
+		0x03, 0xe7, 0x80, 0x49, 0x49, 0x80, 0x4f, 0x67, 0x8a, 0x41, 0x41, 0x8a, 0x67, 0x4f, 0x80, 0x49,
+		0x49, 0x80, 0x4f, 0x67, 0x8b, 0x40, 0x40, 0x8b, 0x67, 0xfd, 0x5d, 0x4f, 0x4f, 0x42, 0x49, 0x6a,
+		0x36, 0x37, 0x69, 0x49, 0x02, 0x15, 0x6b, 0x35, 0x35, 0x6b, 0x49, 0x42, 0x4f, 0x4f, 0x42, 0x03,
+		0x67, 0x4c, 0x84, 0x51, 0x51, 0x84, 0x4c, 0x63, 0x59, 0x59, 0x63, 0x4c, 0x84, 0x51, 0x51, 0x84,
+		0x4c, 0x63, 0x5a, 0x5a, 0x63, 0x86, 0x58, 0x43, 0x43, 0x58, 0x50, 0x4b, 0x4b, 0x50, 0x51, 0x4a,
+		0x4b, 0x50, 0x58, 0x43, 0x43, 0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0xfe, 0x66, 0x04, 0xc7,
+		0x05, 0xed, 0x00, 0x2b, 0x00, 0x06, 0xb3, 0x14, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x17, 0x16,
+		0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x14, 0x06,
+		0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x33,
+		0x32, 0x36, 0x35, 0x11, 0x34, 0x36, 0x36, 0x33, 0x03, 0xd3, 0x8f, 0x3f, 0x14, 0x12, 0x06, 0x12,
+		0x22, 0x04, 0x0e, 0x84, 0x6b, 0x69, 0x72, 0x59, 0xa5, 0x71, 0x49, 0x8f, 0x3f, 0x14, 0x12, 0x06,
+		0x12, 0x22, 0x04, 0x0e, 0x84, 0x6b, 0x69, 0x72, 0x59, 0xa5, 0x71, 0x05, 0xed, 0x1f, 0x1b, 0x08,
+		0x18, 0x12, 0x0f, 0x14, 0x3a, 0x04, 0x33, 0x8f, 0x83, 0xfb, 0xb5, 0x7c, 0xb8, 0x64, 0x1f, 0x1b,
+		0x08, 0x18, 0x12, 0x0f, 0x14, 0x3a, 0x04, 0x33, 0x8f, 0x83, 0x04, 0x4b, 0x7c, 0xb8, 0x64, 0x00,
+		0x00, 0x01, 0x00, 0x7d, 0x00, 0x77, 0x04, 0x1d, 0x04, 0x17, 0x00, 0x19, 0x00, 0x1f, 0x40, 0x1c,
+		0x18, 0x01, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01,
+		0x00, 0x5b, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x2b, 0x14, 0x02, 0x07, 0x16, 0x2b, 0x24, 0x15, 0x14,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x01, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x01, 0x36, 0x33, 0x32,
+		0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x01, 0x04, 0x1d, 0x0c, 0x17, 0x23, 0x10, 0x12, 0xfc, 0xf7,
+		0x19, 0x16, 0x16, 0x19, 0x03, 0x09, 0x12, 0x10, 0x23, 0x17, 0x0c, 0x29, 0xfd, 0x60, 0x02, 0xa0,
+		0xf1, 0x21, 0x12, 0x18, 0x2f, 0x09, 0x01, 0x7d, 0x0d, 0x20, 0x1d, 0x1d, 0x20, 0x0d, 0x01, 0x7d,
+		0x09, 0x2f, 0x18, 0x12, 0x21, 0x14, 0xfe, 0xbe, 0xfe, 0xbe, 0x00, 0x00, 0x00, 0x02, 0x00, 0xaa,
+		0x00, 0x6e, 0x04, 0x22, 0x04, 0x6b, 0x00, 0x17, 0x00, 0x25, 0x00, 0x08, 0xb5, 0x1c, 0x18, 0x0e,
+		0x00, 0x02, 0x30, 0x2b, 0x00, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x05, 0x05, 0x16, 0x15,
+		0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x01, 0x26, 0x35, 0x34, 0x37, 0x01, 0x12, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x03, 0xd1, 0x0e, 0x26, 0x14, 0x08,
+		0x30, 0xfd, 0x9b, 0x02, 0x65, 0x30, 0x08, 0x14, 0x26, 0x0e, 0x11, 0xfd, 0x1e, 0x34, 0x34, 0x02,
+		0xe2, 0x45, 0x1d, 0x1d, 0x22, 0xfd, 0x06, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0xfa, 0x04, 0x6b, 0x34,
+		0x13, 0x12, 0x26, 0x11, 0xe8, 0xe8, 0x11, 0x26, 0x12, 0x13, 0x34, 0x06, 0x01, 0x22, 0x14, 0x3c,
+		0x3c, 0x14, 0x01, 0x22, 0xfc, 0x99, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x8c, 0x01, 0x3e, 0x04, 0x36, 0x03, 0x51, 0x00, 0x12, 0x00, 0x25, 0x40, 0x22,
+		0x00, 0x00, 0x01, 0x00, 0x73, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x55, 0x03, 0x01, 0x02, 0x02,
+		0x01, 0x59, 0x00, 0x01, 0x02, 0x01, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x10, 0x23, 0x25, 0x04,
+		0x07, 0x16, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x21, 0x22,
+		0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0x19, 0x1d, 0x22, 0x29, 0x29, 0x22, 0xfd, 0x2b, 0x22,
+		0x1d, 0x1d, 0x22, 0x03, 0x2c, 0x03, 0x51, 0x1f, 0x25, 0xfe, 0x72, 0x23, 0x1e, 0x1e, 0x23, 0x01,
+		0x42, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaa, 0x01, 0xfe, 0x04, 0x22,
+		0x02, 0x8e, 0x00, 0x0d, 0x00, 0x06, 0xb3, 0x04, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x04, 0x05, 0x1d, 0x1d, 0x22, 0xfd,
+		0x06, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0xfa, 0x02, 0x8e, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27,
+		0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe7, 0x00, 0xc7, 0x03, 0xe5, 0x03, 0xc5, 0x00, 0x27,
+		0x00, 0x20, 0x40, 0x1d, 0x27, 0x1d, 0x13, 0x09, 0x04, 0x00, 0x02, 0x01, 0x4a, 0x01, 0x01, 0x00,
+		0x00, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x19, 0x00, 0x4c, 0x24, 0x2c, 0x24, 0x25, 0x04, 0x07,
+		0x18, 0x2b, 0x01, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x01, 0x01, 0x06, 0x23, 0x22,
+		0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x01, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x01,
+		0x01, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x03, 0xce, 0x17, 0x1d, 0x1d, 0x17,
+		0x15, 0x17, 0xfe, 0xfe, 0xfe, 0xfe, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17, 0x01, 0x02, 0xfe, 0xfe,
+		0x17, 0x1d, 0x1d, 0x17, 0x15, 0x17, 0x01, 0x02, 0x01, 0x02, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17,
+		0xfe, 0xfe, 0x01, 0x44, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17, 0x01, 0x02, 0xfe, 0xfe, 0x17, 0x1d,
+		0x1d, 0x17, 0x15, 0x17, 0x01, 0x02, 0x01, 0x02, 0x17, 0x15, 0x17, 0x1d, 0x1d, 0x17, 0xfe, 0xfe,
+		0x01, 0x02, 0x17, 0x1d, 0x1d, 0x17, 0x15, 0x17, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaa,
+		0x00, 0x44, 0x04, 0x22, 0x04, 0x48, 0x00, 0x37, 0x00, 0x06, 0xb3, 0x25, 0x09, 0x01, 0x30, 0x2b,
+		0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x07, 0x06, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34,
+		0x37, 0x37, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x13, 0x21, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x33, 0x21, 0x37, 0x36, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x07, 0x33, 0x32,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x03, 0x21, 0x04, 0x05, 0x1d, 0x1d, 0x22, 0xfe, 0x3b, 0x7a,
+		0x0b, 0x16, 0x0e, 0x13, 0x19, 0x27, 0x0e, 0x51, 0x98, 0x22, 0x1d, 0x1d, 0x22, 0xe2, 0x98, 0xfe,
+		0x86, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0xc4, 0x7b, 0x0b, 0x16, 0x0e, 0x13, 0x19, 0x27, 0x0e, 0x51,
+		0x98, 0x22, 0x1d, 0x1d, 0x22, 0xe3, 0x97, 0x01, 0x7a, 0x01, 0xc6, 0x21, 0x27, 0x27, 0x21, 0xcf,
+		0x12, 0x11, 0x0f, 0x16, 0x1c, 0x11, 0x17, 0x89, 0x21, 0x27, 0x27, 0x21, 0x01, 0x00, 0x21, 0x27,
+		0x27, 0x21, 0xcf, 0x12, 0x11, 0x0f, 0x16, 0x1c, 0x11, 0x17, 0x89, 0x21, 0x27, 0x27, 0x21, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xa7, 0xff, 0xe9, 0x04, 0x19, 0x04, 0xb9, 0x00, 0x26,
+		0x00, 0x33, 0x00, 0x08, 0xb5, 0x2c, 0x27, 0x08, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x16, 0x15,
+		0x14, 0x02, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+		0x17, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34,
+		0x37, 0x36, 0x33, 0x02, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x36, 0x36, 0x37, 0x26, 0x26, 0x23,
+		0x02, 0xf3, 0xb7, 0x6f, 0x3c, 0x36, 0x43, 0xc9, 0x8d, 0x6b, 0xa3, 0x59, 0x67, 0xb4, 0x70, 0x71,
+		0xa8, 0x2a, 0x17, 0x88, 0x83, 0x40, 0x53, 0x05, 0x0a, 0x10, 0x1a, 0x0c, 0x09, 0x1f, 0x5b, 0x6a,
+		0x93, 0x72, 0x3e, 0x70, 0x5c, 0x6d, 0x97, 0x31, 0x13, 0x89, 0x67, 0x04, 0xb9, 0x65, 0xd2, 0x9c,
+		0x70, 0xfe, 0xf2, 0x6f, 0x8a, 0x86, 0x5c, 0xa3, 0x66, 0x75, 0xb5, 0x63, 0x6b, 0x62, 0x6e, 0x58,
+		0x9c, 0xae, 0x17, 0x02, 0x19, 0x1e, 0x17, 0x10, 0x21, 0x0e, 0x27, 0xfd, 0x8e, 0x3e, 0x71, 0x4b,
+		0x5e, 0x71, 0x01, 0x6f, 0x73, 0x65, 0x81, 0x00, 0x00, 0x05, 0x00, 0x32, 0xff, 0xea, 0x04, 0x9a,
+		0x04, 0xb9, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x31, 0x00, 0x41, 0x00, 0x51, 0x00, 0x62, 0x40, 0x5f,
+		0x00, 0x02, 0x01, 0x05, 0x01, 0x02, 0x05, 0x70, 0x00, 0x03, 0x08, 0x06, 0x08, 0x03, 0x06, 0x70,
+		0x00, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x63, 0x0c, 0x01, 0x07, 0x0d, 0x01, 0x09, 0x08, 0x07,
+		0x09, 0x63, 0x0b, 0x01, 0x05, 0x05, 0x01, 0x5b, 0x0a, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x08,
+		0x08, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x17, 0x06, 0x4c, 0x42, 0x42, 0x32, 0x32, 0x22, 0x22, 0x00,
+		0x00, 0x42, 0x51, 0x42, 0x50, 0x4a, 0x48, 0x32, 0x41, 0x32, 0x40, 0x3a, 0x38, 0x22, 0x31, 0x22,
+		0x30, 0x2a, 0x28, 0x1b, 0x19, 0x12, 0x10, 0x00, 0x0f, 0x00, 0x0e, 0x26, 0x0e, 0x07, 0x15, 0x2b,
+		0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+		0x04, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34,
+		0x37, 0x01, 0x24, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+		0x26, 0x23, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
+		0x36, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+		0x23, 0x01, 0x8e, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x02, 0xbd,
+		0x17, 0x1a, 0x18, 0x19, 0x18, 0xfc, 0x96, 0x16, 0x17, 0x1a, 0x18, 0x19, 0x18, 0x03, 0x6a, 0xfd,
+		0x32, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x02, 0x8e, 0x7e, 0x4a,
+		0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27,
+		0x42, 0x27, 0x27, 0x42, 0x27, 0x04, 0xb9, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a,
+		0x4a, 0x7e, 0x4a, 0x80, 0x1b, 0x1b, 0x16, 0x17, 0x17, 0xfc, 0xc2, 0x16, 0x1b, 0x1b, 0x16, 0x18,
+		0x16, 0x03, 0x3e, 0x14, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27,
+		0xfd, 0xd7, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x82, 0x27,
+		0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x00, 0x00, 0x06, 0x00, 0x32,
+		0xff, 0xea, 0x06, 0x3c, 0x04, 0xb9, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x31, 0x00, 0x4d, 0x00, 0x5d,
+		0x00, 0x6d, 0x00, 0x7d, 0x40, 0x7a, 0x4a, 0x01, 0x0b, 0x08, 0x3c, 0x01, 0x06, 0x03, 0x02, 0x4a,
+		0x00, 0x02, 0x01, 0x05, 0x01, 0x02, 0x05, 0x70, 0x00, 0x03, 0x0a, 0x06, 0x0a, 0x03, 0x06, 0x70,
+		0x00, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x63, 0x10, 0x09, 0x02, 0x08, 0x12, 0x0d, 0x11, 0x03,
+		0x0b, 0x0a, 0x08, 0x0b, 0x63, 0x0f, 0x01, 0x05, 0x05, 0x01, 0x5b, 0x0e, 0x01, 0x01, 0x01, 0x16,
+		0x4b, 0x0c, 0x01, 0x0a, 0x0a, 0x06, 0x5b, 0x07, 0x01, 0x06, 0x06, 0x17, 0x06, 0x4c, 0x5e, 0x5e,
+		0x4e, 0x4e, 0x32, 0x32, 0x22, 0x22, 0x00, 0x00, 0x5e, 0x6d, 0x5e, 0x6c, 0x66, 0x64, 0x4e, 0x5d,
+		0x4e, 0x5c, 0x56, 0x54, 0x32, 0x4d, 0x32, 0x4c, 0x48, 0x46, 0x40, 0x3e, 0x3a, 0x38, 0x22, 0x31,
+		0x22, 0x30, 0x2a, 0x28, 0x1b, 0x19, 0x12, 0x10, 0x00, 0x0f, 0x00, 0x0e, 0x26, 0x13, 0x07, 0x15,
+		0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+		0x33, 0x04, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35,
+		0x34, 0x37, 0x01, 0x24, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
+		0x26, 0x26, 0x23, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06,
+		0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x04,
+		0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x20,
+		0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x01,
+		0x8e, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x02, 0xbd, 0x17, 0x1a,
+		0x18, 0x19, 0x18, 0xfc, 0x96, 0x16, 0x17, 0x1a, 0x18, 0x19, 0x18, 0x03, 0x6a, 0xfd, 0x32, 0x42,
+		0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x04, 0x30, 0x7e, 0x4a, 0x4a, 0x7e,
+		0x4a, 0x40, 0x6d, 0x24, 0x25, 0x6c, 0x40, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x40, 0x6c, 0x25,
+		0x24, 0x6d, 0x40, 0xfe, 0x37, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27,
+		0x01, 0x7b, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x04, 0xb9, 0x4a,
+		0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x80, 0x1b, 0x1b, 0x16, 0x17,
+		0x17, 0xfc, 0xc2, 0x16, 0x1b, 0x1b, 0x16, 0x18, 0x16, 0x03, 0x3e, 0x14, 0x27, 0x42, 0x27, 0x27,
+		0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0xfd, 0xd7, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a,
+		0x38, 0x30, 0x31, 0x37, 0x4a, 0x7e, 0x4a, 0x4a, 0x7e, 0x4a, 0x38, 0x31, 0x31, 0x38, 0x82, 0x27,
+		0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x27, 0x42,
+		0x27, 0x27, 0x42, 0x27, 0x27, 0x42, 0x27, 0x00, 0x00, 0x01, 0x00, 0xaa, 0x00, 0x8a, 0x04, 0x22,
+		0x04, 0x02, 0x00, 0x1f, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x04, 0x03, 0x01, 0x04, 0x57, 0x06, 0x05,
+		0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01,
+		0x04, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x23, 0x24, 0x23, 0x23, 0x24, 0x07, 0x07,
+		0x19, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35,
+		0x11, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x11, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+		0x11, 0x21, 0x04, 0x05, 0x1d, 0x1d, 0x22, 0xfe, 0xcb, 0x21, 0x27, 0x27, 0x21, 0xfe, 0xcb, 0x22,
+		0x1d, 0x1d, 0x22, 0x01, 0x35, 0x21, 0x27, 0x27, 0x21, 0x01, 0x35, 0x02, 0x8e, 0x21, 0x27, 0x27,
+		0x21, 0xfe, 0xcb, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x35, 0x21, 0x27, 0x27, 0x21, 0x01, 0x35, 0x22,
+		0x1d, 0x1d, 0x22, 0xfe, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xaa, 0x00, 0x6e, 0x04, 0x22,
+		0x04, 0x66, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3e, 0x40, 0x3b, 0x02, 0x01, 0x00, 0x08, 0x05, 0x02,
+		0x03, 0x04, 0x00, 0x03, 0x61, 0x00, 0x01, 0x00, 0x04, 0x07, 0x01, 0x04, 0x63, 0x09, 0x01, 0x07,
+		0x06, 0x06, 0x07, 0x55, 0x09, 0x01, 0x07, 0x07, 0x06, 0x59, 0x00, 0x06, 0x07, 0x06, 0x4d, 0x20,
+		0x20, 0x00, 0x00, 0x20, 0x2d, 0x20, 0x2b, 0x27, 0x24, 0x00, 0x1f, 0x00, 0x1e, 0x23, 0x24, 0x23,
+		0x23, 0x24, 0x0a, 0x07, 0x19, 0x2b, 0x12, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x35, 0x34, 0x36,
+		0x33, 0x32, 0x16, 0x15, 0x15, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x15, 0x14, 0x06,
+		0x23, 0x22, 0x26, 0x35, 0x35, 0x21, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35,
+		0x34, 0x36, 0x33, 0x21, 0xc7, 0x1d, 0x1d, 0x22, 0x01, 0x35, 0x21, 0x27, 0x27, 0x21, 0x01, 0x35,
+		0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xcb, 0x21, 0x27, 0x27, 0x21, 0xfe, 0xcb, 0x03, 0x1c, 0x1d, 0x1d,
+		0x22, 0xfd, 0x06, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0xfa, 0x02, 0x9e, 0x21, 0x27, 0x27, 0x21, 0xf9,
+		0x22, 0x1d, 0x1d, 0x22, 0xf9, 0x21, 0x27, 0x27, 0x21, 0xf9, 0x22, 0x1d, 0x1d, 0x22, 0xf9, 0xfe,
+		0x60, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc3,
+		0xff, 0xf6, 0x04, 0x09, 0x04, 0xa3, 0x00, 0x19, 0x00, 0x06, 0xb3, 0x05, 0x00, 0x01, 0x30, 0x2b,
+		0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x21, 0x11, 0x14, 0x06,
+		0x23, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x21, 0x03, 0xec, 0x1d, 0x21, 0x29, 0x02,
+		0x29, 0x21, 0xfd, 0xe6, 0x21, 0x29, 0x02, 0x29, 0x21, 0x1d, 0x22, 0x02, 0xc8, 0x04, 0xa3, 0x1f,
+		0x25, 0xfb, 0xd8, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0xdc, 0xfc, 0x24, 0x23, 0x1e, 0x1e, 0x23, 0x04,
+		0x28, 0x25, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x74, 0xff, 0xea, 0x04, 0x50, 0x04, 0xad, 0x00, 0x1e,
+		0x00, 0x06, 0xb3, 0x1b, 0x07, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x06,
+		0x23, 0x22, 0x26, 0x27, 0x03, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x32, 0x16, 0x17,
+		0x13, 0x01, 0x36, 0x36, 0x33, 0x32, 0x17, 0x04, 0x35, 0x1b, 0x06, 0xfe, 0x85, 0x0d, 0x32, 0x2b,
+		0x2b, 0x33, 0x0e, 0xc1, 0x85, 0x22, 0x1d, 0x1d, 0x22, 0xc0, 0x17, 0x1b, 0x07, 0xb5, 0x01, 0x58,
+		0x08, 0x1a, 0x14, 0x0e, 0x1a, 0x04, 0x9b, 0x1a, 0x13, 0x0d, 0x12, 0xfb, 0xdc, 0x23, 0x1e, 0x1f,
+		0x22, 0x01, 0xd3, 0x21, 0x27, 0x27, 0x21, 0x0f, 0x11, 0xfe, 0x48, 0x03, 0xc9, 0x18, 0x16, 0x08,
+		0x00, 0x03, 0x00, 0xa5, 0xfc, 0xba, 0x04, 0x10, 0x07, 0x05, 0x00, 0x03, 0x00, 0x25, 0x00, 0x29,
+		0x00, 0x0a, 0xb7, 0x28, 0x26, 0x16, 0x04, 0x02, 0x00, 0x03, 0x30, 0x2b, 0x01, 0x23, 0x35, 0x33,
+		0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x01, 0x16, 0x15, 0x14, 0x07, 0x01, 0x21, 0x32, 0x16,
+		0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x37, 0x01, 0x01, 0x26, 0x35, 0x34, 0x36,
+		0x33, 0x21, 0x01, 0x23, 0x35, 0x33, 0x02, 0x66, 0x01, 0x01, 0x01, 0x79, 0x1d, 0x1d, 0x22, 0xfd,
+		0xd5, 0x01, 0x48, 0x0b, 0x0b, 0xfe, 0xa4, 0x02, 0x53, 0x22, 0x1d, 0x1d, 0x22, 0xfd, 0x15, 0x22,
+		0x1f, 0x10, 0x01, 0x85, 0xfe, 0x8b, 0x0c, 0x1f, 0x22, 0x02, 0xc3, 0xfe, 0xa9, 0x01, 0x01, 0x07,
+		0x04, 0x01, 0xfd, 0x9e, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x6b, 0x0e, 0x10, 0x11, 0x0e, 0xfe, 0x4f,
+		0x21, 0x27, 0x27, 0x21, 0x1f, 0x25, 0x20, 0x15, 0x01, 0xe6, 0x01, 0xcf, 0x0e, 0x23, 0x25, 0x1f,
+		0xf8, 0x17, 0x01, 0x00, 0x00, 0x02, 0x00, 0xcd, 0xff, 0xea, 0x03, 0xfe, 0x04, 0xb9, 0x00, 0x17,
+		0x00, 0x1b, 0x00, 0x08, 0xb5, 0x1b, 0x19, 0x0a, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x17, 0x01,
+		0x16, 0x15, 0x14, 0x07, 0x01, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x01, 0x26, 0x35, 0x34, 0x37,
+		0x01, 0x36, 0x36, 0x33, 0x03, 0x13, 0x13, 0x03, 0x02, 0x8f, 0x2d, 0x14, 0x01, 0x26, 0x08, 0x08,
+		0xfe, 0xda, 0x14, 0x2d, 0x29, 0x29, 0x2d, 0x14, 0xfe, 0xd9, 0x08, 0x08, 0x01, 0x27, 0x14, 0x2d,
+		0x29, 0xf6, 0xf6, 0xf6, 0xf6, 0x04, 0xb9, 0x1e, 0x23, 0xfd, 0xf7, 0x0d, 0x11, 0x11, 0x0d, 0xfd,
+		0xf8, 0x23, 0x1e, 0x1e, 0x23, 0x02, 0x08, 0x10, 0x0e, 0x0e, 0x10, 0x02, 0x09, 0x23, 0x1e, 0xfd,
+		0x98, 0xfe, 0x4d, 0x01, 0xb3, 0x01, 0xb4, 0x00, 0x00, 0x01, 0x02, 0x1b, 0xfe, 0x9d, 0x02, 0xb1,
+		0x05, 0x72, 0x00, 0x0d, 0x00, 0x2e, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0c, 0x02, 0x01, 0x01,
+		0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4c, 0x1b, 0x40, 0x0a, 0x02, 0x01, 0x01, 0x00,
+		0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x59, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0c, 0x25,
+		0x03, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34,
+		0x36, 0x33, 0x02, 0x8f, 0x22, 0x22, 0x29, 0x29, 0x22, 0x22, 0x29, 0x05, 0x72, 0x1e, 0x23, 0xf9,
+		0xad, 0x23, 0x1e, 0x1e, 0x23, 0x06, 0x53, 0x23, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x1b,
+		0xfe, 0x9d, 0x02, 0xb1, 0x05, 0x72, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x50, 0x4b, 0xb0, 0x17, 0x50,
+		0x58, 0x40, 0x15, 0x04, 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x63, 0x05, 0x01, 0x03, 0x03,
+		0x02, 0x5b, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4c, 0x1b, 0x40, 0x1b, 0x04, 0x01, 0x01, 0x00, 0x00,
+		0x03, 0x01, 0x00, 0x63, 0x05, 0x01, 0x03, 0x02, 0x02, 0x03, 0x57, 0x05, 0x01, 0x03, 0x03, 0x02,
+		0x5b, 0x00, 0x02, 0x03, 0x02, 0x4f, 0x59, 0x40, 0x12, 0x0e, 0x0e, 0x00, 0x00, 0x0e, 0x1b, 0x0e,
+		0x1a, 0x15, 0x13, 0x00, 0x0d, 0x00, 0x0c, 0x25, 0x06, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x11,
+		0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x12, 0x16, 0x15, 0x11, 0x14, 0x06,
+		0x23, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33, 0x02, 0x8f, 0x22, 0x22, 0x29, 0x29, 0x22, 0x22,
+		0x29, 0x29, 0x22, 0x22, 0x29, 0x29, 0x22, 0x22, 0x29, 0x05, 0x72, 0x1e, 0x23, 0xfd, 0xa9, 0x23,
+		0x1e, 0x1e, 0x23, 0x02, 0x57, 0x23, 0x1e, 0xfc, 0x04, 0x1e, 0x23, 0xfd, 0xa9, 0x23, 0x1e, 0x1e,
+		0x23, 0x02, 0x57, 0x23, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x32, 0xff, 0x67, 0x04, 0x92,
+		0x04, 0x36, 0x00, 0x4a, 0x00, 0x58, 0x00, 0x5b, 0x40, 0x58, 0x1a, 0x17, 0x02, 0x0a, 0x02, 0x0a,
+		0x01, 0x03, 0x0a, 0x02, 0x4a, 0x00, 0x06, 0x00, 0x05, 0x00, 0x06, 0x05, 0x70, 0x0b, 0x01, 0x08,
+		0x00, 0x04, 0x02, 0x08, 0x04, 0x63, 0x00, 0x02, 0x0c, 0x01, 0x0a, 0x03, 0x02, 0x0a, 0x63, 0x09,
+		0x01, 0x03, 0x01, 0x01, 0x00, 0x06, 0x03, 0x00, 0x63, 0x00, 0x05, 0x07, 0x07, 0x05, 0x57, 0x00,
+		0x05, 0x05, 0x07, 0x5b, 0x00, 0x07, 0x05, 0x07, 0x4f, 0x4b, 0x4b, 0x00, 0x00, 0x4b, 0x58, 0x4b,
+		0x57, 0x52, 0x50, 0x00, 0x4a, 0x00, 0x49, 0x27, 0x32, 0x26, 0x25, 0x2e, 0x26, 0x24, 0x26, 0x0d,
+		0x07, 0x1c, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06,
+		0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x37, 0x36, 0x33, 0x32, 0x17,
+		0x16, 0x16, 0x07, 0x03, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
+		0x22, 0x06, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16,
+		0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x12, 0x24, 0x33, 0x02, 0x06,
+		0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x03, 0x2d, 0xe7, 0x7e,
+		0x46, 0x80, 0x53, 0x41, 0x5d, 0x17, 0x34, 0x5e, 0x3f, 0x31, 0x51, 0x2e, 0x56, 0x92, 0x55, 0x56,
+		0x2a, 0x1f, 0x06, 0x13, 0x0f, 0x13, 0x14, 0x17, 0x04, 0x4d, 0x07, 0x28, 0x23, 0x4b, 0x56, 0x60,
+		0xb1, 0x79, 0x88, 0xdd, 0x7d, 0x5a, 0xae, 0x7b, 0x45, 0x85, 0x35, 0x08, 0x03, 0x1c, 0x0d, 0x05,
+		0x18, 0x36, 0x97, 0x51, 0x9f, 0xe6, 0x7b, 0x9f, 0x01, 0x16, 0xad, 0x3c, 0x55, 0x39, 0x24, 0x1e,
+		0x31, 0x57, 0x34, 0x28, 0x24, 0x04, 0x36, 0x8b, 0xf8, 0xa0, 0x74, 0xb3, 0x63, 0x42, 0x3f, 0x43,
+		0x43, 0x36, 0x65, 0x46, 0x5b, 0xca, 0x87, 0x64, 0x3f, 0x0b, 0x07, 0x07, 0x19, 0x0e, 0xfe, 0xd2,
+		0x1b, 0x19, 0x2a, 0x2f, 0x93, 0x79, 0x82, 0xbf, 0x67, 0x95, 0xfe, 0xfe, 0x9f, 0x80, 0xbd, 0x66,
+		0x14, 0x11, 0x02, 0x2d, 0x12, 0x0a, 0x1b, 0x0a, 0x18, 0x1c, 0x83, 0xf4, 0xa7, 0xc2, 0x01, 0x3b,
+		0xb4, 0xfe, 0x5c, 0x59, 0x8b, 0x47, 0x2f, 0x2e, 0x5b, 0x8a, 0x42, 0x2e, 0x33, 0x00, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0x9d, 0xff, 0xea, 0x04, 0x44, 0x04, 0xf5, 0x00, 0x3b, 0x00, 0x45, 0x00, 0x42,
+		0x40, 0x3f, 0x3e, 0x3d, 0x3a, 0x36, 0x2c, 0x11, 0x08, 0x07, 0x06, 0x05, 0x01, 0x4a, 0x00, 0x03,
+		0x04, 0x05, 0x04, 0x03, 0x05, 0x70, 0x00, 0x05, 0x06, 0x04, 0x05, 0x06, 0x6e, 0x00, 0x02, 0x00,
+		0x04, 0x03, 0x02, 0x04, 0x63, 0x07, 0x01, 0x06, 0x06, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x17,
+		0x00, 0x4c, 0x3c, 0x3c, 0x3c, 0x45, 0x3c, 0x44, 0x1b, 0x23, 0x16, 0x2c, 0x23, 0x24, 0x08, 0x07,
+		0x1a, 0x2b, 0x24, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x27, 0x06, 0x23, 0x22, 0x26, 0x26,
+		0x35, 0x34, 0x36, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x01, 0x36,
+		0x37, 0x36, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x17, 0x24, 0x37,
+		0x01, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x04, 0x44, 0x2b, 0x1f, 0x15, 0x16, 0x15, 0x78,
+		0x89, 0xb5, 0x6e, 0xa3, 0x56, 0x68, 0x5f, 0x2e, 0x2e, 0x57, 0xa1, 0x6a, 0x9e, 0x8b, 0x22, 0x10,
+		0x18, 0x1d, 0x0f, 0x13, 0x6b, 0x7a, 0x3d, 0x5a, 0x30, 0x31, 0x32, 0x01, 0x2a, 0x36, 0x27, 0x07,
+		0x1b, 0x19, 0x0d, 0x12, 0x20, 0x1c, 0x05, 0x38, 0x4e, 0x9a, 0xfe, 0x4f, 0x5f, 0xfe, 0xe4, 0x48,
+		0x44, 0x34, 0x5d, 0x3c, 0x44, 0x11, 0x1b, 0x18, 0x12, 0x16, 0x84, 0x9e, 0x5d, 0x9c, 0x5d, 0x6c,
+		0xa5, 0x44, 0x3b, 0x7c, 0x4c, 0x62, 0x9f, 0x5c, 0x57, 0x14, 0x1e, 0x16, 0x1d, 0x2b, 0x0c, 0x47,
+		0x36, 0x5c, 0x37, 0x3f, 0x66, 0x38, 0xfe, 0xb9, 0x6d, 0x93, 0x1a, 0x16, 0x03, 0x05, 0x18, 0x15,
+		0x0c, 0x14, 0xc5, 0x87, 0xa9, 0x24, 0x76, 0x01, 0x37, 0x35, 0x6f, 0x47, 0x39, 0x58, 0x31, 0x00,
+		0x00, 0x01, 0x00, 0x83, 0xfe, 0x66, 0x04, 0x5d, 0x04, 0xa3, 0x00, 0x20, 0x00, 0x2c, 0x40, 0x29,
+		0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x70, 0x02, 0x01, 0x00, 0x00, 0x05, 0x59, 0x06, 0x01,
+		0x05, 0x05, 0x0e, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x20, 0x00,
+		0x1e, 0x13, 0x23, 0x13, 0x23, 0x24, 0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23,
+		0x23, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26,
+		0x35, 0x11, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x04, 0x40, 0x1d, 0x1d, 0x22, 0x44,
+		0x22, 0x29, 0x29, 0x22, 0xa0, 0x22, 0x29, 0x29, 0x22, 0x75, 0xb3, 0x63, 0x69, 0xbd, 0x7b, 0x01,
+		0xfa, 0x04, 0xa3, 0x21, 0x27, 0x27, 0x21, 0xfa, 0x94, 0x23, 0x1e, 0x1e, 0x23, 0x05, 0x6c, 0xfa,
+		0x94, 0x23, 0x1e, 0x1e, 0x23, 0x03, 0x4f, 0x04, 0x53, 0x98, 0x67, 0x6a, 0x9b, 0x52, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x24, 0xff, 0xea, 0x04, 0xa8, 0x04, 0xb9, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x4b,
+		0x00, 0x67, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x5c, 0x00, 0x04, 0x05, 0x07, 0x05, 0x04, 0x07, 0x70,
+		0x00, 0x07, 0x06, 0x05, 0x07, 0x06, 0x6e, 0x0a, 0x01, 0x01, 0x0b, 0x01, 0x03, 0x09, 0x01, 0x03,
+		0x63, 0x0c, 0x01, 0x09, 0x00, 0x05, 0x04, 0x09, 0x05, 0x63, 0x00, 0x06, 0x00, 0x08, 0x02, 0x06,
+		0x08, 0x63, 0x00, 0x02, 0x00, 0x00, 0x02, 0x57, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x02,
+		0x00, 0x4f, 0x20, 0x20, 0x10, 0x10, 0x00, 0x00, 0x20, 0x4b, 0x20, 0x4a, 0x44, 0x42, 0x3a, 0x38,
+		0x35, 0x33, 0x2f, 0x2d, 0x29, 0x28, 0x10, 0x1f, 0x10, 0x1e, 0x18, 0x16, 0x00, 0x0f, 0x00, 0x0e,
+		0x26, 0x0d, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x04, 0x12, 0x15, 0x14, 0x02, 0x04,
+		0x23, 0x22, 0x24, 0x02, 0x35, 0x34, 0x12, 0x24, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33,
+		0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x07,
+		0x06, 0x23, 0x22, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
+		0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+		0x34, 0x36, 0x36, 0x33, 0x03, 0x0d, 0x01, 0x07, 0x94, 0x94, 0xfe, 0xf8, 0xa6, 0xa6, 0xfe, 0xf8,
+		0x94, 0x94, 0x01, 0x07, 0xa7, 0x85, 0xd0, 0x73, 0x73, 0xd0, 0x85, 0x85, 0xd0, 0x73, 0x73, 0xd0,
+		0x85, 0x3c, 0x5d, 0x2a, 0x15, 0x14, 0x07, 0x10, 0x1c, 0x0c, 0x12, 0x25, 0x41, 0x26, 0x4f, 0x66,
+		0x66, 0x4f, 0x26, 0x41, 0x25, 0x12, 0x0c, 0x1c, 0x10, 0x07, 0x14, 0x15, 0x2a, 0x5d, 0x2d, 0x5b,
+		0x8f, 0x50, 0x50, 0x8f, 0x5b, 0x04, 0xb9, 0xa3, 0xfe, 0xe6, 0xaa, 0xaa, 0xfe, 0xe6, 0xa4, 0xa4,
+		0x01, 0x1a, 0xaa, 0xaa, 0x01, 0x1a, 0xa3, 0x78, 0x80, 0xe1, 0x8e, 0x8e, 0xe2, 0x80, 0x80, 0xe2,
+		0x8e, 0x8e, 0xe1, 0x80, 0x98, 0x15, 0x13, 0x0a, 0x19, 0x12, 0x10, 0x11, 0x28, 0x08, 0x11, 0x0f,
+		0x71, 0x69, 0x69, 0x71, 0x0f, 0x11, 0x08, 0x28, 0x11, 0x10, 0x12, 0x19, 0x0a, 0x13, 0x15, 0x53,
+		0x9b, 0x6a, 0x6a, 0x9b, 0x53, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x24, 0xff, 0xea, 0x04, 0xa8,
+		0x04, 0xb9, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x6c, 0xb1, 0x06, 0x64, 0x44,
+		0x40, 0x61, 0x26, 0x01, 0x05, 0x08, 0x01, 0x4a, 0x06, 0x01, 0x04, 0x05, 0x02, 0x05, 0x04, 0x02,
+		0x70, 0x0a, 0x01, 0x01, 0x0b, 0x01, 0x03, 0x07, 0x01, 0x03, 0x63, 0x0c, 0x01, 0x07, 0x0d, 0x01,
+		0x09, 0x08, 0x07, 0x09, 0x63, 0x00, 0x08, 0x00, 0x05, 0x04, 0x08, 0x05, 0x61, 0x00, 0x02, 0x00,
+		0x00, 0x02, 0x57, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x3e, 0x3e, 0x20,
+		0x20, 0x10, 0x10, 0x00, 0x00, 0x3e, 0x46, 0x3e, 0x45, 0x41, 0x3f, 0x20, 0x3d, 0x20, 0x3b, 0x36,
+		0x34, 0x31, 0x30, 0x2e, 0x2c, 0x10, 0x1f, 0x10, 0x1e, 0x18, 0x16, 0x00, 0x0f, 0x00, 0x0e, 0x26,
+		0x0e, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x04, 0x12, 0x15, 0x14, 0x02, 0x04, 0x23,
+		0x22, 0x24, 0x02, 0x35, 0x34, 0x12, 0x24, 0x33, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+		0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x17, 0x16, 0x15,
+		0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x27, 0x23, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11,
+		0x34, 0x36, 0x33, 0x33, 0x07, 0x15, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x03, 0x0d, 0x01,
+		0x07, 0x94, 0x94, 0xfe, 0xf8, 0xa6, 0xa6, 0xfe, 0xf8, 0x94, 0x94, 0x01, 0x07, 0xa7, 0x85, 0xd0,
+		0x73, 0x73, 0xd0, 0x85, 0x85, 0xd0, 0x73, 0x73, 0xd0, 0x85, 0x60, 0x6e, 0x3b, 0x4c, 0x45, 0x6b,
+		0x1a, 0x16, 0x16, 0x16, 0x19, 0x14, 0x9e, 0x59, 0x1d, 0x22, 0x22, 0x1b, 0x1f, 0x22, 0xbb, 0x80,
+		0x6a, 0x42, 0x44, 0x40, 0x3d, 0x04, 0xb9, 0xa3, 0xfe, 0xe6, 0xaa, 0xaa, 0xfe, 0xe6, 0xa4, 0xa4,
+		0x01, 0x1a, 0xaa, 0xaa, 0x01, 0x1a, 0xa3, 0x78, 0x80, 0xe1, 0x8e, 0x8e, 0xe2, 0x80, 0x80, 0xe2,
+		0x8e, 0x8e, 0xe1, 0x80, 0xac, 0x38, 0x65, 0x41, 0x4a, 0x68, 0x17, 0x74, 0x1d, 0x17, 0x15, 0x15,
+		0x13, 0x17, 0xb6, 0x87, 0x23, 0x1e, 0x1e, 0x23, 0x02, 0x07, 0x21, 0x1e, 0x75, 0xd5, 0x38, 0x34,
+		0x32, 0x37, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc1, 0xff, 0x1a, 0x04, 0x0b, 0x04, 0xa3, 0x00, 0x35,
+		0x00, 0x47, 0x00, 0x27, 0x40, 0x24, 0x41, 0x38, 0x1d, 0x02, 0x04, 0x01, 0x03, 0x01, 0x4a, 0x00,
+		0x01, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x03, 0x03, 0x02, 0x59, 0x00, 0x02, 0x02, 0x0e, 0x03,
+		0x4c, 0x2c, 0x29, 0x25, 0x22, 0x34, 0x37, 0x04, 0x07, 0x16, 0x2b, 0x00, 0x06, 0x07, 0x16, 0x15,
+		0x14, 0x06, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x32, 0x36, 0x35, 0x34,
+		0x26, 0x27, 0x25, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21,
+		0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x05, 0x16, 0x16,
+		0x15, 0x05, 0x16, 0x17, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x25, 0x26, 0x27, 0x06, 0x06, 0x15,
+		0x14, 0x16, 0x17, 0x04, 0x0b, 0x3d, 0x3c, 0x14, 0x3f, 0x7c, 0x58, 0xfe, 0xba, 0x22, 0x1d, 0x1d,
+		0x22, 0x01, 0x32, 0x46, 0x47, 0x2b, 0x30, 0xfe, 0xb3, 0x54, 0x4f, 0x3d, 0x3c, 0x14, 0x3f, 0x7c,
+		0x58, 0x01, 0x46, 0x22, 0x1d, 0x1d, 0x22, 0xfe, 0xce, 0x46, 0x47, 0x2b, 0x30, 0x01, 0x4d, 0x54,
+		0x4f, 0xff, 0x01, 0x12, 0x20, 0x19, 0x1a, 0x31, 0x33, 0xfe, 0xb3, 0x12, 0x20, 0x19, 0x1a, 0x31,
+		0x33, 0x01, 0x0b, 0x64, 0x2d, 0x31, 0x3f, 0x47, 0x6c, 0x3d, 0x21, 0x27, 0x27, 0x21, 0x33, 0x31,
+		0x2b, 0x3c, 0x1e, 0xce, 0x34, 0x82, 0x59, 0x42, 0x64, 0x2d, 0x31, 0x3f, 0x47, 0x6c, 0x3d, 0x21,
+		0x27, 0x27, 0x21, 0x33, 0x31, 0x2b, 0x3c, 0x1e, 0xce, 0x34, 0x82, 0x59, 0x40, 0x0b, 0x18, 0x13,
+		0x30, 0x20, 0x2d, 0x48, 0x20, 0xce, 0x0b, 0x18, 0x13, 0x30, 0x20, 0x2d, 0x48, 0x20, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0x3c, 0x02, 0xec, 0x04, 0xf9, 0x05, 0x2a, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x08,
+		0xb5, 0x2d, 0x24, 0x05, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x17, 0x13, 0x16, 0x06, 0x23, 0x22,
+		0x26, 0x27, 0x03, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x27, 0x03, 0x06, 0x06, 0x23, 0x22,
+		0x26, 0x37, 0x13, 0x36, 0x36, 0x33, 0x32, 0x17, 0x13, 0x13, 0x36, 0x33, 0x04, 0x16, 0x15, 0x14,
+		0x06, 0x23, 0x23, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x33, 0x21, 0x04, 0xb6, 0x21, 0x02, 0x1e, 0x02, 0x19, 0x22, 0x22, 0x1b, 0x02, 0x12, 0x5d,
+		0x0c, 0x26, 0x16, 0x16, 0x27, 0x0b, 0x5e, 0x11, 0x02, 0x1b, 0x22, 0x22, 0x19, 0x02, 0x1e, 0x02,
+		0x21, 0x22, 0x32, 0x0c, 0x8e, 0x8e, 0x0c, 0x32, 0xfd, 0x87, 0x1d, 0x1d, 0x22, 0x81, 0x1c, 0x22,
+		0x22, 0x1c, 0x81, 0x22, 0x1d, 0x1d, 0x22, 0x01, 0x7e, 0x05, 0x2a, 0x1e, 0x23, 0xfe, 0x44, 0x23,
+		0x1e, 0x1d, 0x24, 0x01, 0x03, 0xc0, 0x17, 0x19, 0x19, 0x17, 0xc0, 0xfe, 0xfd, 0x24, 0x1d, 0x1e,
+		0x23, 0x01, 0xbc, 0x23, 0x1e, 0x1a, 0xfe, 0xd5, 0x01, 0x2b, 0x1a, 0x0a, 0x1b, 0x21, 0x21, 0x1a,
+		0xfe, 0x84, 0x23, 0x1e, 0x1e, 0x23, 0x01, 0x7c, 0x1a, 0x21, 0x21, 0x1b, 0x00, 0x02, 0x00, 0xf6,
+		0x02, 0x89, 0x03, 0x26, 0x04, 0xb9, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2a, 0xb1, 0x06, 0x64, 0x44,
+		0x40, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x63, 0x00, 0x02, 0x01, 0x01, 0x02, 0x57,
+		0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x26, 0x26, 0x26, 0x22, 0x04, 0x07,
+		0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x12, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
+		0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+		0x23, 0x22, 0x06, 0x06, 0x15, 0xf6, 0x4b, 0x81, 0x4c, 0x4c, 0x81, 0x4b, 0x4b, 0x81, 0x4c, 0x4c,
+		0x81, 0x4b, 0x87, 0x27, 0x43, 0x27, 0x27, 0x43, 0x27, 0x27, 0x43, 0x27, 0x27, 0x43, 0x27, 0x03,
+		0xed, 0x81, 0x4b, 0x4b, 0x81, 0x4c, 0x4c, 0x81, 0x4b, 0x4b, 0x81, 0x4c, 0x27, 0x43, 0x27, 0x27,
+		0x43, 0x27, 0x27, 0x43, 0x27, 0x27, 0x43, 0x27, 0x00, 0x01, 0x00, 0xe8, 0x01, 0xf6, 0x03, 0xe3,
+		0x04, 0xb9, 0x00, 0x1d, 0x00, 0x28, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1d, 0x0e, 0x05, 0x02, 0x00,
+		0x02, 0x01, 0x4a, 0x03, 0x01, 0x02, 0x00, 0x02, 0x72, 0x01, 0x01, 0x00, 0x00, 0x69, 0x00, 0x00,
+		0x00, 0x1d, 0x00, 0x1c, 0x27, 0x19, 0x04, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x16,
+		0x17, 0x01, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x27, 0x03, 0x03, 0x06, 0x06,
+		0x23, 0x22, 0x27, 0x26, 0x26, 0x35, 0x34, 0x37, 0x01, 0x36, 0x36, 0x33, 0x02, 0x82, 0x1e, 0x0a,
+		0x01, 0x34, 0x05, 0x1a, 0x14, 0x16, 0x16, 0x13, 0x1c, 0x07, 0xed, 0xed, 0x07, 0x1c, 0x13, 0x11,
+		0x17, 0x16, 0x1d, 0x06, 0x01, 0x34, 0x0a, 0x1e, 0x1c, 0x04, 0xb9, 0x12, 0x13, 0xfd, 0xb1, 0x09,
+		0x0c, 0x11, 0x1a, 0x07, 0x08, 0x0d, 0x0c, 0x01, 0xe0, 0xfe, 0x20, 0x0c, 0x0d, 0x07, 0x07, 0x1b,
+		0x11, 0x0b, 0x0a, 0x02, 0x4f, 0x13, 0x12, 0x00, 0x00, 0x01, 0x01, 0x22, 0x01, 0x19, 0x03, 0xaa,
+		0x04, 0xb9, 0x00, 0x1f, 0x00, 0x29, 0x40, 0x26, 0x02, 0x01, 0x00, 0x00, 0x03, 0x59, 0x06, 0x05,
+		0x02, 0x03, 0x03, 0x11, 0x4b, 0x00, 0x01, 0x01, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x16, 0x01, 0x4c,
+		0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x23, 0x24, 0x23, 0x23, 0x24, 0x07, 0x07, 0x19, 0x2b, 0x00,
+		0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22,
+		0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x33, 0x03,
+		0x8d, 0x1d, 0x1d, 0x22, 0xbd, 0x21, 0x27, 0x27, 0x21, 0xbd, 0x22, 0x1d, 0x1d, 0x22, 0xbd, 0x21,
+		0x27, 0x27, 0x21, 0xbd, 0x03, 0x9c, 0x21, 0x27, 0x27, 0x21, 0xfe, 0x4c, 0x22, 0x1d, 0x1d, 0x22,
+		0x01, 0xb4, 0x21, 0x27, 0x27, 0x21, 0xde, 0x22, 0x1d, 0x1d, 0x22, 0xde, 0x00, 0x01, 0x01, 0x22,
+		0x00, 0xdd, 0x03, 0xaa, 0x04, 0xb9, 0x00, 0x31, 0x00, 0xdf, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40,
+		0x20, 0x07, 0x01, 0x05, 0x08, 0x01, 0x04, 0x03, 0x05, 0x04, 0x61, 0x0a, 0x09, 0x02, 0x03, 0x02,
+		0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x01, 0x01, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x16, 0x01,
+		0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x22, 0x0a, 0x09, 0x02, 0x03, 0x02, 0x01, 0x00,
+		0x01, 0x03, 0x00, 0x61, 0x08, 0x01, 0x04, 0x04, 0x05, 0x59, 0x07, 0x01, 0x05, 0x05, 0x11, 0x4b,
+		0x00, 0x01, 0x01, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x16, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50,
+		0x58, 0x40, 0x20, 0x07, 0x01, 0x05, 0x08, 0x01, 0x04, 0x03, 0x05, 0x04, 0x61, 0x0a, 0x09, 0x02,
+		0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x01, 0x01, 0x06, 0x5b, 0x00, 0x06, 0x06,
+		0x16, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x22, 0x0a, 0x09, 0x02, 0x03, 0x02,
+		0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x08, 0x01, 0x04, 0x04, 0x05, 0x59, 0x07, 0x01, 0x05, 0x05,
+		0x11, 0x4b, 0x00, 0x01, 0x01, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x16, 0x01, 0x4c, 0x1b, 0x40, 0x20,
+		0x07, 0x01, 0x05, 0x08, 0x01, 0x04, 0x03, 0x05, 0x04, 0x61, 0x0a, 0x09, 0x02, 0x03, 0x02, 0x01,
+		0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x01, 0x01, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x16, 0x01, 0x4c,
+		0x59, 0x59, 0x59, 0x59, 0x40, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x30, 0x24, 0x23, 0x23, 0x24,
+		0x21, 0x24, 0x23, 0x23, 0x24, 0x0b, 0x07, 0x1d, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23,
+		0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33,
+		0x35, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+		0x15, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x15, 0x33, 0x03, 0x8d, 0x1d, 0x1d, 0x22,
+		0xbd, 0x21, 0x27, 0x27, 0x21, 0xbd, 0x22, 0x1d, 0x1d, 0x22, 0xbd, 0xbd, 0x22, 0x1d, 0x1d, 0x22,
+		0xbd, 0x21, 0x27, 0x27, 0x21, 0xbd, 0x22, 0x1d, 0x1d, 0x22, 0xbd, 0xbd, 0x02, 0x58, 0x21, 0x27,
+		0x27, 0x21, 0xac, 0x22, 0x1d, 0x1d, 0x22, 0xac, 0x21, 0x27, 0x27, 0x21, 0xe6, 0x21, 0x27, 0x27,
+		0x21, 0xac, 0x22, 0x1d, 0x1d, 0x22, 0xac, 0x21, 0x27, 0x27, 0x21, 0xe6, 0x00, 0x01, 0xfd, 0x09,
+		0xfd, 0xf2, 0xfe, 0x04, 0xff, 0x6e, 0x00, 0x10, 0x00, 0x2e, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x23,
+		0x0a, 0x01, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01,
+		0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0e, 0x15,
+		0x03, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x04, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22,
+		0x27, 0x26, 0x35, 0x34, 0x37, 0x13, 0x36, 0x33, 0x33, 0xfe, 0x04, 0x06, 0x75, 0x0f, 0x2c, 0x0b,
+		0x06, 0x34, 0x02, 0x3f, 0x08, 0x22, 0x74, 0x92, 0x1a, 0x0c, 0x0d, 0xfe, 0xdd, 0x26, 0x01, 0x07,
+		0x25, 0x04, 0x0c, 0x01, 0x1f, 0x20, 0x00, 0x00, 0xff, 0xff, 0xfd, 0x09, 0xfd, 0xf2, 0xfe, 0x04,
+		0xff, 0x6e, 0x00, 0x02, 0x01, 0x7e, 0x00, 0x00, 0x00, 0x01, 0x01, 0xa1, 0x04, 0x0e, 0x03, 0x93,
+		0x05, 0x87, 0x00, 0x11, 0x00, 0x1f, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x14, 0x0e, 0x01, 0x01, 0x00,
+		0x01, 0x4a, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00, 0x01, 0x01, 0x69, 0x27, 0x20, 0x02, 0x07, 0x16,
+		0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x05, 0x06, 0x23,
+		0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x03, 0x1f, 0x13, 0x22, 0x21, 0x1e, 0x16, 0xfe, 0x8a,
+		0x12, 0x0e, 0x18, 0x16, 0x18, 0x10, 0x01, 0x5c, 0x05, 0x87, 0x29, 0x27, 0x1d, 0x1a, 0x0d, 0xdb,
+		0x0a, 0x19, 0x1b, 0x19, 0x13, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x5e, 0x02, 0x09,
+		0x05, 0x20, 0x00, 0x10, 0x00, 0x19, 0x40, 0x16, 0x0a, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x00,
+		0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x10, 0x00, 0x4c, 0x26, 0x26, 0x02, 0x07, 0x16, 0x2b, 0x00,
+		0x16, 0x15, 0x14, 0x07, 0x03, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x13, 0x36, 0x33, 0x33,
+		0x01, 0xfb, 0x0e, 0x05, 0x86, 0x0d, 0x3d, 0x1c, 0x1e, 0x02, 0x52, 0x08, 0x22, 0x76, 0x05, 0x20,
+		0x0f, 0x0c, 0x09, 0x0f, 0xfe, 0x95, 0x24, 0x16, 0x14, 0x04, 0x0a, 0x01, 0x6a, 0x20, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x1e, 0x04, 0x2f, 0x03, 0xae, 0x05, 0x5c, 0x00, 0x1d, 0x00, 0x2e, 0xb1, 0x06,
+		0x64, 0x44, 0x40, 0x23, 0x0a, 0x01, 0x02, 0x01, 0x01, 0x4a, 0x03, 0x01, 0x01, 0x02, 0x01, 0x72,
+		0x00, 0x02, 0x00, 0x00, 0x02, 0x57, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x02, 0x00, 0x4f,
+		0x13, 0x23, 0x19, 0x26, 0x04, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x16, 0x15, 0x14,
+		0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
+		0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x03, 0x94, 0x1a, 0x01, 0x17, 0xa7,
+		0x89, 0x89, 0xa7, 0x17, 0x01, 0x1a, 0x1c, 0x0f, 0x0d, 0x22, 0x09, 0x17, 0x64, 0x50, 0x51, 0x64,
+		0x16, 0x09, 0x22, 0x0d, 0x0f, 0x05, 0x53, 0x17, 0x13, 0x08, 0x05, 0x71, 0x7c, 0x7c, 0x71, 0x05,
+		0x08, 0x13, 0x17, 0x06, 0x03, 0x18, 0x47, 0x44, 0x44, 0x47, 0x18, 0x03, 0x00, 0x01, 0x01, 0x27,
+		0x04, 0x11, 0x03, 0xa5, 0x05, 0x76, 0x00, 0x17, 0x00, 0x28, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1d,
+		0x12, 0x0b, 0x02, 0x02, 0x00, 0x01, 0x4a, 0x01, 0x01, 0x00, 0x02, 0x00, 0x72, 0x03, 0x01, 0x02,
+		0x02, 0x69, 0x00, 0x00, 0x00, 0x17, 0x00, 0x16, 0x25, 0x17, 0x04, 0x07, 0x16, 0x2b, 0xb1, 0x06,
+		0x00, 0x44, 0x00, 0x27, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32, 0x17, 0x17, 0x37, 0x36,
+		0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x07, 0x06, 0x23, 0x02, 0x42, 0x16, 0xf5, 0x10, 0x17,
+		0x15, 0x17, 0x10, 0x0f, 0xdd, 0xdd, 0x0f, 0x10, 0x17, 0x15, 0x17, 0x10, 0xf5, 0x16, 0x24, 0x04,
+		0x11, 0x14, 0xe9, 0x0f, 0x12, 0x15, 0x1a, 0x18, 0x0c, 0xad, 0xad, 0x0c, 0x18, 0x1a, 0x15, 0x12,
+		0x0f, 0xe9, 0x14, 0x00, 0x00, 0x01, 0x01, 0x8e, 0x05, 0x1b, 0x03, 0xc3, 0x06, 0x6c, 0x00, 0x13,
+		0x00, 0x0f, 0x40, 0x0c, 0x10, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x20, 0x01, 0x07, 0x15,
+		0x2b, 0x00, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x05, 0x06, 0x23, 0x22, 0x26, 0x27,
+		0x26, 0x35, 0x34, 0x37, 0x25, 0x03, 0x58, 0x0e, 0x10, 0x21, 0x13, 0x19, 0x19, 0xfe, 0x1f, 0x08,
+		0x04, 0x0e, 0x18, 0x05, 0x04, 0x17, 0x01, 0xa0, 0x06, 0x6c, 0x1e, 0x23, 0x2c, 0x1c, 0x1b, 0x08,
+		0xa3, 0x02, 0x13, 0x0f, 0x09, 0x0d, 0x1b, 0x0d, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xec,
+		0x05, 0x3d, 0x03, 0xe0, 0x06, 0x5c, 0x00, 0x19, 0x00, 0x2d, 0x40, 0x2a, 0x0a, 0x02, 0x02, 0x02,
+		0x01, 0x01, 0x4a, 0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x72, 0x00, 0x02, 0x00, 0x00, 0x02, 0x57,
+		0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x18,
+		0x23, 0x26, 0x26, 0x05, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22,
+		0x26, 0x27, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36,
+		0x33, 0x03, 0xb3, 0x2d, 0x01, 0x19, 0xc7, 0x99, 0x99, 0xc7, 0x19, 0x01, 0x2d, 0x19, 0x1d, 0x0a,
+		0x22, 0x82, 0x69, 0x69, 0x82, 0x22, 0x0a, 0x1d, 0x06, 0x5c, 0x1f, 0x15, 0x05, 0x03, 0x69, 0x7a,
+		0x7a, 0x69, 0x03, 0x05, 0x15, 0x1f, 0x14, 0x42, 0x39, 0x39, 0x42, 0x14, 0x00, 0x01, 0x01, 0x0a,
+		0x05, 0x1b, 0x03, 0xc2, 0x06, 0x71, 0x00, 0x19, 0x00, 0x1b, 0x40, 0x18, 0x18, 0x01, 0x00, 0x01,
+		0x01, 0x4a, 0x01, 0x01, 0x01, 0x48, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x28,
+		0x2a, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x05, 0x06,
+		0x23, 0x22, 0x27, 0x25, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x32, 0x17, 0x05, 0x25, 0x03,
+		0x84, 0x0c, 0x0c, 0x15, 0x07, 0x0a, 0x10, 0xfe, 0xeb, 0x16, 0x21, 0x20, 0x17, 0xfe, 0xeb, 0x10,
+		0x0a, 0x07, 0x15, 0x0c, 0x0b, 0x08, 0x01, 0x17, 0x01, 0x17, 0x06, 0x71, 0x0e, 0x0c, 0x11, 0x0f,
+		0x13, 0x0f, 0xe8, 0x12, 0x12, 0xe8, 0x0f, 0x13, 0x0f, 0x11, 0x0c, 0x0e, 0x05, 0x9f, 0x9f, 0x00,
+		0xff, 0xff, 0x01, 0x5f, 0xfe, 0x28, 0x03, 0x62, 0x00, 0x1c, 0x00, 0x02, 0x01, 0x91, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x0a, 0x05, 0x18, 0x03, 0xc2, 0x06, 0x6e, 0x00, 0x19, 0x00, 0x1b, 0x40, 0x18,
+		0x18, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x01, 0x01, 0x01, 0x47, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00,
+		0x01, 0x01, 0x69, 0x28, 0x2a, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35,
+		0x34, 0x37, 0x25, 0x36, 0x33, 0x32, 0x17, 0x05, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22,
+		0x27, 0x25, 0x05, 0x01, 0x47, 0x0b, 0x0c, 0x15, 0x07, 0x0a, 0x10, 0x01, 0x15, 0x17, 0x20, 0x20,
+		0x17, 0x01, 0x15, 0x10, 0x0a, 0x07, 0x15, 0x0c, 0x0c, 0x07, 0xfe, 0xe9, 0xfe, 0xe9, 0x05, 0x18,
+		0x0e, 0x0c, 0x11, 0x0f, 0x13, 0x0f, 0xe8, 0x12, 0x12, 0xe8, 0x0f, 0x13, 0x0f, 0x11, 0x0c, 0x0e,
+		0x05, 0x9f, 0x9f, 0x00, 0x00, 0x02, 0x01, 0x35, 0x05, 0x53, 0x03, 0x97, 0x06, 0x57, 0x00, 0x0d,
+		0x00, 0x1b, 0x00, 0x1d, 0x40, 0x1a, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x03, 0x01, 0x01,
+		0x01, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x01, 0x00, 0x4f, 0x25, 0x25, 0x25, 0x21, 0x04, 0x07, 0x18,
+		0x2b, 0x00, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x04,
+		0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x01, 0xf3, 0x28,
+		0x37, 0x37, 0x28, 0x28, 0x37, 0x37, 0x28, 0x01, 0xa4, 0x28, 0x37, 0x37, 0x28, 0x28, 0x37, 0x37,
+		0x28, 0x05, 0x70, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24,
+		0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x05, 0x53, 0x02, 0xc5,
+		0x06, 0x57, 0x00, 0x0d, 0x00, 0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01,
+		0x01, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x25, 0x21, 0x02, 0x07, 0x16, 0x2b, 0x00, 0x06,
+		0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x02, 0xc5, 0x28, 0x37,
+		0x37, 0x28, 0x28, 0x37, 0x37, 0x28, 0x05, 0x70, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24,
+		0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x09, 0x05, 0x1b, 0x03, 0x3e, 0x06, 0x6c, 0x00, 0x11,
+		0x00, 0x11, 0x40, 0x0e, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x29, 0x13, 0x02,
+		0x07, 0x16, 0x2b, 0x00, 0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x25, 0x26, 0x35, 0x34, 0x37, 0x36,
+		0x36, 0x33, 0x32, 0x17, 0x05, 0x03, 0x3e, 0x1b, 0x14, 0x04, 0x08, 0xfe, 0x1f, 0x19, 0x19, 0x13,
+		0x21, 0x10, 0x0e, 0x13, 0x01, 0xa0, 0x05, 0x6e, 0x1b, 0x16, 0x22, 0x02, 0xa3, 0x08, 0x1b, 0x1c,
+		0x2c, 0x23, 0x1e, 0x0b, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2d, 0x05, 0x2b, 0x04, 0x50,
+		0x06, 0x77, 0x00, 0x11, 0x00, 0x23, 0x00, 0x1e, 0x40, 0x1b, 0x1c, 0x13, 0x0a, 0x01, 0x04, 0x00,
+		0x01, 0x01, 0x4a, 0x03, 0x01, 0x01, 0x00, 0x01, 0x72, 0x02, 0x01, 0x00, 0x00, 0x69, 0x27, 0x27,
+		0x27, 0x25, 0x04, 0x07, 0x18, 0x2b, 0x00, 0x15, 0x14, 0x07, 0x05, 0x06, 0x23, 0x22, 0x27, 0x26,
+		0x35, 0x34, 0x37, 0x37, 0x36, 0x33, 0x32, 0x17, 0x04, 0x15, 0x14, 0x07, 0x05, 0x06, 0x23, 0x22,
+		0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x36, 0x33, 0x32, 0x17, 0x02, 0xd4, 0x12, 0xfe, 0xd3, 0x13,
+		0x15, 0x16, 0x14, 0x16, 0x0e, 0xf1, 0x18, 0x1e, 0x1d, 0x22, 0x01, 0xaf, 0x12, 0xfe, 0xd3, 0x14,
+		0x14, 0x16, 0x14, 0x16, 0x0e, 0xf1, 0x18, 0x1e, 0x1d, 0x22, 0x06, 0x40, 0x1a, 0x10, 0x0c, 0xd2,
+		0x0d, 0x0d, 0x0d, 0x16, 0x0f, 0x0e, 0xe9, 0x16, 0x16, 0x21, 0x1a, 0x10, 0x0c, 0xd2, 0x0d, 0x0d,
+		0x0d, 0x16, 0x0f, 0x0e, 0xe9, 0x16, 0x16, 0x00, 0x00, 0x01, 0x01, 0x0e, 0x05, 0x60, 0x03, 0xbe,
+		0x05, 0xf0, 0x00, 0x0d, 0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02,
+		0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0b,
+		0x34, 0x03, 0x07, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34,
+		0x36, 0x33, 0x21, 0x03, 0xa1, 0x1d, 0x1d, 0x22, 0xfd, 0xce, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0x32,
+		0x05, 0xf0, 0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0xff, 0xff, 0x01, 0x9b,
+		0xfe, 0x28, 0x03, 0x29, 0x00, 0x1c, 0x00, 0x02, 0x01, 0x98, 0x00, 0x00, 0xff, 0xff, 0x01, 0x70,
+		0x05, 0x37, 0x03, 0x5c, 0x07, 0x23, 0x01, 0x07, 0x01, 0x99, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x09,
+		0xb1, 0x00, 0x02, 0xb8, 0x01, 0x0e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0b,
+		0x05, 0x4c, 0x03, 0xc1, 0x06, 0x1f, 0x00, 0x23, 0x00, 0x60, 0x4b, 0xb0, 0x22, 0x50, 0x58, 0x40,
+		0x1b, 0x00, 0x00, 0x03, 0x02, 0x00, 0x57, 0x06, 0x05, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03,
+		0x63, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x00, 0x02, 0x4f, 0x1b, 0x40, 0x29, 0x00,
+		0x01, 0x05, 0x00, 0x05, 0x01, 0x00, 0x70, 0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x70, 0x00,
+		0x00, 0x03, 0x02, 0x00, 0x57, 0x06, 0x01, 0x05, 0x00, 0x03, 0x04, 0x05, 0x03, 0x63, 0x00, 0x00,
+		0x00, 0x02, 0x5b, 0x00, 0x02, 0x00, 0x02, 0x4f, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x23, 0x00,
+		0x22, 0x13, 0x24, 0x26, 0x13, 0x24, 0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x17, 0x16, 0x16, 0x33,
+		0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26,
+		0x26, 0x23, 0x22, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x02, 0x06,
+		0x3b, 0x30, 0x2d, 0x36, 0x1d, 0x41, 0x46, 0x0a, 0x0a, 0x17, 0x13, 0x0b, 0x11, 0x6d, 0x5b, 0x22,
+		0x3b, 0x30, 0x2d, 0x36, 0x1d, 0x40, 0x47, 0x0b, 0x09, 0x17, 0x13, 0x0b, 0x11, 0x6d, 0x5b, 0x06,
+		0x1f, 0x10, 0x11, 0x10, 0x0e, 0x2a, 0x06, 0x1f, 0x12, 0x13, 0x18, 0x0d, 0x5b, 0x10, 0x11, 0x10,
+		0x0e, 0x2a, 0x06, 0x1f, 0x12, 0x13, 0x18, 0x0d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5f,
+		0xfe, 0x28, 0x03, 0x62, 0x00, 0x1c, 0x00, 0x20, 0x00, 0x75, 0xb1, 0x06, 0x64, 0x44, 0xb5, 0x0b,
+		0x01, 0x01, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x27, 0x00, 0x00, 0x05, 0x04,
+		0x03, 0x00, 0x68, 0x00, 0x02, 0x04, 0x03, 0x04, 0x02, 0x03, 0x70, 0x00, 0x05, 0x00, 0x04, 0x02,
+		0x05, 0x04, 0x63, 0x00, 0x03, 0x01, 0x01, 0x03, 0x57, 0x00, 0x03, 0x03, 0x01, 0x5c, 0x00, 0x01,
+		0x03, 0x01, 0x50, 0x1b, 0x40, 0x28, 0x00, 0x00, 0x05, 0x04, 0x05, 0x00, 0x04, 0x70, 0x00, 0x02,
+		0x04, 0x03, 0x04, 0x02, 0x03, 0x70, 0x00, 0x05, 0x00, 0x04, 0x02, 0x05, 0x04, 0x63, 0x00, 0x03,
+		0x01, 0x01, 0x03, 0x57, 0x00, 0x03, 0x03, 0x01, 0x5c, 0x00, 0x01, 0x03, 0x01, 0x50, 0x59, 0x40,
+		0x09, 0x14, 0x24, 0x24, 0x17, 0x24, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x05,
+		0x36, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33, 0x32,
+		0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x07, 0x22, 0x26, 0x35, 0x35, 0x33,
+		0x02, 0x97, 0x65, 0x66, 0x7c, 0x79, 0x44, 0x80, 0x33, 0x17, 0x08, 0x11, 0x1d, 0x08, 0x05, 0x2b,
+		0x67, 0x2f, 0x33, 0x3a, 0x36, 0x3e, 0x27, 0x0f, 0x13, 0x84, 0x71, 0x01, 0x5e, 0x4b, 0x57, 0x68,
+		0x18, 0x18, 0x0a, 0x19, 0x0e, 0x15, 0x2d, 0x02, 0x10, 0x16, 0x21, 0x1f, 0x21, 0x20, 0x01, 0x15,
+		0x17, 0xcd, 0x00, 0x00, 0x00, 0x01, 0x01, 0x27, 0x04, 0x0f, 0x03, 0xa5, 0x05, 0x74, 0x00, 0x17,
+		0x00, 0x28, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1d, 0x12, 0x0b, 0x02, 0x00, 0x02, 0x01, 0x4a, 0x03,
+		0x01, 0x02, 0x00, 0x02, 0x72, 0x01, 0x01, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x17, 0x00, 0x16,
+		0x25, 0x17, 0x04, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x17, 0x17, 0x16, 0x15, 0x14,
+		0x07, 0x06, 0x23, 0x22, 0x27, 0x27, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37,
+		0x36, 0x33, 0x02, 0x8a, 0x16, 0xf5, 0x10, 0x17, 0x15, 0x17, 0x10, 0x0f, 0xdd, 0xdd, 0x0f, 0x10,
+		0x17, 0x15, 0x17, 0x10, 0xf5, 0x16, 0x24, 0x05, 0x74, 0x14, 0xe9, 0x0f, 0x12, 0x15, 0x1a, 0x18,
+		0x0c, 0xad, 0xad, 0x0c, 0x18, 0x1a, 0x15, 0x12, 0x0f, 0xe9, 0x14, 0x00, 0x00, 0x02, 0x01, 0x35,
+		0x04, 0x4f, 0x03, 0x97, 0x05, 0x53, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x25, 0xb1, 0x06, 0x64, 0x44,
+		0x40, 0x1a, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x02,
+		0x01, 0x00, 0x01, 0x00, 0x4f, 0x25, 0x25, 0x25, 0x21, 0x04, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00,
+		0x44, 0x00, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x04,
+		0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x01, 0xf3, 0x28,
+		0x37, 0x37, 0x28, 0x28, 0x37, 0x37, 0x28, 0x01, 0xa4, 0x28, 0x37, 0x37, 0x28, 0x28, 0x37, 0x37,
+		0x28, 0x04, 0x6c, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24,
+		0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x04, 0x4f, 0x02, 0xc5,
+		0x05, 0x53, 0x00, 0x0d, 0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00,
+		0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x25, 0x21, 0x02, 0x07,
+		0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33,
+		0x32, 0x16, 0x15, 0x15, 0x02, 0xc5, 0x28, 0x37, 0x37, 0x28, 0x28, 0x37, 0x37, 0x28, 0x04, 0x6c,
+		0x1d, 0x1d, 0x24, 0x82, 0x24, 0x1d, 0x1d, 0x24, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x39,
+		0x04, 0x0e, 0x03, 0x2b, 0x05, 0x87, 0x00, 0x11, 0x00, 0x19, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0e,
+		0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x18, 0x15, 0x02, 0x07, 0x16, 0x2b, 0xb1,
+		0x06, 0x00, 0x44, 0x01, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x25, 0x26, 0x35, 0x34,
+		0x37, 0x36, 0x33, 0x32, 0x17, 0x03, 0x1b, 0x10, 0x18, 0x16, 0x18, 0x0e, 0x12, 0xfe, 0x8a, 0x16,
+		0x1e, 0x21, 0x22, 0x13, 0x12, 0x04, 0x7a, 0x0c, 0x13, 0x19, 0x1b, 0x19, 0x0a, 0xdb, 0x0d, 0x1a,
+		0x1d, 0x27, 0x29, 0x0d, 0x00, 0x02, 0x01, 0x3d, 0x04, 0x0f, 0x04, 0x4f, 0x05, 0x76, 0x00, 0x11,
+		0x00, 0x23, 0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b, 0x1c, 0x13, 0x0a, 0x01, 0x04, 0x00,
+		0x01, 0x01, 0x4a, 0x03, 0x01, 0x01, 0x00, 0x01, 0x72, 0x02, 0x01, 0x00, 0x00, 0x69, 0x27, 0x27,
+		0x27, 0x25, 0x04, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x15, 0x14, 0x07, 0x05, 0x06,
+		0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x36, 0x33, 0x32, 0x17, 0x04, 0x15, 0x14, 0x07,
+		0x05, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x36, 0x33, 0x32, 0x17, 0x02, 0xd3,
+		0x13, 0xfe, 0xf2, 0x11, 0x14, 0x16, 0x1c, 0x1e, 0x0a, 0xed, 0x17, 0x20, 0x1c, 0x1f, 0x01, 0xa9,
+		0x13, 0xfe, 0xf2, 0x11, 0x14, 0x16, 0x1c, 0x1e, 0x0a, 0xed, 0x17, 0x20, 0x1c, 0x1f, 0x05, 0x47,
+		0x1d, 0x13, 0x11, 0xe9, 0x0e, 0x11, 0x13, 0x16, 0x0d, 0x0a, 0xfd, 0x19, 0x13, 0x1c, 0x1d, 0x13,
+		0x11, 0xe9, 0x0e, 0x11, 0x13, 0x16, 0x0d, 0x0a, 0xfd, 0x19, 0x13, 0x00, 0x00, 0x01, 0x01, 0x22,
+		0x04, 0x52, 0x03, 0xaa, 0x04, 0xe2, 0x00, 0x0d, 0x00, 0x27, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1c,
+		0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01,
+		0x00, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0b, 0x34, 0x03, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00,
+		0x44, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x21, 0x03,
+		0x8d, 0x1d, 0x1d, 0x22, 0xfd, 0xf6, 0x22, 0x1d, 0x1d, 0x22, 0x02, 0x0a, 0x04, 0xe2, 0x21, 0x27,
+		0x27, 0x21, 0x21, 0x27, 0x27, 0x21, 0x00, 0x00, 0x00, 0x01, 0x01, 0x9b, 0xfe, 0x28, 0x03, 0x29,
+		0x00, 0x1c, 0x00, 0x19, 0x00, 0x4d, 0xb1, 0x06, 0x64, 0x44, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40,
+		0x17, 0x00, 0x03, 0x00, 0x03, 0x72, 0x01, 0x01, 0x00, 0x02, 0x02, 0x00, 0x57, 0x01, 0x01, 0x00,
+		0x00, 0x02, 0x5c, 0x00, 0x02, 0x00, 0x02, 0x50, 0x1b, 0x40, 0x1a, 0x00, 0x03, 0x01, 0x03, 0x72,
+		0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x02, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00, 0x02, 0x5c,
+		0x00, 0x02, 0x00, 0x02, 0x50, 0x59, 0xb6, 0x15, 0x27, 0x31, 0x24, 0x04, 0x07, 0x18, 0x2b, 0xb1,
+		0x06, 0x00, 0x44, 0x04, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16,
+		0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x33, 0x02, 0x92, 0x5b,
+		0x2a, 0x23, 0x34, 0x3d, 0x08, 0x03, 0x1e, 0x09, 0x02, 0x11, 0x11, 0x4b, 0x59, 0x5d, 0x6b, 0x61,
+		0x5b, 0xa5, 0x42, 0x86, 0x3c, 0x23, 0x26, 0x11, 0x02, 0x36, 0x12, 0x07, 0x16, 0x19, 0x06, 0x1a,
+		0x68, 0x57, 0x51, 0x96, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x70, 0x04, 0x29, 0x03, 0x5c,
+		0x06, 0x15, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x37, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x2c, 0x04, 0x01,
+		0x01, 0x05, 0x01, 0x03, 0x02, 0x01, 0x03, 0x63, 0x00, 0x02, 0x00, 0x00, 0x02, 0x57, 0x00, 0x02,
+		0x02, 0x00, 0x5b, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x10, 0x10, 0x00, 0x00, 0x10, 0x1b, 0x10, 0x1a,
+		0x16, 0x14, 0x00, 0x0f, 0x00, 0x0e, 0x26, 0x06, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00,
+		0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x06,
+		0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x02, 0xab, 0x71, 0x40, 0x40,
+		0x71, 0x45, 0x45, 0x71, 0x40, 0x40, 0x71, 0x45, 0x34, 0x3e, 0x3e, 0x34, 0x34, 0x3e, 0x3e, 0x34,
+		0x06, 0x15, 0x40, 0x71, 0x45, 0x45, 0x71, 0x40, 0x40, 0x71, 0x45, 0x45, 0x71, 0x40, 0x84, 0x3e,
+		0x34, 0x34, 0x3e, 0x3e, 0x34, 0x34, 0x3e, 0x00, 0x00, 0x01, 0x01, 0x0e, 0x04, 0x3e, 0x03, 0xbe,
+		0x05, 0x2d, 0x00, 0x27, 0x00, 0x81, 0xb1, 0x06, 0x64, 0x44, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
+		0x0a, 0x0e, 0x01, 0x00, 0x01, 0x22, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x1b, 0x40, 0x0a, 0x0e, 0x01,
+		0x00, 0x05, 0x22, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x1b,
+		0x00, 0x00, 0x03, 0x02, 0x00, 0x57, 0x06, 0x05, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63,
+		0x00, 0x00, 0x00, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x00, 0x02, 0x4f, 0x1b, 0x40, 0x23, 0x00, 0x01,
+		0x05, 0x01, 0x72, 0x00, 0x04, 0x02, 0x04, 0x73, 0x00, 0x00, 0x03, 0x02, 0x00, 0x57, 0x06, 0x01,
+		0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0x63, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x00, 0x02,
+		0x4f, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x00, 0x26, 0x23, 0x24, 0x27, 0x23, 0x24, 0x07,
+		0x07, 0x19, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37,
+		0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26,
+		0x23, 0x22, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x36, 0x33, 0x02,
+		0x11, 0x39, 0x28, 0x23, 0x30, 0x1a, 0x20, 0x3d, 0x21, 0x0c, 0x11, 0x19, 0x16, 0x15, 0x0e, 0x30,
+		0x6d, 0x35, 0x23, 0x39, 0x28, 0x23, 0x30, 0x1a, 0x20, 0x3d, 0x21, 0x0c, 0x11, 0x19, 0x16, 0x15,
+		0x0e, 0x30, 0x6d, 0x35, 0x05, 0x23, 0x13, 0x12, 0x11, 0x10, 0x22, 0x22, 0x0c, 0x19, 0x16, 0x17,
+		0x13, 0x11, 0x3e, 0x3d, 0x13, 0x12, 0x11, 0x10, 0x22, 0x22, 0x0c, 0x19, 0x16, 0x17, 0x13, 0x11,
+		0x3e, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x9b, 0x81, 0xb5, 0x03, 0x2d,
+		0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x42, 0x4a, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0xd2, 0x42, 0x4a, 0x5a, 0xfd, 0x09, 0xfc, 0xba, 0x0c, 0x8b, 0x07, 0x23,
+		0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+		0x05, 0x8d, 0xfd, 0x7d, 0x00, 0x00, 0x0e, 0x64, 0xfd, 0x09, 0xfe, 0x39, 0x0c, 0x8b, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81,
+		0x04, 0x6c, 0x00, 0xd3, 0x04, 0xcc, 0x00, 0x00, 0x04, 0xcc, 0x00, 0x64, 0x04, 0xcc, 0x00, 0x64,
+		0x04, 0xcc, 0x00, 0x64, 0x04, 0xcc, 0x00, 0x64, 0x04, 0xcc, 0x00, 0x64, 0x04, 0xcc, 0x00, 0x64,
+		0x04, 0xcc, 0x00, 0x64, 0x04, 0xcc, 0x00, 0x64, 0x04, 0xcc, 0x00, 0x64, 0x04, 0xcc, 0x00, 0x64,
+		0x04, 0xcc, 0x00, 0x14, 0x04, 0xcc, 0x00, 0xcd, 0x04, 0xcc, 0x00, 0x96, 0x04, 0xcc, 0x00, 0x96,
+		0x04, 0xcc, 0x00, 0x96, 0x04, 0xcc, 0x00, 0x96, 0x04, 0xcc, 0x00, 0x96, 0x04, 0xcc, 0x00, 0x96,
+		0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0x32, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf,
+		0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xe1,
+		0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xe1,
+		0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xe1, 0x04, 0xcc, 0x00, 0xf5, 0x04, 0xcc, 0x00, 0x6e,
+		0x04, 0xcc, 0x00, 0x6e, 0x04, 0xcc, 0x00, 0x6e, 0x04, 0xcc, 0x00, 0x6e, 0x04, 0xcc, 0x00, 0x6e,
+		0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0x1e, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xc8,
+		0x04, 0xcc, 0x00, 0xb3, 0x04, 0xcc, 0x00, 0xc8, 0x04, 0xcc, 0x00, 0xc8, 0x04, 0xcc, 0x00, 0xc8,
+		0x04, 0xcc, 0x00, 0xc8, 0x04, 0xcc, 0x00, 0xc8, 0x04, 0xcc, 0x00, 0xc8, 0x04, 0xcc, 0x00, 0xc8,
+		0x04, 0xcc, 0x00, 0xc8, 0x04, 0xcc, 0x00, 0xc8, 0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8,
+		0x04, 0xcc, 0x00, 0xd7, 0x04, 0xcc, 0x00, 0xd7, 0x04, 0xcc, 0x00, 0xf5, 0x04, 0xcc, 0x00, 0xe1,
+		0x04, 0xcc, 0x00, 0xf5, 0x04, 0xcc, 0x00, 0xf5, 0x04, 0xcc, 0x00, 0xf5, 0x04, 0xcc, 0x00, 0x3c,
+		0x04, 0xcc, 0x00, 0x90, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf,
+		0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0x5a,
+		0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x5a,
+		0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x5a,
+		0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x54, 0x04, 0xcc, 0x00, 0xeb, 0x04, 0xcc, 0x00, 0xeb,
+		0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0xeb, 0x04, 0xcc, 0x00, 0xeb, 0x04, 0xcc, 0x00, 0xeb,
+		0x04, 0xcc, 0x00, 0xeb, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0xa7,
+		0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0x7a,
+		0x04, 0xcc, 0x00, 0x7a, 0x04, 0xcc, 0x00, 0x7a, 0x04, 0xcc, 0x00, 0x7a, 0x04, 0xcc, 0x00, 0x7a,
+		0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf,
+		0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf,
+		0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0x63,
+		0x04, 0xcc, 0x00, 0x43, 0x04, 0xcc, 0x00, 0x43, 0x04, 0xcc, 0x00, 0x43, 0x04, 0xcc, 0x00, 0x43,
+		0x04, 0xcc, 0x00, 0x43, 0x04, 0xcc, 0x00, 0x95, 0x04, 0xcc, 0x00, 0x7d, 0x04, 0xcc, 0x00, 0x7d,
+		0x04, 0xcc, 0x00, 0x7d, 0x04, 0xcc, 0x00, 0x7d, 0x04, 0xcc, 0x00, 0x7d, 0x04, 0xcc, 0x00, 0xa7,
+		0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0x9f,
+		0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x9f,
+		0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x9f,
+		0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x4b, 0x04, 0xcc, 0x00, 0xc0, 0x04, 0xcc, 0x00, 0x93,
+		0x04, 0xcc, 0x00, 0x93, 0x04, 0xcc, 0x00, 0x93, 0x04, 0xcc, 0x00, 0x93, 0x04, 0xcc, 0x00, 0x93,
+		0x04, 0xcc, 0x00, 0x93, 0x04, 0xcc, 0x00, 0x8b, 0x04, 0xcc, 0x00, 0x8c, 0x04, 0xcc, 0x00, 0x89,
+		0x04, 0xcc, 0x00, 0x9f, 0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0x94,
+		0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0x94,
+		0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0x94, 0x04, 0xcc, 0x00, 0xbb,
+		0x04, 0xcc, 0x00, 0x8b, 0x04, 0xcc, 0x00, 0x8b, 0x04, 0xcc, 0x00, 0x8b, 0x04, 0xcc, 0x00, 0x8b,
+		0x04, 0xcc, 0x00, 0x8b, 0x04, 0xcc, 0x00, 0xca, 0x04, 0xcc, 0x00, 0x14, 0x04, 0xcc, 0x00, 0xca,
+		0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb,
+		0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb,
+		0x04, 0xcc, 0x00, 0xde, 0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xbb,
+		0x04, 0xcc, 0x00, 0xbe, 0x04, 0xcc, 0x00, 0xbe, 0x04, 0xcc, 0x00, 0xbe, 0x04, 0xcc, 0x00, 0xe8,
+		0x04, 0xcc, 0x00, 0xe8, 0x04, 0xcc, 0x00, 0xb1, 0x04, 0xcc, 0x00, 0xb1, 0x04, 0xcc, 0x00, 0x93,
+		0x04, 0xcc, 0x00, 0xb1, 0x04, 0xcc, 0x00, 0x93, 0x04, 0xcc, 0x00, 0xb1, 0x04, 0xcc, 0x00, 0x79,
+		0x04, 0xcc, 0x00, 0xca, 0x04, 0xcc, 0x00, 0xca, 0x04, 0xcc, 0x00, 0xca, 0x04, 0xcc, 0x00, 0xca,
+		0x04, 0xcc, 0x00, 0xca, 0x04, 0xcc, 0x00, 0xca, 0x04, 0xcc, 0x00, 0x86, 0x04, 0xcc, 0x00, 0x86,
+		0x04, 0xcc, 0x00, 0x86, 0x04, 0xcc, 0x00, 0x86, 0x04, 0xcc, 0x00, 0x86, 0x04, 0xcc, 0x00, 0x86,
+		0x04, 0xcc, 0x00, 0x86, 0x04, 0xcc, 0x00, 0x86, 0x04, 0xcc, 0x00, 0x54, 0x04, 0xcc, 0x00, 0x86,
+		0x04, 0xcc, 0x00, 0x46, 0x04, 0xcc, 0x00, 0xc0, 0x04, 0xcc, 0x00, 0xc0, 0x04, 0xcc, 0x00, 0x8b,
+		0x04, 0xcc, 0x01, 0x33, 0x04, 0xcc, 0x01, 0x33, 0x04, 0xcc, 0x01, 0x33, 0x04, 0xcc, 0x01, 0x33,
+		0x04, 0xcc, 0x00, 0xb2, 0x04, 0xcc, 0x00, 0xb2, 0x04, 0xcc, 0x00, 0xb2, 0x04, 0xcc, 0x00, 0xb2,
+		0x04, 0xcc, 0x00, 0xb2, 0x04, 0xcc, 0x00, 0xb2, 0x04, 0xcc, 0x00, 0xeb, 0x04, 0xcc, 0x00, 0x75,
+		0x04, 0xcc, 0x00, 0x75, 0x04, 0xcc, 0x00, 0x75, 0x04, 0xcc, 0x00, 0x75, 0x04, 0xcc, 0x00, 0x75,
+		0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8,
+		0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xbb,
+		0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0xb8, 0x04, 0xcc, 0x00, 0x7c,
+		0x04, 0xcc, 0x00, 0x3a, 0x04, 0xcc, 0x00, 0x3a, 0x04, 0xcc, 0x00, 0x3a, 0x04, 0xcc, 0x00, 0x3a,
+		0x04, 0xcc, 0x00, 0x3a, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0x7b, 0x04, 0xcc, 0x00, 0x7b,
+		0x04, 0xcc, 0x00, 0x7b, 0x04, 0xcc, 0x00, 0x7b, 0x04, 0xcc, 0x00, 0x7b, 0x04, 0xcc, 0x00, 0xb2,
+		0x04, 0xcc, 0x00, 0xb2, 0x04, 0xcc, 0x00, 0xb2, 0x04, 0xcc, 0x00, 0xb2, 0x09, 0x98, 0x00, 0xbb,
+		0x09, 0x98, 0x00, 0xbb, 0x04, 0xcc, 0x00, 0xfc, 0x04, 0xcc, 0x00, 0xeb, 0x04, 0xcc, 0x00, 0x93,
+		0x04, 0xcc, 0x00, 0x51, 0x04, 0xcc, 0x00, 0xda, 0x04, 0xcc, 0x00, 0x62, 0x04, 0xcc, 0x00, 0xbe,
+		0x04, 0xcc, 0x00, 0xdc, 0x04, 0xcc, 0x00, 0xc5, 0x04, 0xcc, 0x00, 0xb5, 0x04, 0xcc, 0x00, 0x91,
+		0x04, 0xcc, 0x00, 0xbc, 0x04, 0xcc, 0x00, 0xcb, 0x04, 0xcc, 0x00, 0xc7, 0x04, 0xcc, 0x00, 0xd2,
+		0x04, 0xcc, 0x00, 0xc2, 0x04, 0xcc, 0x00, 0x6f, 0x04, 0xcc, 0x00, 0x01, 0x04, 0xcc, 0x00, 0x01,
+		0x04, 0xcc, 0x00, 0x15, 0x04, 0xcc, 0x01, 0x3b, 0x04, 0xcc, 0x01, 0x20, 0x04, 0xcc, 0x01, 0x2e,
+		0x04, 0xcc, 0x00, 0xf2, 0x04, 0xcc, 0x03, 0x0b, 0x04, 0xcc, 0x02, 0xa0, 0x04, 0xcc, 0x03, 0x0b,
+		0x04, 0xcc, 0x02, 0xb4, 0x04, 0xcc, 0xfe, 0x39, 0x0e, 0x64, 0x03, 0x05, 0x04, 0xcc, 0x01, 0x18,
+		0x04, 0xcc, 0xfe, 0x20, 0x0e, 0x64, 0x03, 0x05, 0x04, 0xcc, 0x00, 0x6a, 0x04, 0xcc, 0x00, 0xc6,
+		0x04, 0xcc, 0x01, 0xdf, 0x04, 0xcc, 0x01, 0x7e, 0x04, 0xcc, 0x01, 0xdf, 0x04, 0xcc, 0x01, 0x74,
+		0x04, 0xcc, 0x00, 0x6d, 0x04, 0xcc, 0x01, 0xe9, 0x04, 0xcc, 0x01, 0xe9, 0x04, 0xcc, 0x00, 0x3c,
+		0x04, 0xcc, 0x01, 0xdf, 0x04, 0xcc, 0x01, 0x06, 0x04, 0xcc, 0x01, 0x06, 0x04, 0xcc, 0x01, 0x04,
+		0x04, 0xcc, 0x01, 0xe5, 0x04, 0xcc, 0x01, 0x88, 0x04, 0xcc, 0x00, 0xc6, 0x04, 0xcc, 0x00, 0x46,
+		0x04, 0xcc, 0x00, 0xb1, 0x04, 0xcc, 0x00, 0xee, 0x04, 0xcc, 0x01, 0x4a, 0x04, 0xcc, 0x01, 0x66,
+		0x04, 0xcc, 0x01, 0x29, 0x04, 0xcc, 0x01, 0x6b, 0x04, 0xcc, 0x01, 0x0e, 0x04, 0xcc, 0xfe, 0x52,
+		0x09, 0x98, 0xff, 0xf0, 0x09, 0x98, 0x01, 0x1c, 0x04, 0xcc, 0xff, 0x1a, 0x04, 0xcc, 0xff, 0xe2,
+		0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0xcc, 0x00, 0x99, 0x04, 0xcc, 0x00, 0x9d, 0x04, 0xcc, 0x01, 0x89, 0x04, 0xcc, 0x01, 0x8d,
+		0x04, 0xcc, 0x00, 0xc0, 0x04, 0xcc, 0x00, 0xb1, 0x04, 0xcc, 0x00, 0xc0, 0x04, 0xcc, 0x01, 0xa6,
+		0x04, 0xcc, 0x01, 0xb5, 0x04, 0xcc, 0x01, 0xb5, 0x04, 0xcc, 0x00, 0x00, 0x04, 0xcc, 0x00, 0x93,
+		0x04, 0xcc, 0x00, 0x6f, 0x04, 0xcc, 0x00, 0xae, 0x04, 0xcc, 0x00, 0x5a, 0x04, 0xcc, 0x00, 0x21,
+		0x04, 0xcc, 0x00, 0x32, 0x04, 0xcc, 0x00, 0xdc, 0x04, 0xcc, 0xff, 0xe2, 0x04, 0xcc, 0x00, 0x7d,
+		0x04, 0xcc, 0x00, 0x96, 0x04, 0xcc, 0x00, 0x96, 0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0xaa,
+		0x04, 0xcc, 0x00, 0xaf, 0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0x1c, 0x04, 0xcc, 0x00, 0x05,
+		0x04, 0xcc, 0x00, 0x7d, 0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0x8c, 0x04, 0xcc, 0x00, 0xaa,
+		0x04, 0xcc, 0x00, 0xe7, 0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0xa7, 0x04, 0xcc, 0x00, 0x32,
+		0x04, 0xcc, 0x00, 0x32, 0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0xaa, 0x04, 0xcc, 0x00, 0xc3,
+		0x04, 0xcc, 0x00, 0x74, 0x04, 0xcc, 0x00, 0xa5, 0x04, 0xcc, 0x00, 0xcd, 0x04, 0xcc, 0x02, 0x1b,
+		0x04, 0xcc, 0x02, 0x1b, 0x04, 0xcc, 0x00, 0x32, 0x04, 0xcc, 0x00, 0x9d, 0x04, 0xcc, 0x00, 0x83,
+		0x04, 0xcc, 0x00, 0x24, 0x04, 0xcc, 0x00, 0x24, 0x04, 0xcc, 0x00, 0xc1, 0x04, 0xcc, 0x00, 0x3c,
+		0x04, 0xcc, 0x00, 0xf6, 0x04, 0xcc, 0x00, 0xe8, 0x04, 0xcc, 0x01, 0x22, 0x04, 0xcc, 0x01, 0x22,
+		0x02, 0x58, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x09, 0x00, 0x00, 0xfd, 0x09,
+		0x04, 0xcc, 0x01, 0xa1, 0x00, 0xfa, 0x01, 0x1e, 0x01, 0x27, 0x01, 0x8e, 0x00, 0xec, 0x01, 0x0a,
+		0x01, 0x5f, 0x01, 0x0a, 0x01, 0x35, 0x02, 0x07, 0x01, 0x09, 0x01, 0x2d, 0x01, 0x0e, 0x01, 0x9b,
+		0x01, 0x70, 0x01, 0x0b, 0x01, 0x5f, 0x01, 0x27, 0x01, 0x35, 0x02, 0x07, 0x01, 0x39, 0x01, 0x3d,
+		0x01, 0x22, 0x01, 0x9b, 0x01, 0x70, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xc8,
+		0x00, 0xda, 0x00, 0xec, 0x00, 0xfe, 0x01, 0x10, 0x01, 0x22, 0x01, 0x34, 0x01, 0xc2, 0x01, 0xd4,
+		0x01, 0xe6, 0x02, 0x74, 0x02, 0xd6, 0x03, 0x34, 0x03, 0x46, 0x03, 0x58, 0x04, 0x0c, 0x04, 0x1e,
+		0x04, 0x30, 0x04, 0x74, 0x04, 0xd6, 0x04, 0xe8, 0x04, 0xfa, 0x05, 0x46, 0x05, 0x58, 0x05, 0x6a,
+		0x05, 0x7c, 0x05, 0x8e, 0x05, 0xa0, 0x05, 0xb2, 0x05, 0xc4, 0x05, 0xd6, 0x06, 0x62, 0x06, 0xa4,
+		0x07, 0x0e, 0x07, 0x20, 0x07, 0x32, 0x07, 0x3e, 0x07, 0x50, 0x07, 0x98, 0x08, 0x1c, 0x08, 0x2e,
+		0x08, 0x74, 0x08, 0xea, 0x08, 0xfc, 0x09, 0x0e, 0x09, 0x20, 0x09, 0x32, 0x09, 0x44, 0x09, 0x56,
+		0x09, 0x68, 0x09, 0xee, 0x0a, 0x00, 0x0a, 0x4a, 0x0a, 0x5c, 0x0a, 0xb6, 0x0a, 0xc2, 0x0a, 0xf4,
+		0x0b, 0x06, 0x0b, 0x18, 0x0b, 0x24, 0x0b, 0x36, 0x0b, 0x92, 0x0b, 0xf0, 0x0c, 0x4e, 0x0c, 0x60,
+		0x0c, 0x72, 0x0c, 0x7e, 0x0c, 0xe2, 0x0c, 0xf4, 0x0d, 0x3e, 0x0d, 0x50, 0x0d, 0x62, 0x0d, 0x74,
+		0x0d, 0x86, 0x0d, 0x98, 0x0d, 0xaa, 0x0d, 0xbc, 0x0e, 0x38, 0x0e, 0x4a, 0x0e, 0xaa, 0x0e, 0xf4,
+		0x0f, 0x5a, 0x0f, 0xe0, 0x10, 0x34, 0x10, 0x46, 0x10, 0x58, 0x10, 0x64, 0x10, 0xde, 0x10, 0xf0,
+		0x11, 0x02, 0x12, 0x02, 0x12, 0x14, 0x12, 0x20, 0x12, 0x58, 0x12, 0xac, 0x12, 0xbe, 0x13, 0x48,
+		0x13, 0x54, 0x13, 0x94, 0x13, 0xa6, 0x13, 0xb8, 0x13, 0xca, 0x13, 0xdc, 0x13, 0xee, 0x14, 0x00,
+		0x14, 0x12, 0x14, 0x8e, 0x14, 0xa0, 0x14, 0xb2, 0x14, 0xf4, 0x15, 0x62, 0x15, 0x74, 0x15, 0x86,
+		0x15, 0x98, 0x15, 0xaa, 0x16, 0x00, 0x16, 0x44, 0x16, 0x56, 0x16, 0x68, 0x16, 0x7a, 0x16, 0x8c,
+		0x16, 0xce, 0x16, 0xe0, 0x16, 0xf2, 0x17, 0x04, 0x17, 0x94, 0x17, 0xa0, 0x17, 0xac, 0x17, 0xb8,
+		0x17, 0xc4, 0x17, 0xd0, 0x17, 0xdc, 0x18, 0x6e, 0x18, 0x7a, 0x18, 0x86, 0x19, 0x26, 0x19, 0x9e,
+		0x19, 0xf8, 0x1a, 0x04, 0x1a, 0x10, 0x1a, 0xc4, 0x1a, 0xd0, 0x1a, 0xdc, 0x1b, 0x54, 0x1c, 0x0e,
+		0x1c, 0xc2, 0x1d, 0x74, 0x1d, 0xd4, 0x1d, 0xe0, 0x1d, 0xec, 0x1d, 0xf8, 0x1e, 0x04, 0x1e, 0x10,
+		0x1e, 0x1c, 0x1e, 0x28, 0x1e, 0x34, 0x1e, 0xb8, 0x1f, 0x10, 0x1f, 0xc0, 0x1f, 0xcc, 0x1f, 0xd8,
+		0x20, 0xb6, 0x20, 0xc2, 0x21, 0x12, 0x21, 0x92, 0x21, 0xa4, 0x21, 0xb0, 0x21, 0xf0, 0x21, 0xfc,
+		0x22, 0x08, 0x22, 0x14, 0x22, 0x20, 0x22, 0x2c, 0x22, 0x38, 0x22, 0xe0, 0x22, 0xec, 0x23, 0xa8,
+		0x23, 0xb4, 0x23, 0xc0, 0x24, 0x0e, 0x24, 0x1a, 0x24, 0x68, 0x24, 0x74, 0x24, 0xb4, 0x24, 0xc6,
+		0x24, 0xd2, 0x24, 0xde, 0x24, 0xf0, 0x25, 0x5a, 0x25, 0xd8, 0x26, 0x36, 0x26, 0x42, 0x26, 0x4e,
+		0x26, 0x5a, 0x26, 0xdc, 0x26, 0xe8, 0x27, 0x30, 0x27, 0x3c, 0x27, 0x48, 0x27, 0x54, 0x27, 0x60,
+		0x27, 0x6c, 0x27, 0x78, 0x27, 0x84, 0x28, 0x14, 0x28, 0x20, 0x28, 0xa2, 0x29, 0x18, 0x29, 0x7c,
+		0x29, 0xf2, 0x2a, 0x70, 0x2a, 0x7c, 0x2a, 0x88, 0x2a, 0x94, 0x2b, 0x0e, 0x2b, 0x1a, 0x2b, 0x26,
+		0x2c, 0x26, 0x2c, 0x32, 0x2c, 0x3e, 0x2c, 0xbc, 0x2d, 0x16, 0x2d, 0x8a, 0x2d, 0x9c, 0x2e, 0x7e,
+		0x2e, 0x8a, 0x2e, 0xe8, 0x2e, 0xf4, 0x2f, 0x00, 0x2f, 0x0c, 0x2f, 0x18, 0x2f, 0x24, 0x2f, 0x30,
+		0x2f, 0x3c, 0x2f, 0xa6, 0x2f, 0xb2, 0x2f, 0xbe, 0x30, 0x0c, 0x30, 0x6a, 0x30, 0x76, 0x30, 0x82,
+		0x30, 0x8e, 0x30, 0x9a, 0x30, 0xf0, 0x31, 0x44, 0x31, 0x50, 0x31, 0x5c, 0x31, 0x68, 0x31, 0x74,
+		0x31, 0xb6, 0x31, 0xc2, 0x31, 0xce, 0x31, 0xda, 0x31, 0xea, 0x31, 0xf6, 0x32, 0x40, 0x32, 0x76,
+		0x32, 0xa6, 0x32, 0xf6, 0x33, 0x3a, 0x33, 0x70, 0x33, 0xcc, 0x34, 0x16, 0x34, 0x6e, 0x34, 0xe4,
+		0x35, 0x2e, 0x35, 0xa0, 0x36, 0x06, 0x36, 0x42, 0x36, 0xbc, 0x37, 0x20, 0x37, 0x4e, 0x37, 0xfa,
+		0x38, 0xaa, 0x39, 0xbc, 0x39, 0xf0, 0x3a, 0x32, 0x3a, 0x86, 0x3a, 0xc0, 0x3a, 0xf0, 0x3a, 0xfa,
+		0x3b, 0x04, 0x3b, 0x3a, 0x3b, 0x88, 0x3b, 0xd6, 0x3c, 0x22, 0x3c, 0x6e, 0x3c, 0xbc, 0x3d, 0x28,
+		0x3d, 0x66, 0x3d, 0x76, 0x3d, 0xa0, 0x3d, 0xe2, 0x3e, 0x10, 0x3e, 0x64, 0x3e, 0xae, 0x3e, 0xf6,
+		0x3f, 0x92, 0x3f, 0xb8, 0x40, 0x28, 0x40, 0x98, 0x40, 0xa6, 0x40, 0xd4, 0x41, 0x1a, 0x41, 0x58,
+		0x41, 0x86, 0x42, 0x4a, 0x43, 0x0c, 0x43, 0x8a, 0x44, 0x06, 0x44, 0x42, 0x44, 0x7e, 0x44, 0x9c,
+		0x44, 0xba, 0x44, 0xd8, 0x44, 0xf6, 0x45, 0x14, 0x45, 0x3e, 0x45, 0x68, 0x45, 0x92, 0x45, 0x9a,
+		0x45, 0x9a, 0x45, 0xa8, 0x45, 0xb6, 0x45, 0xee, 0x46, 0x26, 0x46, 0x34, 0x46, 0x42, 0x46, 0x50,
+		0x46, 0x7c, 0x46, 0xa6, 0x46, 0xd0, 0x46, 0xd0, 0x47, 0x40, 0x47, 0xca, 0x48, 0x82, 0x49, 0x1a,
+		0x49, 0x8e, 0x49, 0xec, 0x4a, 0x68, 0x4b, 0x12, 0x4b, 0x8e, 0x4b, 0xa6, 0x4c, 0x06, 0x4c, 0x66,
+		0x4c, 0x7e, 0x4c, 0xbc, 0x4c, 0xfe, 0x4d, 0x52, 0x4d, 0x96, 0x4d, 0xd4, 0x4e, 0x16, 0x4e, 0x4a,
+		0x4e, 0x68, 0x4e, 0xbc, 0x4f, 0x10, 0x4f, 0x62, 0x50, 0x0c, 0x50, 0xea, 0x51, 0x32, 0x51, 0x94,
+		0x51, 0xc0, 0x51, 0xf6, 0x52, 0x40, 0x52, 0x7a, 0x52, 0xac, 0x53, 0x02, 0x53, 0xae, 0x54, 0x36,
+		0x54, 0x7e, 0x55, 0x22, 0x55, 0xc0, 0x56, 0x3e, 0x56, 0x9c, 0x56, 0xe2, 0x57, 0x2a, 0x57, 0x6c,
+		0x58, 0x1c, 0x58, 0x1c, 0x58, 0x1c, 0x58, 0x52, 0x58, 0x5a, 0x58, 0x8a, 0x58, 0xb6, 0x58, 0xfc,
+		0x59, 0x38, 0x59, 0x64, 0x59, 0xa4, 0x59, 0xde, 0x59, 0xe6, 0x5a, 0x20, 0x5a, 0x5a, 0x5a, 0x80,
+		0x5a, 0xaa, 0x5a, 0xf2, 0x5b, 0x1c, 0x5b, 0x24, 0x5b, 0x34, 0x5b, 0x9c, 0x5c, 0x08, 0x5c, 0x44,
+		0x5c, 0x82, 0x5c, 0xac, 0x5c, 0xd8, 0x5d, 0x24, 0x5d, 0x52, 0x5d, 0xa2, 0x5d, 0xea, 0x5e, 0x67,
+		0x00, 0x01, 0x00, 0x00, 0x01, 0x9b, 0x00, 0x6e, 0x00, 0x0a, 0x00, 0x5e, 0x00, 0x04, 0x00, 0x02,
+		0x00, 0x26, 0x00, 0x36, 0x00, 0x77, 0x00, 0x00, 0x00, 0x9f, 0x0b, 0xe2, 0x00, 0x03, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x1a, 0x01, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x26, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x23, 0x00, 0x3f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12,
+		0x00, 0x62, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x74, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x82, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x08, 0x00, 0x12, 0x00, 0x9a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11,
+		0x00, 0xac, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0xbd, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0xd8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0d, 0x11, 0x03, 0x00, 0xee, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a,
+		0x11, 0xf1, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x4c, 0x12, 0x0b, 0x00, 0x03,
+		0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x24, 0x12, 0x57, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+		0x00, 0x02, 0x00, 0x0e, 0x12, 0x7b, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x46,
+		0x12, 0x89, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x30, 0x12, 0xcf, 0x00, 0x03,
+		0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x1c, 0x12, 0xff, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+		0x00, 0x06, 0x00, 0x30, 0x13, 0x1b, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x24,
+		0x13, 0x4b, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x22, 0x13, 0x6f, 0x00, 0x03,
+		0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x36, 0x13, 0x91, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+		0x00, 0x0c, 0x00, 0x2c, 0x13, 0xc7, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x22, 0x06,
+		0x13, 0xf3, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x34, 0x35, 0xf9, 0x43, 0x6f,
+		0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x35,
+		0x20, 0x51, 0x75, 0x6f, 0x74, 0x65, 0x2d, 0x55, 0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x20, 0x41,
+		0x70, 0x70, 0x73, 0x2e, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x20, 0x50, 0x72, 0x69, 0x6d,
+		0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x33, 0x2e, 0x30,
+		0x31, 0x38, 0x3b, 0x51, 0x55, 0x51, 0x41, 0x3b, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x50,
+		0x72, 0x69, 0x6d, 0x65, 0x43, 0x6f, 0x64, 0x65, 0x2d, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72,
+		0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x20, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x20, 0x43, 0x6f,
+		0x64, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x33, 0x2e, 0x30, 0x33, 0x31, 0x38,
+		0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x43, 0x6f, 0x64, 0x65,
+		0x2d, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x51, 0x75, 0x6f, 0x74, 0x65, 0x2d, 0x55, 0x6e,
+		0x71, 0x75, 0x6f, 0x74, 0x65, 0x20, 0x41, 0x70, 0x70, 0x73, 0x41, 0x6c, 0x61, 0x6e, 0x20, 0x44,
+		0x61, 0x67, 0x75, 0x65, 0x2d, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x65, 0x68, 0x74, 0x74, 0x70, 0x3a,
+		0x2f, 0x2f, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x75, 0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x61, 0x70,
+		0x70, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x62, 0x61, 0x73,
+		0x69, 0x63, 0x72, 0x65, 0x63, 0x69, 0x70, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x43, 0x6f, 0x70, 0x79,
+		0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x35, 0x0a, 0x51,
+		0x75, 0x6f, 0x74, 0x65, 0x2d, 0x55, 0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x20, 0x41, 0x70, 0x70,
+		0x73, 0x20, 0x28, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x75,
+		0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x61, 0x70, 0x70, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x29, 0x0a,
+		0x77, 0x69, 0x74, 0x68, 0x20, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x46, 0x6f,
+		0x6e, 0x74, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x20,
+		0x50, 0x72, 0x69, 0x6d, 0x65, 0x20, 0x43, 0x6f, 0x64, 0x65, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69,
+		0x73, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
+		0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65,
+		0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x49, 0x4c, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46,
+		0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x56, 0x65, 0x72, 0x73,
+		0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x31, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69,
+		0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x64, 0x20,
+		0x62, 0x65, 0x6c, 0x6f, 0x77, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x73,
+		0x6f, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+		0x20, 0x61, 0x20, 0x46, 0x41, 0x51, 0x20, 0x61, 0x74, 0x3a, 0x20, 0x68, 0x74, 0x74, 0x70, 0x3a,
+		0x2f, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69, 0x6c, 0x2e, 0x6f, 0x72,
+		0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x0a, 0x0a, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x0a, 0x53, 0x49, 0x4c, 0x20, 0x4f, 0x50, 0x45, 0x4e, 0x20, 0x46, 0x4f, 0x4e,
+		0x54, 0x20, 0x4c, 0x49, 0x43, 0x45, 0x4e, 0x53, 0x45, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+		0x6e, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x2d, 0x20, 0x32, 0x36, 0x20, 0x46, 0x65, 0x62, 0x72, 0x75,
+		0x61, 0x72, 0x79, 0x20, 0x32, 0x30, 0x30, 0x37, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+		0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x50, 0x52, 0x45, 0x41, 0x4d, 0x42, 0x4c, 0x45, 0x0a, 0x54,
+		0x68, 0x65, 0x20, 0x67, 0x6f, 0x61, 0x6c, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+		0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
+		0x65, 0x20, 0x28, 0x4f, 0x46, 0x4c, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73,
+		0x74, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x77, 0x69,
+		0x64, 0x65, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f,
+		0x66, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x62, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+		0x66, 0x6f, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x0a, 0x74, 0x6f,
+		0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e,
+		0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x66, 0x66, 0x6f, 0x72,
+		0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x63, 0x61, 0x64, 0x65, 0x6d, 0x69, 0x63, 0x20, 0x61,
+		0x6e, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x74, 0x69, 0x63, 0x20, 0x63, 0x6f,
+		0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f,
+		0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 0x61, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20,
+		0x61, 0x6e, 0x64, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f,
+		0x72, 0x6b, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x66, 0x6f, 0x6e, 0x74,
+		0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20,
+		0x61, 0x6e, 0x64, 0x20, 0x69, 0x6d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
+		0x70, 0x61, 0x72, 0x74, 0x6e, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68,
+		0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x4f, 0x46,
+		0x4c, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x63,
+		0x65, 0x6e, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x62,
+		0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x0a, 0x73, 0x74, 0x75, 0x64, 0x69, 0x65, 0x64, 0x0a, 0x6d,
+		0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x64, 0x69,
+		0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x6c, 0x79,
+		0x20, 0x61, 0x73, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x79,
+		0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x6f, 0x6c, 0x64, 0x20, 0x62, 0x79,
+		0x20, 0x74, 0x68, 0x65, 0x6d, 0x73, 0x65, 0x6c, 0x76, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65,
+		0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x0a, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67,
+		0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+		0x77, 0x6f, 0x72, 0x6b, 0x73, 0x0a, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x6e,
+		0x64, 0x6c, 0x65, 0x64, 0x0a, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x0a, 0x72, 0x65,
+		0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x2f,
+		0x6f, 0x72, 0x20, 0x73, 0x6f, 0x6c, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x79,
+		0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64,
+		0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x72, 0x65, 0x73, 0x65,
+		0x72, 0x76, 0x65, 0x64, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e,
+		0x6f, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76,
+		0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65,
+		0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76,
+		0x61, 0x74, 0x69, 0x76, 0x65, 0x73, 0x0a, 0x68, 0x6f, 0x77, 0x65, 0x76, 0x65, 0x72, 0x0a, 0x63,
+		0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+		0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65,
+		0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73,
+		0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65,
+		0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20,
+		0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69,
+		0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e,
+		0x6f, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79, 0x20,
+		0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+		0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73,
+		0x20, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61,
+		0x74, 0x69, 0x76, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x44, 0x45, 0x46, 0x49, 0x4e, 0x49, 0x54, 0x49,
+		0x4f, 0x4e, 0x53, 0x0a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
+		0x72, 0x65, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+		0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x72,
+		0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43,
+		0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28,
+		0x73, 0x29, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69,
+		0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x6c,
+		0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68,
+		0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75,
+		0x64, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x0a,
+		0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x20, 0x61, 0x6e,
+		0x64, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+		0x0a, 0x0a, 0x22, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x46, 0x6f, 0x6e, 0x74,
+		0x20, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f,
+		0x20, 0x61, 0x6e, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69,
+		0x66, 0x69, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x66, 0x74,
+		0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
+		0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x73, 0x29, 0x2e, 0x0a, 0x0a,
+		0x22, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+		0x6e, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+		0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x46,
+		0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6d,
+		0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72,
+		0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f,
+		0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28, 0x73,
+		0x29, 0x2e, 0x0a, 0x0a, 0x22, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65,
+		0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f,
+		0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+		0x6d, 0x61, 0x64, 0x65, 0x20, 0x62, 0x79, 0x20, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74,
+		0x6f, 0x0a, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x69, 0x6e, 0x67, 0x0a, 0x6f, 0x72, 0x20, 0x73, 0x75,
+		0x62, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x2d, 0x2d, 0x20, 0x69, 0x6e,
+		0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x6f, 0x6c,
+		0x65, 0x20, 0x2d, 0x2d, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+		0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+		0x65, 0x20, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69,
+		0x6f, 0x6e, 0x0a, 0x62, 0x79, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x66,
+		0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x79, 0x20, 0x70, 0x6f, 0x72,
+		0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f,
+		0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x20,
+		0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x22, 0x41,
+		0x75, 0x74, 0x68, 0x6f, 0x72, 0x22, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f,
+		0x20, 0x61, 0x6e, 0x79, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x0a, 0x65, 0x6e,
+		0x67, 0x69, 0x6e, 0x65, 0x65, 0x72, 0x0a, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d, 0x65,
+		0x72, 0x0a, 0x74, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x77, 0x72, 0x69, 0x74,
+		0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x65, 0x72, 0x73,
+		0x6f, 0x6e, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+		0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53,
+		0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x45, 0x52, 0x4d, 0x49, 0x53,
+		0x53, 0x49, 0x4f, 0x4e, 0x20, 0x26, 0x20, 0x43, 0x4f, 0x4e, 0x44, 0x49, 0x54, 0x49, 0x4f, 0x4e,
+		0x53, 0x0a, 0x50, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20,
+		0x68, 0x65, 0x72, 0x65, 0x62, 0x79, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x0a, 0x66,
+		0x72, 0x65, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x0a, 0x74, 0x6f,
+		0x20, 0x61, 0x6e, 0x79, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x20, 0x6f, 0x62, 0x74, 0x61,
+		0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20,
+		0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+		0x65, 0x0a, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x0a, 0x73, 0x74, 0x75, 0x64, 0x79, 0x0a, 0x63,
+		0x6f, 0x70, 0x79, 0x0a, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x0a, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x0a,
+		0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x0a, 0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
+		0x75, 0x74, 0x65, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x6c, 0x6c, 0x20, 0x6d, 0x6f, 0x64,
+		0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x6d, 0x6f, 0x64, 0x69,
+		0x66, 0x69, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
+		0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+		0x0a, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
+		0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74,
+		0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x0a, 0x0a, 0x31, 0x29, 0x20, 0x4e, 0x65, 0x69, 0x74, 0x68, 0x65,
+		0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77,
+		0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x69,
+		0x74, 0x73, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x20, 0x63, 0x6f,
+		0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x69, 0x6e, 0x20, 0x4f, 0x72, 0x69, 0x67,
+		0x69, 0x6e, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64,
+		0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65,
+		0x20, 0x73, 0x6f, 0x6c, 0x64, 0x20, 0x62, 0x79, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x2e,
+		0x0a, 0x0a, 0x32, 0x29, 0x20, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x6f, 0x72,
+		0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+		0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53,
+		0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x62,
+		0x75, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x0a, 0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
+		0x75, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x73, 0x6f, 0x6c, 0x64,
+		0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61,
+		0x72, 0x65, 0x0a, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74,
+		0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61,
+		0x69, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6f,
+		0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x61,
+		0x6e, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2e,
+		0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e,
+		0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x73,
+		0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x2d, 0x61, 0x6c, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x65, 0x78,
+		0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x0a, 0x68, 0x75, 0x6d, 0x61, 0x6e, 0x2d, 0x72, 0x65,
+		0x61, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x6f,
+		0x72, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72,
+		0x69, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x63, 0x68, 0x69, 0x6e, 0x65, 0x2d, 0x72, 0x65, 0x61,
+		0x64, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x20, 0x66,
+		0x69, 0x65, 0x6c, 0x64, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 0x65, 0x78,
+		0x74, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x65,
+		0x73, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x6f,
+		0x73, 0x65, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65,
+		0x20, 0x65, 0x61, 0x73, 0x69, 0x6c, 0x79, 0x20, 0x76, 0x69, 0x65, 0x77, 0x65, 0x64, 0x20, 0x62,
+		0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x33, 0x29, 0x20,
+		0x4e, 0x6f, 0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x56, 0x65, 0x72, 0x73,
+		0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20,
+		0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x75, 0x73, 0x65,
+		0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x46, 0x6f,
+		0x6e, 0x74, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x28, 0x73, 0x29, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73,
+		0x73, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74,
+		0x65, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73,
+		0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+		0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x43, 0x6f,
+		0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2e, 0x20,
+		0x54, 0x68, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+		0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6f,
+		0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x20, 0x66, 0x6f, 0x6e,
+		0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e,
+		0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x73,
+		0x2e, 0x0a, 0x0a, 0x34, 0x29, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x73,
+		0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67,
+		0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28, 0x73, 0x29, 0x20, 0x6f, 0x72, 0x20,
+		0x74, 0x68, 0x65, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x28, 0x73, 0x29, 0x20, 0x6f, 0x66,
+		0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61,
+		0x72, 0x65, 0x20, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20,
+		0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x6f, 0x74, 0x65, 0x0a,
+		0x65, 0x6e, 0x64, 0x6f, 0x72, 0x73, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x64, 0x76, 0x65, 0x72,
+		0x74, 0x69, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65,
+		0x64, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74,
+		0x20, 0x74, 0x6f, 0x20, 0x61, 0x63, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x20,
+		0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e,
+		0x28, 0x73, 0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72,
+		0x69, 0x67, 0x68, 0x74, 0x20, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x28, 0x73, 0x29, 0x20, 0x61,
+		0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x28, 0x73, 0x29,
+		0x20, 0x6f, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x65,
+		0x78, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x20,
+		0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x35, 0x29, 0x20,
+		0x54, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+		0x65, 0x0a, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x75, 0x6e,
+		0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x0a, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x74,
+		0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x0a, 0x6d, 0x75, 0x73,
+		0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64,
+		0x20, 0x65, 0x6e, 0x74, 0x69, 0x72, 0x65, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
+		0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x61, 0x6e, 0x64,
+		0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73,
+		0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61,
+		0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
+		0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e,
+		0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72,
+		0x65, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73,
+		0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f,
+		0x74, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x64,
+		0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20,
+		0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53,
+		0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2e, 0x0a, 0x0a, 0x54, 0x45, 0x52, 0x4d, 0x49, 0x4e,
+		0x41, 0x54, 0x49, 0x4f, 0x4e, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e,
+		0x73, 0x65, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x73, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20,
+		0x61, 0x6e, 0x64, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20,
+		0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+		0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+		0x6d, 0x65, 0x74, 0x2e, 0x0a, 0x0a, 0x44, 0x49, 0x53, 0x43, 0x4c, 0x41, 0x49, 0x4d, 0x45, 0x52,
+		0x0a, 0x54, 0x48, 0x45, 0x20, 0x46, 0x4f, 0x4e, 0x54, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41,
+		0x52, 0x45, 0x20, 0x49, 0x53, 0x20, 0x50, 0x52, 0x4f, 0x56, 0x49, 0x44, 0x45, 0x44, 0x20, 0x22,
+		0x41, 0x53, 0x20, 0x49, 0x53, 0x22, 0x0a, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x57,
+		0x41, 0x52, 0x52, 0x41, 0x4e, 0x54, 0x59, 0x20, 0x4f, 0x46, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x4b,
+		0x49, 0x4e, 0x44, 0x0a, 0x45, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x4f, 0x52, 0x20, 0x49,
+		0x4d, 0x50, 0x4c, 0x49, 0x45, 0x44, 0x0a, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47,
+		0x20, 0x42, 0x55, 0x54, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x45, 0x44,
+		0x20, 0x54, 0x4f, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e, 0x54, 0x49,
+		0x45, 0x53, 0x20, 0x4f, 0x46, 0x20, 0x4d, 0x45, 0x52, 0x43, 0x48, 0x41, 0x4e, 0x54, 0x41, 0x42,
+		0x49, 0x4c, 0x49, 0x54, 0x59, 0x0a, 0x46, 0x49, 0x54, 0x4e, 0x45, 0x53, 0x53, 0x20, 0x46, 0x4f,
+		0x52, 0x20, 0x41, 0x20, 0x50, 0x41, 0x52, 0x54, 0x49, 0x43, 0x55, 0x4c, 0x41, 0x52, 0x20, 0x50,
+		0x55, 0x52, 0x50, 0x4f, 0x53, 0x45, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x4e, 0x4f, 0x4e, 0x49, 0x4e,
+		0x46, 0x52, 0x49, 0x4e, 0x47, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x20, 0x4f, 0x46, 0x20, 0x43, 0x4f,
+		0x50, 0x59, 0x52, 0x49, 0x47, 0x48, 0x54, 0x0a, 0x50, 0x41, 0x54, 0x45, 0x4e, 0x54, 0x0a, 0x54,
+		0x52, 0x41, 0x44, 0x45, 0x4d, 0x41, 0x52, 0x4b, 0x0a, 0x4f, 0x52, 0x20, 0x4f, 0x54, 0x48, 0x45,
+		0x52, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x2e, 0x20, 0x49, 0x4e, 0x20, 0x4e, 0x4f, 0x20, 0x45,
+		0x56, 0x45, 0x4e, 0x54, 0x20, 0x53, 0x48, 0x41, 0x4c, 0x4c, 0x20, 0x54, 0x48, 0x45, 0x20, 0x43,
+		0x4f, 0x50, 0x59, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x48, 0x4f, 0x4c, 0x44, 0x45, 0x52, 0x20,
+		0x42, 0x45, 0x20, 0x4c, 0x49, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x46, 0x4f, 0x52, 0x20, 0x41, 0x4e,
+		0x59, 0x20, 0x43, 0x4c, 0x41, 0x49, 0x4d, 0x0a, 0x44, 0x41, 0x4d, 0x41, 0x47, 0x45, 0x53, 0x20,
+		0x4f, 0x52, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x20, 0x4c, 0x49, 0x41, 0x42, 0x49, 0x4c, 0x49,
+		0x54, 0x59, 0x0a, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x49, 0x4e, 0x47, 0x20, 0x41, 0x4e, 0x59,
+		0x20, 0x47, 0x45, 0x4e, 0x45, 0x52, 0x41, 0x4c, 0x0a, 0x53, 0x50, 0x45, 0x43, 0x49, 0x41, 0x4c,
+		0x0a, 0x49, 0x4e, 0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x0a, 0x49, 0x4e, 0x43, 0x49, 0x44, 0x45,
+		0x4e, 0x54, 0x41, 0x4c, 0x0a, 0x4f, 0x52, 0x20, 0x43, 0x4f, 0x4e, 0x53, 0x45, 0x51, 0x55, 0x45,
+		0x4e, 0x54, 0x49, 0x41, 0x4c, 0x20, 0x44, 0x41, 0x4d, 0x41, 0x47, 0x45, 0x53, 0x0a, 0x57, 0x48,
+		0x45, 0x54, 0x48, 0x45, 0x52, 0x20, 0x49, 0x4e, 0x20, 0x41, 0x4e, 0x20, 0x41, 0x43, 0x54, 0x49,
+		0x4f, 0x4e, 0x20, 0x4f, 0x46, 0x20, 0x43, 0x4f, 0x4e, 0x54, 0x52, 0x41, 0x43, 0x54, 0x0a, 0x54,
+		0x4f, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52, 0x57, 0x49, 0x53, 0x45,
+		0x0a, 0x41, 0x52, 0x49, 0x53, 0x49, 0x4e, 0x47, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x0a, 0x4f, 0x55,
+		0x54, 0x20, 0x4f, 0x46, 0x20, 0x54, 0x48, 0x45, 0x20, 0x55, 0x53, 0x45, 0x20, 0x4f, 0x52, 0x20,
+		0x49, 0x4e, 0x41, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x20, 0x54, 0x4f, 0x20, 0x55, 0x53, 0x45,
+		0x20, 0x54, 0x48, 0x45, 0x20, 0x46, 0x4f, 0x4e, 0x54, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41,
+		0x52, 0x45, 0x20, 0x4f, 0x52, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x4f, 0x54, 0x48, 0x45, 0x52,
+		0x20, 0x44, 0x45, 0x41, 0x4c, 0x49, 0x4e, 0x47, 0x53, 0x20, 0x49, 0x4e, 0x20, 0x54, 0x48, 0x45,
+		0x20, 0x46, 0x4f, 0x4e, 0x54, 0x20, 0x53, 0x4f, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x2e, 0x68,
+		0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69,
+		0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00,
+		0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00,
+		0x63, 0x00, 0x29, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x35, 0x00, 0x20, 0x00,
+		0x51, 0x00, 0x75, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x55, 0x00, 0x6e, 0x00,
+		0x71, 0x00, 0x75, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x70, 0x00,
+		0x70, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x50, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x65, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00,
+		0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x31, 0x00,
+		0x38, 0x00, 0x3b, 0x00, 0x51, 0x00, 0x55, 0x00, 0x51, 0x00, 0x41, 0x00, 0x3b, 0x00, 0x43, 0x00,
+		0x6f, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x65, 0x00, 0x72, 0x00, 0x50, 0x00, 0x72, 0x00,
+		0x69, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x65, 0x00, 0x2d, 0x00,
+		0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x43, 0x00,
+		0x6f, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x65, 0x00, 0x72, 0x00, 0x50, 0x00, 0x72, 0x00,
+		0x69, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x65, 0x00, 0x2d, 0x00,
+		0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x56, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x33, 0x00,
+		0x2e, 0x00, 0x30, 0x00, 0x33, 0x00, 0x31, 0x00, 0x38, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x75, 0x00,
+		0x72, 0x00, 0x69, 0x00, 0x65, 0x00, 0x72, 0x00, 0x50, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6d, 0x00,
+		0x65, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x52, 0x00, 0x65, 0x00,
+		0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x51, 0x00, 0x75, 0x00, 0x6f, 0x00,
+		0x74, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x71, 0x00, 0x75, 0x00, 0x6f, 0x00,
+		0x74, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x73, 0x00, 0x41, 0x00,
+		0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x44, 0x00, 0x61, 0x00, 0x67, 0x00, 0x75, 0x00,
+		0x65, 0x00, 0x2d, 0x00, 0x47, 0x00, 0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x65, 0x00,
+		0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x71, 0x00,
+		0x75, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x65, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x71, 0x00, 0x75, 0x00,
+		0x6f, 0x00, 0x74, 0x00, 0x65, 0x00, 0x61, 0x00, 0x70, 0x00, 0x70, 0x00, 0x73, 0x00, 0x2e, 0x00,
+		0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00,
+		0x2f, 0x00, 0x2f, 0x00, 0x62, 0x00, 0x61, 0x00, 0x73, 0x00, 0x69, 0x00, 0x63, 0x00, 0x72, 0x00,
+		0x65, 0x00, 0x63, 0x00, 0x69, 0x00, 0x70, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00,
+		0x6d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00,
+		0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00, 0x63, 0x00, 0x29, 0x00, 0x20, 0x00, 0x32, 0x00,
+		0x30, 0x00, 0x31, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x51, 0x00, 0x75, 0x00, 0x6f, 0x00, 0x74, 0x00,
+		0x65, 0x00, 0x2d, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x71, 0x00, 0x75, 0x00, 0x6f, 0x00, 0x74, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x73, 0x00, 0x20, 0x00, 0x28, 0x00,
+		0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x71, 0x00,
+		0x75, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x65, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x71, 0x00, 0x75, 0x00,
+		0x6f, 0x00, 0x74, 0x00, 0x65, 0x00, 0x61, 0x00, 0x70, 0x00, 0x70, 0x00, 0x73, 0x00, 0x2e, 0x00,
+		0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x29, 0x00, 0x0a, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00,
+		0x68, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00,
+		0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x75, 0x00,
+		0x72, 0x00, 0x69, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x50, 0x00, 0x72, 0x00, 0x69, 0x00,
+		0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x65, 0x00, 0x2e, 0x00,
+		0x0a, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x46, 0x00,
+		0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00,
+		0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00,
+		0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00,
+		0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
+		0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00,
+		0x0a, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00,
+		0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00,
+		0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00,
+		0x70, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x6c, 0x00,
+		0x6f, 0x00, 0x77, 0x00, 0x0a, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00,
+		0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00,
+		0x76, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00,
+		0x46, 0x00, 0x41, 0x00, 0x51, 0x00, 0x20, 0x00, 0x61, 0x00, 0x74, 0x00, 0x3a, 0x00, 0x20, 0x00,
+		0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00,
+		0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00,
+		0x69, 0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00,
+		0x46, 0x00, 0x4c, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x0a, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x45, 0x00,
+		0x4e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x4c, 0x00,
+		0x49, 0x00, 0x43, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x45, 0x00, 0x20, 0x00, 0x56, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00,
+		0x2e, 0x00, 0x31, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x20, 0x00, 0x32, 0x00, 0x36, 0x00, 0x20, 0x00,
+		0x46, 0x00, 0x65, 0x00, 0x62, 0x00, 0x72, 0x00, 0x75, 0x00, 0x61, 0x00, 0x72, 0x00, 0x79, 0x00,
+		0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0x00, 0x0a, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x50, 0x00, 0x52, 0x00, 0x45, 0x00, 0x41, 0x00, 0x4d, 0x00,
+		0x42, 0x00, 0x4c, 0x00, 0x45, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x67, 0x00, 0x6f, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00,
+		0x6e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00,
+		0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x28, 0x00,
+		0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x29, 0x00, 0x20, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6d, 0x00,
+		0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x6f, 0x00,
+		0x72, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x77, 0x00, 0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x64, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x6d, 0x00,
+		0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x63, 0x00,
+		0x6f, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x61, 0x00,
+		0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x74, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x63, 0x00,
+		0x74, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x73, 0x00, 0x75, 0x00,
+		0x70, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x63, 0x00,
+		0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00,
+		0x65, 0x00, 0x66, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x61, 0x00, 0x63, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00,
+		0x6d, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00,
+		0x6c, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x75, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00,
+		0x69, 0x00, 0x63, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x75, 0x00,
+		0x6e, 0x00, 0x69, 0x00, 0x74, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x61, 0x00,
+		0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00,
+		0x6f, 0x00, 0x76, 0x00, 0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00,
+		0x66, 0x00, 0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x66, 0x00, 0x72, 0x00,
+		0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20, 0x00,
+		0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x77, 0x00, 0x68, 0x00, 0x69, 0x00, 0x63, 0x00, 0x68, 0x00,
+		0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6d, 0x00,
+		0x61, 0x00, 0x79, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x68, 0x00,
+		0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x65, 0x00,
+		0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00, 0x72, 0x00,
+		0x74, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x68, 0x00, 0x69, 0x00, 0x70, 0x00,
+		0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x74, 0x00,
+		0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x54, 0x00,
+		0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x61, 0x00,
+		0x6c, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+		0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x75, 0x00,
+		0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x64, 0x00,
+		0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00,
+		0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00,
+		0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x66, 0x00,
+		0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00,
+		0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x72, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00,
+		0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x6d, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x65, 0x00, 0x73, 0x00,
+		0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00,
+		0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6c, 0x00,
+		0x75, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x61, 0x00,
+		0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72, 0x00,
+		0x6b, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x62, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x62, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x65, 0x00,
+		0x64, 0x00, 0x0a, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x62, 0x00, 0x65, 0x00, 0x64, 0x00, 0x64, 0x00,
+		0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00,
+		0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00,
+		0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00,
+		0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00,
+		0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x70, 0x00,
+		0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x68, 0x00, 0x61, 0x00, 0x74, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00,
+		0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00,
+		0x64, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00,
+		0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00,
+		0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x73, 0x00,
+		0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00,
+		0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00,
+		0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00,
+		0x76, 0x00, 0x65, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x65, 0x00,
+		0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x0a, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x6e, 0x00,
+		0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00,
+		0x6c, 0x00, 0x65, 0x00, 0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00,
+		0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00,
+		0x79, 0x00, 0x70, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x6c, 0x00,
+		0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x20, 0x00,
+		0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x71, 0x00, 0x75, 0x00,
+		0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x66, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
+		0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6d, 0x00,
+		0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00,
+		0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00,
+		0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x64, 0x00,
+		0x6f, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x61, 0x00, 0x70, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00,
+		0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00,
+		0x75, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x63, 0x00, 0x72, 0x00,
+		0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00,
+		0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x69, 0x00, 0x72, 0x00, 0x20, 0x00, 0x64, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00,
+		0x65, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00,
+		0x49, 0x00, 0x4e, 0x00, 0x49, 0x00, 0x54, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x53, 0x00,
+		0x0a, 0x00, 0x22, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00,
+		0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x22, 0x00,
+		0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00,
+		0x65, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00,
+		0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x65, 0x00,
+		0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00,
+		0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00,
+		0x6c, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00,
+		0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00,
+		0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x63, 0x00,
+		0x6c, 0x00, 0x65, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x6d, 0x00,
+		0x61, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00,
+		0x20, 0x00, 0x73, 0x00, 0x75, 0x00, 0x63, 0x00, 0x68, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00,
+		0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x79, 0x00, 0x20, 0x00,
+		0x69, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00, 0x64, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x73, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00,
+		0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x62, 0x00, 0x75, 0x00, 0x69, 0x00,
+		0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00,
+		0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x64, 0x00,
+		0x6f, 0x00, 0x63, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x61, 0x00,
+		0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x22, 0x00,
+		0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x61, 0x00,
+		0x6d, 0x00, 0x65, 0x00, 0x22, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00,
+		0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x73, 0x00, 0x70, 0x00, 0x65, 0x00, 0x63, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00,
+		0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x73, 0x00, 0x75, 0x00, 0x63, 0x00,
+		0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x66, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00,
+		0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00,
+		0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x28, 0x00,
+		0x73, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x4f, 0x00, 0x72, 0x00,
+		0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x56, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x22, 0x00, 0x20, 0x00,
+		0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00,
+		0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00,
+		0x6c, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
+		0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00,
+		0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00,
+		0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
+		0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+		0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x0a, 0x00,
+		0x0a, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00,
+		0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00,
+		0x6f, 0x00, 0x6e, 0x00, 0x22, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00,
+		0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x61, 0x00,
+		0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x64, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x64, 0x00, 0x64, 0x00,
+		0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x0a, 0x00, 0x64, 0x00,
+		0x65, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x0a, 0x00,
+		0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x73, 0x00, 0x75, 0x00, 0x62, 0x00, 0x73, 0x00, 0x74, 0x00,
+		0x69, 0x00, 0x74, 0x00, 0x75, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00,
+		0x2d, 0x00, 0x2d, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00,
+		0x72, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00,
+		0x20, 0x00, 0x77, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x2d, 0x00,
+		0x2d, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00,
+		0x70, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4f, 0x00,
+		0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00,
+		0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x0a, 0x00,
+		0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x67, 0x00,
+		0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x6d, 0x00,
+		0x61, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x62, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6e, 0x00,
+		0x67, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00,
+		0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00,
+		0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00,
+		0x20, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x77, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x76, 0x00,
+		0x69, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00,
+		0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x6f, 0x00, 0x72, 0x00, 0x22, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00,
+		0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x0a, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00,
+		0x65, 0x00, 0x65, 0x00, 0x72, 0x00, 0x0a, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x67, 0x00,
+		0x72, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x72, 0x00, 0x0a, 0x00, 0x74, 0x00,
+		0x65, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6e, 0x00, 0x69, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6c, 0x00,
+		0x20, 0x00, 0x77, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
+		0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00,
+		0x20, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00,
+		0x77, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
+		0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00,
+		0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00,
+		0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x50, 0x00,
+		0x45, 0x00, 0x52, 0x00, 0x4d, 0x00, 0x49, 0x00, 0x53, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4f, 0x00,
+		0x4e, 0x00, 0x20, 0x00, 0x26, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x44, 0x00,
+		0x49, 0x00, 0x54, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x0a, 0x00, 0x50, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
+		0x6e, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00,
+		0x65, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x67, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6e, 0x00,
+		0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x66, 0x00, 0x72, 0x00, 0x65, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x72, 0x00,
+		0x67, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x74, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x69, 0x00,
+		0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00,
+		0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x74, 0x00,
+		0x6f, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x73, 0x00, 0x74, 0x00,
+		0x75, 0x00, 0x64, 0x00, 0x79, 0x00, 0x0a, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00,
+		0x0a, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x72, 0x00, 0x67, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x65, 0x00,
+		0x6d, 0x00, 0x62, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00,
+		0x69, 0x00, 0x66, 0x00, 0x79, 0x00, 0x0a, 0x00, 0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00,
+		0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00,
+		0x0a, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6c, 0x00,
+		0x6c, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00,
+		0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00,
+		0x6e, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00,
+		0x64, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00,
+		0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x73, 0x00, 0x75, 0x00,
+		0x62, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+		0x6c, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x63, 0x00,
+		0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x69, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x73, 0x00, 0x3a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x31, 0x00, 0x29, 0x00, 0x20, 0x00, 0x4e, 0x00,
+		0x65, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00,
+		0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x69, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x69, 0x00, 0x76, 0x00, 0x69, 0x00, 0x64, 0x00, 0x75, 0x00,
+		0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x6f, 0x00,
+		0x6e, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x69, 0x00, 0x6e, 0x00,
+		0x20, 0x00, 0x4f, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00,
+		0x6c, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x64, 0x00,
+		0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00,
+		0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x6d, 0x00,
+		0x61, 0x00, 0x79, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00,
+		0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x69, 0x00, 0x74, 0x00,
+		0x73, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x66, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x32, 0x00,
+		0x29, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00,
+		0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
+		0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x56, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00,
+		0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00,
+		0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x79, 0x00,
+		0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x62, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00,
+		0x6c, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x72, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00,
+		0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00,
+		0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x2f, 0x00, 0x6f, 0x00, 0x72, 0x00,
+		0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00,
+		0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x73, 0x00,
+		0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x0a, 0x00,
+		0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x61, 0x00, 0x74, 0x00, 0x20, 0x00, 0x65, 0x00, 0x61, 0x00,
+		0x63, 0x00, 0x68, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x20, 0x00,
+		0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x73, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6f, 0x00,
+		0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
+		0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00,
+		0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00,
+		0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00,
+		0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x75, 0x00,
+		0x64, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x65, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00,
+		0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x2d, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x65, 0x00, 0x78, 0x00, 0x74, 0x00, 0x20, 0x00, 0x66, 0x00,
+		0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x0a, 0x00, 0x68, 0x00, 0x75, 0x00, 0x6d, 0x00,
+		0x61, 0x00, 0x6e, 0x00, 0x2d, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x64, 0x00, 0x61, 0x00,
+		0x62, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x68, 0x00, 0x65, 0x00, 0x61, 0x00, 0x64, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x69, 0x00,
+		0x6e, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x70, 0x00,
+		0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x72, 0x00, 0x69, 0x00, 0x61, 0x00, 0x74, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x63, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e, 0x00,
+		0x65, 0x00, 0x2d, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x64, 0x00, 0x61, 0x00, 0x62, 0x00,
+		0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x74, 0x00, 0x61, 0x00, 0x64, 0x00,
+		0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6c, 0x00,
+		0x64, 0x00, 0x73, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00,
+		0x6e, 0x00, 0x20, 0x00, 0x74, 0x00, 0x65, 0x00, 0x78, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6f, 0x00,
+		0x72, 0x00, 0x20, 0x00, 0x62, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x61, 0x00, 0x72, 0x00, 0x79, 0x00,
+		0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00,
+		0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x61, 0x00,
+		0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x73, 0x00, 0x20, 0x00, 0x63, 0x00,
+		0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x65, 0x00, 0x61, 0x00,
+		0x73, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x76, 0x00, 0x69, 0x00, 0x65, 0x00,
+		0x77, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00,
+		0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2e, 0x00,
+		0x0a, 0x00, 0x0a, 0x00, 0x33, 0x00, 0x29, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x6f, 0x00, 0x20, 0x00,
+		0x4d, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00,
+		0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00,
+		0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00,
+		0x75, 0x00, 0x6e, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x73, 0x00, 0x73, 0x00, 0x20, 0x00, 0x65, 0x00,
+		0x78, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x69, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x77, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00,
+		0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00,
+		0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x67, 0x00, 0x72, 0x00,
+		0x61, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x72, 0x00,
+		0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x69, 0x00,
+		0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
+		0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+		0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00,
+		0x73, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00,
+		0x63, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x6e, 0x00,
+		0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x70, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x69, 0x00,
+		0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00,
+		0x79, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6e, 0x00,
+		0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x70, 0x00,
+		0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+		0x34, 0x00, 0x29, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6e, 0x00,
+		0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x6f, 0x00,
+		0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00,
+		0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00,
+		0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00,
+		0x29, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x28, 0x00,
+		0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00,
+		0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x73, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00,
+		0x74, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00,
+		0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00,
+		0x6d, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x64, 0x00,
+		0x6f, 0x00, 0x72, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00,
+		0x61, 0x00, 0x64, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74, 0x00, 0x69, 0x00, 0x73, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
+		0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x56, 0x00,
+		0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x0a, 0x00, 0x65, 0x00,
+		0x78, 0x00, 0x63, 0x00, 0x65, 0x00, 0x70, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00,
+		0x20, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x6c, 0x00,
+		0x65, 0x00, 0x64, 0x00, 0x67, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x62, 0x00,
+		0x75, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00,
+		0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00,
+		0x74, 0x00, 0x20, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+		0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x6f, 0x00, 0x72, 0x00, 0x28, 0x00, 0x73, 0x00, 0x29, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00,
+		0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00,
+		0x65, 0x00, 0x69, 0x00, 0x72, 0x00, 0x20, 0x00, 0x65, 0x00, 0x78, 0x00, 0x70, 0x00, 0x6c, 0x00,
+		0x69, 0x00, 0x63, 0x00, 0x69, 0x00, 0x74, 0x00, 0x20, 0x00, 0x77, 0x00, 0x72, 0x00, 0x69, 0x00,
+		0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00,
+		0x6d, 0x00, 0x69, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2e, 0x00,
+		0x0a, 0x00, 0x0a, 0x00, 0x35, 0x00, 0x29, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00,
+		0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x0a, 0x00, 0x6d, 0x00,
+		0x6f, 0x00, 0x64, 0x00, 0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
+		0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x64, 0x00,
+		0x69, 0x00, 0x66, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0a, 0x00, 0x69, 0x00, 0x6e, 0x00,
+		0x20, 0x00, 0x70, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00,
+		0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x77, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x6c, 0x00,
+		0x65, 0x00, 0x0a, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20, 0x00, 0x62, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00,
+		0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6e, 0x00,
+		0x74, 0x00, 0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x75, 0x00,
+		0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00,
+		0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+		0x65, 0x00, 0x0a, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x75, 0x00,
+		0x73, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x62, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00,
+		0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00,
+		0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00,
+		0x6f, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00,
+		0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00,
+		0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x71, 0x00, 0x75, 0x00, 0x69, 0x00,
+		0x72, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x66, 0x00,
+		0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00,
+		0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00,
+		0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x69, 0x00,
+		0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x64, 0x00, 0x6f, 0x00,
+		0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x61, 0x00,
+		0x70, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00,
+		0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x75, 0x00,
+		0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x63, 0x00, 0x72, 0x00, 0x65, 0x00,
+		0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x69, 0x00,
+		0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x46, 0x00,
+		0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00,
+		0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x54, 0x00,
+		0x45, 0x00, 0x52, 0x00, 0x4d, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x41, 0x00, 0x54, 0x00, 0x49, 0x00,
+		0x4f, 0x00, 0x4e, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x62, 0x00, 0x65, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00,
+		0x6e, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00,
+		0x20, 0x00, 0x76, 0x00, 0x6f, 0x00, 0x69, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x66, 0x00,
+		0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00,
+		0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x76, 0x00,
+		0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x69, 0x00, 0x74, 0x00,
+		0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00,
+		0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x74, 0x00,
+		0x2e, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x49, 0x00, 0x53, 0x00, 0x43, 0x00, 0x4c, 0x00,
+		0x41, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x52, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x48, 0x00,
+		0x45, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x53, 0x00,
+		0x4f, 0x00, 0x46, 0x00, 0x54, 0x00, 0x57, 0x00, 0x41, 0x00, 0x52, 0x00, 0x45, 0x00, 0x20, 0x00,
+		0x49, 0x00, 0x53, 0x00, 0x20, 0x00, 0x50, 0x00, 0x52, 0x00, 0x4f, 0x00, 0x56, 0x00, 0x49, 0x00,
+		0x44, 0x00, 0x45, 0x00, 0x44, 0x00, 0x20, 0x00, 0x22, 0x00, 0x41, 0x00, 0x53, 0x00, 0x20, 0x00,
+		0x49, 0x00, 0x53, 0x00, 0x22, 0x00, 0x0a, 0x00, 0x57, 0x00, 0x49, 0x00, 0x54, 0x00, 0x48, 0x00,
+		0x4f, 0x00, 0x55, 0x00, 0x54, 0x00, 0x20, 0x00, 0x57, 0x00, 0x41, 0x00, 0x52, 0x00, 0x52, 0x00,
+		0x41, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x59, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x20, 0x00,
+		0x41, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x20, 0x00, 0x4b, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00,
+		0x0a, 0x00, 0x45, 0x00, 0x58, 0x00, 0x50, 0x00, 0x52, 0x00, 0x45, 0x00, 0x53, 0x00, 0x53, 0x00,
+		0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x4c, 0x00,
+		0x49, 0x00, 0x45, 0x00, 0x44, 0x00, 0x0a, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x43, 0x00, 0x4c, 0x00,
+		0x55, 0x00, 0x44, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x20, 0x00, 0x42, 0x00, 0x55, 0x00,
+		0x54, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x49, 0x00,
+		0x4d, 0x00, 0x49, 0x00, 0x54, 0x00, 0x45, 0x00, 0x44, 0x00, 0x20, 0x00, 0x54, 0x00, 0x4f, 0x00,
+		0x20, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x20, 0x00, 0x57, 0x00, 0x41, 0x00, 0x52, 0x00,
+		0x52, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x49, 0x00, 0x45, 0x00, 0x53, 0x00, 0x20, 0x00,
+		0x4f, 0x00, 0x46, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x52, 0x00, 0x43, 0x00, 0x48, 0x00,
+		0x41, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x41, 0x00, 0x42, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x49, 0x00,
+		0x54, 0x00, 0x59, 0x00, 0x0a, 0x00, 0x46, 0x00, 0x49, 0x00, 0x54, 0x00, 0x4e, 0x00, 0x45, 0x00,
+		0x53, 0x00, 0x53, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x41, 0x00,
+		0x20, 0x00, 0x50, 0x00, 0x41, 0x00, 0x52, 0x00, 0x54, 0x00, 0x49, 0x00, 0x43, 0x00, 0x55, 0x00,
+		0x4c, 0x00, 0x41, 0x00, 0x52, 0x00, 0x20, 0x00, 0x50, 0x00, 0x55, 0x00, 0x52, 0x00, 0x50, 0x00,
+		0x4f, 0x00, 0x53, 0x00, 0x45, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x20, 0x00,
+		0x4e, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x46, 0x00, 0x52, 0x00, 0x49, 0x00,
+		0x4e, 0x00, 0x47, 0x00, 0x45, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x20, 0x00,
+		0x4f, 0x00, 0x46, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x59, 0x00, 0x52, 0x00,
+		0x49, 0x00, 0x47, 0x00, 0x48, 0x00, 0x54, 0x00, 0x0a, 0x00, 0x50, 0x00, 0x41, 0x00, 0x54, 0x00,
+		0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x52, 0x00, 0x41, 0x00, 0x44, 0x00,
+		0x45, 0x00, 0x4d, 0x00, 0x41, 0x00, 0x52, 0x00, 0x4b, 0x00, 0x0a, 0x00, 0x4f, 0x00, 0x52, 0x00,
+		0x20, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x52, 0x00, 0x20, 0x00, 0x52, 0x00,
+		0x49, 0x00, 0x47, 0x00, 0x48, 0x00, 0x54, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00,
+		0x20, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x20, 0x00, 0x45, 0x00, 0x56, 0x00, 0x45, 0x00, 0x4e, 0x00,
+		0x54, 0x00, 0x20, 0x00, 0x53, 0x00, 0x48, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x20, 0x00,
+		0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x59, 0x00,
+		0x52, 0x00, 0x49, 0x00, 0x47, 0x00, 0x48, 0x00, 0x54, 0x00, 0x20, 0x00, 0x48, 0x00, 0x4f, 0x00,
+		0x4c, 0x00, 0x44, 0x00, 0x45, 0x00, 0x52, 0x00, 0x20, 0x00, 0x42, 0x00, 0x45, 0x00, 0x20, 0x00,
+		0x4c, 0x00, 0x49, 0x00, 0x41, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x45, 0x00, 0x20, 0x00, 0x46, 0x00,
+		0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x20, 0x00, 0x43, 0x00,
+		0x4c, 0x00, 0x41, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x41, 0x00, 0x4d, 0x00,
+		0x41, 0x00, 0x47, 0x00, 0x45, 0x00, 0x53, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00,
+		0x4f, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x52, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x49, 0x00,
+		0x41, 0x00, 0x42, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x54, 0x00, 0x59, 0x00, 0x0a, 0x00,
+		0x49, 0x00, 0x4e, 0x00, 0x43, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x44, 0x00, 0x49, 0x00, 0x4e, 0x00,
+		0x47, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4e, 0x00, 0x59, 0x00, 0x20, 0x00, 0x47, 0x00, 0x45, 0x00,
+		0x4e, 0x00, 0x45, 0x00, 0x52, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x0a, 0x00, 0x53, 0x00, 0x50, 0x00,
+		0x45, 0x00, 0x43, 0x00, 0x49, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x0a, 0x00, 0x49, 0x00, 0x4e, 0x00,
+		0x44, 0x00, 0x49, 0x00, 0x52, 0x00, 0x45, 0x00, 0x43, 0x00, 0x54, 0x00, 0x0a, 0x00, 0x49, 0x00,
+		0x4e, 0x00, 0x43, 0x00, 0x49, 0x00, 0x44, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x41, 0x00,
+		0x4c, 0x00, 0x0a, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x4e, 0x00,
+		0x53, 0x00, 0x45, 0x00, 0x51, 0x00, 0x55, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x49, 0x00,
+		0x41, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x44, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x41, 0x00, 0x47, 0x00,
+		0x45, 0x00, 0x53, 0x00, 0x0a, 0x00, 0x57, 0x00, 0x48, 0x00, 0x45, 0x00, 0x54, 0x00, 0x48, 0x00,
+		0x45, 0x00, 0x52, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4e, 0x00,
+		0x20, 0x00, 0x41, 0x00, 0x43, 0x00, 0x54, 0x00, 0x49, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x20, 0x00,
+		0x4f, 0x00, 0x46, 0x00, 0x20, 0x00, 0x43, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x52, 0x00,
+		0x41, 0x00, 0x43, 0x00, 0x54, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x54, 0x00,
+		0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00,
+		0x52, 0x00, 0x57, 0x00, 0x49, 0x00, 0x53, 0x00, 0x45, 0x00, 0x0a, 0x00, 0x41, 0x00, 0x52, 0x00,
+		0x49, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x20, 0x00, 0x46, 0x00, 0x52, 0x00,
+		0x4f, 0x00, 0x4d, 0x00, 0x0a, 0x00, 0x4f, 0x00, 0x55, 0x00, 0x54, 0x00, 0x20, 0x00, 0x4f, 0x00,
+		0x46, 0x00, 0x20, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x20, 0x00, 0x55, 0x00, 0x53, 0x00,
+		0x45, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x41, 0x00,
+		0x42, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x54, 0x00, 0x59, 0x00, 0x20, 0x00, 0x54, 0x00,
+		0x4f, 0x00, 0x20, 0x00, 0x55, 0x00, 0x53, 0x00, 0x45, 0x00, 0x20, 0x00, 0x54, 0x00, 0x48, 0x00,
+		0x45, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x53, 0x00,
+		0x4f, 0x00, 0x46, 0x00, 0x54, 0x00, 0x57, 0x00, 0x41, 0x00, 0x52, 0x00, 0x45, 0x00, 0x20, 0x00,
+		0x4f, 0x00, 0x52, 0x00, 0x20, 0x00, 0x46, 0x00, 0x52, 0x00, 0x4f, 0x00, 0x4d, 0x00, 0x20, 0x00,
+		0x4f, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x52, 0x00, 0x20, 0x00, 0x44, 0x00, 0x45, 0x00,
+		0x41, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x47, 0x00, 0x53, 0x00, 0x20, 0x00, 0x49, 0x00,
+		0x4e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x48, 0x00, 0x45, 0x00, 0x20, 0x00, 0x46, 0x00, 0x4f, 0x00,
+		0x4e, 0x00, 0x54, 0x00, 0x20, 0x00, 0x53, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x54, 0x00, 0x57, 0x00,
+		0x41, 0x00, 0x52, 0x00, 0x45, 0x00, 0x2e, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00,
+		0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00,
+		0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00,
+		0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x02, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0x47, 0x00, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x24, 0x00, 0xc9, 0x01, 0x02, 0x00, 0xc7, 0x00, 0x62, 0x00, 0xad, 0x01, 0x03,
+		0x01, 0x04, 0x00, 0x63, 0x00, 0xae, 0x00, 0x90, 0x00, 0x25, 0x00, 0x26, 0x00, 0xfd, 0x00, 0xff,
+		0x00, 0x64, 0x01, 0x05, 0x01, 0x06, 0x00, 0x27, 0x00, 0xe9, 0x01, 0x07, 0x01, 0x08, 0x00, 0x28,
+		0x00, 0x65, 0x01, 0x09, 0x01, 0x0a, 0x00, 0xc8, 0x00, 0xca, 0x01, 0x0b, 0x00, 0xcb, 0x01, 0x0c,
+		0x01, 0x0d, 0x00, 0x29, 0x00, 0x2a, 0x00, 0xf8, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x10, 0x00, 0x2b,
+		0x01, 0x11, 0x01, 0x12, 0x00, 0x2c, 0x01, 0x13, 0x00, 0xcc, 0x01, 0x14, 0x00, 0xcd, 0x00, 0xce,
+		0x00, 0xfa, 0x00, 0xcf, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x00, 0x2d, 0x01, 0x18, 0x00, 0x2e,
+		0x01, 0x19, 0x00, 0x2f, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c, 0x01, 0x1d, 0x00, 0xe2, 0x00, 0x30,
+		0x00, 0x31, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20, 0x01, 0x21, 0x00, 0x66, 0x00, 0x32, 0x00, 0xd0,
+		0x01, 0x22, 0x00, 0xd1, 0x00, 0x67, 0x00, 0xd3, 0x01, 0x23, 0x01, 0x24, 0x00, 0x91, 0x00, 0xaf,
+		0x00, 0xb0, 0x00, 0x33, 0x00, 0xed, 0x00, 0x34, 0x00, 0x35, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27,
+		0x00, 0x36, 0x01, 0x28, 0x00, 0xe4, 0x00, 0xfb, 0x01, 0x29, 0x01, 0x2a, 0x00, 0x37, 0x01, 0x2b,
+		0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2e, 0x00, 0x38, 0x00, 0xd4, 0x01, 0x2f, 0x00, 0xd5, 0x00, 0x68,
+		0x00, 0xd6, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x00, 0x39, 0x00, 0x3a,
+		0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0xeb, 0x01, 0x39,
+		0x00, 0xbb, 0x01, 0x3a, 0x00, 0x3d, 0x01, 0x3b, 0x00, 0xe6, 0x01, 0x3c, 0x00, 0x44, 0x00, 0x69,
+		0x01, 0x3d, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6a, 0x01, 0x3e, 0x01, 0x3f, 0x00, 0x6e, 0x00, 0x6d,
+		0x00, 0xa0, 0x00, 0x45, 0x00, 0x46, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x6f, 0x01, 0x40, 0x01, 0x41,
+		0x00, 0x47, 0x00, 0xea, 0x01, 0x42, 0x01, 0x01, 0x00, 0x48, 0x00, 0x70, 0x01, 0x43, 0x01, 0x44,
+		0x00, 0x72, 0x00, 0x73, 0x01, 0x45, 0x00, 0x71, 0x01, 0x46, 0x01, 0x47, 0x00, 0x49, 0x00, 0x4a,
+		0x00, 0xf9, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x00, 0x4b, 0x01, 0x4b, 0x01, 0x4c, 0x00, 0x4c,
+		0x00, 0xd7, 0x00, 0x74, 0x01, 0x4d, 0x00, 0x76, 0x00, 0x77, 0x01, 0x4e, 0x00, 0x75, 0x01, 0x4f,
+		0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x00, 0x4d, 0x01, 0x53, 0x01, 0x54, 0x00, 0x4e, 0x01, 0x55,
+		0x00, 0x4f, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x00, 0xe3, 0x00, 0x50, 0x00, 0x51,
+		0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x00, 0x78, 0x00, 0x52, 0x00, 0x79, 0x01, 0x5e,
+		0x00, 0x7b, 0x00, 0x7c, 0x00, 0x7a, 0x01, 0x5f, 0x01, 0x60, 0x00, 0xa1, 0x00, 0x7d, 0x00, 0xb1,
+		0x00, 0x53, 0x00, 0xee, 0x00, 0x54, 0x00, 0x55, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x00, 0x56,
+		0x01, 0x64, 0x00, 0xe5, 0x00, 0xfc, 0x01, 0x65, 0x01, 0x66, 0x00, 0x89, 0x00, 0x57, 0x01, 0x67,
+		0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x00, 0x58, 0x00, 0x7e, 0x01, 0x6b, 0x00, 0x80, 0x00, 0x81,
+		0x00, 0x7f, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70, 0x00, 0x59, 0x00, 0x5a,
+		0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0xec, 0x01, 0x75,
+		0x00, 0xba, 0x01, 0x76, 0x00, 0x5d, 0x01, 0x77, 0x00, 0xe7, 0x01, 0x78, 0x00, 0xc0, 0x00, 0xc1,
+		0x00, 0x9d, 0x00, 0x9e, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x7b, 0x00, 0x9b, 0x00, 0x13, 0x00, 0x14,
+		0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c,
+		0x00, 0xbc, 0x00, 0xf4, 0x00, 0xf5, 0x00, 0xf6, 0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f,
+		0x01, 0x80, 0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87,
+		0x01, 0x88, 0x00, 0x0d, 0x00, 0x3f, 0x00, 0xc3, 0x00, 0x87, 0x00, 0x1d, 0x00, 0x0f, 0x00, 0xab,
+		0x00, 0x04, 0x00, 0xa3, 0x00, 0x06, 0x00, 0x11, 0x00, 0x22, 0x00, 0xa2, 0x00, 0x05, 0x00, 0x0a,
+		0x00, 0x1e, 0x00, 0x12, 0x00, 0x42, 0x00, 0x5e, 0x00, 0x60, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x0b,
+		0x00, 0x0c, 0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x00, 0xb3, 0x00, 0xb2,
+		0x00, 0x10, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0xa9, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xc5,
+		0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4, 0x01, 0x90, 0x00, 0x84, 0x00, 0xbd,
+		0x00, 0x07, 0x01, 0x91, 0x00, 0xa6, 0x00, 0xf7, 0x00, 0x85, 0x01, 0x92, 0x00, 0x96, 0x00, 0xa7,
+		0x00, 0x61, 0x00, 0xb8, 0x00, 0x20, 0x00, 0x21, 0x00, 0x95, 0x00, 0x92, 0x00, 0x9c, 0x00, 0x1f,
+		0x00, 0x94, 0x00, 0xa4, 0x00, 0xef, 0x00, 0xf0, 0x00, 0x8f, 0x00, 0x98, 0x00, 0x08, 0x00, 0xc6,
+		0x00, 0x0e, 0x00, 0x93, 0x00, 0x9a, 0x00, 0xa5, 0x00, 0x99, 0x00, 0xb9, 0x00, 0x5f, 0x00, 0xe8,
+		0x00, 0x23, 0x00, 0x09, 0x00, 0x88, 0x00, 0x8b, 0x00, 0x8a, 0x00, 0x86, 0x00, 0x8c, 0x00, 0x83,
+		0x00, 0x41, 0x00, 0x82, 0x00, 0xc2, 0x01, 0x93, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x00, 0x8d,
+		0x01, 0x97, 0x00, 0xdb, 0x00, 0xe1, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b, 0x01, 0x9c,
+		0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4,
+		0x00, 0xde, 0x00, 0xd8, 0x00, 0x8e, 0x00, 0xdc, 0x00, 0x43, 0x00, 0xdf, 0x00, 0xda, 0x00, 0xe0,
+		0x00, 0xdd, 0x00, 0xd9, 0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x41, 0x6d, 0x61, 0x63,
+		0x72, 0x6f, 0x6e, 0x07, 0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x43, 0x63, 0x69, 0x72,
+		0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a, 0x43, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65,
+		0x6e, 0x74, 0x06, 0x44, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74,
+		0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0a, 0x45,
+		0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f,
+		0x6e, 0x07, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x47, 0x63, 0x69, 0x72, 0x63, 0x75,
+		0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x47, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65,
+		0x6e, 0x74, 0x0a, 0x47, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x04, 0x48, 0x62,
+		0x61, 0x72, 0x0b, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x02, 0x49,
+		0x4a, 0x06, 0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x49, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+		0x07, 0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x0b,
+		0x4a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x4b, 0x63, 0x6f, 0x6d,
+		0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+		0x4c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0c, 0x4c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63,
+		0x65, 0x6e, 0x74, 0x04, 0x4c, 0x64, 0x6f, 0x74, 0x06, 0x4e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+		0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0c, 0x4e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63,
+		0x65, 0x6e, 0x74, 0x03, 0x45, 0x6e, 0x67, 0x06, 0x4f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x4f,
+		0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x4f, 0x6d, 0x61,
+		0x63, 0x72, 0x6f, 0x6e, 0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x52, 0x63, 0x61, 0x72,
+		0x6f, 0x6e, 0x0c, 0x52, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06,
+		0x53, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
+		0x65, 0x78, 0x0c, 0x53, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x04,
+		0x54, 0x62, 0x61, 0x72, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30,
+		0x31, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x41, 0x06, 0x55, 0x62, 0x72, 0x65,
+		0x76, 0x65, 0x0d, 0x55, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74,
+		0x07, 0x55, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b,
+		0x05, 0x55, 0x72, 0x69, 0x6e, 0x67, 0x06, 0x55, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x57, 0x61,
+		0x63, 0x75, 0x74, 0x65, 0x0b, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
+		0x09, 0x57, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76,
+		0x65, 0x0b, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x59, 0x67,
+		0x72, 0x61, 0x76, 0x65, 0x06, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x5a, 0x64, 0x6f, 0x74,
+		0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x61, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x61, 0x6d,
+		0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x61, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x63, 0x63,
+		0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a, 0x63, 0x64, 0x6f, 0x74, 0x61, 0x63,
+		0x63, 0x65, 0x6e, 0x74, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x65, 0x62, 0x72, 0x65,
+		0x76, 0x65, 0x06, 0x65, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0a, 0x65, 0x64, 0x6f, 0x74, 0x61, 0x63,
+		0x63, 0x65, 0x6e, 0x74, 0x07, 0x65, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x65, 0x6f, 0x67,
+		0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
+		0x0c, 0x67, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x67, 0x64,
+		0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x04, 0x68, 0x62, 0x61, 0x72, 0x0b, 0x68, 0x63,
+		0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x69, 0x62, 0x72, 0x65, 0x76, 0x65,
+		0x09, 0x69, 0x2e, 0x6c, 0x6f, 0x63, 0x6c, 0x54, 0x52, 0x4b, 0x02, 0x69, 0x6a, 0x07, 0x69, 0x6d,
+		0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x69, 0x74,
+		0x69, 0x6c, 0x64, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33, 0x37, 0x0b, 0x6a, 0x63, 0x69,
+		0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x6b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61,
+		0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x6c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6c, 0x63, 0x61,
+		0x72, 0x6f, 0x6e, 0x0c, 0x6c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
+		0x04, 0x6c, 0x64, 0x6f, 0x74, 0x06, 0x6e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6e, 0x63, 0x61,
+		0x72, 0x6f, 0x6e, 0x0c, 0x6e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
+		0x03, 0x65, 0x6e, 0x67, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x6f, 0x68, 0x75, 0x6e,
+		0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f,
+		0x6e, 0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0c,
+		0x72, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x73, 0x61, 0x63,
+		0x75, 0x74, 0x65, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c,
+		0x73, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x04, 0x74, 0x62, 0x61,
+		0x72, 0x06, 0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x36, 0x33,
+		0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x42, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d,
+		0x75, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6d,
+		0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x05, 0x75, 0x72,
+		0x69, 0x6e, 0x67, 0x06, 0x75, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x77, 0x61, 0x63, 0x75, 0x74,
+		0x65, 0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x09, 0x77, 0x64,
+		0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x77, 0x67, 0x72, 0x61, 0x76, 0x65, 0x0b, 0x79,
+		0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x79, 0x67, 0x72, 0x61, 0x76,
+		0x65, 0x06, 0x7a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x7a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63,
+		0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x39, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30,
+		0x33, 0x41, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30,
+		0x30, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30,
+		0x30, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x34, 0x09, 0x63, 0x6f, 0x6c, 0x6f,
+		0x6e, 0x2e, 0x61, 0x6c, 0x74, 0x09, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x2e, 0x61, 0x6c, 0x74, 0x0a,
+		0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x2e, 0x61, 0x6c, 0x74, 0x0d, 0x73, 0x65, 0x6d, 0x69, 0x63,
+		0x6f, 0x6c, 0x6f, 0x6e, 0x2e, 0x61, 0x6c, 0x74, 0x0d, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x69,
+		0x73, 0x2e, 0x61, 0x6c, 0x74, 0x31, 0x0d, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x69, 0x73, 0x2e,
+		0x61, 0x6c, 0x74, 0x32, 0x0d, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x69, 0x73, 0x2e, 0x61, 0x6c,
+		0x74, 0x33, 0x0d, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x69, 0x73, 0x2e, 0x61, 0x6c, 0x74, 0x34,
+		0x0d, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x69, 0x73, 0x2e, 0x61, 0x6c, 0x74, 0x35, 0x0a, 0x68,
+		0x79, 0x70, 0x68, 0x65, 0x6e, 0x2e, 0x61, 0x6c, 0x74, 0x0b, 0x65, 0x6d, 0x64, 0x61, 0x73, 0x68,
+		0x2e, 0x61, 0x6c, 0x74, 0x31, 0x0b, 0x65, 0x6d, 0x64, 0x61, 0x73, 0x68, 0x2e, 0x61, 0x6c, 0x74,
+		0x32, 0x0b, 0x65, 0x6d, 0x64, 0x61, 0x73, 0x68, 0x2e, 0x61, 0x6c, 0x74, 0x33, 0x0b, 0x65, 0x6d,
+		0x64, 0x61, 0x73, 0x68, 0x2e, 0x61, 0x6c, 0x74, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31,
+		0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41,
+		0x30, 0x04, 0x45, 0x75, 0x72, 0x6f, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x39, 0x06, 0x6d,
+		0x69, 0x6e, 0x75, 0x74, 0x65, 0x06, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x07, 0x75, 0x6e, 0x69,
+		0x30, 0x33, 0x32, 0x36, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x32, 0x36, 0x2e, 0x63, 0x61, 0x73,
+		0x65, 0x09, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x61, 0x6c, 0x74, 0x0a, 0x61, 0x63, 0x75, 0x74,
+		0x65, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x63, 0x61, 0x73,
+		0x65, 0x0a, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0c, 0x63, 0x65, 0x64,
+		0x69, 0x6c, 0x6c, 0x61, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0f, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
+		0x66, 0x6c, 0x65, 0x78, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0d, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73,
+		0x69, 0x73, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0e, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
+		0x74, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x63, 0x61, 0x73,
+		0x65, 0x11, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x2e, 0x63,
+		0x61, 0x73, 0x65, 0x0b, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0b,
+		0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x09, 0x72, 0x69, 0x6e, 0x67,
+		0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e, 0x63, 0x61, 0x73, 0x65,
+		0x00, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x9a,
+		0x00, 0x94, 0x00, 0x94, 0x04, 0xa3, 0x00, 0x00, 0x05, 0x2a, 0x03, 0x9c, 0x00, 0x00, 0xfe, 0x70,
+		0x07, 0x05, 0xfc, 0xb9, 0x04, 0xb9, 0xff, 0xea, 0x05, 0x2a, 0x03, 0xb2, 0xff, 0xea, 0xfe, 0x70,
+		0x07, 0x05, 0xfc, 0xb9, 0xb0, 0x00, 0x2c, 0x20, 0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20,
+		0x4b, 0xb8, 0x00, 0x0e, 0x51, 0x4b, 0xb0, 0x06, 0x53, 0x5a, 0x58, 0xb0, 0x34, 0x1b, 0xb0, 0x28,
+		0x59, 0x60, 0x66, 0x20, 0x8a, 0x55, 0x58, 0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00,
+		0x63, 0x63, 0x23, 0x62, 0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2,
+		0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x01, 0x2c, 0xb0, 0x20, 0x60, 0x66, 0x2d, 0xb0,
+		0x02, 0x2c, 0x20, 0x64, 0x20, 0xb0, 0xc0, 0x50, 0xb0, 0x04, 0x26, 0x5a, 0xb2, 0x28, 0x01, 0x0a,
+		0x43, 0x45, 0x63, 0x45, 0xb0, 0x06, 0x45, 0x58, 0x21, 0xb0, 0x03, 0x25, 0x59, 0x52, 0x5b, 0x58,
+		0x21, 0x23, 0x21, 0x1b, 0x8a, 0x58, 0x20, 0xb0, 0x50, 0x50, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b,
+		0x20, 0xb0, 0x38, 0x50, 0x58, 0x21, 0xb0, 0x38, 0x59, 0x59, 0x20, 0xb1, 0x01, 0x0a, 0x43, 0x45,
+		0x63, 0x45, 0x61, 0x64, 0xb0, 0x28, 0x50, 0x58, 0x21, 0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0x45,
+		0x20, 0xb0, 0x30, 0x50, 0x58, 0x21, 0xb0, 0x30, 0x59, 0x1b, 0x20, 0xb0, 0xc0, 0x50, 0x58, 0x20,
+		0x66, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x0a, 0x50, 0x58, 0x60, 0x1b, 0x20, 0xb0, 0x20, 0x50,
+		0x58, 0x21, 0xb0, 0x0a, 0x60, 0x1b, 0x20, 0xb0, 0x36, 0x50, 0x58, 0x21, 0xb0, 0x36, 0x60, 0x1b,
+		0x60, 0x59, 0x59, 0x59, 0x1b, 0xb0, 0x01, 0x2b, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65,
+		0x59, 0x59, 0x2d, 0xb0, 0x03, 0x2c, 0x20, 0x45, 0x20, 0xb0, 0x04, 0x25, 0x61, 0x64, 0x20, 0xb0,
+		0x05, 0x43, 0x50, 0x58, 0xb0, 0x05, 0x23, 0x42, 0xb0, 0x06, 0x23, 0x42, 0x1b, 0x21, 0x21, 0x59,
+		0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x04, 0x2c, 0x23, 0x21, 0x23, 0x21, 0x20, 0x64, 0xb1, 0x05, 0x62,
+		0x42, 0x20, 0xb0, 0x06, 0x23, 0x42, 0xb0, 0x06, 0x45, 0x58, 0x1b, 0xb1, 0x01, 0x0a, 0x43, 0x45,
+		0x63, 0xb1, 0x01, 0x0a, 0x43, 0xb0, 0x01, 0x60, 0x45, 0x63, 0xb0, 0x03, 0x2a, 0x21, 0x20, 0xb0,
+		0x06, 0x43, 0x20, 0x8a, 0x20, 0x8a, 0xb0, 0x01, 0x2b, 0xb1, 0x30, 0x05, 0x25, 0xb0, 0x04, 0x26,
+		0x51, 0x58, 0x60, 0x50, 0x1b, 0x61, 0x52, 0x59, 0x58, 0x23, 0x59, 0x21, 0x59, 0x20, 0xb0, 0x40,
+		0x53, 0x58, 0xb0, 0x01, 0x2b, 0x1b, 0x21, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65,
+		0x59, 0x2d, 0xb0, 0x05, 0x2c, 0xb0, 0x07, 0x43, 0x2b, 0xb2, 0x00, 0x02, 0x00, 0x43, 0x60, 0x42,
+		0x2d, 0xb0, 0x06, 0x2c, 0xb0, 0x07, 0x23, 0x42, 0x23, 0x20, 0xb0, 0x00, 0x23, 0x42, 0x61, 0xb0,
+		0x02, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x60, 0xb0, 0x05, 0x2a, 0x2d, 0xb0, 0x07, 0x2c,
+		0x20, 0x20, 0x45, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50,
+		0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0,
+		0x08, 0x2c, 0xb2, 0x07, 0x0b, 0x00, 0x43, 0x45, 0x42, 0x2a, 0x21, 0xb2, 0x00, 0x01, 0x00, 0x43,
+		0x60, 0x42, 0x2d, 0xb0, 0x09, 0x2c, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43,
+		0x60, 0x42, 0x2d, 0xb0, 0x0a, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00,
+		0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20, 0x64, 0x20, 0xb0, 0x20, 0x50,
+		0x58, 0x21, 0xb0, 0x00, 0x1b, 0xb0, 0x30, 0x50, 0x58, 0xb0, 0x20, 0x1b, 0xb0, 0x40, 0x59, 0x59,
+		0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01,
+		0x60, 0x2d, 0xb0, 0x0b, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43,
+		0xb0, 0x04, 0x25, 0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20, 0x64, 0xb0, 0x24, 0x50, 0x58, 0xb0,
+		0x00, 0x1b, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23,
+		0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0c, 0x2c, 0x20, 0xb0, 0x00, 0x23, 0x42, 0xb2,
+		0x0b, 0x0a, 0x03, 0x45, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x2a, 0x21, 0x2d, 0xb0, 0x0d, 0x2c,
+		0xb1, 0x02, 0x02, 0x45, 0xb0, 0x64, 0x61, 0x44, 0x2d, 0xb0, 0x0e, 0x2c, 0xb0, 0x01, 0x60, 0x20,
+		0x20, 0xb0, 0x0c, 0x43, 0x4a, 0xb0, 0x00, 0x50, 0x58, 0x20, 0xb0, 0x0c, 0x23, 0x42, 0x59, 0xb0,
+		0x0d, 0x43, 0x4a, 0xb0, 0x00, 0x52, 0x58, 0x20, 0xb0, 0x0d, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x0f,
+		0x2c, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23,
+		0x61, 0xb0, 0x0e, 0x43, 0x60, 0x20, 0x8a, 0x60, 0x20, 0xb0, 0x0e, 0x23, 0x42, 0x23, 0x2d, 0xb0,
+		0x10, 0x2c, 0x4b, 0x54, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x24, 0xb0, 0x0d, 0x65, 0x23, 0x78,
+		0x2d, 0xb0, 0x11, 0x2c, 0x4b, 0x51, 0x58, 0x4b, 0x53, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x1b,
+		0x21, 0x59, 0x24, 0xb0, 0x13, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x12, 0x2c, 0xb1, 0x00, 0x0f, 0x43,
+		0x55, 0x58, 0xb1, 0x0f, 0x0f, 0x43, 0xb0, 0x01, 0x61, 0x42, 0xb0, 0x0f, 0x2b, 0x59, 0xb0, 0x00,
+		0x43, 0xb0, 0x02, 0x25, 0x42, 0xb1, 0x0c, 0x02, 0x25, 0x42, 0xb1, 0x0d, 0x02, 0x25, 0x42, 0xb0,
+		0x01, 0x16, 0x23, 0x20, 0xb0, 0x03, 0x25, 0x50, 0x58, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04,
+		0x25, 0x42, 0x8a, 0x8a, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x23, 0xb0, 0x01, 0x61,
+		0x20, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x1b, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x02,
+		0x25, 0x42, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x59, 0xb0, 0x0c, 0x43, 0x47, 0xb0,
+		0x0d, 0x43, 0x47, 0x60, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
+		0x66, 0xb0, 0x01, 0x63, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00,
+		0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23,
+		0x44, 0xb0, 0x01, 0x43, 0xb0, 0x00, 0x3e, 0xb2, 0x01, 0x01, 0x01, 0x43, 0x60, 0x42, 0x2d, 0xb0,
+		0x13, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x0f, 0x23, 0x42, 0x20, 0x45, 0xb0,
+		0x0b, 0x23, 0x42, 0xb0, 0x0a, 0x23, 0xb0, 0x01, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5,
+		0x10, 0x10, 0x01, 0x00, 0x0e, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x12, 0x06, 0x2b, 0xb0, 0x75,
+		0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x14, 0x2c, 0xb1, 0x00, 0x13, 0x2b, 0x2d, 0xb0, 0x15, 0x2c,
+		0xb1, 0x01, 0x13, 0x2b, 0x2d, 0xb0, 0x16, 0x2c, 0xb1, 0x02, 0x13, 0x2b, 0x2d, 0xb0, 0x17, 0x2c,
+		0xb1, 0x03, 0x13, 0x2b, 0x2d, 0xb0, 0x18, 0x2c, 0xb1, 0x04, 0x13, 0x2b, 0x2d, 0xb0, 0x19, 0x2c,
+		0xb1, 0x05, 0x13, 0x2b, 0x2d, 0xb0, 0x1a, 0x2c, 0xb1, 0x06, 0x13, 0x2b, 0x2d, 0xb0, 0x1b, 0x2c,
+		0xb1, 0x07, 0x13, 0x2b, 0x2d, 0xb0, 0x1c, 0x2c, 0xb1, 0x08, 0x13, 0x2b, 0x2d, 0xb0, 0x1d, 0x2c,
+		0xb1, 0x09, 0x13, 0x2b, 0x2d, 0xb0, 0x29, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01,
+		0x63, 0xb0, 0x06, 0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x1b, 0x21, 0x21,
+		0x59, 0x2d, 0xb0, 0x2a, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x16,
+		0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x71, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0,
+		0x2b, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x26, 0x60, 0x4b, 0x54,
+		0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x72, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x1e, 0x2c, 0x00,
+		0xb0, 0x0d, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x0f, 0x23, 0x42, 0x20, 0x45, 0xb0,
+		0x0b, 0x23, 0x42, 0xb0, 0x0a, 0x23, 0xb0, 0x01, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5,
+		0x10, 0x10, 0x01, 0x00, 0x0e, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x12, 0x06, 0x2b, 0xb0, 0x75,
+		0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x1f, 0x2c, 0xb1, 0x00, 0x1e, 0x2b, 0x2d, 0xb0, 0x20, 0x2c,
+		0xb1, 0x01, 0x1e, 0x2b, 0x2d, 0xb0, 0x21, 0x2c, 0xb1, 0x02, 0x1e, 0x2b, 0x2d, 0xb0, 0x22, 0x2c,
+		0xb1, 0x03, 0x1e, 0x2b, 0x2d, 0xb0, 0x23, 0x2c, 0xb1, 0x04, 0x1e, 0x2b, 0x2d, 0xb0, 0x24, 0x2c,
+		0xb1, 0x05, 0x1e, 0x2b, 0x2d, 0xb0, 0x25, 0x2c, 0xb1, 0x06, 0x1e, 0x2b, 0x2d, 0xb0, 0x26, 0x2c,
+		0xb1, 0x07, 0x1e, 0x2b, 0x2d, 0xb0, 0x27, 0x2c, 0xb1, 0x08, 0x1e, 0x2b, 0x2d, 0xb0, 0x28, 0x2c,
+		0xb1, 0x09, 0x1e, 0x2b, 0x2d, 0xb0, 0x2c, 0x2c, 0x20, 0x3c, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x2d,
+		0x2c, 0x20, 0x60, 0xb0, 0x10, 0x60, 0x20, 0x43, 0x23, 0xb0, 0x01, 0x60, 0x43, 0xb0, 0x02, 0x25,
+		0x61, 0xb0, 0x01, 0x60, 0xb0, 0x2c, 0x2a, 0x21, 0x2d, 0xb0, 0x2e, 0x2c, 0xb0, 0x2d, 0x2b, 0xb0,
+		0x2d, 0x2a, 0x2d, 0xb0, 0x2f, 0x2c, 0x20, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8,
+		0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
+		0x60, 0x23, 0x61, 0x38, 0x23, 0x20, 0x8a, 0x55, 0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0b, 0x43,
+		0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+		0x01, 0x63, 0x60, 0x23, 0x61, 0x38, 0x1b, 0x21, 0x59, 0x2d, 0xb0, 0x30, 0x2c, 0x00, 0xb1, 0x00,
+		0x02, 0x45, 0x54, 0x58, 0xb0, 0x01, 0x16, 0xb0, 0x2f, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45, 0x58,
+		0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x31, 0x2c, 0x00, 0xb0, 0x0d, 0x2b, 0xb1, 0x00, 0x02,
+		0x45, 0x54, 0x58, 0xb0, 0x01, 0x16, 0xb0, 0x2f, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45, 0x58, 0x30,
+		0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x32, 0x2c, 0x20, 0x35, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x33,
+		0x2c, 0x00, 0xb0, 0x01, 0x45, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
+		0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04,
+		0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0,
+		0x01, 0x2b, 0xb0, 0x00, 0x16, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3e, 0x23, 0x38, 0xb1,
+		0x32, 0x01, 0x15, 0x2a, 0x2d, 0xb0, 0x34, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0b, 0x43,
+		0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+		0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0x38, 0x2d, 0xb0, 0x35, 0x2c, 0x2e, 0x17, 0x3c, 0x2d,
+		0xb0, 0x36, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62,
+		0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00,
+		0x43, 0x61, 0xb0, 0x01, 0x43, 0x63, 0x38, 0x2d, 0xb0, 0x37, 0x2c, 0xb1, 0x02, 0x00, 0x16, 0x25,
+		0x20, 0x2e, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb0, 0x02, 0x25, 0x49, 0x8a, 0x8a, 0x47, 0x23,
+		0x47, 0x23, 0x61, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0xb0, 0x01, 0x23, 0x42, 0xb2, 0x36, 0x01,
+		0x01, 0x15, 0x14, 0x2a, 0x2d, 0xb0, 0x38, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04,
+		0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x09, 0x43, 0x2b, 0x65, 0x8a, 0x2e, 0x23, 0x20, 0x20,
+		0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x39, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25,
+		0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0, 0x04, 0x23, 0x42, 0xb0, 0x09, 0x43, 0x2b,
+		0x20, 0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x02, 0x20, 0x03, 0x20, 0x1b,
+		0xb3, 0x02, 0x26, 0x03, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0xb0, 0x08, 0x43, 0x20, 0x8a, 0x23,
+		0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x46, 0x60, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0,
+		0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b,
+		0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x02, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x43, 0x61, 0x64,
+		0x50, 0x58, 0xb0, 0x02, 0x43, 0x61, 0x1b, 0xb0, 0x03, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0,
+		0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61,
+		0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x1b, 0x23, 0xb0, 0x08, 0x43, 0x46,
+		0xb0, 0x02, 0x25, 0xb0, 0x08, 0x43, 0x47, 0x23, 0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x04, 0x43,
+		0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
+		0x60, 0x23, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x04, 0x43, 0x60, 0xb0, 0x01, 0x2b, 0xb0, 0x05,
+		0x25, 0x61, 0xb0, 0x05, 0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
+		0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x04, 0x26, 0x61, 0x20, 0xb0, 0x04, 0x25, 0x60, 0x64, 0x23,
+		0xb0, 0x03, 0x25, 0x60, 0x64, 0x50, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x23, 0x20, 0x20, 0xb0,
+		0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x59, 0x2d, 0xb0, 0x3a, 0x2c, 0xb0, 0x00, 0x16, 0x20, 0x20,
+		0x20, 0xb0, 0x05, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x3c, 0x38, 0x2d, 0xb0,
+		0x3b, 0x2c, 0xb0, 0x00, 0x16, 0x20, 0xb0, 0x08, 0x23, 0x42, 0x20, 0x20, 0x20, 0x46, 0x23, 0x47,
+		0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x2d, 0xb0, 0x3c, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x03, 0x25,
+		0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x00, 0x54, 0x58, 0x2e, 0x20, 0x3c, 0x23,
+		0x21, 0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0, 0x05,
+		0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0x49,
+		0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x20, 0x58, 0x62, 0x1b,
+		0x21, 0x59, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
+		0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x23, 0x21, 0x59,
+		0x2d, 0xb0, 0x3d, 0x2c, 0xb0, 0x00, 0x16, 0x20, 0xb0, 0x08, 0x43, 0x20, 0x2e, 0x47, 0x23, 0x47,
+		0x23, 0x61, 0x20, 0x60, 0xb0, 0x20, 0x60, 0x66, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
+		0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0,
+		0x3e, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59, 0x2e,
+		0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x3f, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25,
+		0x46, 0x50, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x40, 0x2c,
+		0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59, 0x23, 0x20, 0x2e,
+		0x46, 0xb0, 0x02, 0x25, 0x46, 0x50, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b,
+		0x2d, 0xb0, 0x41, 0x2c, 0xb0, 0x38, 0x2b, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52,
+		0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x42, 0x2c, 0xb0, 0x39,
+		0x2b, 0x8a, 0x20, 0x20, 0x3c, 0xb0, 0x04, 0x23, 0x42, 0x8a, 0x38, 0x23, 0x20, 0x2e, 0x46, 0xb0,
+		0x02, 0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0xb0, 0x04,
+		0x43, 0x2e, 0xb0, 0x2e, 0x2b, 0x2d, 0xb0, 0x43, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0,
+		0x04, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x09, 0x43, 0x2b, 0x23, 0x20, 0x3c,
+		0x20, 0x2e, 0x23, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x44, 0x2c, 0xb1, 0x08, 0x04,
+		0x25, 0x42, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47,
+		0x23, 0x61, 0x20, 0xb0, 0x04, 0x23, 0x42, 0xb0, 0x09, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50, 0x58,
+		0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x02, 0x20, 0x03, 0x20, 0x1b, 0xb3, 0x02, 0x26, 0x03, 0x1a,
+		0x59, 0x42, 0x42, 0x23, 0x20, 0x47, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50,
+		0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a,
+		0x8a, 0x61, 0x20, 0xb0, 0x02, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x43, 0x61, 0x64, 0x50, 0x58,
+		0xb0, 0x02, 0x43, 0x61, 0x1b, 0xb0, 0x03, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62,
+		0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0xb0, 0x02,
+		0x25, 0x46, 0x61, 0x38, 0x23, 0x20, 0x3c, 0x23, 0x38, 0x1b, 0x21, 0x20, 0x20, 0x46, 0x23, 0x47,
+		0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x21, 0x59, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x45,
+		0x2c, 0xb0, 0x38, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x46, 0x2c, 0xb0, 0x39,
+		0x2b, 0x21, 0x23, 0x20, 0x20, 0x3c, 0xb0, 0x04, 0x23, 0x42, 0x23, 0x38, 0xb1, 0x2e, 0x01, 0x14,
+		0x2b, 0xb0, 0x04, 0x43, 0x2e, 0xb0, 0x2e, 0x2b, 0x2d, 0xb0, 0x47, 0x2c, 0xb0, 0x00, 0x15, 0x20,
+		0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0, 0x34, 0x2a,
+		0x2d, 0xb0, 0x48, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01,
+		0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0, 0x34, 0x2a, 0x2d, 0xb0, 0x49, 0x2c, 0xb1, 0x00, 0x01, 0x14,
+		0x13, 0xb0, 0x35, 0x2a, 0x2d, 0xb0, 0x4a, 0x2c, 0xb0, 0x37, 0x2a, 0x2d, 0xb0, 0x4b, 0x2c, 0xb0,
+		0x00, 0x16, 0x45, 0x23, 0x20, 0x2e, 0x20, 0x46, 0x8a, 0x23, 0x61, 0x38, 0xb1, 0x2e, 0x01, 0x14,
+		0x2b, 0x2d, 0xb0, 0x4c, 0x2c, 0xb0, 0x08, 0x23, 0x42, 0xb0, 0x4b, 0x2b, 0x2d, 0xb0, 0x4d, 0x2c,
+		0xb2, 0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb2, 0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0,
+		0x4f, 0x2c, 0xb2, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x50, 0x2c, 0xb2, 0x01, 0x01, 0x44, 0x2b,
+		0x2d, 0xb0, 0x51, 0x2c, 0xb2, 0x00, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x52, 0x2c, 0xb2, 0x00, 0x01,
+		0x45, 0x2b, 0x2d, 0xb0, 0x53, 0x2c, 0xb2, 0x01, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x54, 0x2c, 0xb2,
+		0x01, 0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x55, 0x2c, 0xb2, 0x00, 0x00, 0x41, 0x2b, 0x2d, 0xb0, 0x56,
+		0x2c, 0xb2, 0x00, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x57, 0x2c, 0xb2, 0x01, 0x00, 0x41, 0x2b, 0x2d,
+		0xb0, 0x58, 0x2c, 0xb2, 0x01, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x59, 0x2c, 0xb2, 0x00, 0x00, 0x43,
+		0x2b, 0x2d, 0xb0, 0x5a, 0x2c, 0xb2, 0x00, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5b, 0x2c, 0xb2, 0x01,
+		0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5c, 0x2c, 0xb2, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c,
+		0xb2, 0x00, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x5e, 0x2c, 0xb2, 0x00, 0x01, 0x46, 0x2b, 0x2d, 0xb0,
+		0x5f, 0x2c, 0xb2, 0x01, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x60, 0x2c, 0xb2, 0x01, 0x01, 0x46, 0x2b,
+		0x2d, 0xb0, 0x61, 0x2c, 0xb2, 0x00, 0x00, 0x42, 0x2b, 0x2d, 0xb0, 0x62, 0x2c, 0xb2, 0x00, 0x01,
+		0x42, 0x2b, 0x2d, 0xb0, 0x63, 0x2c, 0xb2, 0x01, 0x00, 0x42, 0x2b, 0x2d, 0xb0, 0x64, 0x2c, 0xb2,
+		0x01, 0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x65, 0x2c, 0xb0, 0x3a, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14,
+		0x2b, 0x2d, 0xb0, 0x66, 0x2c, 0xb0, 0x3a, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x67, 0x2c, 0xb0,
+		0x3a, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x68, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x3a, 0x2b, 0xb0,
+		0x40, 0x2b, 0x2d, 0xb0, 0x69, 0x2c, 0xb0, 0x3b, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d,
+		0xb0, 0x6a, 0x2c, 0xb0, 0x3b, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x6b, 0x2c, 0xb0, 0x3b, 0x2b,
+		0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x6c, 0x2c, 0xb0, 0x3b, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x6d,
+		0x2c, 0xb0, 0x3c, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x6e, 0x2c, 0xb0, 0x3c,
+		0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x6f, 0x2c, 0xb0, 0x3c, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0,
+		0x70, 0x2c, 0xb0, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x71, 0x2c, 0xb0, 0x3d, 0x2b, 0x2e,
+		0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x72, 0x2c, 0xb0, 0x3d, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d,
+		0xb0, 0x73, 0x2c, 0xb0, 0x3d, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x74, 0x2c, 0xb0, 0x3d, 0x2b,
+		0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x75, 0x2c, 0xb3, 0x09, 0x04, 0x02, 0x03, 0x45, 0x58, 0x21, 0x1b,
+		0x23, 0x21, 0x59, 0x42, 0x2b, 0xb0, 0x08, 0x65, 0xb0, 0x03, 0x24, 0x50, 0x78, 0xb1, 0x05, 0x01,
+		0x15, 0x45, 0x58, 0x30, 0x59, 0x2d, 0x00, 0x00, 0x00, 0x4b, 0xb8, 0x00, 0xc8, 0x52, 0x58, 0xb1,
+		0x01, 0x01, 0x8e, 0x59, 0xb0, 0x01, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x70, 0xb1, 0x00, 0x07,
+		0x42, 0xb2, 0x19, 0x01, 0x00, 0x2a, 0xb1, 0x00, 0x07, 0x42, 0xb3, 0x0c, 0x08, 0x01, 0x08, 0x2a,
+		0xb1, 0x00, 0x07, 0x42, 0xb3, 0x16, 0x06, 0x01, 0x08, 0x2a, 0xb1, 0x00, 0x08, 0x42, 0xba, 0x03,
+		0x40, 0x00, 0x01, 0x00, 0x09, 0x2a, 0xb1, 0x00, 0x09, 0x42, 0xba, 0x00, 0x40, 0x00, 0x01, 0x00,
+		0x09, 0x2a, 0xb1, 0x03, 0x00, 0x44, 0xb1, 0x24, 0x01, 0x88, 0x51, 0x58, 0xb0, 0x40, 0x88, 0x58,
+		0xb1, 0x03, 0x64, 0x44, 0xb1, 0x26, 0x01, 0x88, 0x51, 0x58, 0xba, 0x08, 0x80, 0x00, 0x01, 0x04,
+		0x40, 0x88, 0x63, 0x54, 0x58, 0xb1, 0x03, 0x00, 0x44, 0x59, 0x59, 0x59, 0x59, 0xb3, 0x0e, 0x08,
+		0x01, 0x0c, 0x2a, 0xb8, 0x01, 0xff, 0x85, 0xb0, 0x04, 0x8d, 0xb1, 0x02, 0x00, 0x44, 0xb3, 0x05,
+		0x64, 0x06, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	};
+	const std::size_t CourierPrimeCodeSize = sizeof( CourierPrimeCode );
+
+	const unsigned char Inconsolata[ ] =
+	{
+		0x4f, 0x54, 0x54, 0x4f, 0x00, 0x0b, 0x00, 0x80, 0x00, 0x03, 0x00, 0x30, 0x43, 0x46, 0x46, 0x20,
+		0x34, 0x92, 0x40, 0x7d, 0x00, 0x00, 0x0a, 0x10, 0x00, 0x00, 0xd5, 0x0e, 0x46, 0x46, 0x54, 0x4d,
+		0x46, 0xd1, 0x47, 0x9e, 0x00, 0x00, 0xe4, 0xa4, 0x00, 0x00, 0x00, 0x1c, 0x47, 0x44, 0x45, 0x46,
+		0x00, 0x27, 0x01, 0x6d, 0x00, 0x00, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x1e, 0x4f, 0x53, 0x2f, 0x32,
+		0x5d, 0x96, 0xcf, 0x1b, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+		0xcf, 0xbf, 0xb6, 0x54, 0x00, 0x00, 0x05, 0x30, 0x00, 0x00, 0x04, 0xbe, 0x68, 0x65, 0x61, 0x64,
+		0xe6, 0xef, 0x55, 0x6a, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+		0x05, 0x9c, 0x02, 0x54, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+		0x42, 0x04, 0x46, 0xd2, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x05, 0x64, 0x6d, 0x61, 0x78, 0x70,
+		0x01, 0x67, 0x50, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x06, 0x6e, 0x61, 0x6d, 0x65,
+		0x86, 0x96, 0x58, 0x0e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xae, 0x70, 0x6f, 0x73, 0x74,
+		0xff, 0x9f, 0x00, 0x32, 0x00, 0x00, 0x09, 0xf0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
+		0x00, 0x01, 0x02, 0x4d, 0x9b, 0x31, 0x04, 0xbe, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0b, 0x03, 0xe8,
+		0x00, 0x00, 0x00, 0x00, 0xc2, 0xe9, 0x87, 0xd3, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xe9, 0x87, 0xd3,
+		0x00, 0x00, 0xff, 0x50, 0x01, 0xfd, 0x03, 0x42, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x42, 0xff, 0x50, 0x00, 0x5a, 0x01, 0xf4,
+		0x00, 0x00, 0xff, 0xc4, 0x01, 0xfd, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x00, 0x00, 0x50, 0x00, 0x01, 0x67, 0x00, 0x00,
+		0x00, 0x03, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x05, 0x00, 0x08, 0x02, 0x8a, 0x02, 0xbc, 0x00, 0x00,
+		0x00, 0x8c, 0x02, 0x8a, 0x02, 0xbc, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x31, 0x01, 0x02, 0x00, 0x00,
+		0x02, 0x0b, 0x06, 0x09, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x2f, 0x00, 0x00,
+		0x01, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x66, 0x45, 0x64, 0x00, 0x00,
+		0x00, 0x20, 0x24, 0x23, 0x03, 0x34, 0xff, 0x4c, 0x00, 0x00, 0x03, 0x42, 0x00, 0xb0, 0x40, 0x00,
+		0x00, 0x13, 0x85, 0xd4, 0x00, 0x00, 0x01, 0xc8, 0x02, 0x6f, 0x00, 0x20, 0x00, 0x20, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x0e, 0x00, 0xae, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b,
+		0x01, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0xec, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x02, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x27, 0x02, 0x5d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b,
+		0x02, 0x9d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x02, 0xcb, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0b, 0x02, 0xf4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+		0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x16,
+		0x01, 0xd4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0c, 0x01, 0xf8, 0x00, 0x03,
+		0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x4e, 0x02, 0x0d, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+		0x00, 0x04, 0x00, 0x16, 0x02, 0x85, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x20,
+		0x02, 0xa9, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x16, 0x02, 0xdc, 0x00, 0x43,
+		0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62,
+		0x00, 0x79, 0x00, 0x20, 0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x68, 0x00, 0x20, 0x00, 0x4c,
+		0x00, 0x65, 0x00, 0x76, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73,
+		0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20,
+		0x00, 0x6f, 0x00, 0x77, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6c,
+		0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f,
+		0x00, 0x6e, 0x00, 0x74, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x65, 0x00, 0x2e,
+		0x00, 0x20, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67,
+		0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x36, 0x00, 0x20,
+		0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x68, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x76,
+		0x00, 0x69, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x6c,
+		0x00, 0x65, 0x00, 0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e,
+		0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20,
+		0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e,
+		0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69,
+		0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x68,
+		0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63,
+		0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69,
+		0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x46,
+		0x00, 0x4c, 0x00, 0x2e, 0x00, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79,
+		0x20, 0x52, 0x61, 0x70, 0x68, 0x20, 0x4c, 0x65, 0x76, 0x69, 0x65, 0x6e, 0x20, 0x75, 0x73, 0x69,
+		0x6e, 0x67, 0x20, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73,
+		0x20, 0x61, 0x6e, 0x64, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x46, 0x6f, 0x72, 0x67, 0x65, 0x2e, 0x20,
+		0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 0x36, 0x20, 0x52,
+		0x61, 0x70, 0x68, 0x20, 0x4c, 0x65, 0x76, 0x69, 0x65, 0x6e, 0x2e, 0x20, 0x52, 0x65, 0x6c, 0x65,
+		0x61, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53,
+		0x49, 0x4c, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63,
+		0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x73, 0x63, 0x72,
+		0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46, 0x4c,
+		0x2e, 0x00, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x6f,
+		0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x49, 0x6e, 0x63, 0x6f, 0x6e, 0x73,
+		0x6f, 0x6c, 0x61, 0x74, 0x61, 0x00, 0x00, 0x4d, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75,
+		0x00, 0x6d, 0x00, 0x00, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x00, 0x00, 0x46, 0x00, 0x6f, 0x00,
+		0x6e, 0x00, 0x74, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x65, 0x00, 0x20, 0x00,
+		0x32, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x20, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00,
+		0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00,
+		0x61, 0x00, 0x20, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x31, 0x00, 0x35, 0x00, 0x2d, 0x00, 0x38, 0x00,
+		0x2d, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0x00, 0x00, 0x46, 0x6f, 0x6e, 0x74, 0x46,
+		0x6f, 0x72, 0x67, 0x65, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x3a, 0x20, 0x49, 0x6e, 0x63, 0x6f, 0x6e,
+		0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61, 0x20, 0x3a, 0x20, 0x31, 0x35, 0x2d, 0x38, 0x2d, 0x32, 0x30,
+		0x30, 0x37, 0x00, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00,
+		0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x49, 0x6e, 0x63, 0x6f, 0x6e,
+		0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61, 0x00, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00,
+		0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x2e, 0x00,
+		0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x20, 0x00, 0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
+		0x20, 0x30, 0x30, 0x31, 0x2e, 0x30, 0x30, 0x39, 0x20, 0x00, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x63,
+		0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61,
+		0x00, 0x00, 0x49, 0x6e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x02, 0xb4, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x02, 0x98,
+		0x00, 0x00, 0x00, 0x4c, 0x00, 0x40, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x7e, 0x00, 0xff, 0x01, 0x07,
+		0x01, 0x11, 0x01, 0x1b, 0x01, 0x1f, 0x01, 0x31, 0x01, 0x3a, 0x01, 0x3e, 0x01, 0x44, 0x01, 0x48,
+		0x01, 0x4b, 0x01, 0x4d, 0x01, 0x55, 0x01, 0x5b, 0x01, 0x65, 0x01, 0x71, 0x01, 0x7e, 0x01, 0x92,
+		0x02, 0x37, 0x02, 0xc7, 0x02, 0xc9, 0x02, 0xcb, 0x02, 0xdd, 0x20, 0x1a, 0x20, 0x1e, 0x20, 0x22,
+		0x20, 0x26, 0x20, 0x3a, 0x20, 0x44, 0x20, 0x74, 0x20, 0xac, 0x21, 0x22, 0x21, 0x91, 0x21, 0x93,
+		0x22, 0x12, 0x24, 0x23, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa0, 0x01, 0x02, 0x01, 0x0c,
+		0x01, 0x18, 0x01, 0x1e, 0x01, 0x30, 0x01, 0x38, 0x01, 0x3d, 0x01, 0x41, 0x01, 0x47, 0x01, 0x4a,
+		0x01, 0x4d, 0x01, 0x50, 0x01, 0x58, 0x01, 0x5e, 0x01, 0x6e, 0x01, 0x78, 0x01, 0x92, 0x02, 0x37,
+		0x02, 0xc6, 0x02, 0xc9, 0x02, 0xcb, 0x02, 0xd8, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x20, 0x20, 0x26,
+		0x20, 0x39, 0x20, 0x44, 0x20, 0x74, 0x20, 0xac, 0x21, 0x22, 0x21, 0x91, 0x21, 0x93, 0x22, 0x12,
+		0x24, 0x23, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xca, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0xff, 0x14, 0x00, 0x00, 0xfe, 0x3e,
+		0xfe, 0x38, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x32, 0x00, 0x00, 0xe1, 0x2b, 0xe0, 0xd8, 0xe1, 0x15,
+		0xe0, 0xe4, 0xdf, 0xf8, 0xe0, 0x43, 0xdf, 0xc1, 0xdf, 0xc0, 0xde, 0xee, 0xdd, 0x31, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x4a, 0x01, 0x08, 0x01, 0x12, 0x01, 0x1c, 0x01, 0x22, 0x01, 0x24, 0x01, 0x26,
+		0x01, 0x2a, 0x01, 0x2c, 0x01, 0x32, 0x01, 0x34, 0x00, 0x00, 0x01, 0x34, 0x01, 0x3e, 0x01, 0x44,
+		0x01, 0x52, 0x01, 0x58, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5e,
+		0x01, 0x68, 0x00, 0x00, 0x01, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0xa1,
+		0x00, 0xa2, 0x00, 0xa3, 0x01, 0x18, 0x00, 0xa5, 0x01, 0x19, 0x00, 0xa7, 0x01, 0x0a, 0x00, 0xa9,
+		0x00, 0xaa, 0x00, 0xab, 0x00, 0xac, 0x00, 0xad, 0x00, 0xae, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0xb1,
+		0x00, 0xb2, 0x00, 0xb3, 0x01, 0x04, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x01, 0x0d, 0x00, 0xb9,
+		0x00, 0xba, 0x00, 0xbb, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c, 0x00, 0xbf, 0x00, 0xc0, 0x00, 0xc1,
+		0x00, 0xc2, 0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9,
+		0x00, 0xca, 0x00, 0xcb, 0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xcf, 0x00, 0xd0, 0x00, 0xd1,
+		0x00, 0xd2, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xd6, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9,
+		0x00, 0xda, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xde, 0x00, 0xdf, 0x00, 0xe0, 0x00, 0xe1,
+		0x00, 0xe2, 0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xe9,
+		0x00, 0xea, 0x00, 0xeb, 0x00, 0xec, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf0, 0x00, 0xf1,
+		0x00, 0xf2, 0x00, 0xf3, 0x00, 0xf4, 0x00, 0xf5, 0x00, 0xf6, 0x00, 0xf7, 0x00, 0xf8, 0x00, 0xf9,
+		0x00, 0xfa, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfe, 0x00, 0xff, 0x01, 0x26, 0x01, 0x36,
+		0x01, 0x1d, 0x01, 0x35, 0x01, 0x28, 0x01, 0x41, 0x01, 0x29, 0x01, 0x37, 0x01, 0x2c, 0x01, 0x38,
+		0x01, 0x2d, 0x01, 0x5b, 0x01, 0x2a, 0x01, 0x39, 0x01, 0x2b, 0x01, 0x48, 0x01, 0x5c, 0x01, 0x56,
+		0x01, 0x5d, 0x01, 0x10, 0x01, 0x4a, 0x01, 0x27, 0x01, 0x3b, 0x01, 0x1f, 0x01, 0x3a, 0x01, 0x1e,
+		0x01, 0x47, 0x01, 0x2e, 0x01, 0x3c, 0x01, 0x2f, 0x01, 0x3d, 0x01, 0x5a, 0x01, 0x4c, 0x01, 0x30,
+		0x01, 0x3e, 0x00, 0xbc, 0x00, 0xbd, 0x01, 0x25, 0x01, 0x5e, 0x01, 0x31, 0x01, 0x3f, 0x01, 0x20,
+		0x01, 0x40, 0x01, 0x21, 0x01, 0x42, 0x00, 0xa6, 0x00, 0xa8, 0x01, 0x34, 0x01, 0x43, 0x01, 0x22,
+		0x01, 0x5f, 0x01, 0x32, 0x01, 0x44, 0x01, 0x33, 0x01, 0x45, 0x00, 0xbe, 0x01, 0x23, 0x01, 0x60,
+		0x01, 0x24, 0x01, 0x46, 0x00, 0xb4, 0x00, 0xb8, 0x01, 0x05, 0x01, 0x0f, 0x01, 0x08, 0x01, 0x09,
+		0x01, 0x0c, 0x01, 0x0e, 0x01, 0x06, 0x01, 0x0b, 0x01, 0x02, 0x01, 0x01, 0x01, 0x4d, 0x01, 0x63,
+		0x01, 0x64, 0x01, 0x61, 0x00, 0x06, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+		0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
+		0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
+		0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
+		0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40,
+		0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
+		0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50,
+		0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58,
+		0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60,
+		0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68,
+		0x00, 0x69, 0x00, 0x6a, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x70,
+		0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78,
+		0x00, 0x79, 0x00, 0x7a, 0x00, 0x7b, 0x00, 0x7c, 0x00, 0x7d, 0x00, 0x7e, 0x00, 0x00, 0x00, 0xc4,
+		0x00, 0xc5, 0x00, 0xc7, 0x00, 0xc9, 0x00, 0xd1, 0x00, 0xd6, 0x00, 0xdc, 0x00, 0xe1, 0x00, 0xe0,
+		0x00, 0xe2, 0x00, 0xe4, 0x00, 0xe3, 0x00, 0xe5, 0x00, 0xe7, 0x00, 0xe9, 0x00, 0xe8, 0x00, 0xea,
+		0x00, 0xeb, 0x00, 0xed, 0x00, 0xec, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf1, 0x00, 0xf3, 0x00, 0xf2,
+		0x00, 0xf4, 0x00, 0xf6, 0x00, 0xf5, 0x00, 0xfa, 0x00, 0xf9, 0x00, 0xfb, 0x00, 0xfc, 0x01, 0x63,
+		0x00, 0xb0, 0x00, 0xa2, 0x00, 0xa3, 0x00, 0xa7, 0x01, 0x61, 0x00, 0xb6, 0x00, 0xdf, 0x00, 0xae,
+		0x00, 0xa9, 0x01, 0x65, 0x01, 0x04, 0x01, 0x0a, 0x00, 0x00, 0x00, 0xc6, 0x00, 0xd8, 0x00, 0x00,
+		0x00, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xba, 0x00, 0x00, 0x00, 0xe6, 0x00, 0xf8, 0x00, 0xbf,
+		0x00, 0xa1, 0x00, 0xac, 0x00, 0x00, 0x01, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x00, 0xbb,
+		0x01, 0x51, 0x00, 0xa0, 0x00, 0xc0, 0x00, 0xc3, 0x00, 0xd5, 0x00, 0xbc, 0x00, 0xbd, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x02, 0x01, 0x01, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xff,
+		0x00, 0xbe, 0x01, 0x59, 0x00, 0xa4, 0x01, 0x11, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64,
+		0x00, 0xb7, 0x01, 0x4d, 0x01, 0x50, 0x00, 0x00, 0x00, 0xc2, 0x00, 0xca, 0x00, 0xc1, 0x00, 0xcb,
+		0x00, 0xc8, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xcf, 0x00, 0xcc, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0x00,
+		0x00, 0xd2, 0x00, 0xda, 0x00, 0xdb, 0x00, 0xd9, 0x01, 0x10, 0x01, 0x05, 0x01, 0x06, 0x00, 0xaf,
+		0x01, 0x08, 0x01, 0x09, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0b, 0x01, 0x0e, 0x01, 0x0f, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x0c, 0x49, 0x6e, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+		0x6c, 0x61, 0x74, 0x61, 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0x49, 0xf8, 0xa6, 0x00, 0xf8, 0xa7,
+		0x01, 0xf8, 0xa8, 0x02, 0xf8, 0xa9, 0x03, 0xf8, 0x17, 0x04, 0x1d, 0x00, 0x40, 0x04, 0x44, 0x0d,
+		0x8a, 0xfb, 0x45, 0xf8, 0x92, 0xf9, 0xd7, 0x05, 0xfa, 0x91, 0xd8, 0x1d, 0x6a, 0x1e, 0x67, 0x37,
+		0x1d, 0x00, 0xab, 0xe2, 0x41, 0x0e, 0x1d, 0x00, 0x00, 0x06, 0xca, 0x0f, 0x1d, 0x00, 0x00, 0x00,
+		0x00, 0x10, 0x1d, 0x00, 0x00, 0x09, 0x97, 0x11, 0x1d, 0x00, 0x00, 0x00, 0x27, 0x1d, 0x00, 0x00,
+		0xad, 0x8b, 0x12, 0x00, 0x8f, 0x02, 0x00, 0x01, 0x00, 0x09, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21,
+		0x00, 0x29, 0x00, 0x31, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x52, 0x00, 0x5b, 0x00, 0x64,
+		0x00, 0x6d, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x91, 0x00, 0x9a, 0x00, 0xa3, 0x00, 0xac,
+		0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xd9, 0x00, 0xe2, 0x00, 0xeb, 0x00, 0xf4,
+		0x00, 0xfd, 0x01, 0x06, 0x01, 0x0f, 0x01, 0x19, 0x01, 0x23, 0x01, 0x2d, 0x01, 0x37, 0x01, 0x41,
+		0x01, 0x4b, 0x01, 0x55, 0x01, 0x5f, 0x01, 0x69, 0x01, 0x73, 0x01, 0x7d, 0x01, 0x87, 0x01, 0x91,
+		0x01, 0x9b, 0x01, 0xa5, 0x01, 0xaf, 0x01, 0xb9, 0x01, 0xc3, 0x01, 0xcd, 0x01, 0xd7, 0x01, 0xe1,
+		0x01, 0xeb, 0x01, 0xf5, 0x01, 0xff, 0x02, 0x09, 0x02, 0x13, 0x02, 0x1d, 0x02, 0x27, 0x02, 0x31,
+		0x02, 0x3b, 0x02, 0x45, 0x02, 0x4f, 0x02, 0x59, 0x02, 0x69, 0x02, 0x6d, 0x02, 0x77, 0x02, 0x7e,
+		0x02, 0x85, 0x02, 0x8a, 0x02, 0x91, 0x02, 0x98, 0x02, 0x9f, 0x02, 0xad, 0x02, 0xb6, 0x02, 0xbf,
+		0x02, 0xc8, 0x02, 0xcf, 0x02, 0xd6, 0x02, 0xdc, 0x02, 0xe2, 0x02, 0xea, 0x02, 0xf0, 0x02, 0xf6,
+		0x03, 0x00, 0x03, 0x06, 0x03, 0x0c, 0x03, 0x12, 0x03, 0x18, 0x03, 0x1e, 0x03, 0x25, 0x03, 0x2b,
+		0x03, 0x31, 0x03, 0x37, 0x03, 0x3d, 0x03, 0x43, 0x03, 0x50, 0x03, 0x56, 0x03, 0x5b, 0x03, 0x68,
+		0x03, 0x70, 0x03, 0x77, 0x03, 0x7d, 0x03, 0x83, 0x03, 0x89, 0x03, 0x90, 0x03, 0x96, 0x03, 0x9c,
+		0x03, 0xa2, 0x03, 0xa8, 0x03, 0xb5, 0x03, 0xbb, 0x03, 0xc1, 0x03, 0xc7, 0x03, 0xcf, 0x03, 0xd7,
+		0x03, 0xdc, 0x03, 0xe9, 0x03, 0xed, 0x03, 0xf3, 0x03, 0xfd, 0x04, 0x09, 0x04, 0x11, 0x04, 0x14,
+		0x04, 0x1b, 0x04, 0x24, 0x04, 0x30, 0x04, 0x37, 0x04, 0x3d, 0x04, 0x4d, 0x04, 0x54, 0x04, 0x57,
+		0x04, 0x5d, 0x04, 0x63, 0x04, 0x6d, 0x04, 0x73, 0x04, 0x79, 0x04, 0x7f, 0x04, 0x8b, 0x04, 0x92,
+		0x05, 0x2d, 0x05, 0x38, 0x05, 0x43, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x33, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x34, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x35, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x36, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x37, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x38, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x39, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x30, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x31,
+		0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x32, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e,
+		0x31, 0x33, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x4e, 0x61, 0x6d, 0x65, 0x4d,
+		0x65, 0x2e, 0x31, 0x35, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x36, 0x4e, 0x61, 0x6d,
+		0x65, 0x4d, 0x65, 0x2e, 0x31, 0x37, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x38, 0x4e,
+		0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x39, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32,
+		0x30, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32, 0x31, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65,
+		0x2e, 0x32, 0x32, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32, 0x33, 0x4e, 0x61, 0x6d, 0x65,
+		0x4d, 0x65, 0x2e, 0x32, 0x34, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32, 0x35, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32, 0x36, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32, 0x37,
+		0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x32, 0x38, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e,
+		0x32, 0x39, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x33, 0x30, 0x4e, 0x61, 0x6d, 0x65, 0x4d,
+		0x65, 0x2e, 0x33, 0x31, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x32, 0x37, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x32, 0x38, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31,
+		0x32, 0x39, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x33, 0x30, 0x4e, 0x61, 0x6d, 0x65,
+		0x4d, 0x65, 0x2e, 0x31, 0x33, 0x31, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x33, 0x32,
+		0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x33, 0x33, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65,
+		0x2e, 0x31, 0x33, 0x34, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x33, 0x35, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x33, 0x36, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31,
+		0x33, 0x37, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x33, 0x38, 0x4e, 0x61, 0x6d, 0x65,
+		0x4d, 0x65, 0x2e, 0x31, 0x33, 0x39, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x30,
+		0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x31, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65,
+		0x2e, 0x31, 0x34, 0x32, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x33, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x34, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31,
+		0x34, 0x35, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x36, 0x4e, 0x61, 0x6d, 0x65,
+		0x4d, 0x65, 0x2e, 0x31, 0x34, 0x37, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x38,
+		0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x34, 0x39, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65,
+		0x2e, 0x31, 0x35, 0x30, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x35, 0x31, 0x4e, 0x61,
+		0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x35, 0x32, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31,
+		0x35, 0x33, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x35, 0x34, 0x4e, 0x61, 0x6d, 0x65,
+		0x4d, 0x65, 0x2e, 0x31, 0x35, 0x35, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x35, 0x36,
+		0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x35, 0x37, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65,
+		0x2e, 0x31, 0x35, 0x38, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x31, 0x35, 0x39, 0x6e, 0x6f,
+		0x6e, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x70, 0x61, 0x63, 0x65, 0x65, 0x75,
+		0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x75, 0x6e, 0x69, 0x30,
+		0x30, 0x42, 0x32, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x33, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x75,
+		0x6e, 0x69, 0x30, 0x30, 0x42, 0x39, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x42, 0x75, 0x6e, 0x69,
+		0x30, 0x32, 0x43, 0x39, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x63,
+		0x61, 0x70, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x63, 0x61, 0x70, 0x67, 0x72, 0x61, 0x76, 0x65,
+		0x2e, 0x63, 0x61, 0x70, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x63, 0x61, 0x70, 0x6f, 0x6d, 0x61,
+		0x63, 0x72, 0x6f, 0x6e, 0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x4c, 0x63, 0x61, 0x72, 0x6f,
+		0x6e, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65, 0x53, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x54,
+		0x63, 0x61, 0x72, 0x6f, 0x6e, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x5a, 0x64, 0x6f, 0x74, 0x61,
+		0x63, 0x63, 0x65, 0x6e, 0x74, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x41, 0x62, 0x72, 0x65, 0x76,
+		0x65, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x43, 0x61, 0x63, 0x75, 0x74, 0x65, 0x43, 0x63, 0x61,
+		0x72, 0x6f, 0x6e, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e,
+		0x44, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x4e, 0x61, 0x63, 0x75,
+		0x74, 0x65, 0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75,
+		0x6d, 0x6c, 0x61, 0x75, 0x74, 0x52, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x55, 0x72, 0x69, 0x6e, 0x67,
+		0x55, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x54, 0x63, 0x65,
+		0x64, 0x69, 0x6c, 0x6c, 0x61, 0x61, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x61, 0x62, 0x72, 0x65,
+		0x76, 0x65, 0x63, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x65, 0x6f,
+		0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x6c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x6c, 0x61, 0x63, 0x75, 0x74,
+		0x65, 0x6e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x6e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x6f, 0x68, 0x75,
+		0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e,
+		0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x61, 0x63, 0x75, 0x74, 0x65, 0x73, 0x63, 0x65, 0x64,
+		0x69, 0x6c, 0x6c, 0x61, 0x74, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x75, 0x72, 0x69, 0x6e,
+		0x67, 0x75, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x7a, 0x64,
+		0x6f, 0x74, 0x65, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x65, 0x2e, 0x33,
+		0x32, 0x39, 0x6b, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x69, 0x63, 0x64, 0x6f,
+		0x74, 0x6c, 0x65, 0x73, 0x73, 0x6a, 0x65, 0x6e, 0x67, 0x75, 0x70, 0x61, 0x72, 0x72, 0x6f, 0x77,
+		0x64, 0x6f, 0x77, 0x6e, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65,
+		0x73, 0x70, 0x61, 0x63, 0x65, 0x72, 0x2e, 0x73, 0x65, 0x72, 0x69, 0x66, 0x67, 0x62, 0x72, 0x65,
+		0x76, 0x65, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x2e, 0x63,
+		0x61, 0x70, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x34, 0x45, 0x6e, 0x67, 0x64, 0x63, 0x72, 0x6f,
+		0x61, 0x74, 0x47, 0x62, 0x72, 0x65, 0x76, 0x65, 0x49, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65,
+		0x6e, 0x74, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x7a, 0x61,
+		0x63, 0x75, 0x74, 0x65, 0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x6e, 0x6f, 0x73, 0x6c, 0x61, 0x73, 0x68,
+		0x30, 0x30, 0x31, 0x2e, 0x30, 0x30, 0x39, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62,
+		0x79, 0x20, 0x52, 0x61, 0x70, 0x68, 0x20, 0x4c, 0x65, 0x76, 0x69, 0x65, 0x6e, 0x20, 0x75, 0x73,
+		0x69, 0x6e, 0x67, 0x20, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
+		0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x46, 0x6f, 0x72, 0x67, 0x65, 0x2e,
+		0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 0x36, 0x20,
+		0x52, 0x61, 0x70, 0x68, 0x20, 0x4c, 0x65, 0x76, 0x69, 0x65, 0x6e, 0x2e, 0x20, 0x52, 0x65, 0x6c,
+		0x65, 0x61, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+		0x53, 0x49, 0x4c, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69,
+		0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x73, 0x63,
+		0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46,
+		0x4c, 0x2e, 0x49, 0x6e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61, 0x49, 0x6e, 0x63,
+		0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x01, 0x87, 0x01, 0x88, 0x01,
+		0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x01, 0x90, 0x01,
+		0x91, 0x01, 0x92, 0x01, 0x93, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01,
+		0x99, 0x01, 0x9a, 0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0, 0x01,
+		0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00,
+		0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x68, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00,
+		0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00,
+		0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00,
+		0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00,
+		0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00,
+		0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00,
+		0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00,
+		0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x7c, 0x00, 0x42, 0x00, 0x43, 0x00,
+		0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00,
+		0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00,
+		0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00,
+		0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01,
+		0xaa, 0x01, 0xab, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01,
+		0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb7, 0x01, 0xb8, 0x01, 0xb9, 0x01,
+		0xba, 0x01, 0xbb, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe, 0x01, 0xbf, 0x01, 0xc0, 0x01, 0xc1, 0x01,
+		0xc2, 0x01, 0xc3, 0x01, 0xc4, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xc7, 0x00, 0x60, 0x00, 0x61, 0x00,
+		0x62, 0x01, 0xc8, 0x00, 0x64, 0x00, 0xc0, 0x00, 0x66, 0x00, 0xdd, 0x00, 0xaa, 0x00, 0x8b, 0x00,
+		0x6a, 0x00, 0x97, 0x01, 0xc9, 0x00, 0xa5, 0x00, 0x80, 0x00, 0xa1, 0x00, 0x9c, 0x01, 0xca, 0x01,
+		0xcb, 0x00, 0xc7, 0x01, 0xcc, 0x00, 0x73, 0x00, 0x72, 0x00, 0xe4, 0x01, 0xcd, 0x00, 0x8f, 0x00,
+		0x78, 0x00, 0x8e, 0x00, 0x94, 0x00, 0xc6, 0x00, 0x7b, 0x00, 0xae, 0x00, 0xab, 0x00, 0xac, 0x00,
+		0xb0, 0x00, 0xad, 0x00, 0xaf, 0x00, 0x8a, 0x00, 0xb1, 0x00, 0xb5, 0x00, 0xb2, 0x00, 0xb3, 0x00,
+		0xb4, 0x00, 0xb9, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb8, 0x00, 0x9a, 0x00, 0xba, 0x00, 0xbe, 0x00,
+		0xbb, 0x00, 0xbc, 0x00, 0xbf, 0x00, 0xbd, 0x00, 0xa8, 0x00, 0x8d, 0x00, 0xc4, 0x00, 0xc1, 0x00,
+		0xc2, 0x00, 0xc3, 0x00, 0xc5, 0x00, 0x9d, 0x00, 0x95, 0x00, 0xcb, 0x00, 0xc8, 0x00, 0xc9, 0x00,
+		0xcd, 0x00, 0xca, 0x00, 0xcc, 0x00, 0x90, 0x00, 0xce, 0x00, 0xd2, 0x00, 0xcf, 0x00, 0xd0, 0x00,
+		0xd1, 0x00, 0xd6, 0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xa7, 0x00, 0xd7, 0x00, 0xdb, 0x00,
+		0xd8, 0x00, 0xd9, 0x00, 0xdc, 0x00, 0xda, 0x00, 0x9f, 0x00, 0x93, 0x00, 0xe1, 0x00, 0xde, 0x00,
+		0xdf, 0x00, 0xe0, 0x00, 0xe2, 0x00, 0xa2, 0x00, 0xe3, 0x00, 0xa6, 0x00, 0x08, 0x00, 0x41, 0x01,
+		0xce, 0x00, 0x7d, 0x00, 0x7e, 0x00, 0x7f, 0x01, 0xcf, 0x00, 0x81, 0x00, 0x82, 0x00, 0x83, 0x00,
+		0x86, 0x00, 0x84, 0x00, 0x85, 0x00, 0x87, 0x00, 0x88, 0x00, 0x91, 0x00, 0x6b, 0x00, 0x6c, 0x01,
+		0xd0, 0x01, 0xd1, 0x01, 0xd2, 0x01, 0xd3, 0x01, 0xd4, 0x00, 0x67, 0x00, 0xa0, 0x00, 0x9e, 0x00,
+		0x9b, 0x00, 0xa3, 0x01, 0xd5, 0x00, 0x8c, 0x01, 0xd6, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xd9, 0x01,
+		0xda, 0x01, 0xdb, 0x01, 0xdc, 0x01, 0xdd, 0x01, 0xde, 0x01, 0xdf, 0x01, 0xe0, 0x01, 0xe1, 0x01,
+		0xe2, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x01, 0xe9, 0x01,
+		0xea, 0x01, 0xeb, 0x01, 0xec, 0x01, 0xed, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf1, 0x01,
+		0xf2, 0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf6, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01,
+		0xfa, 0x01, 0xfb, 0x01, 0xfc, 0x01, 0xfd, 0x00, 0x92, 0x01, 0xfe, 0x01, 0xff, 0x02, 0x00, 0x02,
+		0x01, 0x02, 0x02, 0x00, 0x75, 0x00, 0x69, 0x00, 0x77, 0x00, 0x76, 0x00, 0x79, 0x02, 0x03, 0x02,
+		0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x00, 0x63, 0x02, 0x0a, 0x02,
+		0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x0f, 0x02, 0x10, 0x00, 0x74, 0x00, 0x65, 0x00,
+		0x70, 0x00, 0x71, 0x00, 0x99, 0x02, 0x11, 0x01, 0x67, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05,
+		0x00, 0x08, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x11, 0x00, 0x14, 0x00, 0x17, 0x00, 0x1a, 0x00, 0x1d,
+		0x00, 0x20, 0x00, 0x23, 0x00, 0x26, 0x00, 0x29, 0x00, 0x2c, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x35,
+		0x00, 0x38, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x41, 0x00, 0x44, 0x00, 0x47, 0x00, 0x4a, 0x00, 0x4d,
+		0x00, 0x50, 0x00, 0x53, 0x00, 0x56, 0x00, 0x59, 0x00, 0x5c, 0x00, 0x5f, 0x00, 0x60, 0x01, 0x81,
+		0x01, 0x97, 0x02, 0xdd, 0x05, 0xc8, 0x07, 0x5f, 0x09, 0x91, 0x09, 0x9f, 0x0a, 0x6a, 0x0a, 0xeb,
+		0x0b, 0xa3, 0x0b, 0xb1, 0x0b, 0xbf, 0x0b, 0xcd, 0x0b, 0xdb, 0x0c, 0x06, 0x0d, 0x1a, 0x0d, 0x6f,
+		0x0e, 0xc5, 0x10, 0x68, 0x10, 0xcb, 0x11, 0xea, 0x13, 0x84, 0x14, 0x21, 0x15, 0xb4, 0x17, 0x6c,
+		0x17, 0x82, 0x17, 0x9d, 0x17, 0xde, 0x17, 0xf9, 0x18, 0x3a, 0x19, 0x87, 0x1b, 0x81, 0x1b, 0x9c,
+		0x1d, 0x4b, 0x1d, 0x59, 0x1d, 0x74, 0x1d, 0x82, 0x1d, 0xbc, 0x1d, 0xca, 0x1e, 0x71, 0x1e, 0x7f,
+		0x1f, 0x72, 0x20, 0x3a, 0x20, 0x48, 0x20, 0xab, 0x20, 0xb4, 0x20, 0xcf, 0x21, 0xda, 0x23, 0x7c,
+		0x23, 0x97, 0x23, 0xa5, 0x23, 0xb3, 0x23, 0xc1, 0x24, 0x02, 0x24, 0x77, 0x24, 0xe6, 0x24, 0xf4,
+		0x25, 0x02, 0x25, 0x32, 0x25, 0x5d, 0x25, 0x8d, 0x25, 0xd2, 0x25, 0xee, 0x26, 0xb1, 0x26, 0xcc,
+		0x28, 0x29, 0x28, 0x37, 0x29, 0xd3, 0x29, 0xee, 0x2b, 0x18, 0x2b, 0x40, 0x2c, 0x76, 0x2c, 0x91,
+		0x2c, 0xfb, 0x2d, 0xd8, 0x2d, 0xe6, 0x2f, 0x7e, 0x2f, 0x87, 0x2f, 0xa2, 0x30, 0x37, 0x31, 0x4d,
+		0x31, 0x5b, 0x31, 0x69, 0x31, 0x77, 0x31, 0x85, 0x32, 0x3a, 0x33, 0x17, 0x33, 0x86, 0x33, 0x94,
+		0x33, 0xa2, 0x35, 0xbf, 0x35, 0xdb, 0x37, 0xf9, 0x38, 0xa6, 0x38, 0xa9, 0x38, 0xac, 0x38, 0xae,
+		0x38, 0xb0, 0x38, 0xb2, 0x38, 0xb4, 0x38, 0xb6, 0x38, 0xb8, 0x38, 0xba, 0x38, 0xbc, 0x38, 0xbe,
+		0x38, 0xc0, 0x38, 0xc2, 0x38, 0xc4, 0x38, 0xc6, 0x38, 0xc8, 0x38, 0xca, 0x38, 0xcc, 0x38, 0xce,
+		0x38, 0xd0, 0x38, 0xd2, 0x38, 0xd4, 0x38, 0xd6, 0x38, 0xd8, 0x38, 0xda, 0x38, 0xdc, 0x38, 0xde,
+		0x38, 0xe1, 0x38, 0xe4, 0x38, 0xe7, 0x38, 0xea, 0x38, 0xed, 0x38, 0xf0, 0x38, 0xf1, 0x3a, 0x12,
+		0x3b, 0xf2, 0x3e, 0x05, 0x40, 0x2e, 0x40, 0xd8, 0x40, 0xf3, 0x43, 0xc6, 0x43, 0xe1, 0x44, 0xf9,
+		0x46, 0xcb, 0x46, 0xe6, 0x47, 0x0c, 0x47, 0x1a, 0x48, 0x44, 0x48, 0x52, 0x49, 0x0b, 0x49, 0x34,
+		0x4a, 0x8a, 0x4c, 0x24, 0x4c, 0x3f, 0x4d, 0xcd, 0x4e, 0x4d, 0x4e, 0x5b, 0x4e, 0x76, 0x4e, 0xcb,
+		0x4f, 0x91, 0x4f, 0xe7, 0x51, 0x7c, 0x54, 0x5d, 0x54, 0x85, 0x55, 0xd2, 0x55, 0xfa, 0x56, 0x22,
+		0x56, 0x4a, 0x56, 0x72, 0x56, 0xa7, 0x57, 0xac, 0x58, 0x44, 0x5a, 0x78, 0x5a, 0x93, 0x5a, 0xae,
+		0x5a, 0xc9, 0x5a, 0xf1, 0x5b, 0x0c, 0x5b, 0x27, 0x5b, 0x42, 0x5b, 0x6a, 0x5b, 0x85, 0x5b, 0xa0,
+		0x5b, 0xc8, 0x5b, 0xf0, 0x5c, 0x18, 0x5c, 0x40, 0x5c, 0x75, 0x5c, 0xf0, 0x5e, 0xee, 0x5f, 0x09,
+		0x5f, 0x24, 0x5f, 0x3f, 0x5f, 0x67, 0x5f, 0x82, 0x60, 0xe6, 0x62, 0xa3, 0x62, 0xcb, 0x62, 0xf3,
+		0x63, 0x1b, 0x63, 0x43, 0x63, 0x78, 0x63, 0xad, 0x66, 0xc9, 0x68, 0xc2, 0x68, 0xea, 0x69, 0x12,
+		0x69, 0x3a, 0x69, 0x6f, 0x69, 0x8a, 0x69, 0xa5, 0x69, 0xc0, 0x69, 0xe8, 0x6b, 0x88, 0x6b, 0xa3,
+		0x6b, 0xcb, 0x6b, 0xf3, 0x6c, 0x1b, 0x6c, 0x43, 0x6c, 0x78, 0x6d, 0x3e, 0x6e, 0xd7, 0x6e, 0xf2,
+		0x6f, 0x0d, 0x6f, 0x28, 0x6f, 0x50, 0x6f, 0x6b, 0x70, 0x14, 0x70, 0x3c, 0x70, 0x4a, 0x70, 0x58,
+		0x70, 0x66, 0x70, 0x74, 0x70, 0x82, 0x70, 0x90, 0x70, 0x9e, 0x70, 0xac, 0x70, 0xba, 0x70, 0xc8,
+		0x70, 0xe3, 0x70, 0xfe, 0x71, 0x19, 0x72, 0x1f, 0x72, 0xfe, 0x73, 0x0c, 0x73, 0x1a, 0x73, 0x28,
+		0x73, 0x36, 0x73, 0x44, 0x73, 0x89, 0x73, 0x97, 0x73, 0xa5, 0x73, 0xcd, 0x75, 0x7c, 0x75, 0xae,
+		0x75, 0xe3, 0x77, 0x53, 0x79, 0x14, 0x7a, 0x43, 0x7a, 0xff, 0x7b, 0xd4, 0x7b, 0xef, 0x7e, 0xee,
+		0x7f, 0x09, 0x7f, 0x24, 0x7f, 0x3f, 0x7f, 0x67, 0x7f, 0x8f, 0x7f, 0xaa, 0x7f, 0xc5, 0x7f, 0xe0,
+		0x81, 0x02, 0x81, 0x1d, 0x81, 0x45, 0x81, 0x60, 0x81, 0x7b, 0x81, 0x96, 0x81, 0xcb, 0x81, 0xf3,
+		0x82, 0x1b, 0x82, 0x43, 0x83, 0x7b, 0x85, 0x9b, 0x85, 0xc3, 0x85, 0xde, 0x87, 0xfa, 0x89, 0x80,
+		0x8a, 0x55, 0x8a, 0x70, 0x8a, 0x8b, 0x8a, 0xa6, 0x8a, 0xdb, 0x8a, 0xf6, 0x8b, 0x11, 0x8b, 0x2c,
+		0x8e, 0x27, 0x90, 0x7e, 0x90, 0xa6, 0x90, 0xce, 0x90, 0xe9, 0x91, 0x8a, 0x91, 0xb2, 0x91, 0xb5,
+		0x92, 0xa8, 0x92, 0xb6, 0x94, 0x5e, 0x94, 0x6c, 0x94, 0x82, 0x94, 0x98, 0x94, 0xae, 0x94, 0xcc,
+		0x95, 0x23, 0x95, 0x7a, 0x95, 0xaa, 0x96, 0x9c, 0x96, 0xd1, 0x96, 0xec, 0x97, 0x4f, 0x97, 0x5d,
+		0x99, 0x02, 0x9a, 0xc7, 0x9a, 0xe2, 0x9a, 0xfd, 0x9b, 0x18, 0x9b, 0xed, 0x9c, 0x08, 0x9c, 0x65,
+		0x9e, 0x6c, 0x9e, 0xb0, 0x9f, 0x1d, 0x9f, 0xbe, 0xa1, 0x22, 0x0e, 0xf8, 0x1b, 0x0e, 0xf8, 0x13,
+		0x0e, 0xf8, 0x0a, 0x0e, 0xf8, 0x02, 0x0e, 0xf7, 0xf9, 0x0e, 0xf7, 0xf0, 0x0e, 0xf7, 0xe8, 0x0e,
+		0xf7, 0xdf, 0x0e, 0xf7, 0xd6, 0x0e, 0xf7, 0xce, 0x0e, 0xf7, 0xc5, 0x0e, 0xf7, 0xbc, 0x0e, 0xf7,
+		0xb4, 0x0e, 0xf7, 0xab, 0x0e, 0xf7, 0xa3, 0x0e, 0xf7, 0x9a, 0x0e, 0xf7, 0x91, 0x0e, 0xf7, 0x89,
+		0x0e, 0xf7, 0x80, 0x0e, 0xf7, 0x77, 0x0e, 0xf7, 0x6f, 0x0e, 0xf7, 0x66, 0x0e, 0xf7, 0x5e, 0x0e,
+		0xf7, 0x55, 0x0e, 0xf7, 0x4c, 0x0e, 0xf7, 0x44, 0x0e, 0xf7, 0x3b, 0x0e, 0xf7, 0x32, 0x0e, 0xf7,
+		0x2a, 0x0e, 0xf7, 0x21, 0x0e, 0xf7, 0x19, 0x0e, 0x0e, 0xff, 0x01, 0x2a, 0x99, 0x80, 0xff, 0x00,
+		0x2f, 0xe3, 0x80, 0x15, 0xff, 0x00, 0x20, 0xa0, 0x80, 0xff, 0xff, 0xe5, 0x7d, 0x80, 0xff, 0x00,
+		0x1a, 0x7f, 0x80, 0xff, 0xff, 0xdf, 0x5f, 0x80, 0xff, 0xff, 0xdf, 0x5d, 0x40, 0xff, 0xff, 0xe5,
+		0x80, 0x00, 0xff, 0xff, 0xe5, 0x7e, 0x00, 0xff, 0xff, 0xdf, 0x62, 0x80, 0xff, 0xff, 0xdf, 0x5f,
+		0x80, 0xff, 0x00, 0x1a, 0x82, 0x80, 0xff, 0xff, 0xe5, 0x80, 0xc0, 0xff, 0x00, 0x20, 0xa0, 0x80,
+		0xff, 0x00, 0x20, 0xa3, 0x00, 0xff, 0x00, 0x1a, 0x7f, 0xc0, 0xff, 0x00, 0x1a, 0x82, 0x40, 0xff,
+		0x00, 0x20, 0x9d, 0x00, 0x1e, 0xff, 0xff, 0xc6, 0x69, 0x80, 0xff, 0x02, 0x6c, 0x13, 0x00, 0x15,
+		0xff, 0xff, 0xee, 0xae, 0x00, 0x8b, 0xff, 0xff, 0xee, 0x65, 0x40, 0xff, 0xff, 0xf5, 0x67, 0x00,
+		0xff, 0xff, 0xf7, 0x13, 0x80, 0xff, 0xff, 0xea, 0x82, 0x40, 0xff, 0xff, 0xfb, 0x69, 0x00, 0xff,
+		0xff, 0xf4, 0xf2, 0xc0, 0xff, 0xff, 0xfd, 0xc6, 0x40, 0xff, 0xff, 0xf2, 0x82, 0x00, 0x8b, 0xff,
+		0xff, 0xed, 0x44, 0x00, 0x8b, 0xff, 0xff, 0xdf, 0xba, 0x80, 0xff, 0x00, 0x06, 0x60, 0xc0, 0xff,
+		0xff, 0xe7, 0xb7, 0x80, 0xff, 0x00, 0x03, 0x7d, 0x80, 0xff, 0xff, 0xbe, 0x4b, 0x40, 0x08, 0xff,
+		0x00, 0x0e, 0xab, 0xc0, 0xff, 0xfe, 0xeb, 0xd7, 0x00, 0xff, 0x00, 0x32, 0x0e, 0x00, 0x8b, 0xff,
+		0x00, 0x12, 0x1f, 0x80, 0xff, 0x01, 0x14, 0x29, 0x00, 0x05, 0xff, 0x00, 0x02, 0x7f, 0x40, 0xff,
+		0x00, 0x26, 0x12, 0x80, 0xff, 0x00, 0x06, 0xc9, 0xc0, 0xff, 0x00, 0x25, 0xda, 0x80, 0x8b, 0xff,
+		0x00, 0x26, 0x34, 0xc0, 0x8b, 0xff, 0x00, 0x17, 0x82, 0x00, 0xff, 0xff, 0xfd, 0xb2, 0x80, 0xff,
+		0x00, 0x0b, 0x34, 0xc0, 0xff, 0xff, 0xfe, 0x7e, 0x40, 0xff, 0x00, 0x05, 0xe8, 0x80, 0xff, 0xff,
+		0xf8, 0x48, 0x80, 0xff, 0x00, 0x1e, 0x47, 0x80, 0xff, 0xff, 0xea, 0xf5, 0x00, 0xff, 0x00, 0x0c,
+		0x98, 0x40, 0xff, 0xff, 0xed, 0x3b, 0x40, 0x8b, 0x08, 0x0e, 0xff, 0x01, 0x8c, 0xb2, 0x40, 0xff,
+		0x02, 0x5c, 0xa9, 0x00, 0x15, 0x20, 0x0a, 0xff, 0xff, 0x53, 0x66, 0x80, 0x16, 0x20, 0x0a, 0x0e,
+		0xff, 0x00, 0xad, 0x76, 0x80, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xff, 0xeb, 0xf1, 0x00,
+		0xff, 0xff, 0x56, 0x74, 0x40, 0xff, 0xff, 0x90, 0xe2, 0x00, 0xff, 0xff, 0xfe, 0xac, 0x00, 0xff,
+		0xff, 0xfc, 0x8c, 0x40, 0xff, 0xff, 0xd0, 0x89, 0x00, 0xff, 0x00, 0x6c, 0xec, 0xc0, 0xff, 0x00,
+		0x01, 0x16, 0xc0, 0xff, 0xff, 0xeb, 0xdd, 0xc0, 0xff, 0xff, 0x55, 0xd2, 0x00, 0xff, 0xff, 0x9d,
+		0xb7, 0x40, 0xff, 0xff, 0xfe, 0x37, 0x80, 0xff, 0xff, 0xfb, 0xaf, 0x80, 0xff, 0xff, 0xd2, 0x42,
+		0xc0, 0xff, 0x00, 0x61, 0x29, 0x80, 0xff, 0x00, 0x01, 0x92, 0x40, 0xff, 0xff, 0xea, 0xc8, 0x00,
+		0xff, 0xff, 0x4c, 0xa6, 0x80, 0xff, 0x00, 0x3a, 0xaf, 0x40, 0xff, 0x00, 0x02, 0x96, 0xc0, 0xff,
+		0x00, 0x15, 0x86, 0x80, 0xff, 0x00, 0xb1, 0xb6, 0x80, 0xff, 0x00, 0x6e, 0xbc, 0x80, 0xff, 0x00,
+		0x01, 0xca, 0x40, 0xff, 0xff, 0xea, 0x33, 0xc0, 0xff, 0xff, 0x49, 0x0b, 0xc0, 0xff, 0x00, 0x3c,
+		0x69, 0x00, 0xff, 0x00, 0x03, 0x73, 0x80, 0xff, 0x00, 0x16, 0x0c, 0x40, 0xff, 0x00, 0xb4, 0x7b,
+		0x80, 0x05, 0xff, 0x00, 0x63, 0xa2, 0x80, 0xff, 0x00, 0x01, 0x9c, 0x80, 0xff, 0x00, 0x05, 0x2d,
+		0x80, 0xff, 0x00, 0x2e, 0x9a, 0x00, 0xff, 0xff, 0x9c, 0xdb, 0x80, 0xff, 0xff, 0xfe, 0x33, 0x80,
+		0xff, 0x00, 0x14, 0x8f, 0x40, 0xff, 0x00, 0xa8, 0x4e, 0x40, 0xff, 0x00, 0x5b, 0x87, 0x40, 0xff,
+		0x00, 0x00, 0xea, 0x40, 0xff, 0x00, 0x05, 0x2d, 0x80, 0xff, 0x00, 0x30, 0x54, 0x00, 0xff, 0xff,
+		0xa5, 0x2d, 0x40, 0xff, 0xff, 0xfe, 0xea, 0x40, 0xff, 0x00, 0x14, 0x0e, 0xc0, 0xff, 0x00, 0xa4,
+		0x31, 0x40, 0xff, 0xff, 0xc1, 0xdd, 0x40, 0xff, 0xff, 0xfd, 0x69, 0x40, 0xff, 0xff, 0xec, 0xa8,
+		0x40, 0xff, 0xff, 0x5d, 0xa9, 0x40, 0xff, 0xff, 0x91, 0xd7, 0x40, 0xff, 0xff, 0xfe, 0xaf, 0x40,
+		0xff, 0x00, 0x14, 0xc3, 0x80, 0xff, 0x00, 0xab, 0x6b, 0xc0, 0x05, 0xff, 0xff, 0xe5, 0x71, 0x80,
+		0xff, 0xff, 0x24, 0xc1, 0xc0, 0x15, 0xff, 0x00, 0x6e, 0x3a, 0x80, 0xff, 0x00, 0x01, 0x1a, 0x40,
+		0xff, 0xff, 0xeb, 0xe3, 0x80, 0xff, 0xff, 0x57, 0x34, 0x00, 0xff, 0xff, 0x91, 0x53, 0xc0, 0xff,
+		0xff, 0xfd, 0xfd, 0xc0, 0x05, 0x0e, 0xff, 0x00, 0xea, 0xbc, 0x80, 0xff, 0x02, 0x8a, 0xb3, 0xc0,
+		0x15, 0xff, 0xff, 0xc4, 0x18, 0x80, 0x07, 0xff, 0xff, 0xa3, 0xd6, 0x40, 0xff, 0xff, 0xf4, 0x1e,
+		0x00, 0xff, 0xff, 0xc0, 0xae, 0xc0, 0xff, 0xff, 0xc2, 0xef, 0x80, 0x8b, 0xff, 0xff, 0xb8, 0x03,
+		0x40, 0x8b, 0xff, 0xff, 0xdb, 0x96, 0x00, 0xff, 0x00, 0x10, 0x8b, 0x40, 0xff, 0xff, 0xc7, 0xad,
+		0x00, 0xff, 0x00, 0x54, 0x11, 0x80, 0xff, 0xff, 0xd8, 0x43, 0x00, 0x9d, 0xff, 0xff, 0xf7, 0x7e,
+		0x00, 0xff, 0x00, 0x12, 0x9d, 0x00, 0xff, 0xff, 0xf9, 0x0c, 0x00, 0xff, 0x00, 0x12, 0x41, 0x40,
+		0xff, 0xff, 0xf9, 0xe3, 0xc0, 0x08, 0xff, 0xff, 0x24, 0x32, 0x00, 0x07, 0xff, 0xff, 0xcb, 0x6d,
+		0x40, 0xff, 0x00, 0x05, 0xd7, 0x40, 0xff, 0xff, 0xd4, 0x16, 0xc0, 0xff, 0x00, 0x19, 0x7a, 0x40,
+		0xff, 0xff, 0xe3, 0xec, 0xc0, 0xff, 0x00, 0x1d, 0xe0, 0x00, 0xff, 0xff, 0xfc, 0x2a, 0x40, 0xff,
+		0x00, 0x04, 0x14, 0x80, 0xff, 0x00, 0x00, 0x85, 0xc0, 0xff, 0x00, 0x02, 0xb2, 0x40, 0xff, 0x00,
+		0x00, 0x3b, 0xc0, 0xff, 0x00, 0x04, 0x5f, 0x40, 0xff, 0x00, 0x00, 0x11, 0x40, 0xff, 0x00, 0x01,
+		0x40, 0x80, 0xff, 0x00, 0x00, 0x7a, 0x80, 0xff, 0x00, 0x05, 0xc1, 0x00, 0xff, 0xff, 0xfb, 0x0d,
+		0xc0, 0xff, 0x00, 0x02, 0x41, 0x80, 0x08, 0xff, 0xff, 0xd4, 0xd9, 0x80, 0xff, 0xff, 0xc4, 0x74,
+		0x00, 0x05, 0xff, 0x00, 0x2c, 0x82, 0x00, 0xff, 0xff, 0xcf, 0xba, 0x40, 0xff, 0x00, 0x3d, 0xc1,
+		0x00, 0xff, 0xff, 0xe4, 0xe1, 0x00, 0xff, 0x00, 0x44, 0xed, 0x80, 0xff, 0xff, 0xfb, 0xb2, 0x40,
+		0x08, 0xff, 0xff, 0xc3, 0x07, 0x40, 0xff, 0x00, 0x3a, 0xaf, 0x00, 0xff, 0x00, 0x3e, 0xd1, 0x40,
+		0x07, 0xff, 0x00, 0x71, 0x3b, 0x40, 0xff, 0x00, 0x0e, 0xc3, 0x40, 0xff, 0x00, 0x35, 0x25, 0x40,
+		0xff, 0x00, 0x4e, 0xcb, 0xc0, 0x8b, 0xff, 0x00, 0x47, 0xb8, 0x40, 0x8b, 0xff, 0x00, 0x5b, 0x50,
+		0x00, 0xff, 0xff, 0xb0, 0xde, 0xc0, 0xff, 0x00, 0x21, 0xe9, 0x00, 0xff, 0xff, 0xea, 0xf0, 0x80,
+		0xff, 0x00, 0x09, 0x0f, 0x80, 0xff, 0xff, 0xeb, 0x47, 0xc0, 0xff, 0x00, 0x08, 0xe9, 0x80, 0xff,
+		0xff, 0xe9, 0x26, 0xc0, 0xff, 0x00, 0x07, 0xbf, 0xc0, 0xff, 0xff, 0xe9, 0x61, 0xc0, 0xff, 0x00,
+		0x07, 0x97, 0x00, 0x08, 0xff, 0x00, 0xc0, 0x96, 0xc0, 0x07, 0xff, 0x00, 0x2b, 0x52, 0x00, 0xff,
+		0xff, 0xf9, 0x79, 0x40, 0xff, 0x00, 0x1e, 0xcc, 0x40, 0xff, 0xff, 0xed, 0x5d, 0xc0, 0xff, 0x00,
+		0x14, 0xc8, 0x40, 0xff, 0xff, 0xe6, 0xca, 0x80, 0xff, 0x00, 0x03, 0x1c, 0x80, 0xff, 0xff, 0xfc,
+		0x3a, 0x00, 0xff, 0x00, 0x00, 0xaf, 0xc0, 0xff, 0xff, 0xfe, 0xeb, 0x80, 0xff, 0x00, 0x00, 0x70,
+		0x00, 0xff, 0xff, 0xff, 0x18, 0x80, 0xff, 0x00, 0x01, 0x7a, 0x40, 0xff, 0xff, 0xfc, 0xf1, 0x40,
+		0xff, 0xff, 0xff, 0x44, 0x00, 0xff, 0xff, 0xfd, 0x3c, 0x00, 0xff, 0x00, 0x00, 0x3a, 0x40, 0xff,
+		0xff, 0xfd, 0x1b, 0x40, 0xff, 0x00, 0x00, 0x5a, 0x00, 0xff, 0xff, 0xfb, 0x89, 0x40, 0xff, 0x00,
+		0x02, 0xb2, 0x40, 0xff, 0xff, 0xfe, 0x17, 0x40, 0xff, 0x00, 0x02, 0x21, 0xc0, 0xff, 0xff, 0xff,
+		0x71, 0x00, 0x08, 0xff, 0x00, 0x2b, 0x26, 0x80, 0xff, 0x00, 0x36, 0x5e, 0x80, 0x05, 0xff, 0xff,
+		0xdb, 0x47, 0x00, 0xff, 0x00, 0x2b, 0xd6, 0xc0, 0xff, 0xff, 0xcb, 0x5f, 0xc0, 0xff, 0x00, 0x1a,
+		0x9b, 0xc0, 0xff, 0xff, 0xc4, 0xe9, 0x80, 0xff, 0x00, 0x05, 0xf4, 0x40, 0x08, 0xff, 0x00, 0x26,
+		0x60, 0xc0, 0x07, 0x8b, 0xff, 0x00, 0x09, 0x9a, 0x80, 0xff, 0x00, 0x06, 0xc0, 0xc0, 0xff, 0x00,
+		0x00, 0x49, 0xc0, 0x8b, 0xff, 0x00, 0x07, 0x68, 0x80, 0x8b, 0xff, 0x00, 0x01, 0x2e, 0x80, 0xff,
+		0xff, 0xff, 0xc2, 0x00, 0xff, 0x00, 0x01, 0x29, 0x80, 0xff, 0xff, 0xff, 0x87, 0xc0, 0xff, 0x00,
+		0x01, 0x11, 0x80, 0x08, 0xff, 0xff, 0xf9, 0xf5, 0x80, 0xff, 0xfe, 0x86, 0xbd, 0x00, 0x15, 0xff,
+		0x00, 0x13, 0xf3, 0x80, 0xff, 0xff, 0xf9, 0xb6, 0x40, 0xff, 0x00, 0x11, 0xc0, 0x00, 0xff, 0xff,
+		0xf9, 0xc8, 0xc0, 0xff, 0x00, 0x0d, 0xbb, 0x80, 0xff, 0xff, 0xf8, 0x88, 0x00, 0xff, 0x00, 0x29,
+		0xfb, 0x80, 0xff, 0xff, 0xe9, 0x2a, 0x80, 0xff, 0x00, 0x07, 0xaa, 0x40, 0xff, 0xff, 0xde, 0xbb,
+		0x00, 0x8b, 0xff, 0xff, 0xeb, 0x77, 0xc0, 0x8b, 0xff, 0xff, 0xd2, 0xd4, 0x00, 0xff, 0xff, 0xdb,
+		0x0e, 0x00, 0xff, 0xff, 0xd2, 0xd4, 0xc0, 0xff, 0xff, 0xbf, 0xdd, 0x40, 0xff, 0xff, 0xf3, 0x97,
+		0x40, 0x08, 0xff, 0xff, 0xc5, 0x51, 0x00, 0xff, 0x01, 0x1e, 0xbc, 0x00, 0x15, 0xff, 0xff, 0xf3,
+		0x31, 0x80, 0xff, 0x00, 0x05, 0x1d, 0xc0, 0xff, 0xff, 0xf4, 0x20, 0xc0, 0xff, 0x00, 0x05, 0x69,
+		0x40, 0xff, 0xff, 0xf5, 0xa8, 0x80, 0xff, 0x00, 0x05, 0xf5, 0x00, 0xff, 0xff, 0xd3, 0xec, 0xc0,
+		0xff, 0x00, 0x19, 0x62, 0x00, 0xff, 0xff, 0xf5, 0xb2, 0x00, 0xff, 0x00, 0x1d, 0xf8, 0x40, 0x8b,
+		0xff, 0x00, 0x15, 0xd0, 0xc0, 0x8b, 0xff, 0x00, 0x22, 0x93, 0x00, 0xff, 0x00, 0x1a, 0x83, 0x40,
+		0xff, 0x00, 0x25, 0x7a, 0x00, 0xff, 0x00, 0x3e, 0xe3, 0x40, 0xff, 0x00, 0x07, 0x59, 0x00, 0x08,
+		0x0e, 0xff, 0x01, 0x86, 0xf0, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0xff, 0xfe, 0xa6, 0xcc,
+		0xc0, 0xff, 0xfd, 0x90, 0xea, 0x00, 0xff, 0x00, 0x3f, 0xdc, 0x80, 0x8b, 0xff, 0x01, 0x5c, 0xa7,
+		0x00, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x05, 0xff, 0xfe, 0xc1, 0x78, 0x80, 0xff, 0x00, 0x0b, 0x4f,
+		0x80, 0x15, 0xff, 0xff, 0xc4, 0x92, 0x40, 0xff, 0xff, 0xcc, 0x0e, 0x40, 0xff, 0xff, 0xc9, 0xfe,
+		0x80, 0xff, 0xff, 0xb3, 0x20, 0x00, 0xff, 0xff, 0xb5, 0x51, 0x80, 0xff, 0x00, 0x32, 0xe8, 0x40,
+		0xff, 0xff, 0xc7, 0xf7, 0x80, 0xff, 0x00, 0x3d, 0x5e, 0xc0, 0xff, 0x00, 0x3c, 0xe8, 0x40, 0xff,
+		0x00, 0x32, 0x99, 0x40, 0xff, 0x00, 0x37, 0x5a, 0x80, 0xff, 0x00, 0x4a, 0x46, 0x00, 0xff, 0x00,
+		0x4c, 0x41, 0xc0, 0xff, 0xff, 0xcc, 0x7d, 0xc0, 0xff, 0x00, 0x37, 0xb6, 0x40, 0xff, 0xff, 0xc3,
+		0x19, 0x40, 0x1f, 0xff, 0xff, 0xfe, 0xa4, 0x40, 0xff, 0xff, 0xcb, 0x45, 0x00, 0x15, 0xff, 0x00,
+		0x10, 0x32, 0x40, 0xff, 0x00, 0x22, 0x83, 0xc0, 0xff, 0xff, 0xf5, 0x5a, 0x40, 0xff, 0xff, 0xb8,
+		0xc9, 0x40, 0xff, 0xff, 0xc6, 0x2c, 0x40, 0xff, 0xff, 0xe2, 0xc0, 0xc0, 0xff, 0xff, 0xf0, 0x44,
+		0x80, 0xff, 0xff, 0xec, 0x1b, 0x00, 0xff, 0xff, 0xed, 0xf9, 0x40, 0xff, 0xff, 0xde, 0xf6, 0x00,
+		0xff, 0x00, 0x0c, 0xfb, 0x40, 0xff, 0x00, 0x43, 0xb9, 0xc0, 0xff, 0x00, 0x3b, 0x48, 0x80, 0xff,
+		0x00, 0x1d, 0xc6, 0xc0, 0xff, 0x00, 0x0f, 0x6e, 0x40, 0xff, 0x00, 0x13, 0xb8, 0x40, 0x1f, 0xff,
+		0x01, 0x58, 0x11, 0x40, 0xff, 0xfe, 0x31, 0xf0, 0x80, 0x15, 0xff, 0x00, 0x4a, 0x75, 0x40, 0xff,
+		0xff, 0xcd, 0x2d, 0x40, 0xff, 0x00, 0x37, 0x58, 0x40, 0xff, 0xff, 0xc3, 0x20, 0x40, 0xff, 0xff,
+		0xc3, 0x45, 0x40, 0xff, 0xff, 0xcc, 0xe0, 0x80, 0xff, 0xff, 0xc8, 0xd8, 0x00, 0xff, 0xff, 0xb5,
+		0x11, 0x80, 0xff, 0xff, 0xb5, 0x9a, 0x00, 0xff, 0x00, 0x32, 0xfa, 0x00, 0xff, 0xff, 0xc8, 0x9d,
+		0x80, 0xff, 0x00, 0x3c, 0xf7, 0xc0, 0xff, 0x00, 0x3c, 0xa8, 0x80, 0xff, 0x00, 0x32, 0xf2, 0x80,
+		0xff, 0x00, 0x37, 0x1e, 0x80, 0xff, 0x00, 0x4a, 0xf3, 0x00, 0x1e, 0xff, 0xff, 0x90, 0x12, 0x40,
+		0xff, 0x00, 0x4e, 0x06, 0x80, 0x15, 0xff, 0x00, 0x14, 0x92, 0x00, 0xff, 0x00, 0x1f, 0xcd, 0xc0,
+		0xff, 0xff, 0xef, 0xe2, 0x40, 0xff, 0xff, 0xbf, 0xc5, 0x00, 0xff, 0xff, 0xc4, 0x5c, 0x00, 0xff,
+		0xff, 0xe1, 0xe2, 0xc0, 0xff, 0xff, 0xee, 0xb8, 0x00, 0xff, 0xff, 0xea, 0x96, 0x80, 0xff, 0xff,
+		0xe8, 0x91, 0x00, 0xff, 0xff, 0xe2, 0x86, 0x40, 0xff, 0x00, 0x13, 0xf4, 0x00, 0xff, 0x00, 0x3b,
+		0x12, 0x80, 0xff, 0x00, 0x3c, 0xed, 0xc0, 0xff, 0x00, 0x1e, 0x96, 0x00, 0xff, 0x00, 0x11, 0x50,
+		0x80, 0xff, 0x00, 0x15, 0x79, 0xc0, 0x1f, 0x0e, 0xff, 0x00, 0xe4, 0xe2, 0x40, 0xff, 0x02, 0x75,
+		0x39, 0x80, 0x15, 0xff, 0xff, 0xb3, 0xf7, 0x00, 0xff, 0xff, 0xc2, 0x9e, 0x80, 0xff, 0xff, 0xc7,
+		0x6e, 0x00, 0xff, 0xff, 0xb5, 0x5e, 0xc0, 0x1f, 0x8b, 0xff, 0xff, 0xc9, 0x16, 0x80, 0xff, 0x00,
+		0x21, 0xc7, 0x40, 0xff, 0xff, 0xc8, 0x33, 0x40, 0xff, 0x00, 0x24, 0xff, 0x80, 0xff, 0xff, 0xd3,
+		0x4c, 0x80, 0xff, 0xff, 0xb3, 0x28, 0x00, 0xff, 0xff, 0xd5, 0xfb, 0x80, 0xff, 0xff, 0xce, 0x9d,
+		0x40, 0xff, 0xff, 0xb2, 0xb1, 0x00, 0x8b, 0xff, 0xff, 0xb2, 0xef, 0x40, 0x8b, 0xff, 0xff, 0xa6,
+		0xf9, 0x80, 0xff, 0x00, 0x42, 0x1c, 0x40, 0xff, 0xff, 0xbc, 0x6c, 0x40, 0xff, 0x00, 0x59, 0xfe,
+		0xc0, 0x8b, 0xff, 0x00, 0x43, 0x57, 0x40, 0x8b, 0xff, 0x00, 0x3d, 0x94, 0x80, 0xff, 0x00, 0x25,
+		0x20, 0x80, 0xff, 0x00, 0x27, 0xb1, 0x80, 0xff, 0x00, 0x31, 0x33, 0x40, 0x08, 0xff, 0x00, 0x37,
+		0x3b, 0x40, 0xff, 0xff, 0xa7, 0xf9, 0x40, 0xff, 0x00, 0x3a, 0xaf, 0x40, 0xff, 0x00, 0x2c, 0x03,
+		0x40, 0xff, 0xff, 0xba, 0x18, 0xc0, 0xff, 0x00, 0x5a, 0x9d, 0x80, 0x05, 0xff, 0x00, 0x1c, 0x0e,
+		0xc0, 0xff, 0x00, 0x25, 0x10, 0x40, 0xff, 0x00, 0x19, 0x5e, 0x00, 0xff, 0x00, 0x26, 0xee, 0xc0,
+		0xff, 0x00, 0x16, 0x85, 0x00, 0xff, 0x00, 0x28, 0x82, 0x40, 0x08, 0xff, 0xff, 0xbf, 0x46, 0x40,
+		0xff, 0x00, 0x2c, 0xe0, 0x40, 0x05, 0xff, 0xff, 0xfd, 0xa1, 0xc0, 0xff, 0xff, 0xfd, 0xda, 0x00,
+		0xff, 0xff, 0xfe, 0x09, 0x40, 0xff, 0xff, 0xfc, 0x9f, 0x40, 0x8b, 0xff, 0xff, 0xfb, 0x1d, 0xc0,
+		0x8b, 0xff, 0xff, 0xfb, 0xeb, 0xc0, 0xff, 0x00, 0x01, 0x61, 0xc0, 0xff, 0xff, 0xfc, 0x1d, 0x00,
+		0x8b, 0xff, 0xff, 0xfc, 0x0e, 0x80, 0x8b, 0xff, 0xff, 0xfd, 0x39, 0x80, 0xff, 0xff, 0xff, 0x69,
+		0x40, 0xff, 0xff, 0xfd, 0x57, 0x00, 0xff, 0xff, 0xff, 0x40, 0x00, 0xff, 0xff, 0xfd, 0xa1, 0x40,
+		0xff, 0xff, 0xf8, 0x87, 0x80, 0xff, 0xff, 0xe8, 0x64, 0x80, 0xff, 0xff, 0xf2, 0x53, 0x00, 0xff,
+		0xff, 0xe2, 0xda, 0x80, 0xff, 0xff, 0xe8, 0x3e, 0xc0, 0xff, 0xff, 0xe4, 0x6a, 0x40, 0x08, 0xff,
+		0xff, 0x8f, 0xcf, 0x40, 0xff, 0x00, 0x9c, 0x34, 0x00, 0x05, 0xff, 0x00, 0x41, 0x3b, 0x40, 0xff,
+		0x00, 0x23, 0xa9, 0x00, 0xff, 0x00, 0x2a, 0xaf, 0x80, 0xff, 0x00, 0x41, 0x58, 0xc0, 0x8b, 0xff,
+		0x00, 0x41, 0x6a, 0x80, 0x08, 0xff, 0x00, 0x4d, 0x06, 0x00, 0xff, 0xff, 0xc5, 0x5a, 0x00, 0xff,
+		0x00, 0x38, 0x1c, 0xc0, 0xff, 0xff, 0xb5, 0x07, 0xc0, 0x1e, 0xff, 0xff, 0xbb, 0x8c, 0x00, 0xff,
+		0xff, 0x7b, 0x87, 0x80, 0x15, 0xff, 0x00, 0x2b, 0xda, 0x80, 0xff, 0x00, 0x1f, 0xb6, 0xc0, 0xff,
+		0x00, 0x1d, 0x52, 0x00, 0xff, 0x00, 0x23, 0x75, 0x80, 0xff, 0x00, 0x24, 0xda, 0x00, 0xff, 0x00,
+		0x20, 0x8f, 0x40, 0xff, 0xff, 0xe0, 0xbe, 0x40, 0xff, 0xff, 0xd0, 0xa3, 0x80, 0x1e, 0x8b, 0xff,
+		0xff, 0xd2, 0x70, 0xc0, 0xff, 0xff, 0xe2, 0x4e, 0x40, 0xff, 0xff, 0xd0, 0xb5, 0xc0, 0xff, 0xff,
+		0xd1, 0x9b, 0x80, 0xff, 0xff, 0xe6, 0x5b, 0x40, 0xff, 0xff, 0xce, 0x60, 0xc0, 0xff, 0x00, 0x3e,
+		0x16, 0xc0, 0xff, 0xff, 0xf5, 0x20, 0x00, 0xff, 0x00, 0x23, 0x8d, 0x00, 0x8b, 0xff, 0x00, 0x1a,
+		0x4c, 0x40, 0x08, 0xff, 0x00, 0x24, 0x55, 0x40, 0xff, 0xff, 0x37, 0x41, 0x40, 0x15, 0xff, 0x00,
+		0x7f, 0xb9, 0x80, 0xff, 0xff, 0x53, 0x66, 0x80, 0x05, 0x8b, 0xff, 0xff, 0xc9, 0x1e, 0x40, 0xff,
+		0xff, 0xba, 0xcf, 0x40, 0xff, 0xff, 0xbd, 0x59, 0x40, 0xff, 0xff, 0xcc, 0xf3, 0x00, 0xff, 0xff,
+		0xd7, 0xbd, 0x00, 0xff, 0x00, 0x28, 0xd7, 0xc0, 0xff, 0x00, 0x3a, 0x14, 0x00, 0x1e, 0x8b, 0xff,
+		0x00, 0x33, 0xc7, 0x40, 0xff, 0x00, 0x1f, 0xfb, 0xc0, 0xff, 0x00, 0x38, 0xa8, 0x80, 0xff, 0x00,
+		0x35, 0x23, 0x40, 0xff, 0x00, 0x22, 0x6e, 0xc0, 0x08, 0x0e, 0xff, 0x01, 0x3f, 0x06, 0xc0, 0xff,
+		0x02, 0x5c, 0xa9, 0x00, 0x15, 0x20, 0x0a, 0x0e, 0xff, 0x01, 0x87, 0xcd, 0x40, 0xff, 0x02, 0x9a,
+		0x3c, 0x80, 0x15, 0xff, 0xff, 0x65, 0x3e, 0xc0, 0xff, 0xff, 0xbb, 0xec, 0xc0, 0xff, 0xff, 0x9d,
+		0x9e, 0xc0, 0xff, 0xff, 0x63, 0x52, 0x40, 0x8b, 0xff, 0xff, 0x48, 0xf4, 0x00, 0x8b, 0xff, 0xff,
+		0x4a, 0x5d, 0x40, 0xff, 0x00, 0x5f, 0x99, 0x80, 0xff, 0xff, 0x59, 0xbe, 0x40, 0xff, 0x00, 0x9e,
+		0x66, 0x00, 0xff, 0xff, 0xac, 0xdb, 0x80, 0x08, 0xff, 0x00, 0x20, 0xcb, 0x40, 0xff, 0x00, 0x34,
+		0xa4, 0x80, 0x05, 0xff, 0xff, 0x77, 0x53, 0x80, 0xff, 0x00, 0x4f, 0x6c, 0x40, 0xff, 0xff, 0xaf,
+		0x6f, 0x00, 0xff, 0x00, 0x92, 0xf4, 0x40, 0x8b, 0xff, 0x00, 0x9b, 0x5d, 0xc0, 0x8b, 0xff, 0x00,
+		0x8e, 0xd7, 0x00, 0xff, 0x00, 0x45, 0x32, 0x00, 0xff, 0x00, 0x7f, 0x62, 0x80, 0xff, 0x00, 0x74,
+		0xd5, 0xc0, 0xff, 0x00, 0x44, 0xe8, 0xc0, 0xff, 0x00, 0x02, 0xab, 0x40, 0xff, 0x00, 0x01, 0x93,
+		0x00, 0xff, 0x00, 0x02, 0x68, 0x00, 0xff, 0x00, 0x01, 0x8c, 0x00, 0xff, 0x00, 0x03, 0xf9, 0xc0,
+		0x8b, 0xff, 0x00, 0x03, 0x83, 0x80, 0x8b, 0xff, 0x00, 0x03, 0x2c, 0xc0, 0xff, 0xff, 0xfe, 0xdc,
+		0x40, 0xff, 0x00, 0x03, 0xf7, 0x40, 0x8b, 0xff, 0x00, 0x01, 0x6e, 0xc0, 0x8b, 0xff, 0x00, 0x03,
+		0x3b, 0x80, 0xff, 0x00, 0x00, 0x21, 0x80, 0xff, 0x00, 0x03, 0x63, 0x40, 0xff, 0x00, 0x01, 0xee,
+		0x40, 0x08, 0x0e, 0xff, 0x00, 0x4d, 0xab, 0x80, 0xff, 0x02, 0x5b, 0x3c, 0xc0, 0x15, 0xff, 0x00,
+		0x84, 0x2b, 0xc0, 0xff, 0xff, 0xb9, 0xbc, 0x00, 0xff, 0x00, 0x53, 0x9a, 0x80, 0xff, 0xff, 0x77,
+		0x1b, 0x40, 0x8b, 0xff, 0xff, 0x6b, 0x95, 0x80, 0x8b, 0xff, 0xff, 0x69, 0x82, 0x40, 0xff, 0xff,
+		0xaa, 0x30, 0x40, 0xff, 0xff, 0x74, 0x71, 0x00, 0xff, 0xff, 0x78, 0xdc, 0x00, 0xff, 0xff, 0xb8,
+		0x78, 0xc0, 0x08, 0xff, 0x00, 0x12, 0xfc, 0x40, 0xff, 0xff, 0xc3, 0x97, 0x00, 0x05, 0xff, 0x00,
+		0xa5, 0xd7, 0xc0, 0xff, 0x00, 0x4f, 0x10, 0xc0, 0xff, 0x00, 0x6a, 0xdd, 0x80, 0xff, 0x00, 0xa6,
+		0x1e, 0x00, 0x8b, 0xff, 0x00, 0xb3, 0xa9, 0xc0, 0x8b, 0xff, 0x00, 0xb2, 0x13, 0x00, 0xff, 0xff,
+		0x96, 0xf1, 0x80, 0xff, 0x00, 0xa2, 0x00, 0x80, 0xff, 0xff, 0x5d, 0x87, 0x00, 0xff, 0x00, 0x4a,
+		0xc7, 0x00, 0x08, 0x0e, 0xff, 0x00, 0xd5, 0x29, 0x40, 0xff, 0x02, 0x06, 0xa9, 0xc0, 0x15, 0xff,
+		0x00, 0x0f, 0x88, 0xc0, 0xff, 0xff, 0x4f, 0x15, 0xc0, 0xff, 0xff, 0x5e, 0x9e, 0x80, 0xff, 0x00,
+		0x4b, 0xf1, 0xc0, 0xff, 0xff, 0xe6, 0x1c, 0x00, 0xff, 0xff, 0xbf, 0x46, 0x40, 0xff, 0x00, 0xac,
+		0x99, 0xc0, 0xff, 0xff, 0xcb, 0x5b, 0x80, 0xff, 0xff, 0x7d, 0xaf, 0xc0, 0xff, 0xff, 0x69, 0xd6,
+		0x80, 0xff, 0x00, 0x36, 0x5e, 0x80, 0xff, 0xff, 0xd3, 0xfc, 0xc0, 0xff, 0x00, 0x70, 0x30, 0x80,
+		0xff, 0x00, 0xa6, 0x8f, 0x00, 0xff, 0x00, 0x6b, 0xe0, 0x00, 0xff, 0xff, 0x5a, 0x4d, 0xc0, 0xff,
+		0x00, 0x36, 0x5e, 0x80, 0xff, 0x00, 0x2b, 0x26, 0x80, 0xff, 0xff, 0x82, 0x00, 0x80, 0xff, 0x00,
+		0x97, 0x06, 0x80, 0xff, 0x00, 0xab, 0xbc, 0xc0, 0xff, 0x00, 0x33, 0xc7, 0x80, 0xff, 0xff, 0xe5,
+		0x3f, 0x40, 0xff, 0x00, 0x3d, 0x46, 0x00, 0xff, 0xff, 0x61, 0x35, 0x40, 0xff, 0xff, 0xb7, 0x82,
+		0x00, 0xff, 0x00, 0x0f, 0x88, 0xc0, 0xff, 0x00, 0x96, 0x29, 0x80, 0x05, 0xff, 0x00, 0x01, 0x49,
+		0x40, 0xff, 0x00, 0x0c, 0x6e, 0xc0, 0xff, 0x00, 0x03, 0x0f, 0x40, 0xff, 0x00, 0x02, 0x6d, 0x00,
+		0xff, 0x00, 0x01, 0xb2, 0x00, 0xff, 0x00, 0x0b, 0xe5, 0x00, 0x08, 0x0e, 0xff, 0x00, 0xdd, 0xca,
+		0x80, 0xff, 0x02, 0x0a, 0xfa, 0x80, 0x15, 0x21, 0x0a, 0x0e, 0xff, 0x01, 0x31, 0xa2, 0x40, 0xff,
+		0x00, 0x13, 0xb5, 0x00, 0x15, 0x22, 0x0a, 0x0e, 0xff, 0x00, 0x46, 0xc4, 0x00, 0xff, 0x01, 0x5b,
+		0xca, 0x00, 0x15, 0x23, 0x0a, 0x0e, 0xff, 0x01, 0x29, 0xbc, 0x80, 0xff, 0x00, 0x2e, 0x2a, 0x40,
+		0x15, 0x24, 0x0a, 0x0e, 0xff, 0x00, 0x3f, 0xdc, 0xc0, 0xff, 0xff, 0xf3, 0x0e, 0x00, 0x15, 0xff,
+		0x00, 0x3a, 0xaf, 0x00, 0xff, 0xff, 0xe2, 0xa8, 0x80, 0xff, 0x01, 0x3a, 0x21, 0xc0, 0xff, 0x02,
+		0xa4, 0x97, 0x80, 0xff, 0xff, 0xc4, 0x74, 0x00, 0xff, 0x00, 0x1e, 0x34, 0x80, 0x05, 0x0e, 0xff,
+		0x00, 0xfb, 0x59, 0x00, 0xff, 0x02, 0x73, 0x66, 0xc0, 0x15, 0xff, 0xff, 0x9d, 0x1d, 0x40, 0xff,
+		0xff, 0x99, 0x95, 0xc0, 0xff, 0xff, 0x86, 0x90, 0x00, 0xff, 0xff, 0x38, 0x97, 0xc0, 0xff, 0xff,
+		0x36, 0x6f, 0x40, 0xff, 0x00, 0x67, 0xe0, 0x40, 0xff, 0xff, 0x8b, 0xc5, 0x80, 0xff, 0x00, 0x62,
+		0x86, 0xc0, 0xff, 0x00, 0x5a, 0x6e, 0x80, 0xff, 0x00, 0x6a, 0xbf, 0x80, 0xff, 0x00, 0x62, 0x23,
+		0x00, 0xff, 0x00, 0xd6, 0x1a, 0xc0, 0xff, 0x00, 0xd4, 0xab, 0x80, 0xff, 0xff, 0x99, 0x98, 0x40,
+		0xff, 0x00, 0x71, 0xba, 0x40, 0xff, 0xff, 0xa0, 0x1f, 0xc0, 0x1f, 0xff, 0x00, 0x61, 0x5c, 0xc0,
+		0xff, 0xff, 0x71, 0x91, 0x80, 0x15, 0xff, 0xff, 0x24, 0xa9, 0x00, 0xff, 0xfe, 0xe3, 0xf9, 0x00,
+		0x05, 0xff, 0xff, 0xf7, 0x36, 0x40, 0xff, 0x00, 0x22, 0x3b, 0x00, 0xff, 0xff, 0xfa, 0xe2, 0x00,
+		0xff, 0x00, 0x27, 0x7d, 0xc0, 0x8b, 0xff, 0x00, 0x2c, 0x0d, 0x00, 0x8b, 0xff, 0x00, 0x9f, 0x6a,
+		0x00, 0xff, 0x00, 0x49, 0x2f, 0x40, 0xff, 0x00, 0x57, 0xff, 0xc0, 0xff, 0x00, 0x3d, 0xc1, 0x80,
+		0x8b, 0xff, 0x00, 0x22, 0x16, 0xc0, 0x8b, 0xff, 0x00, 0x25, 0x7c, 0x00, 0xff, 0xff, 0xe5, 0xd8,
+		0xc0, 0xff, 0x00, 0x1a, 0xbb, 0x40, 0xff, 0xff, 0xc8, 0xfe, 0xc0, 0x08, 0xff, 0x00, 0x17, 0x20,
+		0x00, 0xff, 0xff, 0xbd, 0x2d, 0x00, 0x15, 0xff, 0x00, 0x08, 0x48, 0x40, 0xff, 0xff, 0xdc, 0xdb,
+		0xc0, 0xff, 0x00, 0x04, 0xdd, 0xc0, 0xff, 0xff, 0xd6, 0x56, 0x40, 0x8b, 0xff, 0xff, 0xcf, 0x8a,
+		0x80, 0x8b, 0xff, 0xff, 0x51, 0xe0, 0x80, 0xff, 0xff, 0xb4, 0xdc, 0xc0, 0xff, 0xff, 0xbd, 0xc9,
+		0x00, 0xff, 0xff, 0xc9, 0x05, 0x80, 0x8b, 0xff, 0xff, 0xda, 0xfe, 0x40, 0x8b, 0xff, 0xff, 0xd9,
+		0xab, 0x80, 0xff, 0x00, 0x1e, 0x60, 0x80, 0xff, 0xff, 0xe4, 0xec, 0x00, 0xff, 0x00, 0x36, 0xa7,
+		0x00, 0x08, 0x0e, 0xff, 0x01, 0x29, 0xbc, 0x40, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xff,
+		0xd1, 0x65, 0xc0, 0x8b, 0xff, 0xff, 0x60, 0x58, 0x40, 0xff, 0xff, 0xac, 0x4a, 0x00, 0xff, 0x00,
+		0x10, 0x65, 0xc0, 0xff, 0xff, 0xd9, 0x2a, 0x40, 0xff, 0x00, 0x7b, 0x68, 0xc0, 0xff, 0x00, 0x23,
+		0x62, 0x00, 0x8b, 0xff, 0xfe, 0x1d, 0x95, 0x40, 0xff, 0xff, 0x8c, 0x5b, 0x80, 0x8b, 0x8b, 0xff,
+		0xff, 0xc8, 0xc4, 0x80, 0xff, 0x01, 0x26, 0x48, 0x80, 0x8b, 0x8b, 0xff, 0x00, 0x37, 0x3b, 0x80,
+		0xff, 0xff, 0x8f, 0xcf, 0x80, 0x8b, 0x05, 0x0e, 0xff, 0x00, 0x4d, 0xab, 0x80, 0xff, 0x02, 0x0e,
+		0x6e, 0x00, 0x15, 0xff, 0x00, 0x32, 0xea, 0xc0, 0xff, 0xff, 0xd7, 0x70, 0x80, 0x05, 0xff, 0x00,
+		0x05, 0xf2, 0x00, 0xff, 0x00, 0x08, 0x79, 0x40, 0xff, 0xff, 0xfd, 0x71, 0xc0, 0xff, 0x00, 0x06,
+		0x3f, 0xc0, 0xff, 0x00, 0x05, 0x55, 0x80, 0xff, 0x00, 0x08, 0x4a, 0xc0, 0xff, 0x00, 0x0e, 0xb4,
+		0x80, 0xff, 0x00, 0x16, 0xdc, 0xc0, 0xff, 0x00, 0x25, 0x69, 0x00, 0xff, 0x00, 0x21, 0xe8, 0x00,
+		0xff, 0x00, 0x36, 0x6b, 0x40, 0x8b, 0xff, 0x00, 0x42, 0x63, 0x40, 0x8b, 0xff, 0x00, 0x35, 0x49,
+		0x00, 0xff, 0xff, 0xcc, 0x90, 0x40, 0x8b, 0xff, 0xff, 0xbd, 0x07, 0x80, 0x8b, 0xff, 0xff, 0xb4,
+		0x15, 0xc0, 0xff, 0xff, 0xc0, 0x0b, 0x80, 0xff, 0xff, 0xc9, 0x4c, 0x80, 0xff, 0xff, 0xd2, 0xd1,
+		0x40, 0xff, 0xff, 0xd7, 0x4b, 0xc0, 0xff, 0xff, 0xb8, 0xd6, 0xc0, 0xff, 0xff, 0xbf, 0xe4, 0x40,
+		0xff, 0xff, 0xc6, 0x9c, 0xc0, 0xff, 0xff, 0xbf, 0xb2, 0x40, 0xff, 0xff, 0xcb, 0x86, 0x40, 0xff,
+		0xff, 0x98, 0x80, 0x00, 0x08, 0xff, 0xff, 0xd3, 0xfc, 0xc0, 0xff, 0x01, 0x6d, 0xe9, 0x40, 0xff,
+		0x00, 0x45, 0xe7, 0x40, 0x07, 0xff, 0xff, 0xf9, 0x82, 0x80, 0xff, 0x00, 0x02, 0x27, 0x40, 0xff,
+		0xff, 0xfb, 0x19, 0x40, 0xff, 0xff, 0xfb, 0x25, 0x40, 0xff, 0xff, 0xfd, 0xec, 0x00, 0xff, 0xff,
+		0xfe, 0x35, 0x40, 0xff, 0xff, 0xfb, 0xf1, 0xc0, 0xff, 0xff, 0xfc, 0x80, 0xc0, 0xff, 0xff, 0xfd,
+		0xec, 0x00, 0xff, 0xff, 0xff, 0x5c, 0x40, 0xff, 0xff, 0xfb, 0x70, 0xc0, 0x8b, 0x08, 0xff, 0xfe,
+		0xfa, 0x82, 0xc0, 0x06, 0xff, 0x00, 0x33, 0xf8, 0xc0, 0xff, 0x00, 0x5a, 0x9a, 0x80, 0xff, 0x00,
+		0x48, 0xaf, 0x80, 0xff, 0x00, 0x3d, 0xeb, 0x80, 0xff, 0x00, 0x2c, 0xec, 0x80, 0xff, 0x00, 0x2a,
+		0x16, 0x80, 0xff, 0x00, 0x2d, 0xae, 0x00, 0xff, 0x00, 0x2a, 0xcb, 0xc0, 0xff, 0x00, 0x3f, 0xf3,
+		0x80, 0xff, 0x00, 0x40, 0x16, 0x40, 0x8b, 0xff, 0x00, 0x59, 0x9c, 0xc0, 0x8b, 0xff, 0x00, 0x61,
+		0x16, 0x00, 0xff, 0xff, 0xb0, 0xfb, 0x80, 0xff, 0x00, 0x4d, 0xf1, 0x40, 0xff, 0xff, 0x9a, 0x47,
+		0xc0, 0x8b, 0xff, 0xff, 0xb9, 0x4a, 0xc0, 0x8b, 0xff, 0xff, 0xbd, 0x03, 0x00, 0xff, 0xff, 0xd9,
+		0xc7, 0x80, 0xff, 0xff, 0xdb, 0x47, 0x00, 0xff, 0xff, 0xc1, 0x3e, 0x00, 0x08, 0x0e, 0xff, 0x01,
+		0x9a, 0xd2, 0x40, 0xff, 0x01, 0xd3, 0x30, 0x40, 0x15, 0xff, 0x00, 0x55, 0x0e, 0x40, 0xff, 0xff,
+		0xb7, 0x34, 0x80, 0xff, 0x00, 0x48, 0xd1, 0x80, 0xff, 0xff, 0x9d, 0x73, 0x00, 0x1e, 0xff, 0xff,
+		0xc7, 0xcb, 0x80, 0x8b, 0xff, 0xff, 0xc9, 0x96, 0xc0, 0xff, 0xff, 0xe8, 0x05, 0x40, 0xff, 0xff,
+		0xd8, 0xe4, 0x80, 0xff, 0xff, 0xd5, 0x47, 0x40, 0x08, 0xff, 0x00, 0x26, 0xd5, 0xc0, 0xff, 0xff,
+		0xd4, 0xd9, 0x80, 0x05, 0xff, 0x00, 0x1d, 0x10, 0x40, 0xff, 0x00, 0x1f, 0x25, 0xc0, 0xff, 0x00,
+		0x27, 0xe1, 0x00, 0xff, 0x00, 0x10, 0xaf, 0x40, 0xff, 0x00, 0x26, 0x87, 0xc0, 0x8b, 0xff, 0x00,
+		0x3f, 0xf1, 0x40, 0x8b, 0xff, 0x00, 0x2c, 0x5f, 0x40, 0xff, 0xff, 0xd3, 0x8c, 0x80, 0x8b, 0xff,
+		0xff, 0xcb, 0x5e, 0x00, 0x8b, 0xff, 0xff, 0xda, 0x0b, 0x00, 0xff, 0xff, 0xe8, 0xad, 0xc0, 0xff,
+		0xff, 0xd6, 0xdc, 0x00, 0xff, 0xff, 0xd4, 0xde, 0x40, 0xff, 0xff, 0xed, 0x0e, 0x40, 0xff, 0xff,
+		0xf5, 0x0b, 0x80, 0xff, 0xff, 0xfb, 0x30, 0x40, 0xff, 0xff, 0xe3, 0xa7, 0x80, 0xff, 0xff, 0xf5,
+		0x20, 0xc0, 0xff, 0xff, 0xc4, 0xe2, 0x40, 0xff, 0xff, 0xff, 0xde, 0xc0, 0x08, 0xff, 0xff, 0xc7,
+		0xe7, 0xc0, 0x07, 0xff, 0x00, 0x0a, 0x7e, 0x40, 0xff, 0x00, 0x01, 0x7a, 0x00, 0xff, 0x00, 0x0a,
+		0x94, 0x80, 0xff, 0x00, 0x00, 0xbf, 0xc0, 0xff, 0x00, 0x0a, 0x96, 0xc0, 0x8b, 0x08, 0xff, 0x00,
+		0x54, 0x5f, 0xc0, 0xff, 0x00, 0x3e, 0x00, 0xc0, 0xff, 0xff, 0xd3, 0xec, 0xc0, 0xff, 0xff, 0xb5,
+		0xbb, 0x80, 0xff, 0xff, 0xbb, 0x91, 0xc0, 0xff, 0xff, 0xcb, 0x8c, 0xc0, 0xff, 0xff, 0xc5, 0x68,
+		0x80, 0xff, 0xff, 0xb7, 0x0d, 0x40, 0x1f, 0xff, 0xff, 0xc5, 0xf3, 0xc0, 0x8b, 0xff, 0xff, 0xdc,
+		0xf0, 0x00, 0xff, 0x00, 0x25, 0x33, 0x40, 0xff, 0xff, 0xfb, 0x92, 0x80, 0xff, 0x00, 0x04, 0xfd,
+		0x00, 0xff, 0xff, 0xf7, 0x82, 0x00, 0xff, 0x00, 0x09, 0x91, 0x40, 0xff, 0x00, 0x04, 0x73, 0x80,
+		0xff, 0x00, 0x09, 0xb1, 0x00, 0xff, 0xff, 0xf7, 0x1e, 0x00, 0xff, 0x00, 0x09, 0x17, 0xc0, 0x08,
+		0xff, 0xff, 0xcb, 0x5b, 0x80, 0xff, 0xff, 0xc1, 0x00, 0x40, 0x05, 0xff, 0x00, 0x29, 0xca, 0x40,
+		0xff, 0xff, 0xd1, 0x8a, 0x40, 0xff, 0x00, 0x3b, 0x89, 0xc0, 0xff, 0xff, 0xe7, 0x87, 0x80, 0xff,
+		0x00, 0x3e, 0x67, 0x00, 0x8b, 0xff, 0x00, 0x77, 0x5e, 0x80, 0x8b, 0xff, 0x00, 0x48, 0x7a, 0xc0,
+		0xff, 0x00, 0x55, 0x1f, 0x80, 0x8b, 0xff, 0x00, 0x60, 0xcf, 0x80, 0x8b, 0xff, 0x00, 0x4a, 0x23,
+		0x80, 0xff, 0xff, 0xd5, 0x9c, 0x00, 0xff, 0x00, 0x3f, 0x14, 0xc0, 0xff, 0xff, 0xbf, 0x5b, 0x00,
+		0xff, 0x00, 0x17, 0x9f, 0x40, 0xff, 0x00, 0x37, 0xe9, 0x40, 0xff, 0x00, 0x14, 0xd3, 0x80, 0xff,
+		0x00, 0x25, 0x53, 0x80, 0xff, 0x00, 0x35, 0x87, 0x80, 0x8b, 0xff, 0x00, 0x3c, 0x94, 0x00, 0x08,
+		0x0e, 0xff, 0x01, 0x39, 0x44, 0xc0, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xfe, 0xf7, 0x0f,
+		0x40, 0xff, 0xfe, 0x70, 0x6e, 0x40, 0x8b, 0xff, 0xff, 0xcc, 0x38, 0x40, 0xff, 0x00, 0xfb, 0x22,
+		0x00, 0x8b, 0x8b, 0xff, 0xff, 0x53, 0x66, 0x80, 0xff, 0x00, 0x48, 0x7e, 0x00, 0x8b, 0x8b, 0xff,
+		0x00, 0xab, 0xbc, 0xc0, 0xff, 0x00, 0x50, 0x42, 0x40, 0x8b, 0x8b, 0xff, 0x00, 0x3e, 0x22, 0xc0,
+		0xff, 0xff, 0xaf, 0xbd, 0xc0, 0x8b, 0x8b, 0xff, 0x01, 0x86, 0x13, 0x80, 0x05, 0xff, 0xff, 0xb8,
+		0x5f, 0x00, 0xff, 0xff, 0x90, 0xac, 0x40, 0x15, 0xff, 0xfe, 0xe9, 0x40, 0x40, 0xff, 0xff, 0x49,
+		0x0b, 0x40, 0x07, 0x0e, 0xff, 0x00, 0x6a, 0x26, 0x40, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0xff,
+		0xff, 0xea, 0x6c, 0xc0, 0xff, 0xfe, 0xc3, 0x47, 0x80, 0xff, 0x00, 0x2c, 0xe0, 0x40, 0xff, 0xff,
+		0xed, 0xe0, 0x80, 0x05, 0xff, 0x00, 0x1e, 0x12, 0x40, 0xff, 0x00, 0x25, 0xde, 0xc0, 0xff, 0x00,
+		0x2c, 0x1c, 0x00, 0xff, 0x00, 0x14, 0xe8, 0x40, 0xff, 0x00, 0x2a, 0x8c, 0xc0, 0x8b, 0x08, 0xff,
+		0x00, 0x41, 0x99, 0x80, 0xff, 0x00, 0x3d, 0xed, 0x40, 0xff, 0xff, 0xce, 0x9a, 0x80, 0xff, 0xff,
+		0x9c, 0xb3, 0x40, 0xff, 0xff, 0xa0, 0x2b, 0x80, 0xff, 0xff, 0xc4, 0xdb, 0x40, 0xff, 0xff, 0xcb,
+		0x8c, 0x80, 0xff, 0xff, 0xbd, 0x1c, 0x00, 0x1f, 0xff, 0xff, 0xbc, 0xb7, 0x40, 0x8b, 0xff, 0xff,
+		0xd4, 0x87, 0x40, 0xff, 0x00, 0x33, 0x02, 0x80, 0xff, 0xff, 0xfc, 0x88, 0x80, 0xff, 0x00, 0x06,
+		0x8e, 0x00, 0xff, 0xff, 0xfb, 0xf8, 0xc0, 0xff, 0x00, 0x07, 0x9e, 0x00, 0xff, 0x00, 0x05, 0x22,
+		0x00, 0xff, 0x00, 0x09, 0xd9, 0x40, 0xff, 0xff, 0xf7, 0x71, 0x80, 0xff, 0x00, 0x06, 0x1a, 0x80,
+		0x08, 0xff, 0xff, 0xc1, 0xdd, 0x40, 0xff, 0xff, 0xd1, 0x66, 0x00, 0x05, 0xff, 0x00, 0x29, 0x52,
+		0x00, 0xff, 0xff, 0xc3, 0x01, 0xc0, 0xff, 0x00, 0x45, 0x4e, 0x00, 0xff, 0xff, 0xdd, 0x2f, 0x80,
+		0xff, 0x00, 0x4a, 0x0c, 0x00, 0x8b, 0x08, 0xff, 0x00, 0x6b, 0xb6, 0x00, 0xff, 0x00, 0x59, 0x1a,
+		0x40, 0xff, 0x00, 0x49, 0x2b, 0xc0, 0xff, 0x00, 0x87, 0x0e, 0x80, 0xff, 0x00, 0x85, 0x63, 0x40,
+		0xff, 0xff, 0xab, 0xd2, 0x00, 0xff, 0x00, 0x4a, 0x60, 0x80, 0xff, 0xff, 0x97, 0xac, 0x00, 0x1f,
+		0xff, 0xff, 0xdd, 0x97, 0x00, 0x8b, 0xff, 0xff, 0xdd, 0x31, 0xc0, 0xff, 0xff, 0xf7, 0xed, 0xc0,
+		0xff, 0xff, 0xdf, 0xb7, 0x40, 0xff, 0xff, 0xef, 0xe5, 0x40, 0x08, 0xff, 0x00, 0x09, 0x7e, 0x40,
+		0xff, 0x00, 0xb3, 0x81, 0x00, 0xff, 0x01, 0x01, 0x2c, 0x80, 0x8b, 0x8b, 0xff, 0x00, 0x3e, 0xff,
+		0xc0, 0x05, 0x0e, 0xff, 0x01, 0x1f, 0x15, 0xc0, 0xff, 0x02, 0x76, 0x1c, 0x00, 0x15, 0xff, 0xff,
+		0xb5, 0xb9, 0x40, 0x8b, 0xff, 0xff, 0xaf, 0x56, 0x00, 0xff, 0xff, 0xd2, 0x38, 0x40, 0xff, 0xff,
+		0xd9, 0xa7, 0x40, 0xff, 0xff, 0x93, 0x0f, 0x40, 0xff, 0xff, 0xeb, 0x1b, 0x80, 0xff, 0xff, 0xc4,
+		0xa4, 0x80, 0xff, 0xff, 0xfa, 0x3e, 0xc0, 0xff, 0xff, 0xb7, 0x74, 0x80, 0x8b, 0xff, 0xff, 0xc4,
+		0x34, 0x00, 0x8b, 0xff, 0xff, 0xb7, 0x0a, 0x00, 0xff, 0x00, 0x07, 0x1a, 0x80, 0xff, 0xff, 0xb2,
+		0x1a, 0x80, 0xff, 0x00, 0x28, 0x05, 0x00, 0xff, 0xff, 0xc3, 0x8e, 0xc0, 0xff, 0x00, 0x24, 0x48,
+		0xc0, 0xff, 0xff, 0xc9, 0x32, 0xc0, 0xff, 0x00, 0x37, 0x71, 0xc0, 0xff, 0xff, 0xe4, 0x0d, 0xc0,
+		0xff, 0x00, 0x37, 0x7c, 0x00, 0x8b, 0x08, 0xff, 0x00, 0x5e, 0xb8, 0x00, 0xff, 0x00, 0x53, 0x21,
+		0x80, 0xff, 0x00, 0x50, 0x23, 0xc0, 0xff, 0x00, 0x80, 0x4f, 0x80, 0xff, 0x00, 0x81, 0xae, 0xc0,
+		0xff, 0xff, 0xad, 0x26, 0x00, 0xff, 0x00, 0x4a, 0x80, 0x80, 0xff, 0xff, 0xa7, 0xe9, 0xc0, 0x1f,
+		0xff, 0xff, 0xc9, 0xa3, 0x40, 0x8b, 0xff, 0xff, 0xcd, 0xd9, 0x00, 0xff, 0xff, 0xe3, 0x66, 0xc0,
+		0xff, 0xff, 0xe4, 0x78, 0x80, 0xff, 0xff, 0xd1, 0x66, 0x40, 0xff, 0x00, 0x03, 0xce, 0xc0, 0xff,
+		0x00, 0xd5, 0x26, 0x40, 0xff, 0x00, 0x66, 0x8f, 0x80, 0xff, 0x00, 0x1b, 0xd7, 0x00, 0xff, 0x00,
+		0x2c, 0xcb, 0xc0, 0x8b, 0xff, 0x00, 0x29, 0x6d, 0x80, 0x8b, 0xff, 0x00, 0x1b, 0x8d, 0x80, 0xff,
+		0xff, 0xe9, 0xf6, 0x80, 0xff, 0x00, 0x03, 0xd1, 0x80, 0xff, 0xff, 0xfc, 0x00, 0x40, 0xff, 0x00,
+		0x06, 0x1a, 0xc0, 0xff, 0xff, 0xf9, 0x9b, 0xc0, 0xff, 0xff, 0xff, 0xcf, 0x00, 0xff, 0xff, 0xf6,
+		0xa3, 0x00, 0xff, 0x00, 0x09, 0x2d, 0x00, 0xff, 0xff, 0xf9, 0x40, 0x40, 0x08, 0xff, 0x00, 0x30,
+		0x54, 0x00, 0xff, 0x00, 0x35, 0x81, 0x80, 0x05, 0xff, 0xff, 0xdb, 0x65, 0x00, 0xff, 0x00, 0x24,
+		0x14, 0xc0, 0xff, 0xff, 0xce, 0xa9, 0x40, 0xff, 0x00, 0x14, 0xff, 0x00, 0xff, 0xff, 0xcd, 0x4b,
+		0xc0, 0x8b, 0x08, 0xff, 0xff, 0xe6, 0xc6, 0x40, 0xff, 0xfe, 0xde, 0xda, 0x80, 0x15, 0xff, 0x00,
+		0x32, 0x16, 0x40, 0xff, 0x00, 0x3b, 0x4a, 0x00, 0xff, 0xff, 0xd8, 0xf3, 0x40, 0xff, 0xff, 0x94,
+		0x9d, 0xc0, 0xff, 0xff, 0x9e, 0x91, 0x40, 0xff, 0xff, 0xca, 0x0d, 0x00, 0xff, 0xff, 0xd2, 0xa2,
+		0xc0, 0xff, 0xff, 0xcb, 0x27, 0x40, 0x1f, 0xff, 0xff, 0xb3, 0xfc, 0x40, 0x8b, 0xff, 0xff, 0xc7,
+		0x20, 0x00, 0xff, 0x00, 0x59, 0x05, 0x00, 0xff, 0x00, 0x08, 0x41, 0x80, 0xff, 0x00, 0x74, 0x6c,
+		0x00, 0xff, 0x00, 0x1c, 0x17, 0x00, 0xff, 0x00, 0x33, 0x1c, 0xc0, 0xff, 0x00, 0x2f, 0xb6, 0xc0,
+		0xff, 0x00, 0x20, 0xad, 0x40, 0xff, 0x00, 0x2e, 0x40, 0x00, 0x8b, 0x08, 0x0e, 0xff, 0x00, 0x4e,
+		0x88, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0xff, 0xff, 0xbd, 0x8c, 0x80, 0xff, 0x01, 0x0a,
+		0xaa, 0xc0, 0x07, 0xff, 0xff, 0xe0, 0x89, 0x00, 0xff, 0xff, 0xb6, 0x03, 0x80, 0xff, 0xff, 0xe1,
+		0xca, 0x40, 0xff, 0xff, 0xb5, 0x7a, 0xc0, 0xff, 0xff, 0xe3, 0x0f, 0x40, 0xff, 0xff, 0xb4, 0xfd,
+		0x80, 0xff, 0xff, 0xd5, 0x8c, 0xc0, 0xff, 0xff, 0x91, 0xf8, 0x40, 0xff, 0xff, 0xd8, 0x49, 0x40,
+		0xff, 0xff, 0x90, 0xea, 0x80, 0xff, 0xff, 0xdb, 0x12, 0x00, 0xff, 0xff, 0x8f, 0xff, 0x00, 0x08,
+		0xff, 0x00, 0x4e, 0x88, 0x80, 0x06, 0xff, 0x00, 0x1e, 0x60, 0x80, 0xff, 0x00, 0x62, 0x1f, 0x80,
+		0xff, 0x00, 0x21, 0x19, 0x40, 0xff, 0x00, 0x61, 0x48, 0x00, 0xff, 0x00, 0x23, 0xc4, 0xc0, 0xff,
+		0x00, 0x60, 0x4a, 0x40, 0xff, 0x00, 0x24, 0xa1, 0xc0, 0xff, 0x00, 0x62, 0x9c, 0x80, 0xff, 0x00,
+		0x27, 0x6e, 0x80, 0xff, 0x00, 0x61, 0x92, 0x40, 0xff, 0x00, 0x2a, 0x2b, 0x00, 0xff, 0x00, 0x60,
+		0x5f, 0xc0, 0x08, 0xff, 0x00, 0x26, 0xd5, 0xc0, 0x07, 0x0e, 0xff, 0x01, 0x02, 0x3a, 0x80, 0xff,
+		0x02, 0x76, 0xe7, 0xc0, 0x15, 0xff, 0xff, 0xa0, 0xa2, 0x00, 0xff, 0xff, 0xb6, 0xd9, 0xc0, 0xff,
+		0xff, 0xba, 0x55, 0xc0, 0xff, 0xff, 0xac, 0x0e, 0x40, 0x1f, 0x8b, 0xff, 0xff, 0xc2, 0xb7, 0x00,
+		0xff, 0x00, 0x26, 0xba, 0x40, 0xff, 0xff, 0xc8, 0x1b, 0x80, 0xff, 0x00, 0x38, 0x3e, 0x00, 0xff,
+		0xff, 0xe3, 0x46, 0x00, 0xff, 0xff, 0xb6, 0x0d, 0x00, 0xff, 0xff, 0xdd, 0x3c, 0x40, 0xff, 0xff,
+		0xcd, 0x8b, 0x40, 0xff, 0xff, 0xbb, 0xf5, 0x80, 0x8b, 0xff, 0xff, 0xb8, 0x19, 0x00, 0x08, 0xff,
+		0xff, 0xa3, 0x2b, 0x40, 0xff, 0x00, 0x51, 0xed, 0x40, 0xff, 0xff, 0xb5, 0xbc, 0x80, 0xff, 0x00,
+		0x6b, 0x4f, 0x40, 0xff, 0x00, 0x6d, 0x6e, 0x80, 0xff, 0x00, 0x52, 0x5d, 0x00, 0xff, 0x00, 0x4c,
+		0x53, 0xc0, 0xff, 0x00, 0x5e, 0xee, 0x00, 0x1e, 0x8b, 0xff, 0x00, 0x49, 0x5c, 0x80, 0xff, 0xff,
+		0xcd, 0xf9, 0xc0, 0xff, 0x00, 0x42, 0x81, 0x40, 0xff, 0xff, 0xb9, 0xc0, 0xc0, 0xff, 0x00, 0x20,
+		0x68, 0x00, 0xff, 0x00, 0x3c, 0x66, 0x80, 0xff, 0x00, 0x1f, 0xb8, 0x40, 0xff, 0x00, 0x27, 0x04,
+		0xc0, 0xff, 0x00, 0x3a, 0x7a, 0xc0, 0x8b, 0xff, 0x00, 0x3c, 0x08, 0x40, 0x08, 0xff, 0x00, 0x52,
+		0x1b, 0x40, 0xff, 0xff, 0xb9, 0x35, 0xc0, 0xff, 0x00, 0x41, 0x73, 0x00, 0xff, 0xff, 0xa4, 0x90,
+		0x40, 0x1e, 0xff, 0xff, 0xeb, 0x18, 0xc0, 0xff, 0xfe, 0xb8, 0x02, 0x00, 0x15, 0xff, 0x00, 0x50,
+		0x2a, 0xc0, 0xff, 0xff, 0xe6, 0xb5, 0x00, 0xff, 0x00, 0x34, 0xf4, 0x80, 0xff, 0xff, 0xc8, 0xd7,
+		0xc0, 0x8b, 0xff, 0xff, 0xc3, 0x1c, 0x40, 0x08, 0xff, 0xff, 0xc3, 0xec, 0x80, 0xff, 0xff, 0xcc,
+		0xdf, 0x00, 0xff, 0xff, 0xcf, 0x24, 0x40, 0xff, 0xff, 0xbd, 0x63, 0xc0, 0xff, 0xff, 0xbc, 0x36,
+		0xc0, 0xff, 0xff, 0xcb, 0x1c, 0x80, 0xff, 0x00, 0x32, 0x9f, 0xc0, 0xff, 0x00, 0x3e, 0xb2, 0x00,
+		0x1e, 0x8b, 0xff, 0x00, 0x3a, 0xe2, 0x40, 0xff, 0x00, 0x2d, 0xfd, 0x00, 0xff, 0x00, 0x35, 0x73,
+		0x80, 0xff, 0x00, 0x3b, 0x4d, 0xc0, 0xff, 0x00, 0x18, 0x9e, 0xc0, 0x08, 0xff, 0x00, 0x0f, 0x89,
+		0x40, 0xff, 0x01, 0x0d, 0x45, 0x00, 0x15, 0xff, 0x00, 0x37, 0xb2, 0x40, 0xff, 0x00, 0x2b, 0x8b,
+		0xc0, 0xff, 0xff, 0xd6, 0x93, 0x40, 0xff, 0xff, 0xcb, 0xf8, 0x00, 0x1f, 0x8b, 0xff, 0xff, 0xd0,
+		0x0b, 0x40, 0xff, 0xff, 0xdb, 0x1b, 0x00, 0xff, 0xff, 0xd1, 0x7b, 0x40, 0xff, 0xff, 0xcf, 0x75,
+		0x40, 0xff, 0xff, 0xe5, 0xe4, 0x80, 0x08, 0x8b, 0xff, 0xff, 0x92, 0x54, 0x40, 0xff, 0x00, 0x2a,
+		0xc7, 0x40, 0xff, 0x00, 0x52, 0x57, 0x80, 0xff, 0x00, 0x31, 0x1d, 0x40, 0xff, 0x00, 0x29, 0x7c,
+		0x00, 0xff, 0x00, 0x27, 0xcd, 0xc0, 0xff, 0x00, 0x36, 0x61, 0x80, 0x1f, 0x0e, 0xff, 0x00, 0xd9,
+		0x32, 0x00, 0xff, 0xff, 0xf5, 0x82, 0x40, 0x15, 0xff, 0x00, 0x4c, 0x0c, 0x80, 0x8b, 0xff, 0x00,
+		0x4f, 0x93, 0x40, 0xff, 0x00, 0x2d, 0x99, 0x40, 0xff, 0x00, 0x25, 0xc0, 0x80, 0xff, 0x00, 0x63,
+		0x8d, 0x00, 0xff, 0x00, 0x0a, 0xef, 0x80, 0xff, 0x00, 0x1c, 0xd6, 0x40, 0xff, 0x00, 0x0f, 0xbe,
+		0x80, 0xff, 0x00, 0x36, 0x0f, 0x00, 0x8b, 0xff, 0x00, 0x65, 0xfb, 0x40, 0x8b, 0xff, 0x00, 0x4d,
+		0xff, 0x00, 0xff, 0xff, 0xf9, 0x02, 0x80, 0xff, 0x00, 0x35, 0xcf, 0x00, 0xff, 0xff, 0xf1, 0x7e,
+		0xc0, 0xff, 0x00, 0x2a, 0x94, 0xc0, 0xff, 0xff, 0xdf, 0x8a, 0x00, 0xff, 0x00, 0x5f, 0x4c, 0x40,
+		0xff, 0xff, 0xb8, 0x43, 0x40, 0xff, 0x00, 0x27, 0xe8, 0x80, 0xff, 0xff, 0xbe, 0xf5, 0x00, 0x8b,
+		0x08, 0xff, 0xff, 0x9f, 0x11, 0x80, 0xff, 0xff, 0xae, 0x96, 0xc0, 0xff, 0xff, 0xaa, 0x5e, 0x00,
+		0xff, 0xff, 0x87, 0x40, 0x80, 0xff, 0xff, 0x88, 0x4c, 0x40, 0xff, 0x00, 0x50, 0x76, 0x00, 0xff,
+		0xff, 0xb3, 0x06, 0x80, 0xff, 0x00, 0x5a, 0x84, 0xc0, 0x1f, 0xff, 0x00, 0x33, 0x6c, 0x00, 0x8b,
+		0xff, 0x00, 0x30, 0x05, 0x80, 0xff, 0x00, 0x19, 0x3b, 0x80, 0xff, 0x00, 0x1d, 0x0b, 0x00, 0xff,
+		0x00, 0x2a, 0x1e, 0x40, 0xff, 0xff, 0xfd, 0x0a, 0xc0, 0xff, 0xff, 0x9f, 0x1f, 0x00, 0xff, 0xff,
+		0xf0, 0x23, 0x00, 0xff, 0xff, 0xd5, 0xfe, 0xc0, 0xff, 0xff, 0xf9, 0x6e, 0x00, 0xff, 0xff, 0xf0,
+		0x78, 0x40, 0xff, 0xff, 0xe5, 0x59, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xcc, 0x41,
+		0x00, 0xff, 0xff, 0xe9, 0x65, 0x80, 0xff, 0xff, 0xd3, 0x36, 0x40, 0x8b, 0xff, 0xff, 0xd3, 0x49,
+		0x80, 0x8b, 0xff, 0xff, 0xe1, 0xe1, 0xc0, 0xff, 0x00, 0x16, 0x7d, 0x80, 0xff, 0xff, 0xff, 0xcb,
+		0x00, 0xff, 0x00, 0x00, 0x29, 0x00, 0xff, 0xff, 0xf7, 0x8f, 0x80, 0xff, 0x00, 0x06, 0x89, 0x80,
+		0xff, 0x00, 0x02, 0xc5, 0xc0, 0xff, 0x00, 0x0a, 0xc5, 0x00, 0xff, 0xff, 0xf5, 0x5d, 0xc0, 0xff,
+		0x00, 0x06, 0xc0, 0x00, 0x08, 0xff, 0xff, 0xcf, 0xac, 0x40, 0xff, 0xff, 0xca, 0x7e, 0x40, 0x05,
+		0xff, 0x00, 0x24, 0xbd, 0x40, 0xff, 0xff, 0xdb, 0x94, 0xc0, 0xff, 0x00, 0x31, 0xa0, 0x00, 0xff,
+		0xff, 0xeb, 0x53, 0x80, 0xff, 0x00, 0x33, 0x6f, 0x40, 0x8b, 0x08, 0xff, 0x00, 0x1c, 0xc0, 0x00,
+		0xff, 0x01, 0x29, 0xa2, 0xc0, 0x15, 0xff, 0xff, 0xc8, 0x72, 0xc0, 0xff, 0xff, 0xc9, 0xef, 0x00,
+		0xff, 0x00, 0x2d, 0xb9, 0x00, 0xff, 0x00, 0x5c, 0xc2, 0xc0, 0xff, 0x00, 0x5a, 0xac, 0x80, 0xff,
+		0x00, 0x34, 0x33, 0x80, 0xff, 0x00, 0x32, 0xba, 0x00, 0xff, 0x00, 0x38, 0x87, 0xc0, 0x1f, 0xff,
+		0x00, 0x46, 0xec, 0x80, 0x8b, 0xff, 0x00, 0x3b, 0x42, 0xc0, 0xff, 0xff, 0xb2, 0x13, 0x00, 0xff,
+		0xff, 0xf4, 0xf1, 0x40, 0xff, 0xff, 0x82, 0x38, 0x80, 0xff, 0xff, 0xe4, 0x74, 0x80, 0xff, 0xff,
+		0xd1, 0x93, 0x80, 0xff, 0xff, 0xd2, 0x2d, 0x80, 0xff, 0xff, 0xe2, 0x3e, 0xc0, 0xff, 0xff, 0xd3,
+		0x20, 0x80, 0x8b, 0x08, 0x0e, 0xff, 0x01, 0x29, 0xbc, 0x80, 0xff, 0x01, 0x6d, 0x79, 0x80, 0x15,
+		0x24, 0x0a, 0xff, 0xfe, 0xc0, 0xb0, 0xc0, 0x04, 0x24, 0x0a, 0x0e, 0xff, 0x01, 0x31, 0xa2, 0x40,
+		0xff, 0x00, 0x13, 0xb5, 0x00, 0x15, 0x22, 0x0a, 0xff, 0xff, 0xf8, 0x1a, 0x40, 0xff, 0x01, 0x59,
+		0xc4, 0x80, 0x15, 0x24, 0x0a, 0x0e, 0xff, 0x01, 0xca, 0x40, 0xc0, 0xff, 0x01, 0xf0, 0x39, 0x80,
+		0x15, 0xff, 0xfe, 0xa5, 0x13, 0x00, 0xff, 0xff, 0x4f, 0x15, 0xc0, 0xff, 0x01, 0x5d, 0x83, 0xc0,
+		0xff, 0xff, 0x3b, 0x3c, 0x80, 0x8b, 0xff, 0xff, 0xb4, 0xeb, 0x40, 0xff, 0xfe, 0x55, 0xad, 0x80,
+		0xff, 0x00, 0xf8, 0x8b, 0x40, 0x8b, 0xff, 0x00, 0x30, 0x54, 0x00, 0xff, 0x01, 0xa7, 0xbb, 0xc0,
+		0xff, 0x00, 0xde, 0xa7, 0x80, 0x05, 0x0e, 0xff, 0x00, 0x2c, 0xe0, 0x40, 0xff, 0x01, 0xb6, 0x67,
+		0x40, 0x15, 0x25, 0x0a, 0xff, 0xfe, 0x65, 0x36, 0x40, 0xff, 0xff, 0x30, 0xe1, 0x40, 0x15, 0x25,
+		0x0a, 0x0e, 0xff, 0x00, 0x2a, 0x49, 0x80, 0xff, 0x01, 0xf0, 0x39, 0x80, 0x15, 0xff, 0x01, 0x5a,
+		0xed, 0x00, 0xff, 0xff, 0x4f, 0x15, 0xc0, 0xff, 0xfe, 0xa2, 0x7c, 0x40, 0xff, 0xff, 0x3b, 0x3c,
+		0x80, 0x8b, 0xff, 0xff, 0xb4, 0xeb, 0x40, 0xff, 0x01, 0xaa, 0x52, 0x40, 0xff, 0x00, 0xf8, 0x8b,
+		0x40, 0x8b, 0xff, 0x00, 0x30, 0x54, 0x00, 0xff, 0xfe, 0x58, 0x44, 0x80, 0xff, 0x00, 0xde, 0xa7,
+		0x80, 0x05, 0x0e, 0xff, 0x01, 0x40, 0x2c, 0xc0, 0xff, 0x00, 0x2c, 0x70, 0x40, 0x15, 0xff, 0x00,
+		0x1f, 0x78, 0xc0, 0xff, 0xff, 0xe5, 0xb9, 0x80, 0xff, 0x00, 0x19, 0xed, 0x00, 0xff, 0xff, 0xdf,
+		0x20, 0x00, 0xff, 0xff, 0xdf, 0x23, 0x40, 0xff, 0xff, 0xe5, 0xbd, 0x00, 0xff, 0xff, 0xe6, 0x13,
+		0x80, 0xff, 0xff, 0xe0, 0x8a, 0x40, 0xff, 0xff, 0xe0, 0x79, 0xc0, 0xff, 0x00, 0x1a, 0x4a, 0x40,
+		0xff, 0xff, 0xe6, 0x16, 0x80, 0xff, 0x00, 0x20, 0xd1, 0x00, 0xff, 0x00, 0x20, 0xe3, 0xc0, 0xff,
+		0x00, 0x1a, 0x47, 0x40, 0xff, 0x00, 0x19, 0xef, 0xc0, 0xff, 0x00, 0x1f, 0x7c, 0x80, 0x1e, 0xff,
+		0xfe, 0xff, 0xb0, 0x00, 0xff, 0x02, 0x04, 0x83, 0x00, 0x15, 0xff, 0x00, 0x32, 0xea, 0xc0, 0xff,
+		0xff, 0xd0, 0x89, 0x00, 0x05, 0xff, 0x00, 0x1f, 0x89, 0x00, 0xff, 0x00, 0x34, 0xbd, 0x40, 0xff,
+		0x00, 0x35, 0x14, 0x00, 0xff, 0x00, 0x21, 0xb1, 0x40, 0xff, 0x00, 0x32, 0x8f, 0xc0, 0x8b, 0xff,
+		0x00, 0x3b, 0xd1, 0x80, 0x8b, 0xff, 0x00, 0x2d, 0x6b, 0x00, 0xff, 0xff, 0xd1, 0x6c, 0x40, 0x8b,
+		0xff, 0xff, 0xc4, 0xe8, 0x80, 0x8b, 0xff, 0xff, 0xbe, 0x7c, 0x80, 0xff, 0xff, 0xcc, 0x21, 0x00,
+		0xff, 0xff, 0xd7, 0x28, 0x00, 0xff, 0xff, 0xe1, 0xc6, 0xc0, 0xff, 0xff, 0xde, 0xd0, 0x40, 0xff,
+		0xff, 0xd3, 0xd2, 0xc0, 0xff, 0xff, 0xcf, 0x7e, 0x40, 0xff, 0xff, 0xfd, 0x30, 0x00, 0xff, 0xff,
+		0xdc, 0xcc, 0x00, 0x8b, 0xff, 0xff, 0xd3, 0x1c, 0xc0, 0x08, 0xff, 0xff, 0xd6, 0x93, 0x40, 0xff,
+		0x00, 0x41, 0x96, 0x80, 0xff, 0x00, 0x29, 0x6c, 0xc0, 0x07, 0x8b, 0xff, 0x00, 0x23, 0x3d, 0x80,
+		0xff, 0x00, 0x02, 0x52, 0xc0, 0xff, 0x00, 0x1d, 0xb7, 0x40, 0xff, 0x00, 0x29, 0x2d, 0x00, 0xff,
+		0x00, 0x24, 0x99, 0x00, 0xff, 0x00, 0x21, 0x00, 0xc0, 0xff, 0x00, 0x1d, 0x55, 0x80, 0xff, 0x00,
+		0x42, 0x19, 0x80, 0xff, 0x00, 0x26, 0x0c, 0x80, 0x8b, 0xff, 0x00, 0x5d, 0xf7, 0x40, 0x8b, 0xff,
+		0x00, 0x5d, 0x33, 0x00, 0xff, 0xff, 0xbf, 0xac, 0x00, 0xff, 0x00, 0x53, 0x37, 0x80, 0xff, 0xff,
+		0x8e, 0xb0, 0xc0, 0x8b, 0xff, 0xff, 0xb5, 0x1f, 0x00, 0x8b, 0xff, 0xff, 0xb5, 0x99, 0x80, 0xff,
+		0xff, 0xda, 0x92, 0xc0, 0xff, 0xff, 0xd4, 0x7b, 0xc0, 0xff, 0xff, 0xbc, 0xf3, 0xc0, 0x08, 0x0e,
+		0xff, 0x01, 0xb2, 0xf3, 0xc0, 0xff, 0x00, 0x1e, 0x34, 0x80, 0x15, 0xff, 0xff, 0xe5, 0x3f, 0x40,
+		0xff, 0x00, 0x30, 0x54, 0x00, 0x05, 0xff, 0xff, 0xe0, 0x3e, 0x80, 0xff, 0xff, 0xea, 0x95, 0x00,
+		0xff, 0xff, 0xda, 0x94, 0x40, 0xff, 0xff, 0xf4, 0x90, 0xc0, 0xff, 0xff, 0xd9, 0xb9, 0x40, 0x8b,
+		0x08, 0xff, 0xff, 0x9f, 0x1e, 0x80, 0xff, 0xff, 0x8d, 0x03, 0x80, 0xff, 0x00, 0x4c, 0x31, 0x40,
+		0xff, 0x00, 0xc3, 0x0e, 0xc0, 0xff, 0x00, 0xb3, 0xda, 0xc0, 0xff, 0x00, 0x5c, 0xf7, 0x00, 0xff,
+		0x00, 0x52, 0x4c, 0xc0, 0xff, 0x00, 0x56, 0xa2, 0x40, 0x1f, 0xff, 0x00, 0x4a, 0xbd, 0xc0, 0x8b,
+		0xff, 0x00, 0x3a, 0xe3, 0x00, 0xff, 0xff, 0xc3, 0x59, 0x00, 0xff, 0x00, 0x00, 0x0d, 0x80, 0xff,
+		0xff, 0xb6, 0x03, 0x40, 0x08, 0xff, 0xff, 0xf1, 0x54, 0x40, 0x06, 0xff, 0xff, 0xd9, 0xcf, 0x40,
+		0x8b, 0xff, 0xff, 0xd8, 0x20, 0x40, 0xff, 0xff, 0xff, 0xc1, 0x40, 0xff, 0xff, 0xd8, 0x84, 0x80,
+		0xff, 0xff, 0xf0, 0x59, 0xc0, 0xff, 0xff, 0xc2, 0x04, 0xc0, 0xff, 0xff, 0xe7, 0x6e, 0xc0, 0xff,
+		0xff, 0xde, 0xf2, 0x00, 0xff, 0xff, 0xca, 0xc4, 0x80, 0x8b, 0xff, 0xff, 0xca, 0x17, 0x40, 0x8b,
+		0xff, 0xff, 0xb7, 0xad, 0x80, 0xff, 0x00, 0x3a, 0x5c, 0x40, 0xff, 0xff, 0xc5, 0xfd, 0x00, 0xff,
+		0x00, 0x47, 0x97, 0x40, 0x8b, 0xff, 0x00, 0x26, 0x8b, 0x40, 0x8b, 0xff, 0x00, 0x24, 0x95, 0x80,
+		0xff, 0x00, 0x11, 0x15, 0x00, 0xff, 0x00, 0x18, 0xc3, 0x80, 0xff, 0x00, 0x1d, 0x92, 0x40, 0x08,
+		0xff, 0xff, 0xda, 0x07, 0x40, 0xff, 0x00, 0x3c, 0x69, 0x00, 0xff, 0x00, 0xca, 0xce, 0x00, 0x07,
+		0x8b, 0xff, 0x00, 0x2f, 0xa7, 0x00, 0xff, 0xff, 0xff, 0x5c, 0xc0, 0xff, 0x00, 0x30, 0x2c, 0x80,
+		0xff, 0xff, 0xea, 0x36, 0xc0, 0xff, 0x00, 0x30, 0x18, 0x00, 0xff, 0xff, 0xdf, 0xdc, 0x00, 0xff,
+		0x00, 0x46, 0xf3, 0x40, 0xff, 0xff, 0xbd, 0x46, 0x00, 0xff, 0x00, 0x27, 0xb7, 0x00, 0xff, 0xff,
+		0xb7, 0x80, 0xc0, 0x8b, 0x08, 0xff, 0xff, 0x92, 0xd2, 0x80, 0xff, 0xff, 0x7c, 0xdb, 0xc0, 0xff,
+		0xff, 0xa4, 0x24, 0x00, 0xff, 0xff, 0x1d, 0x2b, 0x00, 0xff, 0xff, 0x17, 0xe1, 0xc0, 0xff, 0x00,
+		0x8b, 0x24, 0x00, 0xff, 0xff, 0xa3, 0x01, 0xc0, 0xff, 0x00, 0x7c, 0xae, 0x00, 0x1f, 0xff, 0x00,
+		0x31, 0x8c, 0x40, 0x8b, 0xff, 0x00, 0x30, 0xa5, 0xc0, 0xff, 0x00, 0x0e, 0x5e, 0x00, 0xff, 0x00,
+		0x29, 0xe3, 0x00, 0xff, 0x00, 0x1b, 0x0f, 0xc0, 0x08, 0xff, 0xff, 0xe1, 0xcb, 0x80, 0xff, 0x01,
+		0x6c, 0x2f, 0x80, 0x15, 0xff, 0xff, 0xed, 0x03, 0xc0, 0x07, 0x8b, 0xff, 0xff, 0xd8, 0x5c, 0x00,
+		0xff, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xd9, 0xce, 0x00, 0xff, 0xff, 0xf0, 0x66, 0x40, 0xff,
+		0xff, 0xe1, 0xaf, 0x40, 0xff, 0xff, 0xf0, 0x87, 0x40, 0xff, 0xff, 0xe1, 0xef, 0x00, 0xff, 0xff,
+		0xe2, 0xa2, 0xc0, 0xff, 0xff, 0xf0, 0x92, 0x80, 0xff, 0xff, 0xe3, 0x20, 0x40, 0x8b, 0xff, 0xff,
+		0xd4, 0x1c, 0x40, 0x8b, 0xff, 0xff, 0xdc, 0xc7, 0x00, 0xff, 0x00, 0x22, 0xc0, 0xc0, 0x8b, 0xff,
+		0x00, 0x2b, 0x44, 0x80, 0x8b, 0xff, 0x00, 0x19, 0x95, 0x40, 0xff, 0x00, 0x0c, 0xaa, 0x00, 0xff,
+		0x00, 0x1b, 0x0b, 0x40, 0xff, 0x00, 0x1a, 0xed, 0xc0, 0xff, 0x00, 0x12, 0x7c, 0x40, 0xff, 0x00,
+		0x21, 0xbd, 0x40, 0xff, 0x00, 0x17, 0x29, 0x00, 0xff, 0x00, 0x29, 0xfe, 0x00, 0xff, 0x00, 0x00,
+		0x56, 0x80, 0xff, 0x00, 0x23, 0xc3, 0x80, 0x8b, 0x08, 0x0e, 0xff, 0x00, 0x0e, 0xab, 0xc0, 0xff,
+		0xff, 0xff, 0x23, 0x00, 0x15, 0x26, 0x0a, 0xff, 0x00, 0x5b, 0x7a, 0x40, 0xff, 0xfe, 0x72, 0x28,
+		0x40, 0x15, 0x27, 0x0a, 0x0e, 0xff, 0x00, 0x30, 0x54, 0x00, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15,
+		0xff, 0xfd, 0x90, 0xea, 0x00, 0xff, 0x00, 0xb0, 0x0d, 0x40, 0x07, 0xff, 0x00, 0x2a, 0x62, 0x00,
+		0x8b, 0xff, 0x00, 0x2a, 0xe5, 0xc0, 0xff, 0x00, 0x00, 0x7e, 0x00, 0xff, 0x00, 0x2b, 0x0f, 0x00,
+		0xff, 0x00, 0x12, 0x4c, 0x40, 0xff, 0x00, 0x43, 0x0d, 0xc0, 0xff, 0x00, 0x1c, 0x7e, 0x80, 0xff,
+		0x00, 0x24, 0xdc, 0x40, 0xff, 0x00, 0x3d, 0x03, 0x40, 0x8b, 0xff, 0x00, 0x40, 0x38, 0x40, 0x8b,
+		0xff, 0x00, 0x48, 0x8f, 0x00, 0xff, 0xff, 0xd1, 0x33, 0x40, 0xff, 0x00, 0x41, 0x60, 0x40, 0xff,
+		0xff, 0xba, 0x30, 0x80, 0xff, 0x00, 0x17, 0x87, 0xc0, 0xff, 0x00, 0x37, 0xe9, 0x80, 0xff, 0x00,
+		0x16, 0xcf, 0x80, 0xff, 0x00, 0x24, 0x6d, 0xc0, 0xff, 0x00, 0x36, 0x55, 0x40, 0x8b, 0xff, 0x00,
+		0x3b, 0xbc, 0x80, 0x8b, 0xff, 0x00, 0x37, 0xfe, 0x00, 0xff, 0xff, 0xdf, 0xd4, 0x80, 0xff, 0x00,
+		0x35, 0x63, 0x40, 0xff, 0xff, 0xc5, 0x73, 0x40, 0xff, 0x00, 0x19, 0x76, 0x00, 0xff, 0xff, 0xd9,
+		0x03, 0x80, 0xff, 0x00, 0x10, 0xf3, 0xc0, 0xff, 0xff, 0xd8, 0xe7, 0x00, 0xff, 0x00, 0x00, 0x6e,
+		0x80, 0xff, 0xff, 0xd9, 0xaf, 0x00, 0x8b, 0x08, 0xff, 0xff, 0x94, 0x20, 0x00, 0xff, 0xff, 0xc4,
+		0x74, 0x00, 0x15, 0xff, 0x00, 0x62, 0x61, 0xc0, 0x06, 0xff, 0x00, 0x1a, 0x9c, 0x00, 0x8b, 0xff,
+		0x00, 0x1c, 0x7a, 0x80, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0x00, 0x1b, 0xb1, 0x80, 0xff, 0xff,
+		0xf4, 0xd0, 0x40, 0xff, 0x00, 0x29, 0x51, 0x40, 0xff, 0xff, 0xef, 0x4f, 0x80, 0xff, 0x00, 0x15,
+		0xe5, 0x00, 0xff, 0xff, 0xdc, 0xb3, 0x80, 0x8b, 0xff, 0xff, 0xdc, 0x25, 0x80, 0x8b, 0xff, 0xff,
+		0xdc, 0x6f, 0x40, 0xff, 0xff, 0xea, 0xa5, 0x00, 0xff, 0xff, 0xdd, 0xb5, 0x00, 0xff, 0xff, 0xd8,
+		0xc4, 0x80, 0xff, 0xff, 0xef, 0x05, 0x40, 0xff, 0xff, 0xe3, 0x51, 0x00, 0xff, 0xff, 0xf3, 0x96,
+		0x80, 0xff, 0xff, 0xe2, 0x28, 0x00, 0xff, 0xff, 0xff, 0xe2, 0xc0, 0xff, 0xff, 0xe4, 0x42, 0x40,
+		0x8b, 0x08, 0xff, 0xff, 0x9e, 0x7b, 0x40, 0x06, 0xff, 0xff, 0xc5, 0x51, 0x00, 0x04, 0xff, 0x00,
+		0x65, 0xd5, 0x80, 0x06, 0xff, 0x00, 0x1f, 0x79, 0xc0, 0x8b, 0xff, 0x00, 0x1e, 0xea, 0x80, 0xff,
+		0xff, 0xff, 0x64, 0x80, 0xff, 0x00, 0x1f, 0x1a, 0x40, 0xff, 0xff, 0xf1, 0x3c, 0xc0, 0xff, 0x00,
+		0x2e, 0x3f, 0xc0, 0xff, 0xff, 0xea, 0x0c, 0x80, 0xff, 0x00, 0x18, 0x86, 0x80, 0xff, 0xff, 0xd3,
+		0x88, 0x00, 0x8b, 0xff, 0xff, 0xd2, 0xf0, 0x00, 0x8b, 0xff, 0xff, 0xd3, 0x71, 0x40, 0xff, 0xff,
+		0xe8, 0x4b, 0x40, 0xff, 0xff, 0xd6, 0x51, 0x00, 0xff, 0xff, 0xd4, 0xf1, 0x80, 0xff, 0xff, 0xec,
+		0x99, 0x40, 0xff, 0xff, 0xe5, 0x17, 0x40, 0xff, 0xff, 0xf3, 0xe0, 0x00, 0xff, 0xff, 0xe5, 0x97,
+		0xc0, 0xff, 0xff, 0xff, 0x87, 0x40, 0xff, 0xff, 0xe5, 0x12, 0x00, 0x8b, 0x08, 0xff, 0xff, 0x88,
+		0xe8, 0x00, 0x06, 0x0e, 0xff, 0x01, 0x15, 0x8e, 0x80, 0xff, 0x02, 0x74, 0x43, 0x80, 0x15, 0x28,
+		0x0a, 0x0e, 0xff, 0x00, 0x35, 0x81, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0x29, 0x0a, 0xff,
+		0xff, 0xb0, 0x9a, 0xc0, 0xff, 0xff, 0xc4, 0x74, 0x00, 0x15, 0x2a, 0x0a, 0x0e, 0xff, 0x00, 0x3a,
+		0xaf, 0x00, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0x2b, 0x0a, 0x0e, 0xff, 0x00, 0x4d, 0xab, 0x80,
+		0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xfd, 0x90, 0x0d, 0x00, 0xff, 0x00, 0x46, 0xc4, 0x00,
+		0xff, 0x01, 0x32, 0x5d, 0x80, 0xff, 0x00, 0xe9, 0x02, 0xc0, 0xff, 0x00, 0x3c, 0x69, 0x00, 0xff,
+		0xff, 0x16, 0xfd, 0x40, 0xff, 0x00, 0xc3, 0xe6, 0x80, 0xff, 0x01, 0x20, 0x3e, 0x00, 0xff, 0x00,
+		0x3d, 0x46, 0x00, 0x07, 0x0e, 0xff, 0x01, 0x15, 0x3e, 0x80, 0xff, 0x02, 0x75, 0x25, 0x40, 0x15,
+		0x2c, 0x0a, 0x0e, 0xff, 0x00, 0x36, 0x5e, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0xff, 0xfd,
+		0x90, 0xea, 0x00, 0xff, 0x00, 0x48, 0x7e, 0x00, 0xff, 0x01, 0x28, 0xdf, 0x40, 0xff, 0x00, 0xf3,
+		0x5d, 0x80, 0xff, 0xfe, 0xd6, 0x43, 0xc0, 0xff, 0x00, 0x46, 0xc4, 0x40, 0xff, 0x02, 0x59, 0x83,
+		0x00, 0x07, 0x8b, 0xff, 0x00, 0x0a, 0x5c, 0x40, 0xff, 0x00, 0x07, 0x31, 0x80, 0xff, 0x00, 0x00,
+		0x4f, 0x40, 0x8b, 0xff, 0x00, 0x07, 0x92, 0x00, 0x8b, 0xff, 0x00, 0x01, 0x7e, 0x00, 0xff, 0xff,
+		0xff, 0x99, 0xc0, 0xff, 0x00, 0x01, 0x73, 0x00, 0xff, 0xff, 0xff, 0x3f, 0x40, 0xff, 0x00, 0x01,
+		0x41, 0x80, 0x08, 0xff, 0xff, 0xb4, 0x0e, 0x40, 0xff, 0xfe, 0xf5, 0x55, 0x40, 0xff, 0xff, 0x0b,
+		0xc5, 0x80, 0xff, 0x00, 0xf2, 0x80, 0xc0, 0x06, 0x8b, 0xff, 0x00, 0x0a, 0xaf, 0x00, 0xff, 0x00,
+		0x06, 0x42, 0x00, 0xff, 0x00, 0x01, 0x02, 0x40, 0x8b, 0xff, 0x00, 0x07, 0xdd, 0xc0, 0x8b, 0xff,
+		0x00, 0x01, 0x9c, 0x40, 0xff, 0xff, 0xff, 0xa1, 0x40, 0xff, 0x00, 0x01, 0x93, 0xc0, 0xff, 0xff,
+		0xff, 0x4a, 0x40, 0xff, 0x00, 0x01, 0x6b, 0x00, 0x08, 0x0e, 0xff, 0x00, 0x58, 0x06, 0xc0, 0xff,
+		0x02, 0x6f, 0x16, 0x00, 0x15, 0x2d, 0x0a, 0x0e, 0xff, 0x00, 0xab, 0xbc, 0xc0, 0xff, 0x02, 0x6f,
+		0x16, 0x00, 0x15, 0xff, 0xff, 0xc5, 0x51, 0x00, 0xff, 0x00, 0x77, 0xf5, 0x00, 0xff, 0xfe, 0x9b,
+		0x94, 0xc0, 0x07, 0x8b, 0xff, 0xff, 0xd9, 0x6c, 0x40, 0xff, 0x00, 0x00, 0xda, 0x80, 0xff, 0xff,
+		0xd3, 0x86, 0x40, 0xff, 0xff, 0xe8, 0xcd, 0x00, 0xff, 0xff, 0xdd, 0x71, 0xc0, 0xff, 0xff, 0xef,
+		0x53, 0xc0, 0xff, 0xff, 0xe7, 0x2a, 0x00, 0xff, 0xff, 0xe4, 0xf3, 0x80, 0xff, 0xff, 0xf1, 0x1a,
+		0x80, 0xff, 0xff, 0xe2, 0x10, 0xc0, 0x8b, 0xff, 0xff, 0xcb, 0xe0, 0xc0, 0x8b, 0xff, 0xff, 0xd8,
+		0x8f, 0xc0, 0xff, 0x00, 0x2b, 0x49, 0xc0, 0xff, 0xff, 0xfd, 0xd7, 0x80, 0xff, 0x00, 0x02, 0xc8,
+		0xc0, 0xff, 0xff, 0xfb, 0x90, 0xc0, 0xff, 0x00, 0x05, 0xb8, 0x00, 0xff, 0x00, 0x04, 0x30, 0x00,
+		0xff, 0x00, 0x06, 0xe4, 0x00, 0xff, 0xff, 0xfa, 0x11, 0x00, 0xff, 0x00, 0x05, 0x74, 0x80, 0x08,
+		0xff, 0xff, 0xd1, 0x66, 0x00, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0x05, 0xff, 0x00, 0x24, 0xe8, 0x80,
+		0xff, 0xff, 0xd3, 0xd6, 0x80, 0xff, 0x00, 0x35, 0x61, 0x00, 0xff, 0xff, 0xe7, 0x08, 0xc0, 0xff,
+		0x00, 0x37, 0x19, 0x00, 0x8b, 0xff, 0x00, 0x3a, 0xfe, 0x80, 0x8b, 0xff, 0x00, 0x36, 0x03, 0x00,
+		0xff, 0x00, 0x1d, 0x02, 0x80, 0xff, 0x00, 0x1c, 0xe0, 0x80, 0xff, 0x00, 0x36, 0x0a, 0x00, 0xff,
+		0x00, 0x17, 0xde, 0x80, 0xff, 0x00, 0x2c, 0xab, 0x00, 0xff, 0x00, 0x00, 0x68, 0x00, 0xff, 0x00,
+		0x2f, 0x50, 0x00, 0x8b, 0xff, 0x00, 0x2d, 0x1f, 0x80, 0x08, 0xff, 0x01, 0x63, 0x8e, 0x80, 0xff,
+		0x00, 0x5f, 0xcb, 0x00, 0xff, 0x00, 0x3a, 0xaf, 0x00, 0x07, 0x0e, 0xff, 0x00, 0x2a, 0x49, 0x80,
+		0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xfd, 0x90, 0x0d, 0x00, 0xff, 0x00, 0x4a, 0x37, 0xc0,
+		0xff, 0x01, 0x02, 0x09, 0x80, 0x07, 0xff, 0x00, 0x31, 0x31, 0x00, 0xff, 0x00, 0x35, 0x81, 0x80,
+		0xff, 0x00, 0xd8, 0x9c, 0xc0, 0xff, 0xfe, 0xc4, 0x24, 0x40, 0x05, 0x8b, 0x8b, 0xff, 0x00, 0x27,
+		0x88, 0xc0, 0xff, 0x00, 0x03, 0x9a, 0x40, 0xff, 0x00, 0x31, 0x5b, 0x00, 0xff, 0xff, 0xff, 0xd9,
+		0x80, 0x08, 0xff, 0xff, 0x04, 0x01, 0x00, 0xff, 0x01, 0x62, 0xb1, 0x80, 0xff, 0x00, 0xeb, 0x99,
+		0x40, 0xff, 0x01, 0x0d, 0x41, 0x80, 0xff, 0xff, 0xe6, 0x1c, 0x40, 0x8b, 0x05, 0xff, 0xff, 0xef,
+		0x12, 0x40, 0x8b, 0xff, 0xff, 0xee, 0x49, 0x40, 0xff, 0x00, 0x00, 0xd1, 0x00, 0xff, 0xff, 0xee,
+		0xdc, 0xc0, 0xff, 0x00, 0x04, 0x5c, 0x80, 0x08, 0xff, 0xfe, 0xfb, 0x5f, 0xc0, 0xff, 0xfe, 0xdb,
+		0x71, 0x80, 0x8b, 0xff, 0x01, 0x06, 0x5a, 0x00, 0x05, 0x8b, 0xff, 0x00, 0x04, 0x54, 0x00, 0xff,
+		0x00, 0x00, 0x5c, 0x80, 0xff, 0x00, 0x02, 0xa8, 0x40, 0xff, 0x00, 0x03, 0x7e, 0x40, 0xff, 0x00,
+		0x04, 0x8b, 0x40, 0xff, 0x00, 0x02, 0x51, 0xc0, 0xff, 0x00, 0x03, 0x03, 0x80, 0xff, 0x00, 0x04,
+		0x6e, 0x00, 0xff, 0x00, 0x04, 0x98, 0x40, 0xff, 0xff, 0xfe, 0xe3, 0xc0, 0xff, 0x00, 0x06, 0xc0,
+		0xc0, 0x08, 0x0e, 0xff, 0x00, 0x42, 0x73, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0x2e, 0x0a,
+		0x0e, 0xff, 0x00, 0x28, 0x8f, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0xff, 0xfd, 0x90, 0x0d,
+		0x00, 0xff, 0x00, 0x41, 0x96, 0xc0, 0xff, 0x01, 0xd3, 0xbf, 0x00, 0x07, 0xff, 0x00, 0x7d, 0xff,
+		0x80, 0xff, 0xff, 0x08, 0x51, 0xc0, 0xff, 0x00, 0x1a, 0xc0, 0xc0, 0x8b, 0xff, 0x00, 0x86, 0xa0,
+		0xc0, 0xff, 0x00, 0xfb, 0x22, 0x00, 0x8b, 0xff, 0xfe, 0x28, 0xcd, 0x40, 0xff, 0x00, 0x42, 0x73,
+		0x40, 0x8b, 0x8b, 0xff, 0x02, 0x70, 0xd0, 0x00, 0xff, 0xff, 0xcb, 0x5b, 0x80, 0x8b, 0xff, 0xff,
+		0x62, 0xef, 0x00, 0xff, 0xfe, 0xce, 0x7f, 0x80, 0xff, 0xff, 0x65, 0x86, 0x00, 0xff, 0x01, 0x30,
+		0xa3, 0x80, 0x05, 0x0e, 0xff, 0x00, 0x32, 0x0d, 0xc0, 0x16, 0x2f, 0x0a, 0x0e, 0xff, 0x01, 0xd7,
+		0x34, 0x80, 0xff, 0x01, 0x36, 0x40, 0x80, 0x15, 0x30, 0x0a, 0xff, 0xff, 0x23, 0x60, 0x80, 0xff,
+		0x00, 0xfe, 0x28, 0x80, 0x15, 0x31, 0x0a, 0x0e, 0xff, 0x00, 0x3a, 0xaf, 0x00, 0xff, 0x02, 0x6f,
+		0x16, 0x00, 0x15, 0xff, 0xfd, 0x90, 0xea, 0x00, 0xff, 0x00, 0x48, 0x7e, 0x00, 0xff, 0x01, 0x13,
+		0x4c, 0x00, 0xff, 0x00, 0x7a, 0x8b, 0xc0, 0x8b, 0x07, 0xff, 0x00, 0x26, 0xd0, 0xc0, 0x8b, 0xff,
+		0x00, 0x25, 0x5a, 0xc0, 0xff, 0x00, 0x00, 0xf6, 0xc0, 0xff, 0x00, 0x25, 0xd8, 0x40, 0xff, 0x00,
+		0x13, 0x3d, 0x00, 0xff, 0x00, 0x39, 0x9f, 0x00, 0xff, 0x00, 0x1d, 0x4a, 0xc0, 0xff, 0x00, 0x1e,
+		0x52, 0x00, 0xff, 0x00, 0x3b, 0xad, 0x80, 0x8b, 0xff, 0x00, 0x3f, 0x2b, 0x40, 0x8b, 0xff, 0x00,
+		0x3f, 0x03, 0xc0, 0xff, 0xff, 0xe1, 0xa2, 0x00, 0xff, 0x00, 0x3c, 0xf9, 0x00, 0xff, 0xff, 0xc5,
+		0x23, 0xc0, 0xff, 0x00, 0x1e, 0x50, 0x00, 0xff, 0xff, 0xd8, 0xed, 0xc0, 0xff, 0x00, 0x14, 0x1f,
+		0x00, 0xff, 0xff, 0xd9, 0x58, 0x80, 0xff, 0x00, 0x01, 0x07, 0x00, 0xff, 0xff, 0xd7, 0xd1, 0xc0,
+		0x8b, 0x08, 0xff, 0xff, 0x8a, 0xa1, 0xc0, 0xff, 0xff, 0xbe, 0x69, 0x80, 0x15, 0xff, 0x00, 0x75,
+		0x5e, 0x40, 0x06, 0xff, 0x00, 0x1a, 0x08, 0x40, 0x8b, 0xff, 0x00, 0x19, 0x0c, 0x80, 0xff, 0xff,
+		0xff, 0x5d, 0x00, 0xff, 0x00, 0x19, 0x65, 0xc0, 0xff, 0xff, 0xf3, 0x42, 0x80, 0xff, 0x00, 0x26,
+		0xd8, 0x00, 0xff, 0xff, 0xec, 0x83, 0xc0, 0xff, 0x00, 0x14, 0x2b, 0xc0, 0xff, 0xff, 0xd8, 0x5b,
+		0x80, 0x8b, 0xff, 0xff, 0xd7, 0x70, 0xc0, 0x8b, 0xff, 0xff, 0xd8, 0x44, 0x00, 0xff, 0xff, 0xec,
+		0xb7, 0xc0, 0xff, 0xff, 0xda, 0xe0, 0x00, 0xff, 0xff, 0xdb, 0xe7, 0x00, 0xff, 0xff, 0xed, 0xbc,
+		0x80, 0xff, 0xff, 0xe7, 0xf9, 0xc0, 0xff, 0xff, 0xf3, 0xd8, 0x40, 0xff, 0xff, 0xe8, 0x3e, 0x80,
+		0xff, 0xff, 0xff, 0x6a, 0x40, 0xff, 0xff, 0xe7, 0x6f, 0x00, 0x8b, 0x08, 0xff, 0xff, 0x82, 0x00,
+		0xc0, 0x06, 0x0e, 0xff, 0x00, 0xfa, 0xb1, 0xc0, 0xff, 0x02, 0x36, 0x26, 0x40, 0x15, 0xff, 0x00,
+		0x2b, 0xde, 0x00, 0x8b, 0xff, 0x00, 0x35, 0xe9, 0xc0, 0xff, 0xff, 0xe6, 0x23, 0xc0, 0xff, 0x00,
+		0x1e, 0x06, 0xc0, 0xff, 0xff, 0xb6, 0x68, 0x00, 0xff, 0x00, 0x15, 0xb0, 0xc0, 0xff, 0xff, 0xca,
+		0xd5, 0x40, 0xff, 0x00, 0x03, 0xcc, 0x00, 0xff, 0xff, 0xc3, 0x68, 0x80, 0x8b, 0xff, 0xff, 0xcb,
+		0x9c, 0x40, 0x08, 0xff, 0xff, 0x30, 0xf3, 0xc0, 0xff, 0xff, 0x9f, 0x40, 0x00, 0xff, 0xff, 0xd9,
+		0xba, 0x00, 0xff, 0xff, 0xcb, 0xb7, 0x00, 0xff, 0xff, 0xb6, 0xc0, 0x80, 0xff, 0xff, 0xab, 0xc7,
+		0x80, 0xff, 0x00, 0x45, 0xcd, 0xc0, 0xff, 0x00, 0xc5, 0xa0, 0x80, 0xff, 0x00, 0xb6, 0xf7, 0x00,
+		0xff, 0x00, 0x55, 0x47, 0x00, 0xff, 0x00, 0x3c, 0x87, 0x40, 0xff, 0x00, 0x43, 0xee, 0xc0, 0x1e,
+		0xff, 0x00, 0xdc, 0x84, 0x40, 0xff, 0xfe, 0xfe, 0xb3, 0x80, 0x15, 0x8b, 0xff, 0x00, 0x3b, 0x13,
+		0x80, 0xff, 0xff, 0xfb, 0xde, 0x00, 0xff, 0x00, 0x4c, 0xdd, 0x80, 0xff, 0xff, 0xde, 0xb0, 0x40,
+		0xff, 0x00, 0x42, 0x56, 0x00, 0xff, 0xff, 0xd7, 0x5e, 0xc0, 0xff, 0x00, 0x50, 0xe8, 0x00, 0xff,
+		0xff, 0xb8, 0xc8, 0x40, 0xff, 0x00, 0x25, 0xf4, 0xc0, 0xff, 0xff, 0xbb, 0xa2, 0x80, 0x8b, 0xff,
+		0xff, 0xa3, 0x5a, 0x80, 0x8b, 0xff, 0xff, 0x7c, 0x6f, 0x00, 0xff, 0xff, 0xb7, 0xd0, 0xc0, 0x8b,
+		0xff, 0xff, 0x0a, 0x92, 0x40, 0x8b, 0xff, 0xff, 0x22, 0x9e, 0x80, 0xff, 0x00, 0x69, 0xf5, 0x00,
+		0xff, 0xff, 0xab, 0xf8, 0x40, 0xff, 0x00, 0x5a, 0xa0, 0x80, 0xff, 0xff, 0xf1, 0xc7, 0xc0, 0xff,
+		0xff, 0xff, 0x27, 0x80, 0xff, 0xff, 0xc7, 0x0e, 0xc0, 0xff, 0x00, 0x0f, 0x5e, 0x80, 0xff, 0xff,
+		0xd5, 0x05, 0x00, 0xff, 0x00, 0x2d, 0x68, 0x80, 0xff, 0xff, 0xe9, 0x76, 0x40, 0xff, 0x00, 0x26,
+		0xc6, 0x40, 0xff, 0xff, 0xec, 0xc0, 0x80, 0xff, 0x00, 0x2b, 0x8d, 0x80, 0xff, 0x00, 0x04, 0x98,
+		0x80, 0xff, 0x00, 0x47, 0xf2, 0x40, 0xff, 0xff, 0xff, 0x62, 0x00, 0x08, 0xff, 0x00, 0x01, 0xba,
+		0x00, 0xff, 0x00, 0x44, 0x2d, 0x80, 0x05, 0xff, 0xff, 0xe0, 0x38, 0xc0, 0xff, 0xff, 0xfe, 0xa0,
+		0x40, 0xff, 0xff, 0xe4, 0xef, 0x80, 0xff, 0xff, 0xfc, 0x1f, 0x00, 0xff, 0xff, 0xe9, 0xa2, 0x40,
+		0x8b, 0xff, 0xff, 0xc1, 0x60, 0x00, 0x8b, 0xff, 0xff, 0xf6, 0x89, 0x40, 0xff, 0x00, 0x28, 0xf9,
+		0x80, 0xff, 0xff, 0xfe, 0xd6, 0x40, 0xff, 0x00, 0x22, 0x92, 0x00, 0xff, 0x00, 0x38, 0xc6, 0x00,
+		0xff, 0x00, 0x0a, 0x57, 0xc0, 0xff, 0x00, 0x37, 0xbe, 0x00, 0xff, 0x00, 0x25, 0x78, 0x80, 0xff,
+		0x00, 0x22, 0x42, 0xc0, 0xff, 0x00, 0x44, 0xfd, 0x00, 0xff, 0x00, 0x21, 0x19, 0x80, 0xff, 0x00,
+		0x42, 0xa6, 0x00, 0xff, 0x00, 0x03, 0xf0, 0x80, 0xff, 0x00, 0x4d, 0x37, 0x40, 0x8b, 0xff, 0x00,
+		0x36, 0xb3, 0x00, 0x08, 0x0e, 0xff, 0x00, 0x38, 0x18, 0x40, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15,
+		0x32, 0x0a, 0xff, 0xff, 0x8e, 0xf2, 0x80, 0xff, 0xff, 0xbe, 0x69, 0x80, 0x15, 0x33, 0x0a, 0x0e,
+		0xff, 0x01, 0xb2, 0xf3, 0xc0, 0xff, 0x02, 0x24, 0xde, 0x40, 0x15, 0x34, 0x0a, 0x0e, 0xff, 0x00,
+		0x1f, 0x11, 0x80, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0x35, 0x0a, 0x0e, 0xff, 0x00, 0x32, 0x0d,
+		0xc0, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0x36, 0x0a, 0x0e, 0xff, 0x00, 0x19, 0x07, 0x00, 0xff,
+		0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0x00, 0xd4, 0x4c, 0x40, 0xff, 0xfd, 0x8b, 0xbc, 0x40, 0xff,
+		0x00, 0x1f, 0xee, 0x40, 0x8b, 0xff, 0x00, 0xd0, 0xd8, 0x80, 0xff, 0x02, 0x73, 0x66, 0xc0, 0xff,
+		0xff, 0xba, 0xf6, 0x00, 0x8b, 0xff, 0xff, 0x68, 0xf9, 0x80, 0xff, 0xfe, 0x21, 0xe6, 0x00, 0xff,
+		0xff, 0x60, 0x58, 0x40, 0xff, 0x01, 0xde, 0xf7, 0x00, 0x05, 0x0e, 0xff, 0x00, 0x11, 0x42, 0x80,
+		0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0xff, 0x00, 0x64, 0x1b, 0xc0, 0xff, 0xfd, 0x8c, 0x99, 0x40,
+		0xff, 0x00, 0x1c, 0x7a, 0x80, 0x8b, 0xff, 0x00, 0x6c, 0xbd, 0x00, 0xff, 0x01, 0x9b, 0xa6, 0xc0,
+		0xff, 0x00, 0x6b, 0x03, 0x00, 0xff, 0xfe, 0x64, 0x59, 0x40, 0xff, 0x00, 0x1b, 0x9d, 0xc0, 0x8b,
+		0xff, 0x00, 0x62, 0x61, 0xc0, 0xff, 0x02, 0x73, 0x66, 0xc0, 0xff, 0xff, 0xc5, 0x51, 0x00, 0x8b,
+		0xff, 0xff, 0xc7, 0x0a, 0xc0, 0xff, 0xfe, 0x59, 0x21, 0x40, 0xff, 0xff, 0x9b, 0x07, 0x80, 0xff,
+		0x01, 0x79, 0x21, 0x80, 0xff, 0xff, 0xea, 0x6c, 0xc0, 0x8b, 0xff, 0xff, 0x9b, 0xe4, 0x40, 0xff,
+		0xfe, 0x88, 0x98, 0x80, 0xff, 0xff, 0xbc, 0xaf, 0xc0, 0xff, 0x01, 0xa5, 0x24, 0xc0, 0x05, 0x0e,
+		0xff, 0x01, 0x7a, 0xdb, 0x80, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xff, 0x7f, 0x8b, 0x80,
+		0xff, 0xff, 0x13, 0x29, 0x80, 0xff, 0xff, 0x7c, 0xb1, 0x00, 0xff, 0x00, 0xec, 0xd6, 0x80, 0xff,
+		0xff, 0xb4, 0xeb, 0x40, 0x8b, 0xff, 0x00, 0xa6, 0xf0, 0xc0, 0xff, 0xfe, 0xcd, 0xcf, 0x00, 0xff,
+		0xff, 0x55, 0x9b, 0x80, 0xff, 0xfe, 0xc2, 0x3e, 0x00, 0xff, 0x00, 0x4c, 0xce, 0xc0, 0x8b, 0xff,
+		0x00, 0x85, 0x4f, 0x80, 0xff, 0x00, 0xf6, 0xf4, 0x00, 0xff, 0x00, 0x8a, 0x88, 0xc0, 0xff, 0xff,
+		0x09, 0x0c, 0x00, 0xff, 0x00, 0x4e, 0x88, 0x80, 0x8b, 0xff, 0xff, 0x4f, 0x56, 0x40, 0xff, 0x01,
+		0x3f, 0x62, 0x00, 0xff, 0x00, 0x9d, 0xad, 0x40, 0xff, 0x01, 0x30, 0x91, 0x00, 0x05, 0x0e, 0xff,
+		0x00, 0x1c, 0x7a, 0x80, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0x37, 0x0a, 0x0e, 0xff, 0x00, 0x3e,
+		0x22, 0xc0, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0x38, 0x0a, 0x0e, 0xff, 0x00, 0x83, 0x2d, 0x00,
+		0xff, 0x02, 0x9d, 0xb0, 0x40, 0x15, 0xff, 0xfd, 0x09, 0x6c, 0x40, 0xff, 0x01, 0x1e, 0x84, 0x40,
+		0xff, 0x00, 0x38, 0xf5, 0x40, 0xff, 0xff, 0x21, 0x58, 0x80, 0xff, 0x02, 0x82, 0x12, 0x40, 0xff,
+		0x00, 0xdd, 0xca, 0x80, 0xff, 0x00, 0x3b, 0x8c, 0x40, 0x07, 0x0e, 0xff, 0x01, 0xb4, 0xad, 0x80,
+		0xff, 0xff, 0xf3, 0x0e, 0x00, 0x15, 0xff, 0xfe, 0xc6, 0xbb, 0x40, 0xff, 0x02, 0xa5, 0x74, 0x80,
+		0xff, 0xff, 0xc4, 0x74, 0x00, 0xff, 0xff, 0xe1, 0xcb, 0x80, 0xff, 0x01, 0x3a, 0x21, 0xc0, 0xff,
+		0xfd, 0x5b, 0x68, 0x80, 0x05, 0x0e, 0xff, 0x01, 0x71, 0x5d, 0x40, 0xff, 0x02, 0x9d, 0xb0, 0x40,
+		0x15, 0xff, 0xfe, 0xe2, 0x58, 0xc0, 0xff, 0xff, 0xc4, 0x73, 0xc0, 0xff, 0x00, 0xdd, 0xca, 0x80,
+		0xff, 0xfd, 0x7d, 0xed, 0xc0, 0xff, 0xff, 0x21, 0x58, 0x80, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0xff,
+		0x01, 0x1e, 0x84, 0x40, 0x06, 0x0e, 0xff, 0x00, 0x5d, 0x34, 0x40, 0xff, 0x01, 0x6e, 0xc6, 0x80,
+		0x15, 0xff, 0x00, 0x32, 0x0d, 0xc0, 0xff, 0xff, 0xe7, 0xd6, 0x00, 0xff, 0x00, 0x6d, 0x9a, 0x00,
+		0xff, 0x00, 0xaf, 0x30, 0x40, 0xff, 0x00, 0x60, 0xa7, 0xc0, 0xff, 0xff, 0x50, 0xcf, 0xc0, 0xff,
+		0x00, 0x35, 0x81, 0xc0, 0xff, 0x00, 0x19, 0x06, 0xc0, 0xff, 0xff, 0x78, 0x82, 0x40, 0xff, 0x00,
+		0xff, 0x72, 0xc0, 0xff, 0xff, 0xea, 0x6c, 0xc0, 0x8b, 0x05, 0x0e, 0xff, 0x00, 0x22, 0x85, 0x00,
+		0xff, 0xff, 0xed, 0x03, 0x80, 0x15, 0xff, 0xff, 0xc2, 0xba, 0x40, 0xff, 0x01, 0xaf, 0x80, 0x00,
+		0xff, 0x00, 0x3d, 0x45, 0xc0, 0x07, 0x0e, 0xff, 0x00, 0xdb, 0x59, 0x00, 0xff, 0x01, 0xcc, 0xf2,
+		0x40, 0x15, 0xff, 0x00, 0x1d, 0x16, 0x00, 0xff, 0xff, 0xdd, 0x56, 0x40, 0xff, 0x00, 0x1e, 0x03,
+		0x40, 0xff, 0x00, 0x03, 0xb5, 0xc0, 0xff, 0x00, 0x0f, 0x0c, 0x40, 0xff, 0x00, 0x0c, 0xa0, 0x80,
+		0xff, 0x00, 0x0e, 0xc5, 0x80, 0xff, 0x00, 0x0c, 0x65, 0x00, 0xff, 0x00, 0x08, 0x07, 0x80, 0xff,
+		0x00, 0x1a, 0xd6, 0xc0, 0xff, 0xff, 0xe6, 0x9a, 0x80, 0xff, 0x00, 0x1e, 0x44, 0x00, 0xff, 0xff,
+		0xf2, 0x15, 0x00, 0xff, 0x00, 0x10, 0x96, 0x40, 0xff, 0xff, 0xee, 0x59, 0xc0, 0xff, 0x00, 0x0b,
+		0x49, 0xc0, 0xff, 0xff, 0xf2, 0x0b, 0x40, 0xff, 0x00, 0x10, 0xa1, 0xc0, 0xff, 0xff, 0xf3, 0x62,
+		0xc0, 0xff, 0x00, 0x0f, 0x08, 0x80, 0xff, 0xff, 0xf7, 0x36, 0x40, 0xff, 0x00, 0x11, 0x42, 0x00,
+		0xff, 0xff, 0xf9, 0x50, 0x80, 0xff, 0x00, 0x10, 0x5b, 0xc0, 0x08, 0xff, 0xff, 0xe5, 0x42, 0x40,
+		0xff, 0x00, 0x41, 0x6f, 0x00, 0xff, 0xff, 0xcc, 0xd0, 0x80, 0xff, 0xff, 0xe7, 0x13, 0x40, 0xff,
+		0x00, 0x18, 0x33, 0xc0, 0xff, 0xff, 0xbd, 0x90, 0x40, 0x05, 0xff, 0x00, 0x18, 0xe8, 0xc0, 0xff,
+		0xff, 0xbb, 0xa0, 0x40, 0xff, 0x00, 0x0d, 0xfd, 0x00, 0xff, 0xff, 0xe2, 0x19, 0x40, 0xff, 0x00,
+		0x10, 0xe3, 0x40, 0xff, 0xff, 0xeb, 0xdf, 0xc0, 0x08, 0x0e, 0xff, 0x00, 0x5a, 0x9d, 0x80, 0xff,
+		0x01, 0x93, 0x05, 0x80, 0x15, 0x39, 0x0a, 0xff, 0x01, 0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43, 0x00,
+		0xc0, 0x15, 0x3a, 0x0a, 0x0e, 0xff, 0x00, 0x3b, 0x8c, 0x00, 0xff, 0x02, 0x99, 0x5f, 0x80, 0x15,
+		0xff, 0xfd, 0x66, 0xa0, 0x80, 0xff, 0x00, 0x2e, 0x9a, 0x40, 0x07, 0xff, 0x00, 0x19, 0x06, 0xc0,
+		0xff, 0x00, 0x3c, 0x69, 0x00, 0x05, 0xff, 0x00, 0x1e, 0x00, 0xc0, 0xff, 0xff, 0xd3, 0x6d, 0x40,
+		0xff, 0x00, 0x32, 0x67, 0xc0, 0xff, 0xff, 0xe4, 0xe0, 0xc0, 0xff, 0x00, 0x36, 0xd2, 0x00, 0x8b,
+		0x08, 0xff, 0x00, 0x5d, 0xad, 0xc0, 0xff, 0x00, 0x61, 0x4f, 0xc0, 0xff, 0x00, 0x4f, 0x98, 0xc0,
+		0xff, 0x00, 0xa5, 0xbc, 0x00, 0xff, 0x00, 0x9f, 0x99, 0xc0, 0xff, 0xff, 0xa2, 0x12, 0x80, 0xff,
+		0x00, 0x4a, 0x29, 0x00, 0xff, 0xff, 0xa6, 0x37, 0x00, 0x1f, 0xff, 0xff, 0xc5, 0xd0, 0xc0, 0x8b,
+		0xff, 0xff, 0xca, 0x60, 0x40, 0xff, 0xff, 0xe1, 0x07, 0x80, 0xff, 0xff, 0xe3, 0x07, 0x80, 0xff,
+		0xff, 0xcd, 0xc9, 0xc0, 0x08, 0xff, 0x01, 0x00, 0x4f, 0x80, 0x07, 0x8b, 0xff, 0x00, 0x05, 0x50,
+		0x40, 0xff, 0x00, 0x01, 0x15, 0x40, 0xff, 0x00, 0x02, 0x2f, 0xc0, 0xff, 0x00, 0x04, 0xb2, 0x00,
+		0xff, 0x00, 0x03, 0xba, 0xc0, 0xff, 0x00, 0x01, 0xad, 0x00, 0xff, 0x00, 0x01, 0x55, 0x00, 0xff,
+		0x00, 0x05, 0x78, 0x40, 0xff, 0x00, 0x03, 0xde, 0x00, 0xff, 0xff, 0xfe, 0x4b, 0x80, 0xff, 0x00,
+		0x06, 0x02, 0x80, 0x08, 0xff, 0x00, 0x68, 0x7b, 0x80, 0xff, 0xfe, 0xfc, 0x8a, 0x80, 0x15, 0xff,
+		0x00, 0x2a, 0xee, 0xc0, 0xff, 0x00, 0x5a, 0xfa, 0x80, 0xff, 0xff, 0xe6, 0x4f, 0x40, 0xff, 0xff,
+		0x5e, 0xb3, 0x80, 0xff, 0xff, 0x74, 0x17, 0x80, 0xff, 0xff, 0xa5, 0xa1, 0x40, 0xff, 0xff, 0xe6,
+		0x77, 0x40, 0xff, 0xff, 0xd3, 0x50, 0xc0, 0x1f, 0xff, 0xff, 0xe0, 0xc1, 0x00, 0x8b, 0xff, 0xff,
+		0xba, 0xfb, 0x80, 0xff, 0x00, 0x0c, 0x7d, 0x00, 0xff, 0xff, 0xf4, 0x7c, 0xc0, 0xff, 0x00, 0x57,
+		0x18, 0x40, 0xff, 0xff, 0xfc, 0xdc, 0x00, 0xff, 0x00, 0x17, 0xc3, 0x40, 0xff, 0x00, 0x00, 0x55,
+		0x00, 0xff, 0x00, 0x1a, 0xeb, 0x40, 0x8b, 0xff, 0x00, 0x27, 0x89, 0x40, 0x8b, 0xff, 0x00, 0x29,
+		0x51, 0xc0, 0xff, 0x00, 0x01, 0x96, 0x80, 0xff, 0x00, 0x1d, 0x67, 0xc0, 0xff, 0x00, 0x0a, 0x63,
+		0x00, 0xff, 0x00, 0x19, 0x23, 0x00, 0xff, 0x00, 0x11, 0x05, 0x80, 0xff, 0x00, 0x29, 0x31, 0x00,
+		0xff, 0x00, 0x29, 0x82, 0xc0, 0xff, 0x00, 0x19, 0x94, 0x00, 0xff, 0x00, 0x2d, 0x38, 0xc0, 0x8b,
+		0x08, 0x0e, 0xff, 0x01, 0xc8, 0x87, 0x00, 0xff, 0x01, 0x7d, 0x72, 0x40, 0x15, 0x3b, 0x0a, 0x0e,
+		0xff, 0x01, 0x73, 0x17, 0x00, 0xff, 0x01, 0x86, 0x13, 0x80, 0x15, 0xff, 0xff, 0xea, 0x09, 0x80,
+		0xff, 0x00, 0x2e, 0xf5, 0x00, 0xff, 0xff, 0xcf, 0x1d, 0x80, 0xff, 0x00, 0x1f, 0xa7, 0x00, 0xff,
+		0xff, 0xc0, 0xdf, 0x40, 0x8b, 0x08, 0xff, 0xff, 0xa8, 0xeb, 0x00, 0xff, 0xff, 0x96, 0xd7, 0xc0,
+		0xff, 0xff, 0xc2, 0x23, 0xc0, 0xff, 0xff, 0x51, 0x65, 0xc0, 0xff, 0xff, 0x57, 0x5a, 0x80, 0xff,
+		0x00, 0x5d, 0x5a, 0x80, 0xff, 0xff, 0xb6, 0x4a, 0x40, 0xff, 0x00, 0x58, 0x4f, 0x80, 0x1f, 0xff,
+		0x00, 0x3a, 0x6c, 0x00, 0x8b, 0xff, 0x00, 0x35, 0xfc, 0x40, 0xff, 0x00, 0x20, 0x36, 0x00, 0xff,
+		0x00, 0x1c, 0xb1, 0x00, 0xff, 0x00, 0x33, 0x47, 0x40, 0x08, 0xff, 0xff, 0xd8, 0x4d, 0x40, 0x07,
+		0x8b, 0xff, 0xff, 0xf5, 0x25, 0x40, 0xff, 0x00, 0x00, 0xa7, 0x80, 0xff, 0xff, 0xf4, 0x49, 0x00,
+		0xff, 0x00, 0x03, 0xa9, 0x40, 0xff, 0xff, 0xf4, 0xe9, 0x80, 0x08, 0xff, 0x00, 0x47, 0xa1, 0x00,
+		0x06, 0xff, 0xff, 0xfc, 0x65, 0xc0, 0xff, 0x00, 0x0d, 0xfd, 0x40, 0xff, 0xff, 0xff, 0x4e, 0xc0,
+		0xff, 0x00, 0x0e, 0x78, 0x00, 0xff, 0xff, 0xff, 0xfa, 0xc0, 0xff, 0x00, 0x0d, 0xd4, 0x40, 0x08,
+		0xff, 0xff, 0xff, 0x23, 0x40, 0xff, 0x02, 0x52, 0x9b, 0x80, 0x05, 0xff, 0xff, 0xff, 0xfe, 0x00,
+		0xff, 0x00, 0x05, 0x36, 0x40, 0xff, 0x00, 0x00, 0x73, 0x80, 0xff, 0x00, 0x02, 0xcc, 0x40, 0xff,
+		0x00, 0x03, 0x90, 0x40, 0xff, 0x00, 0x05, 0x82, 0x40, 0xff, 0x00, 0x02, 0x10, 0x00, 0xff, 0x00,
+		0x03, 0x30, 0x00, 0xff, 0x00, 0x03, 0xcb, 0x00, 0xff, 0x00, 0x04, 0xf7, 0xc0, 0xff, 0xff, 0xff,
+		0xa1, 0x80, 0xff, 0x00, 0x06, 0xce, 0x00, 0x08, 0xff, 0xff, 0xb3, 0x31, 0x40, 0x06, 0xff, 0xff,
+		0x7d, 0x5f, 0xc0, 0xff, 0xff, 0x00, 0x96, 0x40, 0x15, 0xff, 0x00, 0x28, 0x0e, 0x80, 0x8b, 0xff,
+		0x00, 0x3b, 0x05, 0x80, 0xff, 0xff, 0xea, 0xb8, 0x80, 0xff, 0x00, 0x12, 0x13, 0xc0, 0xff, 0xff,
+		0xbc, 0x2c, 0x00, 0xff, 0x00, 0x05, 0xa9, 0xc0, 0xff, 0xff, 0xea, 0xc0, 0xc0, 0xff, 0x00, 0x02,
+		0x04, 0x40, 0xff, 0xff, 0xe6, 0x80, 0x40, 0x8b, 0xff, 0xff, 0xcd, 0x00, 0x80, 0x8b, 0xff, 0xff,
+		0xdd, 0x8e, 0x00, 0xff, 0xff, 0xfd, 0xe3, 0x80, 0xff, 0xff, 0xe6, 0x65, 0x40, 0xff, 0xff, 0xf8,
+		0x97, 0xc0, 0xff, 0xff, 0xe8, 0xee, 0x80, 0xff, 0xff, 0xee, 0x67, 0x80, 0xff, 0xff, 0xc9, 0x34,
+		0x00, 0xff, 0xff, 0xd0, 0xb7, 0x80, 0xff, 0xff, 0xe0, 0x26, 0x00, 0xff, 0xff, 0xd0, 0x5a, 0x40,
+		0x8b, 0x08, 0xff, 0xff, 0xcc, 0x46, 0x80, 0xff, 0xff, 0xb3, 0x24, 0x00, 0xff, 0x00, 0x28, 0x2d,
+		0x00, 0xff, 0x00, 0x96, 0x7a, 0xc0, 0xff, 0x00, 0x82, 0x0f, 0xc0, 0xff, 0x00, 0x49, 0x3a, 0xc0,
+		0xff, 0x00, 0x23, 0xe6, 0xc0, 0xff, 0x00, 0x34, 0x90, 0x80, 0x1f, 0x0e, 0xff, 0x01, 0x02, 0xa3,
+		0xc0, 0xff, 0x01, 0xd3, 0xfb, 0x00, 0x15, 0x3c, 0x0a, 0xff, 0xff, 0x76, 0x30, 0x00, 0xff, 0xff,
+		0x3d, 0x97, 0x40, 0x15, 0x3d, 0x0a, 0x0e, 0xff, 0x01, 0x57, 0x7e, 0x40, 0xff, 0x02, 0x9e, 0xf1,
+		0x40, 0x15, 0xff, 0xff, 0xbf, 0xcf, 0x40, 0x8b, 0xff, 0xff, 0xc3, 0xf2, 0x80, 0xff, 0xff, 0xe4,
+		0x55, 0x00, 0xff, 0xff, 0xe0, 0x12, 0x40, 0xff, 0xff, 0xcc, 0x13, 0x40, 0xff, 0xff, 0xe8, 0x95,
+		0xc0, 0xff, 0xff, 0xd9, 0xeb, 0x40, 0xff, 0xff, 0xfe, 0x56, 0x80, 0xff, 0xff, 0xd9, 0xef, 0x00,
+		0x8b, 0xff, 0xff, 0xd7, 0x72, 0xc0, 0x08, 0xff, 0xff, 0xd3, 0x1f, 0xc0, 0xff, 0xff, 0x9c, 0xc1,
+		0x40, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0xff, 0x00, 0x63, 0x3e, 0xc0, 0xff, 0xfe, 0x8b, 0x2f, 0x00,
+		0xff, 0x00, 0x45, 0x0a, 0x40, 0xff, 0x01, 0x74, 0xd1, 0x00, 0xff, 0x00, 0x95, 0x4c, 0x80, 0xff,
+		0x00, 0x38, 0xf5, 0x40, 0xff, 0xff, 0x6a, 0xb3, 0x80, 0xff, 0x00, 0x23, 0x62, 0x00, 0x07, 0x8b,
+		0xff, 0x00, 0x21, 0x17, 0x80, 0xff, 0xff, 0xff, 0x90, 0x80, 0xff, 0x00, 0x23, 0x03, 0x40, 0xff,
+		0x00, 0x11, 0x11, 0x80, 0xff, 0x00, 0x1e, 0x95, 0xc0, 0xff, 0x00, 0x12, 0xd7, 0x80, 0xff, 0x00,
+		0x21, 0xc2, 0x80, 0xff, 0x00, 0x23, 0x43, 0xc0, 0xff, 0x00, 0x10, 0xd5, 0x80, 0xff, 0x00, 0x25,
+		0xc8, 0x40, 0x8b, 0xff, 0x00, 0x2b, 0xfe, 0x40, 0x8b, 0xff, 0x00, 0x24, 0x9a, 0x00, 0xff, 0xff,
+		0xe8, 0xc8, 0x00, 0xff, 0x00, 0x13, 0x37, 0x00, 0xff, 0xff, 0xe2, 0xf0, 0x40, 0xff, 0x00, 0x03,
+		0x35, 0x80, 0xff, 0xff, 0xfb, 0x25, 0x00, 0xff, 0xff, 0xff, 0x33, 0x00, 0xff, 0xff, 0xfd, 0x44,
+		0x40, 0xff, 0x00, 0x00, 0x58, 0x00, 0xff, 0xff, 0xfb, 0xba, 0x80, 0xff, 0x00, 0x00, 0x8d, 0x00,
+		0xff, 0xff, 0xf9, 0x26, 0x40, 0xff, 0x00, 0x04, 0x7d, 0x80, 0xff, 0xff, 0xfe, 0x33, 0xc0, 0xff,
+		0x00, 0x03, 0x14, 0x00, 0xff, 0x00, 0x00, 0x50, 0x00, 0x08, 0xff, 0x00, 0x20, 0xcb, 0x40, 0xff,
+		0x00, 0x42, 0x73, 0x80, 0x05, 0xff, 0xff, 0xdf, 0x4f, 0x80, 0xff, 0x00, 0x27, 0x57, 0x40, 0xff,
+		0xff, 0xce, 0x5e, 0x40, 0xff, 0x00, 0x17, 0x2f, 0xc0, 0xff, 0xff, 0xc6, 0x88, 0xc0, 0x8b, 0x08,
+		0x0e, 0xff, 0x00, 0x7d, 0xf5, 0x40, 0xff, 0x01, 0x3a, 0x5b, 0xc0, 0x15, 0x3e, 0x0a, 0xff, 0x00,
+		0x68, 0xfd, 0x40, 0xff, 0x00, 0x9d, 0x50, 0x00, 0x15, 0x3f, 0x0a, 0xff, 0xff, 0xba, 0x5e, 0x00,
+		0xff, 0xfe, 0x40, 0xbf, 0xc0, 0x15, 0x40, 0x0a, 0x0e, 0xff, 0x00, 0x45, 0xe7, 0x40, 0x16, 0xff,
+		0x00, 0x49, 0x5a, 0xc0, 0xff, 0x01, 0x07, 0x37, 0x00, 0x06, 0x8b, 0xff, 0x00, 0x1e, 0xc4, 0x80,
+		0xff, 0x00, 0x03, 0xb3, 0x40, 0xff, 0x00, 0x16, 0x59, 0x80, 0xff, 0x00, 0x13, 0x01, 0x00, 0xff,
+		0x00, 0x19, 0x52, 0xc0, 0xff, 0x00, 0x11, 0x6a, 0xc0, 0xff, 0x00, 0x17, 0x35, 0xc0, 0xff, 0x00,
+		0x2b, 0xe7, 0x00, 0xff, 0x00, 0x28, 0x62, 0x00, 0xff, 0x00, 0x30, 0x4f, 0x40, 0x8b, 0xff, 0x00,
+		0x16, 0xed, 0x80, 0x8b, 0xff, 0x00, 0x16, 0x99, 0xc0, 0xff, 0xff, 0xf6, 0xae, 0x00, 0xff, 0x00,
+		0x10, 0x68, 0xc0, 0xff, 0xff, 0xec, 0x64, 0x80, 0xff, 0x00, 0x18, 0xb9, 0xc0, 0xff, 0xff, 0xe2,
+		0x74, 0x00, 0xff, 0x00, 0x00, 0x34, 0xc0, 0xff, 0xff, 0xd8, 0xcb, 0x00, 0x8b, 0xff, 0xff, 0xdf,
+		0xbb, 0x00, 0x08, 0xff, 0xfe, 0xec, 0xb4, 0x00, 0xff, 0x00, 0x46, 0xc4, 0x00, 0xff, 0x01, 0x15,
+		0x06, 0x00, 0x8b, 0x07, 0x8b, 0xff, 0x00, 0x23, 0xab, 0xc0, 0xff, 0xff, 0xff, 0xc4, 0x40, 0xff,
+		0x00, 0x25, 0xb2, 0x00, 0xff, 0xff, 0xef, 0xc0, 0x00, 0xff, 0x00, 0x24, 0xb9, 0x80, 0xff, 0xff,
+		0xe9, 0x41, 0x40, 0xff, 0x00, 0x33, 0x66, 0xc0, 0xff, 0xff, 0xd1, 0x2c, 0x00, 0xff, 0x00, 0x1d,
+		0x3b, 0x80, 0xff, 0xff, 0xcb, 0xf0, 0xc0, 0x8b, 0xff, 0xff, 0xc2, 0x01, 0x00, 0x8b, 0xff, 0xff,
+		0xc7, 0xb0, 0xc0, 0xff, 0xff, 0xd7, 0x70, 0x40, 0xff, 0xff, 0xde, 0x74, 0x40, 0xff, 0xff, 0xcd,
+		0x14, 0xc0, 0x08, 0xff, 0x01, 0x08, 0xf1, 0x00, 0x07, 0x8b, 0xff, 0x00, 0x03, 0x64, 0x80, 0xff,
+		0x00, 0x00, 0x3b, 0x80, 0xff, 0x00, 0x02, 0x9c, 0x40, 0xff, 0x00, 0x03, 0x65, 0xc0, 0xff, 0x00,
+		0x03, 0x95, 0xc0, 0xff, 0x00, 0x02, 0x4b, 0xc0, 0xff, 0x00, 0x02, 0x6c, 0x00, 0xff, 0x00, 0x04,
+		0x0f, 0xc0, 0xff, 0x00, 0x03, 0x14, 0x40, 0x8b, 0xff, 0x00, 0x05, 0x37, 0x00, 0x8b, 0xff, 0x00,
+		0x01, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xd5, 0x40, 0xff, 0x00, 0x01, 0x03, 0x80, 0xff, 0xff, 0xff,
+		0xac, 0x40, 0xff, 0x00, 0x00, 0xf6, 0x00, 0x08, 0xff, 0xff, 0xad, 0x27, 0x00, 0x06, 0x0e, 0xff,
+		0x00, 0x6a, 0x26, 0x40, 0xff, 0x01, 0xc9, 0x63, 0xc0, 0x15, 0x41, 0x0a, 0xff, 0xff, 0xdd, 0x7b,
+		0x80, 0xff, 0x00, 0xc6, 0x7d, 0x80, 0x15, 0x42, 0x0a, 0x0e, 0xff, 0x00, 0x7d, 0xff, 0x80, 0xff,
+		0x01, 0xc9, 0x63, 0xc0, 0x15, 0x43, 0x0a, 0xff, 0xff, 0xdc, 0x9e, 0x80, 0xff, 0x00, 0xc6, 0x7d,
+		0x80, 0x15, 0xff, 0xff, 0xe3, 0x5d, 0x80, 0xff, 0xff, 0xe8, 0xd6, 0x40, 0xff, 0xff, 0xe8, 0xed,
+		0x40, 0xff, 0xff, 0xe3, 0xb6, 0x80, 0xff, 0xff, 0xe3, 0xb8, 0x00, 0xff, 0x00, 0x17, 0x29, 0x00,
+		0xff, 0xff, 0xe8, 0xf0, 0x00, 0xff, 0x00, 0x1c, 0xa0, 0x80, 0xff, 0x00, 0x1c, 0xa5, 0x00, 0xff,
+		0x00, 0x17, 0x29, 0x00, 0xff, 0x00, 0x17, 0x12, 0x80, 0xff, 0x00, 0x1c, 0x47, 0x00, 0xff, 0x00,
+		0x1c, 0x4b, 0xc0, 0xff, 0xff, 0xe8, 0xd4, 0x80, 0xff, 0x00, 0x17, 0x0f, 0x00, 0xff, 0xff, 0xe3,
+		0x60, 0x40, 0x1f, 0x0e, 0xff, 0x00, 0x42, 0x73, 0x80, 0xff, 0x02, 0x98, 0x82, 0x80, 0x15, 0xff,
+		0xfd, 0x66, 0xa0, 0x80, 0xff, 0x00, 0x48, 0x7e, 0x00, 0xff, 0x00, 0xad, 0x76, 0x80, 0x07, 0xff,
+		0x00, 0x3c, 0x68, 0xc0, 0xff, 0x00, 0x38, 0x18, 0x80, 0xff, 0x00, 0xba, 0x68, 0x80, 0xff, 0xff,
+		0x16, 0xfd, 0x40, 0x05, 0x8b, 0xff, 0x00, 0x26, 0x51, 0x80, 0xff, 0x00, 0x03, 0x79, 0xc0, 0xff,
+		0x00, 0x2f, 0xe4, 0x80, 0x1e, 0xff, 0x00, 0x02, 0x54, 0x80, 0x8b, 0xff, 0x00, 0x02, 0x55, 0x00,
+		0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0x00, 0x02, 0x54, 0xc0, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x08,
+		0xff, 0xff, 0x1f, 0x9e, 0xc0, 0xff, 0x01, 0x11, 0x92, 0x40, 0xff, 0x00, 0xc0, 0x73, 0x00, 0xff,
+		0x00, 0xb5, 0x3b, 0x00, 0xff, 0xff, 0xe6, 0x1c, 0x00, 0x8b, 0x05, 0xff, 0xff, 0xee, 0x7c, 0x40,
+		0x8b, 0xff, 0xff, 0xed, 0xba, 0x00, 0xff, 0x00, 0x00, 0xd1, 0x80, 0xff, 0xff, 0xee, 0x48, 0x40,
+		0xff, 0x00, 0x04, 0x5c, 0x00, 0x08, 0xff, 0xff, 0x1b, 0x4e, 0x40, 0xff, 0xff, 0x2b, 0xb3, 0xc0,
+		0x8b, 0xff, 0x01, 0x87, 0xcd, 0x40, 0x05, 0x8b, 0xff, 0x00, 0x04, 0x53, 0xc0, 0xff, 0x00, 0x00,
+		0x5c, 0x80, 0xff, 0x00, 0x02, 0xa8, 0x40, 0xff, 0x00, 0x03, 0x7e, 0x00, 0xff, 0x00, 0x04, 0x8b,
+		0x80, 0xff, 0x00, 0x02, 0x51, 0xc0, 0xff, 0x00, 0x03, 0x03, 0x80, 0xff, 0x00, 0x04, 0x6e, 0x00,
+		0xff, 0x00, 0x04, 0x98, 0x40, 0xff, 0xff, 0xfe, 0xe3, 0xc0, 0xff, 0x00, 0x06, 0xc0, 0x80, 0x08,
+		0x0e, 0xff, 0x00, 0x54, 0x93, 0x00, 0xff, 0x02, 0x98, 0x82, 0x80, 0x15, 0x44, 0x0a, 0x0e, 0xff,
+		0x00, 0x25, 0xf8, 0xc0, 0x16, 0xff, 0x00, 0x41, 0x96, 0x80, 0xff, 0x01, 0x30, 0xa3, 0x80, 0x06,
+		0x8b, 0xff, 0x00, 0x15, 0x83, 0x40, 0xff, 0x00, 0x01, 0x7e, 0x00, 0xff, 0x00, 0x13, 0xf4, 0x40,
+		0xff, 0x00, 0x0c, 0xf2, 0xc0, 0xff, 0x00, 0x18, 0x0a, 0x80, 0xff, 0x00, 0x10, 0x87, 0x40, 0xff,
+		0x00, 0x1e, 0xb1, 0x00, 0xff, 0x00, 0x14, 0x6a, 0x40, 0xff, 0x00, 0x0b, 0xee, 0xc0, 0xff, 0x00,
+		0x12, 0x4b, 0xc0, 0x8b, 0xff, 0x00, 0x10, 0x46, 0x40, 0x8b, 0xff, 0x00, 0x12, 0x4c, 0xc0, 0xff,
+		0xff, 0xf5, 0xe1, 0xc0, 0xff, 0x00, 0x07, 0xbe, 0x00, 0xff, 0xff, 0xe6, 0xeb, 0xc0, 0xff, 0x00,
+		0x05, 0xe5, 0xc0, 0xff, 0xff, 0xec, 0xe4, 0x80, 0xff, 0xff, 0xfe, 0x9c, 0xc0, 0xff, 0xff, 0xe9,
+		0xf5, 0x80, 0x8b, 0xff, 0xff, 0xed, 0x28, 0xc0, 0x08, 0xff, 0xfe, 0xc2, 0x6a, 0x80, 0xff, 0x00,
+		0x43, 0x50, 0x40, 0xff, 0x01, 0x2e, 0x0c, 0xc0, 0x07, 0x8b, 0xff, 0x00, 0x18, 0x02, 0x80, 0xff,
+		0x00, 0x02, 0x55, 0x40, 0xff, 0x00, 0x13, 0x95, 0x40, 0xff, 0x00, 0x10, 0xde, 0x40, 0xff, 0x00,
+		0x1c, 0x73, 0x00, 0xff, 0x00, 0x07, 0x90, 0x40, 0xff, 0x00, 0x0c, 0xc2, 0x00, 0xff, 0x00, 0x11,
+		0xd1, 0x40, 0xff, 0x00, 0x1c, 0x6e, 0x00, 0xff, 0x00, 0x1b, 0xbd, 0xc0, 0x8b, 0xff, 0x00, 0x0e,
+		0xc8, 0x00, 0x8b, 0xff, 0x00, 0x0e, 0x1a, 0x80, 0xff, 0xff, 0xf7, 0x63, 0xc0, 0xff, 0x00, 0x07,
+		0x63, 0x40, 0xff, 0xff, 0xef, 0x1b, 0x80, 0xff, 0x00, 0x08, 0x6a, 0x00, 0xff, 0xff, 0xec, 0xc3,
+		0x40, 0xff, 0xff, 0xfd, 0xc5, 0x00, 0xff, 0xff, 0xe5, 0xdb, 0x80, 0x8b, 0xff, 0xff, 0xeb, 0x3a,
+		0x80, 0x08, 0xff, 0xfe, 0xbb, 0x83, 0x00, 0xff, 0x00, 0x44, 0x2d, 0x40, 0xff, 0x01, 0x45, 0x5a,
+		0x00, 0x07, 0x8b, 0xff, 0x00, 0x25, 0xce, 0x40, 0xff, 0x00, 0x01, 0x9a, 0x40, 0xff, 0x00, 0x26,
+		0xa2, 0x40, 0xff, 0xff, 0xeb, 0xc8, 0x00, 0xff, 0x00, 0x1e, 0x86, 0x00, 0xff, 0xff, 0xee, 0x7d,
+		0xc0, 0xff, 0x00, 0x1a, 0x6f, 0x80, 0xff, 0xff, 0xe3, 0xbd, 0x40, 0xff, 0x00, 0x09, 0xdc, 0x80,
+		0xff, 0xff, 0xe6, 0x4d, 0x80, 0x8b, 0xff, 0xff, 0xd4, 0x2e, 0x00, 0x8b, 0xff, 0xff, 0xd7, 0x33,
+		0x80, 0xff, 0xff, 0xe5, 0xf4, 0x80, 0xff, 0xff, 0xee, 0x40, 0xc0, 0xff, 0xff, 0xd7, 0x97, 0x80,
+		0xff, 0xff, 0xf8, 0xd6, 0x80, 0xff, 0x00, 0x25, 0xbb, 0x40, 0xff, 0xff, 0xdf, 0x47, 0x00, 0xff,
+		0x00, 0x1c, 0xc4, 0x80, 0xff, 0xff, 0xd7, 0x0e, 0xc0, 0x8b, 0xff, 0xff, 0xda, 0x87, 0x00, 0x8b,
+		0xff, 0xff, 0xdc, 0xfa, 0x00, 0xff, 0xff, 0xe7, 0xcd, 0x80, 0xff, 0xff, 0xea, 0xff, 0x40, 0xff,
+		0xff, 0xe0, 0x0e, 0x00, 0x08, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x00, 0x2c, 0xe0, 0x40, 0xff,
+		0xff, 0xbd, 0x8c, 0x80, 0x8b, 0x05, 0x0e, 0xff, 0x00, 0x44, 0x2d, 0x40, 0x16, 0x45, 0x0a, 0x0e,
+		0xff, 0x01, 0xcc, 0x13, 0xc0, 0xff, 0x00, 0xe2, 0x5e, 0x40, 0x15, 0x46, 0x0a, 0xff, 0xff, 0x2f,
+		0xb5, 0xc0, 0xff, 0x00, 0xb3, 0x54, 0x80, 0x15, 0x47, 0x0a, 0x0e, 0xff, 0x00, 0x3b, 0x8c, 0x00,
+		0xff, 0x01, 0xc8, 0x87, 0x00, 0x15, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0xfd, 0x90, 0xea, 0x00,
+		0xff, 0x00, 0x49, 0x5a, 0xc0, 0x8b, 0x8b, 0xff, 0x00, 0xe2, 0xf8, 0x00, 0x05, 0xff, 0x00, 0x1e,
+		0x7f, 0x80, 0xff, 0xff, 0xd2, 0xd3, 0x80, 0xff, 0x00, 0x33, 0x20, 0x80, 0xff, 0xff, 0xe4, 0x8d,
+		0x80, 0xff, 0x00, 0x37, 0x7e, 0x40, 0x8b, 0x08, 0xff, 0x00, 0x5d, 0x63, 0x80, 0xff, 0x00, 0x62,
+		0x4d, 0xc0, 0xff, 0x00, 0x4e, 0x4a, 0x80, 0xff, 0x00, 0xa7, 0x86, 0x80, 0xff, 0x00, 0xa1, 0x3b,
+		0x40, 0xff, 0xff, 0xa0, 0x7f, 0x80, 0xff, 0x00, 0x48, 0x0b, 0xc0, 0xff, 0xff, 0xa6, 0x1e, 0x80,
+		0x1f, 0xff, 0xff, 0xc5, 0x5d, 0xc0, 0x8b, 0xff, 0xff, 0xc9, 0x61, 0x80, 0xff, 0xff, 0xe1, 0xad,
+		0x40, 0xff, 0xff, 0xe0, 0xf6, 0x80, 0xff, 0xff, 0xce, 0x10, 0x80, 0x08, 0xff, 0x00, 0x45, 0xe7,
+		0x40, 0x07, 0xff, 0x00, 0x75, 0xe2, 0x80, 0xff, 0xff, 0xcd, 0x01, 0x80, 0x15, 0x48, 0x0a, 0x0e,
+		0xff, 0x01, 0x75, 0xad, 0xc0, 0xff, 0x01, 0x86, 0x13, 0x80, 0x15, 0xff, 0xff, 0xff, 0xab, 0x80,
+		0xff, 0xff, 0xe0, 0x30, 0x40, 0xff, 0x00, 0x4e, 0xeb, 0x80, 0xff, 0xff, 0x9a, 0xa3, 0x00, 0xff,
+		0xff, 0x9b, 0xe9, 0x40, 0xff, 0xff, 0x9d, 0xde, 0x80, 0xff, 0xff, 0xaf, 0x49, 0xc0, 0xff, 0xff,
+		0x64, 0xbe, 0x40, 0xff, 0xff, 0x6b, 0xf2, 0x40, 0xff, 0x00, 0x56, 0xec, 0x00, 0xff, 0xff, 0xa1,
+		0x4c, 0x00, 0xff, 0x00, 0x64, 0xe1, 0x00, 0x1e, 0xff, 0x00, 0x3a, 0x2e, 0x40, 0x8b, 0xff, 0x00,
+		0x35, 0x65, 0x00, 0xff, 0x00, 0x20, 0x8b, 0xc0, 0xff, 0x00, 0x1c, 0x91, 0x00, 0xff, 0x00, 0x32,
+		0xde, 0x80, 0x08, 0xff, 0xff, 0x10, 0x16, 0x00, 0xff, 0x00, 0x47, 0xa1, 0x40, 0xff, 0x02, 0x6f,
+		0x16, 0x00, 0xff, 0xff, 0xbb, 0xd2, 0x80, 0x07, 0xff, 0xff, 0x7d, 0xa4, 0xc0, 0xff, 0xff, 0xd1,
+		0x6d, 0x40, 0x15, 0xff, 0x00, 0x28, 0xca, 0x00, 0x8b, 0xff, 0x00, 0x34, 0x9a, 0x00, 0xff, 0xff,
+		0xea, 0x32, 0xc0, 0xff, 0x00, 0x14, 0x01, 0xc0, 0xff, 0xff, 0xc7, 0xf9, 0xc0, 0xff, 0x00, 0x09,
+		0x02, 0x40, 0xff, 0xff, 0xe6, 0xc7, 0x00, 0xff, 0x00, 0x02, 0x29, 0xc0, 0xff, 0xff, 0xe3, 0x3c,
+		0xc0, 0x8b, 0xff, 0xff, 0xc8, 0xc3, 0x40, 0x8b, 0xff, 0xff, 0xdd, 0xd8, 0x00, 0xff, 0xff, 0xfd,
+		0xec, 0xc0, 0xff, 0xff, 0xe6, 0x5b, 0x00, 0xff, 0xff, 0xf8, 0x8b, 0x40, 0xff, 0xff, 0xe8, 0xd7,
+		0xc0, 0xff, 0xff, 0xee, 0x78, 0x00, 0xff, 0xff, 0xc9, 0x8c, 0x00, 0xff, 0xff, 0xd0, 0xe8, 0x40,
+		0xff, 0xff, 0xdf, 0xd4, 0xc0, 0xff, 0xff, 0xd0, 0x5d, 0x00, 0x8b, 0x08, 0xff, 0xff, 0xbe, 0xd5,
+		0x00, 0xff, 0xff, 0xbd, 0xbe, 0x80, 0xff, 0x00, 0x3c, 0x97, 0x00, 0xff, 0x00, 0x81, 0x15, 0x80,
+		0xff, 0x00, 0x77, 0x2e, 0x80, 0xff, 0x00, 0x43, 0x5a, 0x00, 0xff, 0x00, 0x2f, 0xc6, 0x00, 0xff,
+		0x00, 0x3d, 0x4b, 0x80, 0x1f, 0x0e, 0xff, 0x00, 0x63, 0x3e, 0xc0, 0xff, 0x01, 0xc8, 0x87, 0x00,
+		0x15, 0x49, 0x0a, 0x0e, 0xff, 0x01, 0xb0, 0x5d, 0x00, 0xff, 0x01, 0x8c, 0x1e, 0x00, 0x15, 0x4a,
+		0x0a, 0x0e, 0xff, 0x00, 0xbc, 0x22, 0x40, 0xff, 0x02, 0x43, 0x12, 0xc0, 0x15, 0x4b, 0x0a, 0x0e,
+		0xff, 0x00, 0x3e, 0xff, 0xc0, 0xff, 0x01, 0xc8, 0x87, 0x00, 0x15, 0x4c, 0x0a, 0x0e, 0xff, 0x00,
+		0x27, 0xb2, 0xc0, 0xff, 0x01, 0xc9, 0x63, 0xc0, 0x15, 0xff, 0x00, 0xb5, 0x3a, 0xc0, 0xff, 0xfe,
+		0x33, 0x28, 0x80, 0xff, 0x00, 0x38, 0x18, 0x80, 0x8b, 0xff, 0x00, 0x6f, 0x53, 0x80, 0xff, 0x01,
+		0x04, 0xa0, 0x40, 0x05, 0xff, 0x00, 0x1b, 0x53, 0x40, 0xff, 0x00, 0x3f, 0xf8, 0xc0, 0xff, 0x00,
+		0x19, 0xa6, 0xc0, 0xff, 0x00, 0x42, 0x9c, 0x80, 0xff, 0x00, 0x0f, 0x33, 0x80, 0xff, 0x00, 0x45,
+		0xa2, 0x00, 0x08, 0xff, 0xff, 0xbf, 0x46, 0x40, 0x06, 0xff, 0xff, 0xf3, 0xe9, 0x00, 0xff, 0xff,
+		0xbd, 0x6e, 0x80, 0xff, 0xff, 0xe7, 0xd0, 0xc0, 0xff, 0xff, 0xc0, 0xa5, 0xc0, 0xff, 0xff, 0xe6,
+		0x23, 0x80, 0xff, 0xff, 0xc4, 0x0f, 0xc0, 0x08, 0xff, 0xff, 0xb6, 0xa5, 0x00, 0xff, 0xff, 0x55,
+		0xfd, 0x00, 0xff, 0xff, 0x7b, 0xf6, 0x40, 0xff, 0x01, 0x4d, 0xfb, 0x40, 0x05, 0xff, 0xff, 0xff,
+		0x2a, 0x00, 0xff, 0x00, 0x02, 0x1d, 0x40, 0xff, 0xff, 0xff, 0x5d, 0x40, 0xff, 0x00, 0x01, 0xcb,
+		0x80, 0x8b, 0xff, 0x00, 0x02, 0x67, 0xc0, 0x8b, 0xff, 0x00, 0x06, 0x14, 0xc0, 0xff, 0x00, 0x04,
+		0xec, 0x40, 0xff, 0x00, 0x05, 0x52, 0x80, 0xff, 0xff, 0xfe, 0x46, 0x40, 0xff, 0x00, 0x08, 0x2c,
+		0x00, 0x08, 0x0e, 0xff, 0x00, 0x0f, 0x88, 0xc0, 0xff, 0x01, 0xc9, 0x63, 0xc0, 0x15, 0xff, 0x00,
+		0x5c, 0x57, 0x40, 0xff, 0xfe, 0x35, 0xbf, 0x40, 0xff, 0x00, 0x40, 0xb9, 0x80, 0x8b, 0xff, 0x00,
+		0x50, 0x42, 0x80, 0xff, 0x01, 0x28, 0x02, 0x80, 0xff, 0x00, 0x54, 0x92, 0xc0, 0xff, 0xfe, 0xd7,
+		0xfd, 0x80, 0xff, 0x00, 0x43, 0x50, 0x80, 0x8b, 0x05, 0xff, 0x00, 0x1e, 0xee, 0x40, 0xff, 0x00,
+		0x97, 0x79, 0x00, 0xff, 0x00, 0x19, 0x55, 0x80, 0xff, 0x00, 0x98, 0x93, 0xc0, 0xff, 0x00, 0x13,
+		0xae, 0x00, 0xff, 0x00, 0x99, 0x57, 0x40, 0x08, 0xff, 0xff, 0xbd, 0x8c, 0x80, 0x06, 0xff, 0x00,
+		0x01, 0xcd, 0x80, 0xff, 0xff, 0xc8, 0xc9, 0x40, 0xff, 0xff, 0xfb, 0x45, 0xc0, 0xff, 0xff, 0xcd,
+		0x3e, 0xc0, 0xff, 0xff, 0xd8, 0xa3, 0x40, 0xff, 0xfe, 0xfc, 0x0e, 0x80, 0x08, 0xff, 0xff, 0x9f,
+		0x58, 0x00, 0xff, 0x01, 0x43, 0xa0, 0x00, 0xff, 0xff, 0xd3, 0xfc, 0xc0, 0x8b, 0xff, 0xff, 0xb1,
+		0x77, 0x80, 0xff, 0xfe, 0xbb, 0x83, 0x00, 0xff, 0xff, 0xbd, 0x8c, 0x80, 0xff, 0x01, 0x49, 0xaa,
+		0x80, 0x05, 0xff, 0xff, 0xfe, 0xab, 0x80, 0xff, 0x00, 0x06, 0x9a, 0x80, 0xff, 0xff, 0xff, 0xca,
+		0x40, 0xff, 0x00, 0x03, 0x9b, 0x80, 0xff, 0x00, 0x02, 0x7a, 0x80, 0xff, 0x00, 0x07, 0xfa, 0x80,
+		0xff, 0x00, 0x01, 0xa6, 0x40, 0xff, 0x00, 0x05, 0x50, 0x40, 0xff, 0x00, 0x02, 0xa1, 0x80, 0xff,
+		0x00, 0x06, 0xb3, 0x00, 0xff, 0xff, 0xfd, 0x5e, 0xc0, 0xff, 0x00, 0x07, 0xc5, 0x00, 0x08, 0x0e,
+		0xff, 0x01, 0x6a, 0x75, 0xc0, 0xff, 0x01, 0xc9, 0x63, 0xc0, 0x15, 0xff, 0xff, 0x8d, 0xdb, 0x80,
+		0xff, 0xff, 0x56, 0xc8, 0x00, 0xff, 0xff, 0x88, 0x45, 0x00, 0xff, 0x00, 0xa9, 0x38, 0x00, 0xff,
+		0xff, 0xb1, 0x77, 0x80, 0x8b, 0xff, 0x00, 0x9d, 0xce, 0x40, 0xff, 0xff, 0x1e, 0xcc, 0xc0, 0xff,
+		0xff, 0x5f, 0x9b, 0x00, 0xff, 0xff, 0x17, 0xcf, 0x80, 0xff, 0x00, 0x51, 0x1f, 0x40, 0x8b, 0xff,
+		0x00, 0x77, 0x25, 0x40, 0xff, 0x00, 0xb1, 0xa2, 0xc0, 0xff, 0x00, 0x7d, 0xf2, 0x40, 0xff, 0xff,
+		0x4e, 0x5d, 0x40, 0xff, 0x00, 0x51, 0xfc, 0x40, 0x8b, 0xff, 0xff, 0x58, 0x19, 0xc0, 0xff, 0x00,
+		0xea, 0xe7, 0xc0, 0xff, 0x00, 0x94, 0x0d, 0x00, 0xff, 0x00, 0xde, 0x7c, 0x00, 0x05, 0x0e, 0xff,
+		0x00, 0x2d, 0xbd, 0x40, 0xff, 0x01, 0xc8, 0x87, 0x00, 0x15, 0x4d, 0x0a, 0x0e, 0xff, 0x00, 0x46,
+		0xc4, 0x00, 0xff, 0x01, 0xc9, 0x63, 0xc0, 0x15, 0x4e, 0x0a, 0x0e, 0xff, 0x00, 0x34, 0xa4, 0x80,
+		0xff, 0x01, 0x1b, 0xed, 0x40, 0x15, 0xff, 0xff, 0xc7, 0xe7, 0xc0, 0xff, 0x00, 0x14, 0xb6, 0x80,
+		0x07, 0xff, 0x00, 0x10, 0xeb, 0x80, 0x8b, 0xff, 0x00, 0x19, 0xc2, 0x00, 0xff, 0x00, 0x00, 0x34,
+		0x00, 0xff, 0x00, 0x14, 0x82, 0x80, 0xff, 0xff, 0xeb, 0xe6, 0xc0, 0xff, 0x00, 0x13, 0xa1, 0x00,
+		0xff, 0xff, 0xec, 0xc4, 0x40, 0xff, 0x00, 0x06, 0xbf, 0xc0, 0xff, 0xff, 0xe2, 0xe1, 0xc0, 0x8b,
+		0xff, 0xff, 0xd4, 0xd1, 0xc0, 0x8b, 0xff, 0xff, 0xe0, 0xd3, 0x00, 0xff, 0xff, 0xfc, 0x3f, 0x80,
+		0xff, 0xff, 0xe2, 0x31, 0x00, 0x8b, 0xff, 0xff, 0xd9, 0x06, 0xc0, 0x8b, 0xff, 0xff, 0xdb, 0xb3,
+		0x40, 0xff, 0x00, 0x03, 0x0e, 0x80, 0xff, 0xff, 0xbb, 0x9d, 0x40, 0xff, 0x00, 0x34, 0xae, 0x80,
+		0xff, 0xff, 0xd7, 0x92, 0x40, 0xff, 0x00, 0x2b, 0x32, 0x00, 0xff, 0xff, 0xde, 0xd9, 0xc0, 0xff,
+		0x00, 0x33, 0x37, 0x00, 0xff, 0x00, 0x03, 0x06, 0x80, 0xff, 0x00, 0x3d, 0xc5, 0xc0, 0x8b, 0x08,
+		0xff, 0x00, 0x24, 0x3f, 0x00, 0xff, 0x00, 0x38, 0x18, 0x40, 0xff, 0xff, 0xda, 0xe4, 0x00, 0x06,
+		0xff, 0xff, 0xd6, 0xe2, 0x40, 0x8b, 0xff, 0xff, 0xe0, 0xd0, 0xc0, 0xff, 0xff, 0xfd, 0xf8, 0x80,
+		0xff, 0xff, 0xe4, 0xa4, 0x00, 0xff, 0x00, 0x12, 0xd9, 0x00, 0xff, 0xff, 0xdc, 0x41, 0x00, 0xff,
+		0x00, 0x18, 0xa0, 0x80, 0xff, 0xff, 0xfa, 0xea, 0x40, 0xff, 0x00, 0x2b, 0xc7, 0x40, 0x8b, 0xff,
+		0x00, 0x22, 0x6b, 0x00, 0x8b, 0xff, 0x00, 0x1a, 0x79, 0x00, 0xff, 0x00, 0x03, 0x2b, 0x00, 0xff,
+		0x00, 0x1a, 0x38, 0x80, 0x8b, 0xff, 0x00, 0x1e, 0xea, 0x40, 0x8b, 0xff, 0x00, 0x68, 0x82, 0x40,
+		0xff, 0xff, 0xd1, 0x78, 0x00, 0xff, 0x00, 0x26, 0x10, 0x00, 0xff, 0xff, 0xda, 0x10, 0x40, 0xff,
+		0x00, 0x0d, 0x2f, 0xc0, 0xff, 0x00, 0x1e, 0xef, 0x40, 0xff, 0x00, 0x0d, 0x45, 0x80, 0xff, 0x00,
+		0x19, 0x71, 0xc0, 0xff, 0x00, 0x17, 0xc0, 0x00, 0xff, 0x00, 0x0e, 0xc4, 0x40, 0xff, 0x00, 0x1e,
+		0x32, 0x80, 0xff, 0x00, 0x0d, 0x3b, 0x40, 0xff, 0x00, 0x1b, 0x0f, 0x40, 0xff, 0x00, 0x02, 0xa9,
+		0x80, 0xff, 0x00, 0x1d, 0x90, 0x40, 0x8b, 0xff, 0x00, 0x17, 0xc9, 0x00, 0x08, 0x8b, 0xff, 0x00,
+		0x18, 0x6d, 0xc0, 0xff, 0xff, 0xfd, 0x0b, 0x00, 0xff, 0x00, 0x15, 0xe7, 0xc0, 0x8b, 0xff, 0x00,
+		0x17, 0xf1, 0x40, 0x8b, 0xff, 0x00, 0x14, 0x4e, 0xc0, 0xff, 0x00, 0x01, 0x95, 0x00, 0xff, 0x00,
+		0x30, 0xac, 0x00, 0xff, 0x00, 0x26, 0x80, 0x00, 0xff, 0x00, 0x18, 0x0a, 0x00, 0xff, 0x00, 0x1a,
+		0xe6, 0x80, 0xff, 0x00, 0x10, 0xcb, 0xc0, 0xff, 0x00, 0x1e, 0x76, 0x00, 0xff, 0xff, 0xfb, 0xe8,
+		0x40, 0xff, 0x00, 0x2b, 0xb7, 0xc0, 0x8b, 0x08, 0xff, 0x00, 0x22, 0x85, 0x40, 0xff, 0x00, 0x38,
+		0xf5, 0x80, 0xff, 0xff, 0xe1, 0xcb, 0x80, 0x06, 0xff, 0xff, 0xca, 0x56, 0xc0, 0x8b, 0xff, 0xff,
+		0xbf, 0xbf, 0x80, 0xff, 0x00, 0x03, 0xbb, 0x40, 0xff, 0xff, 0xd0, 0x05, 0x40, 0xff, 0xff, 0xd4,
+		0x43, 0x80, 0xff, 0xff, 0xd4, 0x06, 0xc0, 0xff, 0xff, 0xd7, 0xea, 0xc0, 0xff, 0xff, 0xfa, 0xa1,
+		0xc0, 0xff, 0xff, 0xc7, 0xc4, 0x80, 0x8b, 0xff, 0xff, 0xda, 0x5c, 0x40, 0x8b, 0xff, 0xff, 0xe7,
+		0x3c, 0xc0, 0xff, 0x00, 0x02, 0x8d, 0x00, 0xff, 0xff, 0xe9, 0x5c, 0x40, 0x8b, 0xff, 0xff, 0xe7,
+		0xd4, 0xc0, 0x8b, 0xff, 0xff, 0xe7, 0x8c, 0x40, 0xff, 0xff, 0xfd, 0x88, 0x00, 0xff, 0xff, 0xdc,
+		0x24, 0x80, 0xff, 0xff, 0xe8, 0x90, 0x00, 0xff, 0xff, 0xe7, 0x6a, 0xc0, 0xff, 0xff, 0xea, 0x2a,
+		0xc0, 0xff, 0xff, 0xe9, 0x19, 0x00, 0xff, 0xff, 0xe4, 0xae, 0x80, 0xff, 0x00, 0x00, 0x5b, 0xc0,
+		0xff, 0xff, 0xee, 0x3d, 0x40, 0x8b, 0x08, 0x0e, 0xff, 0x00, 0xd8, 0x9d, 0x00, 0xff, 0x02, 0x8c,
+		0x6d, 0x80, 0x15, 0xff, 0xfc, 0xdc, 0x8c, 0x00, 0xff, 0x00, 0x43, 0x50, 0x40, 0xff, 0x03, 0x23,
+		0x74, 0x00, 0x07, 0x0e, 0xff, 0x01, 0xbf, 0xe5, 0xc0, 0xff, 0x01, 0x1b, 0xed, 0x40, 0x15, 0xff,
+		0xff, 0xec, 0x26, 0x80, 0x06, 0xff, 0xff, 0xee, 0x3d, 0x40, 0x8b, 0xff, 0xff, 0xe4, 0xae, 0x80,
+		0xff, 0xff, 0xff, 0xa4, 0x40, 0xff, 0xff, 0xea, 0x2a, 0xc0, 0xff, 0x00, 0x16, 0xe7, 0x00, 0xff,
+		0xff, 0xe8, 0x90, 0x00, 0xff, 0x00, 0x18, 0x95, 0x40, 0xff, 0xff, 0xfd, 0x88, 0x00, 0xff, 0x00,
+		0x23, 0xdb, 0x80, 0x8b, 0xff, 0x00, 0x18, 0x73, 0xc0, 0x8b, 0xff, 0x00, 0x18, 0x2b, 0x40, 0xff,
+		0x00, 0x02, 0x8d, 0x00, 0xff, 0x00, 0x16, 0xa3, 0xc0, 0x8b, 0xff, 0x00, 0x18, 0xc3, 0x40, 0x8b,
+		0xff, 0x00, 0x25, 0xa3, 0xc0, 0xff, 0xff, 0xfa, 0xa1, 0xc0, 0xff, 0x00, 0x38, 0x3b, 0x80, 0xff,
+		0xff, 0xd4, 0x06, 0xc0, 0xff, 0x00, 0x28, 0x15, 0x40, 0xff, 0xff, 0xd0, 0x05, 0x40, 0xff, 0x00,
+		0x2b, 0xbc, 0x80, 0xff, 0xff, 0xbf, 0xbf, 0x80, 0xff, 0xff, 0xfc, 0x44, 0xc0, 0xff, 0xff, 0xca,
+		0x56, 0xc0, 0x8b, 0x08, 0xff, 0xff, 0xe1, 0xcb, 0x80, 0xff, 0xff, 0xc7, 0x0a, 0x80, 0xff, 0x00,
+		0x22, 0x85, 0x40, 0x06, 0xff, 0x00, 0x2b, 0xb7, 0xc0, 0x8b, 0xff, 0x00, 0x1e, 0x76, 0x00, 0xff,
+		0x00, 0x04, 0x17, 0xc0, 0xff, 0x00, 0x1a, 0xe6, 0x80, 0xff, 0xff, 0xef, 0x34, 0x40, 0xff, 0x00,
+		0x26, 0x80, 0x00, 0xff, 0xff, 0xe7, 0xf6, 0x00, 0xff, 0x00, 0x01, 0x95, 0x00, 0xff, 0xff, 0xcf,
+		0x54, 0x00, 0x8b, 0xff, 0xff, 0xeb, 0xb1, 0x40, 0x8b, 0xff, 0xff, 0xe8, 0x0e, 0xc0, 0xff, 0xff,
+		0xfd, 0x0b, 0x00, 0xff, 0xff, 0xea, 0x18, 0x40, 0x8b, 0xff, 0xff, 0xe7, 0x92, 0x40, 0x8b, 0xff,
+		0xff, 0xe8, 0x37, 0x00, 0xff, 0x00, 0x02, 0xa9, 0x80, 0xff, 0xff, 0xe2, 0x6f, 0xc0, 0xff, 0x00,
+		0x0d, 0x3b, 0x40, 0xff, 0xff, 0xe4, 0xf0, 0xc0, 0xff, 0x00, 0x0e, 0xc4, 0x40, 0xff, 0xff, 0xe1,
+		0xcd, 0x80, 0xff, 0x00, 0x19, 0x71, 0xc0, 0xff, 0xff, 0xe8, 0x40, 0x00, 0xff, 0x00, 0x1e, 0xef,
+		0x00, 0xff, 0xff, 0xf2, 0xba, 0x80, 0xff, 0xff, 0xda, 0x10, 0x80, 0xff, 0xff, 0xf2, 0xd0, 0x40,
+		0xff, 0xff, 0xd1, 0x78, 0x00, 0xff, 0xff, 0xd9, 0xf0, 0x00, 0x8b, 0xff, 0xff, 0x97, 0x7d, 0xc0,
+		0x08, 0x8b, 0xff, 0xff, 0xe1, 0x15, 0xc0, 0xff, 0x00, 0x03, 0x2b, 0x00, 0xff, 0xff, 0xe5, 0xc7,
+		0x80, 0x8b, 0xff, 0xff, 0xe5, 0x87, 0x00, 0x8b, 0xff, 0xff, 0xdd, 0x95, 0x00, 0xff, 0xff, 0xfa,
+		0xea, 0x40, 0xff, 0xff, 0xd4, 0x38, 0xc0, 0xff, 0xff, 0xdc, 0x41, 0x00, 0xff, 0xff, 0xe7, 0x5f,
+		0x80, 0xff, 0xff, 0xe4, 0xa4, 0x00, 0xff, 0xff, 0xed, 0x27, 0x00, 0xff, 0xff, 0xe0, 0xd0, 0xc0,
+		0xff, 0x00, 0x02, 0x07, 0x80, 0xff, 0xff, 0xd6, 0xe2, 0x40, 0x8b, 0x08, 0xff, 0xff, 0xda, 0xe4,
+		0x00, 0xff, 0xff, 0xc7, 0xe7, 0xc0, 0xff, 0x00, 0x24, 0x3f, 0x00, 0x06, 0xff, 0x00, 0x3d, 0xc5,
+		0xc0, 0x8b, 0xff, 0x00, 0x33, 0x37, 0x00, 0xff, 0xff, 0xfc, 0xf9, 0x80, 0xff, 0x00, 0x2b, 0x32,
+		0x00, 0xff, 0x00, 0x21, 0x26, 0x40, 0xff, 0x00, 0x34, 0xae, 0x80, 0xff, 0x00, 0x28, 0x6d, 0xc0,
+		0xff, 0x00, 0x03, 0x0e, 0x40, 0xff, 0x00, 0x44, 0x62, 0xc0, 0x8b, 0xff, 0x00, 0x24, 0x4c, 0xc0,
+		0x8b, 0xff, 0x00, 0x26, 0xf9, 0x40, 0xff, 0xff, 0xfc, 0x3f, 0xc0, 0xff, 0x00, 0x1d, 0xcf, 0x00,
+		0x8b, 0xff, 0x00, 0x1f, 0x2d, 0x00, 0x8b, 0xff, 0x00, 0x2b, 0x2e, 0x40, 0xff, 0x00, 0x06, 0xbf,
+		0xc0, 0xff, 0x00, 0x1d, 0x1e, 0x40, 0xff, 0x00, 0x13, 0xa1, 0x00, 0xff, 0x00, 0x13, 0x3b, 0xc0,
+		0xff, 0x00, 0x14, 0x82, 0x80, 0xff, 0x00, 0x14, 0x19, 0x40, 0xff, 0x00, 0x19, 0xc2, 0x00, 0xff,
+		0xff, 0xff, 0xcc, 0x00, 0xff, 0x00, 0x10, 0xeb, 0x80, 0x8b, 0x08, 0xff, 0x00, 0x14, 0xb6, 0x80,
+		0x06, 0x0e, 0xff, 0x00, 0x5b, 0x7a, 0x40, 0xff, 0x01, 0x55, 0xbf, 0x80, 0x15, 0xff, 0x00, 0x19,
+		0x4e, 0x80, 0xff, 0x00, 0x29, 0x68, 0xc0, 0xff, 0x00, 0x1d, 0x6d, 0x80, 0xff, 0x00, 0x14, 0x60,
+		0x80, 0xff, 0x00, 0x1c, 0x43, 0xc0, 0x8b, 0xff, 0x00, 0x3d, 0x0a, 0xc0, 0x8b, 0xff, 0x00, 0x14,
+		0x76, 0x40, 0xff, 0xff, 0xb0, 0x6a, 0x80, 0xff, 0x00, 0x51, 0x0d, 0x40, 0x8b, 0xff, 0x00, 0x3e,
+		0xdd, 0x80, 0x8b, 0xff, 0x00, 0x31, 0x90, 0x00, 0xff, 0x00, 0x34, 0x90, 0x40, 0xff, 0x00, 0x1a,
+		0x0d, 0x80, 0xff, 0x00, 0x27, 0x73, 0xc0, 0x08, 0xff, 0xff, 0xd2, 0x43, 0x00, 0xff, 0x00, 0x25,
+		0xf9, 0x00, 0x05, 0xff, 0xff, 0xe3, 0x37, 0xc0, 0xff, 0xff, 0xd8, 0xdd, 0x80, 0xff, 0xff, 0xe8,
+		0x5f, 0x00, 0xff, 0xff, 0xe6, 0x68, 0x80, 0xff, 0xff, 0xdf, 0x33, 0x80, 0x8b, 0xff, 0xff, 0xc6,
+		0xf1, 0x00, 0x8b, 0xff, 0xff, 0xe5, 0xcb, 0x40, 0xff, 0x00, 0x4b, 0x20, 0x40, 0xff, 0xff, 0xad,
+		0x79, 0x40, 0x8b, 0xff, 0xff, 0xc7, 0x57, 0x00, 0x8b, 0xff, 0xff, 0xcc, 0xd3, 0x00, 0xff, 0xff,
+		0xd8, 0x49, 0xc0, 0xff, 0xff, 0xe2, 0x7c, 0x80, 0xff, 0xff, 0xcd, 0xea, 0x80, 0x08, 0x0e, 0xf7,
+		0x10, 0x0e, 0xf7, 0x07, 0x0e, 0xf6, 0x0e, 0xed, 0x0e, 0xe4, 0x0e, 0xdc, 0x0e, 0xd3, 0x0e, 0xca,
+		0x0e, 0xc2, 0x0e, 0xb9, 0x0e, 0xb1, 0x0e, 0xa8, 0x0e, 0x9f, 0x0e, 0x97, 0x0e, 0x8e, 0x0e, 0x85,
+		0x0e, 0x7d, 0x0e, 0x74, 0x0e, 0x6c, 0x0e, 0x63, 0x0e, 0x5a, 0x0e, 0x52, 0x0e, 0x49, 0x0e, 0x40,
+		0x0e, 0x38, 0x0e, 0x2f, 0x0e, 0x27, 0x0e, 0xfb, 0x00, 0x0e, 0xfb, 0x09, 0x0e, 0xfb, 0x11, 0x0e,
+		0xfb, 0x1a, 0x0e, 0xfb, 0x23, 0x0e, 0xfb, 0x2b, 0x0e, 0x0e, 0xff, 0x00, 0xb4, 0x54, 0x40, 0xff,
+		0x02, 0x60, 0xd7, 0x80, 0x15, 0xff, 0xff, 0xdf, 0x5f, 0x80, 0xff, 0x00, 0x1a, 0x82, 0x80, 0xff,
+		0xff, 0xe5, 0x80, 0x80, 0xff, 0x00, 0x20, 0xa0, 0x80, 0xff, 0x00, 0x20, 0xa2, 0xc0, 0xff, 0x00,
+		0x1a, 0x80, 0x00, 0xff, 0x00, 0x1a, 0x82, 0x00, 0xff, 0x00, 0x20, 0x9d, 0x80, 0xff, 0x00, 0x20,
+		0xa0, 0x80, 0xff, 0xff, 0xe5, 0x7d, 0x80, 0xff, 0x00, 0x1a, 0x7f, 0x40, 0xff, 0xff, 0xdf, 0x5f,
+		0x80, 0xff, 0xff, 0xdf, 0x5d, 0x00, 0xff, 0xff, 0xe5, 0x80, 0x40, 0xff, 0xff, 0xe5, 0x7d, 0xc0,
+		0xff, 0xff, 0xdf, 0x63, 0x00, 0x1e, 0xff, 0x00, 0x39, 0x96, 0x80, 0xff, 0xfd, 0x93, 0xed, 0x00,
+		0x15, 0xff, 0x00, 0x11, 0x52, 0x00, 0x8b, 0xff, 0x00, 0x11, 0x9a, 0xc0, 0xff, 0x00, 0x0a, 0x99,
+		0x00, 0xff, 0x00, 0x08, 0xec, 0x80, 0xff, 0x00, 0x15, 0x7d, 0xc0, 0xff, 0x00, 0x04, 0x97, 0x00,
+		0xff, 0x00, 0x0b, 0x0d, 0x40, 0xff, 0x00, 0x02, 0x39, 0xc0, 0xff, 0x00, 0x0d, 0x7e, 0x00, 0x8b,
+		0xff, 0x00, 0x12, 0xbc, 0x00, 0x8b, 0xff, 0x00, 0x20, 0x45, 0x80, 0xff, 0xff, 0xf9, 0x9f, 0x40,
+		0xff, 0x00, 0x18, 0x48, 0x80, 0xff, 0xff, 0xfc, 0x82, 0x80, 0xff, 0x00, 0x41, 0xb4, 0xc0, 0x08,
+		0xff, 0xff, 0xf1, 0x54, 0x40, 0xff, 0x01, 0x14, 0x29, 0x00, 0xff, 0xff, 0xcd, 0xf2, 0x00, 0x8b,
+		0xff, 0xff, 0xed, 0xe0, 0x80, 0xff, 0xfe, 0xeb, 0xd7, 0x00, 0x05, 0xff, 0xff, 0xfd, 0x80, 0xc0,
+		0xff, 0xff, 0xd9, 0xed, 0x80, 0xff, 0xff, 0xf9, 0x36, 0x40, 0xff, 0xff, 0xda, 0x25, 0x80, 0x8b,
+		0xff, 0xff, 0xd9, 0xcb, 0x40, 0x8b, 0xff, 0xff, 0xe8, 0x7e, 0x00, 0xff, 0x00, 0x02, 0x4d, 0x80,
+		0xff, 0xff, 0xf4, 0xcb, 0x40, 0xff, 0x00, 0x01, 0x81, 0xc0, 0xff, 0xff, 0xfa, 0x17, 0x80, 0xff,
+		0x00, 0x07, 0xb7, 0x80, 0xff, 0xff, 0xe1, 0xb8, 0x80, 0xff, 0x00, 0x15, 0x0b, 0x00, 0xff, 0xff,
+		0xf3, 0x67, 0xc0, 0xff, 0x00, 0x12, 0xc4, 0xc0, 0x8b, 0x08, 0x0e, 0xff, 0x01, 0x1c, 0xca, 0x40,
+		0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xff, 0xf1, 0xe8, 0xc0, 0xff, 0xff, 0x8f, 0x8f, 0x00,
+		0x05, 0xff, 0xff, 0x7a, 0x01, 0x80, 0xff, 0xff, 0xf9, 0x86, 0x80, 0xff, 0xff, 0xa7, 0x9f, 0x80,
+		0xff, 0xff, 0x9d, 0xa0, 0x00, 0x8b, 0xff, 0xff, 0x79, 0xe8, 0x80, 0x8b, 0xff, 0xff, 0x8c, 0xc0,
+		0x40, 0xff, 0x00, 0x41, 0x19, 0x40, 0xff, 0xff, 0xa7, 0x5b, 0x40, 0xff, 0x00, 0x62, 0x5f, 0x40,
+		0xff, 0xff, 0xe4, 0xcc, 0x00, 0x08, 0xff, 0xff, 0xf1, 0xd4, 0x00, 0xff, 0xff, 0x8e, 0xe6, 0x80,
+		0xff, 0x00, 0x39, 0xd2, 0x40, 0xff, 0xff, 0xf9, 0x18, 0x80, 0xff, 0x00, 0x0e, 0xae, 0xc0, 0xff,
+		0x00, 0x6f, 0x6b, 0xc0, 0x05, 0xff, 0x00, 0x02, 0x75, 0x40, 0xff, 0xff, 0xff, 0xee, 0x40, 0xff,
+		0x00, 0x02, 0x78, 0x80, 0xff, 0xff, 0xff, 0xf7, 0x40, 0xff, 0x00, 0x02, 0x7c, 0x00, 0x8b, 0xff,
+		0x00, 0x40, 0xd1, 0x40, 0x8b, 0xff, 0x00, 0x3c, 0xe9, 0x40, 0xff, 0x00, 0x18, 0x8a, 0x40, 0xff,
+		0x00, 0x2a, 0xe6, 0x00, 0xff, 0x00, 0x2f, 0x19, 0x40, 0x08, 0xff, 0xff, 0xdb, 0xc1, 0x00, 0xff,
+		0x00, 0x30, 0x54, 0x00, 0x05, 0xff, 0xff, 0xdd, 0x39, 0xc0, 0xff, 0xff, 0xdc, 0x43, 0x40, 0xff,
+		0xff, 0xd0, 0x53, 0x40, 0xff, 0xff, 0xeb, 0xa4, 0x40, 0xff, 0xff, 0xcf, 0xad, 0x80, 0x8b, 0x08,
+		0xff, 0xff, 0xff, 0x61, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x2e, 0x1e, 0x80, 0xff,
+		0x01, 0x5d, 0xf6, 0x00, 0x05, 0xff, 0x00, 0x24, 0xa5, 0x80, 0xff, 0xff, 0xf4, 0xe3, 0xc0, 0xff,
+		0x00, 0x19, 0x25, 0xc0, 0xff, 0xff, 0xea, 0x9f, 0x40, 0xff, 0x00, 0x0c, 0xe7, 0x80, 0xff, 0xff,
+		0xf0, 0xb1, 0x40, 0xff, 0x00, 0x05, 0x24, 0x40, 0xff, 0xff, 0xf9, 0xe6, 0xc0, 0xff, 0xff, 0xfe,
+		0x46, 0x00, 0xff, 0xff, 0xfb, 0xb6, 0x80, 0x8b, 0xff, 0xff, 0xfa, 0x58, 0xc0, 0x8b, 0xff, 0xff,
+		0xfe, 0xad, 0x80, 0xff, 0xff, 0xff, 0xea, 0x40, 0xff, 0xff, 0xfa, 0x99, 0x40, 0xff, 0x00, 0x04,
+		0xa7, 0x40, 0xff, 0xff, 0xfc, 0xc2, 0x00, 0x08, 0xff, 0x00, 0x2c, 0x03, 0x40, 0xff, 0x00, 0x38,
+		0xf5, 0x40, 0x05, 0xff, 0xff, 0xe7, 0x9f, 0xc0, 0xff, 0x00, 0x25, 0x5c, 0xc0, 0xff, 0xff, 0xd8,
+		0x08, 0x80, 0xff, 0x00, 0x1d, 0x4c, 0x00, 0xff, 0xff, 0xc9, 0xa4, 0xc0, 0xff, 0x00, 0x0a, 0xdb,
+		0x80, 0x08, 0xff, 0x00, 0x0a, 0xd3, 0x00, 0xff, 0x00, 0x52, 0x23, 0x40, 0x05, 0xff, 0x00, 0x00,
+		0xe7, 0x80, 0xff, 0x00, 0x06, 0xd8, 0xc0, 0xff, 0x00, 0x01, 0x8e, 0xc0, 0xff, 0x00, 0x02, 0x3d,
+		0x00, 0xff, 0x00, 0x02, 0x91, 0x00, 0xff, 0x00, 0x04, 0x93, 0x00, 0xff, 0x00, 0x01, 0x32, 0x40,
+		0xff, 0x00, 0x02, 0x21, 0xc0, 0xff, 0x00, 0x03, 0x13, 0x40, 0xff, 0x00, 0x05, 0x5a, 0x00, 0xff,
+		0xff, 0xff, 0x54, 0x80, 0xff, 0x00, 0x06, 0x79, 0x40, 0x08, 0xff, 0xff, 0x7b, 0xff, 0xc0, 0xff,
+		0xfe, 0x02, 0xb0, 0x40, 0x15, 0xff, 0xff, 0xc3, 0x87, 0x40, 0xff, 0x00, 0x18, 0x45, 0x80, 0xff,
+		0xff, 0xd7, 0x6b, 0x80, 0xff, 0x00, 0x3e, 0xba, 0x80, 0x8b, 0xff, 0x00, 0x57, 0x13, 0x00, 0x8b,
+		0xff, 0x00, 0x68, 0x9a, 0xc0, 0xff, 0x00, 0x3e, 0x20, 0x40, 0xff, 0x00, 0x3e, 0x57, 0x80, 0xff,
+		0x00, 0x52, 0x46, 0x80, 0xff, 0x00, 0x04, 0xe9, 0x40, 0x08, 0x0e, 0xff, 0x01, 0xa1, 0xb1, 0x40,
+		0xff, 0x02, 0x3c, 0x2b, 0x40, 0x15, 0xff, 0xff, 0xdc, 0x1d, 0x40, 0xff, 0x00, 0x20, 0xe9, 0xc0,
+		0xff, 0xff, 0xd1, 0x8a, 0xc0, 0xff, 0x00, 0x12, 0x02, 0x40, 0xff, 0xff, 0xd0, 0x59, 0xc0, 0x8b,
+		0xff, 0xff, 0xa3, 0x37, 0x00, 0x8b, 0xff, 0xff, 0xad, 0x37, 0x00, 0xff, 0xff, 0xba, 0xda, 0xc0,
+		0x8b, 0xff, 0xff, 0x8f, 0xd9, 0x40, 0x8b, 0xff, 0xff, 0xea, 0x59, 0xc0, 0xff, 0x00, 0x02, 0xfe,
+		0xc0, 0xff, 0xff, 0xea, 0xd8, 0x40, 0xff, 0x00, 0x04, 0x40, 0x40, 0xff, 0xff, 0xeb, 0x01, 0x40,
+		0x08, 0xff, 0xff, 0xcb, 0xf0, 0x80, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0xff, 0x00, 0x41, 0x6e, 0xc0,
+		0x06, 0xff, 0x00, 0x07, 0xe1, 0x80, 0xff, 0xff, 0xdf, 0x9f, 0x40, 0xff, 0x00, 0x07, 0x21, 0x40,
+		0xff, 0xff, 0xdf, 0x48, 0x80, 0x8b, 0xff, 0xff, 0xdd, 0xb8, 0x80, 0x8b, 0xff, 0xff, 0xd2, 0xfe,
+		0x00, 0xff, 0xff, 0xf3, 0xc7, 0x40, 0xff, 0xff, 0xd6, 0x06, 0xc0, 0xff, 0xff, 0xe9, 0xc3, 0xc0,
+		0xff, 0xff, 0xdd, 0x69, 0x00, 0xff, 0xff, 0xf0, 0x2c, 0xc0, 0xff, 0xff, 0xe7, 0x61, 0x80, 0xff,
+		0xff, 0xf3, 0xe2, 0xc0, 0xff, 0xff, 0xfb, 0x36, 0x80, 0xff, 0xff, 0xd1, 0x79, 0x40, 0xff, 0xff,
+		0xea, 0x81, 0xc0, 0x08, 0xff, 0x00, 0x19, 0xe3, 0xc0, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0x05, 0xff,
+		0x00, 0x40, 0x1b, 0x40, 0xff, 0x00, 0x21, 0xe2, 0xc0, 0xff, 0x00, 0x26, 0x96, 0x00, 0xff, 0x00,
+		0x03, 0xcc, 0x40, 0xff, 0x00, 0x14, 0x6f, 0x40, 0x8b, 0xff, 0x00, 0x48, 0x9a, 0xc0, 0x8b, 0xff,
+		0x00, 0x29, 0xd1, 0x40, 0xff, 0xff, 0xd3, 0x45, 0x80, 0xff, 0x00, 0x3f, 0xc2, 0x80, 0x8b, 0xff,
+		0x00, 0x2b, 0xa5, 0x00, 0x8b, 0xff, 0x00, 0x26, 0x23, 0x80, 0xff, 0x00, 0x17, 0xa9, 0x00, 0xff,
+		0x00, 0x16, 0x84, 0xc0, 0xff, 0x00, 0x11, 0xe7, 0x80, 0x08, 0xff, 0xff, 0xe5, 0x3f, 0x40, 0xff,
+		0x00, 0x33, 0xc7, 0xc0, 0x05, 0xff, 0xff, 0xeb, 0xb1, 0x00, 0xff, 0xff, 0xee, 0x9d, 0x40, 0xff,
+		0xff, 0xe5, 0xfc, 0xc0, 0xff, 0xff, 0xf5, 0xb2, 0x80, 0xff, 0xff, 0xe4, 0x69, 0xc0, 0x8b, 0xff,
+		0xff, 0xc6, 0xbc, 0xc0, 0x8b, 0xff, 0xff, 0xd6, 0xa8, 0xc0, 0xff, 0x00, 0x29, 0x37, 0x40, 0xff,
+		0xff, 0xbd, 0x84, 0x00, 0x8b, 0xff, 0xff, 0xf7, 0x02, 0x00, 0x8b, 0xff, 0xff, 0xf7, 0x07, 0xc0,
+		0xff, 0xff, 0xff, 0x3c, 0xc0, 0xff, 0xff, 0xf7, 0x27, 0x80, 0xff, 0xff, 0xfe, 0x74, 0x40, 0xff,
+		0x00, 0x17, 0xbf, 0x00, 0xff, 0x00, 0x26, 0x67, 0x40, 0xff, 0x00, 0x0c, 0xf6, 0x80, 0xff, 0x00,
+		0x2e, 0x22, 0x40, 0x8b, 0xff, 0x00, 0x31, 0x62, 0x80, 0x8b, 0xff, 0x00, 0x22, 0x3c, 0x40, 0xff,
+		0xff, 0xf9, 0xb2, 0xc0, 0xff, 0x00, 0x20, 0x2e, 0x80, 0xff, 0xff, 0xf8, 0xba, 0xc0, 0xff, 0x00,
+		0x1e, 0xf2, 0x00, 0x08, 0xff, 0x00, 0x55, 0x99, 0xc0, 0xff, 0x00, 0x38, 0xf5, 0x40, 0xff, 0xff,
+		0x9c, 0xe6, 0x80, 0x06, 0xff, 0xff, 0xfb, 0x4e, 0x40, 0xff, 0x00, 0x15, 0xd8, 0xc0, 0xff, 0xff,
+		0xfc, 0x98, 0x00, 0xff, 0x00, 0x15, 0x74, 0x40, 0x8b, 0xff, 0x00, 0x15, 0x62, 0xc0, 0x8b, 0xff,
+		0x00, 0x53, 0x3b, 0x40, 0xff, 0x00, 0x34, 0xfb, 0x00, 0xff, 0x00, 0x28, 0x53, 0x80, 0xff, 0x00,
+		0x35, 0xa8, 0x40, 0x8b, 0xff, 0x00, 0x29, 0xfe, 0x00, 0x8b, 0xff, 0x00, 0x1c, 0x1f, 0x40, 0xff,
+		0xff, 0xe7, 0xcb, 0x00, 0xff, 0x00, 0x04, 0x3e, 0xc0, 0xff, 0xff, 0xfb, 0x56, 0x00, 0xff, 0x00,
+		0x05, 0xd5, 0x00, 0xff, 0xff, 0xf9, 0x97, 0x00, 0xff, 0xff, 0xff, 0x5f, 0x80, 0xff, 0xff, 0xf7,
+		0xf6, 0xc0, 0xff, 0x00, 0x08, 0x29, 0x40, 0xff, 0xff, 0xfa, 0x04, 0x40, 0x08, 0x0e, 0xff, 0x01,
+		0xd0, 0x4b, 0x40, 0xff, 0x02, 0x3d, 0xe5, 0x00, 0x15, 0xff, 0xff, 0xdd, 0x46, 0xc0, 0xff, 0x00,
+		0x23, 0x28, 0x40, 0xff, 0xff, 0xd0, 0x53, 0x00, 0xff, 0x00, 0x12, 0xb0, 0x40, 0xff, 0xff, 0xcb,
+		0x37, 0x40, 0x8b, 0xff, 0xff, 0xc1, 0x88, 0xc0, 0x8b, 0xff, 0xff, 0xad, 0x01, 0x80, 0xff, 0xff,
+		0xe5, 0xec, 0xc0, 0xff, 0xff, 0xcc, 0xde, 0x80, 0xff, 0xff, 0xa6, 0xcf, 0xc0, 0xff, 0xff, 0xef,
+		0x25, 0x80, 0xff, 0xff, 0xe2, 0x9a, 0x00, 0xff, 0xff, 0xf4, 0x95, 0x40, 0xff, 0xff, 0xde, 0xa1,
+		0x40, 0xff, 0xff, 0xf8, 0xa9, 0xc0, 0xff, 0xff, 0xdc, 0x88, 0x40, 0x08, 0xff, 0xff, 0xcc, 0xd3,
+		0xc0, 0x8b, 0xff, 0xff, 0xf3, 0x0e, 0x00, 0xff, 0xff, 0xc6, 0x2d, 0xc0, 0xff, 0x00, 0x37, 0xb2,
+		0x40, 0x8b, 0x05, 0xff, 0xff, 0xfe, 0x10, 0x80, 0xff, 0xff, 0xea, 0xcf, 0xc0, 0xff, 0xff, 0xff,
+		0x28, 0x80, 0xff, 0xff, 0xea, 0x73, 0x80, 0x8b, 0xff, 0xff, 0xea, 0x70, 0xc0, 0x8b, 0xff, 0xff,
+		0xfa, 0x96, 0x80, 0xff, 0x00, 0x00, 0x11, 0xc0, 0xff, 0xff, 0xfa, 0xae, 0x00, 0xff, 0x00, 0x00,
+		0x23, 0x40, 0xff, 0xff, 0xfa, 0xc5, 0x40, 0x08, 0xff, 0xff, 0xd7, 0xd1, 0xc0, 0x8b, 0xff, 0xff,
+		0xf3, 0x0e, 0x00, 0xff, 0xff, 0xc6, 0x2d, 0xc0, 0xff, 0x00, 0x39, 0xcf, 0x40, 0x8b, 0x05, 0xff,
+		0x00, 0x1a, 0x2a, 0x00, 0xff, 0xff, 0x46, 0xdc, 0x00, 0xff, 0x00, 0x7d, 0x44, 0x80, 0xff, 0xff,
+		0xd3, 0x79, 0x40, 0xff, 0x00, 0x50, 0xed, 0xc0, 0x8b, 0xff, 0x00, 0x34, 0x41, 0xc0, 0x8b, 0xff,
+		0x00, 0x31, 0x19, 0x40, 0xff, 0x00, 0x11, 0xba, 0x80, 0xff, 0x00, 0x26, 0x3f, 0xc0, 0xff, 0x00,
+		0x21, 0x4c, 0x40, 0x08, 0xff, 0xff, 0xe3, 0x85, 0x40, 0xff, 0x00, 0x32, 0x0d, 0xc0, 0x05, 0xff,
+		0xff, 0xe2, 0xc6, 0x00, 0xff, 0xff, 0xe5, 0xaf, 0xc0, 0xff, 0xff, 0xd9, 0xff, 0x40, 0xff, 0xff,
+		0xf1, 0x92, 0x80, 0xff, 0xff, 0xd8, 0x29, 0x80, 0x8b, 0xff, 0xff, 0xd1, 0xad, 0xc0, 0x8b, 0xff,
+		0xff, 0xcd, 0x21, 0x40, 0xff, 0x00, 0x13, 0xc0, 0x00, 0xff, 0xff, 0xdc, 0xce, 0x00, 0xff, 0x00,
+		0x2f, 0xa1, 0x80, 0xff, 0xff, 0xeb, 0xa2, 0xc0, 0xff, 0x00, 0x1b, 0x8e, 0x80, 0xff, 0xff, 0xf2,
+		0xc4, 0x80, 0xff, 0x00, 0x21, 0xbf, 0x40, 0xff, 0xff, 0xf8, 0xfd, 0x80, 0xff, 0x00, 0x28, 0xa4,
+		0xc0, 0x08, 0xff, 0x00, 0xb1, 0x5d, 0x00, 0x8b, 0xff, 0x00, 0x16, 0x70, 0x40, 0xff, 0x00, 0x39,
+		0xd2, 0x40, 0xff, 0xff, 0x32, 0x7a, 0x40, 0x8b, 0x05, 0xff, 0xff, 0xff, 0xbf, 0xc0, 0xff, 0x00,
+		0x06, 0xec, 0x40, 0xff, 0xff, 0xff, 0xe0, 0x40, 0xff, 0x00, 0x07, 0x14, 0x40, 0x8b, 0xff, 0x00,
+		0x07, 0x3d, 0x40, 0x8b, 0xff, 0x00, 0x16, 0x8f, 0xc0, 0xff, 0x00, 0x00, 0xe2, 0x80, 0xff, 0x00,
+		0x13, 0x8b, 0x40, 0xff, 0x00, 0x01, 0x6a, 0xc0, 0xff, 0x00, 0x10, 0xe9, 0x80, 0x08, 0xff, 0x00,
+		0xe9, 0xcd, 0x00, 0x8b, 0xff, 0x00, 0x15, 0x93, 0x40, 0xff, 0x00, 0x39, 0xd2, 0x40, 0xff, 0xff,
+		0x09, 0x08, 0x80, 0x8b, 0x05, 0xff, 0x00, 0x01, 0xa7, 0xc0, 0xff, 0x00, 0x07, 0x81, 0xc0, 0xff,
+		0x00, 0x01, 0xac, 0x80, 0xff, 0x00, 0x06, 0x5f, 0x40, 0xff, 0x00, 0x01, 0x8d, 0x40, 0xff, 0x00,
+		0x05, 0x65, 0x40, 0xff, 0x00, 0x1d, 0x6f, 0xc0, 0xff, 0x00, 0x66, 0x63, 0xc0, 0xff, 0x00, 0x48,
+		0x78, 0x00, 0xff, 0x00, 0x22, 0xae, 0xc0, 0xff, 0x00, 0x3b, 0xb5, 0xc0, 0x8b, 0xff, 0x00, 0x43,
+		0x5d, 0xc0, 0x8b, 0xff, 0x00, 0x25, 0x33, 0x80, 0xff, 0xff, 0xd4, 0xd4, 0x00, 0xff, 0x00, 0x00,
+		0xf7, 0x40, 0xff, 0xff, 0xfe, 0xd3, 0x00, 0xff, 0x00, 0x05, 0x78, 0x00, 0xff, 0xff, 0xf9, 0x58,
+		0x80, 0xff, 0xff, 0xfb, 0xfd, 0xc0, 0xff, 0xff, 0xf7, 0xf7, 0x00, 0xff, 0x00, 0x07, 0x22, 0x40,
+		0xff, 0xff, 0xfa, 0x2b, 0x00, 0x08, 0x0e, 0xff, 0x00, 0x24, 0x3f, 0x00, 0xff, 0x02, 0x6f, 0xf3,
+		0x00, 0x15, 0xff, 0x00, 0xbb, 0x45, 0x40, 0xff, 0xfe, 0xb7, 0x32, 0x80, 0x8b, 0xff, 0xff, 0xeb,
+		0x49, 0x80, 0xff, 0xff, 0x74, 0x31, 0xc0, 0x8b, 0x8b, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0xff, 0x00,
+		0x8b, 0xce, 0x40, 0x8b, 0x8b, 0xff, 0xff, 0xc1, 0x00, 0x40, 0xff, 0xff, 0x74, 0x31, 0xc0, 0x8b,
+		0x8b, 0xff, 0xff, 0xc7, 0xe7, 0xc0, 0xff, 0x00, 0x8b, 0xce, 0x40, 0x8b, 0x8b, 0xff, 0xff, 0x9d,
+		0x9e, 0x40, 0xff, 0x00, 0x44, 0x2d, 0x80, 0x8b, 0x8b, 0xff, 0x00, 0x62, 0x61, 0xc0, 0xff, 0x00,
+		0x86, 0xa0, 0xc0, 0x8b, 0x8b, 0xff, 0x00, 0x38, 0x18, 0x40, 0xff, 0xff, 0x79, 0x5f, 0x40, 0x8b,
+		0x05, 0xff, 0x00, 0x3e, 0xff, 0xc0, 0xff, 0x00, 0x86, 0xa0, 0xc0, 0xff, 0x00, 0x38, 0xf5, 0x40,
+		0xff, 0xff, 0x79, 0x5f, 0x40, 0xff, 0x00, 0x14, 0xb6, 0x80, 0x07, 0xff, 0x00, 0xae, 0x53, 0x40,
+		0xff, 0x01, 0x47, 0xf0, 0x80, 0xff, 0xff, 0xb5, 0xc8, 0x40, 0x8b, 0xff, 0xff, 0x7b, 0x19, 0x40,
+		0xff, 0xfe, 0xfc, 0x3c, 0xc0, 0xff, 0xff, 0x6f, 0x04, 0x00, 0xff, 0x01, 0x04, 0xa0, 0x40, 0x05,
+		0x0e, 0xff, 0x01, 0x92, 0x28, 0x80, 0xff, 0x02, 0xf3, 0x20, 0x00, 0x15, 0x4f, 0x0a, 0xff, 0x00,
+		0xa3, 0xf8, 0x40, 0xff, 0xff, 0x94, 0xfd, 0x00, 0x15, 0x34, 0x0a, 0x0e, 0xff, 0x01, 0x9c, 0x83,
+		0x80, 0xff, 0x02, 0x47, 0x63, 0x40, 0x15, 0xff, 0xff, 0xe1, 0x2c, 0x00, 0xff, 0x00, 0x36, 0x39,
+		0x80, 0xff, 0xff, 0xc5, 0x97, 0x00, 0xff, 0x00, 0x22, 0x08, 0x80, 0xff, 0xff, 0xbd, 0xd7, 0xc0,
+		0x8b, 0xff, 0xff, 0xa2, 0x51, 0x40, 0x8b, 0xff, 0xff, 0xba, 0x8b, 0xc0, 0xff, 0xff, 0xbe, 0x2a,
+		0x00, 0x8b, 0xff, 0xff, 0xb3, 0xc1, 0x40, 0x8b, 0xff, 0xff, 0xd8, 0x5e, 0x80, 0xff, 0x00, 0x13,
+		0x06, 0x00, 0xff, 0xff, 0xd4, 0x5c, 0xc0, 0xff, 0x00, 0x2f, 0xb0, 0xc0, 0xff, 0xff, 0xe2, 0x61,
+		0x40, 0xff, 0xff, 0xd0, 0x48, 0x40, 0xff, 0xff, 0xee, 0xfe, 0x00, 0xff, 0xff, 0xde, 0x24, 0x40,
+		0xff, 0xff, 0xd9, 0x6f, 0x80, 0x8b, 0xff, 0xff, 0xd2, 0xd4, 0x40, 0x8b, 0xff, 0xff, 0xdd, 0x90,
+		0xc0, 0xff, 0x00, 0x13, 0x30, 0x00, 0xff, 0xff, 0xdb, 0xf7, 0x40, 0xff, 0x00, 0x2c, 0x67, 0x40,
+		0xff, 0xff, 0xe5, 0xc3, 0x00, 0xff, 0x00, 0x31, 0xe1, 0x00, 0xff, 0xff, 0xe2, 0x86, 0x80, 0xff,
+		0x00, 0x38, 0xc6, 0x40, 0xff, 0xff, 0xfc, 0x6a, 0x80, 0xff, 0x00, 0x29, 0x73, 0xc0, 0xff, 0xff,
+		0xe7, 0x78, 0xc0, 0x08, 0xff, 0x00, 0x22, 0x01, 0xc0, 0xff, 0xff, 0xeb, 0xe0, 0xc0, 0xff, 0x00,
+		0x0b, 0xf2, 0x40, 0xff, 0xff, 0xe4, 0x7e, 0xc0, 0x8b, 0xff, 0xff, 0xe8, 0xa0, 0x40, 0x8b, 0xff,
+		0xff, 0xd6, 0x96, 0x40, 0xff, 0xff, 0xda, 0xa4, 0x80, 0xff, 0xff, 0xda, 0xa6, 0x80, 0xff, 0xff,
+		0xc2, 0xcc, 0x00, 0x8b, 0xff, 0xff, 0xb4, 0xa0, 0x40, 0x8b, 0xff, 0xff, 0xdd, 0xdf, 0x80, 0xff,
+		0x00, 0x37, 0x14, 0x00, 0xff, 0xff, 0xfc, 0xf7, 0x80, 0xff, 0x00, 0x07, 0xe0, 0x00, 0xff, 0xff,
+		0xfd, 0xd5, 0x80, 0xff, 0x00, 0x05, 0x9f, 0x40, 0xff, 0x00, 0x01, 0x9f, 0x40, 0xff, 0x00, 0x08,
+		0xb7, 0x00, 0xff, 0xff, 0xf8, 0x3d, 0x00, 0xff, 0x00, 0x03, 0x2d, 0x00, 0x08, 0xff, 0xff, 0xcb,
+		0x5b, 0x40, 0xff, 0xff, 0xc2, 0xba, 0x40, 0x05, 0xff, 0x00, 0x29, 0xdb, 0x00, 0xff, 0xff, 0xc9,
+		0x32, 0x00, 0xff, 0x00, 0x40, 0xd5, 0x00, 0xff, 0xff, 0xe1, 0x59, 0x80, 0xff, 0x00, 0x42, 0x94,
+		0xc0, 0x8b, 0xff, 0x00, 0x65, 0x19, 0x40, 0x8b, 0xff, 0x00, 0x45, 0x42, 0x00, 0xff, 0x00, 0x45,
+		0x0c, 0x80, 0x8b, 0xff, 0x00, 0x4d, 0xea, 0xc0, 0x8b, 0xff, 0x00, 0x2a, 0x84, 0x40, 0xff, 0xff,
+		0xeb, 0x68, 0x40, 0xff, 0x00, 0x2b, 0xe0, 0x80, 0xff, 0xff, 0xd4, 0x2e, 0xc0, 0xff, 0x00, 0x1d,
+		0xc4, 0xc0, 0xff, 0x00, 0x2b, 0x85, 0x40, 0xff, 0x00, 0x11, 0xd2, 0x40, 0xff, 0x00, 0x1e, 0x62,
+		0x40, 0xff, 0x00, 0x25, 0x11, 0x80, 0x8b, 0xff, 0x00, 0x29, 0xcd, 0xc0, 0x8b, 0xff, 0x00, 0x24,
+		0x06, 0x40, 0xff, 0xff, 0xe9, 0xf0, 0xc0, 0xff, 0x00, 0x2b, 0xdd, 0x40, 0xff, 0xff, 0xba, 0x34,
+		0x00, 0xff, 0x00, 0x21, 0x54, 0x40, 0xff, 0xff, 0xd7, 0xb9, 0x40, 0xff, 0x00, 0x13, 0x3b, 0x40,
+		0xff, 0xff, 0xda, 0x7e, 0x80, 0xff, 0x00, 0x08, 0x6d, 0xc0, 0xff, 0xff, 0xe3, 0x4c, 0x00, 0xff,
+		0x00, 0x0f, 0x2e, 0x00, 0x08, 0xff, 0xff, 0xd4, 0x50, 0x00, 0xff, 0x00, 0x17, 0x1a, 0x80, 0xff,
+		0xff, 0xf6, 0xbd, 0x40, 0xff, 0x00, 0x1e, 0xfd, 0x00, 0x8b, 0xff, 0x00, 0x14, 0x45, 0x80, 0x8b,
+		0xff, 0x00, 0x29, 0xa1, 0x00, 0xff, 0x00, 0x26, 0x3e, 0x80, 0xff, 0x00, 0x23, 0x2c, 0x00, 0xff,
+		0x00, 0x34, 0xae, 0x00, 0x8b, 0xff, 0x00, 0x35, 0x17, 0x80, 0x8b, 0xff, 0x00, 0x1d, 0xd9, 0x40,
+		0xff, 0xff, 0xdb, 0xc1, 0x80, 0xff, 0x00, 0x08, 0x23, 0x00, 0xff, 0xff, 0xe9, 0x6d, 0xc0, 0xff,
+		0x00, 0x02, 0x81, 0xc0, 0xff, 0xff, 0xf9, 0x0c, 0x80, 0xff, 0xff, 0xfe, 0x06, 0x00, 0xff, 0xff,
+		0xf7, 0xfc, 0x40, 0xff, 0x00, 0x07, 0x55, 0x80, 0xff, 0xff, 0xfa, 0x75, 0x80, 0x08, 0xff, 0xff,
+		0x60, 0xfc, 0xc0, 0xff, 0xff, 0x79, 0x32, 0x40, 0x15, 0xff, 0x00, 0x1e, 0xf8, 0x00, 0xff, 0xff,
+		0xf3, 0x9f, 0xc0, 0xff, 0x00, 0x1e, 0xfd, 0xc0, 0xff, 0xff, 0xf9, 0x15, 0x40, 0xff, 0x00, 0x19,
+		0xaf, 0x40, 0xff, 0xff, 0xf3, 0x53, 0x00, 0xff, 0x00, 0x2e, 0x7f, 0x40, 0xff, 0xff, 0xe9, 0x0e,
+		0x00, 0xff, 0x00, 0x0b, 0x74, 0x40, 0xff, 0xff, 0xdf, 0x2e, 0xc0, 0x8b, 0xff, 0xff, 0xe9, 0x33,
+		0x80, 0x8b, 0xff, 0xff, 0xe5, 0xfe, 0xc0, 0xff, 0xff, 0xf1, 0x6f, 0x80, 0xff, 0xff, 0xe9, 0x5d,
+		0x80, 0xff, 0xff, 0xea, 0x22, 0x40, 0xff, 0xff, 0xf4, 0xfa, 0x40, 0xff, 0xff, 0xdc, 0x03, 0x80,
+		0xff, 0x00, 0x0e, 0x94, 0x00, 0xff, 0xff, 0xdd, 0x60, 0x40, 0xff, 0x00, 0x04, 0x92, 0x80, 0xff,
+		0xff, 0xe1, 0xd6, 0xc0, 0xff, 0x00, 0x0e, 0xc1, 0xc0, 0xff, 0xff, 0xd5, 0xa0, 0xc0, 0xff, 0x00,
+		0x14, 0xbb, 0x40, 0xff, 0xff, 0xf4, 0x6d, 0x00, 0xff, 0x00, 0x1e, 0xcf, 0xc0, 0x8b, 0xff, 0x00,
+		0x16, 0x50, 0x40, 0x8b, 0xff, 0x00, 0x1d, 0x11, 0x80, 0xff, 0x00, 0x12, 0xf4, 0x80, 0xff, 0x00,
+		0x18, 0xab, 0x00, 0xff, 0x00, 0x1a, 0x99, 0x00, 0xff, 0x00, 0x08, 0xb1, 0x40, 0x08, 0x0e, 0xff,
+		0x01, 0x79, 0x21, 0xc0, 0xff, 0x02, 0x92, 0x78, 0x40, 0x15, 0x50, 0x0a, 0xff, 0x00, 0xa6, 0x8f,
+		0x00, 0xff, 0xff, 0x86, 0x51, 0x00, 0x15, 0x4a, 0x0a, 0x0e, 0xff, 0x01, 0x06, 0x06, 0x40, 0xff,
+		0x01, 0xa7, 0xcf, 0xc0, 0x15, 0xff, 0xff, 0xaf, 0x68, 0xc0, 0xff, 0xff, 0xbd, 0x36, 0x40, 0xff,
+		0xff, 0xc1, 0x36, 0xc0, 0xff, 0xff, 0xaa, 0xa4, 0x80, 0xff, 0xff, 0xac, 0x8d, 0x40, 0xff, 0x00,
+		0x40, 0xc2, 0x00, 0xff, 0xff, 0xb9, 0x70, 0xc0, 0xff, 0x00, 0x51, 0x55, 0xc0, 0x1f, 0xff, 0x00,
+		0x31, 0x24, 0x80, 0x8b, 0xff, 0x00, 0x2e, 0x80, 0x00, 0xff, 0x00, 0x1a, 0x48, 0x00, 0xff, 0x00,
+		0x1b, 0xa7, 0x80, 0xff, 0x00, 0x29, 0xeb, 0x40, 0x08, 0xff, 0xff, 0xd3, 0xfc, 0xc0, 0xff, 0x00,
+		0x1d, 0x57, 0x80, 0x05, 0xff, 0xff, 0xf1, 0x30, 0x00, 0xff, 0xff, 0xe4, 0x6c, 0x80, 0xff, 0xff,
+		0xe3, 0x42, 0x00, 0xff, 0xff, 0xee, 0xa7, 0x80, 0xff, 0xff, 0xe0, 0xad, 0x00, 0x8b, 0x08, 0xff,
+		0xff, 0xcb, 0x7f, 0xc0, 0xff, 0xff, 0xd6, 0x3a, 0x80, 0xff, 0x00, 0x2f, 0x6f, 0x00, 0xff, 0x00,
+		0x3c, 0x7a, 0xc0, 0xff, 0x00, 0x3e, 0x2f, 0x40, 0xff, 0x00, 0x2e, 0x1b, 0x40, 0xff, 0x00, 0x1d,
+		0x6e, 0xc0, 0xff, 0x00, 0x2f, 0x33, 0x40, 0x1f, 0xff, 0x00, 0x31, 0x6b, 0x80, 0x8b, 0xff, 0x00,
+		0x0f, 0x92, 0x80, 0xff, 0xff, 0xdd, 0x73, 0x00, 0xff, 0x00, 0x01, 0xcb, 0xc0, 0xff, 0xff, 0xf8,
+		0xad, 0x40, 0xff, 0x00, 0x01, 0x9c, 0x40, 0xff, 0xff, 0xf9, 0x6f, 0x40, 0xff, 0xff, 0xfc, 0xac,
+		0x40, 0xff, 0xff, 0xf8, 0xf3, 0xc0, 0xff, 0x00, 0x05, 0x98, 0x40, 0xff, 0xff, 0xf9, 0x38, 0x40,
+		0x08, 0xff, 0x00, 0x33, 0xc7, 0xc0, 0xff, 0x00, 0x13, 0xd9, 0x40, 0x05, 0xff, 0xff, 0xf3, 0x13,
+		0x80, 0xff, 0x00, 0x35, 0x14, 0xc0, 0xff, 0xff, 0xcf, 0x41, 0xc0, 0xff, 0x00, 0x27, 0x56, 0xc0,
+		0xff, 0xff, 0xc1, 0x11, 0x40, 0x8b, 0x08, 0xff, 0xff, 0xf9, 0xb0, 0x40, 0xff, 0xfe, 0x6b, 0x13,
+		0xc0, 0x15, 0x51, 0x0a, 0xff, 0xff, 0x3b, 0x99, 0x00, 0xff, 0x00, 0xff, 0x5f, 0x40, 0x15, 0x52,
+		0x0a, 0x0e, 0xff, 0x00, 0x7a, 0x8b, 0xc0, 0xff, 0x02, 0x36, 0x20, 0xc0, 0x15, 0xff, 0x00, 0x22,
+		0x85, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00, 0x16, 0x77, 0x80, 0xff, 0x00, 0x1e,
+		0xcd, 0xc0, 0xff, 0x00, 0x24, 0x8d, 0x00, 0xff, 0x00, 0x0d, 0x3a, 0x40, 0xff, 0x00, 0x22, 0xa2,
+		0x00, 0x8b, 0xff, 0x00, 0x1f, 0x4e, 0x80, 0x8b, 0xff, 0x00, 0x14, 0xf9, 0xc0, 0xff, 0xff, 0xf3,
+		0xe9, 0x40, 0xff, 0x00, 0x0b, 0x4e, 0x80, 0xff, 0xff, 0xee, 0x61, 0x40, 0xff, 0x00, 0x0a, 0xbb,
+		0x00, 0xff, 0xff, 0xef, 0x46, 0xc0, 0xff, 0x00, 0x00, 0x50, 0x80, 0xff, 0xff, 0xee, 0x32, 0x40,
+		0x8b, 0xff, 0xff, 0xef, 0x18, 0x80, 0x08, 0xff, 0xff, 0xf3, 0xeb, 0x00, 0xff, 0xff, 0xf1, 0x54,
+		0x40, 0x07, 0xff, 0xff, 0xce, 0x80, 0xc0, 0x8b, 0xff, 0xff, 0xc8, 0xef, 0xc0, 0xff, 0x00, 0x02,
+		0x58, 0xc0, 0xff, 0xff, 0xd3, 0x3c, 0xc0, 0xff, 0xff, 0xe8, 0x2a, 0x00, 0xff, 0xff, 0xd6, 0x51,
+		0x40, 0xff, 0xff, 0xe9, 0xcd, 0xc0, 0xff, 0xff, 0xee, 0x28, 0x00, 0xff, 0xff, 0xda, 0xe0, 0x80,
+		0x8b, 0xff, 0xff, 0xde, 0xdc, 0xc0, 0x8b, 0xff, 0xff, 0xc8, 0x65, 0x80, 0xff, 0x00, 0x30, 0x60,
+		0x00, 0xff, 0xff, 0xcf, 0x35, 0xc0, 0xff, 0x00, 0x45, 0x51, 0x00, 0x8b, 0xff, 0x00, 0x26, 0xc5,
+		0x00, 0x8b, 0xff, 0x00, 0x26, 0x40, 0xc0, 0xff, 0x00, 0x0f, 0x29, 0x80, 0xff, 0x00, 0x1d, 0xab,
+		0x80, 0xff, 0x00, 0x1b, 0xfd, 0x40, 0x08, 0xff, 0xff, 0xde, 0x57, 0xc0, 0xff, 0x00, 0x3e, 0xff,
+		0xc0, 0xff, 0x00, 0xda, 0x56, 0xc0, 0x07, 0x8b, 0xff, 0x00, 0x1a, 0x49, 0xc0, 0xff, 0xff, 0xfe,
+		0xf3, 0xc0, 0xff, 0x00, 0x16, 0xa3, 0xc0, 0xff, 0xff, 0xf5, 0x73, 0x80, 0xff, 0x00, 0x16, 0xab,
+		0x80, 0xff, 0xff, 0xeb, 0x66, 0x80, 0xff, 0x00, 0x2c, 0x45, 0xc0, 0xff, 0xff, 0xd2, 0x36, 0x40,
+		0xff, 0x00, 0x15, 0x97, 0x80, 0xff, 0xff, 0xc9, 0xc5, 0x80, 0x8b, 0xff, 0xff, 0xd0, 0xcb, 0x40,
+		0x8b, 0xff, 0xff, 0xcc, 0xae, 0x80, 0xff, 0xff, 0xf0, 0xf3, 0x40, 0xff, 0xff, 0xdc, 0x12, 0x00,
+		0xff, 0xff, 0xd6, 0xb5, 0xc0, 0x08, 0xff, 0x00, 0xcd, 0x65, 0x00, 0xff, 0xff, 0x71, 0x9b, 0x00,
+		0x15, 0xff, 0xff, 0xee, 0xbd, 0x40, 0x07, 0x8b, 0xff, 0xff, 0xe8, 0xc0, 0x40, 0xff, 0xff, 0xff,
+		0x6a, 0x40, 0xff, 0xff, 0xeb, 0x8a, 0x80, 0xff, 0xff, 0xea, 0x60, 0xc0, 0xff, 0xff, 0xeb, 0xe2,
+		0xc0, 0xff, 0xff, 0xee, 0x3d, 0x40, 0xff, 0xff, 0xef, 0x7a, 0x00, 0xff, 0xff, 0xe4, 0x2d, 0x00,
+		0xff, 0xff, 0xf1, 0x25, 0x80, 0xff, 0xff, 0xe1, 0x47, 0x80, 0x8b, 0xff, 0xff, 0xd9, 0x7a, 0xc0,
+		0x8b, 0xff, 0xff, 0xe7, 0x89, 0x00, 0xff, 0x00, 0x19, 0x0b, 0x40, 0x8b, 0xff, 0x00, 0x1c, 0x00,
+		0xc0, 0x8b, 0xff, 0x00, 0x15, 0xa8, 0x00, 0xff, 0x00, 0x0f, 0x44, 0x40, 0xff, 0x00, 0x1b, 0x1e,
+		0x00, 0xff, 0x00, 0x2c, 0x21, 0x40, 0xff, 0x00, 0x07, 0xd4, 0x00, 0xff, 0x00, 0x1a, 0x5d, 0xc0,
+		0xff, 0x00, 0x04, 0xad, 0x40, 0xff, 0x00, 0x21, 0x71, 0x80, 0xff, 0xff, 0xfe, 0x22, 0x80, 0xff,
+		0x00, 0x19, 0xe5, 0x00, 0x8b, 0x08, 0xff, 0xff, 0x14, 0x66, 0xc0, 0xff, 0xff, 0x26, 0x86, 0x00,
+		0x15, 0x53, 0x0a, 0x0e, 0xff, 0x00, 0xf8, 0x8b, 0x40, 0xff, 0x00, 0xfc, 0xdc, 0x00, 0x15, 0x54,
+		0x0a, 0xff, 0xfe, 0xb2, 0xe2, 0x00, 0xff, 0xff, 0x6c, 0x6d, 0x80, 0x15, 0x54, 0x0a, 0x0e, 0xff,
+		0x00, 0x5b, 0x7a, 0x40, 0xff, 0x01, 0x5a, 0xed, 0x00, 0x15, 0xff, 0xff, 0xc1, 0x00, 0x40, 0xff,
+		0x01, 0x02, 0xe6, 0x80, 0xff, 0xff, 0x81, 0x23, 0xc0, 0xff, 0x00, 0x3f, 0xdc, 0xc0, 0xff, 0x00,
+		0xbd, 0xdc, 0x00, 0x07, 0x0e, 0xff, 0x00, 0x46, 0xc4, 0x00, 0xff, 0x01, 0x5b, 0xca, 0x00, 0x15,
+		0x23, 0x0a, 0x0e, 0xff, 0x00, 0xff, 0xb6, 0x80, 0xff, 0x00, 0x12, 0xe3, 0x80, 0x15, 0x51, 0x0a,
+		0xff, 0xff, 0x3b, 0x99, 0x00, 0xff, 0x00, 0xff, 0x5f, 0x40, 0x15, 0x52, 0x0a, 0xff, 0x00, 0x60,
+		0x07, 0x80, 0xff, 0xff, 0x72, 0xa4, 0x40, 0x15, 0xff, 0x00, 0x2d, 0xbd, 0x40, 0xff, 0x00, 0x7b,
+		0x68, 0x80, 0xff, 0x00, 0x41, 0x96, 0x80, 0x06, 0xff, 0x00, 0x3e, 0x22, 0xc0, 0xff, 0xff, 0x82,
+		0xdd, 0x80, 0xff, 0x00, 0x2f, 0x77, 0x00, 0xff, 0x00, 0x06, 0xe7, 0x80, 0xff, 0xff, 0xbf, 0x46,
+		0x80, 0xff, 0x00, 0x7d, 0x22, 0x80, 0x05, 0xff, 0x00, 0x22, 0xa2, 0x40, 0xff, 0x00, 0x09, 0xb6,
+		0xc0, 0xff, 0x00, 0x18, 0x0c, 0xc0, 0xff, 0x00, 0x1f, 0x68, 0x80, 0x8b, 0xff, 0x00, 0x23, 0x73,
+		0x80, 0x8b, 0xff, 0x00, 0x1e, 0xdd, 0x00, 0xff, 0xff, 0xed, 0xa8, 0x40, 0xff, 0x00, 0x1d, 0xc7,
+		0xc0, 0xff, 0xff, 0xde, 0x42, 0xc0, 0xff, 0x00, 0x0e, 0x46, 0xc0, 0xff, 0xff, 0xe8, 0xfe, 0x80,
+		0xff, 0x00, 0x09, 0xbb, 0xc0, 0xff, 0xff, 0xe8, 0x92, 0x00, 0xff, 0x00, 0x00, 0x27, 0x80, 0xff,
+		0xff, 0xe9, 0xb2, 0xc0, 0x8b, 0x08, 0xff, 0xff, 0xa1, 0xee, 0xc0, 0x06, 0xff, 0x00, 0x2d, 0xbd,
+		0x40, 0xff, 0xff, 0xd7, 0x70, 0x80, 0x15, 0xff, 0x00, 0x31, 0x30, 0xc0, 0x06, 0xff, 0x00, 0x10,
+		0x6e, 0x00, 0x8b, 0xff, 0x00, 0x13, 0x77, 0x80, 0xff, 0x00, 0x00, 0x2e, 0x40, 0xff, 0x00, 0x10,
+		0x22, 0x00, 0xff, 0xff, 0xf6, 0xed, 0x00, 0xff, 0x00, 0x0f, 0x38, 0x80, 0xff, 0xff, 0xf7, 0x70,
+		0x80, 0xff, 0x00, 0x06, 0xf8, 0x40, 0xff, 0xff, 0xf2, 0x2c, 0x40, 0x8b, 0xff, 0xff, 0xf3, 0x00,
+		0x80, 0x8b, 0xff, 0xff, 0xf3, 0xbb, 0x40, 0xff, 0xff, 0xf9, 0xcf, 0xc0, 0xff, 0xff, 0xf3, 0x06,
+		0x80, 0xff, 0xff, 0xf2, 0x80, 0x80, 0xff, 0xff, 0xf7, 0x75, 0x80, 0xff, 0xff, 0xf0, 0x20, 0x80,
+		0xff, 0xff, 0xf5, 0xf4, 0xc0, 0xff, 0xff, 0xec, 0x58, 0x40, 0xff, 0x00, 0x00, 0x14, 0xc0, 0xff,
+		0xff, 0xef, 0x95, 0xc0, 0x8b, 0x08, 0xff, 0xff, 0xcc, 0x38, 0x40, 0x06, 0x0e, 0xff, 0x00, 0x7b,
+		0x68, 0xc0, 0xff, 0x02, 0x6d, 0x5c, 0x40, 0x15, 0x55, 0x0a, 0x0e, 0xff, 0x01, 0x86, 0xf0, 0x80,
+		0xff, 0x01, 0xf8, 0x61, 0xc0, 0x15, 0xff, 0x00, 0x49, 0xf6, 0xc0, 0xff, 0xff, 0xc3, 0x8d, 0x00,
+		0xff, 0x00, 0x3c, 0x48, 0x00, 0xff, 0xff, 0xb5, 0x55, 0x80, 0xff, 0xff, 0xb5, 0x58, 0xc0, 0xff,
+		0xff, 0xc3, 0x90, 0x80, 0xff, 0xff, 0xc3, 0xba, 0x40, 0xff, 0xff, 0xb6, 0x0c, 0x80, 0xff, 0xff,
+		0xb6, 0x01, 0x40, 0xff, 0x00, 0x3c, 0x76, 0x80, 0xff, 0xff, 0xc3, 0xbc, 0x00, 0xff, 0x00, 0x4a,
+		0xa1, 0x00, 0xff, 0x00, 0x4a, 0xaa, 0x80, 0xff, 0x00, 0x3c, 0x72, 0x40, 0xff, 0x00, 0x3c, 0x46,
+		0x80, 0xff, 0x00, 0x49, 0xf6, 0xc0, 0x1e, 0xff, 0xff, 0x79, 0xeb, 0x80, 0xff, 0x00, 0x51, 0x98,
+		0x80, 0x15, 0xff, 0x00, 0x28, 0xa0, 0x80, 0xff, 0x00, 0x21, 0xfa, 0x40, 0xff, 0xff, 0xdc, 0xe6,
+		0x00, 0xff, 0xff, 0xd2, 0xf4, 0x80, 0xff, 0xff, 0xd2, 0xa0, 0xc0, 0xff, 0xff, 0xdd, 0xe5, 0x40,
+		0xff, 0xff, 0xdc, 0xe5, 0x00, 0xff, 0xff, 0xd7, 0x76, 0x40, 0xff, 0xff, 0xd7, 0x3f, 0x40, 0xff,
+		0xff, 0xde, 0x01, 0x40, 0xff, 0x00, 0x23, 0x26, 0xc0, 0xff, 0x00, 0x2d, 0x0f, 0x40, 0xff, 0x00,
+		0x2d, 0x48, 0x00, 0xff, 0x00, 0x22, 0x20, 0x00, 0xff, 0x00, 0x23, 0x21, 0xc0, 0xff, 0x00, 0x28,
+		0xa9, 0x40, 0x1f, 0x0e, 0xff, 0x00, 0x2d, 0xbd, 0x40, 0xff, 0x00, 0x50, 0x42, 0x40, 0x15, 0xff,
+		0xff, 0xc1, 0x00, 0x40, 0xff, 0x01, 0x9b, 0xa6, 0x80, 0xff, 0x00, 0x3e, 0xff, 0xc0, 0x07, 0xff,
+		0xff, 0x14, 0x66, 0xc0, 0xff, 0x01, 0xee, 0x80, 0x00, 0x15, 0x21, 0x0a, 0x0e, 0xff, 0x00, 0x6f,
+		0x53, 0xc0, 0xff, 0x02, 0x2a, 0x0b, 0xc0, 0x15, 0xff, 0x00, 0x2e, 0x9a, 0x00, 0xff, 0xff, 0xe0,
+		0xee, 0xc0, 0x05, 0xff, 0x00, 0x04, 0xf5, 0x40, 0xff, 0x00, 0x09, 0x69, 0x00, 0xff, 0xff, 0xff,
+		0x4a, 0xc0, 0xff, 0x00, 0x04, 0x76, 0x80, 0xff, 0x00, 0x05, 0x64, 0xc0, 0xff, 0x00, 0x06, 0xd2,
+		0xc0, 0xff, 0x00, 0x11, 0x95, 0xc0, 0xff, 0x00, 0x16, 0x3f, 0x40, 0xff, 0x00, 0x20, 0xa4, 0x00,
+		0xff, 0x00, 0x13, 0xfb, 0xc0, 0xff, 0x00, 0x26, 0x68, 0x00, 0x8b, 0xff, 0x00, 0x2f, 0xcf, 0x80,
+		0x8b, 0xff, 0x00, 0x1b, 0x79, 0xc0, 0xff, 0xff, 0xe2, 0xab, 0xc0, 0x8b, 0xff, 0xff, 0xe0, 0x45,
+		0x80, 0x8b, 0xff, 0xff, 0xe1, 0xeb, 0x40, 0xff, 0xff, 0xe9, 0x75, 0x80, 0xff, 0xff, 0xe7, 0xdc,
+		0x40, 0xff, 0xff, 0xe2, 0xfb, 0xc0, 0xff, 0xff, 0xe8, 0x67, 0x40, 0xff, 0xff, 0xe2, 0x0d, 0x40,
+		0xff, 0xff, 0xe7, 0xa6, 0x00, 0xff, 0xff, 0xb6, 0x8b, 0xc0, 0xff, 0xff, 0xcf, 0x3d, 0x00, 0xff,
+		0xff, 0xc8, 0x4a, 0x40, 0xff, 0xff, 0xb2, 0xf4, 0x80, 0x08, 0xff, 0xff, 0xd3, 0xfc, 0xc0, 0xff,
+		0x01, 0x17, 0x9c, 0x80, 0xff, 0x00, 0x3e, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xf9, 0x82, 0x80, 0xff,
+		0x00, 0x02, 0x27, 0x40, 0xff, 0xff, 0xfb, 0x19, 0x40, 0xff, 0xff, 0xfb, 0x25, 0x80, 0xff, 0xff,
+		0xfd, 0xec, 0x00, 0xff, 0xff, 0xfe, 0x35, 0x00, 0xff, 0xff, 0xfb, 0xf1, 0xc0, 0xff, 0xff, 0xfc,
+		0x80, 0x80, 0xff, 0xff, 0xfd, 0xec, 0x00, 0xff, 0xff, 0xff, 0x5c, 0x80, 0xff, 0xff, 0xfb, 0x70,
+		0x80, 0x8b, 0x08, 0xff, 0xff, 0x49, 0xe8, 0x40, 0x06, 0xff, 0x00, 0x37, 0xdf, 0x40, 0xff, 0x00,
+		0x3e, 0x70, 0x40, 0xff, 0x00, 0x37, 0x4c, 0x00, 0xff, 0x00, 0x19, 0xf2, 0x80, 0xff, 0x00, 0x27,
+		0xb8, 0x00, 0xff, 0x00, 0x24, 0x9b, 0x00, 0xff, 0x00, 0x0e, 0x34, 0x80, 0xff, 0x00, 0x0d, 0x17,
+		0x80, 0xff, 0x00, 0x20, 0x89, 0x00, 0xff, 0x00, 0x20, 0x88, 0x40, 0x8b, 0xff, 0x00, 0x2f, 0x58,
+		0x00, 0x8b, 0xff, 0x00, 0x3c, 0x97, 0x80, 0xff, 0xff, 0xc9, 0xeb, 0x80, 0xff, 0x00, 0x33, 0x5d,
+		0x00, 0xff, 0xff, 0xb0, 0x65, 0xc0, 0x8b, 0xff, 0xff, 0xc3, 0x5b, 0x80, 0x8b, 0xff, 0xff, 0xc7,
+		0xdc, 0x40, 0xff, 0xff, 0xe1, 0x1a, 0x80, 0xff, 0xff, 0xe1, 0xfd, 0x40, 0xff, 0xff, 0xcb, 0xcc,
+		0xc0, 0x08, 0x0e, 0xff, 0x01, 0x01, 0xa5, 0x00, 0xff, 0x02, 0x7d, 0xda, 0x40, 0x15, 0xff, 0xff,
+		0xcd, 0xa9, 0x80, 0x8b, 0xff, 0xff, 0xcf, 0x6d, 0x00, 0xff, 0xff, 0xe9, 0x7a, 0xc0, 0xff, 0xff,
+		0xde, 0x67, 0x00, 0xff, 0xff, 0xd8, 0x4a, 0x00, 0x08, 0xff, 0x00, 0x24, 0x3f, 0x00, 0xff, 0xff,
+		0xda, 0xe4, 0x00, 0x05, 0xff, 0x00, 0x18, 0x03, 0xc0, 0xff, 0x00, 0x1e, 0x03, 0x40, 0xff, 0x00,
+		0x23, 0x67, 0x00, 0xff, 0x00, 0x10, 0x9f, 0x40, 0xff, 0x00, 0x21, 0xd2, 0x80, 0x8b, 0x08, 0xff,
+		0x00, 0x2c, 0xfa, 0x80, 0xff, 0x00, 0x1d, 0xab, 0xc0, 0xff, 0xff, 0xe2, 0xc6, 0x00, 0xff, 0xff,
+		0xe2, 0x14, 0x80, 0xff, 0xff, 0xe9, 0x0a, 0x40, 0xff, 0xff, 0xee, 0x2d, 0x80, 0xff, 0xff, 0xe3,
+		0x84, 0xc0, 0xff, 0xff, 0xbe, 0x7b, 0xc0, 0x1f, 0xff, 0xff, 0xf9, 0x61, 0x40, 0x8b, 0xff, 0xff,
+		0xf9, 0x62, 0x80, 0xff, 0x00, 0x00, 0x53, 0x00, 0xff, 0xff, 0xf9, 0x69, 0x40, 0xff, 0x00, 0x00,
+		0xa1, 0x40, 0x08, 0xff, 0xff, 0xcd, 0xf2, 0x40, 0x07, 0xff, 0x00, 0x09, 0xa6, 0x80, 0xff, 0x00,
+		0x01, 0x2e, 0x40, 0xff, 0x00, 0x09, 0xe0, 0x40, 0xff, 0x00, 0x00, 0xa1, 0xc0, 0xff, 0x00, 0x0a,
+		0x5d, 0x40, 0x8b, 0x08, 0xff, 0x00, 0x4c, 0x8a, 0x00, 0xff, 0x00, 0x0b, 0x54, 0x80, 0xff, 0xff,
+		0xdb, 0x15, 0x80, 0xff, 0xff, 0xed, 0x9b, 0x00, 0xff, 0xff, 0xdc, 0x68, 0xc0, 0xff, 0xff, 0xd8,
+		0xad, 0x80, 0xff, 0xff, 0xe2, 0xd8, 0xc0, 0xff, 0xff, 0xce, 0xf9, 0x00, 0x1f, 0xff, 0xff, 0xd0,
+		0xa9, 0x00, 0x8b, 0xff, 0xff, 0xe1, 0xd2, 0xc0, 0xff, 0x00, 0x1b, 0x6a, 0xc0, 0xff, 0xff, 0xfa,
+		0xbb, 0xc0, 0xff, 0x00, 0x05, 0x24, 0x40, 0xff, 0xff, 0xf6, 0xaf, 0x80, 0xff, 0x00, 0x09, 0x17,
+		0x00, 0xff, 0x00, 0x04, 0x2f, 0x80, 0xff, 0x00, 0x09, 0x69, 0x80, 0xff, 0xff, 0xf7, 0x30, 0x00,
+		0xff, 0x00, 0x09, 0x5c, 0x40, 0x08, 0xff, 0xff, 0xd1, 0x66, 0x00, 0xff, 0xff, 0xcc, 0x38, 0x80,
+		0x05, 0xff, 0x00, 0x23, 0xe6, 0x40, 0xff, 0xff, 0xd6, 0xfb, 0x40, 0xff, 0x00, 0x33, 0xdd, 0xc0,
+		0xff, 0xff, 0xe8, 0x49, 0x00, 0xff, 0x00, 0x36, 0x8b, 0xc0, 0x8b, 0xff, 0x00, 0x4f, 0xbf, 0xc0,
+		0x8b, 0xff, 0x00, 0x47, 0x5c, 0x40, 0xff, 0x00, 0x32, 0x03, 0x40, 0x8b, 0xff, 0x00, 0x41, 0x5a,
+		0x00, 0x8b, 0xff, 0x00, 0x2a, 0x13, 0x00, 0xff, 0xff, 0xe0, 0xfb, 0xc0, 0xff, 0x00, 0x24, 0x2a,
+		0x40, 0xff, 0xff, 0xd5, 0xa9, 0x00, 0xff, 0x00, 0x07, 0x7b, 0xc0, 0xff, 0x00, 0x21, 0x29, 0xc0,
+		0xff, 0x00, 0x0a, 0x8f, 0x40, 0xff, 0x00, 0x17, 0x1c, 0xc0, 0xff, 0x00, 0x1e, 0xfe, 0xc0, 0x8b,
+		0xff, 0x00, 0x24, 0x97, 0x00, 0x8b, 0xff, 0x00, 0x39, 0x8f, 0x40, 0xff, 0xff, 0xc7, 0x9f, 0xc0,
+		0xff, 0x00, 0x31, 0xef, 0xc0, 0xff, 0xff, 0xb5, 0x7d, 0x80, 0x8b, 0x08, 0x0e, 0xff, 0x01, 0x8c,
+		0xfb, 0x00, 0xff, 0x02, 0xf3, 0x20, 0x00, 0x15, 0x4f, 0x0a, 0xff, 0xff, 0x34, 0x54, 0xc0, 0xff,
+		0xff, 0xdf, 0x34, 0xc0, 0x15, 0x38, 0x0a, 0x0e, 0xff, 0x00, 0x18, 0x2a, 0x00, 0xff, 0xff, 0x59,
+		0x71, 0x00, 0x15, 0xff, 0x00, 0x3e, 0x22, 0xc0, 0x06, 0xff, 0x00, 0x00, 0xbe, 0x40, 0xff, 0x00,
+		0x4b, 0x5e, 0x00, 0xff, 0x00, 0x00, 0x4a, 0xc0, 0xff, 0x00, 0x4b, 0xa3, 0x00, 0xff, 0xff, 0xff,
+		0xd4, 0x00, 0xff, 0x00, 0x4b, 0xf7, 0x00, 0xff, 0x00, 0x14, 0xca, 0x00, 0xff, 0xff, 0xd3, 0xfc,
+		0x80, 0xff, 0x00, 0x2c, 0x5f, 0x00, 0xff, 0xff, 0xe4, 0x61, 0x80, 0xff, 0x00, 0x30, 0xa4, 0xc0,
+		0x8b, 0xff, 0x00, 0x33, 0x81, 0x00, 0x8b, 0xff, 0x00, 0x30, 0x05, 0x80, 0xff, 0x00, 0x1e, 0xba,
+		0x40, 0xff, 0x00, 0x17, 0x22, 0x00, 0xff, 0x00, 0x2f, 0xcf, 0x40, 0xff, 0x00, 0x05, 0x97, 0x40,
+		0xff, 0xff, 0xd4, 0xf7, 0x40, 0xff, 0x00, 0x22, 0x46, 0x40, 0xff, 0xff, 0xdd, 0x46, 0xc0, 0xff,
+		0x00, 0x2a, 0x53, 0x00, 0x8b, 0xff, 0x00, 0x25, 0x11, 0x00, 0x8b, 0xff, 0x00, 0x1f, 0x9c, 0xc0,
+		0xff, 0x00, 0x1a, 0x14, 0x40, 0xff, 0x00, 0x13, 0x24, 0x80, 0xff, 0x00, 0x1d, 0x3d, 0x80, 0x08,
+		0xff, 0xff, 0xe5, 0x3f, 0x40, 0xff, 0x00, 0x32, 0xea, 0xc0, 0x05, 0x8b, 0xff, 0xff, 0xea, 0xde,
+		0x00, 0xff, 0xff, 0xcf, 0x8e, 0x80, 0xff, 0xff, 0xde, 0x1b, 0x40, 0x1e, 0xff, 0xff, 0xf3, 0xeb,
+		0xc0, 0x8b, 0xff, 0xff, 0xf4, 0x11, 0xc0, 0xff, 0x00, 0x06, 0x7c, 0x80, 0xff, 0xff, 0xf8, 0x84,
+		0x00, 0xff, 0x00, 0x0d, 0x27, 0x80, 0xff, 0xff, 0xf7, 0x74, 0xc0, 0xff, 0x00, 0x0f, 0x04, 0x00,
+		0xff, 0x00, 0x00, 0x22, 0x80, 0xff, 0x00, 0x12, 0x47, 0xc0, 0x8b, 0xff, 0x00, 0x0f, 0x5b, 0x00,
+		0x08, 0xff, 0x01, 0x54, 0xe2, 0xc0, 0xff, 0xff, 0xc0, 0x23, 0x40, 0xff, 0xfe, 0xf7, 0x0f, 0x00,
+		0x07, 0x8b, 0xff, 0xff, 0xe1, 0x53, 0x40, 0xff, 0xff, 0xfe, 0x7c, 0x00, 0xff, 0xff, 0xe5, 0x8f,
+		0x80, 0xff, 0xff, 0xf4, 0x98, 0x40, 0xff, 0xff, 0xe5, 0xf3, 0x00, 0xff, 0xff, 0xee, 0x56, 0x40,
+		0xff, 0xff, 0xd7, 0xa8, 0x40, 0xff, 0xff, 0xdc, 0xa5, 0x80, 0xff, 0xff, 0xe7, 0x0f, 0x00, 0xff,
+		0xff, 0xdb, 0xcf, 0x80, 0x8b, 0xff, 0xff, 0xe0, 0x31, 0x80, 0x8b, 0xff, 0xff, 0xe0, 0x1e, 0x00,
+		0xff, 0x00, 0x13, 0xa8, 0xc0, 0xff, 0xff, 0xee, 0x36, 0x40, 0xff, 0x00, 0x24, 0x13, 0x00, 0xff,
+		0xff, 0xf2, 0x23, 0x00, 0xff, 0x00, 0x1c, 0x1c, 0x80, 0xff, 0xff, 0xfe, 0xfa, 0x40, 0xff, 0x00,
+		0x1c, 0x8e, 0xc0, 0x8b, 0xff, 0x00, 0x1e, 0x01, 0x80, 0x08, 0xff, 0x01, 0x0e, 0xfb, 0x80, 0xff,
+		0xff, 0xbe, 0x69, 0x80, 0xff, 0xff, 0x01, 0x6a, 0x40, 0x07, 0x8b, 0xff, 0xff, 0x81, 0x69, 0xc0,
+		0xff, 0xff, 0xec, 0xf6, 0x00, 0xff, 0xff, 0x81, 0xbd, 0x40, 0xff, 0xff, 0xff, 0x30, 0xc0, 0xff,
+		0xff, 0x8c, 0x58, 0xc0, 0x08, 0x0e, 0xff, 0x01, 0xb3, 0xd0, 0xc0, 0xff, 0x02, 0x99, 0x5f, 0x80,
+		0x15, 0xff, 0xff, 0x82, 0xdd, 0x40, 0x06, 0xff, 0xff, 0xd1, 0x99, 0x00, 0x8b, 0xff, 0xff, 0xce,
+		0x2e, 0xc0, 0xff, 0xff, 0xff, 0xcd, 0x00, 0xff, 0xff, 0xcf, 0xfe, 0x80, 0xff, 0xff, 0xeb, 0x36,
+		0xc0, 0xff, 0xff, 0xbd, 0xa0, 0x40, 0xff, 0xff, 0xe3, 0x43, 0x00, 0xff, 0xff, 0xdb, 0xbb, 0x80,
+		0xff, 0xff, 0xc5, 0x8c, 0x00, 0x8b, 0xff, 0xff, 0xc2, 0xa2, 0xc0, 0x8b, 0xff, 0xff, 0xa5, 0xe7,
+		0x80, 0xff, 0x00, 0x4d, 0x56, 0x00, 0xff, 0xff, 0xb2, 0xcd, 0x00, 0xff, 0x00, 0x65, 0x5a, 0xc0,
+		0xff, 0xff, 0xf9, 0x5c, 0xc0, 0x08, 0xff, 0xfe, 0x79, 0xec, 0x80, 0xff, 0x00, 0x3b, 0x8c, 0x00,
+		0xff, 0x02, 0xa4, 0x97, 0x80, 0xff, 0x00, 0x4b, 0xf1, 0xc0, 0xff, 0xfd, 0x5b, 0x68, 0x80, 0xff,
+		0x00, 0x39, 0xd2, 0x40, 0x07, 0x0e, 0xff, 0x01, 0x29, 0xbc, 0x80, 0xff, 0x01, 0x4a, 0xf4, 0x80,
+		0x15, 0x24, 0x0a, 0x0e, 0xff, 0x01, 0x79, 0x21, 0xc0, 0xff, 0x02, 0x92, 0x78, 0x40, 0x15, 0x50,
+		0x0a, 0xff, 0xff, 0x3c, 0xf6, 0x00, 0xff, 0xff, 0xc3, 0x96, 0xc0, 0x15, 0x4e, 0x0a, 0x0e, 0xff,
+		0x01, 0x29, 0xbc, 0x40, 0xff, 0x02, 0x78, 0x94, 0x40, 0x15, 0xff, 0xff, 0xd5, 0xb6, 0x80, 0x8b,
+		0xff, 0xff, 0x7b, 0xf6, 0x00, 0xff, 0xff, 0xb7, 0x82, 0x00, 0xff, 0x00, 0x10, 0x65, 0x80, 0xff,
+		0xff, 0xe0, 0xee, 0xc0, 0xff, 0x00, 0x5f, 0xcb, 0x00, 0xff, 0x00, 0x18, 0x29, 0xc0, 0x8b, 0xff,
+		0xff, 0x0a, 0x0b, 0xc0, 0xff, 0xff, 0x9c, 0xc1, 0x40, 0x8b, 0x8b, 0xff, 0xff, 0xc9, 0xa1, 0x80,
+		0xff, 0x00, 0xfe, 0x96, 0x00, 0x8b, 0x8b, 0xff, 0x00, 0x36, 0x5e, 0x80, 0xff, 0xff, 0xa2, 0xcb,
+		0xc0, 0x8b, 0x05, 0x0e, 0xff, 0x00, 0xfb, 0xd8, 0x80, 0xff, 0x02, 0x6e, 0x3b, 0x80, 0x15, 0xff,
+		0xff, 0xac, 0xdf, 0x40, 0xff, 0xff, 0xb6, 0xed, 0x00, 0xff, 0xff, 0xb4, 0xb8, 0x00, 0xff, 0xff,
+		0x8d, 0x4c, 0x80, 0xff, 0xff, 0x92, 0xe5, 0xc0, 0xff, 0x00, 0x46, 0xc3, 0x80, 0xff, 0xff, 0xbd,
+		0x1c, 0xc0, 0xff, 0x00, 0x4f, 0x33, 0x40, 0xff, 0x00, 0x49, 0x27, 0x80, 0xff, 0x00, 0x4e, 0x4f,
+		0x80, 0xff, 0x00, 0x3a, 0x8e, 0x80, 0xff, 0x00, 0x81, 0x6b, 0x00, 0xff, 0x00, 0x78, 0x00, 0x80,
+		0xff, 0xff, 0xb6, 0xbe, 0xc0, 0xff, 0x00, 0x39, 0xff, 0x00, 0xff, 0xff, 0xb8, 0x07, 0x40, 0x1f,
+		0xff, 0xff, 0xa0, 0x58, 0x80, 0xff, 0xff, 0x46, 0xa1, 0x40, 0x15, 0xff, 0x00, 0x56, 0x2a, 0x40,
+		0xff, 0x00, 0x2d, 0x2c, 0xc0, 0xff, 0x00, 0x2b, 0x19, 0xc0, 0xff, 0x00, 0x2d, 0xa1, 0x00, 0xff,
+		0x00, 0x2e, 0x08, 0x00, 0xff, 0x00, 0x2c, 0x68, 0x00, 0xff, 0xff, 0xd4, 0x6d, 0x00, 0xff, 0xff,
+		0xaa, 0x4d, 0x80, 0xff, 0xff, 0xa9, 0xee, 0x00, 0xff, 0xff, 0xd0, 0x79, 0x80, 0xff, 0xff, 0xdb,
+		0x48, 0x00, 0xff, 0xff, 0xd5, 0x40, 0x00, 0xff, 0xff, 0xd3, 0x8f, 0xc0, 0xff, 0xff, 0xd1, 0x79,
+		0x00, 0xff, 0x00, 0x27, 0x11, 0xc0, 0xff, 0x00, 0x53, 0xb9, 0xc0, 0x1e, 0xff, 0xff, 0xaf, 0xc0,
+		0xc0, 0xff, 0xff, 0x19, 0x65, 0x00, 0x15, 0x53, 0x0a, 0x0e, 0xff, 0x01, 0xbe, 0x2b, 0xc0, 0xff,
+		0x00, 0xfc, 0xdc, 0x00, 0x15, 0xff, 0xff, 0x68, 0x1c, 0xc0, 0xff, 0x00, 0x93, 0x92, 0x80, 0xff,
+		0xff, 0xd9, 0x2a, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0x00, 0x78, 0xd1, 0xc0, 0xff, 0xff,
+		0x89, 0xc5, 0x00, 0xff, 0xff, 0x80, 0x46, 0xc0, 0xff, 0xff, 0x74, 0x31, 0x80, 0xff, 0x00, 0x27,
+		0xb2, 0xc0, 0xff, 0xff, 0xd8, 0x4d, 0x80, 0xff, 0x00, 0x9d, 0xed, 0xc0, 0xff, 0x00, 0xa8, 0x48,
+		0xc0, 0x05, 0xff, 0xff, 0x4a, 0xc5, 0x40, 0xff, 0x00, 0x17, 0x4d, 0x40, 0x15, 0x56, 0x0a, 0x0e,
+		0xff, 0x00, 0xfc, 0xdc, 0x00, 0xff, 0x02, 0x53, 0x78, 0x40, 0x15, 0xff, 0xff, 0xea, 0xd5, 0x40,
+		0xff, 0x00, 0x16, 0xf8, 0x80, 0xff, 0xff, 0xe2, 0x3b, 0xc0, 0xff, 0x00, 0x0d, 0x47, 0x00, 0xff,
+		0xff, 0xe0, 0xbe, 0x00, 0x8b, 0xff, 0xff, 0xd7, 0x92, 0x80, 0x8b, 0xff, 0xff, 0xc9, 0xc2, 0x80,
+		0xff, 0xff, 0xe9, 0x02, 0x00, 0xff, 0xff, 0xde, 0xdc, 0x00, 0xff, 0xff, 0xb2, 0x81, 0x40, 0xff,
+		0xff, 0xe5, 0x31, 0x40, 0xff, 0xff, 0xc1, 0x50, 0x00, 0xff, 0xff, 0xf9, 0x42, 0x80, 0xff, 0xff,
+		0xb7, 0xa8, 0x00, 0x8b, 0xff, 0xff, 0xac, 0x0d, 0x80, 0x8b, 0xff, 0xff, 0x8a, 0xa2, 0x40, 0xff,
+		0x00, 0x12, 0xf1, 0x80, 0xff, 0xff, 0xc1, 0x5b, 0x40, 0xff, 0x00, 0x03, 0xb9, 0x80, 0xff, 0xff,
+		0xf3, 0xd2, 0xc0, 0xff, 0x00, 0x1c, 0xa7, 0x40, 0xff, 0xff, 0xa2, 0x53, 0x40, 0xff, 0x00, 0x3c,
+		0x4e, 0x80, 0xff, 0xff, 0xde, 0xa1, 0x40, 0xff, 0x00, 0x31, 0x53, 0xc0, 0x8b, 0xff, 0x00, 0x1f,
+		0xc2, 0xc0, 0x8b, 0xff, 0x00, 0x1d, 0xdb, 0xc0, 0xff, 0x00, 0x0d, 0xc9, 0x40, 0xff, 0x00, 0x14,
+		0x1c, 0x40, 0xff, 0x00, 0x18, 0x43, 0x00, 0x08, 0xff, 0xff, 0xe0, 0xee, 0x80, 0xff, 0x00, 0xe5,
+		0x8e, 0xc0, 0xff, 0x00, 0x3e, 0x22, 0xc0, 0xff, 0xff, 0x59, 0x71, 0x00, 0xff, 0x00, 0xe7, 0x48,
+		0xc0, 0xff, 0x00, 0x8f, 0x42, 0x00, 0xff, 0x00, 0x3f, 0xdc, 0xc0, 0xff, 0xff, 0x70, 0xbe, 0x00,
+		0xff, 0x00, 0xcc, 0x88, 0x00, 0xff, 0x00, 0xa9, 0x25, 0xc0, 0xff, 0x00, 0x3e, 0x22, 0xc0, 0xff,
+		0xff, 0x18, 0xb7, 0x80, 0x07, 0xff, 0xff, 0x4c, 0x79, 0x40, 0xff, 0xfe, 0xd4, 0x59, 0x40, 0x15,
+		0x8b, 0xff, 0x00, 0x69, 0xc4, 0x00, 0xff, 0x00, 0x0d, 0x59, 0x00, 0xff, 0x00, 0x2e, 0x1f, 0x40,
+		0xff, 0x00, 0x06, 0x1f, 0xc0, 0xff, 0x00, 0x12, 0x5d, 0x00, 0xff, 0x00, 0x12, 0x27, 0x00, 0xff,
+		0x00, 0x36, 0x70, 0xc0, 0xff, 0x00, 0x1e, 0x26, 0x00, 0xff, 0x00, 0x18, 0xe8, 0xc0, 0xff, 0x00,
+		0x1d, 0x7c, 0x00, 0x8b, 0xff, 0x00, 0x2d, 0x10, 0x00, 0x8b, 0xff, 0x00, 0x19, 0xac, 0x00, 0xff,
+		0xff, 0xc8, 0xf8, 0x00, 0xff, 0x00, 0x0a, 0xac, 0x00, 0xff, 0xff, 0xde, 0x23, 0x80, 0x08, 0xff,
+		0xfe, 0x9c, 0x71, 0xc0, 0x07, 0xff, 0xff, 0xf6, 0x2e, 0xc0, 0xff, 0xff, 0xd3, 0xa5, 0x40, 0xff,
+		0xff, 0xe3, 0x6b, 0x40, 0xff, 0xff, 0xe1, 0x42, 0x40, 0xff, 0xff, 0xdd, 0x70, 0xc0, 0x8b, 0xff,
+		0xff, 0xe9, 0x7a, 0x80, 0x8b, 0xff, 0xff, 0xdf, 0x30, 0xc0, 0xff, 0x00, 0x0d, 0xc2, 0xc0, 0xff,
+		0xff, 0xe9, 0x84, 0xc0, 0xff, 0x00, 0x36, 0xee, 0x00, 0xff, 0xff, 0xe4, 0x16, 0x00, 0xff, 0x00,
+		0x44, 0x33, 0x00, 0xff, 0x00, 0x00, 0x05, 0x80, 0xff, 0x00, 0x69, 0x29, 0xc0, 0x8b, 0xff, 0x00,
+		0x1b, 0xe4, 0x00, 0x08, 0x0e, 0xff, 0x00, 0xa1, 0x71, 0x80, 0xff, 0x01, 0xd2, 0x11, 0xc0, 0x15,
+		0xff, 0xff, 0xd0, 0xd8, 0x40, 0x8b, 0xff, 0xff, 0xcd, 0x8e, 0x80, 0xff, 0xff, 0xe5, 0x20, 0x80,
+		0xff, 0xff, 0xe2, 0x51, 0x80, 0xff, 0xff, 0xc7, 0xfa, 0xc0, 0xff, 0xff, 0xe7, 0x56, 0x40, 0xff,
+		0xff, 0xd1, 0x72, 0x40, 0xff, 0xff, 0xfc, 0x88, 0xc0, 0xff, 0xff, 0xc9, 0xd3, 0xc0, 0x8b, 0xff,
+		0xff, 0xd2, 0x08, 0xc0, 0x8b, 0xff, 0xff, 0xcb, 0x73, 0xc0, 0xff, 0x00, 0x03, 0xb6, 0x80, 0xff,
+		0xff, 0xbf, 0xe8, 0x40, 0xff, 0x00, 0x18, 0x1f, 0x40, 0xff, 0xff, 0xce, 0x6d, 0x00, 0xff, 0x00,
+		0x1d, 0xcf, 0xc0, 0xff, 0xff, 0xc2, 0xbb, 0x40, 0xff, 0x00, 0x32, 0x76, 0x00, 0xff, 0xff, 0xeb,
+		0xc2, 0x40, 0xff, 0x00, 0x27, 0xc2, 0x40, 0x8b, 0xff, 0x00, 0x24, 0x36, 0x00, 0x8b, 0xff, 0x00,
+		0x23, 0xbf, 0xc0, 0xff, 0x00, 0x0f, 0xe7, 0x00, 0xff, 0x00, 0x1a, 0xff, 0xc0, 0xff, 0x00, 0x18,
+		0xae, 0x40, 0xff, 0x00, 0x1f, 0xfb, 0x40, 0xff, 0xff, 0xe5, 0x70, 0x00, 0xff, 0x00, 0x28, 0x45,
+		0x00, 0xff, 0xff, 0xf1, 0x75, 0x80, 0xff, 0x00, 0x29, 0x92, 0xc0, 0x8b, 0x08, 0xff, 0x00, 0x30,
+		0x2c, 0x80, 0x8b, 0xff, 0x00, 0x2e, 0x1b, 0x00, 0xff, 0x00, 0x13, 0x82, 0xc0, 0xff, 0x00, 0x21,
+		0x89, 0x40, 0xff, 0x00, 0x22, 0x89, 0xc0, 0x08, 0xff, 0xff, 0xdc, 0x9e, 0x00, 0xff, 0x00, 0x2b,
+		0x26, 0x40, 0x05, 0xff, 0xff, 0xe6, 0x66, 0x40, 0xff, 0xff, 0xe2, 0xdb, 0x40, 0xff, 0xff, 0xdc,
+		0x17, 0x80, 0xff, 0xff, 0xf6, 0x44, 0x00, 0xff, 0xff, 0xe3, 0x21, 0x00, 0x8b, 0xff, 0xff, 0xda,
+		0xb6, 0xc0, 0x8b, 0xff, 0xff, 0xdb, 0x08, 0x80, 0xff, 0x00, 0x10, 0xaf, 0x00, 0xff, 0xff, 0xee,
+		0x45, 0x00, 0xff, 0x00, 0x28, 0x2e, 0x40, 0xff, 0xff, 0xf5, 0x28, 0x00, 0xff, 0x00, 0x18, 0x93,
+		0xc0, 0xff, 0xff, 0xfc, 0xf8, 0x00, 0xff, 0x00, 0x1d, 0xde, 0x00, 0xff, 0xff, 0xff, 0x79, 0x40,
+		0xff, 0x00, 0x3f, 0x0f, 0x80, 0x08, 0xff, 0x00, 0xe3, 0xd5, 0x00, 0xff, 0x00, 0x0b, 0x38, 0x40,
+		0x06, 0x8b, 0xff, 0x00, 0x32, 0x04, 0xc0, 0xff, 0x00, 0x02, 0x50, 0x80, 0xff, 0x00, 0x35, 0x9e,
+		0x00, 0xff, 0xff, 0xef, 0xe1, 0xc0, 0xff, 0x00, 0x2c, 0x11, 0x00, 0xff, 0xff, 0xe9, 0x59, 0x80,
+		0xff, 0x00, 0x3d, 0xed, 0x00, 0xff, 0xff, 0xcc, 0x5a, 0x40, 0xff, 0x00, 0x18, 0x4e, 0x80, 0xff,
+		0xff, 0xd1, 0xaa, 0x80, 0x8b, 0xff, 0xff, 0xd9, 0x46, 0x80, 0x8b, 0xff, 0xff, 0xda, 0xfe, 0xc0,
+		0xff, 0xff, 0xef, 0x81, 0xc0, 0xff, 0xff, 0xe6, 0x91, 0x00, 0xff, 0xff, 0xe2, 0xb1, 0x40, 0xff,
+		0xff, 0xea, 0x62, 0x40, 0xff, 0x00, 0x1d, 0x0e, 0x00, 0xff, 0xff, 0xdd, 0xc4, 0x40, 0xff, 0x00,
+		0x10, 0xbb, 0xc0, 0xff, 0xff, 0xda, 0xb5, 0x40, 0x8b, 0x08, 0xff, 0x00, 0x65, 0xc5, 0x80, 0xff,
+		0xff, 0x43, 0xd1, 0x00, 0x15, 0xff, 0xff, 0xff, 0x03, 0x80, 0xff, 0x00, 0x2f, 0xa2, 0x80, 0xff,
+		0x00, 0x09, 0x5b, 0x00, 0xff, 0x00, 0x19, 0xe0, 0x40, 0xff, 0x00, 0x02, 0x36, 0x40, 0xff, 0x00,
+		0x05, 0xf3, 0xc0, 0xff, 0x00, 0x0f, 0x67, 0x40, 0xff, 0x00, 0x29, 0x6b, 0x80, 0xff, 0x00, 0x20,
+		0x51, 0x80, 0xff, 0x00, 0x0c, 0xb3, 0xc0, 0xff, 0x00, 0x1a, 0x0b, 0xc0, 0x8b, 0xff, 0x00, 0x19,
+		0xdd, 0x80, 0x8b, 0xff, 0x00, 0x1a, 0xcc, 0xc0, 0xff, 0xff, 0xf3, 0xd1, 0x80, 0xff, 0x00, 0x0f,
+		0x44, 0x40, 0xff, 0xff, 0xe6, 0x84, 0x80, 0xff, 0x00, 0x0f, 0xc4, 0x40, 0xff, 0xff, 0xe5, 0xae,
+		0x40, 0xff, 0xff, 0xff, 0x60, 0x00, 0xff, 0xff, 0xe0, 0x9c, 0x40, 0x8b, 0xff, 0xff, 0xe2, 0x6b,
+		0x00, 0x08, 0xff, 0xff, 0xf7, 0x5e, 0xc0, 0x07, 0xff, 0xfe, 0x93, 0xc1, 0x00, 0xff, 0xff, 0xe0,
+		0x26, 0x00, 0x15, 0x8b, 0xff, 0x00, 0x1c, 0x2e, 0x40, 0xff, 0x00, 0x01, 0xee, 0xc0, 0xff, 0x00,
+		0x27, 0x27, 0xc0, 0xff, 0x00, 0x0f, 0xe2, 0x40, 0xff, 0x00, 0x22, 0x47, 0xc0, 0xff, 0x00, 0x11,
+		0xd9, 0xc0, 0xff, 0x00, 0x26, 0x87, 0xc0, 0xff, 0x00, 0x1e, 0x65, 0x80, 0xff, 0x00, 0x13, 0x7e,
+		0xc0, 0xff, 0x00, 0x1c, 0x4f, 0x40, 0x8b, 0xff, 0x00, 0x1a, 0x17, 0x40, 0x8b, 0xff, 0x00, 0x16,
+		0x51, 0x00, 0xff, 0xff, 0xee, 0xe3, 0x00, 0x8b, 0xff, 0xff, 0xe5, 0xad, 0xc0, 0x8b, 0xff, 0xff,
+		0xf1, 0xb5, 0x00, 0xff, 0xff, 0xf7, 0x01, 0x00, 0xff, 0xff, 0xda, 0x81, 0xc0, 0x8b, 0xff, 0xff,
+		0xb5, 0x96, 0x40, 0x8b, 0xff, 0xff, 0xa9, 0x17, 0xc0, 0xff, 0x00, 0x0c, 0x92, 0x00, 0xff, 0xff,
+		0xd0, 0xe2, 0x00, 0x8b, 0xff, 0xff, 0xf3, 0x0a, 0xc0, 0x8b, 0xff, 0xff, 0xe7, 0x03, 0x80, 0xff,
+		0xff, 0xe6, 0xcb, 0x00, 0xff, 0xff, 0xf1, 0xd5, 0x80, 0xff, 0xff, 0xe7, 0x04, 0x00, 0x8b, 0x08,
+		0xff, 0xff, 0xe1, 0xf1, 0xc0, 0x8b, 0xff, 0xff, 0xdd, 0x62, 0x40, 0xff, 0x00, 0x13, 0x58, 0x00,
+		0xff, 0xff, 0xef, 0x05, 0x80, 0xff, 0x00, 0x35, 0xee, 0x80, 0xff, 0xff, 0xf3, 0x8b, 0x00, 0xff,
+		0x00, 0x27, 0x91, 0x80, 0xff, 0xff, 0xfd, 0xf1, 0xc0, 0xff, 0x00, 0x31, 0x82, 0x80, 0x8b, 0xff,
+		0x00, 0x21, 0xc6, 0x00, 0x08, 0x0e, 0xff, 0x00, 0xd0, 0xdc, 0x80, 0xff, 0x02, 0xe2, 0x4b, 0x80,
+		0x15, 0x57, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x00, 0x15, 0x58, 0x0a,
+		0xff, 0xfe, 0x99, 0xda, 0x80, 0xff, 0xff, 0x8d, 0xa4, 0x80, 0x15, 0x37, 0x0a, 0x0e, 0xff, 0x00,
+		0xb5, 0x5d, 0x80, 0xff, 0x02, 0x5f, 0xf6, 0x80, 0x15, 0xff, 0xff, 0xe0, 0x87, 0x40, 0xff, 0x00,
+		0x1a, 0x46, 0x80, 0xff, 0xff, 0xe6, 0x13, 0x00, 0xff, 0x00, 0x20, 0xe0, 0x00, 0xff, 0x00, 0x20,
+		0xdc, 0xc0, 0xff, 0x00, 0x1a, 0x43, 0x00, 0xff, 0x00, 0x19, 0xec, 0x80, 0xff, 0x00, 0x1f, 0x75,
+		0xc0, 0xff, 0x00, 0x1f, 0x86, 0x40, 0xff, 0xff, 0xe5, 0xb5, 0xc0, 0xff, 0x00, 0x19, 0xe9, 0x80,
+		0xff, 0xff, 0xdf, 0x2f, 0x00, 0xff, 0xff, 0xdf, 0x1c, 0x40, 0xff, 0xff, 0xe5, 0xb8, 0xc0, 0xff,
+		0xff, 0xe6, 0x10, 0x40, 0xff, 0xff, 0xe0, 0x83, 0x80, 0x1e, 0xff, 0x01, 0x00, 0x50, 0x00, 0xff,
+		0xfd, 0xfb, 0x7d, 0x00, 0x15, 0xff, 0xff, 0xcd, 0x15, 0x40, 0xff, 0x00, 0x2f, 0x77, 0x00, 0x05,
+		0xff, 0xff, 0xe0, 0x77, 0x00, 0xff, 0xff, 0xcb, 0x42, 0xc0, 0xff, 0xff, 0xca, 0xec, 0x00, 0xff,
+		0xff, 0xde, 0x4e, 0xc0, 0xff, 0xff, 0xcd, 0x70, 0x40, 0x8b, 0xff, 0xff, 0xc4, 0x2e, 0x80, 0x8b,
+		0xff, 0xff, 0xd2, 0x95, 0x00, 0xff, 0x00, 0x2e, 0x93, 0xc0, 0x8b, 0xff, 0x00, 0x3b, 0x17, 0x80,
+		0x8b, 0xff, 0x00, 0x41, 0x83, 0x80, 0xff, 0x00, 0x33, 0xdf, 0x00, 0xff, 0x00, 0x28, 0xd8, 0x00,
+		0xff, 0x00, 0x1e, 0x39, 0x40, 0xff, 0x00, 0x21, 0x2f, 0xc0, 0xff, 0x00, 0x2c, 0x2d, 0x40, 0xff,
+		0x00, 0x30, 0x81, 0xc0, 0xff, 0x00, 0x02, 0xd0, 0x00, 0xff, 0x00, 0x23, 0x34, 0x00, 0x8b, 0xff,
+		0x00, 0x2c, 0xe3, 0x40, 0x08, 0xff, 0x00, 0x29, 0x6c, 0xc0, 0xff, 0xff, 0xbe, 0x69, 0x80, 0xff,
+		0xff, 0xd6, 0x93, 0x40, 0x07, 0x8b, 0xff, 0xff, 0xdc, 0xc2, 0x80, 0xff, 0xff, 0xfd, 0xad, 0x40,
+		0xff, 0xff, 0xe2, 0x48, 0xc0, 0xff, 0xff, 0xd6, 0xd3, 0x00, 0xff, 0xff, 0xdb, 0x67, 0x00, 0xff,
+		0xff, 0xde, 0xff, 0x40, 0xff, 0xff, 0xe2, 0xaa, 0x80, 0xff, 0xff, 0xbd, 0xe6, 0x80, 0xff, 0xff,
+		0xd9, 0xf3, 0x80, 0x8b, 0xff, 0xff, 0xa2, 0x08, 0xc0, 0x8b, 0xff, 0xff, 0xa2, 0xcd, 0x00, 0xff,
+		0x00, 0x40, 0x54, 0x00, 0xff, 0xff, 0xac, 0xc8, 0x80, 0xff, 0x00, 0x71, 0x4f, 0x40, 0x8b, 0xff,
+		0x00, 0x4a, 0xe1, 0x00, 0x8b, 0xff, 0x00, 0x4a, 0x66, 0x80, 0xff, 0x00, 0x25, 0x6d, 0x40, 0xff,
+		0x00, 0x2b, 0x84, 0x40, 0xff, 0x00, 0x43, 0x0c, 0x40, 0x08, 0x0e, 0xff, 0x00, 0xb5, 0x3b, 0x00,
+		0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x59, 0x0a, 0xff, 0xfe, 0xc0, 0xb0, 0x80, 0xff, 0xfd, 0x41,
+		0x84, 0x80, 0x15, 0x26, 0x0a, 0xff, 0x00, 0x5b, 0x7a, 0x40, 0xff, 0xfe, 0x72, 0x28, 0x40, 0x15,
+		0x27, 0x0a, 0x0e, 0xff, 0x01, 0x34, 0x17, 0x40, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a,
+		0xff, 0xfe, 0xb2, 0xe1, 0xc0, 0xff, 0xfd, 0x2d, 0xab, 0x40, 0x15, 0x26, 0x0a, 0xff, 0x00, 0x5b,
+		0x7a, 0x40, 0xff, 0xfe, 0x72, 0x28, 0x40, 0x15, 0x27, 0x0a, 0x0e, 0xff, 0x00, 0x65, 0xd5, 0x80,
+		0xff, 0x02, 0xb4, 0x20, 0x40, 0x15, 0x5b, 0x0a, 0xff, 0xff, 0x25, 0xa9, 0x40, 0xff, 0xfc, 0xe7,
+		0xc4, 0x00, 0x15, 0x26, 0x0a, 0xff, 0x00, 0x5b, 0x7a, 0x40, 0xff, 0xfe, 0x72, 0x28, 0x40, 0x15,
+		0x27, 0x0a, 0x0e, 0xff, 0x00, 0x83, 0x2d, 0x00, 0xff, 0x02, 0xab, 0x7f, 0x00, 0x15, 0x5c, 0x0a,
+		0xff, 0xff, 0xb8, 0x5f, 0x00, 0xff, 0xfd, 0x33, 0xb5, 0xc0, 0x15, 0x26, 0x0a, 0xff, 0x00, 0x5b,
+		0x7a, 0x40, 0xff, 0xfe, 0x72, 0x28, 0x40, 0x15, 0x27, 0x0a, 0x0e, 0xff, 0x00, 0xc9, 0xf5, 0x40,
+		0xff, 0x02, 0xe2, 0x4b, 0x80, 0x15, 0x57, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00,
+		0x03, 0x00, 0x15, 0x58, 0x0a, 0xff, 0xfe, 0x92, 0xf3, 0x00, 0xff, 0xfd, 0x1c, 0xd4, 0x80, 0x15,
+		0x26, 0x0a, 0xff, 0x00, 0x5b, 0x7a, 0x40, 0xff, 0xfe, 0x72, 0x28, 0x40, 0x15, 0x27, 0x0a, 0x0e,
+		0xff, 0x00, 0xc7, 0x47, 0x80, 0xff, 0x02, 0xc3, 0x77, 0x00, 0x15, 0xff, 0x00, 0x1a, 0x25, 0xc0,
+		0xff, 0x00, 0x13, 0x09, 0x40, 0xff, 0x00, 0x13, 0xcc, 0x00, 0xff, 0x00, 0x16, 0x75, 0x00, 0xff,
+		0x00, 0x16, 0xb4, 0x80, 0xff, 0x00, 0x12, 0xc1, 0x00, 0xff, 0xff, 0xeb, 0xfe, 0x00, 0xff, 0xff,
+		0xe6, 0x51, 0x40, 0xff, 0xff, 0xe5, 0xe9, 0x00, 0xff, 0xff, 0xed, 0x03, 0x00, 0xff, 0xff, 0xec,
+		0x34, 0x00, 0xff, 0xff, 0xe9, 0x87, 0x80, 0xff, 0xff, 0xe9, 0x3e, 0x80, 0xff, 0xff, 0xed, 0x43,
+		0x40, 0xff, 0x00, 0x14, 0x08, 0x80, 0xff, 0x00, 0x19, 0x99, 0x80, 0x1e, 0xff, 0x00, 0x7e, 0xef,
+		0x40, 0xff, 0xfe, 0x28, 0xff, 0x40, 0x15, 0x27, 0x0a, 0xff, 0x00, 0x0a, 0x16, 0x00, 0xff, 0x00,
+		0x91, 0x50, 0x80, 0x15, 0xff, 0x00, 0x2e, 0xfa, 0x40, 0xff, 0x00, 0x04, 0x1b, 0x80, 0xff, 0x00,
+		0x24, 0x25, 0x00, 0xff, 0x00, 0x26, 0x13, 0x00, 0x8b, 0xff, 0x00, 0x2d, 0x83, 0x00, 0x08, 0xff,
+		0x00, 0x30, 0x30, 0x80, 0xff, 0xff, 0xd7, 0x72, 0x00, 0xff, 0x00, 0x27, 0xd7, 0xc0, 0xff, 0xff,
+		0xcc, 0xfe, 0xc0, 0xff, 0xff, 0xcd, 0x0a, 0x40, 0xff, 0xff, 0xd7, 0x7d, 0xc0, 0xff, 0xff, 0xd8,
+		0x2c, 0x80, 0xff, 0xff, 0xcf, 0xda, 0x40, 0x1e, 0x8b, 0xff, 0xff, 0xd3, 0x02, 0xc0, 0xff, 0x00,
+		0x23, 0x34, 0xc0, 0xff, 0xff, 0xda, 0x5d, 0xc0, 0xff, 0x00, 0x2d, 0xf5, 0x40, 0xff, 0xff, 0xfb,
+		0x0e, 0x00, 0x08, 0xff, 0xff, 0x29, 0x23, 0x80, 0xff, 0xfd, 0x93, 0xda, 0x00, 0xff, 0x00, 0x45,
+		0x0a, 0x40, 0x8b, 0xff, 0x00, 0x3c, 0x69, 0x00, 0xff, 0x00, 0xb6, 0xf4, 0xc0, 0xff, 0x00, 0xc5,
+		0xa0, 0x80, 0x8b, 0xff, 0x00, 0x45, 0x0a, 0x40, 0xff, 0xff, 0x49, 0xe8, 0x40, 0xff, 0x00, 0x48,
+		0x7e, 0x00, 0x8b, 0x05, 0x0e, 0xff, 0x00, 0xc8, 0x37, 0x40, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15,
+		0xff, 0xff, 0x3c, 0x19, 0x80, 0xff, 0xfd, 0x90, 0x0d, 0x00, 0xff, 0x00, 0x3f, 0xdc, 0x80, 0x8b,
+		0xff, 0x00, 0x35, 0x81, 0x80, 0xff, 0x00, 0xa9, 0x26, 0x00, 0xff, 0x00, 0x82, 0x50, 0x40, 0x8b,
+		0x8b, 0xff, 0xff, 0x56, 0xda, 0x00, 0xff, 0x00, 0xe5, 0x8e, 0xc0, 0x8b, 0x8b, 0xff, 0x00, 0x3e,
+		0x22, 0xc0, 0xff, 0xff, 0x59, 0x71, 0x00, 0x8b, 0xff, 0xff, 0xfe, 0x46, 0x00, 0xff, 0x00, 0xe7,
+		0x48, 0xc0, 0xff, 0x00, 0x90, 0xfc, 0x00, 0x8b, 0x8b, 0xff, 0x00, 0x3f, 0xdc, 0xc0, 0xff, 0xff,
+		0x6e, 0x27, 0x40, 0x8b, 0xff, 0xff, 0xfe, 0x46, 0x00, 0xff, 0x00, 0xcc, 0x88, 0x00, 0xff, 0x00,
+		0xad, 0x76, 0x80, 0x8b, 0x8b, 0xff, 0x00, 0x3e, 0x22, 0xc0, 0x05, 0xff, 0xff, 0x17, 0xda, 0x80,
+		0xff, 0xff, 0xc1, 0xdd, 0x40, 0x15, 0xff, 0xfe, 0xb1, 0x27, 0xc0, 0xff, 0xff, 0x8c, 0x5b, 0x80,
+		0x07, 0xff, 0x00, 0x68, 0x6c, 0x80, 0xff, 0x01, 0x4e, 0xd8, 0x40, 0x05, 0x0e, 0xff, 0x01, 0x15,
+		0x8e, 0x80, 0xff, 0x02, 0x74, 0x43, 0x80, 0x15, 0xff, 0xff, 0x9f, 0x17, 0xc0, 0xff, 0xff, 0x73,
+		0xe2, 0x00, 0xff, 0xff, 0xb9, 0x18, 0x40, 0xff, 0xff, 0x06, 0x90, 0xc0, 0x1f, 0x8b, 0xff, 0xff,
+		0x1c, 0x47, 0x40, 0xff, 0x00, 0x77, 0xda, 0x80, 0xff, 0xff, 0xae, 0x4d, 0x80, 0xff, 0x00, 0x63,
+		0xd5, 0x80, 0xff, 0xff, 0xf7, 0xd4, 0xc0, 0x08, 0xff, 0xff, 0xf6, 0x0c, 0xc0, 0xff, 0xff, 0xb4,
+		0x3a, 0x40, 0xff, 0x00, 0x1d, 0x57, 0xc0, 0x8b, 0x05, 0xff, 0x00, 0x0b, 0x64, 0x40, 0x8b, 0xff,
+		0x00, 0x0e, 0x6a, 0x00, 0xff, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x00, 0x0a, 0xc4, 0x80, 0xff, 0xff,
+		0xf9, 0x66, 0x80, 0xff, 0x00, 0x07, 0xd6, 0x00, 0xff, 0xff, 0xfb, 0x32, 0xc0, 0xff, 0x00, 0x03,
+		0x0e, 0xc0, 0xff, 0xff, 0xf9, 0x52, 0x40, 0x8b, 0xff, 0xff, 0xfa, 0x1c, 0x40, 0x8b, 0xff, 0xff,
+		0xf7, 0x4b, 0x80, 0xff, 0xff, 0xf9, 0x32, 0x40, 0xff, 0xff, 0xf0, 0x4e, 0x80, 0xff, 0xff, 0xd9,
+		0x1e, 0x40, 0x8b, 0xff, 0xff, 0xe1, 0xc4, 0x40, 0x8b, 0xff, 0xff, 0xda, 0x58, 0x00, 0xff, 0x00,
+		0x0a, 0x0f, 0xc0, 0xff, 0xff, 0xe0, 0x96, 0xc0, 0xff, 0x00, 0x19, 0x54, 0xc0, 0x08, 0xff, 0xff,
+		0xe6, 0xf9, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00, 0x25, 0x5d, 0x40, 0xff, 0xff,
+		0xe5, 0xb9, 0x40, 0xff, 0x00, 0x2a, 0xc8, 0x80, 0xff, 0xff, 0xf5, 0x16, 0x80, 0xff, 0x00, 0x26,
+		0x6b, 0x40, 0x8b, 0xff, 0x00, 0x49, 0x64, 0x80, 0x8b, 0xff, 0x00, 0x23, 0x12, 0x00, 0xff, 0x00,
+		0x26, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x23, 0xb9, 0x80, 0x8b, 0xff, 0x00, 0x13, 0x63, 0x00, 0xff,
+		0xff, 0xf5, 0x8f, 0x40, 0xff, 0x00, 0x11, 0xfa, 0x40, 0xff, 0xff, 0xec, 0xef, 0xc0, 0xff, 0x00,
+		0x09, 0x40, 0x00, 0xff, 0xff, 0xf3, 0x26, 0xc0, 0xff, 0x00, 0x06, 0x3c, 0x40, 0xff, 0xff, 0xf2,
+		0xdf, 0xc0, 0xff, 0x00, 0x00, 0xcf, 0x40, 0xff, 0xff, 0xf3, 0x3d, 0xc0, 0xff, 0x00, 0x00, 0xac,
+		0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x40, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x00, 0x04, 0x3a,
+		0xc0, 0xff, 0x00, 0x26, 0xc5, 0x00, 0x05, 0xff, 0x00, 0x40, 0x03, 0xc0, 0xff, 0x00, 0x08, 0x0b,
+		0x40, 0xff, 0x00, 0x39, 0xe1, 0x40, 0xff, 0x00, 0x24, 0xcc, 0xc0, 0xff, 0x00, 0x22, 0x64, 0xc0,
+		0xff, 0x00, 0x38, 0x31, 0x40, 0x08, 0xff, 0xff, 0xcc, 0x38, 0x80, 0xff, 0x00, 0x21, 0xa8, 0x40,
+		0x05, 0xff, 0xff, 0xe3, 0x43, 0x80, 0xff, 0xff, 0xd0, 0x6f, 0x80, 0xff, 0xff, 0xce, 0x7a, 0x00,
+		0xff, 0xff, 0xe3, 0x9d, 0x80, 0xff, 0xff, 0xcf, 0x1a, 0x00, 0x8b, 0x08, 0xff, 0xff, 0xa4, 0x51,
+		0x00, 0xff, 0xff, 0xaf, 0x5e, 0x80, 0xff, 0x00, 0x5f, 0xa8, 0xc0, 0xff, 0x00, 0xa8, 0x65, 0xc0,
+		0xff, 0x00, 0xa5, 0x88, 0x40, 0xff, 0x00, 0x4e, 0x62, 0xc0, 0xff, 0x00, 0x5c, 0xad, 0x40, 0xff,
+		0x00, 0x58, 0x15, 0x40, 0x1f, 0xff, 0x00, 0x30, 0xc5, 0xc0, 0x8b, 0xff, 0x00, 0x2d, 0x75, 0xc0,
+		0xff, 0xff, 0xe3, 0x1d, 0x80, 0xff, 0x00, 0x19, 0x26, 0x40, 0xff, 0xff, 0xd4, 0x90, 0xc0, 0xff,
+		0x00, 0x01, 0xfc, 0x40, 0xff, 0xff, 0xfc, 0x92, 0x80, 0xff, 0x00, 0x01, 0x75, 0x80, 0xff, 0xff,
+		0xfd, 0x6a, 0xc0, 0x8b, 0xff, 0xff, 0xfb, 0x59, 0xc0, 0x8b, 0xff, 0xff, 0xfd, 0x85, 0x00, 0xff,
+		0xff, 0xff, 0x93, 0x80, 0xff, 0xff, 0xfd, 0x82, 0x80, 0x8b, 0xff, 0xff, 0xfd, 0x83, 0x80, 0x8b,
+		0xff, 0xff, 0xfe, 0xd4, 0x40, 0xff, 0xff, 0xff, 0xe1, 0x80, 0xff, 0xff, 0xfa, 0xa2, 0x40, 0xff,
+		0x00, 0x04, 0xae, 0x00, 0xff, 0xff, 0xfc, 0xb8, 0x40, 0x08, 0xff, 0x00, 0x42, 0x73, 0x80, 0xff,
+		0x00, 0x20, 0xcb, 0x80, 0x05, 0xff, 0xff, 0xde, 0x7e, 0x80, 0xff, 0x00, 0x4b, 0x1e, 0x00, 0xff,
+		0xff, 0xb5, 0x3c, 0x40, 0xff, 0x00, 0x30, 0x4a, 0x80, 0xff, 0xff, 0xad, 0x37, 0xc0, 0x8b, 0x08,
+		0x0e, 0xff, 0x00, 0xb5, 0x3b, 0x00, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x59, 0x0a, 0xff, 0xfe,
+		0xec, 0xb3, 0xc0, 0xff, 0xff, 0xb2, 0x54, 0x80, 0x15, 0x2b, 0x0a, 0x0e, 0xff, 0x01, 0x45, 0x59,
+		0xc0, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff, 0xfe, 0xcd, 0xa2, 0x80, 0xff, 0xff,
+		0x9e, 0x7b, 0x40, 0x15, 0x2b, 0x0a, 0x0e, 0xff, 0x00, 0x6e, 0x76, 0xc0, 0xff, 0x02, 0xb4, 0x20,
+		0x40, 0x15, 0x5b, 0x0a, 0xff, 0xff, 0x49, 0x0b, 0x40, 0xff, 0xff, 0x58, 0x94, 0x00, 0x15, 0x2b,
+		0x0a, 0x0e, 0xff, 0x00, 0xd0, 0xdc, 0x80, 0xff, 0x02, 0xe2, 0x4b, 0x80, 0x15, 0x57, 0x0a, 0xff,
+		0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x00, 0x15, 0x58, 0x0a, 0xff, 0xfe, 0xb8, 0x0f,
+		0x00, 0xff, 0xff, 0x8d, 0xa4, 0x80, 0x15, 0x2b, 0x0a, 0x0e, 0xff, 0x00, 0xb5, 0x3b, 0x00, 0xff,
+		0x03, 0x17, 0x5f, 0x00, 0x15, 0x59, 0x0a, 0xff, 0xff, 0x0a, 0x0b, 0x80, 0xff, 0xff, 0xb1, 0x77,
+		0x80, 0x15, 0x2d, 0x0a, 0x0e, 0xff, 0x01, 0x45, 0x59, 0xc0, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15,
+		0x5a, 0x0a, 0xff, 0xfe, 0xea, 0xfa, 0x40, 0xff, 0xff, 0x9d, 0x9e, 0x40, 0x15, 0x2d, 0x0a, 0x0e,
+		0xff, 0x00, 0x64, 0xf8, 0x80, 0xff, 0x02, 0xb4, 0x20, 0x40, 0x15, 0x5b, 0x0a, 0xff, 0xff, 0x6f,
+		0xe1, 0x40, 0xff, 0xff, 0x57, 0xb7, 0x00, 0x15, 0x2d, 0x0a, 0x0e, 0xff, 0x00, 0xcd, 0x69, 0x00,
+		0xff, 0x02, 0xe2, 0x4b, 0x80, 0x15, 0x57, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00,
+		0x03, 0x00, 0x15, 0x58, 0x0a, 0xff, 0xfe, 0xd8, 0xda, 0x40, 0xff, 0xff, 0x8c, 0xc7, 0x80, 0x15,
+		0x2d, 0x0a, 0x0e, 0xff, 0x00, 0x4e, 0x88, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0x5d, 0x0a,
+		0xff, 0xff, 0xb4, 0xeb, 0x40, 0xff, 0xfe, 0xbe, 0x1a, 0x00, 0x15, 0x5e, 0x0a, 0x0e, 0xff, 0x00,
+		0x87, 0x7d, 0xc0, 0xff, 0x02, 0xab, 0x7f, 0x00, 0x15, 0x5c, 0x0a, 0xff, 0xff, 0xd7, 0x70, 0x40,
+		0xff, 0xfd, 0x34, 0x92, 0xc0, 0x15, 0x2f, 0x0a, 0x0e, 0xff, 0x00, 0xb5, 0x3b, 0x00, 0xff, 0x03,
+		0x17, 0x5f, 0x00, 0x15, 0x59, 0x0a, 0xff, 0x00, 0x89, 0x39, 0x40, 0xff, 0xfe, 0x78, 0xa2, 0x00,
+		0x15, 0x30, 0x0a, 0xff, 0xff, 0x23, 0x60, 0x80, 0xff, 0x00, 0xfe, 0x28, 0x80, 0x15, 0x31, 0x0a,
+		0x0e, 0xff, 0x01, 0x45, 0x59, 0xc0, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff, 0x00,
+		0x6a, 0x28, 0x00, 0xff, 0xfe, 0x64, 0xc8, 0xc0, 0x15, 0x30, 0x0a, 0xff, 0xff, 0x23, 0x60, 0x80,
+		0xff, 0x00, 0xfe, 0x28, 0x80, 0x15, 0x31, 0x0a, 0x0e, 0xff, 0x00, 0x71, 0x0d, 0x80, 0xff, 0x02,
+		0xb4, 0x20, 0x40, 0x15, 0x5b, 0x0a, 0xff, 0x00, 0xe2, 0xfa, 0x00, 0xff, 0xfe, 0x1e, 0xe1, 0x80,
+		0x15, 0x30, 0x0a, 0xff, 0xff, 0x23, 0x60, 0x80, 0xff, 0x00, 0xfe, 0x28, 0x80, 0x15, 0x31, 0x0a,
+		0x0e, 0xff, 0x00, 0x87, 0x7d, 0xc0, 0xff, 0x02, 0xab, 0x7f, 0x00, 0x15, 0x5c, 0x0a, 0xff, 0x01,
+		0x7c, 0x97, 0x00, 0xff, 0xfe, 0x6a, 0xd3, 0x40, 0x15, 0x30, 0x0a, 0xff, 0xff, 0x23, 0x60, 0x80,
+		0xff, 0x00, 0xfe, 0x28, 0x80, 0x15, 0x31, 0x0a, 0x0e, 0xff, 0x00, 0xd0, 0xdc, 0x80, 0xff, 0x02,
+		0xe2, 0x4b, 0x80, 0x15, 0x57, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x00,
+		0x15, 0x58, 0x0a, 0xff, 0x00, 0x54, 0x94, 0x80, 0xff, 0xfe, 0x53, 0xf2, 0x00, 0x15, 0x30, 0x0a,
+		0xff, 0xff, 0x23, 0x60, 0x80, 0xff, 0x00, 0xfe, 0x28, 0x80, 0x15, 0x31, 0x0a, 0x0e, 0xff, 0x01,
+		0x7e, 0x4f, 0x00, 0xff, 0x01, 0xf7, 0x21, 0x00, 0x15, 0xff, 0xff, 0x81, 0xcc, 0x80, 0xff, 0xff,
+		0x7c, 0xad, 0x40, 0xff, 0xff, 0x83, 0xee, 0x80, 0xff, 0x00, 0x83, 0x52, 0xc0, 0xff, 0xff, 0xd0,
+		0x89, 0x00, 0xff, 0xff, 0xd2, 0x42, 0xc0, 0xff, 0x00, 0x7d, 0xfe, 0x40, 0xff, 0xff, 0x7b, 0x07,
+		0x40, 0xff, 0xff, 0x82, 0x01, 0xc0, 0xff, 0xff, 0x7c, 0xe5, 0x00, 0xff, 0x00, 0x2c, 0xe0, 0x40,
+		0xff, 0xff, 0xd3, 0xfc, 0x80, 0xff, 0x00, 0x7c, 0xed, 0xc0, 0xff, 0x00, 0x80, 0xe1, 0x00, 0xff,
+		0x00, 0x7e, 0x34, 0x40, 0xff, 0xff, 0x7a, 0xce, 0x80, 0xff, 0x00, 0x2e, 0x9a, 0x00, 0xff, 0x00,
+		0x2d, 0xbd, 0x00, 0xff, 0xff, 0x80, 0xdd, 0x80, 0xff, 0x00, 0x86, 0x91, 0xc0, 0xff, 0x00, 0x81,
+		0xb9, 0x80, 0xff, 0x00, 0x85, 0xd3, 0x00, 0x05, 0x0e, 0xff, 0x00, 0xfa, 0x95, 0x00, 0xff, 0x02,
+		0x34, 0x69, 0x00, 0x15, 0xff, 0x00, 0x1b, 0xc3, 0xc0, 0x8b, 0xff, 0x00, 0x1f, 0x58, 0x00, 0xff,
+		0xff, 0xf5, 0xa1, 0x80, 0xff, 0x00, 0x1a, 0xab, 0xc0, 0xff, 0xff, 0xe6, 0x65, 0x00, 0x08, 0xff,
+		0xff, 0x34, 0x16, 0x00, 0xff, 0xfe, 0x80, 0x53, 0x80, 0x05, 0xff, 0xff, 0xeb, 0x61, 0x00, 0xff,
+		0x00, 0x28, 0xe4, 0xc0, 0xff, 0xff, 0xf2, 0x87, 0xc0, 0xff, 0x00, 0x39, 0x87, 0xc0, 0x8b, 0xff,
+		0x00, 0x4e, 0x6b, 0x40, 0x8b, 0xff, 0x00, 0xb9, 0xc3, 0x40, 0xff, 0x00, 0x56, 0xc1, 0x00, 0xff,
+		0x00, 0x39, 0x0b, 0x00, 0xff, 0x00, 0x41, 0x78, 0xc0, 0x8b, 0x08, 0xff, 0x00, 0xdc, 0x9f, 0x80,
+		0xff, 0xff, 0x01, 0xd7, 0x80, 0x15, 0x8b, 0xff, 0x00, 0x3a, 0x4a, 0xc0, 0xff, 0xff, 0xfb, 0xd3,
+		0x80, 0xff, 0x00, 0x4d, 0x68, 0xc0, 0xff, 0xff, 0xde, 0x04, 0x00, 0xff, 0x00, 0x42, 0x95, 0xc0,
+		0xff, 0xff, 0xfa, 0x0a, 0x00, 0xff, 0x00, 0x0b, 0xad, 0x80, 0xff, 0xff, 0xf9, 0x66, 0x80, 0xff,
+		0x00, 0x0a, 0xc5, 0x80, 0xff, 0xff, 0xf8, 0xdd, 0x80, 0xff, 0x00, 0x09, 0xe1, 0x00, 0x08, 0xff,
+		0x00, 0x37, 0x42, 0x00, 0xff, 0x00, 0x67, 0x3f, 0x40, 0xff, 0xff, 0xca, 0x7e, 0x80, 0xff, 0x00,
+		0x1c, 0x7a, 0x80, 0xff, 0xff, 0xd2, 0x2c, 0x00, 0xff, 0xff, 0xa9, 0xc6, 0x00, 0x05, 0xff, 0xff,
+		0xdc, 0xcf, 0x80, 0xff, 0x00, 0x1a, 0xc5, 0x40, 0xff, 0xff, 0xd7, 0x32, 0x40, 0xff, 0x00, 0x0c,
+		0xda, 0xc0, 0xff, 0xff, 0xd8, 0x3b, 0xc0, 0x8b, 0xff, 0xff, 0xa3, 0x12, 0x80, 0x8b, 0xff, 0xff,
+		0x7c, 0xc1, 0x00, 0xff, 0xff, 0xb7, 0x68, 0x40, 0x8b, 0xff, 0xff, 0x0b, 0x1b, 0x40, 0x8b, 0xff,
+		0xff, 0x90, 0x54, 0xc0, 0xff, 0x00, 0x1a, 0xec, 0x00, 0xff, 0xff, 0xb3, 0x35, 0xc0, 0xff, 0x00,
+		0x26, 0x55, 0xc0, 0xff, 0xff, 0xcd, 0x80, 0x80, 0x08, 0xff, 0xff, 0xc5, 0xa5, 0xc0, 0xff, 0xff,
+		0x92, 0x35, 0x00, 0xff, 0x00, 0x33, 0xc7, 0xc0, 0xff, 0xff, 0xe5, 0x3f, 0x40, 0xff, 0x00, 0x31,
+		0xde, 0x80, 0xff, 0x00, 0x5d, 0x2e, 0x00, 0x05, 0xff, 0x00, 0x25, 0x8e, 0x40, 0xff, 0xff, 0xe3,
+		0xce, 0xc0, 0xff, 0x00, 0x29, 0xe1, 0xc0, 0xff, 0xff, 0xf4, 0x81, 0x80, 0xff, 0x00, 0x24, 0xce,
+		0xc0, 0x8b, 0xff, 0x00, 0x43, 0x43, 0x40, 0x8b, 0xff, 0x00, 0x47, 0xb9, 0xc0, 0xff, 0x00, 0x25,
+		0x84, 0x40, 0xff, 0x00, 0x29, 0x05, 0x00, 0xff, 0x00, 0x53, 0x02, 0x80, 0xff, 0x00, 0x21, 0x1a,
+		0x80, 0xff, 0x00, 0x42, 0xfe, 0x40, 0xff, 0x00, 0x03, 0xf4, 0x00, 0xff, 0x00, 0x4d, 0x84, 0x00,
+		0x8b, 0xff, 0x00, 0x36, 0xb9, 0x00, 0x08, 0xff, 0xff, 0x9f, 0x42, 0x80, 0xff, 0x00, 0xa1, 0xf4,
+		0x80, 0x15, 0xff, 0x00, 0x02, 0xa7, 0x00, 0xff, 0xff, 0xf9, 0xae, 0xc0, 0x05, 0xff, 0x00, 0x15,
+		0x0f, 0x00, 0xff, 0xff, 0xcb, 0x9e, 0xc0, 0xff, 0x00, 0x03, 0x31, 0x40, 0xff, 0xff, 0xc4, 0x54,
+		0x40, 0x8b, 0xff, 0xff, 0xcb, 0x42, 0x80, 0x8b, 0xff, 0xff, 0xd7, 0x31, 0xc0, 0xff, 0xff, 0xfd,
+		0xa4, 0x80, 0xff, 0xff, 0xc0, 0x6d, 0xc0, 0xff, 0xff, 0xe6, 0x77, 0x00, 0xff, 0xff, 0xca, 0x4a,
+		0xc0, 0xff, 0xff, 0xe3, 0x2a, 0xc0, 0xff, 0xff, 0xc3, 0x5b, 0x00, 0xff, 0xff, 0xcf, 0xb9, 0x80,
+		0xff, 0xff, 0xe8, 0x4d, 0xc0, 0xff, 0xff, 0xd6, 0x13, 0x00, 0x8b, 0xff, 0xff, 0xe4, 0xa5, 0x80,
+		0x8b, 0xff, 0xff, 0xe2, 0x39, 0x00, 0xff, 0x00, 0x09, 0xde, 0x00, 0xff, 0xff, 0xe5, 0xdb, 0xc0,
+		0xff, 0x00, 0x17, 0xcf, 0xc0, 0x08, 0x0e, 0xff, 0x00, 0xb5, 0x3b, 0x00, 0xff, 0x03, 0x17, 0x5f,
+		0x00, 0x15, 0x59, 0x0a, 0xff, 0xfe, 0xe4, 0x12, 0x80, 0xff, 0xff, 0xb1, 0x77, 0x80, 0x15, 0x36,
+		0x0a, 0x0e, 0xff, 0x01, 0x45, 0x59, 0xc0, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff,
+		0xfe, 0xc5, 0x01, 0x40, 0xff, 0xff, 0x9d, 0x9e, 0x40, 0x15, 0x36, 0x0a, 0x0e, 0xff, 0x00, 0x71,
+		0x0d, 0x80, 0xff, 0x02, 0xb4, 0x20, 0x40, 0x15, 0x5b, 0x0a, 0xff, 0xff, 0x3d, 0xd3, 0x40, 0xff,
+		0xff, 0x57, 0xb7, 0x00, 0x15, 0x36, 0x0a, 0x0e, 0xff, 0x00, 0xd9, 0x7e, 0x00, 0xff, 0x02, 0xe2,
+		0x4b, 0x80, 0x15, 0x57, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x00, 0x15,
+		0x58, 0x0a, 0xff, 0xfe, 0xa6, 0xcc, 0x40, 0xff, 0xff, 0x8c, 0xc7, 0x80, 0x15, 0x36, 0x0a, 0x0e,
+		0xff, 0x01, 0x45, 0x59, 0xc0, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff, 0xfe, 0xaf,
+		0x6e, 0x00, 0xff, 0xff, 0x9e, 0x7b, 0x40, 0x15, 0x37, 0x0a, 0x0e, 0xff, 0x00, 0x3a, 0xaf, 0x00,
+		0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0xff, 0xfd, 0x90, 0xea, 0x00, 0xff, 0x00, 0x46, 0xc4, 0x40,
+		0xff, 0x00, 0x9d, 0xed, 0xc0, 0xff, 0x00, 0x7c, 0x45, 0x80, 0x07, 0xff, 0x00, 0x26, 0xd0, 0xc0,
+		0x8b, 0xff, 0x00, 0x25, 0x5a, 0xc0, 0xff, 0x00, 0x00, 0xf6, 0xc0, 0xff, 0x00, 0x25, 0xd8, 0x40,
+		0xff, 0x00, 0x13, 0x3d, 0x00, 0xff, 0x00, 0x39, 0x9f, 0x00, 0xff, 0x00, 0x1d, 0x4b, 0x00, 0xff,
+		0x00, 0x1e, 0x52, 0x00, 0xff, 0x00, 0x3b, 0xad, 0x40, 0x8b, 0xff, 0x00, 0x3f, 0x2b, 0x40, 0x8b,
+		0xff, 0x00, 0x3f, 0x03, 0xc0, 0xff, 0xff, 0xe1, 0xa2, 0x00, 0xff, 0x00, 0x3c, 0xf9, 0x40, 0xff,
+		0xff, 0xc5, 0x23, 0xc0, 0xff, 0x00, 0x1e, 0x4f, 0xc0, 0xff, 0xff, 0xd8, 0xef, 0xc0, 0xff, 0x00,
+		0x14, 0x1e, 0x00, 0xff, 0xff, 0xd9, 0x5c, 0x00, 0xff, 0x00, 0x01, 0x08, 0x00, 0xff, 0xff, 0xd7,
+		0xcc, 0x40, 0x8b, 0x08, 0xff, 0xff, 0x88, 0xe8, 0x00, 0xff, 0x00, 0x59, 0xc0, 0x80, 0x06, 0x8b,
+		0xff, 0x00, 0x03, 0x99, 0x40, 0xff, 0x00, 0x00, 0x28, 0x80, 0xff, 0x00, 0x02, 0xc9, 0x40, 0xff,
+		0x00, 0x02, 0xb4, 0x80, 0xff, 0x00, 0x04, 0x4c, 0xc0, 0xff, 0x00, 0x02, 0x28, 0xc0, 0xff, 0x00,
+		0x03, 0x6e, 0x80, 0xff, 0x00, 0x03, 0x6c, 0x00, 0xff, 0x00, 0x03, 0xd3, 0xc0, 0x8b, 0xff, 0x00,
+		0x05, 0x8b, 0x40, 0x8b, 0xff, 0x00, 0x01, 0x69, 0x00, 0xff, 0xff, 0xff, 0xc5, 0xc0, 0xff, 0x00,
+		0x01, 0x65, 0x00, 0xff, 0xff, 0xff, 0x8c, 0xc0, 0xff, 0x00, 0x01, 0x53, 0x00, 0x08, 0xff, 0xff,
+		0xf8, 0x3b, 0xc0, 0xff, 0xff, 0x49, 0x0b, 0x40, 0x15, 0xff, 0x00, 0x77, 0x18, 0x00, 0x06, 0xff,
+		0x00, 0x1a, 0x08, 0x40, 0x8b, 0xff, 0x00, 0x19, 0x0c, 0x80, 0xff, 0xff, 0xff, 0x5d, 0x40, 0xff,
+		0x00, 0x19, 0x65, 0xc0, 0xff, 0xff, 0xf3, 0x42, 0x80, 0xff, 0x00, 0x26, 0xd8, 0x00, 0xff, 0xff,
+		0xec, 0x83, 0x80, 0xff, 0x00, 0x14, 0x2b, 0xc0, 0xff, 0xff, 0xd8, 0x5b, 0x80, 0x8b, 0xff, 0xff,
+		0xd7, 0x70, 0xc0, 0x8b, 0xff, 0xff, 0xd8, 0x44, 0x00, 0xff, 0xff, 0xec, 0xb7, 0xc0, 0xff, 0xff,
+		0xda, 0xe0, 0x00, 0xff, 0xff, 0xdb, 0xe7, 0x00, 0xff, 0xff, 0xed, 0xbc, 0x80, 0xff, 0xff, 0xe7,
+		0xf9, 0xc0, 0xff, 0xff, 0xf3, 0xd8, 0x40, 0xff, 0xff, 0xe8, 0x3e, 0x80, 0xff, 0xff, 0xff, 0x6a,
+		0x40, 0xff, 0xff, 0xe7, 0x6f, 0x00, 0x8b, 0x08, 0xff, 0xff, 0x81, 0x23, 0xc0, 0x06, 0x0e, 0xff,
+		0x00, 0x37, 0x3b, 0x80, 0x16, 0xff, 0x00, 0x44, 0x2d, 0x40, 0xff, 0x01, 0xa8, 0x98, 0x80, 0x06,
+		0x8b, 0xff, 0x00, 0x2c, 0x30, 0x80, 0xff, 0x00, 0x00, 0xa1, 0x00, 0xff, 0x00, 0x33, 0x22, 0x00,
+		0xff, 0x00, 0x1c, 0x78, 0x40, 0xff, 0x00, 0x29, 0x59, 0x40, 0xff, 0x00, 0x17, 0x6e, 0x80, 0xff,
+		0x00, 0x22, 0x07, 0xc0, 0xff, 0x00, 0x22, 0x7d, 0x00, 0xff, 0x00, 0x0f, 0xe0, 0x00, 0xff, 0x00,
+		0x20, 0xbc, 0x80, 0x8b, 0xff, 0x00, 0x3b, 0x71, 0xc0, 0x8b, 0xff, 0x00, 0x31, 0x98, 0x40, 0xff,
+		0xff, 0xcd, 0x58, 0x00, 0x8b, 0xff, 0xff, 0xbe, 0x17, 0x40, 0x8b, 0xff, 0xff, 0xd0, 0xea, 0x40,
+		0xff, 0xff, 0xe5, 0xe7, 0x80, 0xff, 0xff, 0xd4, 0xfd, 0x00, 0xff, 0xff, 0xda, 0x4f, 0x00, 0xff,
+		0xff, 0xef, 0x22, 0x80, 0xff, 0xff, 0xef, 0x47, 0xc0, 0xff, 0xff, 0xf8, 0x84, 0xc0, 0xff, 0xff,
+		0xf1, 0xbd, 0x00, 0xff, 0xff, 0xff, 0x8e, 0x80, 0xff, 0xff, 0xf1, 0x11, 0x80, 0x8b, 0x08, 0xff,
+		0xff, 0xe3, 0x85, 0x80, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0xff, 0x00, 0x1e, 0x34, 0x40, 0x06, 0xff,
+		0x00, 0x20, 0x94, 0x80, 0x8b, 0xff, 0x00, 0x1b, 0x07, 0x80, 0xff, 0xff, 0xfd, 0xbc, 0x40, 0xff,
+		0x00, 0x1c, 0x3c, 0x40, 0xff, 0xff, 0xee, 0x50, 0x40, 0xff, 0x00, 0x25, 0xb0, 0x40, 0xff, 0xff,
+		0xe8, 0x64, 0x80, 0xff, 0x00, 0x1c, 0x32, 0x00, 0xff, 0xff, 0xd2, 0x0c, 0xc0, 0x8b, 0xff, 0xff,
+		0xcb, 0x75, 0x80, 0x8b, 0xff, 0xff, 0xb7, 0x96, 0x40, 0xff, 0xff, 0xc9, 0x6e, 0x80, 0xff, 0xff,
+		0xc9, 0x2d, 0x80, 0xff, 0xff, 0xc0, 0x43, 0x00, 0x8b, 0xff, 0xff, 0xe7, 0x7c, 0x40, 0x8b, 0xff,
+		0xff, 0xe8, 0x47, 0x00, 0xff, 0x00, 0x08, 0x3c, 0x40, 0xff, 0xff, 0xec, 0xe2, 0x80, 0xff, 0x00,
+		0x0f, 0x18, 0x40, 0x08, 0xff, 0xff, 0xdc, 0x9e, 0x00, 0xff, 0xff, 0xc7, 0xe7, 0xc0, 0x05, 0xaa,
+		0xff, 0xff, 0xeb, 0xb1, 0xc0, 0xff, 0x00, 0x24, 0x1f, 0x00, 0xff, 0xff, 0xf5, 0x36, 0x80, 0xff,
+		0x00, 0x24, 0xcb, 0x80, 0x8b, 0xff, 0x00, 0x66, 0x81, 0x80, 0x8b, 0xff, 0x00, 0x50, 0xf6, 0x40,
+		0xff, 0x00, 0x52, 0x61, 0x80, 0x8b, 0xff, 0x00, 0x6c, 0xa4, 0xc0, 0x8b, 0xff, 0x00, 0x53, 0x16,
+		0xc0, 0xff, 0xff, 0xcf, 0x92, 0xc0, 0xff, 0x00, 0x48, 0x0b, 0x00, 0xff, 0xff, 0xb5, 0x03, 0x40,
+		0xff, 0x00, 0x17, 0x3b, 0x80, 0xff, 0x00, 0x31, 0x1b, 0x00, 0xff, 0x00, 0x19, 0x48, 0x00, 0xff,
+		0x00, 0x1e, 0x78, 0xc0, 0xff, 0x00, 0x33, 0x15, 0x80, 0x8b, 0xff, 0x00, 0x39, 0x7e, 0x40, 0x8b,
+		0xff, 0x00, 0x5f, 0x17, 0x40, 0xff, 0xff, 0xae, 0x9d, 0x80, 0xff, 0x00, 0x50, 0xdf, 0x00, 0xff,
+		0xff, 0x9c, 0x3b, 0x40, 0x8b, 0xff, 0xff, 0xbb, 0xd2, 0x80, 0x8b, 0xff, 0xff, 0xbf, 0xa6, 0x00,
+		0xff, 0xff, 0xd9, 0x82, 0x00, 0xff, 0xff, 0xe1, 0x58, 0x40, 0xff, 0xff, 0xba, 0x5d, 0x40, 0x08,
+		0xff, 0xff, 0xeb, 0xaf, 0x00, 0xff, 0xff, 0xd1, 0xd9, 0xc0, 0xff, 0xff, 0xff, 0x6c, 0xc0, 0xff,
+		0xff, 0xd1, 0xe4, 0x40, 0x8b, 0xff, 0xff, 0xd2, 0x6d, 0x80, 0x08, 0x0e, 0xff, 0x00, 0xf3, 0x5d,
+		0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x5f, 0x0a, 0xff, 0xff, 0x0f, 0x39, 0x40, 0xff, 0xff,
+		0x6a, 0xb3, 0x80, 0x15, 0x39, 0x0a, 0xff, 0x01, 0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43, 0x00, 0xc0,
+		0x15, 0x3a, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60,
+		0x0a, 0xff, 0xfe, 0xf7, 0xec, 0x00, 0xff, 0xff, 0x02, 0x47, 0x40, 0x15, 0x39, 0x0a, 0xff, 0x01,
+		0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43, 0x00, 0xc0, 0x15, 0x3a, 0x0a, 0x0e, 0xff, 0x00, 0x8c, 0xab,
+		0x40, 0xff, 0x02, 0x20, 0x8d, 0x80, 0x15, 0x61, 0x0a, 0xff, 0xff, 0x5e, 0x9e, 0x80, 0xff, 0xfe,
+		0xe5, 0xcc, 0xc0, 0x15, 0x39, 0x0a, 0xff, 0x01, 0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43, 0x00, 0xc0,
+		0x15, 0x3a, 0x0a, 0x0e, 0xff, 0x00, 0x90, 0xfc, 0x00, 0xff, 0x02, 0x2d, 0x7f, 0x80, 0x15, 0x5c,
+		0x0a, 0xff, 0xff, 0xf6, 0x81, 0xc0, 0xff, 0xff, 0x45, 0x97, 0xc0, 0x15, 0x39, 0x0a, 0xff, 0x01,
+		0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43, 0x00, 0xc0, 0x15, 0x3a, 0x0a, 0x0e, 0xff, 0x00, 0xe2, 0x1f,
+		0x40, 0xff, 0x02, 0x66, 0x05, 0xc0, 0x15, 0x62, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00,
+		0x00, 0x03, 0x40, 0x15, 0x63, 0x0a, 0xff, 0xfe, 0xc6, 0xba, 0xc0, 0xff, 0xff, 0x2c, 0xfc, 0x80,
+		0x15, 0x39, 0x0a, 0xff, 0x01, 0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43, 0x00, 0xc0, 0x15, 0x3a, 0x0a,
+		0x0e, 0xff, 0x01, 0x5b, 0xcb, 0x00, 0xff, 0x02, 0x5c, 0xf6, 0x00, 0x15, 0x64, 0x0a, 0xff, 0xff,
+		0x7b, 0xe2, 0x00, 0xff, 0x00, 0x00, 0xab, 0x80, 0x15, 0x65, 0x0a, 0xff, 0xff, 0x82, 0xf0, 0x80,
+		0xff, 0xff, 0x35, 0x64, 0x00, 0x15, 0x39, 0x0a, 0xff, 0x01, 0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43,
+		0x00, 0xc0, 0x15, 0x3a, 0x0a, 0x0e, 0xff, 0x00, 0x1f, 0x11, 0x80, 0xff, 0x01, 0x9b, 0xa6, 0xc0,
+		0x15, 0xff, 0x00, 0x23, 0x62, 0x00, 0xff, 0xff, 0xd3, 0xfc, 0x80, 0x05, 0xff, 0x00, 0x12, 0x73,
+		0xc0, 0xff, 0x00, 0x1a, 0x87, 0xc0, 0xff, 0x00, 0x1c, 0xdd, 0x80, 0xff, 0x00, 0x10, 0xb0, 0x80,
+		0xff, 0x00, 0x1c, 0x16, 0xc0, 0x8b, 0xff, 0x00, 0x1f, 0x38, 0xc0, 0x8b, 0xff, 0x00, 0x1d, 0x35,
+		0xc0, 0xff, 0xff, 0xeb, 0x11, 0x00, 0xff, 0x00, 0x0c, 0x1a, 0xc0, 0xff, 0xff, 0xde, 0x13, 0x80,
+		0xff, 0x00, 0x05, 0xd8, 0xc0, 0xff, 0xff, 0xef, 0x9e, 0x00, 0xff, 0x00, 0x00, 0xb0, 0x00, 0xff,
+		0xff, 0xef, 0x67, 0x00, 0x8b, 0xff, 0xff, 0xed, 0x9e, 0x80, 0x08, 0x8b, 0xff, 0xff, 0xe6, 0x1c,
+		0x40, 0xff, 0xff, 0xe9, 0x90, 0x00, 0xff, 0xff, 0xff, 0x23, 0x00, 0x05, 0xff, 0xff, 0xe7, 0xf5,
+		0xc0, 0xff, 0xff, 0xff, 0x13, 0x40, 0xff, 0xff, 0xdc, 0x5a, 0xc0, 0xff, 0xff, 0xfe, 0x8e, 0x80,
+		0xff, 0xff, 0xda, 0xbb, 0x00, 0xff, 0xff, 0xef, 0x2e, 0x00, 0xff, 0xff, 0xc1, 0x4a, 0x80, 0xff,
+		0xff, 0xe3, 0xb3, 0x40, 0xff, 0xff, 0xe3, 0x63, 0x40, 0xff, 0xff, 0xc8, 0x6d, 0x00, 0x8b, 0xff,
+		0xff, 0xcc, 0xd4, 0x40, 0x8b, 0xff, 0xff, 0xb4, 0xdc, 0x40, 0xff, 0x00, 0x3b, 0x7d, 0xc0, 0xff,
+		0xff, 0xc4, 0x22, 0x80, 0xff, 0x00, 0x48, 0x08, 0x00, 0x8b, 0xff, 0x00, 0x2f, 0xce, 0x00, 0x8b,
+		0xff, 0x00, 0x2b, 0x90, 0x00, 0xff, 0x00, 0x1a, 0xc6, 0x40, 0xff, 0x00, 0x15, 0x7b, 0x40, 0xff,
+		0x00, 0x2a, 0x66, 0x40, 0xff, 0x00, 0x1b, 0x4c, 0x00, 0xff, 0xff, 0xd5, 0x03, 0x40, 0xff, 0x00,
+		0x2f, 0x67, 0x80, 0xff, 0xff, 0xe5, 0xf2, 0x40, 0xff, 0x00, 0x32, 0xec, 0x00, 0x8b, 0xff, 0x00,
+		0x2c, 0x29, 0x00, 0x8b, 0xff, 0x00, 0x29, 0xde, 0x40, 0xff, 0x00, 0x13, 0x9d, 0x80, 0xff, 0x00,
+		0x1c, 0x43, 0x40, 0xff, 0x00, 0x21, 0xe4, 0x40, 0x08, 0xff, 0xff, 0xdc, 0x9e, 0x00, 0xff, 0x00,
+		0x29, 0x6c, 0x80, 0x05, 0xff, 0xff, 0xee, 0xd3, 0x00, 0xff, 0xff, 0xe9, 0x04, 0xc0, 0xff, 0xff,
+		0xe4, 0xe3, 0x00, 0xff, 0xff, 0xf2, 0xb9, 0x40, 0xff, 0xff, 0xe2, 0xb3, 0xc0, 0x8b, 0xff, 0xff,
+		0xd8, 0xfc, 0x00, 0x8b, 0xff, 0xff, 0xdb, 0x01, 0x40, 0xff, 0x00, 0x17, 0x4e, 0x40, 0xff, 0xff,
+		0xef, 0x18, 0x00, 0xff, 0x00, 0x26, 0x82, 0x80, 0xff, 0xff, 0xf6, 0x78, 0x80, 0xff, 0x00, 0x15,
+		0xb4, 0x80, 0xff, 0xff, 0xff, 0x1e, 0x40, 0xff, 0x00, 0x14, 0x7a, 0x00, 0x8b, 0xff, 0x00, 0x17,
+		0xbd, 0x40, 0x08, 0x8b, 0xff, 0x00, 0x2e, 0x9a, 0x00, 0xff, 0x00, 0xcf, 0xfb, 0x80, 0xff, 0x00,
+		0x08, 0xa1, 0x40, 0x8b, 0xff, 0x00, 0x25, 0xf8, 0xc0, 0x05, 0x8b, 0xff, 0x00, 0x2d, 0x04, 0x80,
+		0xff, 0x00, 0x00, 0x4c, 0x80, 0xff, 0x00, 0x33, 0x92, 0x00, 0xff, 0xff, 0xe5, 0x60, 0x40, 0xff,
+		0x00, 0x2b, 0xa0, 0x40, 0xff, 0xff, 0xe7, 0x1c, 0x40, 0xff, 0x00, 0x28, 0xc8, 0x40, 0xff, 0xff,
+		0xd8, 0x5e, 0x40, 0xff, 0x00, 0x11, 0x8c, 0x40, 0xff, 0xff, 0xdc, 0x04, 0x80, 0x8b, 0xff, 0xff,
+		0xd5, 0xb5, 0x40, 0x8b, 0xff, 0xff, 0xd7, 0x4a, 0x00, 0xff, 0xff, 0xe8, 0x63, 0xc0, 0xff, 0xff,
+		0xe9, 0xaf, 0x80, 0xff, 0xff, 0xd9, 0x6b, 0xc0, 0xff, 0xff, 0xea, 0x71, 0x00, 0xff, 0x00, 0x26,
+		0x3b, 0x80, 0xff, 0xff, 0xd6, 0xa7, 0x80, 0xff, 0x00, 0x17, 0xf0, 0x80, 0xff, 0xff, 0xcf, 0x67,
+		0x00, 0x8b, 0xff, 0xff, 0xd3, 0xc2, 0x80, 0x8b, 0xff, 0xff, 0xd5, 0x1d, 0x40, 0xff, 0xff, 0xec,
+		0x44, 0x40, 0xff, 0xff, 0xe3, 0xa8, 0xc0, 0xff, 0xff, 0xdc, 0x77, 0x40, 0x08, 0xff, 0x00, 0xbd,
+		0xdc, 0x00, 0xff, 0xff, 0x3f, 0x8d, 0x00, 0x15, 0xff, 0xff, 0xda, 0x07, 0x40, 0x07, 0x8b, 0xff,
+		0xff, 0xdd, 0x3d, 0x80, 0xff, 0x00, 0x02, 0x57, 0x00, 0xff, 0xff, 0xe5, 0xbd, 0xc0, 0xff, 0xff,
+		0xf7, 0x46, 0x00, 0xff, 0xff, 0xe8, 0x44, 0x80, 0xff, 0xff, 0xf4, 0xb9, 0x40, 0xff, 0xff, 0xe1,
+		0x55, 0x00, 0xff, 0xff, 0xe4, 0x75, 0x40, 0xff, 0xff, 0xf0, 0x37, 0x80, 0xff, 0xff, 0xe4, 0xe4,
+		0x40, 0x8b, 0xff, 0xff, 0xd7, 0x7c, 0x00, 0x8b, 0xff, 0xff, 0xde, 0x1a, 0x40, 0xff, 0x00, 0x22,
+		0x38, 0x80, 0x8b, 0xff, 0x00, 0x2b, 0x87, 0x80, 0x8b, 0xff, 0x00, 0x1c, 0x93, 0x00, 0xff, 0x00,
+		0x0f, 0x2b, 0x00, 0xff, 0x00, 0x1e, 0x95, 0x80, 0xff, 0x00, 0x20, 0xae, 0x40, 0xff, 0x00, 0x10,
+		0xbf, 0x40, 0xff, 0x00, 0x19, 0x5e, 0xc0, 0xff, 0x00, 0x0d, 0x00, 0x40, 0xff, 0x00, 0x1a, 0x5f,
+		0x80, 0xff, 0x00, 0x00, 0xa2, 0x00, 0xff, 0x00, 0x19, 0x8f, 0x40, 0xff, 0x00, 0x01, 0x05, 0x80,
+		0x08, 0xff, 0x00, 0x52, 0xd9, 0x40, 0xff, 0x00, 0x3c, 0x69, 0x00, 0x15, 0xff, 0x00, 0x11, 0x42,
+		0x80, 0x07, 0x8b, 0xff, 0x00, 0x18, 0x65, 0x80, 0xff, 0x00, 0x01, 0x3a, 0x80, 0xff, 0x00, 0x1a,
+		0x94, 0x80, 0xff, 0x00, 0x11, 0xb1, 0x40, 0xff, 0x00, 0x1a, 0x80, 0x80, 0xff, 0x00, 0x0e, 0x90,
+		0x40, 0xff, 0x00, 0x15, 0xd0, 0x40, 0xff, 0x00, 0x16, 0x21, 0x00, 0xff, 0x00, 0x0f, 0xa6, 0x40,
+		0xff, 0x00, 0x18, 0xa9, 0x40, 0x8b, 0xff, 0x00, 0x19, 0x60, 0x40, 0x8b, 0xff, 0x00, 0x17, 0x41,
+		0x80, 0xff, 0xff, 0xef, 0xa0, 0x00, 0xff, 0x00, 0x0b, 0xfc, 0x80, 0xff, 0xff, 0xe4, 0x27, 0x00,
+		0xff, 0x00, 0x08, 0xe3, 0x00, 0xff, 0xff, 0xeb, 0x5a, 0x00, 0xff, 0x00, 0x00, 0x62, 0x00, 0xff,
+		0xff, 0xeb, 0x2c, 0x80, 0x8b, 0xff, 0xff, 0xeb, 0x62, 0xc0, 0x08, 0xff, 0xff, 0xec, 0x26, 0xc0,
+		0x07, 0x0e, 0xff, 0x01, 0xc8, 0x87, 0x00, 0xff, 0x01, 0x7d, 0x72, 0x40, 0x15, 0xff, 0xff, 0xdc,
+		0x06, 0x80, 0xff, 0x00, 0x34, 0xbb, 0x40, 0xff, 0xff, 0xc2, 0x9c, 0x40, 0xff, 0x00, 0x1f, 0xde,
+		0x00, 0xff, 0xff, 0xb6, 0x88, 0xc0, 0x8b, 0xff, 0xff, 0x79, 0xbd, 0x00, 0x8b, 0xff, 0xff, 0xa0,
+		0xa8, 0xc0, 0xff, 0xff, 0x9b, 0x55, 0x00, 0x8b, 0xff, 0xff, 0x76, 0xe5, 0x00, 0x8b, 0xff, 0xff,
+		0x7d, 0xd4, 0x00, 0xff, 0x00, 0x55, 0x94, 0x80, 0xff, 0xff, 0x9d, 0xfb, 0xc0, 0xff, 0x00, 0x76,
+		0x76, 0x00, 0xff, 0xff, 0xf5, 0x9c, 0x40, 0x08, 0xff, 0xff, 0xf6, 0x22, 0x40, 0xff, 0xff, 0xb4,
+		0xde, 0xc0, 0xff, 0x00, 0x1d, 0x57, 0xc0, 0x8b, 0x05, 0xff, 0x00, 0x0b, 0x64, 0x40, 0x8b, 0xff,
+		0x00, 0x0e, 0x6a, 0x00, 0xff, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x00, 0x0a, 0xc4, 0x80, 0xff, 0xff,
+		0xf9, 0x66, 0x80, 0xff, 0x00, 0x07, 0xd6, 0x00, 0xff, 0xff, 0xfb, 0x32, 0xc0, 0xff, 0x00, 0x03,
+		0x0e, 0xc0, 0xff, 0xff, 0xf9, 0x52, 0x40, 0x8b, 0xff, 0xff, 0xfa, 0x1c, 0x40, 0x8b, 0xff, 0xff,
+		0xf7, 0x4b, 0x80, 0xff, 0xff, 0xf9, 0x32, 0x40, 0xff, 0xff, 0xf0, 0x4e, 0x80, 0xff, 0xff, 0xd9,
+		0x1e, 0x40, 0x8b, 0xff, 0xff, 0xe1, 0xc4, 0x40, 0x8b, 0xff, 0xff, 0xda, 0x58, 0x00, 0xff, 0x00,
+		0x0a, 0x0f, 0xc0, 0xff, 0xff, 0xe0, 0x96, 0xc0, 0xff, 0x00, 0x19, 0x54, 0xc0, 0x08, 0xff, 0xff,
+		0xe6, 0xf9, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00, 0x25, 0x5d, 0x40, 0xff, 0xff,
+		0xe5, 0xb9, 0x40, 0xff, 0x00, 0x2a, 0xc8, 0x80, 0xff, 0xff, 0xf5, 0x16, 0x80, 0xff, 0x00, 0x26,
+		0x6b, 0x40, 0x8b, 0xff, 0x00, 0x49, 0x64, 0x80, 0x8b, 0xff, 0x00, 0x23, 0x12, 0x00, 0xff, 0x00,
+		0x26, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x23, 0xb9, 0x80, 0x8b, 0xff, 0x00, 0x13, 0x63, 0x00, 0xff,
+		0xff, 0xf5, 0x8f, 0x40, 0xff, 0x00, 0x11, 0xfa, 0x40, 0xff, 0xff, 0xec, 0xef, 0xc0, 0xff, 0x00,
+		0x09, 0x40, 0x00, 0xff, 0xff, 0xf3, 0x26, 0xc0, 0xff, 0x00, 0x06, 0x3c, 0x40, 0xff, 0xff, 0xf2,
+		0xdf, 0xc0, 0xff, 0x00, 0x00, 0xcf, 0x40, 0xff, 0xff, 0xf3, 0x3d, 0xc0, 0xff, 0x00, 0x00, 0xac,
+		0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x40, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x00, 0x04, 0x11,
+		0xc0, 0xff, 0x00, 0x25, 0x4c, 0x80, 0x05, 0xff, 0x00, 0x37, 0x8a, 0xc0, 0xff, 0x00, 0x05, 0x40,
+		0x40, 0xff, 0x00, 0x34, 0x1c, 0x00, 0xff, 0x00, 0x18, 0xc0, 0x40, 0xff, 0x00, 0x26, 0x71, 0x00,
+		0xff, 0x00, 0x29, 0x70, 0x00, 0x08, 0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0x00, 0x30, 0x53, 0xc0,
+		0x05, 0xff, 0xff, 0xe1, 0x1c, 0xc0, 0x68, 0xff, 0xff, 0xd3, 0xa4, 0x80, 0xff, 0xff, 0xeb, 0xc0,
+		0x00, 0xff, 0xff, 0xd2, 0x36, 0xc0, 0x8b, 0x08, 0xff, 0xff, 0xa6, 0xfa, 0x00, 0xff, 0xff, 0xbc,
+		0x24, 0x40, 0xff, 0x00, 0x4a, 0x99, 0x40, 0xff, 0x00, 0x6a, 0xc2, 0x40, 0xff, 0x00, 0x68, 0x1d,
+		0x00, 0xff, 0x00, 0x42, 0xe9, 0xc0, 0xff, 0x00, 0x40, 0xfd, 0x80, 0xff, 0x00, 0x53, 0xf3, 0x00,
+		0x1f, 0xff, 0x00, 0x4e, 0x00, 0x40, 0x8b, 0xff, 0x00, 0x25, 0x83, 0xc0, 0xff, 0xff, 0xc9, 0x88,
+		0x40, 0xff, 0x00, 0x02, 0xa6, 0x00, 0xff, 0xff, 0xfa, 0xa4, 0x80, 0xff, 0x00, 0x03, 0xd1, 0x40,
+		0xff, 0xff, 0xf8, 0x48, 0x00, 0xff, 0xff, 0xfa, 0x90, 0x00, 0xff, 0xff, 0xf6, 0x9b, 0x40, 0xff,
+		0x00, 0x07, 0xeb, 0x00, 0xff, 0xff, 0xfa, 0x06, 0x80, 0x08, 0x0e, 0xff, 0x00, 0xf3, 0x5d, 0xc0,
+		0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x5f, 0x0a, 0xff, 0xff, 0xb7, 0x3f, 0x80, 0xff, 0xff, 0xab,
+		0xa9, 0x00, 0x15, 0x3c, 0x0a, 0xff, 0xff, 0x76, 0x30, 0x00, 0xff, 0xff, 0x3d, 0x97, 0x40, 0x15,
+		0x3d, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a,
+		0xff, 0xff, 0x9f, 0xf2, 0x40, 0xff, 0xff, 0x43, 0x3c, 0xc0, 0x15, 0x3c, 0x0a, 0xff, 0xff, 0x76,
+		0x30, 0x00, 0xff, 0xff, 0x3d, 0x97, 0x40, 0x15, 0x3d, 0x0a, 0x0e, 0xff, 0x00, 0x85, 0xc3, 0xc0,
+		0xff, 0x02, 0x20, 0x8d, 0x80, 0x15, 0x61, 0x0a, 0xff, 0x00, 0x0d, 0x8c, 0x40, 0xff, 0xff, 0x26,
+		0xc2, 0x40, 0x15, 0x3c, 0x0a, 0xff, 0xff, 0x76, 0x30, 0x00, 0xff, 0xff, 0x3d, 0x97, 0x40, 0x15,
+		0x3d, 0x0a, 0x0e, 0xff, 0x00, 0xd6, 0xe7, 0x00, 0xff, 0x02, 0x66, 0x05, 0xc0, 0x15, 0x62, 0x0a,
+		0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x40, 0x15, 0x63, 0x0a, 0xff, 0xff, 0x79,
+		0xf9, 0x40, 0xff, 0xff, 0x6d, 0xf2, 0x00, 0x15, 0x3c, 0x0a, 0xff, 0xff, 0x76, 0x30, 0x00, 0xff,
+		0xff, 0x3d, 0x97, 0x40, 0x15, 0x3d, 0x0a, 0x0e, 0xff, 0x00, 0xbf, 0x96, 0x00, 0xff, 0x02, 0xbb,
+		0x07, 0xc0, 0x15, 0x5f, 0x0a, 0xff, 0xff, 0x52, 0x89, 0xc0, 0xff, 0xff, 0xa1, 0x11, 0xc0, 0x15,
+		0x41, 0x0a, 0x0e, 0xff, 0x01, 0x1b, 0x10, 0x80, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a,
+		0xff, 0xff, 0x10, 0x16, 0x00, 0xff, 0xff, 0x38, 0xa5, 0x80, 0x15, 0x41, 0x0a, 0x0e, 0xff, 0x00,
+		0x71, 0x0d, 0x80, 0xff, 0x02, 0x20, 0x8d, 0x80, 0x15, 0x61, 0x0a, 0xff, 0xff, 0x89, 0xc5, 0x00,
+		0xff, 0xff, 0x1c, 0x2b, 0x00, 0x15, 0x41, 0x0a, 0x0e, 0xff, 0x00, 0xca, 0xd2, 0x00, 0xff, 0x02,
+		0x66, 0x05, 0xc0, 0x15, 0x62, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x40,
+		0x15, 0x63, 0x0a, 0xff, 0xfe, 0xed, 0x90, 0xc0, 0xff, 0xff, 0x63, 0x5a, 0xc0, 0x15, 0x41, 0x0a,
+		0x0e, 0xff, 0x00, 0xfe, 0xc8, 0x00, 0xff, 0x01, 0x95, 0x9e, 0x80, 0x15, 0xff, 0x00, 0x33, 0xec,
+		0x40, 0xff, 0x00, 0x50, 0xc8, 0xc0, 0xff, 0xff, 0xdd, 0x26, 0x00, 0xff, 0xff, 0x75, 0x2b, 0xc0,
+		0xff, 0xff, 0x75, 0x1d, 0x80, 0xff, 0xff, 0xb4, 0x5d, 0x40, 0xff, 0xff, 0xd4, 0xff, 0x80, 0xff,
+		0xff, 0xc7, 0xad, 0xc0, 0xff, 0xff, 0xb8, 0x3f, 0x00, 0xff, 0xff, 0xbc, 0xb9, 0x80, 0xff, 0x00,
+		0x42, 0x00, 0x40, 0xff, 0x00, 0x74, 0x49, 0x80, 0xff, 0x00, 0x75, 0xa4, 0xc0, 0xff, 0x00, 0x46,
+		0xbb, 0x80, 0xff, 0x00, 0x37, 0xa2, 0xc0, 0xff, 0x00, 0x43, 0x8c, 0x00, 0x1f, 0xff, 0x00, 0x5c,
+		0x03, 0xc0, 0xff, 0x00, 0xa4, 0xbb, 0x00, 0x15, 0xff, 0x00, 0x55, 0x91, 0x40, 0xff, 0x00, 0x18,
+		0x42, 0x00, 0xff, 0xff, 0xee, 0xbd, 0x80, 0xff, 0x00, 0x2c, 0xe0, 0x40, 0xff, 0xff, 0x94, 0x37,
+		0x40, 0xff, 0xff, 0xe2, 0x8b, 0x00, 0x05, 0xff, 0xff, 0xe1, 0x39, 0x80, 0xff, 0x00, 0x1b, 0x75,
+		0x00, 0xff, 0xff, 0xe1, 0x3f, 0x00, 0xff, 0x00, 0x14, 0x4f, 0x00, 0xff, 0xff, 0xe6, 0x46, 0x80,
+		0xff, 0x00, 0x0e, 0x7c, 0x40, 0x08, 0xff, 0xff, 0xae, 0xe0, 0xc0, 0xff, 0xff, 0xef, 0x9a, 0x40,
+		0x05, 0xff, 0x00, 0x25, 0x19, 0x80, 0xff, 0xff, 0xef, 0x4a, 0x40, 0xff, 0x00, 0x22, 0x47, 0x00,
+		0xff, 0xff, 0xea, 0x67, 0x40, 0xff, 0x00, 0x1e, 0xad, 0xc0, 0xff, 0xff, 0xe6, 0x54, 0x00, 0x08,
+		0xff, 0xff, 0x98, 0x37, 0xc0, 0xff, 0xff, 0xe3, 0xa3, 0x40, 0xff, 0x00, 0x12, 0x1f, 0x80, 0xff,
+		0xff, 0xd0, 0x89, 0x00, 0xff, 0x00, 0x7f, 0x4e, 0x80, 0xff, 0x00, 0x24, 0x17, 0x00, 0x05, 0xff,
+		0x00, 0x24, 0x79, 0xc0, 0xff, 0xff, 0xd8, 0x59, 0x40, 0xff, 0x00, 0x1d, 0x40, 0x80, 0xff, 0xff,
+		0xd1, 0xa5, 0xc0, 0xff, 0x00, 0x14, 0x20, 0x80, 0xff, 0xff, 0xcc, 0xf1, 0x80, 0xff, 0xff, 0xe1,
+		0xc7, 0x80, 0xff, 0x00, 0x20, 0xb1, 0x00, 0xff, 0xff, 0xd4, 0xd1, 0x40, 0xff, 0x00, 0x13, 0x5b,
+		0x00, 0xff, 0xff, 0xd1, 0x76, 0x40, 0x8b, 0x08, 0xff, 0xff, 0x91, 0x08, 0x00, 0xff, 0xff, 0x9e,
+		0xc7, 0x80, 0xff, 0xff, 0x94, 0xc2, 0x80, 0xff, 0xff, 0x76, 0xc2, 0xc0, 0xff, 0xff, 0x76, 0x8f,
+		0x00, 0xff, 0x00, 0x64, 0x12, 0x00, 0xff, 0xff, 0x9e, 0xaf, 0x00, 0xff, 0x00, 0x73, 0x99, 0x00,
+		0x1f, 0xff, 0x00, 0x42, 0x72, 0x00, 0x8b, 0xff, 0x00, 0x3e, 0x5b, 0x00, 0xff, 0x00, 0x20, 0xc0,
+		0xc0, 0xff, 0x00, 0x24, 0xba, 0x40, 0xff, 0x00, 0x3c, 0xe8, 0xc0, 0xff, 0x00, 0x20, 0x75, 0x80,
+		0xff, 0x00, 0x35, 0xd5, 0x80, 0xff, 0x00, 0x06, 0x3a, 0x40, 0xff, 0x00, 0x3f, 0xdc, 0x80, 0x8b,
+		0xff, 0x00, 0x35, 0xdd, 0xc0, 0x8b, 0xff, 0x00, 0x91, 0xcd, 0x00, 0xff, 0xff, 0xcb, 0xc7, 0x40,
+		0xff, 0x00, 0x65, 0xf0, 0x00, 0xff, 0xff, 0xc2, 0xc3, 0xc0, 0xff, 0x00, 0x45, 0x79, 0x80, 0x08,
+		0x0e, 0xff, 0x00, 0x82, 0x50, 0x40, 0xff, 0x02, 0x2d, 0x7f, 0x80, 0x15, 0x5c, 0x0a, 0xff, 0xff,
+		0xee, 0xbd, 0x40, 0xff, 0xfd, 0xb2, 0x92, 0x40, 0x15, 0x45, 0x0a, 0x0e, 0xff, 0x00, 0xf3, 0x5d,
+		0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x5f, 0x0a, 0xff, 0x00, 0x80, 0xaf, 0x80, 0xff, 0xfe,
+		0xba, 0x0c, 0x40, 0x15, 0x46, 0x0a, 0xff, 0xff, 0x2f, 0xb5, 0xc0, 0xff, 0x00, 0xb3, 0x54, 0x80,
+		0x15, 0x47, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60,
+		0x0a, 0xff, 0x00, 0x69, 0x62, 0x40, 0xff, 0xfe, 0x51, 0xa0, 0x00, 0x15, 0x46, 0x0a, 0xff, 0xff,
+		0x2f, 0xb5, 0xc0, 0xff, 0x00, 0xb3, 0x54, 0x80, 0x15, 0x47, 0x0a, 0x0e, 0xff, 0x00, 0x85, 0xc3,
+		0xc0, 0xff, 0x02, 0x20, 0x8d, 0x80, 0x15, 0x61, 0x0a, 0xff, 0x00, 0xd6, 0xfc, 0x40, 0xff, 0xfe,
+		0x35, 0x25, 0x80, 0x15, 0x46, 0x0a, 0xff, 0xff, 0x2f, 0xb5, 0xc0, 0xff, 0x00, 0xb3, 0x54, 0x80,
+		0x15, 0x47, 0x0a, 0x0e, 0xff, 0x00, 0x87, 0x7d, 0xc0, 0xff, 0x02, 0x2d, 0x7f, 0x80, 0x15, 0x5c,
+		0x0a, 0xff, 0x01, 0x71, 0x76, 0x40, 0xff, 0xfe, 0x94, 0xf0, 0x80, 0x15, 0x46, 0x0a, 0xff, 0xff,
+		0x2f, 0xb5, 0xc0, 0xff, 0x00, 0xb3, 0x54, 0x80, 0x15, 0x47, 0x0a, 0x0e, 0xff, 0x00, 0xd5, 0x2d,
+		0x40, 0xff, 0x02, 0x66, 0x05, 0xc0, 0x15, 0x62, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff, 0x00,
+		0x00, 0x03, 0x40, 0x15, 0x63, 0x0a, 0xff, 0x00, 0x45, 0x23, 0x00, 0xff, 0xfe, 0x7c, 0x55, 0x40,
+		0x15, 0x46, 0x0a, 0xff, 0xff, 0x2f, 0xb5, 0xc0, 0xff, 0x00, 0xb3, 0x54, 0x80, 0x15, 0x47, 0x0a,
+		0x0e, 0xff, 0x00, 0x46, 0xc4, 0x00, 0xff, 0x01, 0x5b, 0xca, 0x00, 0x15, 0x23, 0x0a, 0xff, 0xff,
+		0x7d, 0xb0, 0x00, 0xff, 0x00, 0x77, 0x16, 0x40, 0x15, 0xff, 0x00, 0x18, 0xc3, 0x40, 0xff, 0xff,
+		0xeb, 0xe2, 0xc0, 0xff, 0x00, 0x14, 0x21, 0x00, 0xff, 0xff, 0xe7, 0x38, 0xc0, 0xff, 0xff, 0xe7,
+		0x3a, 0x80, 0xff, 0xff, 0xeb, 0xe1, 0x00, 0xff, 0xff, 0xeb, 0xe0, 0x80, 0xff, 0xff, 0xe7, 0x3b,
+		0x00, 0xff, 0xff, 0xe7, 0x3b, 0x00, 0xff, 0x00, 0x14, 0x1f, 0x80, 0xff, 0xff, 0xeb, 0xe0, 0x80,
+		0xff, 0x00, 0x18, 0xc5, 0x00, 0xff, 0x00, 0x18, 0xc7, 0xc0, 0xff, 0x00, 0x14, 0x1c, 0xc0, 0xff,
+		0x00, 0x14, 0x21, 0x40, 0xff, 0x00, 0x18, 0xc3, 0x80, 0x1e, 0xff, 0x00, 0x00, 0x02, 0x00, 0xff,
+		0xfe, 0xcb, 0xe9, 0x00, 0x15, 0xff, 0x00, 0x18, 0xc8, 0x40, 0xff, 0xff, 0xeb, 0xdd, 0xc0, 0xff,
+		0x00, 0x14, 0x22, 0x40, 0xff, 0xff, 0xe7, 0x37, 0xc0, 0xff, 0xff, 0xe7, 0x36, 0xc0, 0xff, 0xff,
+		0xeb, 0xde, 0x00, 0xff, 0xff, 0xeb, 0xde, 0x40, 0xff, 0xff, 0xe7, 0x37, 0x00, 0xff, 0xff, 0xe7,
+		0x36, 0xc0, 0xff, 0x00, 0x14, 0x22, 0x40, 0xff, 0xff, 0xeb, 0xde, 0x40, 0xff, 0x00, 0x18, 0xc9,
+		0x40, 0xff, 0x00, 0x18, 0xc8, 0x80, 0xff, 0x00, 0x14, 0x21, 0xc0, 0xff, 0x00, 0x14, 0x22, 0xc0,
+		0xff, 0x00, 0x18, 0xc8, 0x80, 0x1e, 0x0e, 0xff, 0x00, 0xfb, 0xc9, 0x80, 0xff, 0x01, 0x95, 0xb2,
+		0xc0, 0x15, 0xff, 0x00, 0x11, 0x8a, 0x80, 0x8b, 0xff, 0x00, 0x11, 0xd3, 0xc0, 0xff, 0xff, 0xfb,
+		0xf8, 0xc0, 0xff, 0x00, 0x10, 0xb7, 0x80, 0xff, 0xff, 0xf7, 0xb9, 0x40, 0x08, 0xff, 0xff, 0x65,
+		0xf6, 0x40, 0xff, 0xfe, 0xe4, 0x92, 0x00, 0x05, 0xff, 0xff, 0xeb, 0x73, 0xc0, 0xff, 0x00, 0x1e,
+		0x65, 0x00, 0xff, 0xff, 0xf3, 0x34, 0xc0, 0xff, 0x00, 0x29, 0x12, 0x80, 0x8b, 0xff, 0x00, 0x31,
+		0xaf, 0x80, 0x8b, 0xff, 0x00, 0x6f, 0xfd, 0xc0, 0xff, 0x00, 0x41, 0x6c, 0x80, 0xff, 0x00, 0x3e,
+		0x97, 0x40, 0xff, 0x00, 0x45, 0xdf, 0x00, 0x8b, 0x08, 0xff, 0x00, 0xd0, 0x4a, 0x40, 0xff, 0xff,
+		0x4c, 0xab, 0x80, 0x15, 0x8b, 0xff, 0x00, 0x56, 0xca, 0x40, 0xff, 0xff, 0xe1, 0xdc, 0x40, 0xff,
+		0x00, 0x40, 0x19, 0x00, 0xff, 0xff, 0xd3, 0x97, 0xc0, 0xff, 0x00, 0x28, 0x1a, 0x40, 0x08, 0xff,
+		0x00, 0x27, 0xed, 0xc0, 0xff, 0x00, 0x48, 0xd3, 0x40, 0xff, 0xff, 0xca, 0x7e, 0x80, 0xff, 0x00,
+		0x1c, 0x7a, 0xc0, 0xff, 0xff, 0xda, 0xe2, 0x40, 0xff, 0xff, 0xbb, 0xb5, 0x00, 0x05, 0xff, 0xff,
+		0xe7, 0x57, 0x40, 0xff, 0x00, 0x0a, 0xf7, 0x80, 0xff, 0xff, 0xe5, 0x66, 0x40, 0xff, 0x00, 0x05,
+		0x8d, 0x00, 0xff, 0xff, 0xe5, 0x1d, 0x40, 0x8b, 0xff, 0xff, 0x8b, 0x92, 0x80, 0x8b, 0xff, 0xff,
+		0x9c, 0x2f, 0x00, 0xff, 0xff, 0x9b, 0x25, 0x00, 0x8b, 0xff, 0xff, 0x72, 0xd8, 0xc0, 0x8b, 0xff,
+		0xff, 0xb4, 0xd6, 0x00, 0xff, 0x00, 0x1c, 0xf2, 0x40, 0xff, 0xff, 0xc0, 0xd4, 0x40, 0xff, 0x00,
+		0x2c, 0xcb, 0xc0, 0xff, 0xff, 0xd5, 0xd5, 0xc0, 0x08, 0xff, 0xff, 0xd3, 0xb6, 0xc0, 0xff, 0xff,
+		0xae, 0x83, 0x00, 0xff, 0x00, 0x33, 0xc7, 0x80, 0xff, 0xff, 0xe5, 0x3f, 0x40, 0xff, 0x00, 0x28,
+		0xa7, 0x80, 0xff, 0x00, 0x4a, 0x25, 0x80, 0x05, 0xff, 0x00, 0x1c, 0x2d, 0x00, 0xff, 0xff, 0xf1,
+		0x86, 0x00, 0xff, 0x00, 0x1f, 0x5f, 0x80, 0xff, 0xff, 0xf8, 0x1c, 0x40, 0xff, 0x00, 0x20, 0xac,
+		0x00, 0x8b, 0xff, 0x00, 0x6c, 0x2f, 0x00, 0x8b, 0xff, 0x00, 0x61, 0x56, 0x00, 0xff, 0x00, 0x56,
+		0xfe, 0x80, 0x8b, 0xff, 0x00, 0x97, 0x74, 0xc0, 0x08, 0xff, 0xff, 0x92, 0x98, 0xc0, 0xff, 0x00,
+		0x7f, 0x6b, 0x00, 0x15, 0xff, 0x00, 0x16, 0x43, 0x80, 0xff, 0xff, 0xe2, 0x30, 0x00, 0xff, 0x00,
+		0x0e, 0xb1, 0x80, 0xff, 0xff, 0xd4, 0xe8, 0x40, 0x8b, 0xff, 0xff, 0xc6, 0x80, 0x40, 0x8b, 0xff,
+		0xff, 0x8d, 0x02, 0xc0, 0xff, 0xff, 0xbe, 0x2b, 0x00, 0xff, 0xff, 0xc5, 0xa7, 0xc0, 0xff, 0xff,
+		0xbd, 0x51, 0x00, 0x8b, 0xff, 0xff, 0xea, 0x66, 0x00, 0x8b, 0xff, 0xff, 0xeb, 0x03, 0xc0, 0xff,
+		0x00, 0x06, 0x04, 0xc0, 0xff, 0xff, 0xed, 0x2a, 0x80, 0xff, 0x00, 0x0b, 0x68, 0xc0, 0x08, 0x0e,
+		0xff, 0x00, 0xf3, 0x5d, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x5f, 0x0a, 0xff, 0xfe, 0xf3,
+		0x9b, 0x80, 0xff, 0xff, 0xa0, 0x35, 0x00, 0x15, 0x4c, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0,
+		0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0xfe, 0xdc, 0x4e, 0x40, 0xff, 0xff, 0x37,
+		0xc8, 0xc0, 0x15, 0x4c, 0x0a, 0x0e, 0xff, 0x00, 0x85, 0xc3, 0xc0, 0xff, 0x02, 0x20, 0x8d, 0x80,
+		0x15, 0x61, 0x0a, 0xff, 0xff, 0x49, 0xe8, 0x40, 0xff, 0xff, 0x1b, 0x4e, 0x40, 0x15, 0x4c, 0x0a,
+		0x0e, 0xff, 0x00, 0xd5, 0x2d, 0x40, 0xff, 0x02, 0x66, 0x05, 0xc0, 0x15, 0x62, 0x0a, 0xff, 0x00,
+		0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x40, 0x15, 0x63, 0x0a, 0xff, 0xfe, 0xb8, 0x0f, 0x00,
+		0xff, 0xff, 0x62, 0x7e, 0x00, 0x15, 0x4c, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02,
+		0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0xfe, 0xcb, 0x0b, 0xc0, 0xff, 0xff, 0x37, 0xc8, 0xc0,
+		0x15, 0x4d, 0x0a, 0x0e, 0xff, 0x00, 0x3c, 0x69, 0x00, 0xff, 0x02, 0x98, 0x82, 0x80, 0x15, 0xff,
+		0xfc, 0xc0, 0xee, 0x80, 0xff, 0x00, 0x49, 0x5a, 0xc0, 0xff, 0x00, 0xe2, 0xf8, 0x00, 0x07, 0xff,
+		0x00, 0x1e, 0x7f, 0x80, 0xff, 0xff, 0xd2, 0xd3, 0x80, 0xff, 0x00, 0x33, 0x20, 0x80, 0xff, 0xff,
+		0xe4, 0x8d, 0x80, 0xff, 0x00, 0x37, 0x7e, 0x40, 0x8b, 0x08, 0xff, 0x00, 0x5d, 0x63, 0x80, 0xff,
+		0x00, 0x62, 0x4d, 0xc0, 0xff, 0x00, 0x4e, 0x4a, 0x80, 0xff, 0x00, 0xa7, 0x86, 0x80, 0xff, 0x00,
+		0xa1, 0x3b, 0x40, 0xff, 0xff, 0xa0, 0x7f, 0x80, 0xff, 0x00, 0x48, 0x0b, 0xc0, 0xff, 0xff, 0xa6,
+		0x1e, 0x80, 0x1f, 0xff, 0xff, 0xc5, 0x5d, 0xc0, 0x8b, 0xff, 0xff, 0xc9, 0x61, 0x80, 0xff, 0xff,
+		0xe1, 0xad, 0x40, 0xff, 0xff, 0xe0, 0xf6, 0x80, 0xff, 0xff, 0xce, 0x10, 0x80, 0x08, 0xff, 0x00,
+		0xf5, 0x17, 0x80, 0x07, 0x8b, 0xff, 0x00, 0x0f, 0xff, 0xc0, 0xff, 0x00, 0x07, 0x5d, 0x40, 0xff,
+		0x00, 0x03, 0x2e, 0x80, 0xff, 0xff, 0xff, 0x8a, 0x00, 0xff, 0x00, 0x0d, 0x9d, 0x00, 0x08, 0xff,
+		0x00, 0x6e, 0xfb, 0x40, 0xff, 0xfe, 0xfd, 0x06, 0x00, 0x15, 0x48, 0x0a, 0x0e, 0xff, 0x00, 0xd5,
+		0x2d, 0x40, 0xff, 0x02, 0x66, 0x05, 0xc0, 0x15, 0x62, 0x0a, 0xff, 0x00, 0xb1, 0xc3, 0x80, 0xff,
+		0x00, 0x00, 0x03, 0x40, 0x15, 0x63, 0x0a, 0xff, 0xfe, 0xa6, 0xcc, 0x80, 0xff, 0xff, 0x62, 0x7e,
+		0x00, 0x15, 0x4d, 0x0a, 0x0e, 0xff, 0x00, 0x2c, 0xe0, 0x40, 0xff, 0x01, 0x57, 0x79, 0x40, 0x15,
+		0x25, 0x0a, 0x0e, 0xff, 0x01, 0x31, 0xa2, 0x40, 0xff, 0x02, 0x2a, 0xc4, 0x40, 0x15, 0x22, 0x0a,
+		0x0e, 0xff, 0x00, 0xb6, 0x16, 0x40, 0xff, 0x01, 0xc1, 0xb2, 0x40, 0x15, 0x66, 0x0a, 0x0e, 0xff,
+		0x00, 0xf3, 0x5d, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x5f, 0x0a, 0x0e, 0xff, 0x01, 0x23,
+		0xb1, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0x0e, 0xff, 0x00, 0x85, 0xc3, 0xc0,
+		0xff, 0x02, 0x20, 0x8d, 0x80, 0x15, 0x61, 0x0a, 0x0e, 0xff, 0x00, 0x87, 0x7d, 0xc0, 0xff, 0x02,
+		0x2d, 0x7f, 0x80, 0x15, 0x5c, 0x0a, 0x0e, 0xff, 0x00, 0x7b, 0x68, 0xc0, 0xff, 0x02, 0x6d, 0x5c,
+		0x40, 0x15, 0x55, 0x0a, 0x0e, 0xff, 0x00, 0x89, 0x37, 0x80, 0xff, 0x02, 0x86, 0x63, 0x00, 0x15,
+		0x67, 0x0a, 0x0e, 0xff, 0x00, 0xfe, 0x96, 0x80, 0xff, 0x02, 0x8f, 0xe1, 0x40, 0x15, 0x42, 0x0a,
+		0x0e, 0xff, 0x00, 0xd5, 0x2d, 0x40, 0xff, 0x02, 0x66, 0x05, 0xc0, 0x15, 0x62, 0x0a, 0xff, 0x00,
+		0xb1, 0xc3, 0x80, 0xff, 0x00, 0x00, 0x03, 0x40, 0x15, 0x63, 0x0a, 0x0e, 0xff, 0x00, 0xd6, 0x06,
+		0x40, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0x00, 0x5c, 0x57, 0x40, 0xff, 0x00,
+		0x2a, 0x49, 0x80, 0x15, 0x60, 0x0a, 0x0e, 0xff, 0x01, 0x5b, 0xcb, 0x00, 0xff, 0x02, 0x5c, 0xf6,
+		0x00, 0x15, 0x64, 0x0a, 0xff, 0xff, 0x7b, 0xe2, 0x00, 0xff, 0x00, 0x00, 0xab, 0x80, 0x15, 0x65,
+		0x0a, 0x0e, 0xff, 0x01, 0x05, 0x7d, 0x40, 0x16, 0xff, 0xff, 0xf4, 0xc7, 0xc0, 0xff, 0xff, 0xaa,
+		0x90, 0x40, 0xff, 0x00, 0x1d, 0x57, 0xc0, 0x8b, 0x05, 0xff, 0x00, 0x0b, 0x64, 0x40, 0x8b, 0xff,
+		0x00, 0x0e, 0x6a, 0x00, 0xff, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x00, 0x0a, 0xc4, 0x80, 0xff, 0xff,
+		0xf9, 0x66, 0x80, 0xff, 0x00, 0x07, 0xd6, 0x00, 0xff, 0xff, 0xfb, 0x32, 0xc0, 0xff, 0x00, 0x03,
+		0x0e, 0xc0, 0xff, 0xff, 0xf9, 0x52, 0x40, 0x8b, 0xff, 0xff, 0xfa, 0x1c, 0x40, 0x8b, 0xff, 0xff,
+		0xf7, 0x4b, 0x80, 0xff, 0xff, 0xf9, 0x32, 0x40, 0xff, 0xff, 0xf0, 0x4e, 0x80, 0xff, 0xff, 0xd9,
+		0x1e, 0x40, 0x8b, 0xff, 0xff, 0xe1, 0xc4, 0x40, 0x8b, 0xff, 0xff, 0xda, 0x58, 0x00, 0xff, 0x00,
+		0x0a, 0x0f, 0xc0, 0xff, 0xff, 0xe0, 0x96, 0xc0, 0xff, 0x00, 0x19, 0x54, 0xc0, 0x08, 0xff, 0xff,
+		0xe6, 0xf9, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00, 0x25, 0x5d, 0x40, 0xff, 0xff,
+		0xe5, 0xb9, 0x40, 0xff, 0x00, 0x2a, 0xc8, 0x80, 0xff, 0xff, 0xf5, 0x16, 0x80, 0xff, 0x00, 0x26,
+		0x6b, 0x40, 0x8b, 0xff, 0x00, 0x49, 0x64, 0x80, 0x8b, 0xff, 0x00, 0x23, 0x12, 0x00, 0xff, 0x00,
+		0x26, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x23, 0xb9, 0x80, 0x8b, 0xff, 0x00, 0x13, 0x63, 0x00, 0xff,
+		0xff, 0xf5, 0x8f, 0x40, 0xff, 0x00, 0x11, 0xfa, 0x40, 0xff, 0xff, 0xec, 0xef, 0xc0, 0xff, 0x00,
+		0x09, 0x40, 0x00, 0xff, 0xff, 0xf3, 0x26, 0xc0, 0xff, 0x00, 0x06, 0x3c, 0x40, 0xff, 0xff, 0xf2,
+		0xdf, 0xc0, 0xff, 0x00, 0x00, 0xcf, 0x40, 0xff, 0xff, 0xf3, 0x3d, 0xc0, 0xff, 0x00, 0x00, 0xac,
+		0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x40, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x00, 0x05, 0x2d,
+		0x80, 0xff, 0x00, 0x2f, 0x77, 0x00, 0x05, 0x0e, 0xff, 0x01, 0x63, 0x8e, 0x40, 0x16, 0xff, 0xff,
+		0xcc, 0x30, 0x00, 0xff, 0xff, 0xd5, 0x41, 0x80, 0xff, 0xff, 0xe4, 0x76, 0x00, 0xff, 0xff, 0xd8,
+		0x1a, 0x00, 0x8b, 0xff, 0xff, 0xdf, 0xc8, 0x40, 0x8b, 0xff, 0xff, 0xde, 0xa5, 0x00, 0xff, 0x00,
+		0x1a, 0x96, 0x40, 0xff, 0xff, 0xe4, 0x29, 0x80, 0xff, 0x00, 0x33, 0xd1, 0x00, 0x8b, 0xff, 0x00,
+		0x18, 0xda, 0x80, 0x8b, 0xff, 0x00, 0x18, 0xaa, 0x40, 0xff, 0x00, 0x06, 0x4f, 0x80, 0xff, 0x00,
+		0x13, 0x9b, 0x80, 0xff, 0x00, 0x10, 0xfe, 0x00, 0x08, 0xff, 0x00, 0x2d, 0xbd, 0x40, 0x07, 0xff,
+		0xff, 0xf9, 0xa4, 0x80, 0xff, 0xff, 0xfa, 0xb9, 0xc0, 0xff, 0xff, 0xf5, 0xec, 0x40, 0xff, 0xff,
+		0xf9, 0x1e, 0x00, 0xff, 0xff, 0xf0, 0x61, 0x40, 0xff, 0xff, 0xfa, 0x4f, 0xc0, 0xff, 0xff, 0xf5,
+		0x7d, 0x00, 0xff, 0xff, 0xfc, 0x2c, 0x00, 0xff, 0xff, 0xf8, 0xa1, 0x80, 0xff, 0xff, 0xfe, 0x8c,
+		0x40, 0xff, 0xff, 0xf9, 0xcb, 0x80, 0x8b, 0xff, 0xff, 0xed, 0xca, 0xc0, 0x8b, 0xff, 0xff, 0xf4,
+		0xf3, 0xc0, 0xff, 0x00, 0x0d, 0x14, 0xc0, 0x8b, 0xff, 0x00, 0x0f, 0x5c, 0x00, 0x8b, 0xff, 0x00,
+		0x0e, 0xca, 0x00, 0xff, 0x00, 0x09, 0xce, 0xc0, 0xff, 0x00, 0x0b, 0xdb, 0x80, 0xff, 0x00, 0x07,
+		0x07, 0x40, 0xff, 0x00, 0x07, 0xf6, 0x00, 0xff, 0x00, 0x08, 0x7e, 0x00, 0xff, 0x00, 0x09, 0x9e,
+		0x00, 0xff, 0x00, 0x18, 0xb8, 0xc0, 0xff, 0x00, 0x1b, 0x46, 0x40, 0xff, 0x00, 0x21, 0x9e, 0xc0,
+		0xff, 0x00, 0x1e, 0x32, 0xc0, 0x08, 0x0e, 0xff, 0x01, 0x79, 0x21, 0xc0, 0xff, 0x02, 0x92, 0x78,
+		0x40, 0x15, 0x50, 0x0a, 0x0e, 0xff, 0x00, 0x6a, 0x26, 0x40, 0xff, 0x01, 0xc9, 0x63, 0xc0, 0x15,
+		0x41, 0x0a, 0x0e, 0xff, 0x00, 0x90, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0xdc, 0x00, 0x15, 0x54, 0x0a,
+		0x0e, 0xff, 0x01, 0x56, 0x9c, 0x80, 0xff, 0x00, 0xfc, 0xdc, 0x00, 0x15, 0x56, 0x0a, 0x0e, 0xff,
+		0x00, 0x71, 0xea, 0x80, 0xff, 0x02, 0x38, 0xb7, 0x80, 0x15, 0x5b, 0x0a, 0x0e, 0xff, 0x01, 0x86,
+		0x13, 0x80, 0xff, 0x02, 0x77, 0xb7, 0x80, 0x15, 0xff, 0xff, 0xe3, 0x85, 0x80, 0xff, 0x00, 0x21,
+		0xa8, 0x00, 0xff, 0xff, 0x90, 0xac, 0x40, 0xff, 0xff, 0xbb, 0xd2, 0x80, 0xff, 0xff, 0x98, 0x70,
+		0x80, 0xff, 0x00, 0x46, 0xc4, 0x80, 0xff, 0xff, 0xdf, 0x34, 0xc0, 0xff, 0xff, 0xda, 0x07, 0x00,
+		0xff, 0x00, 0x7b, 0x68, 0xc0, 0xff, 0xff, 0x9e, 0x7b, 0x00, 0xff, 0x00, 0x15, 0x93, 0x40, 0x8b,
+		0x05, 0x0e, 0xff, 0x00, 0xcf, 0x1e, 0xc0, 0xff, 0x02, 0xa0, 0x47, 0x00, 0x15, 0x59, 0x0a, 0x0e,
+		0xff, 0x01, 0x45, 0x59, 0xc0, 0xff, 0x02, 0xa0, 0x47, 0x00, 0x15, 0x5a, 0x0a, 0x0e, 0xff, 0x00,
+		0x7b, 0x68, 0xc0, 0xff, 0x02, 0x6d, 0x5c, 0x40, 0x15, 0x55, 0x0a, 0xff, 0x00, 0x52, 0xf2, 0x40,
+		0xff, 0xfe, 0x75, 0x02, 0x00, 0x15, 0x46, 0x0a, 0xff, 0xff, 0x2f, 0xb5, 0xc0, 0xff, 0x00, 0xb3,
+		0x54, 0x80, 0x15, 0x47, 0x0a, 0x0e, 0xff, 0x00, 0x44, 0x17, 0x40, 0xff, 0x01, 0xeb, 0xd3, 0x00,
+		0x15, 0xff, 0x00, 0x38, 0x82, 0x40, 0xff, 0xff, 0xc7, 0x7d, 0x80, 0x05, 0xff, 0xff, 0xed, 0xb8,
+		0xc0, 0xff, 0xff, 0xe6, 0x87, 0x40, 0xff, 0xff, 0xf5, 0x36, 0x80, 0xff, 0xff, 0xe0, 0xd5, 0x80,
+		0x8b, 0xff, 0xff, 0xde, 0x70, 0x00, 0x8b, 0xff, 0xff, 0xde, 0xb3, 0xc0, 0xff, 0x00, 0x0a, 0x9e,
+		0x00, 0xff, 0xff, 0xe1, 0x0f, 0xc0, 0xff, 0x00, 0x12, 0x04, 0x80, 0xff, 0xff, 0xe6, 0xa3, 0xc0,
+		0x08, 0xff, 0xff, 0xc7, 0xec, 0x00, 0xff, 0xff, 0xc7, 0xec, 0x00, 0xff, 0x00, 0x23, 0x8e, 0x00,
+		0xff, 0xff, 0xdc, 0x71, 0xc0, 0xff, 0x00, 0x37, 0xd3, 0xc0, 0xff, 0x00, 0x37, 0xd3, 0x80, 0x05,
+		0xff, 0x00, 0x19, 0xb0, 0xc0, 0xff, 0xff, 0xed, 0x31, 0x80, 0xff, 0x00, 0x1f, 0x9e, 0x80, 0xff,
+		0xff, 0xf4, 0xdf, 0x00, 0xff, 0x00, 0x22, 0x17, 0x80, 0x8b, 0xff, 0x00, 0x21, 0x90, 0x00, 0x8b,
+		0xff, 0x00, 0x1f, 0x2a, 0x80, 0xff, 0x00, 0x0a, 0xc9, 0x80, 0xff, 0x00, 0x19, 0x78, 0xc0, 0xff,
+		0x00, 0x12, 0x47, 0x40, 0x08, 0xff, 0x00, 0x36, 0xf5, 0x00, 0xff, 0xff, 0xc9, 0x0b, 0x40, 0xff,
+		0x00, 0x23, 0x8e, 0x00, 0xff, 0x00, 0x23, 0x8e, 0x40, 0xff, 0xff, 0xc9, 0x20, 0xc0, 0xff, 0x00,
+		0x36, 0xdf, 0x40, 0x05, 0xff, 0x00, 0x12, 0x8a, 0xc0, 0xff, 0x00, 0x19, 0x95, 0x40, 0xff, 0x00,
+		0x0a, 0xf5, 0x40, 0xff, 0x00, 0x1f, 0x64, 0x80, 0x8b, 0xff, 0x00, 0x21, 0xd3, 0xc0, 0x8b, 0xff,
+		0x00, 0x22, 0x17, 0x80, 0xff, 0xff, 0xf4, 0xde, 0xc0, 0xff, 0x00, 0x1f, 0x9e, 0x40, 0xff, 0xff,
+		0xed, 0x31, 0x80, 0xff, 0x00, 0x19, 0xb0, 0xc0, 0x08, 0xff, 0x00, 0x37, 0x4f, 0x00, 0xff, 0x00,
+		0x37, 0x4f, 0x40, 0xff, 0xff, 0xdc, 0x72, 0x00, 0xff, 0x00, 0x23, 0x8e, 0x00, 0xff, 0xff, 0xc8,
+		0x70, 0x80, 0xff, 0xff, 0xc8, 0x70, 0x80, 0x05, 0xff, 0xff, 0xe6, 0xa3, 0x80, 0xff, 0x00, 0x12,
+		0x04, 0x80, 0xff, 0xff, 0xe1, 0x10, 0x00, 0xff, 0x00, 0x0a, 0x9e, 0x40, 0xff, 0xff, 0xde, 0xb3,
+		0xc0, 0x8b, 0xff, 0xff, 0xde, 0x2c, 0x40, 0x8b, 0xff, 0xff, 0xe0, 0x9b, 0x80, 0xff, 0xff, 0xf5,
+		0x0a, 0x80, 0xff, 0xff, 0xe6, 0x6b, 0x00, 0xff, 0xff, 0xed, 0x75, 0x40, 0x08, 0xff, 0xff, 0xc7,
+		0x92, 0xc0, 0xff, 0x00, 0x38, 0x6d, 0x00, 0x05, 0xff, 0x00, 0x93, 0x3a, 0x80, 0xff, 0xff, 0xae,
+		0x24, 0xc0, 0x15, 0xff, 0x00, 0x37, 0x3a, 0x00, 0xff, 0x00, 0x2d, 0x2e, 0xc0, 0xff, 0xff, 0xd2,
+		0xd1, 0x00, 0xff, 0xff, 0xc8, 0xc6, 0x80, 0xff, 0xff, 0xc8, 0xc6, 0x00, 0xff, 0xff, 0xd2, 0xd1,
+		0x40, 0xff, 0xff, 0xd2, 0xd1, 0x80, 0xff, 0xff, 0xc8, 0xc6, 0x00, 0xff, 0xff, 0xc8, 0xc6, 0x80,
+		0xff, 0xff, 0xd2, 0xd1, 0x00, 0xff, 0x00, 0x2d, 0x2e, 0x80, 0xff, 0x00, 0x37, 0x3a, 0x00, 0xff,
+		0x00, 0x37, 0x39, 0x80, 0xff, 0x00, 0x2d, 0x2f, 0x00, 0xff, 0x00, 0x2d, 0x2f, 0x00, 0xff, 0x00,
+		0x37, 0x39, 0x80, 0x1f, 0x0e, 0xff, 0x00, 0xd8, 0x9d, 0x00, 0xff, 0x02, 0x8c, 0x6d, 0x80, 0x15,
+		0xff, 0xfe, 0x9a, 0xb8, 0x00, 0xff, 0x00, 0x43, 0x50, 0x40, 0xff, 0x01, 0x65, 0x48, 0x00, 0x07,
+		0xff, 0xfc, 0xdc, 0x8c, 0x00, 0x04, 0xff, 0x01, 0x5a, 0xed, 0x40, 0xff, 0xff, 0xbc, 0xaf, 0xc0,
+		0xff, 0xfe, 0xa5, 0x12, 0xc0, 0x07, 0x0e, 0xff, 0x00, 0x4b, 0xf1, 0xc0, 0xff, 0xff, 0xef, 0x9a,
+		0x40, 0x15, 0x68, 0x0a, 0xff, 0x00, 0x06, 0x8f, 0x00, 0xff, 0xfe, 0x59, 0x0b, 0x40, 0x15, 0x69,
+		0x0a, 0xff, 0xff, 0xd3, 0x1f, 0xc0, 0xff, 0xff, 0xb1, 0xfc, 0x40, 0x15, 0x6a, 0x0a, 0xff, 0xff,
+		0x71, 0x6e, 0xc0, 0xff, 0x02, 0x77, 0xf9, 0x80, 0x15, 0x6b, 0x0a, 0x0e, 0xff, 0x00, 0x4b, 0xf1,
+		0xc0, 0xff, 0xff, 0xef, 0x9a, 0x40, 0x15, 0x68, 0x0a, 0xff, 0xff, 0x81, 0x92, 0x00, 0xff, 0xfe,
+		0x0f, 0x8a, 0x40, 0x15, 0xff, 0x00, 0x25, 0x48, 0x00, 0xff, 0xff, 0xe7, 0x25, 0x80, 0x05, 0xff,
+		0x00, 0x03, 0xf7, 0x80, 0xff, 0x00, 0x07, 0x87, 0x40, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xff, 0x00,
+		0x03, 0x92, 0x00, 0xff, 0x00, 0x04, 0x50, 0x80, 0xff, 0x00, 0x05, 0x75, 0x40, 0xff, 0x00, 0x0e,
+		0x11, 0x80, 0xff, 0x00, 0x11, 0xcc, 0x40, 0xff, 0x00, 0x1a, 0x1c, 0xc0, 0xff, 0x00, 0x0f, 0xfc,
+		0xc0, 0xff, 0x00, 0x1e, 0xb9, 0xc0, 0x8b, 0xff, 0x00, 0x26, 0x3f, 0x80, 0x8b, 0xff, 0x00, 0x15,
+		0xfb, 0x00, 0xff, 0xff, 0xe8, 0x89, 0x40, 0x8b, 0xff, 0xff, 0xe6, 0x9e, 0x00, 0x8b, 0xff, 0xff,
+		0xe7, 0xef, 0x80, 0xff, 0xff, 0xed, 0xf7, 0x80, 0xff, 0xff, 0xec, 0xb0, 0x40, 0xff, 0xff, 0xe8,
+		0xc9, 0x80, 0xff, 0xff, 0xed, 0x1f, 0x40, 0xff, 0xff, 0xe8, 0x0a, 0x80, 0xff, 0xff, 0xec, 0x84,
+		0xc0, 0xff, 0xff, 0xc5, 0x3c, 0xc0, 0xff, 0xff, 0xd8, 0xfd, 0xc0, 0xff, 0xff, 0xd3, 0x6e, 0x80,
+		0xff, 0xff, 0xc2, 0x5d, 0x40, 0x08, 0xff, 0xff, 0xdc, 0xca, 0x00, 0xff, 0x00, 0xdf, 0xb0, 0x80,
+		0xff, 0x00, 0x32, 0x66, 0x40, 0x07, 0xff, 0xff, 0xfa, 0xce, 0xc0, 0xff, 0x00, 0x01, 0xb9, 0x00,
+		0xff, 0xff, 0xfc, 0x14, 0x40, 0xff, 0xff, 0xfc, 0x1e, 0x00, 0xff, 0xff, 0xfe, 0x56, 0x40, 0xff,
+		0xff, 0xfe, 0x90, 0xc0, 0xff, 0xff, 0xfc, 0xc1, 0x80, 0xff, 0xff, 0xfd, 0x33, 0xc0, 0xff, 0xff,
+		0xfe, 0x56, 0x80, 0xff, 0xff, 0xff, 0x7d, 0x40, 0xff, 0xff, 0xfc, 0x5a, 0x00, 0x8b, 0x08, 0xff,
+		0xff, 0x6e, 0x53, 0x40, 0x06, 0xff, 0x00, 0x2c, 0xb2, 0xc0, 0xff, 0x00, 0x31, 0xf3, 0x40, 0xff,
+		0x00, 0x2c, 0x3c, 0xc0, 0xff, 0x00, 0x14, 0xc2, 0x00, 0xff, 0x00, 0x1f, 0xc6, 0x40, 0xff, 0x00,
+		0x1d, 0x48, 0xc0, 0xff, 0x00, 0x0b, 0x5d, 0x40, 0xff, 0x00, 0x0a, 0x79, 0x40, 0xff, 0x00, 0x1a,
+		0x07, 0x40, 0xff, 0x00, 0x1a, 0x06, 0xc0, 0x8b, 0xff, 0x00, 0x25, 0xe0, 0x00, 0x8b, 0xff, 0x00,
+		0x30, 0x79, 0x00, 0xff, 0xff, 0xd4, 0xbc, 0x80, 0xff, 0x00, 0x29, 0x17, 0x40, 0xff, 0xff, 0xc0,
+		0x51, 0x40, 0x8b, 0xff, 0xff, 0xcf, 0x7c, 0x80, 0x8b, 0xff, 0xff, 0xd3, 0x16, 0x80, 0xff, 0xff,
+		0xe7, 0x48, 0x80, 0xff, 0xff, 0xe7, 0xfd, 0xc0, 0xff, 0xff, 0xd6, 0x3d, 0x40, 0x08, 0xff, 0xff,
+		0x8a, 0xb8, 0x00, 0xff, 0x01, 0xfd, 0x67, 0xc0, 0x15, 0x6b, 0x0a, 0x0e, 0xff, 0x00, 0x51, 0x1f,
+		0x40, 0xff, 0xff, 0xef, 0x9a, 0x40, 0x15, 0x68, 0x0a, 0xff, 0xfe, 0xf5, 0x31, 0x40, 0xff, 0x00,
+		0x13, 0x3e, 0x80, 0x15, 0xff, 0xff, 0xd7, 0xba, 0xc0, 0x8b, 0xff, 0xff, 0xd9, 0x24, 0x00, 0xff,
+		0xff, 0xed, 0xfb, 0xc0, 0xff, 0xff, 0xe5, 0x1f, 0x40, 0xff, 0xff, 0xe0, 0x3b, 0x40, 0x08, 0xff,
+		0x00, 0x1c, 0xff, 0x00, 0xff, 0xff, 0xe2, 0x50, 0x00, 0x05, 0xff, 0x00, 0x13, 0x36, 0x40, 0xff,
+		0x00, 0x18, 0x02, 0x80, 0xff, 0x00, 0x1c, 0x52, 0x80, 0xff, 0x00, 0x0d, 0x4c, 0x40, 0xff, 0x00,
+		0x1b, 0x0e, 0xc0, 0x8b, 0x08, 0xff, 0x00, 0x23, 0xfb, 0xc0, 0xff, 0x00, 0x17, 0xbc, 0x80, 0xff,
+		0xff, 0xe8, 0x9e, 0x80, 0xff, 0xff, 0xe8, 0x10, 0x40, 0xff, 0xff, 0xed, 0xa1, 0xc0, 0xff, 0xff,
+		0xf1, 0xbe, 0x00, 0xff, 0xff, 0xe9, 0x37, 0x00, 0xff, 0xff, 0xcb, 0x96, 0x40, 0x1f, 0xff, 0xff,
+		0xfa, 0xb4, 0x00, 0x8b, 0xff, 0xff, 0xfa, 0xb5, 0x40, 0xff, 0x00, 0x00, 0x42, 0x80, 0xff, 0xff,
+		0xfa, 0xba, 0xc0, 0xff, 0x00, 0x00, 0x81, 0x00, 0x08, 0xff, 0xff, 0xd7, 0xf5, 0x00, 0x07, 0xff,
+		0x00, 0x07, 0xb8, 0x40, 0xff, 0x00, 0x00, 0xf1, 0xc0, 0xff, 0x00, 0x07, 0xe6, 0xc0, 0xff, 0x00,
+		0x00, 0x81, 0x80, 0xff, 0x00, 0x08, 0x4a, 0x80, 0x8b, 0x08, 0xff, 0x00, 0x3d, 0x3b, 0x40, 0xff,
+		0x00, 0x09, 0x10, 0x80, 0xff, 0xff, 0xe2, 0x77, 0x80, 0xff, 0xff, 0xf1, 0x48, 0xc0, 0xff, 0xff,
+		0xe3, 0x87, 0x00, 0xff, 0xff, 0xe0, 0x8a, 0xc0, 0xff, 0xff, 0xe8, 0xad, 0x80, 0xff, 0xff, 0xd8,
+		0xc7, 0x00, 0x1f, 0xff, 0xff, 0xda, 0x21, 0x00, 0x8b, 0xff, 0xff, 0xe7, 0xdb, 0xc0, 0xff, 0x00,
+		0x15, 0xef, 0x00, 0xff, 0xff, 0xfb, 0xc9, 0x40, 0xff, 0x00, 0x04, 0x1d, 0x00, 0xff, 0xff, 0xf8,
+		0x8c, 0x80, 0xff, 0x00, 0x07, 0x45, 0x80, 0xff, 0x00, 0x03, 0x59, 0x40, 0xff, 0x00, 0x07, 0x87,
+		0xc0, 0xff, 0xff, 0xf8, 0xf3, 0x40, 0xff, 0x00, 0x07, 0x7d, 0x00, 0x08, 0xff, 0xff, 0xda, 0xb8,
+		0x00, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00, 0x1c, 0xb8, 0x00, 0xff, 0xff, 0xdf, 0x2f,
+		0x80, 0xff, 0x00, 0x29, 0x7e, 0x40, 0xff, 0xff, 0xed, 0x07, 0x40, 0xff, 0x00, 0x2b, 0xa3, 0x00,
+		0x8b, 0xff, 0x00, 0x3f, 0xcc, 0xc0, 0x8b, 0xff, 0x00, 0x39, 0x16, 0x80, 0xff, 0x00, 0x28, 0x02,
+		0x80, 0x8b, 0xff, 0x00, 0x34, 0x48, 0x00, 0x8b, 0xff, 0x00, 0x21, 0xa8, 0xc0, 0xff, 0xff, 0xe7,
+		0x2f, 0xc0, 0xff, 0x00, 0x1c, 0xee, 0xc0, 0xff, 0xff, 0xde, 0x21, 0x00, 0xff, 0x00, 0x05, 0xfc,
+		0x80, 0xff, 0x00, 0x1a, 0x87, 0xc0, 0xff, 0x00, 0x08, 0x72, 0x80, 0xff, 0x00, 0x12, 0x7d, 0x40,
+		0xff, 0x00, 0x18, 0xcc, 0x00, 0x8b, 0xff, 0x00, 0x1d, 0x45, 0x80, 0x8b, 0xff, 0x00, 0x2e, 0x0c,
+		0x40, 0xff, 0xff, 0xd2, 0xe6, 0x40, 0xff, 0x00, 0x27, 0xf3, 0x00, 0xff, 0xff, 0xc4, 0x64, 0x80,
+		0x8b, 0x08, 0xff, 0x01, 0x0c, 0x30, 0x40, 0xff, 0xfe, 0x45, 0xcc, 0xc0, 0x15, 0x69, 0x0a, 0xff,
+		0xff, 0xd3, 0x1f, 0xc0, 0xff, 0xff, 0xb1, 0xfc, 0x40, 0x15, 0x6a, 0x0a, 0x0e, 0xff, 0x01, 0x46,
+		0x36, 0xc0, 0xff, 0x00, 0xec, 0x76, 0x40, 0x15, 0x27, 0x0a, 0xff, 0xff, 0x20, 0x7b, 0x80, 0xff,
+		0xfe, 0x25, 0x59, 0x80, 0x15, 0xff, 0x00, 0x45, 0x0a, 0x40, 0x8b, 0xff, 0x00, 0x3c, 0x69, 0x00,
+		0xff, 0x00, 0xb6, 0xf4, 0xc0, 0xff, 0x00, 0xc5, 0xa0, 0x80, 0x8b, 0xff, 0x00, 0x45, 0x0a, 0x40,
+		0xff, 0xff, 0x49, 0xe8, 0x40, 0xff, 0x00, 0x06, 0xe7, 0x80, 0x8b, 0x05, 0xff, 0xff, 0xcc, 0x2f,
+		0xc0, 0xff, 0xff, 0xd5, 0x41, 0x80, 0xff, 0xff, 0xe4, 0x76, 0x00, 0xff, 0xff, 0xd8, 0x1a, 0x00,
+		0x8b, 0xff, 0xff, 0xdf, 0xc8, 0x40, 0x8b, 0xff, 0xff, 0xde, 0xa5, 0x00, 0xff, 0x00, 0x1a, 0x96,
+		0x40, 0xff, 0xff, 0xe4, 0x29, 0x80, 0xff, 0x00, 0x33, 0xd1, 0x00, 0x8b, 0xff, 0x00, 0x18, 0xda,
+		0xc0, 0x8b, 0xff, 0x00, 0x18, 0xaa, 0x00, 0xff, 0x00, 0x06, 0x4f, 0x80, 0xff, 0x00, 0x13, 0x9b,
+		0x80, 0xff, 0x00, 0x10, 0xfe, 0x00, 0x08, 0xff, 0x00, 0x2d, 0xbd, 0x40, 0x07, 0xff, 0xff, 0xf9,
+		0xa4, 0x80, 0xff, 0xff, 0xfa, 0xb9, 0xc0, 0xff, 0xff, 0xf5, 0xec, 0x40, 0xff, 0xff, 0xf9, 0x1e,
+		0x00, 0xff, 0xff, 0xf0, 0x61, 0x80, 0xff, 0xff, 0xfa, 0x4f, 0xc0, 0xff, 0xff, 0xf5, 0x7c, 0xc0,
+		0xff, 0xff, 0xfc, 0x2c, 0x00, 0xff, 0xff, 0xf8, 0xa1, 0x80, 0xff, 0xff, 0xfe, 0x8c, 0x40, 0xff,
+		0xff, 0xf9, 0xcb, 0x80, 0x8b, 0xff, 0xff, 0xed, 0xca, 0xc0, 0x8b, 0xff, 0xff, 0xf4, 0xf4, 0x00,
+		0xff, 0x00, 0x0d, 0x14, 0xc0, 0x8b, 0xff, 0x00, 0x0f, 0x5c, 0x00, 0x8b, 0xff, 0x00, 0x0e, 0xca,
+		0x00, 0xff, 0x00, 0x09, 0xce, 0x80, 0xff, 0x00, 0x0b, 0xdb, 0x80, 0xff, 0x00, 0x07, 0x07, 0x40,
+		0xff, 0x00, 0x07, 0xf6, 0x00, 0xff, 0x00, 0x08, 0x7e, 0x00, 0xff, 0x00, 0x09, 0x9e, 0x00, 0xff,
+		0x00, 0x18, 0xb8, 0xc0, 0xff, 0x00, 0x1b, 0x46, 0x40, 0xff, 0x00, 0x21, 0x9e, 0xc0, 0xff, 0x00,
+		0x1e, 0x32, 0xc0, 0x08, 0xff, 0xff, 0xff, 0x23, 0x40, 0x8b, 0xff, 0xff, 0x0f, 0x39, 0x00, 0xff,
+		0x02, 0x7a, 0x4e, 0x00, 0xff, 0xff, 0xf8, 0x3b, 0xc0, 0x8b, 0x05, 0x0e, 0xff, 0x00, 0x49, 0x5b,
+		0x00, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0x8b, 0xff, 0xfe, 0xc1, 0xb4, 0xc0, 0xff, 0xff, 0xca,
+		0x7e, 0x40, 0xff, 0xff, 0xee, 0x96, 0x40, 0x8b, 0xff, 0xff, 0xc2, 0xba, 0x40, 0xff, 0x00, 0x35,
+		0x81, 0xc0, 0xff, 0x00, 0x11, 0x28, 0x00, 0x8b, 0xff, 0xff, 0x0b, 0xdf, 0xc0, 0xff, 0x01, 0x74,
+		0xd0, 0xc0, 0x8b, 0x8b, 0xff, 0x00, 0x3c, 0x69, 0x00, 0xff, 0xfe, 0xd3, 0xad, 0x00, 0x8b, 0x8b,
+		0xff, 0x00, 0xce, 0xf6, 0x00, 0xff, 0x00, 0xbf, 0x96, 0x00, 0xff, 0x00, 0x3d, 0x6e, 0xc0, 0x8b,
+		0xff, 0x00, 0x3f, 0xdc, 0x80, 0x05, 0xff, 0xff, 0xf6, 0xca, 0x80, 0xff, 0xff, 0xfb, 0xd8, 0x80,
+		0xff, 0xff, 0xf8, 0x24, 0x40, 0xff, 0xff, 0xfd, 0x88, 0x80, 0xff, 0xff, 0xf7, 0x2d, 0x80, 0xff,
+		0xff, 0xfd, 0x20, 0xc0, 0x08, 0xff, 0xff, 0x5a, 0x4d, 0xc0, 0xff, 0xff, 0xca, 0x13, 0x40, 0x8b,
+		0xff, 0x01, 0x05, 0x0b, 0x80, 0x05, 0x8b, 0xff, 0x00, 0x0f, 0xe8, 0x00, 0xff, 0x00, 0x08, 0xda,
+		0x00, 0xff, 0x00, 0x02, 0x0f, 0x80, 0x8b, 0xff, 0x00, 0x0c, 0xbb, 0x80, 0x8b, 0xff, 0x00, 0x00,
+		0xfd, 0xc0, 0xff, 0xff, 0xff, 0xed, 0x40, 0xff, 0x00, 0x00, 0xfd, 0x00, 0xff, 0xff, 0xff, 0xda,
+		0x00, 0xff, 0x00, 0x00, 0xfa, 0x80, 0x08, 0x0e, 0xff, 0x01, 0xa6, 0xba, 0xc0, 0xff, 0x02, 0x31,
+		0x85, 0x40, 0x15, 0xff, 0x00, 0x28, 0xf0, 0x80, 0xff, 0xff, 0xe4, 0xe4, 0x00, 0xff, 0x00, 0x19,
+		0x67, 0x80, 0xff, 0xff, 0xe3, 0x8b, 0x80, 0xff, 0xff, 0xe5, 0xac, 0x00, 0xff, 0xff, 0xec, 0x47,
+		0x80, 0xff, 0xff, 0xea, 0x8a, 0xc0, 0xff, 0xff, 0xe7, 0xd6, 0x80, 0x1e, 0x8b, 0xff, 0xff, 0xea,
+		0x7d, 0x40, 0xff, 0x00, 0x0f, 0x3d, 0x80, 0xff, 0xff, 0xf6, 0xcd, 0x40, 0xff, 0x00, 0x07, 0x11,
+		0x40, 0xff, 0xff, 0xfb, 0x4c, 0x80, 0xff, 0x00, 0x06, 0xf3, 0x40, 0xff, 0xff, 0xfb, 0x60, 0x80,
+		0xff, 0x00, 0x0b, 0xca, 0x40, 0xff, 0xff, 0xf8, 0xa2, 0x40, 0x8b, 0xff, 0xff, 0xef, 0x87, 0xc0,
+		0x8b, 0xff, 0xff, 0xf2, 0xc3, 0x00, 0xff, 0xff, 0xf8, 0x0f, 0x80, 0xff, 0xff, 0xf2, 0x53, 0xc0,
+		0xff, 0xff, 0xfc, 0x17, 0xc0, 0xff, 0xff, 0xf9, 0x95, 0x00, 0xff, 0xff, 0xf8, 0x2f, 0xc0, 0xff,
+		0xff, 0xf3, 0x29, 0x40, 0xff, 0xff, 0xf2, 0x8f, 0x00, 0xff, 0xff, 0xec, 0x88, 0x80, 0xff, 0xff,
+		0xed, 0x06, 0xc0, 0xff, 0xff, 0xee, 0x8d, 0x00, 0x08, 0xff, 0x00, 0x1b, 0x9d, 0x80, 0xff, 0xff,
+		0xe7, 0xd6, 0x00, 0x05, 0xff, 0x00, 0x37, 0xb8, 0x40, 0xff, 0x00, 0x38, 0x92, 0xc0, 0xff, 0x00,
+		0x1d, 0x4e, 0x40, 0xff, 0x00, 0x34, 0x2b, 0x40, 0x8b, 0xff, 0x00, 0x29, 0xa6, 0xc0, 0x08, 0xff,
+		0xfe, 0x9b, 0xb8, 0xc0, 0xff, 0x00, 0x3d, 0x90, 0xc0, 0x15, 0x2e, 0x0a, 0x0e, 0xff, 0x01, 0x34,
+		0x17, 0x40, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff, 0x00, 0x57, 0x29, 0xc0, 0xff,
+		0xff, 0x53, 0x66, 0x80, 0x15, 0x34, 0x0a, 0x0e, 0xff, 0x01, 0xb2, 0xf3, 0xc0, 0xff, 0x02, 0x24,
+		0xde, 0x40, 0x15, 0xff, 0xff, 0xd5, 0xcd, 0x00, 0xff, 0x00, 0x32, 0x23, 0x80, 0xff, 0xff, 0xc1,
+		0x50, 0xc0, 0xff, 0x00, 0x1b, 0x89, 0xc0, 0xff, 0xff, 0xbc, 0x13, 0xc0, 0x8b, 0xff, 0xff, 0x8f,
+		0x77, 0x80, 0x8b, 0xff, 0xff, 0xb2, 0xb5, 0x00, 0xff, 0xff, 0xb5, 0x8f, 0x00, 0x8b, 0xff, 0xff,
+		0xaa, 0xc8, 0x80, 0x8b, 0xff, 0xff, 0xdb, 0xab, 0x40, 0xff, 0x00, 0x0e, 0x42, 0x80, 0xff, 0xff,
+		0xd1, 0x28, 0x40, 0xff, 0x00, 0x33, 0xf3, 0xc0, 0xff, 0xff, 0xd9, 0xa3, 0xc0, 0xff, 0x00, 0x39,
+		0xb7, 0x40, 0xff, 0xff, 0xd5, 0x62, 0x80, 0xff, 0x00, 0x59, 0xf0, 0x80, 0xff, 0xff, 0xea, 0x70,
+		0x40, 0xff, 0x00, 0x2f, 0x17, 0x80, 0xff, 0xff, 0xe2, 0x7c, 0x40, 0xff, 0x00, 0x28, 0xde, 0x00,
+		0xff, 0xff, 0xe6, 0x62, 0x80, 0xff, 0x00, 0x0b, 0x69, 0x40, 0xff, 0xff, 0xdf, 0x74, 0x40, 0x8b,
+		0xff, 0xff, 0xe4, 0x22, 0x80, 0x8b, 0xff, 0xff, 0xc9, 0xc9, 0x40, 0xff, 0xff, 0xd2, 0x65, 0xc0,
+		0xff, 0xff, 0xc5, 0x2d, 0xc0, 0xff, 0xff, 0xa5, 0x8a, 0x00, 0x8b, 0x08, 0xff, 0xff, 0xbb, 0x99,
+		0xc0, 0x8b, 0xff, 0xff, 0xcb, 0x52, 0x80, 0xff, 0x00, 0x21, 0x73, 0xc0, 0xff, 0xff, 0xe4, 0x23,
+		0xc0, 0xff, 0x00, 0x23, 0x48, 0xc0, 0xff, 0xff, 0xfc, 0xdf, 0x00, 0xff, 0x00, 0x03, 0xf6, 0x40,
+		0xff, 0x00, 0x00, 0x42, 0x40, 0xff, 0x00, 0x02, 0x87, 0x40, 0xff, 0x00, 0x00, 0x0e, 0x80, 0xff,
+		0x00, 0x04, 0x20, 0x40, 0xff, 0x00, 0x00, 0x05, 0xc0, 0xff, 0x00, 0x01, 0xa6, 0x80, 0xff, 0x00,
+		0x00, 0x38, 0x80, 0xff, 0x00, 0x05, 0x80, 0xc0, 0xff, 0xff, 0xfb, 0x38, 0x00, 0xff, 0x00, 0x02,
+		0x6d, 0x40, 0x08, 0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0xff, 0xb8, 0x5f, 0x00, 0x05, 0xff, 0x00,
+		0x2c, 0xe3, 0xc0, 0xff, 0xff, 0xcf, 0x1d, 0x40, 0xff, 0x00, 0x3e, 0x55, 0xc0, 0xff, 0xff, 0xe5,
+		0x46, 0xc0, 0xff, 0x00, 0x45, 0x42, 0xc0, 0xff, 0xff, 0xfb, 0xdc, 0x40, 0x08, 0xff, 0xff, 0xf6,
+		0x12, 0xc0, 0xff, 0xff, 0xb4, 0x68, 0xc0, 0xff, 0x00, 0x1d, 0x57, 0x80, 0x8b, 0x05, 0xff, 0x00,
+		0x0b, 0x64, 0x80, 0x8b, 0xff, 0x00, 0x0e, 0x69, 0xc0, 0xff, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x00,
+		0x0a, 0xc4, 0xc0, 0xff, 0xff, 0xf9, 0x66, 0x80, 0xff, 0x00, 0x07, 0xd6, 0x00, 0xff, 0xff, 0xfb,
+		0x32, 0xc0, 0xff, 0x00, 0x03, 0x0e, 0x80, 0xff, 0xff, 0xf9, 0x52, 0x40, 0x8b, 0xff, 0xff, 0xfa,
+		0x1c, 0x40, 0x8b, 0xff, 0xff, 0xf7, 0x4b, 0x80, 0xff, 0xff, 0xf9, 0x32, 0x40, 0xff, 0xff, 0xf0,
+		0x4e, 0x80, 0xff, 0xff, 0xd9, 0x1e, 0x80, 0x8b, 0xff, 0xff, 0xe1, 0xc4, 0x00, 0x8b, 0xff, 0xff,
+		0xda, 0x58, 0x40, 0xff, 0x00, 0x0a, 0x0f, 0xc0, 0xff, 0xff, 0xe0, 0x96, 0xc0, 0xff, 0x00, 0x19,
+		0x54, 0xc0, 0x08, 0xff, 0xff, 0xe6, 0xf9, 0x00, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00,
+		0x25, 0x5d, 0x40, 0xff, 0xff, 0xe5, 0xb9, 0x40, 0xff, 0x00, 0x2a, 0xc8, 0xc0, 0xff, 0xff, 0xf5,
+		0x16, 0x80, 0xff, 0x00, 0x26, 0x6b, 0x00, 0x8b, 0xff, 0x00, 0x49, 0x64, 0xc0, 0x8b, 0xff, 0x00,
+		0x23, 0x12, 0x00, 0xff, 0x00, 0x26, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x23, 0xb9, 0x80, 0x8b, 0xff,
+		0x00, 0x13, 0x63, 0x00, 0xff, 0xff, 0xf5, 0x8f, 0x40, 0xff, 0x00, 0x11, 0xfa, 0x40, 0xff, 0xff,
+		0xec, 0xef, 0xc0, 0xff, 0x00, 0x09, 0x40, 0x00, 0xff, 0xff, 0xf3, 0x26, 0x80, 0xff, 0x00, 0x06,
+		0x3c, 0x40, 0xff, 0xff, 0xf2, 0xe0, 0x00, 0xff, 0x00, 0x00, 0xcf, 0x40, 0xff, 0xff, 0xf3, 0x3d,
+		0x80, 0xff, 0x00, 0x00, 0xac, 0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x80, 0xff, 0x00, 0x00, 0xdd,
+		0x00, 0xff, 0x00, 0x04, 0x24, 0x00, 0xff, 0x00, 0x25, 0xf4, 0x80, 0x05, 0xff, 0x00, 0x85, 0x74,
+		0x00, 0xff, 0x00, 0x0a, 0x3a, 0x00, 0xff, 0x00, 0x32, 0x03, 0x80, 0xff, 0x00, 0x5e, 0xd2, 0x80,
+		0x8b, 0xff, 0x00, 0x4a, 0x19, 0x40, 0x8b, 0xff, 0x00, 0x20, 0x9b, 0x80, 0xff, 0xff, 0xf6, 0x98,
+		0x40, 0xff, 0x00, 0x2b, 0x84, 0x40, 0xff, 0xff, 0xd8, 0xff, 0x00, 0xff, 0x00, 0x24, 0xba, 0x80,
+		0xff, 0xff, 0xc9, 0xcc, 0x80, 0xff, 0x00, 0x33, 0x0a, 0x00, 0xff, 0xff, 0xa8, 0x36, 0x40, 0xff,
+		0x00, 0x11, 0xb2, 0x40, 0xff, 0xff, 0xc6, 0xfc, 0x80, 0xff, 0x00, 0x21, 0x58, 0x80, 0xff, 0xff,
+		0xcb, 0xda, 0xc0, 0xff, 0x00, 0x1e, 0x7f, 0x00, 0xff, 0xff, 0xf4, 0x7a, 0x80, 0xff, 0x00, 0x24,
+		0xf6, 0x40, 0x8b, 0xff, 0x00, 0x19, 0x78, 0xc0, 0x8b, 0xff, 0x00, 0x2f, 0xc5, 0x80, 0xff, 0x00,
+		0x29, 0x33, 0x00, 0xff, 0x00, 0x2b, 0x90, 0x80, 0xff, 0x00, 0x47, 0x54, 0xc0, 0x8b, 0xff, 0x00,
+		0x3a, 0x0b, 0xc0, 0x8b, 0xff, 0x00, 0x2c, 0xa0, 0x40, 0xff, 0xff, 0xe5, 0x79, 0x00, 0xff, 0x00,
+		0x18, 0x22, 0x80, 0xff, 0xff, 0xdc, 0xd0, 0x00, 0x08, 0xff, 0x00, 0x02, 0xa5, 0xc0, 0xff, 0xff,
+		0xfc, 0x24, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xff, 0xff, 0xfd, 0xea, 0x40, 0xff, 0x00, 0x00,
+		0x22, 0x00, 0xff, 0xff, 0xfc, 0x52, 0xc0, 0xff, 0x00, 0x00, 0x33, 0x00, 0xff, 0xff, 0xfa, 0x75,
+		0xc0, 0xff, 0x00, 0x02, 0xe1, 0x80, 0xff, 0xff, 0xfe, 0x06, 0x40, 0xff, 0x00, 0x02, 0x2f, 0xc0,
+		0xff, 0xff, 0xff, 0x56, 0x00, 0x08, 0x0e, 0xff, 0x01, 0x8c, 0xfb, 0x00, 0xff, 0x02, 0xf3, 0x20,
+		0x00, 0x15, 0x4f, 0x0a, 0xff, 0xff, 0x15, 0x43, 0x80, 0xff, 0xff, 0xe0, 0x11, 0xc0, 0x15, 0x35,
+		0x0a, 0x0e, 0xff, 0x01, 0x34, 0x17, 0x40, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff,
+		0xfe, 0xe2, 0x58, 0xc0, 0xff, 0xff, 0x9d, 0x9e, 0x40, 0x15, 0x38, 0x0a, 0x0e, 0xff, 0x00, 0xfe,
+		0x96, 0x80, 0xff, 0x03, 0x0e, 0xbd, 0xc0, 0x15, 0x42, 0x0a, 0xff, 0xff, 0x3f, 0x8c, 0x40, 0xff,
+		0xff, 0x60, 0x58, 0x40, 0x15, 0x38, 0x0a, 0x0e, 0xff, 0x01, 0x34, 0x17, 0x40, 0xff, 0x03, 0x17,
+		0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff, 0xfe, 0xdc, 0x4e, 0x40, 0xff, 0xff, 0x9d, 0x9e, 0x40, 0x15,
+		0x32, 0x0a, 0xff, 0xff, 0x8e, 0xf2, 0x80, 0xff, 0xff, 0xbe, 0x69, 0x80, 0x15, 0x33, 0x0a, 0x0e,
+		0xff, 0x00, 0x7f, 0xb9, 0x40, 0xff, 0x03, 0x10, 0x77, 0x80, 0x15, 0x67, 0x0a, 0xff, 0xff, 0x8e,
+		0xf2, 0x80, 0xff, 0xfc, 0xee, 0xab, 0x80, 0x15, 0x26, 0x0a, 0xff, 0x00, 0x5b, 0x7a, 0x40, 0xff,
+		0xfe, 0x72, 0x28, 0x40, 0x15, 0x27, 0x0a, 0x0e, 0xff, 0x01, 0x34, 0x17, 0x40, 0xff, 0x03, 0x17,
+		0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff, 0xfe, 0xe6, 0xa9, 0x80, 0xff, 0xff, 0x9d, 0x9e, 0x40, 0x15,
+		0x2e, 0x0a, 0x0e, 0xff, 0x01, 0x34, 0x17, 0x40, 0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a,
+		0xff, 0xff, 0xb9, 0xc4, 0x80, 0xff, 0xff, 0xa2, 0xcb, 0xc0, 0x15, 0x28, 0x0a, 0x0e, 0xff, 0x01,
+		0x9d, 0x60, 0x80, 0xff, 0x02, 0xf3, 0x20, 0x00, 0x15, 0x4f, 0x0a, 0xff, 0xff, 0xfb, 0x5b, 0x00,
+		0xff, 0xff, 0xe4, 0x62, 0x40, 0x15, 0x28, 0x0a, 0x0e, 0xff, 0x00, 0x3a, 0xaf, 0x00, 0xff, 0x02,
+		0x6f, 0xf3, 0x00, 0x15, 0xff, 0xfd, 0x90, 0x0d, 0x00, 0xff, 0x01, 0x37, 0x8b, 0x00, 0x07, 0xff,
+		0xff, 0xcc, 0x30, 0x00, 0xff, 0xff, 0xd5, 0x41, 0x80, 0xff, 0xff, 0xe4, 0x76, 0x00, 0xff, 0xff,
+		0xd8, 0x1a, 0x00, 0x8b, 0xff, 0xff, 0xdf, 0xc8, 0x40, 0x8b, 0xff, 0xff, 0xde, 0xa5, 0x00, 0xff,
+		0x00, 0x1a, 0x96, 0x40, 0xff, 0xff, 0xe4, 0x29, 0x80, 0xff, 0x00, 0x33, 0xd1, 0x00, 0x8b, 0xff,
+		0x00, 0x18, 0xda, 0x80, 0x8b, 0xff, 0x00, 0x18, 0xaa, 0x40, 0xff, 0x00, 0x06, 0x4f, 0x80, 0xff,
+		0x00, 0x13, 0x9b, 0x80, 0xff, 0x00, 0x10, 0xfe, 0x00, 0x08, 0xff, 0x00, 0x2d, 0xbd, 0x40, 0x07,
+		0xff, 0xff, 0xf9, 0xa4, 0x80, 0xff, 0xff, 0xfa, 0xb9, 0xc0, 0xff, 0xff, 0xf5, 0xec, 0x40, 0xff,
+		0xff, 0xf9, 0x1e, 0x00, 0xff, 0xff, 0xf0, 0x61, 0x40, 0xff, 0xff, 0xfa, 0x4f, 0xc0, 0xff, 0xff,
+		0xf5, 0x7d, 0x00, 0xff, 0xff, 0xfc, 0x2c, 0x00, 0xff, 0xff, 0xf8, 0xa1, 0x80, 0xff, 0xff, 0xfe,
+		0x8c, 0x40, 0xff, 0xff, 0xf9, 0xcb, 0x80, 0x8b, 0xff, 0xff, 0xed, 0xca, 0xc0, 0x8b, 0xff, 0xff,
+		0xf4, 0xf3, 0xc0, 0xff, 0x00, 0x0d, 0x14, 0xc0, 0x8b, 0xff, 0x00, 0x0f, 0x5c, 0x00, 0x8b, 0xff,
+		0x00, 0x0e, 0xca, 0x00, 0xff, 0x00, 0x09, 0xce, 0xc0, 0xff, 0x00, 0x0b, 0xdb, 0x80, 0xff, 0x00,
+		0x07, 0x07, 0x40, 0xff, 0x00, 0x07, 0xf6, 0x00, 0xff, 0x00, 0x08, 0x7e, 0x00, 0xff, 0x00, 0x09,
+		0x9e, 0x00, 0xff, 0x00, 0x18, 0xb8, 0xc0, 0xff, 0x00, 0x1b, 0x46, 0x40, 0xff, 0x00, 0x21, 0x9e,
+		0xc0, 0xff, 0x00, 0x1e, 0x32, 0xc0, 0x08, 0xff, 0x00, 0x01, 0xba, 0x00, 0xff, 0x00, 0x3e, 0x22,
+		0xc0, 0xff, 0xfe, 0xc6, 0xbb, 0x00, 0xff, 0x00, 0xe7, 0x48, 0xc0, 0xff, 0x01, 0x04, 0xa0, 0x40,
+		0xff, 0x00, 0x3f, 0xdc, 0xc0, 0xff, 0xfe, 0xfb, 0x5f, 0xc0, 0xff, 0x00, 0xcc, 0x88, 0x00, 0xff,
+		0x01, 0x3b, 0xdb, 0xc0, 0xff, 0x00, 0x3e, 0x22, 0xc0, 0x06, 0x0e, 0xff, 0x01, 0x8c, 0xfb, 0x00,
+		0xff, 0x02, 0xf3, 0x20, 0x00, 0x15, 0x4f, 0x0a, 0xff, 0xff, 0x30, 0xe1, 0x00, 0xff, 0xff, 0xe0,
+		0x11, 0xc0, 0x15, 0x2b, 0x0a, 0x0e, 0xff, 0x01, 0x73, 0x17, 0x00, 0xff, 0x02, 0xf3, 0x20, 0x00,
+		0x15, 0x4f, 0x0a, 0xff, 0xff, 0x45, 0x97, 0x80, 0xff, 0xff, 0xdf, 0x34, 0xc0, 0x15, 0x29, 0x0a,
+		0xff, 0xff, 0xb0, 0x9a, 0xc0, 0xff, 0xff, 0xc4, 0x74, 0x00, 0x15, 0x2a, 0x0a, 0x0e, 0xff, 0x00,
+		0x4e, 0x88, 0x80, 0xff, 0x02, 0x6f, 0x16, 0x00, 0x15, 0x5d, 0x0a, 0xff, 0xff, 0xb4, 0xeb, 0x40,
+		0xff, 0xfe, 0xbe, 0x1a, 0x00, 0x15, 0x5e, 0x0a, 0x0e, 0xff, 0x01, 0x34, 0x17, 0x40, 0xff, 0x03,
+		0x17, 0x5f, 0x00, 0x15, 0x5a, 0x0a, 0xff, 0xfe, 0xd6, 0x43, 0xc0, 0xff, 0xfd, 0x2e, 0x88, 0x40,
+		0x15, 0x2f, 0x0a, 0x0e, 0xff, 0x01, 0x8c, 0xfb, 0x00, 0xff, 0x02, 0xf3, 0x20, 0x00, 0x15, 0x4f,
+		0x0a, 0xff, 0xff, 0x28, 0x3f, 0xc0, 0xff, 0xfd, 0x70, 0x1e, 0xc0, 0x15, 0x2f, 0x0a, 0x0e, 0xff,
+		0x01, 0x9a, 0xc9, 0xc0, 0xff, 0x03, 0x2a, 0x5b, 0x80, 0x15, 0x6c, 0x0a, 0xff, 0xff, 0x1f, 0x9e,
+		0xc0, 0xff, 0x00, 0x40, 0xb9, 0xc0, 0x15, 0x6d, 0x0a, 0xff, 0x00, 0xbf, 0x97, 0xc0, 0xff, 0xfe,
+		0x4c, 0x9e, 0xc0, 0x15, 0x30, 0x0a, 0xff, 0xff, 0x23, 0x60, 0x80, 0xff, 0x00, 0xfe, 0x28, 0x80,
+		0x15, 0x31, 0x0a, 0x0e, 0xff, 0x01, 0x8c, 0xfb, 0x00, 0xff, 0x02, 0xf3, 0x20, 0x00, 0x15, 0x4f,
+		0x0a, 0xff, 0xff, 0x2e, 0x4a, 0x40, 0xff, 0xff, 0xdf, 0x34, 0xc0, 0x15, 0x32, 0x0a, 0xff, 0xff,
+		0x8e, 0xf2, 0x80, 0xff, 0xff, 0xbe, 0x69, 0x80, 0x15, 0x33, 0x0a, 0x0e, 0xff, 0x01, 0x58, 0x57,
+		0x40, 0xff, 0x02, 0xc2, 0xcb, 0x80, 0x15, 0x64, 0x0a, 0xff, 0xff, 0x7b, 0xe2, 0x00, 0xff, 0x00,
+		0x00, 0xab, 0x80, 0x15, 0x65, 0x0a, 0xff, 0xff, 0x5d, 0xd4, 0x80, 0xff, 0xff, 0xab, 0x9f, 0x00,
+		0x15, 0x36, 0x0a, 0x0e, 0xff, 0x01, 0x9a, 0xc9, 0xc0, 0xff, 0x03, 0x2a, 0x5b, 0x80, 0x15, 0x6c,
+		0x0a, 0xff, 0xff, 0x1f, 0x9e, 0xc0, 0xff, 0x00, 0x40, 0xb9, 0xc0, 0x15, 0x6d, 0x0a, 0xff, 0xff,
+		0x1a, 0x71, 0x00, 0xff, 0xff, 0x85, 0x74, 0x40, 0x15, 0x36, 0x0a, 0x0e, 0xff, 0x00, 0x1f, 0x11,
+		0x80, 0xff, 0x02, 0x6f, 0xf3, 0x00, 0x15, 0xff, 0xff, 0xc1, 0x00, 0x40, 0xff, 0x00, 0xb0, 0xea,
+		0x40, 0xff, 0xfd, 0xce, 0x2f, 0xc0, 0xff, 0x00, 0x0f, 0x6b, 0xc0, 0x07, 0xff, 0xff, 0xf4, 0xe4,
+		0xc0, 0xff, 0xff, 0xab, 0x6d, 0x40, 0xff, 0x00, 0x1d, 0x57, 0x80, 0x8b, 0x05, 0xff, 0x00, 0x0b,
+		0x64, 0x80, 0x8b, 0xff, 0x00, 0x0e, 0x69, 0xc0, 0xff, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x00, 0x0a,
+		0xc4, 0xc0, 0xff, 0xff, 0xf9, 0x66, 0x80, 0xff, 0x00, 0x07, 0xd6, 0x00, 0xff, 0xff, 0xfb, 0x32,
+		0xc0, 0xff, 0x00, 0x03, 0x0e, 0x80, 0xff, 0xff, 0xf9, 0x52, 0x40, 0x8b, 0xff, 0xff, 0xfa, 0x1c,
+		0x40, 0x8b, 0xff, 0xff, 0xf7, 0x4b, 0x80, 0xff, 0xff, 0xf9, 0x32, 0x40, 0xff, 0xff, 0xf0, 0x4e,
+		0x80, 0xff, 0xff, 0xd9, 0x1e, 0x80, 0x8b, 0xff, 0xff, 0xe1, 0xc4, 0x00, 0x8b, 0xff, 0xff, 0xda,
+		0x58, 0x40, 0xff, 0x00, 0x0a, 0x0f, 0xc0, 0xff, 0xff, 0xe0, 0x96, 0xc0, 0xff, 0x00, 0x19, 0x54,
+		0xc0, 0x08, 0xff, 0xff, 0xe6, 0xf9, 0x00, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00, 0x25,
+		0x5d, 0x40, 0xff, 0xff, 0xe5, 0xb9, 0x40, 0xff, 0x00, 0x2a, 0xc8, 0xc0, 0xff, 0xff, 0xf5, 0x16,
+		0x80, 0xff, 0x00, 0x26, 0x6b, 0x00, 0x8b, 0xff, 0x00, 0x49, 0x64, 0xc0, 0x8b, 0xff, 0x00, 0x23,
+		0x12, 0x00, 0xff, 0x00, 0x26, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x23, 0xb9, 0x80, 0x8b, 0xff, 0x00,
+		0x13, 0x63, 0x00, 0xff, 0xff, 0xf5, 0x8f, 0x40, 0xff, 0x00, 0x11, 0xfa, 0x40, 0xff, 0xff, 0xec,
+		0xef, 0xc0, 0xff, 0x00, 0x09, 0x40, 0x00, 0xff, 0xff, 0xf3, 0x26, 0x80, 0xff, 0x00, 0x06, 0x3c,
+		0x40, 0xff, 0xff, 0xf2, 0xe0, 0x00, 0xff, 0x00, 0x00, 0xcf, 0x40, 0xff, 0xff, 0xf3, 0x3d, 0x80,
+		0xff, 0x00, 0x00, 0xac, 0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x80, 0xff, 0x00, 0x00, 0xdd, 0x00,
+		0xff, 0x00, 0x05, 0x15, 0x40, 0xff, 0x00, 0x2e, 0x9a, 0x00, 0xff, 0x00, 0x0c, 0x2d, 0x40, 0x8b,
+		0x8b, 0xff, 0x02, 0x31, 0xd0, 0x40, 0xff, 0x00, 0xb7, 0xd1, 0xc0, 0x8b, 0x8b, 0xff, 0x00, 0x3e,
+		0xff, 0xc0, 0x05, 0x0e, 0xff, 0x01, 0x70, 0x80, 0x40, 0xff, 0x00, 0xd6, 0x06, 0x40, 0x15, 0x3a,
+		0x0a, 0xff, 0xfe, 0xfa, 0x83, 0x00, 0xff, 0x00, 0xbc, 0xff, 0x40, 0x15, 0xff, 0x00, 0x23, 0x62,
+		0x00, 0xff, 0xff, 0xd2, 0x42, 0xc0, 0x05, 0xff, 0x00, 0x25, 0x6b, 0x00, 0xff, 0x00, 0x27, 0x2c,
+		0x80, 0xff, 0x00, 0x33, 0x6e, 0xc0, 0xff, 0x00, 0x0b, 0xc5, 0x00, 0xff, 0x00, 0x2a, 0x36, 0x80,
+		0x8b, 0xff, 0x00, 0x36, 0x43, 0x00, 0x8b, 0xff, 0x00, 0x1a, 0xd3, 0x80, 0xff, 0xff, 0xe9, 0x34,
+		0x00, 0xff, 0x00, 0x0c, 0xe5, 0x40, 0xff, 0xff, 0xea, 0xd3, 0x40, 0xff, 0x00, 0x0f, 0x38, 0x80,
+		0xff, 0xff, 0xe7, 0x01, 0x00, 0xff, 0xff, 0xff, 0xa5, 0x80, 0xff, 0xff, 0xe2, 0x9b, 0x40, 0x8b,
+		0xff, 0xff, 0xe7, 0xca, 0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x40, 0xff, 0xff, 0xf1, 0x54, 0x40,
+		0x07, 0xff, 0xff, 0xbc, 0xb4, 0xc0, 0x8b, 0xff, 0xff, 0xb7, 0xf7, 0xc0, 0xff, 0x00, 0x00, 0xb4,
+		0x80, 0xff, 0xff, 0xc5, 0xe0, 0x40, 0xff, 0xff, 0xea, 0xa3, 0xc0, 0xff, 0xff, 0xb7, 0xf1, 0x00,
+		0xff, 0xff, 0xe5, 0x84, 0x80, 0xff, 0xff, 0xdf, 0x4d, 0x40, 0xff, 0xff, 0xca, 0x9a, 0xc0, 0x8b,
+		0xff, 0xff, 0xcd, 0x5b, 0x80, 0x8b, 0xff, 0xff, 0xbc, 0xfa, 0x40, 0xff, 0x00, 0x3a, 0x40, 0x40,
+		0xff, 0xff, 0xc1, 0xb8, 0xc0, 0xff, 0x00, 0x5f, 0x73, 0x00, 0x8b, 0xff, 0x00, 0x38, 0x1d, 0x40,
+		0x8b, 0xff, 0x00, 0x3a, 0x14, 0x80, 0xff, 0x00, 0x14, 0x6c, 0xc0, 0xff, 0x00, 0x31, 0xd8, 0xc0,
+		0xff, 0x00, 0x28, 0xd9, 0x80, 0x08, 0xff, 0xff, 0xcd, 0xf2, 0x40, 0xff, 0x00, 0x00, 0xdc, 0xc0,
+		0x07, 0xff, 0xff, 0xcc, 0x30, 0x00, 0xff, 0xff, 0xd5, 0x41, 0x80, 0xff, 0xff, 0xe4, 0x76, 0x00,
+		0xff, 0xff, 0xd8, 0x1a, 0x00, 0x8b, 0xff, 0xff, 0xdf, 0xc8, 0x40, 0x8b, 0xff, 0xff, 0xde, 0xa5,
+		0x00, 0xff, 0x00, 0x1a, 0x96, 0x40, 0xff, 0xff, 0xe4, 0x29, 0x80, 0xff, 0x00, 0x33, 0xd1, 0x00,
+		0x8b, 0xff, 0x00, 0x18, 0xda, 0x80, 0x8b, 0xff, 0x00, 0x18, 0xaa, 0x40, 0xff, 0x00, 0x06, 0x4f,
+		0x80, 0xff, 0x00, 0x13, 0x9b, 0x80, 0xff, 0x00, 0x10, 0xfe, 0x00, 0x08, 0xff, 0x00, 0x2d, 0xbd,
+		0x40, 0x07, 0xff, 0xff, 0xf9, 0xa4, 0x80, 0xff, 0xff, 0xfa, 0xb9, 0xc0, 0xff, 0xff, 0xf5, 0xec,
+		0x40, 0xff, 0xff, 0xf9, 0x1e, 0x00, 0xff, 0xff, 0xf0, 0x61, 0x40, 0xff, 0xff, 0xfa, 0x4f, 0xc0,
+		0xff, 0xff, 0xf5, 0x7d, 0x00, 0xff, 0xff, 0xfc, 0x2c, 0x00, 0xff, 0xff, 0xf8, 0xa1, 0x80, 0xff,
+		0xff, 0xfe, 0x8c, 0x40, 0xff, 0xff, 0xf9, 0xcb, 0x80, 0x8b, 0xff, 0xff, 0xed, 0xca, 0xc0, 0x8b,
+		0xff, 0xff, 0xf4, 0xf3, 0xc0, 0xff, 0x00, 0x0d, 0x14, 0xc0, 0x8b, 0xff, 0x00, 0x0f, 0x5c, 0x00,
+		0x8b, 0xff, 0x00, 0x0e, 0xca, 0x00, 0xff, 0x00, 0x09, 0xce, 0xc0, 0xff, 0x00, 0x0b, 0xdb, 0x80,
+		0xff, 0x00, 0x07, 0x07, 0x40, 0xff, 0x00, 0x07, 0xf6, 0x00, 0xff, 0x00, 0x08, 0x7e, 0x00, 0xff,
+		0x00, 0x09, 0x9e, 0x00, 0xff, 0x00, 0x18, 0xb8, 0xc0, 0xff, 0x00, 0x1b, 0x46, 0x40, 0xff, 0x00,
+		0x21, 0x9e, 0xc0, 0xff, 0x00, 0x1e, 0x32, 0xc0, 0x08, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x01,
+		0x1b, 0x10, 0x80, 0x06, 0x8b, 0xff, 0x00, 0x25, 0x72, 0x00, 0xff, 0xff, 0xfe, 0xa7, 0xc0, 0xff,
+		0x00, 0x23, 0x5e, 0xc0, 0xff, 0xff, 0xea, 0xe9, 0xc0, 0xff, 0x00, 0x23, 0x24, 0x80, 0xff, 0xff,
+		0xe2, 0x04, 0xc0, 0xff, 0x00, 0x31, 0xf7, 0x80, 0xff, 0xff, 0xc6, 0x07, 0x00, 0xff, 0x00, 0x19,
+		0xf1, 0x00, 0xff, 0xff, 0xb9, 0x17, 0x40, 0x8b, 0xff, 0xff, 0xc2, 0x5e, 0xc0, 0x8b, 0xff, 0xff,
+		0xc5, 0x44, 0xc0, 0xff, 0xff, 0xec, 0x2c, 0xc0, 0xff, 0xff, 0xd5, 0x51, 0xc0, 0xff, 0xff, 0xd3,
+		0xea, 0x80, 0x08, 0x0e, 0xff, 0x00, 0x91, 0xd8, 0xc0, 0xff, 0x02, 0x86, 0x63, 0x00, 0x15, 0x67,
+		0x0a, 0xff, 0xff, 0xc8, 0xc4, 0xc0, 0xff, 0xff, 0x0c, 0xa2, 0x80, 0x15, 0x39, 0x0a, 0xff, 0x01,
+		0x15, 0xe2, 0xc0, 0xff, 0xff, 0x43, 0x00, 0xc0, 0x15, 0x3a, 0x0a, 0x0e, 0xff, 0x01, 0xc8, 0x87,
+		0x00, 0xff, 0x01, 0x7d, 0x72, 0x40, 0x15, 0x3b, 0x0a, 0xff, 0xff, 0xe3, 0x85, 0x80, 0xff, 0x01,
+		0x50, 0x92, 0x00, 0x15, 0x50, 0x0a, 0x0e, 0xff, 0x01, 0x34, 0xf4, 0x40, 0xff, 0x01, 0x86, 0x13,
+		0x80, 0x15, 0xff, 0xff, 0xe8, 0x50, 0x40, 0xff, 0x00, 0x30, 0x3f, 0x00, 0xff, 0xff, 0xce, 0xc4,
+		0x00, 0xff, 0x00, 0x1e, 0x7c, 0x00, 0xff, 0xff, 0xc9, 0x64, 0x40, 0x8b, 0x08, 0xff, 0xff, 0xa3,
+		0x60, 0x40, 0xff, 0xff, 0xa7, 0x32, 0xc0, 0xff, 0xff, 0xaa, 0x0a, 0xc0, 0xff, 0xff, 0x69, 0x30,
+		0xc0, 0xff, 0xff, 0x73, 0x2f, 0xc0, 0xff, 0x00, 0x4b, 0xd2, 0x80, 0xff, 0xff, 0x9a, 0x68, 0x00,
+		0xff, 0x00, 0x60, 0x57, 0x40, 0x1f, 0xff, 0x00, 0x37, 0xcd, 0x00, 0x8b, 0xff, 0x00, 0x31, 0xa3,
+		0xc0, 0xff, 0x00, 0x23, 0xd0, 0x00, 0xff, 0x00, 0x1b, 0xe6, 0x40, 0xff, 0x00, 0x2f, 0xe9, 0x40,
+		0x08, 0xff, 0xff, 0xd8, 0x4d, 0x40, 0x07, 0x8b, 0xff, 0xff, 0xf5, 0x25, 0x40, 0xff, 0x00, 0x00,
+		0xa7, 0x80, 0xff, 0xff, 0xf4, 0x49, 0x00, 0xff, 0x00, 0x03, 0xa9, 0x40, 0xff, 0xff, 0xf4, 0xe9,
+		0x80, 0x08, 0xff, 0x00, 0x47, 0xa1, 0x00, 0x06, 0xff, 0xff, 0xfc, 0x5d, 0x00, 0xff, 0x00, 0x0d,
+		0xfd, 0x80, 0xff, 0xff, 0xff, 0x52, 0x40, 0xff, 0x00, 0x0e, 0x7b, 0x40, 0x8b, 0xff, 0x00, 0x0d,
+		0xd0, 0xc0, 0x08, 0xff, 0x02, 0x6f, 0x16, 0x00, 0xff, 0xff, 0xbb, 0xd2, 0xc0, 0x07, 0xff, 0xff,
+		0x84, 0x08, 0xc0, 0xff, 0xff, 0x00, 0xb0, 0x80, 0x15, 0xff, 0x00, 0x24, 0xac, 0x00, 0x8b, 0xff,
+		0x00, 0x2e, 0x4e, 0x00, 0xff, 0xff, 0xe6, 0x90, 0xc0, 0xff, 0x00, 0x13, 0xe7, 0x80, 0xff, 0xff,
+		0xd6, 0x37, 0x00, 0xff, 0x00, 0x0e, 0x09, 0xc0, 0xff, 0xff, 0xe2, 0x87, 0x00, 0xff, 0x00, 0x01,
+		0x46, 0x80, 0xff, 0xff, 0xdf, 0xb7, 0x00, 0x8b, 0xff, 0xff, 0xc2, 0xff, 0xc0, 0x8b, 0xff, 0xff,
+		0xd6, 0xc5, 0xc0, 0xff, 0xff, 0xfd, 0x4e, 0xc0, 0xff, 0xff, 0xdd, 0x5b, 0xc0, 0xff, 0xff, 0xec,
+		0x3d, 0x80, 0xff, 0xff, 0xdf, 0xb5, 0x00, 0xff, 0xff, 0xed, 0x52, 0x80, 0xff, 0xff, 0xe1, 0x79,
+		0x00, 0xff, 0xff, 0xdd, 0x61, 0x40, 0xff, 0xff, 0xe4, 0x02, 0x40, 0xff, 0xff, 0xd8, 0x7c, 0x00,
+		0x8b, 0x08, 0xff, 0xff, 0xb6, 0x0a, 0x00, 0xff, 0xff, 0xd3, 0xe3, 0x40, 0xff, 0x00, 0x5e, 0x2f,
+		0x40, 0xff, 0x00, 0x5c, 0xff, 0xc0, 0xff, 0x00, 0x62, 0x63, 0xc0, 0xff, 0x00, 0x32, 0x49, 0xc0,
+		0xff, 0x00, 0x47, 0x16, 0x00, 0xff, 0x00, 0x40, 0xdb, 0x40, 0x1f, 0xff, 0x01, 0x44, 0x0a, 0x80,
+		0xff, 0x00, 0xc2, 0x9b, 0xc0, 0x15, 0xff, 0x00, 0x28, 0xf0, 0x40, 0xff, 0xff, 0xe4, 0xe4, 0x00,
+		0xff, 0x00, 0x19, 0x67, 0xc0, 0xff, 0xff, 0xe3, 0x8b, 0xc0, 0xff, 0xff, 0xe5, 0xab, 0xc0, 0xff,
+		0xff, 0xec, 0x47, 0x80, 0xff, 0xff, 0xea, 0x8a, 0xc0, 0xff, 0xff, 0xe7, 0xd6, 0x80, 0x1e, 0x8b,
+		0xff, 0xff, 0xea, 0x7d, 0x00, 0xff, 0x00, 0x0f, 0x3d, 0x80, 0xff, 0xff, 0xf6, 0xcd, 0x40, 0xff,
+		0x00, 0x07, 0x11, 0x40, 0xff, 0xff, 0xfb, 0x4c, 0xc0, 0xff, 0x00, 0x06, 0xf3, 0x40, 0xff, 0xff,
+		0xfb, 0x60, 0x80, 0xff, 0x00, 0x0b, 0xca, 0x40, 0xff, 0xff, 0xf8, 0xa2, 0x40, 0x8b, 0xff, 0xff,
+		0xef, 0x87, 0xc0, 0x8b, 0xff, 0xff, 0xf2, 0xc2, 0xc0, 0xff, 0xff, 0xf8, 0x0f, 0x80, 0xff, 0xff,
+		0xf2, 0x53, 0xc0, 0xff, 0xff, 0xfc, 0x18, 0x00, 0xff, 0xff, 0xf9, 0x95, 0x00, 0xff, 0xff, 0xf8,
+		0x2f, 0x80, 0xff, 0xff, 0xf3, 0x29, 0x80, 0xff, 0xff, 0xf2, 0x8f, 0x00, 0xff, 0xff, 0xec, 0x88,
+		0x80, 0xff, 0xff, 0xed, 0x06, 0xc0, 0xff, 0xff, 0xee, 0x8d, 0x00, 0x08, 0xff, 0x00, 0x1b, 0x9d,
+		0xc0, 0xff, 0xff, 0xe7, 0xd6, 0x00, 0x05, 0xff, 0x00, 0x37, 0xb8, 0x00, 0xff, 0x00, 0x38, 0x92,
+		0xc0, 0xff, 0x00, 0x1d, 0x4e, 0x40, 0xff, 0x00, 0x34, 0x2b, 0x40, 0x8b, 0xff, 0x00, 0x29, 0xa6,
+		0xc0, 0x08, 0x0e, 0xff, 0x01, 0x02, 0xc5, 0x00, 0xff, 0x01, 0xd3, 0xfc, 0xc0, 0x15, 0xff, 0xff,
+		0x93, 0x05, 0xc0, 0xff, 0xff, 0x9a, 0xea, 0x40, 0xff, 0xff, 0xb1, 0xde, 0x00, 0xff, 0xff, 0x5b,
+		0xaa, 0xc0, 0xff, 0xff, 0x69, 0xdf, 0xc0, 0xff, 0x00, 0x5c, 0xa6, 0xc0, 0xff, 0xff, 0xaa, 0x3e,
+		0x40, 0xff, 0x00, 0x77, 0xfb, 0x40, 0x1f, 0xff, 0x00, 0x17, 0x0f, 0x80, 0x8b, 0xff, 0x00, 0x16,
+		0xfc, 0xc0, 0xff, 0x00, 0x03, 0x38, 0x00, 0xff, 0x00, 0x16, 0x47, 0x40, 0xff, 0x00, 0x06, 0x47,
+		0x80, 0xff, 0xff, 0xdb, 0x30, 0xc0, 0xff, 0xff, 0xdd, 0x18, 0x40, 0xff, 0xff, 0xed, 0x6c, 0xc0,
+		0xff, 0xff, 0xdc, 0xc1, 0x00, 0x8b, 0xff, 0xff, 0xe2, 0x74, 0x00, 0x8b, 0xff, 0xff, 0xd7, 0x01,
+		0x00, 0xff, 0x00, 0x20, 0xe1, 0x80, 0xff, 0xff, 0xde, 0x94, 0xc0, 0xff, 0x00, 0x31, 0xe3, 0x80,
+		0x8b, 0xff, 0x00, 0x17, 0xa0, 0xc0, 0x8b, 0xff, 0x00, 0x17, 0x65, 0xc0, 0xff, 0x00, 0x07, 0x9a,
+		0xc0, 0xff, 0x00, 0x12, 0xcb, 0x40, 0xff, 0x00, 0x0a, 0x4e, 0x40, 0x08, 0xff, 0x00, 0x00, 0xdd,
+		0x00, 0xff, 0x00, 0x31, 0x31, 0x00, 0x05, 0xff, 0xff, 0xe3, 0x31, 0x80, 0xff, 0xff, 0xed, 0x9f,
+		0x40, 0xff, 0xff, 0xee, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x63, 0x00, 0xff, 0xff, 0xfa, 0xc0, 0xc0,
+		0x8b, 0xff, 0xff, 0xe9, 0x59, 0xc0, 0x8b, 0xff, 0xff, 0xef, 0x9d, 0x40, 0xff, 0x00, 0x10, 0x67,
+		0x80, 0x8b, 0xff, 0x00, 0x16, 0x9a, 0x40, 0x8b, 0xff, 0x00, 0x1d, 0x36, 0x80, 0xff, 0x00, 0x1c,
+		0x05, 0xc0, 0xff, 0x00, 0x20, 0x2d, 0xc0, 0xff, 0x00, 0x22, 0x75, 0x40, 0xff, 0x00, 0x2a, 0xdd,
+		0x80, 0x08, 0xff, 0x00, 0x23, 0x62, 0x00, 0xff, 0x00, 0x2c, 0x03, 0x40, 0xff, 0xff, 0xd8, 0x4d,
+		0x40, 0xff, 0x00, 0x26, 0xd5, 0xc0, 0x05, 0xff, 0xff, 0xe2, 0x39, 0x40, 0xff, 0xff, 0xde, 0xa6,
+		0xc0, 0xff, 0xff, 0xd4, 0xee, 0x00, 0xff, 0xff, 0xed, 0xf3, 0x00, 0xff, 0xff, 0xd2, 0x93, 0x40,
+		0x8b, 0xff, 0xff, 0xc2, 0xe1, 0x80, 0x8b, 0xff, 0xff, 0xa7, 0x83, 0x80, 0xff, 0x00, 0x21, 0xb2,
+		0x00, 0xff, 0xff, 0xfa, 0x90, 0x40, 0xff, 0x00, 0x88, 0xcc, 0x40, 0x08, 0xff, 0x01, 0x44, 0x3b,
+		0x00, 0x06, 0xff, 0x00, 0x02, 0xb7, 0x40, 0xff, 0x00, 0x1e, 0xb4, 0xc0, 0xff, 0xff, 0xfe, 0xb3,
+		0x80, 0xff, 0x00, 0x1d, 0x14, 0x80, 0xff, 0xff, 0xfb, 0x89, 0x40, 0xff, 0x00, 0x1a, 0xc0, 0xc0,
+		0xff, 0xff, 0xeb, 0x7b, 0x00, 0xff, 0x00, 0x7a, 0xf9, 0x40, 0xff, 0xff, 0xaa, 0xcb, 0xc0, 0xff,
+		0x00, 0x28, 0x22, 0xc0, 0xff, 0xff, 0xb4, 0xd2, 0x40, 0x8b, 0x08, 0xff, 0xff, 0x76, 0x0e, 0xc0,
+		0xff, 0xff, 0x3d, 0x95, 0x80, 0x15, 0x3d, 0x0a, 0x0e, 0xff, 0x01, 0xda, 0x82, 0x80, 0xff, 0x02,
+		0x5c, 0xab, 0xc0, 0x15, 0xff, 0x00, 0x28, 0xf0, 0x40, 0xff, 0xff, 0xe4, 0xe4, 0x00, 0xff, 0x00,
+		0x19, 0x67, 0xc0, 0xff, 0xff, 0xe3, 0x8b, 0x80, 0xff, 0xff, 0xe5, 0xab, 0xc0, 0xff, 0xff, 0xec,
+		0x47, 0xc0, 0xff, 0xff, 0xea, 0x8a, 0xc0, 0xff, 0xff, 0xe7, 0xd6, 0x80, 0x1e, 0x8b, 0xff, 0xff,
+		0xea, 0x7d, 0x00, 0xff, 0x00, 0x0f, 0x3d, 0x40, 0xff, 0xff, 0xf6, 0xcd, 0x40, 0xff, 0x00, 0x07,
+		0x11, 0x80, 0xff, 0xff, 0xfb, 0x4c, 0xc0, 0xff, 0x00, 0x06, 0xf3, 0x40, 0xff, 0xff, 0xfb, 0x60,
+		0x80, 0xff, 0x00, 0x0b, 0xca, 0x40, 0xff, 0xff, 0xf8, 0xa2, 0x40, 0x8b, 0xff, 0xff, 0xef, 0x87,
+		0xc0, 0x8b, 0xff, 0xff, 0xf2, 0xc2, 0xc0, 0xff, 0xff, 0xf8, 0x0f, 0x80, 0xff, 0xff, 0xf2, 0x53,
+		0xc0, 0xff, 0xff, 0xfc, 0x17, 0xc0, 0xff, 0xff, 0xf9, 0x95, 0x00, 0xff, 0xff, 0xf8, 0x2f, 0xc0,
+		0xff, 0xff, 0xf3, 0x29, 0x80, 0xff, 0xff, 0xf2, 0x8f, 0x00, 0xff, 0xff, 0xec, 0x88, 0x80, 0xff,
+		0xff, 0xed, 0x06, 0xc0, 0xff, 0xff, 0xee, 0x8d, 0x00, 0x08, 0xff, 0x00, 0x1b, 0x9d, 0x80, 0xff,
+		0xff, 0xe7, 0xd6, 0x00, 0x05, 0xff, 0x00, 0x37, 0xb8, 0x40, 0xff, 0x00, 0x38, 0x92, 0xc0, 0xff,
+		0x00, 0x1d, 0x4e, 0x40, 0xff, 0x00, 0x34, 0x2b, 0x40, 0x8b, 0xff, 0x00, 0x29, 0xa6, 0xc0, 0x08,
+		0xff, 0xfe, 0x68, 0xce, 0x00, 0xff, 0x00, 0x3b, 0xd6, 0xc0, 0x15, 0x44, 0x0a, 0x0e, 0xff, 0x00,
+		0x54, 0x93, 0x00, 0xff, 0x02, 0x98, 0x82, 0x80, 0x15, 0x44, 0x0a, 0xff, 0x00, 0x15, 0x93, 0x40,
+		0xff, 0x00, 0xaa, 0x03, 0x00, 0x15, 0x5a, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02,
+		0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0xfe, 0xe1, 0x7b, 0xc0, 0xff, 0xfd, 0x6f, 0x41, 0xc0,
+		0x15, 0x45, 0x0a, 0x0e, 0xff, 0x01, 0x79, 0x21, 0xc0, 0xff, 0x02, 0x92, 0x78, 0x40, 0x15, 0x50,
+		0x0a, 0xff, 0xff, 0x3a, 0x5f, 0x40, 0xff, 0xfd, 0xfa, 0x33, 0x00, 0x15, 0x45, 0x0a, 0x0e, 0xff,
+		0x00, 0xd6, 0x06, 0x40, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0x00, 0x5c, 0x57,
+		0x40, 0xff, 0x00, 0x2a, 0x49, 0x80, 0x15, 0x60, 0x0a, 0xff, 0x00, 0x1b, 0xb6, 0xc0, 0xff, 0xfe,
+		0x51, 0xa0, 0x00, 0x15, 0x46, 0x0a, 0xff, 0xff, 0x2f, 0xb5, 0xc0, 0xff, 0x00, 0xb3, 0x54, 0x80,
+		0x15, 0x47, 0x0a, 0x0e, 0xff, 0x01, 0x79, 0x21, 0xc0, 0xff, 0x02, 0x92, 0x78, 0x40, 0x15, 0x50,
+		0x0a, 0xff, 0xff, 0x59, 0x70, 0xc0, 0xff, 0xff, 0xc2, 0xba, 0x00, 0x15, 0x49, 0x0a, 0x0e, 0xff,
+		0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0x00, 0x4d, 0xab,
+		0x80, 0xff, 0xfe, 0xfb, 0x5f, 0xc0, 0x15, 0x4a, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff,
+		0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0x00, 0x65, 0xd5, 0x80, 0xff, 0xfe, 0xec, 0xb4,
+		0x00, 0x15, 0x3b, 0x0a, 0x0e, 0xff, 0x01, 0xb0, 0x5d, 0x00, 0xff, 0x01, 0x8c, 0x1e, 0x00, 0x15,
+		0xff, 0xff, 0xd5, 0xc8, 0xc0, 0xff, 0x00, 0x2e, 0x85, 0x40, 0xff, 0xff, 0xc3, 0x58, 0x80, 0xff,
+		0x00, 0x19, 0x1c, 0x80, 0xff, 0xff, 0xbc, 0x6c, 0x80, 0x8b, 0xff, 0xff, 0x95, 0xe5, 0x40, 0x8b,
+		0xff, 0xff, 0xba, 0x7c, 0x40, 0xff, 0xff, 0xc4, 0xb5, 0x80, 0x8b, 0xff, 0xff, 0xbb, 0xc3, 0x80,
+		0x8b, 0xff, 0xff, 0xb0, 0x3b, 0x00, 0xff, 0x00, 0x56, 0x81, 0x40, 0xff, 0xff, 0xe2, 0xef, 0x40,
+		0xff, 0x00, 0x18, 0xcc, 0x00, 0xff, 0xff, 0xf7, 0x09, 0x40, 0xff, 0x00, 0x26, 0xa3, 0x80, 0xff,
+		0xff, 0xf2, 0x08, 0x80, 0xff, 0x00, 0x32, 0x72, 0x00, 0xff, 0xff, 0xf3, 0xdd, 0x40, 0xff, 0x00,
+		0x21, 0xb3, 0x80, 0xff, 0xff, 0xf0, 0x3a, 0x00, 0xff, 0x00, 0x25, 0xb0, 0xc0, 0xff, 0xff, 0xee,
+		0x5b, 0x80, 0xff, 0x00, 0x07, 0xe5, 0x40, 0xff, 0xff, 0xe7, 0xf1, 0x00, 0x8b, 0xff, 0xff, 0xef,
+		0x7d, 0x80, 0x8b, 0xff, 0xff, 0xd5, 0x34, 0x80, 0xff, 0xff, 0xcb, 0xcf, 0x00, 0xff, 0xff, 0xe2,
+		0x83, 0x40, 0xff, 0xff, 0xbe, 0xbb, 0xc0, 0x8b, 0x08, 0xff, 0xff, 0xb1, 0xb0, 0x80, 0x8b, 0xff,
+		0xff, 0xcd, 0xd7, 0x00, 0xff, 0x00, 0x2f, 0x30, 0x80, 0xff, 0xff, 0xf1, 0x8b, 0x80, 0xff, 0x00,
+		0x10, 0x6e, 0x40, 0xff, 0xff, 0xfc, 0x98, 0x00, 0xff, 0x00, 0x03, 0xdf, 0xc0, 0xff, 0x00, 0x00,
+		0x71, 0xc0, 0xff, 0x00, 0x02, 0xd0, 0x80, 0xff, 0x00, 0x00, 0x2f, 0x40, 0xff, 0x00, 0x03, 0xff,
+		0xc0, 0xff, 0x00, 0x00, 0x10, 0x00, 0xff, 0x00, 0x01, 0x5f, 0x80, 0xff, 0x00, 0x00, 0x6f, 0xc0,
+		0xff, 0x00, 0x05, 0xba, 0x40, 0xff, 0xff, 0xfb, 0x12, 0xc0, 0xff, 0x00, 0x02, 0x4d, 0x80, 0x08,
+		0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0xff, 0xb8, 0x5f, 0x00, 0x05, 0xff, 0x00, 0x31, 0xa1, 0x80,
+		0xff, 0xff, 0xd1, 0xd9, 0xc0, 0xff, 0x00, 0x3f, 0x80, 0x80, 0xff, 0xff, 0xe9, 0x2e, 0x80, 0xff,
+		0x00, 0x40, 0x32, 0x80, 0xff, 0xff, 0xfc, 0xdb, 0x00, 0x08, 0xff, 0xff, 0xf6, 0x17, 0x80, 0xff,
+		0xff, 0xb4, 0x8a, 0x40, 0xff, 0x00, 0x1d, 0x57, 0x80, 0x8b, 0x05, 0xff, 0x00, 0x0b, 0x64, 0x40,
+		0x8b, 0xff, 0x00, 0x0e, 0x6a, 0x00, 0xff, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x00, 0x0a, 0xc4, 0xc0,
+		0xff, 0xff, 0xf9, 0x66, 0x80, 0xff, 0x00, 0x07, 0xd6, 0x00, 0xff, 0xff, 0xfb, 0x32, 0xc0, 0xff,
+		0x00, 0x03, 0x0e, 0x80, 0xff, 0xff, 0xf9, 0x52, 0x40, 0x8b, 0xff, 0xff, 0xfa, 0x1c, 0x40, 0x8b,
+		0xff, 0xff, 0xf7, 0x4b, 0x80, 0xff, 0xff, 0xf9, 0x32, 0x40, 0xff, 0xff, 0xf0, 0x4e, 0x80, 0xff,
+		0xff, 0xd9, 0x1e, 0x80, 0x8b, 0xff, 0xff, 0xe1, 0xc4, 0x00, 0x8b, 0xff, 0xff, 0xda, 0x58, 0x40,
+		0xff, 0x00, 0x0a, 0x0f, 0xc0, 0xff, 0xff, 0xe0, 0x96, 0xc0, 0xff, 0x00, 0x19, 0x54, 0xc0, 0x08,
+		0xff, 0xff, 0xe6, 0xf9, 0x00, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05, 0xff, 0x00, 0x25, 0x5d, 0x40,
+		0xff, 0xff, 0xe5, 0xb9, 0x40, 0xff, 0x00, 0x2a, 0xc8, 0xc0, 0xff, 0xff, 0xf5, 0x16, 0x80, 0xff,
+		0x00, 0x26, 0x6b, 0x00, 0x8b, 0xff, 0x00, 0x49, 0x64, 0xc0, 0x8b, 0xff, 0x00, 0x23, 0x12, 0x00,
+		0xff, 0x00, 0x26, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x23, 0xb9, 0x80, 0x8b, 0xff, 0x00, 0x13, 0x63,
+		0x00, 0xff, 0xff, 0xf5, 0x8f, 0x40, 0xff, 0x00, 0x11, 0xfa, 0x40, 0xff, 0xff, 0xec, 0xef, 0xc0,
+		0xff, 0x00, 0x09, 0x40, 0x00, 0xff, 0xff, 0xf3, 0x26, 0x80, 0xff, 0x00, 0x06, 0x3c, 0x40, 0xff,
+		0xff, 0xf2, 0xe0, 0x00, 0xff, 0x00, 0x00, 0xcf, 0x40, 0xff, 0xff, 0xf3, 0x3d, 0x80, 0xff, 0x00,
+		0x00, 0xac, 0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x80, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x00,
+		0x04, 0x30, 0x80, 0xff, 0x00, 0x26, 0x66, 0x80, 0x05, 0xff, 0x00, 0x6a, 0x9d, 0xc0, 0xff, 0x00,
+		0x0a, 0x1a, 0x00, 0xff, 0x00, 0x37, 0x7e, 0x40, 0xff, 0x00, 0x43, 0xa2, 0x40, 0x8b, 0xff, 0x00,
+		0x3f, 0x9d, 0x40, 0x8b, 0xff, 0x00, 0x1f, 0x9f, 0x00, 0x7e, 0xff, 0x00, 0x29, 0x55, 0x80, 0xff,
+		0xff, 0xc9, 0xf1, 0x40, 0xff, 0x00, 0x1e, 0x58, 0x40, 0xff, 0xff, 0xcc, 0x5f, 0xc0, 0xff, 0x00,
+		0x1c, 0xfa, 0x80, 0xff, 0xff, 0xb6, 0x6e, 0x40, 0xff, 0x00, 0x0a, 0x51, 0x00, 0xff, 0xff, 0xd5,
+		0x4c, 0x80, 0xff, 0x00, 0x14, 0xa2, 0xc0, 0xff, 0xff, 0xda, 0xae, 0x40, 0xff, 0x00, 0x12, 0x09,
+		0x40, 0xff, 0xff, 0xf8, 0x0f, 0x00, 0xff, 0x00, 0x16, 0x27, 0xc0, 0x8b, 0xff, 0x00, 0x0f, 0x59,
+		0x80, 0x8b, 0xff, 0x00, 0x24, 0xc3, 0x80, 0xff, 0x00, 0x2c, 0x9b, 0x00, 0xff, 0x00, 0x19, 0x9f,
+		0x00, 0xff, 0x00, 0x33, 0xa7, 0x00, 0x8b, 0xff, 0x00, 0x41, 0x20, 0x80, 0x8b, 0xff, 0x00, 0x2c,
+		0x4d, 0xc0, 0xff, 0xff, 0xd7, 0xb5, 0x00, 0xff, 0x00, 0x11, 0x63, 0x80, 0xff, 0xff, 0xe9, 0x8f,
+		0x40, 0x08, 0xff, 0x00, 0x02, 0xd1, 0x00, 0xff, 0xff, 0xfc, 0x5d, 0x40, 0xff, 0xff, 0xff, 0x58,
+		0x00, 0xff, 0xff, 0xfd, 0x99, 0xc0, 0xff, 0xff, 0xff, 0xfa, 0x00, 0xff, 0xff, 0xfc, 0x7c, 0xc0,
+		0xff, 0xff, 0xff, 0xf6, 0x00, 0xff, 0xff, 0xfa, 0x04, 0x80, 0xff, 0x00, 0x03, 0x7b, 0x00, 0xff,
+		0xff, 0xfe, 0x5c, 0x40, 0xff, 0x00, 0x01, 0xc4, 0x00, 0xff, 0xff, 0xff, 0x94, 0x80, 0x08, 0x0e,
+		0xff, 0x00, 0xbc, 0x22, 0x40, 0xff, 0x02, 0x43, 0x12, 0xc0, 0x15, 0xff, 0xff, 0xf7, 0x5e, 0xc0,
+		0xff, 0xff, 0x85, 0x74, 0x40, 0xff, 0xff, 0x93, 0x43, 0x00, 0x8b, 0xff, 0xff, 0xff, 0x23, 0x40,
+		0xff, 0xff, 0xc5, 0x50, 0xc0, 0xff, 0x00, 0x6b, 0x03, 0x00, 0x8b, 0x05, 0xff, 0xff, 0xf9, 0x9f,
+		0xc0, 0xff, 0xff, 0xb1, 0xc6, 0xc0, 0xff, 0xff, 0xfc, 0xe2, 0x00, 0xff, 0xff, 0xb2, 0x3e, 0x80,
+		0x8b, 0xff, 0xff, 0xb2, 0x6a, 0x80, 0x8b, 0xff, 0xff, 0xd7, 0x03, 0xc0, 0xff, 0x00, 0x00, 0x5e,
+		0xc0, 0xff, 0xff, 0xd2, 0x17, 0x40, 0xff, 0x00, 0x1a, 0x96, 0xc0, 0xff, 0xff, 0xda, 0x89, 0x80,
+		0xff, 0x00, 0x12, 0x59, 0x40, 0xff, 0xff, 0xe6, 0x25, 0xc0, 0xff, 0x00, 0x1c, 0x6b, 0x40, 0xff,
+		0xff, 0xef, 0x09, 0x40, 0xff, 0x00, 0x24, 0x9e, 0x40, 0xff, 0xff, 0xfb, 0x6a, 0x00, 0x08, 0xff,
+		0xff, 0xf5, 0xc3, 0x80, 0xff, 0xff, 0xb2, 0x0b, 0x40, 0xff, 0x00, 0x1d, 0x57, 0x80, 0x8b, 0x05,
+		0xff, 0x00, 0x0b, 0x64, 0x40, 0x8b, 0xff, 0x00, 0x0e, 0x6a, 0x00, 0xff, 0x00, 0x00, 0x07, 0xc0,
+		0xff, 0x00, 0x0a, 0xc4, 0xc0, 0xff, 0xff, 0xf9, 0x66, 0x80, 0xff, 0x00, 0x07, 0xd6, 0x00, 0xff,
+		0xff, 0xfb, 0x32, 0xc0, 0xff, 0x00, 0x03, 0x0e, 0x80, 0xff, 0xff, 0xf9, 0x52, 0x40, 0x8b, 0xff,
+		0xff, 0xfa, 0x1c, 0x40, 0x8b, 0xff, 0xff, 0xf7, 0x4b, 0x80, 0xff, 0xff, 0xf9, 0x32, 0x40, 0xff,
+		0xff, 0xf0, 0x4e, 0x80, 0xff, 0xff, 0xd9, 0x1e, 0x40, 0x8b, 0xff, 0xff, 0xe1, 0xc4, 0x40, 0x8b,
+		0xff, 0xff, 0xda, 0x58, 0x00, 0xff, 0x00, 0x0a, 0x0f, 0xc0, 0xff, 0xff, 0xe0, 0x96, 0xc0, 0xff,
+		0x00, 0x19, 0x54, 0xc0, 0x08, 0xff, 0xff, 0xe6, 0xf9, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x80, 0x05,
+		0xff, 0x00, 0x25, 0x5d, 0x40, 0xff, 0xff, 0xe5, 0xb9, 0x40, 0xff, 0x00, 0x2a, 0xc8, 0x80, 0xff,
+		0xff, 0xf5, 0x16, 0x80, 0xff, 0x00, 0x26, 0x6b, 0x40, 0x8b, 0xff, 0x00, 0x49, 0x64, 0x80, 0x8b,
+		0xff, 0x00, 0x23, 0x12, 0x00, 0xff, 0x00, 0x26, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x23, 0xb9, 0x80,
+		0x8b, 0xff, 0x00, 0x13, 0x63, 0x00, 0xff, 0xff, 0xf5, 0x8f, 0x40, 0xff, 0x00, 0x11, 0xfa, 0x40,
+		0xff, 0xff, 0xec, 0xef, 0xc0, 0xff, 0x00, 0x09, 0x40, 0x00, 0xff, 0xff, 0xf3, 0x26, 0xc0, 0xff,
+		0x00, 0x06, 0x3c, 0x40, 0xff, 0xff, 0xf2, 0xe0, 0x00, 0xff, 0x00, 0x00, 0xcf, 0x40, 0xff, 0xff,
+		0xf3, 0x3d, 0x80, 0xff, 0x00, 0x00, 0xac, 0x00, 0x08, 0xff, 0xff, 0xef, 0x9a, 0x40, 0xff, 0x00,
+		0x00, 0xdd, 0x00, 0xff, 0x00, 0x04, 0x5d, 0xc0, 0xff, 0x00, 0x28, 0x03, 0xc0, 0x05, 0xff, 0x00,
+		0x2e, 0x3f, 0x00, 0xff, 0x00, 0x05, 0x2d, 0x40, 0xff, 0x00, 0x2b, 0xdf, 0x40, 0xff, 0x00, 0x14,
+		0x3b, 0x00, 0xff, 0x00, 0x21, 0x3d, 0x80, 0xff, 0x00, 0x18, 0x54, 0x80, 0x08, 0xff, 0xff, 0xe9,
+		0x8f, 0xc0, 0xff, 0x00, 0x38, 0xf5, 0x40, 0x05, 0xff, 0xff, 0xd9, 0x3b, 0xc0, 0xff, 0xff, 0xe3,
+		0x2c, 0xc0, 0xff, 0xff, 0xdc, 0x92, 0x80, 0xff, 0xff, 0xf3, 0x1e, 0x80, 0xff, 0xff, 0xe3, 0xdd,
+		0x00, 0x8b, 0xff, 0xff, 0xdd, 0xe6, 0x00, 0x8b, 0xff, 0xff, 0xdc, 0x8c, 0xc0, 0xff, 0x00, 0x12,
+		0xde, 0xc0, 0xff, 0xff, 0xf8, 0xaf, 0xc0, 0xff, 0x00, 0x36, 0xdd, 0x00, 0xff, 0xff, 0xff, 0x76,
+		0xc0, 0xff, 0x00, 0x04, 0x05, 0x00, 0xff, 0xff, 0xfd, 0x99, 0xc0, 0xff, 0x00, 0x11, 0x94, 0x00,
+		0x8b, 0xff, 0x00, 0x42, 0x38, 0x80, 0x8b, 0xff, 0x00, 0x3b, 0xb7, 0x40, 0xff, 0x00, 0x02, 0xe5,
+		0x40, 0xff, 0x00, 0x3b, 0xa4, 0x80, 0xff, 0x00, 0x05, 0xc6, 0x00, 0xff, 0x00, 0x3b, 0x64, 0xc0,
+		0x08, 0xff, 0x00, 0x96, 0x29, 0x80, 0xff, 0x00, 0x3b, 0x8c, 0x00, 0xff, 0xff, 0x6a, 0xb3, 0x80,
+		0x06, 0x8b, 0x8b, 0xff, 0x00, 0x06, 0xe5, 0x40, 0xff, 0x00, 0x52, 0x49, 0x80, 0xff, 0x00, 0x04,
+		0xb3, 0x80, 0xff, 0x00, 0x19, 0x54, 0x40, 0xff, 0x00, 0x01, 0xfc, 0xc0, 0xff, 0x00, 0x0a, 0xb3,
+		0xc0, 0xff, 0x00, 0x07, 0x30, 0x00, 0xff, 0x00, 0x06, 0x2b, 0x80, 0xff, 0xff, 0xfc, 0x7d, 0x00,
+		0xff, 0x00, 0x0a, 0x23, 0xc0, 0x08, 0x0e, 0xff, 0x01, 0x5b, 0xcb, 0x00, 0xff, 0x02, 0x5c, 0xf6,
+		0x00, 0x15, 0x64, 0x0a, 0xff, 0xff, 0x7b, 0xe2, 0x00, 0xff, 0x00, 0x00, 0xab, 0x80, 0x15, 0x65,
+		0x0a, 0xff, 0xff, 0x67, 0x52, 0xc0, 0xff, 0xff, 0x6a, 0xe5, 0x80, 0x15, 0x4c, 0x0a, 0x0e, 0xff,
+		0x00, 0xd6, 0x06, 0x40, 0xff, 0x02, 0xbb, 0x07, 0xc0, 0x15, 0x60, 0x0a, 0xff, 0x00, 0x5c, 0x57,
+		0x40, 0xff, 0x00, 0x2a, 0x49, 0x80, 0x15, 0x60, 0x0a, 0xff, 0xfe, 0x8e, 0xa2, 0xc0, 0xff, 0xff,
+		0x37, 0xc8, 0xc0, 0x15, 0x4c, 0x0a, 0x0e, 0xff, 0x00, 0x46, 0xc4, 0x00, 0xff, 0x01, 0xc9, 0x63,
+		0xc0, 0x15, 0x4e, 0x0a, 0xff, 0xff, 0x54, 0x44, 0x00, 0xff, 0x00, 0xc6, 0x7d, 0x80, 0x15, 0x42,
+		0x0a, 0x0e, 0xff, 0x00, 0x54, 0x93, 0x00, 0xff, 0x02, 0x98, 0x82, 0x80, 0x15, 0xff, 0xff, 0xc6,
+		0x2e, 0x00, 0xff, 0x00, 0x81, 0x73, 0x40, 0xff, 0xfe, 0xfa, 0x39, 0x40, 0x07, 0xff, 0xff, 0xb1,
+		0x77, 0x80, 0xff, 0xff, 0xe4, 0xab, 0xc0, 0x8b, 0xff, 0xff, 0xbe, 0x69, 0x80, 0xff, 0x00, 0x4e,
+		0x88, 0x80, 0xff, 0x00, 0x1a, 0x8c, 0xc0, 0x8b, 0xff, 0xff, 0x23, 0x46, 0x80, 0xff, 0xff, 0x78,
+		0x82, 0x40, 0x8b, 0x8b, 0xff, 0xff, 0xc6, 0x2d, 0xc0, 0xff, 0x01, 0x56, 0x9c, 0x40, 0x8b, 0x8b,
+		0xff, 0x00, 0x39, 0xd2, 0x40, 0xff, 0xff, 0x79, 0x5f, 0x40, 0x8b, 0x8b, 0xff, 0x00, 0xf5, 0x3b,
+		0xc0, 0xff, 0x00, 0x5b, 0x7a, 0x80, 0xff, 0x00, 0x1e, 0xed, 0x40, 0x8b, 0xff, 0x00, 0x49, 0x5a,
+		0xc0, 0x05, 0xff, 0xff, 0xf6, 0x81, 0xc0, 0xff, 0xff, 0xf9, 0x18, 0x80, 0xff, 0xff, 0xf9, 0x18,
+		0x80, 0xff, 0xff, 0xfb, 0xaf, 0x80, 0xff, 0xff, 0xf5, 0xa5, 0x00, 0xff, 0xff, 0xfc, 0x8c, 0x40,
+		0x08, 0xff, 0xff, 0xbf, 0x46, 0x40, 0xff, 0xff, 0xe9, 0x79, 0xc0, 0x8b, 0xff, 0x01, 0x26, 0x5e,
+		0x80, 0x05, 0x0e, 0xff, 0x01, 0x79, 0x21, 0xc0, 0xff, 0x02, 0x92, 0x78, 0x40, 0x15, 0x50, 0x0a,
+		0xff, 0xff, 0xf8, 0xd5, 0xc0, 0xff, 0xff, 0xce, 0x2e, 0x00, 0x15, 0x3c, 0x0a, 0xff, 0xff, 0x76,
+		0x30, 0x00, 0xff, 0xff, 0x3d, 0x97, 0x40, 0x15, 0x3d, 0x0a, 0x0e, 0xfb, 0x34, 0x0e, 0xff, 0x00,
+		0x42, 0x73, 0x80, 0xff, 0x01, 0xc8, 0x87, 0x00, 0x15, 0xff, 0xfe, 0x36, 0x9c, 0x00, 0xff, 0x00,
+		0x48, 0x7e, 0x00, 0xff, 0x00, 0xad, 0x76, 0x80, 0x07, 0xff, 0x00, 0x3c, 0x68, 0xc0, 0xff, 0x00,
+		0x38, 0x18, 0x80, 0xff, 0x00, 0xba, 0x68, 0x80, 0xff, 0xff, 0x16, 0xfd, 0x40, 0x05, 0x8b, 0xff,
+		0x00, 0x26, 0x51, 0x80, 0xff, 0x00, 0x03, 0x79, 0xc0, 0xff, 0x00, 0x2f, 0xe4, 0x80, 0x1e, 0xff,
+		0x00, 0x02, 0x54, 0x80, 0x8b, 0xff, 0x00, 0x02, 0x55, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff,
+		0x00, 0x02, 0x54, 0xc0, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x08, 0xff, 0xff, 0x1f, 0x9e, 0xc0, 0xff,
+		0x01, 0x11, 0x92, 0x40, 0xff, 0x00, 0xc0, 0x73, 0x00, 0xff, 0x00, 0xb5, 0x3b, 0x00, 0xff, 0xff,
+		0xe6, 0x1c, 0x00, 0x8b, 0x05, 0xff, 0xff, 0xee, 0x7c, 0x40, 0x8b, 0xff, 0xff, 0xed, 0xba, 0x00,
+		0xff, 0x00, 0x00, 0xd1, 0x80, 0xff, 0xff, 0xee, 0x48, 0x40, 0xff, 0x00, 0x04, 0x5c, 0x00, 0x08,
+		0xff, 0xff, 0x1b, 0x4e, 0x40, 0xff, 0xff, 0x2b, 0xb3, 0xc0, 0x8b, 0xff, 0x00, 0xb7, 0xd1, 0x80,
+		0x05, 0x8b, 0xff, 0x00, 0x03, 0xac, 0x00, 0xff, 0x00, 0x00, 0x2f, 0x80, 0xff, 0x00, 0x02, 0xe0,
+		0x40, 0xff, 0x00, 0x03, 0x1e, 0xc0, 0xff, 0x00, 0x04, 0x40, 0x80, 0xff, 0x00, 0x02, 0x6d, 0x00,
+		0xff, 0x00, 0x03, 0x4e, 0x80, 0xff, 0x00, 0x03, 0xee, 0x40, 0xff, 0x00, 0x03, 0xbd, 0x00, 0x8b,
+		0xff, 0x00, 0x05, 0xf9, 0x00, 0x8b, 0xff, 0x00, 0x00, 0xb2, 0x00, 0xff, 0xff, 0xff, 0xf1, 0x80,
+		0xff, 0x00, 0x00, 0xb1, 0x40, 0xff, 0xff, 0xff, 0xe3, 0x00, 0xff, 0x00, 0x00, 0xaf, 0x80, 0x08,
+		0x0e, 0xff, 0x00, 0x7d, 0xff, 0x80, 0xff, 0x01, 0xc9, 0x63, 0xc0, 0x15, 0x43, 0x0a, 0x0e, 0xff,
+		0x00, 0x44, 0x2d, 0x40, 0x16, 0xff, 0x00, 0x49, 0x5b, 0x00, 0xff, 0x01, 0x07, 0x37, 0x00, 0x06,
+		0x8b, 0xff, 0x00, 0x1e, 0xc4, 0x80, 0xff, 0x00, 0x03, 0xb3, 0x00, 0xff, 0x00, 0x16, 0x59, 0x80,
+		0xff, 0x00, 0x13, 0x01, 0x00, 0xff, 0x00, 0x19, 0x52, 0xc0, 0xff, 0x00, 0x11, 0x6b, 0x00, 0xff,
+		0x00, 0x17, 0x35, 0xc0, 0xff, 0x00, 0x2b, 0xe7, 0x00, 0xff, 0x00, 0x28, 0x62, 0x00, 0xff, 0x00,
+		0x30, 0x4f, 0x40, 0x8b, 0xff, 0x00, 0x16, 0xed, 0x80, 0x8b, 0xff, 0x00, 0x16, 0x99, 0xc0, 0xff,
+		0xff, 0xf6, 0xae, 0x00, 0xff, 0x00, 0x10, 0x68, 0xc0, 0xff, 0xff, 0xec, 0x64, 0x80, 0xff, 0x00,
+		0x18, 0xb9, 0xc0, 0xff, 0xff, 0xe2, 0x74, 0x00, 0xff, 0x00, 0x00, 0x34, 0xc0, 0xff, 0xff, 0xd8,
+		0xcb, 0x00, 0x8b, 0xff, 0xff, 0xdf, 0xbb, 0x00, 0x08, 0xff, 0xff, 0x19, 0x94, 0x40, 0x07, 0x8b,
+		0xff, 0xff, 0xdc, 0x85, 0x80, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xd6, 0x4a, 0x00, 0xff,
+		0xff, 0xea, 0x31, 0x80, 0xff, 0xff, 0xde, 0x1a, 0x00, 0xff, 0xff, 0xed, 0x43, 0x00, 0xff, 0xff,
+		0xe2, 0xdf, 0x00, 0xff, 0xff, 0xe3, 0x76, 0x00, 0xff, 0xff, 0xf2, 0x72, 0x40, 0xff, 0xff, 0xe4,
+		0x74, 0x40, 0x8b, 0xff, 0xff, 0xe0, 0xca, 0x80, 0x8b, 0xff, 0xff, 0xe9, 0x78, 0x80, 0xff, 0x00,
+		0x11, 0x6e, 0x80, 0xff, 0xff, 0xfd, 0x91, 0xc0, 0xff, 0x00, 0x03, 0x6f, 0x00, 0xff, 0xff, 0xfd,
+		0x50, 0x80, 0xff, 0x00, 0x03, 0xcb, 0x40, 0xff, 0x00, 0x00, 0xf2, 0x40, 0xff, 0x00, 0x07, 0xa9,
+		0x40, 0xff, 0xff, 0xf9, 0x2c, 0x00, 0xff, 0x00, 0x01, 0x7e, 0x40, 0x08, 0xff, 0xff, 0xdd, 0x7b,
+		0x00, 0xff, 0xff, 0xbc, 0xaf, 0xc0, 0x05, 0xff, 0x00, 0x1b, 0xf6, 0x80, 0xff, 0xff, 0xea, 0x5a,
+		0x00, 0xff, 0x00, 0x22, 0x57, 0x40, 0xff, 0xff, 0xf4, 0x43, 0x80, 0xff, 0x00, 0x23, 0x50, 0x40,
+		0x8b, 0xff, 0x00, 0x3e, 0xfc, 0xc0, 0x8b, 0xff, 0x00, 0x3c, 0xa2, 0x80, 0xff, 0x00, 0x25, 0x42,
+		0x40, 0xff, 0x00, 0x1b, 0xb9, 0xc0, 0xff, 0x00, 0x44, 0x30, 0x40, 0xff, 0x00, 0x11, 0x4e, 0x00,
+		0xff, 0x00, 0x2a, 0x8f, 0x40, 0xff, 0x00, 0x00, 0x65, 0xc0, 0xff, 0x00, 0x2a, 0x5f, 0x80, 0x8b,
+		0xff, 0x00, 0x29, 0x7e, 0x80, 0x08, 0xff, 0x00, 0xdc, 0xed, 0xc0, 0x07, 0x8b, 0xff, 0x00, 0x23,
+		0xab, 0xc0, 0xff, 0xff, 0xff, 0xc4, 0x00, 0xff, 0x00, 0x25, 0xb2, 0x00, 0xff, 0xff, 0xef, 0xc0,
+		0x40, 0xff, 0x00, 0x24, 0xb9, 0x80, 0xff, 0xff, 0xe9, 0x41, 0x40, 0xff, 0x00, 0x33, 0x66, 0xc0,
+		0xff, 0xff, 0xd1, 0x2b, 0xc0, 0xff, 0x00, 0x1d, 0x3b, 0x80, 0xff, 0xff, 0xcb, 0xf0, 0xc0, 0x8b,
+		0xff, 0xff, 0xc2, 0x01, 0x40, 0x8b, 0xff, 0xff, 0xc7, 0xb0, 0xc0, 0xff, 0xff, 0xd7, 0x70, 0x40,
+		0xff, 0xff, 0xde, 0x74, 0x40, 0xff, 0xff, 0xcd, 0x14, 0xc0, 0x08, 0xff, 0x00, 0x50, 0x42, 0x80,
+		0xff, 0xff, 0xb6, 0xa5, 0x00, 0x07, 0x0e, 0xff, 0x01, 0x31, 0xa2, 0x40, 0xff, 0x00, 0x13, 0xb5,
+		0x00, 0x15, 0x22, 0x0a, 0x0e, 0xff, 0x01, 0x1d, 0xa5, 0xc0, 0xff, 0x01, 0xc1, 0xb2, 0x40, 0x15,
+		0x66, 0x0a, 0xff, 0xff, 0x30, 0xe1, 0x40, 0x16, 0x66, 0x0a, 0x0e, 0xff, 0x00, 0xca, 0x13, 0x00,
+		0xff, 0x02, 0x2a, 0xc4, 0x40, 0x15, 0x22, 0x0a, 0xff, 0x00, 0xcf, 0x1e, 0x80, 0x16, 0x22, 0x0a,
+		0x0e, 0xff, 0x01, 0x99, 0x31, 0x80, 0xff, 0x00, 0x13, 0xb5, 0x00, 0x15, 0x22, 0x0a, 0xff, 0xff,
+		0x30, 0xe1, 0x80, 0x16, 0x22, 0x0a, 0x0e, 0xff, 0x01, 0xd6, 0x56, 0x00, 0xff, 0x00, 0x2e, 0x2a,
+		0x40, 0x15, 0x24, 0x0a, 0xff, 0xfe, 0xa6, 0xcd, 0x00, 0x16, 0x24, 0x0a, 0xff, 0x00, 0xac, 0x99,
+		0x80, 0x16, 0x24, 0x0a, 0x0e, 0xff, 0x00, 0x3a, 0xaf, 0x00, 0xff, 0x01, 0x93, 0xe2, 0x40, 0x15,
+		0xff, 0x00, 0x2b, 0x26, 0x80, 0xff, 0xff, 0xdc, 0x9e, 0x00, 0xff, 0x00, 0x74, 0x81, 0x40, 0xff,
+		0x00, 0x90, 0x77, 0x80, 0x8b, 0xff, 0xfd, 0xdd, 0x60, 0x00, 0xff, 0x00, 0x42, 0x73, 0x80, 0x8b,
+		0x8b, 0xff, 0x02, 0x22, 0x1f, 0x80, 0xff, 0x00, 0x6a, 0x26, 0x40, 0xff, 0xff, 0x70, 0x09, 0x00,
+		0xff, 0x00, 0x32, 0x0d, 0xc0, 0xff, 0x00, 0x21, 0xa8, 0x40, 0xff, 0xff, 0x52, 0x89, 0x80, 0xff,
+		0x00, 0xee, 0x30, 0x00, 0xff, 0xff, 0xea, 0x6c, 0xc0, 0x8b, 0x05, 0x0e, 0xff, 0x01, 0xb8, 0xfe,
+		0x40, 0xff, 0x00, 0xca, 0xce, 0x40, 0x15, 0xff, 0xff, 0xd4, 0xd9, 0x80, 0xff, 0x00, 0x23, 0x62,
+		0x00, 0xff, 0xff, 0x8b, 0x7e, 0xc0, 0xff, 0xff, 0x6f, 0x88, 0x80, 0x8b, 0xff, 0x02, 0x22, 0xa0,
+		0x00, 0xff, 0xff, 0xbd, 0x8c, 0x80, 0x8b, 0x8b, 0xff, 0xfd, 0xdd, 0xe0, 0x80, 0xff, 0xff, 0x95,
+		0xd9, 0xc0, 0xff, 0x00, 0x8f, 0xf7, 0x00, 0xff, 0xff, 0xcd, 0xf2, 0x40, 0xff, 0xff, 0xde, 0x57,
+		0xc0, 0xff, 0x00, 0xad, 0x76, 0x80, 0xff, 0xff, 0x11, 0xd0, 0x00, 0xff, 0x00, 0x15, 0x93, 0x40,
+		0x8b, 0x05, 0x0e, 0xff, 0x00, 0x30, 0x54, 0x00, 0xff, 0x00, 0x45, 0xe7, 0x40, 0x15, 0xff, 0xff,
+		0x78, 0x82, 0x40, 0xff, 0x01, 0x93, 0xe2, 0x40, 0xff, 0x00, 0x87, 0x7d, 0xc0, 0xff, 0xff, 0xcf,
+		0xac, 0x00, 0xff, 0xff, 0xa5, 0x62, 0x80, 0xff, 0xfe, 0xcb, 0x0b, 0xc0, 0xff, 0x00, 0x5a, 0x9d,
+		0x80, 0x07, 0x0e, 0xff, 0x00, 0x40, 0xb9, 0x80, 0xff, 0x01, 0xc8, 0x87, 0x00, 0x15, 0xff, 0xff,
+		0xc6, 0x2d, 0xc0, 0xff, 0x00, 0x3e, 0xff, 0xc0, 0xff, 0xfe, 0xa6, 0xcc, 0xc0, 0xff, 0xff, 0xbf,
+		0x46, 0x80, 0xff, 0xff, 0xc9, 0xa1, 0x80, 0xff, 0x00, 0xe8, 0x25, 0xc0, 0xff, 0x00, 0x36, 0x5e,
+		0x80, 0xff, 0xff, 0xa0, 0x34, 0xc0, 0xff, 0x00, 0xb0, 0xea, 0x40, 0x07, 0x8b, 0xff, 0x00, 0x18,
+		0xac, 0x00, 0xff, 0x00, 0x00, 0x60, 0x00, 0xff, 0x00, 0x1e, 0xe4, 0x80, 0xff, 0x00, 0x23, 0xbd,
+		0x80, 0xff, 0x00, 0x32, 0x9e, 0x80, 0xff, 0x00, 0x24, 0x1b, 0x80, 0xff, 0x00, 0x33, 0x23, 0x80,
+		0xff, 0x00, 0x28, 0x93, 0x00, 0xff, 0x00, 0x11, 0xa8, 0xc0, 0xff, 0x00, 0x22, 0x1e, 0x00, 0x8b,
+		0xff, 0x00, 0x23, 0xe1, 0x80, 0x8b, 0xff, 0x00, 0x18, 0xb6, 0x00, 0xff, 0xff, 0xec, 0xf2, 0x40,
+		0xff, 0x00, 0x0b, 0xfa, 0x80, 0xff, 0xff, 0xf0, 0x23, 0x00, 0xff, 0x00, 0x05, 0xa7, 0x80, 0xff,
+		0xff, 0xf8, 0x83, 0x80, 0xff, 0x00, 0x03, 0x2e, 0x00, 0xff, 0xff, 0xf8, 0x8f, 0x80, 0xff, 0x00,
+		0x07, 0x48, 0x00, 0xff, 0xff, 0xf9, 0x17, 0xc0, 0x08, 0xff, 0x00, 0x21, 0xa8, 0x40, 0xff, 0x00,
+		0x45, 0x0a, 0x40, 0x05, 0xff, 0xff, 0xdf, 0x9d, 0x40, 0xff, 0x00, 0x20, 0x57, 0x00, 0xff, 0xff,
+		0xd4, 0xf8, 0xc0, 0xff, 0x00, 0x11, 0x47, 0x80, 0xff, 0xff, 0xd5, 0x6c, 0xc0, 0x8b, 0xff, 0xff,
+		0xbe, 0x37, 0x00, 0x8b, 0xff, 0xff, 0xc6, 0xd4, 0xc0, 0xff, 0xff, 0xd6, 0x92, 0x00, 0xff, 0xff,
+		0xe3, 0xaf, 0xc0, 0xff, 0xff, 0xc6, 0x9e, 0x80, 0x08, 0xff, 0x00, 0x02, 0x97, 0x00, 0xff, 0x00,
+		0x58, 0x06, 0xc0, 0x05, 0x0e, 0xff, 0x00, 0x91, 0xd8, 0xc0, 0xff, 0x02, 0x86, 0x63, 0x00, 0x15,
+		0x67, 0x0a, 0xff, 0xff, 0xec, 0x1c, 0x80, 0xff, 0xfe, 0xb3, 0xf8, 0xc0, 0x15, 0x3e, 0x0a, 0xff,
+		0x00, 0x68, 0xfd, 0x40, 0xff, 0x00, 0x9d, 0x50, 0x00, 0x15, 0x3f, 0x0a, 0xff, 0xff, 0xba, 0x5e,
+		0x00, 0xff, 0xfe, 0x40, 0xbf, 0xc0, 0x15, 0x40, 0x0a, 0x0e, 0xff, 0x01, 0x9a, 0xc9, 0xc0, 0xff,
+		0x03, 0x2a, 0x5b, 0x80, 0x15, 0x6c, 0x0a, 0xff, 0xff, 0x1f, 0x9e, 0xc0, 0xff, 0x00, 0x40, 0xb9,
+		0xc0, 0x15, 0x6d, 0x0a, 0x0e, 0xff, 0x01, 0x2e, 0x0c, 0xc0, 0xff, 0x02, 0x81, 0x35, 0x80, 0x15,
+		0xff, 0xff, 0x37, 0xc8, 0xc0, 0xff, 0xfe, 0xff, 0xb0, 0x80, 0x8b, 0xff, 0xff, 0xdc, 0x9d, 0xc0,
+		0xff, 0x00, 0xb6, 0x17, 0xc0, 0x8b, 0x8b, 0xff, 0xff, 0x9e, 0x7b, 0x40, 0xff, 0x00, 0x38, 0xf5,
+		0x40, 0x8b, 0x8b, 0xff, 0x00, 0x60, 0xa8, 0x00, 0xff, 0x00, 0x3e, 0xff, 0xc0, 0x8b, 0x8b, 0xff,
+		0x00, 0x2f, 0x77, 0x00, 0xff, 0xff, 0xc1, 0x00, 0x40, 0x8b, 0x8b, 0xff, 0x00, 0xf5, 0x17, 0x80,
+		0x05, 0xff, 0xff, 0xc7, 0xe7, 0xc0, 0xff, 0xff, 0x9e, 0x7b, 0x40, 0x15, 0xff, 0xff, 0x6c, 0x6d,
+		0x40, 0xff, 0xff, 0x8a, 0xa1, 0xc0, 0x07, 0x0e, 0xff, 0x00, 0x4b, 0xf1, 0xc0, 0xff, 0xff, 0xef,
+		0x9a, 0x40, 0x15, 0x68, 0x0a, 0x0e, 0xff, 0x00, 0x32, 0xea, 0xc0, 0x16, 0xff, 0x00, 0x49, 0x5b,
+		0x00, 0xff, 0x01, 0x9c, 0x83, 0x80, 0x06, 0x8b, 0xff, 0x00, 0x21, 0x29, 0x40, 0xff, 0x00, 0x03,
+		0x93, 0x00, 0xff, 0x00, 0x18, 0x67, 0xc0, 0xff, 0x00, 0x13, 0x4a, 0x80, 0xff, 0x00, 0x1b, 0x87,
+		0x40, 0xff, 0x00, 0x16, 0x3d, 0x80, 0xff, 0x00, 0x1f, 0xbc, 0x00, 0xff, 0x00, 0x32, 0x6e, 0xc0,
+		0xff, 0x00, 0x2a, 0x02, 0x80, 0xff, 0x00, 0x36, 0x16, 0x00, 0x8b, 0xff, 0x00, 0x25, 0x93, 0x40,
+		0x8b, 0xff, 0x00, 0x21, 0x5b, 0x00, 0xff, 0xff, 0xeb, 0xb6, 0x40, 0xff, 0x00, 0x11, 0xc5, 0x40,
+		0xff, 0xff, 0xdc, 0x8d, 0x80, 0xff, 0x00, 0x0f, 0x74, 0xc0, 0xff, 0xff, 0xe1, 0x2b, 0x40, 0xff,
+		0xff, 0xff, 0xf0, 0xc0, 0xff, 0xff, 0xde, 0x56, 0x00, 0x8b, 0xff, 0xff, 0xe2, 0xe2, 0x80, 0x08,
+		0xff, 0xff, 0x04, 0x01, 0x00, 0x07, 0x8b, 0xff, 0xff, 0xe8, 0x61, 0x40, 0xff, 0xff, 0xff, 0xe8,
+		0x80, 0xff, 0xff, 0xe5, 0x10, 0x80, 0xff, 0xff, 0xf4, 0xf3, 0x80, 0xff, 0xff, 0xe8, 0x85, 0xc0,
+		0xff, 0xff, 0xf2, 0xa0, 0xc0, 0xff, 0xff, 0xe3, 0x95, 0x80, 0xff, 0xff, 0xe6, 0x93, 0x40, 0xff,
+		0xff, 0xf0, 0x89, 0xc0, 0xff, 0xff, 0xe3, 0xc7, 0x80, 0x8b, 0xff, 0xff, 0xe8, 0x75, 0x40, 0x8b,
+		0xff, 0xff, 0xed, 0x8d, 0x00, 0xff, 0x00, 0x0a, 0xcb, 0x40, 0xff, 0xff, 0xfd, 0xf4, 0x40, 0xff,
+		0x00, 0x01, 0x7e, 0x00, 0xff, 0xff, 0xfb, 0xd1, 0x80, 0xff, 0x00, 0x03, 0x0d, 0x00, 0xff, 0xff,
+		0xff, 0x37, 0x40, 0xff, 0x00, 0x05, 0x26, 0x40, 0xff, 0xff, 0xfa, 0x42, 0x40, 0xff, 0x00, 0x03,
+		0x5b, 0xc0, 0x08, 0xff, 0xff, 0xdc, 0x9e, 0x00, 0xff, 0xff, 0xc1, 0xdd, 0x00, 0x05, 0xff, 0x00,
+		0x1a, 0xd0, 0xc0, 0xff, 0xff, 0xf0, 0x06, 0x00, 0xff, 0x00, 0x1e, 0x53, 0x80, 0xff, 0xff, 0xf7,
+		0x9e, 0xc0, 0xff, 0x00, 0x1e, 0x9d, 0xc0, 0x8b, 0xff, 0x00, 0x39, 0xc1, 0xc0, 0x8b, 0xff, 0x00,
+		0x33, 0xe7, 0xc0, 0xff, 0x00, 0x1d, 0xb6, 0xc0, 0xff, 0x00, 0x18, 0xbd, 0x00, 0xff, 0x00, 0x34,
+		0x9a, 0x80, 0xff, 0x00, 0x10, 0x45, 0x40, 0xff, 0x00, 0x22, 0x98, 0xc0, 0xff, 0x00, 0x00, 0x9f,
+		0x40, 0xff, 0x00, 0x22, 0x32, 0xc0, 0x8b, 0xff, 0x00, 0x22, 0xa0, 0x40, 0x08, 0xff, 0x00, 0xf8,
+		0x8b, 0x40, 0x8b, 0x07, 0x8b, 0xff, 0x00, 0x27, 0x69, 0xc0, 0xff, 0xff, 0xff, 0x77, 0x00, 0xff,
+		0x00, 0x27, 0xe1, 0x80, 0xff, 0xff, 0xed, 0xc2, 0x40, 0xff, 0x00, 0x27, 0xd2, 0x40, 0xff, 0xff,
+		0xe5, 0x48, 0xc0, 0xff, 0x00, 0x3a, 0x51, 0x40, 0xff, 0xff, 0xc8, 0x8e, 0x80, 0xff, 0x00, 0x21,
+		0x26, 0x80, 0xff, 0xff, 0xc2, 0x77, 0x00, 0x8b, 0xff, 0xff, 0xbe, 0x75, 0x00, 0x8b, 0xff, 0xff,
+		0xc2, 0xf6, 0xc0, 0x66, 0xff, 0xff, 0xdc, 0x90, 0x00, 0xff, 0xff, 0xc8, 0xa5, 0xc0, 0x08, 0xff,
+		0x00, 0x51, 0x1f, 0x40, 0xff, 0xff, 0xb6, 0xa5, 0x00, 0x07, 0x0e, 0xff, 0x00, 0xe9, 0x8f, 0x80,
+		0xff, 0x01, 0x99, 0xf5, 0xc0, 0x15, 0xff, 0x00, 0x28, 0x0e, 0x40, 0x8b, 0xff, 0x00, 0x3b, 0x05,
+		0x40, 0xff, 0xff, 0xea, 0xb8, 0x80, 0xff, 0x00, 0x12, 0x14, 0x00, 0xff, 0xff, 0xbc, 0x2c, 0x00,
+		0xff, 0x00, 0x05, 0xaa, 0x00, 0xff, 0xff, 0xea, 0xc0, 0xc0, 0xff, 0x00, 0x02, 0x04, 0x40, 0xff,
+		0xff, 0xe6, 0x80, 0x40, 0x8b, 0xff, 0xff, 0xcd, 0x00, 0x80, 0x8b, 0xff, 0xff, 0xdd, 0x8e, 0x00,
+		0xff, 0xff, 0xfd, 0xe3, 0x40, 0xff, 0xff, 0xe6, 0x65, 0x40, 0xff, 0xff, 0xf8, 0x97, 0xc0, 0xff,
+		0xff, 0xe8, 0xee, 0x80, 0xff, 0xff, 0xee, 0x67, 0xc0, 0xff, 0xff, 0xc9, 0x34, 0x00, 0xff, 0xff,
+		0xd0, 0xb7, 0x40, 0xff, 0xff, 0xe0, 0x26, 0x00, 0xff, 0xff, 0xd0, 0x5a, 0x40, 0x8b, 0x08, 0xff,
+		0xff, 0xcc, 0x46, 0xc0, 0xff, 0xff, 0xb3, 0x23, 0xc0, 0xff, 0x00, 0x28, 0x2d, 0x00, 0xff, 0x00,
+		0x96, 0x7a, 0xc0, 0xff, 0x00, 0x82, 0x0f, 0xc0, 0xff, 0x00, 0x49, 0x3b, 0x00, 0xff, 0x00, 0x23,
+		0xe6, 0xc0, 0xff, 0x00, 0x34, 0x90, 0x80, 0x1f, 0xff, 0x00, 0xc6, 0x13, 0x40, 0xff, 0x00, 0x85,
+		0xbb, 0x00, 0x15, 0xff, 0x00, 0x2b, 0xe0, 0x80, 0xff, 0x00, 0x35, 0x81, 0x80, 0xff, 0xff, 0xd4,
+		0x0b, 0xc0, 0x06, 0xff, 0xff, 0xff, 0xf1, 0x00, 0xff, 0x00, 0x27, 0xb2, 0xc0, 0x05, 0xff, 0xff,
+		0xff, 0xfe, 0x00, 0xff, 0x00, 0x05, 0x36, 0x40, 0xff, 0x00, 0x00, 0x73, 0xc0, 0xff, 0x00, 0x02,
+		0xcc, 0x40, 0xff, 0x00, 0x03, 0x90, 0x40, 0xff, 0x00, 0x05, 0x82, 0x40, 0xff, 0x00, 0x02, 0x0f,
+		0xc0, 0xff, 0x00, 0x03, 0x30, 0x00, 0xff, 0x00, 0x03, 0xcb, 0x40, 0xff, 0x00, 0x04, 0xf7, 0xc0,
+		0xff, 0xff, 0xff, 0xa1, 0x40, 0xff, 0x00, 0x06, 0xce, 0x00, 0x08, 0xff, 0xff, 0xb3, 0x31, 0x40,
+		0xff, 0xff, 0xbb, 0xd2, 0xc0, 0xff, 0xff, 0xb4, 0x0e, 0x80, 0xff, 0xff, 0xca, 0x7e, 0x80, 0xff,
+		0x00, 0x4b, 0xf1, 0x80, 0xff, 0xff, 0x66, 0x62, 0xc0, 0x06, 0xff, 0xff, 0xea, 0x09, 0xc0, 0xff,
+		0x00, 0x2e, 0xf5, 0x00, 0xff, 0xff, 0xcf, 0x1d, 0x40, 0xff, 0x00, 0x1f, 0xa7, 0x00, 0xff, 0xff,
+		0xc0, 0xdf, 0x40, 0x8b, 0x08, 0xff, 0xff, 0xa8, 0xeb, 0x00, 0xff, 0xff, 0x96, 0xd7, 0xc0, 0xff,
+		0xff, 0xc2, 0x23, 0xc0, 0xff, 0xff, 0x51, 0x65, 0xc0, 0xff, 0xff, 0x57, 0x5a, 0x80, 0xff, 0x00,
+		0x5d, 0x5a, 0x80, 0xff, 0xff, 0xb6, 0x4a, 0x40, 0xff, 0x00, 0x58, 0x4f, 0x80, 0x1f, 0xff, 0x00,
+		0x3a, 0x6c, 0x00, 0x8b, 0xff, 0x00, 0x35, 0xfc, 0x80, 0xff, 0x00, 0x20, 0x36, 0x00, 0xff, 0x00,
+		0x1c, 0xb1, 0x00, 0xff, 0x00, 0x33, 0x47, 0x40, 0x08, 0xff, 0xff, 0xd8, 0x4d, 0x40, 0x07, 0x8b,
+		0xff, 0xff, 0xf5, 0x25, 0x40, 0xff, 0x00, 0x00, 0xa7, 0x40, 0xff, 0xff, 0xf4, 0x49, 0x00, 0xff,
+		0x00, 0x03, 0xa9, 0x40, 0xff, 0xff, 0xf4, 0xe9, 0x80, 0x08, 0xff, 0x00, 0x47, 0xa1, 0x00, 0x06,
+		0xff, 0xff, 0xfc, 0x65, 0xc0, 0xff, 0x00, 0x0d, 0xfd, 0x40, 0xff, 0xff, 0xff, 0x4e, 0xc0, 0xff,
+		0x00, 0x0e, 0x78, 0x00, 0xff, 0xff, 0xff, 0xfb, 0x00, 0xff, 0x00, 0x0d, 0xd4, 0x40, 0x08, 0x0e,
+		0xff, 0x00, 0x91, 0xd8, 0xc0, 0xff, 0x03, 0x16, 0x82, 0x00, 0x15, 0x67, 0x0a, 0xff, 0x00, 0x83,
+		0x65, 0xc0, 0xff, 0xff, 0x5e, 0xa3, 0x40, 0x15, 0x2c, 0x0a, 0x0e, 0xff, 0x00, 0xed, 0x54, 0x00,
+		0xff, 0x03, 0x17, 0x5f, 0x00, 0x15, 0x42, 0x0a, 0xff, 0xff, 0x6a, 0xb2, 0xc0, 0xff, 0xff, 0x57,
+		0xb7, 0x00, 0x15, 0x2d, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0,
+		0x15, 0x60, 0x0a, 0xff, 0xff, 0x00, 0x8d, 0x40, 0xff, 0xff, 0x37, 0xc8, 0xc0, 0x15, 0x49, 0x0a,
+		0x0e, 0xff, 0x01, 0xe3, 0x23, 0xc0, 0xff, 0x02, 0x7f, 0x30, 0xc0, 0x15, 0xff, 0x00, 0x28, 0xf0,
+		0x80, 0xff, 0xff, 0xe4, 0xe4, 0x00, 0xff, 0x00, 0x19, 0x67, 0x80, 0xff, 0xff, 0xe3, 0x8b, 0x80,
+		0xff, 0xff, 0xe5, 0xab, 0xc0, 0xff, 0xff, 0xec, 0x47, 0xc0, 0xff, 0xff, 0xea, 0x8b, 0x00, 0xff,
+		0xff, 0xe7, 0xd6, 0x40, 0x1e, 0x8b, 0xff, 0xff, 0xea, 0x7d, 0x40, 0xff, 0x00, 0x0f, 0x3d, 0x40,
+		0xff, 0xff, 0xf6, 0xcd, 0x40, 0xff, 0x00, 0x07, 0x11, 0x80, 0xff, 0xff, 0xfb, 0x4c, 0x80, 0xff,
+		0x00, 0x06, 0xf3, 0x40, 0xff, 0xff, 0xfb, 0x60, 0xc0, 0xff, 0x00, 0x0b, 0xca, 0x40, 0xff, 0xff,
+		0xf8, 0xa2, 0x00, 0x8b, 0xff, 0xff, 0xef, 0x88, 0x00, 0x8b, 0xff, 0xff, 0xf2, 0xc2, 0xc0, 0xff,
+		0xff, 0xf8, 0x0f, 0x80, 0xff, 0xff, 0xf2, 0x53, 0xc0, 0xff, 0xff, 0xfc, 0x17, 0xc0, 0xff, 0xff,
+		0xf9, 0x95, 0x00, 0xff, 0xff, 0xf8, 0x2f, 0xc0, 0xff, 0xff, 0xf3, 0x29, 0x80, 0xff, 0xff, 0xf2,
+		0x8f, 0x00, 0xff, 0xff, 0xec, 0x88, 0x40, 0xff, 0xff, 0xed, 0x06, 0xc0, 0xff, 0xff, 0xee, 0x8d,
+		0x00, 0x08, 0xff, 0x00, 0x1b, 0x9d, 0x80, 0xff, 0xff, 0xe7, 0xd6, 0x00, 0x05, 0xff, 0x00, 0x37,
+		0xb8, 0x40, 0xff, 0x00, 0x38, 0x92, 0xc0, 0xff, 0x00, 0x1d, 0x4e, 0x40, 0xff, 0x00, 0x34, 0x2b,
+		0x40, 0x8b, 0xff, 0x00, 0x29, 0xa6, 0xc0, 0x08, 0xff, 0xfe, 0xbf, 0x1a, 0xc0, 0xff, 0xff, 0xc3,
+		0xe2, 0x00, 0x15, 0x4b, 0x0a, 0x0e, 0xff, 0x01, 0x23, 0xb1, 0xc0, 0xff, 0x02, 0xbb, 0x07, 0xc0,
+		0x15, 0x60, 0x0a, 0xff, 0xfe, 0xe4, 0x12, 0x80, 0xff, 0xff, 0x38, 0xa5, 0x80, 0x15, 0x4e, 0x0a,
+		0x0e, 0xff, 0x01, 0x54, 0xe2, 0xc0, 0xff, 0x01, 0x28, 0x70, 0x00, 0x15, 0xff, 0x00, 0x2d, 0xc4,
+		0x40, 0xff, 0xff, 0xda, 0x19, 0xc0, 0xff, 0x00, 0x25, 0x84, 0x40, 0xff, 0xff, 0xd0, 0xde, 0xc0,
+		0xff, 0xff, 0xd0, 0xdd, 0x00, 0xff, 0xff, 0xda, 0x20, 0x40, 0xff, 0xff, 0xda, 0x78, 0x00, 0xff,
+		0xff, 0xd2, 0x41, 0xc0, 0xff, 0xff, 0xd2, 0x33, 0x80, 0xff, 0x00, 0x25, 0xe7, 0x00, 0xff, 0xff,
+		0xda, 0x7c, 0x40, 0xff, 0x00, 0x2f, 0x19, 0x00, 0xff, 0x00, 0x2f, 0x28, 0x00, 0xff, 0x00, 0x25,
+		0xe2, 0x40, 0xff, 0x00, 0x25, 0x8b, 0x00, 0xff, 0x00, 0x2d, 0xc3, 0x00, 0x1e, 0x0e, 0xff, 0x01,
+		0xdf, 0xd4, 0x00, 0xff, 0x02, 0x6c, 0x7f, 0x40, 0x15, 0xff, 0xff, 0xe4, 0x50, 0x40, 0xff, 0x00,
+		0x21, 0x50, 0x40, 0x62, 0xff, 0x00, 0x13, 0x54, 0x40, 0xff, 0xff, 0xd5, 0x26, 0x40, 0x8b, 0xff,
+		0xff, 0xcb, 0x67, 0xc0, 0x8b, 0xff, 0xff, 0xcc, 0xf8, 0x80, 0xff, 0xff, 0xe2, 0xde, 0x80, 0xff,
+		0xff, 0xe4, 0x80, 0x00, 0xff, 0xff, 0xc8, 0xef, 0x40, 0xff, 0xff, 0xed, 0x34, 0x40, 0xff, 0xff,
+		0xda, 0x5d, 0x80, 0xff, 0xff, 0xfc, 0xc3, 0x00, 0xff, 0xff, 0xd9, 0x10, 0x80, 0xff, 0xff, 0xfd,
+		0x2a, 0x40, 0xff, 0xff, 0xda, 0x47, 0x00, 0x08, 0xff, 0xff, 0xf9, 0x20, 0x80, 0xff, 0xff, 0xa4,
+		0x85, 0x80, 0xff, 0xff, 0x82, 0xd5, 0x80, 0x8b, 0x8b, 0xff, 0xff, 0xc7, 0x0a, 0xc0, 0xff, 0x00,
+		0x78, 0xe2, 0x80, 0x8b, 0xff, 0xff, 0xe9, 0x7f, 0x40, 0xff, 0xfe, 0xd4, 0x8a, 0x00, 0x05, 0xff,
+		0xff, 0xfd, 0xb9, 0x80, 0xff, 0xff, 0xe1, 0xb8, 0x80, 0xff, 0xff, 0xfc, 0xe2, 0x80, 0xff, 0xff,
+		0xda, 0x7a, 0x80, 0xff, 0xff, 0xef, 0x2e, 0x00, 0xff, 0xff, 0xe1, 0x29, 0xc0, 0xff, 0xff, 0xf1,
+		0x4c, 0xc0, 0xff, 0xff, 0xe5, 0x0c, 0xc0, 0xff, 0xff, 0xeb, 0xe5, 0xc0, 0xff, 0xff, 0xf6, 0xfd,
+		0x80, 0xff, 0xff, 0xef, 0x97, 0x00, 0x8b, 0xff, 0xff, 0xee, 0x48, 0x00, 0x8b, 0xff, 0xff, 0xf3,
+		0x32, 0xc0, 0xff, 0x00, 0x0a, 0x29, 0x80, 0xff, 0xff, 0xfa, 0x78, 0xc0, 0xff, 0x00, 0x09, 0x02,
+		0x40, 0xff, 0xff, 0xfd, 0x72, 0x40, 0xff, 0x00, 0x04, 0x29, 0x40, 0xff, 0xff, 0xfe, 0x1b, 0x40,
+		0xff, 0x00, 0x05, 0x97, 0x40, 0xff, 0xff, 0xf9, 0xf6, 0x80, 0xff, 0x00, 0x02, 0xfa, 0x40, 0x08,
+		0xff, 0xff, 0xd7, 0x70, 0x80, 0xff, 0xff, 0xc0, 0x23, 0x80, 0x05, 0xff, 0x00, 0x14, 0xc9, 0x40,
+		0xff, 0xff, 0xe9, 0x80, 0xc0, 0xff, 0x00, 0x1d, 0x79, 0xc0, 0xff, 0xff, 0xf3, 0x1c, 0xc0, 0xff,
+		0x00, 0x1f, 0x1f, 0x00, 0x8b, 0xff, 0x00, 0x29, 0x26, 0x00, 0x8b, 0xff, 0x00, 0x2c, 0x41, 0x80,
+		0xff, 0x00, 0x16, 0x90, 0x80, 0xff, 0x00, 0x1c, 0xa9, 0x00, 0xff, 0x00, 0x30, 0xdb, 0x80, 0xff,
+		0x00, 0x17, 0x74, 0xc0, 0xff, 0x00, 0x27, 0xfc, 0x40, 0xff, 0x00, 0x05, 0x5b, 0xc0, 0xff, 0x00,
+		0x2b, 0x74, 0x80, 0xff, 0x00, 0x03, 0x92, 0x00, 0xff, 0x00, 0x2c, 0x7e, 0x00, 0x08, 0xff, 0x00,
+		0x18, 0x3c, 0x00, 0xff, 0x01, 0x2e, 0x0c, 0xc0, 0xff, 0x00, 0x7f, 0xa7, 0x40, 0x8b, 0x8b, 0xff,
+		0x00, 0x38, 0xf5, 0x40, 0xff, 0xff, 0x84, 0xea, 0xc0, 0x8b, 0xff, 0x00, 0x06, 0x94, 0x00, 0xff,
+		0x00, 0x51, 0xfc, 0x40, 0x05, 0xff, 0x00, 0x02, 0x86, 0xc0, 0xff, 0x00, 0x1f, 0x7e, 0x00, 0xff,
+		0x00, 0x01, 0x2f, 0xc0, 0xff, 0x00, 0x26, 0x3e, 0x40, 0xff, 0x00, 0x0e, 0x21, 0x00, 0xff, 0x00,
+		0x1f, 0x34, 0x00, 0xff, 0x00, 0x10, 0x5d, 0x80, 0xff, 0x00, 0x24, 0x24, 0x00, 0xff, 0x00, 0x1c,
+		0xa4, 0xc0, 0xff, 0x00, 0x0e, 0x36, 0x80, 0xff, 0x00, 0x19, 0x30, 0x40, 0x8b, 0xff, 0x00, 0x21,
+		0x0b, 0x00, 0x8b, 0xff, 0x00, 0x18, 0x89, 0x80, 0xff, 0xff, 0xe9, 0x10, 0x00, 0xff, 0x00, 0x09,
+		0x45, 0x00, 0xff, 0xff, 0xec, 0x6a, 0x80, 0xff, 0x00, 0x02, 0x81, 0x80, 0xff, 0xff, 0xfa, 0xb4,
+		0xc0, 0xff, 0xff, 0xff, 0x50, 0x40, 0xff, 0xff, 0xfd, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc9, 0x00,
+		0xff, 0xff, 0xfc, 0x1b, 0x00, 0xff, 0x00, 0x01, 0x27, 0x80, 0xff, 0xff, 0xfa, 0x47, 0x40, 0xff,
+		0x00, 0x03, 0xee, 0x40, 0xff, 0xff, 0xfe, 0x09, 0xc0, 0xff, 0x00, 0x03, 0x1e, 0x40, 0xff, 0xff,
+		0xff, 0xfd, 0x00, 0x08, 0x0e, 0xff, 0x00, 0xd8, 0x9d, 0x00, 0xff, 0x02, 0x8c, 0x6d, 0x80, 0x15,
+		0xff, 0xff, 0x3c, 0x19, 0x80, 0xff, 0xff, 0x58, 0x94, 0x00, 0xff, 0xff, 0xc4, 0x74, 0x00, 0xff,
+		0x00, 0xa7, 0x6c, 0x00, 0xff, 0xfd, 0xdb, 0xfe, 0x80, 0xff, 0x00, 0x43, 0x50, 0x40, 0xff, 0x02,
+		0x24, 0x01, 0x80, 0xff, 0x00, 0xa5, 0xb2, 0x40, 0xff, 0x00, 0x3b, 0x8c, 0x00, 0xff, 0xff, 0x5a,
+		0x4d, 0xc0, 0xff, 0x00, 0xc3, 0xe6, 0x80, 0x07, 0x0e, 0xff, 0x00, 0xd8, 0x9d, 0x00, 0xff, 0x02,
+		0x8c, 0x6d, 0x80, 0x15, 0xff, 0xff, 0x3c, 0x19, 0x80, 0xff, 0xff, 0x58, 0x94, 0x00, 0xff, 0xff,
+		0xc4, 0x74, 0x00, 0xff, 0x00, 0xa7, 0x6c, 0x00, 0xff, 0xfe, 0xeb, 0xd7, 0x00, 0xff, 0xff, 0x58,
+		0x94, 0x00, 0xff, 0xff, 0xc4, 0x74, 0x00, 0xff, 0x00, 0xa7, 0x6c, 0x00, 0xff, 0xff, 0x2b, 0xb3,
+		0x80, 0xff, 0x00, 0x43, 0x50, 0x40, 0xff, 0x00, 0xd4, 0x4c, 0x80, 0xff, 0x00, 0xa5, 0xb2, 0x40,
+		0xff, 0x00, 0x3b, 0x8c, 0x00, 0xff, 0xff, 0x5a, 0x4d, 0xc0, 0xff, 0x01, 0x14, 0x29, 0x00, 0x07,
+		0xff, 0x00, 0xa5, 0xb2, 0x40, 0xff, 0x00, 0x3b, 0x8c, 0x00, 0xff, 0xff, 0x5a, 0x4d, 0xc0, 0xff,
+		0x00, 0xc3, 0xe6, 0x80, 0x06, 0x0e, 0xff, 0x00, 0xee, 0xaa, 0x00, 0xff, 0x02, 0x7a, 0x97, 0x00,
+		0x15, 0xff, 0xff, 0x23, 0x24, 0x80, 0xff, 0xff, 0xd8, 0x06, 0x80, 0xff, 0x00, 0x55, 0xf1, 0xc0,
+		0xff, 0xfe, 0xed, 0x2d, 0x80, 0xff, 0x00, 0x2c, 0xf8, 0xc0, 0xff, 0x01, 0x12, 0xd2, 0x80, 0xff,
+		0x00, 0x59, 0xf1, 0x00, 0x06, 0xff, 0x00, 0x3f, 0xf5, 0x80, 0xff, 0x00, 0x27, 0xf9, 0x80, 0x15,
+		0xff, 0xff, 0xdd, 0x05, 0xc0, 0xff, 0xfe, 0xc5, 0x34, 0x00, 0xff, 0x00, 0x29, 0xf9, 0x00, 0xff,
+		0x00, 0xd6, 0xdc, 0x80, 0x06, 0xff, 0x00, 0x36, 0xf7, 0x00, 0xff, 0xff, 0x95, 0x11, 0xc0, 0xff,
+		0x00, 0x0f, 0xfd, 0x80, 0x8a, 0xff, 0x00, 0x1d, 0x7b, 0x00, 0xff, 0x00, 0x35, 0x77, 0x40, 0xff,
+		0x00, 0x1e, 0x7a, 0xc0, 0xff, 0x00, 0x36, 0x77, 0x00, 0x8b, 0xff, 0xff, 0x29, 0x23, 0x80, 0xff,
+		0x00, 0x29, 0xf9, 0x00, 0x8b, 0x8b, 0xff, 0x01, 0x3a, 0xcc, 0x00, 0xff, 0xff, 0xdf, 0x05, 0x80,
+		0x8b, 0xff, 0xff, 0xda, 0x86, 0x40, 0xff, 0xff, 0xb7, 0x8c, 0x00, 0xff, 0xff, 0xda, 0x86, 0x40,
+		0xff, 0xff, 0xb7, 0x8c, 0x00, 0x05, 0x0e, 0xff, 0xff, 0xf4, 0xc3, 0x80, 0xff, 0x00, 0x3f, 0xdd,
+		0x00, 0xff, 0x02, 0x01, 0x81, 0x40, 0xff, 0x00, 0x3d, 0x45, 0xc0, 0x01, 0xff, 0x00, 0x3e, 0xd7,
+		0xc0, 0xff, 0x00, 0x42, 0x94, 0x00, 0xff, 0x00, 0xf3, 0x80, 0xc0, 0xff, 0x00, 0x40, 0xa3, 0x80,
+		0x03, 0xff, 0x01, 0xb5, 0x90, 0x00, 0xff, 0x01, 0x34, 0xc7, 0xc0, 0x15, 0xff, 0x00, 0xc4, 0x36,
+		0xc0, 0xff, 0xff, 0xac, 0xf8, 0xc0, 0xff, 0x00, 0x7a, 0x69, 0x00, 0xff, 0xff, 0x97, 0xb2, 0x80,
+		0xff, 0xff, 0x92, 0xa6, 0x80, 0xff, 0xff, 0xb1, 0xf6, 0x00, 0xff, 0xff, 0x7c, 0xb6, 0x00, 0xff,
+		0xff, 0x36, 0x8b, 0x80, 0xff, 0xff, 0x3b, 0x3f, 0x80, 0xff, 0x00, 0x56, 0xad, 0x00, 0xff, 0xff,
+		0x92, 0xdb, 0x00, 0xff, 0x00, 0x62, 0x9d, 0x40, 0xff, 0x00, 0x6c, 0xcc, 0x00, 0xff, 0x00, 0x50,
+		0xa2, 0x00, 0xff, 0x00, 0x82, 0x0f, 0xc0, 0xff, 0x00, 0xbd, 0xf4, 0x80, 0x1e, 0xff, 0xff, 0x44,
+		0x05, 0x80, 0xff, 0x01, 0x01, 0x5a, 0x00, 0x15, 0xff, 0x00, 0x19, 0x1a, 0x40, 0x8b, 0xff, 0x00,
+		0x26, 0x0f, 0x00, 0xff, 0xff, 0xf3, 0x92, 0xc0, 0xff, 0x00, 0x1a, 0x95, 0x00, 0xff, 0xff, 0xc0,
+		0xda, 0x40, 0xff, 0x00, 0x13, 0x95, 0xc0, 0xff, 0xff, 0xd1, 0x78, 0x40, 0xff, 0x00, 0x0e, 0x03,
+		0x00, 0xff, 0xff, 0xae, 0x11, 0x00, 0x8b, 0xff, 0xff, 0xbd, 0x7d, 0x40, 0x8b, 0xff, 0xff, 0xcd,
+		0x52, 0x00, 0xff, 0xff, 0xf7, 0xb1, 0xc0, 0xff, 0xff, 0xb0, 0x06, 0x80, 0xff, 0xff, 0xe3, 0xce,
+		0x40, 0xff, 0xff, 0xcb, 0x6e, 0x40, 0xff, 0xff, 0xe5, 0x8e, 0x80, 0xff, 0xff, 0xce, 0xb2, 0x40,
+		0xff, 0xff, 0xdd, 0x88, 0x80, 0xff, 0xff, 0xf5, 0x92, 0x40, 0xff, 0xff, 0xe9, 0x27, 0x40, 0x8b,
+		0xff, 0xff, 0xe5, 0xb4, 0x00, 0x8b, 0xff, 0xff, 0xd8, 0x7e, 0xc0, 0xff, 0x00, 0x0d, 0xac, 0xc0,
+		0xff, 0xff, 0xe4, 0x6a, 0x00, 0xff, 0x00, 0x42, 0x53, 0x00, 0xff, 0xff, 0xef, 0x3c, 0x40, 0xff,
+		0x00, 0x28, 0x4d, 0xc0, 0xff, 0xff, 0xf2, 0xe8, 0x00, 0xff, 0x00, 0x42, 0xa9, 0x40, 0x8b, 0xff,
+		0x00, 0x3f, 0xed, 0x80, 0x08, 0x8b, 0xff, 0x00, 0x58, 0xa4, 0x80, 0xff, 0x00, 0x0f, 0x4f, 0xc0,
+		0xff, 0x00, 0x3f, 0xb8, 0x40, 0xff, 0x00, 0x14, 0x77, 0x80, 0xff, 0x00, 0x2c, 0xd0, 0x80, 0xff,
+		0x00, 0x19, 0x4e, 0xc0, 0xff, 0x00, 0x37, 0x6a, 0x80, 0xff, 0x00, 0x25, 0x4f, 0x40, 0xff, 0x00,
+		0x0a, 0x05, 0x40, 0xff, 0x00, 0x15, 0xc4, 0x80, 0x8b, 0x08, 0x0e, 0xf8, 0x88, 0x14, 0xef, 0x15,
+		0x7f, 0x97, 0xf8, 0x5d, 0x95, 0xf7, 0x30, 0x92, 0xae, 0x8f, 0x06, 0xfb, 0x40, 0x90, 0x07, 0x8b,
+		0x0c, 0x0a, 0xca, 0x0a, 0xc8, 0x8d, 0x0c, 0x0c, 0xcd, 0x0b, 0xcb, 0x8d, 0x0c, 0x0d, 0x1c, 0x00,
+		0x27, 0x13, 0x00, 0x4e, 0x02, 0x00, 0x01, 0x00, 0x96, 0x00, 0xcf, 0x01, 0x8c, 0x01, 0x9d, 0x01,
+		0xef, 0x02, 0x00, 0x02, 0x38, 0x02, 0x4a, 0x03, 0x69, 0x03, 0xde, 0x04, 0x54, 0x04, 0x8d, 0x05,
+		0xce, 0x06, 0x07, 0x06, 0x5b, 0x06, 0xd3, 0x07, 0x67, 0x07, 0xfa, 0x08, 0x7a, 0x08, 0xf0, 0x0a,
+		0xdc, 0x0b, 0x01, 0x0c, 0x40, 0x0c, 0x82, 0x0c, 0xe1, 0x0e, 0x0b, 0x0e, 0x91, 0x0f, 0x75, 0x10,
+		0x39, 0x10, 0x6f, 0x10, 0xc1, 0x12, 0xae, 0x13, 0x89, 0x13, 0xb8, 0x14, 0x0a, 0x14, 0xe4, 0x15,
+		0x13, 0x15, 0xf3, 0x16, 0x45, 0x16, 0x97, 0x17, 0x2a, 0x17, 0xf3, 0x19, 0xdb, 0x1b, 0x1f, 0x1c,
+		0x48, 0x1d, 0xc6, 0x1e, 0x21, 0x1e, 0x5b, 0x1e, 0x95, 0x1e, 0xe7, 0x1f, 0x39, 0x1f, 0x4a, 0x1f,
+		0x84, 0x1f, 0x95, 0x1f, 0xd3, 0x20, 0x25, 0x20, 0x77, 0x20, 0x97, 0x20, 0xb7, 0x20, 0xf1, 0x21,
+		0xb1, 0x22, 0x3a, 0x22, 0xc4, 0x22, 0xe4, 0x23, 0x04, 0x23, 0x3e, 0x23, 0x90, 0x23, 0xe2, 0x24,
+		0x34, 0x24, 0x86, 0x25, 0x43, 0x25, 0xc4, 0x25, 0xe4, 0x26, 0x26, 0x26, 0x32, 0x26, 0x7c, 0x26,
+		0x9c, 0x26, 0xbc, 0xff, 0x00, 0x2d, 0x40, 0x00, 0xff, 0xff, 0xe6, 0x9f, 0xc0, 0xff, 0x00, 0x10,
+		0x73, 0x00, 0xff, 0xff, 0xec, 0x5b, 0x40, 0xff, 0xff, 0xec, 0xb7, 0xc0, 0xff, 0xff, 0xe8, 0x99,
+		0x00, 0xff, 0xff, 0xf0, 0x9a, 0x00, 0xff, 0xff, 0xd8, 0x7d, 0x80, 0x1e, 0x8b, 0xff, 0xff, 0xea,
+		0x59, 0x00, 0xff, 0x00, 0x06, 0x43, 0xc0, 0xff, 0xff, 0xec, 0x02, 0x00, 0x8b, 0xff, 0xff, 0xea,
+		0x4a, 0x00, 0x8b, 0xff, 0xff, 0xec, 0x60, 0x00, 0xff, 0xff, 0xfb, 0xa3, 0x80, 0xff, 0xff, 0xed,
+		0x21, 0x80, 0xff, 0xff, 0xfa, 0x9b, 0x40, 0xff, 0xff, 0xef, 0x2c, 0x00, 0x08, 0xff, 0xff, 0xea,
+		0x6c, 0xc0, 0xff, 0xff, 0xbc, 0xaf, 0x80, 0xff, 0x00, 0x37, 0x3b, 0x80, 0xff, 0xff, 0xf2, 0x31,
+		0x40, 0xff, 0x00, 0x18, 0x2a, 0x00, 0xff, 0x00, 0x42, 0x73, 0x40, 0x05, 0xff, 0x00, 0x18, 0xde,
+		0x40, 0xff, 0x00, 0x44, 0x63, 0x80, 0xff, 0x00, 0x08, 0x81, 0x40, 0xff, 0x00, 0x1f, 0xe5, 0xc0,
+		0x8b, 0xff, 0x00, 0x1a, 0x45, 0xc0, 0x08, 0x0b, 0xff, 0xff, 0x55, 0x20, 0x00, 0xff, 0xff, 0x4f,
+		0x15, 0xc0, 0xff, 0xff, 0xc2, 0xba, 0x40, 0xff, 0x00, 0xb0, 0xea, 0x40, 0xff, 0xff, 0x44, 0xba,
+		0x80, 0xff, 0x00, 0x3e, 0xff, 0xc0, 0xff, 0x00, 0xbb, 0x45, 0x80, 0xff, 0x00, 0xaa, 0xdf, 0xc0,
+		0xff, 0x00, 0x3d, 0x45, 0xc0, 0xff, 0xff, 0x55, 0x20, 0x40, 0xff, 0x00, 0xaa, 0xe0, 0x00, 0x07,
+		0x0b, 0xff, 0x00, 0x33, 0x2c, 0x80, 0xff, 0xff, 0xde, 0x1d, 0x00, 0xff, 0x00, 0x1f, 0xc1, 0x80,
+		0xff, 0xff, 0xdc, 0x6e, 0x80, 0xff, 0xff, 0xdf, 0x16, 0xc0, 0xff, 0xff, 0xe7, 0x59, 0x80, 0xff,
+		0xff, 0xe5, 0x2d, 0x80, 0xff, 0xff, 0xe1, 0xcc, 0x00, 0x1e, 0x8b, 0xff, 0xff, 0xe5, 0x1c, 0x80,
+		0xff, 0x00, 0x13, 0x0c, 0xc0, 0xff, 0xff, 0xf4, 0x80, 0x80, 0xff, 0x00, 0x08, 0xd5, 0xc0, 0xff,
+		0xff, 0xfa, 0x1f, 0xc0, 0xff, 0x00, 0x08, 0xb0, 0x00, 0xff, 0xff, 0xfa, 0x38, 0xc0, 0xff, 0x00,
+		0x0e, 0xbc, 0xc0, 0xff, 0xff, 0xf6, 0xca, 0xc0, 0x8b, 0xff, 0xff, 0xeb, 0x69, 0xc0, 0x8b, 0xff,
+		0xff, 0xef, 0x73, 0x80, 0xff, 0xff, 0xf6, 0x13, 0x80, 0xff, 0xff, 0xee, 0xe8, 0xc0, 0xff, 0xff,
+		0xfb, 0x1d, 0xc0, 0xff, 0xff, 0xf7, 0xfa, 0x40, 0xff, 0xff, 0xf6, 0x3b, 0x80, 0xff, 0xff, 0xef,
+		0xf3, 0xc0, 0xff, 0xff, 0xef, 0x32, 0xc0, 0xff, 0xff, 0xe7, 0xaa, 0x80, 0xff, 0xff, 0xe8, 0x48,
+		0x80, 0xff, 0xff, 0xea, 0x30, 0x40, 0x08, 0xff, 0x00, 0x22, 0x85, 0x00, 0xff, 0xff, 0xe1, 0xcb,
+		0x80, 0x05, 0xff, 0x00, 0x45, 0xa6, 0x40, 0xff, 0x00, 0x46, 0xb7, 0x80, 0xff, 0x00, 0x24, 0xa1,
+		0xc0, 0xff, 0x00, 0x41, 0x36, 0x00, 0x8b, 0xff, 0x00, 0x34, 0x10, 0x80, 0x08, 0x0b, 0xff, 0xff,
+		0xbd, 0x8c, 0x80, 0xff, 0x01, 0x67, 0xdf, 0x00, 0xff, 0x00, 0x42, 0x73, 0x80, 0x07, 0x0b, 0xff,
+		0x00, 0x1f, 0x78, 0xc0, 0xff, 0xff, 0xe5, 0xb9, 0xc0, 0xff, 0x00, 0x19, 0xec, 0xc0, 0xff, 0xff,
+		0xdf, 0x20, 0x00, 0xff, 0xff, 0xdf, 0x23, 0x40, 0xff, 0xff, 0xe5, 0xbd, 0x00, 0xff, 0xff, 0xe6,
+		0x13, 0x80, 0xff, 0xff, 0xe0, 0x8a, 0x40, 0xff, 0xff, 0xe0, 0x7a, 0x00, 0xff, 0x00, 0x1a, 0x4a,
+		0x00, 0xff, 0xff, 0xe6, 0x16, 0x40, 0xff, 0x00, 0x20, 0xd1, 0x40, 0xff, 0x00, 0x20, 0xe3, 0x80,
+		0xff, 0x00, 0x1a, 0x47, 0x40, 0xff, 0x00, 0x19, 0xf0, 0x00, 0xff, 0x00, 0x1f, 0x7c, 0x80, 0x1e,
+		0x0b, 0xff, 0xff, 0xc2, 0xba, 0x40, 0xff, 0x01, 0x9a, 0xc9, 0xc0, 0xff, 0x00, 0x3d, 0x45, 0xc0,
+		0x07, 0x0b, 0xff, 0x00, 0x45, 0x0a, 0x40, 0x8b, 0xff, 0x00, 0x3c, 0x69, 0x00, 0xff, 0x00, 0xb6,
+		0xf4, 0xc0, 0xff, 0x00, 0xc5, 0xa0, 0x80, 0x8b, 0xff, 0x00, 0x45, 0x0a, 0x40, 0xff, 0xff, 0x49,
+		0xe8, 0x40, 0xff, 0x00, 0x48, 0x7e, 0x00, 0x8b, 0xff, 0xff, 0x0f, 0x39, 0x00, 0xff, 0x02, 0x7a,
+		0x4e, 0x00, 0xff, 0xff, 0xf8, 0x3b, 0xc0, 0x8b, 0x05, 0x0b, 0xff, 0xff, 0x57, 0xb7, 0x00, 0x8b,
+		0xff, 0x00, 0x50, 0x42, 0x80, 0xff, 0x00, 0xed, 0x53, 0x40, 0x05, 0x0b, 0xff, 0xff, 0x9f, 0x17,
+		0xc0, 0xff, 0xff, 0x73, 0xe2, 0x00, 0xff, 0xff, 0xb9, 0x18, 0x40, 0xff, 0xff, 0x06, 0x90, 0xc0,
+		0xff, 0xff, 0x0f, 0x43, 0x00, 0xff, 0x00, 0x85, 0xf2, 0x80, 0xff, 0xff, 0xb2, 0x75, 0x00, 0xff,
+		0x00, 0x66, 0xa3, 0x40, 0x1f, 0xff, 0x00, 0x4a, 0x4f, 0x80, 0x8b, 0xff, 0x00, 0x45, 0x73, 0xc0,
+		0xff, 0x00, 0x26, 0xd1, 0x80, 0xff, 0x00, 0x27, 0x19, 0x40, 0xff, 0x00, 0x3f, 0xe1, 0x40, 0x08,
+		0xff, 0xff, 0xcc, 0x38, 0x80, 0xff, 0x00, 0x21, 0xa8, 0x40, 0x05, 0xff, 0xff, 0xe3, 0x43, 0x80,
+		0xff, 0xff, 0xd0, 0x6f, 0x80, 0xff, 0xff, 0xce, 0x7a, 0x00, 0xff, 0xff, 0xe3, 0x9d, 0x80, 0xff,
+		0xff, 0xcf, 0x1a, 0x00, 0x8b, 0x08, 0xff, 0xff, 0xa4, 0x51, 0x00, 0xff, 0xff, 0xaf, 0x5e, 0x80,
+		0xff, 0x00, 0x5f, 0xa8, 0xc0, 0xff, 0x00, 0xa8, 0x65, 0xc0, 0xff, 0x00, 0xa5, 0x88, 0x40, 0xff,
+		0x00, 0x4e, 0x62, 0xc0, 0xff, 0x00, 0x5c, 0xad, 0x40, 0xff, 0x00, 0x58, 0x15, 0x40, 0x1f, 0xff,
+		0x00, 0x30, 0xc5, 0xc0, 0x8b, 0xff, 0x00, 0x2d, 0x76, 0x00, 0xff, 0xff, 0xe3, 0x1d, 0xc0, 0xff,
+		0x00, 0x19, 0x26, 0x00, 0xff, 0xff, 0xd4, 0x90, 0x80, 0xff, 0x00, 0x01, 0xfc, 0x40, 0xff, 0xff,
+		0xfc, 0x92, 0x80, 0xff, 0x00, 0x01, 0x75, 0x80, 0xff, 0xff, 0xfd, 0x6a, 0xc0, 0x8b, 0xff, 0xff,
+		0xfb, 0x59, 0xc0, 0x8b, 0xff, 0xff, 0xfd, 0x85, 0x00, 0xff, 0xff, 0xff, 0x93, 0x80, 0xff, 0xff,
+		0xfd, 0x82, 0x80, 0x8b, 0xff, 0xff, 0xfd, 0x83, 0x80, 0x8b, 0xff, 0xff, 0xfe, 0xd4, 0x40, 0xff,
+		0xff, 0xff, 0xf6, 0x00, 0xff, 0xff, 0xfa, 0x94, 0x00, 0xff, 0x00, 0x04, 0x99, 0x80, 0xff, 0xff,
+		0xfc, 0xc6, 0x80, 0x08, 0xff, 0x00, 0x42, 0x73, 0x80, 0xff, 0x00, 0x20, 0xcb, 0x80, 0x05, 0xff,
+		0xff, 0xde, 0x7e, 0x80, 0xff, 0x00, 0x4b, 0x1e, 0x00, 0xff, 0xff, 0xb5, 0x3c, 0x40, 0xff, 0x00,
+		0x30, 0x4a, 0x80, 0xff, 0xff, 0xad, 0x37, 0xc0, 0x8b, 0x08, 0x0b, 0xff, 0xfd, 0x90, 0x0d, 0x00,
+		0xff, 0x00, 0x85, 0xc4, 0x00, 0x07, 0xff, 0x00, 0x31, 0x87, 0x00, 0x8b, 0xff, 0x00, 0x29, 0x56,
+		0xc0, 0xff, 0x00, 0x02, 0x6d, 0x00, 0xff, 0x00, 0x2b, 0xed, 0x80, 0xff, 0x00, 0x16, 0x95, 0x40,
+		0xff, 0x00, 0x59, 0x53, 0xc0, 0xff, 0x00, 0x2d, 0xec, 0xc0, 0xff, 0x00, 0x30, 0xbe, 0x00, 0xff,
+		0x00, 0x6a, 0x28, 0x00, 0x8b, 0xff, 0x00, 0x88, 0x5a, 0x00, 0x8b, 0xff, 0x00, 0x77, 0xf8, 0x00,
+		0xff, 0xff, 0xdc, 0x6e, 0x80, 0xff, 0x00, 0x68, 0xfe, 0xc0, 0xff, 0xff, 0xaf, 0xdc, 0x40, 0xff,
+		0x00, 0x34, 0x25, 0x40, 0xff, 0xff, 0xd2, 0xba, 0x40, 0xff, 0x00, 0x1d, 0x75, 0x40, 0xff, 0xff,
+		0xd3, 0x26, 0xc0, 0xff, 0x00, 0x03, 0xf0, 0xc0, 0xff, 0xff, 0xc9, 0x0c, 0x00, 0x8b, 0x08, 0x0b,
+		0xff, 0x00, 0x4b, 0x14, 0xc0, 0x06, 0xff, 0x00, 0x27, 0x42, 0x40, 0x8b, 0xff, 0x00, 0x27, 0x6a,
+		0xc0, 0xff, 0xff, 0xfd, 0xbf, 0x40, 0xff, 0x00, 0x26, 0x90, 0x00, 0xff, 0xff, 0xe0, 0x09, 0x40,
+		0xff, 0x00, 0x39, 0xe7, 0x40, 0xff, 0xff, 0xd0, 0x01, 0xc0, 0xff, 0x00, 0x13, 0x56, 0x40, 0xff,
+		0xff, 0xa7, 0x59, 0xc0, 0x8b, 0xff, 0xff, 0xa6, 0x84, 0xc0, 0x8b, 0xff, 0xff, 0x89, 0x38, 0xc0,
+		0xff, 0xff, 0xd8, 0x98, 0x40, 0xff, 0xff, 0xbb, 0xa4, 0xc0, 0xff, 0xff, 0xce, 0x37, 0x00, 0xff,
+		0xff, 0xde, 0x68, 0x40, 0xff, 0xff, 0xd8, 0xef, 0xc0, 0xff, 0xff, 0xe5, 0xa4, 0x40, 0xff, 0xff,
+		0xd9, 0xbc, 0x00, 0xff, 0xff, 0xfe, 0x41, 0xc0, 0xff, 0xff, 0xd8, 0xd2, 0x80, 0x8b, 0x08, 0xff,
+		0xff, 0xc0, 0x23, 0x40, 0x06, 0x0b, 0xff, 0xfd, 0x90, 0x0d, 0x00, 0xff, 0x01, 0x7b, 0xb8, 0x80,
+		0xff, 0x00, 0x3e, 0x22, 0xc0, 0xff, 0xfe, 0xc6, 0xbb, 0x00, 0xff, 0x00, 0xe7, 0x48, 0xc0, 0xff,
+		0x01, 0x04, 0xa0, 0x40, 0xff, 0x00, 0x3f, 0xdc, 0xc0, 0xff, 0xfe, 0xfb, 0x5f, 0xc0, 0xff, 0x00,
+		0xcc, 0x88, 0x00, 0xff, 0x01, 0x3b, 0xdb, 0xc0, 0xff, 0x00, 0x3e, 0x22, 0xc0, 0x07, 0x0b, 0xff,
+		0xff, 0xad, 0x22, 0x40, 0xff, 0xff, 0x61, 0xc5, 0x40, 0xff, 0xff, 0xcc, 0x58, 0x00, 0xff, 0xfe,
+		0xee, 0x9b, 0x80, 0xff, 0xff, 0x14, 0x2c, 0xc0, 0xff, 0x00, 0x84, 0x0a, 0xc0, 0xff, 0xff, 0xb2,
+		0x31, 0x80, 0xff, 0x00, 0x6c, 0xbb, 0x80, 0x1f, 0xff, 0x00, 0x39, 0xb7, 0x80, 0x8b, 0xff, 0x00,
+		0x42, 0x99, 0x40, 0xff, 0x00, 0x15, 0x84, 0x00, 0xff, 0x00, 0x3a, 0xbd, 0x80, 0xff, 0x00, 0x2b,
+		0x40, 0x80, 0x08, 0xff, 0x00, 0xf3, 0x5d, 0x80, 0xff, 0xff, 0x4e, 0x39, 0x00, 0xff, 0xff, 0xc3,
+		0x97, 0x40, 0xff, 0x00, 0x71, 0x0d, 0x80, 0xff, 0xff, 0x6b, 0x90, 0x40, 0x07, 0xff, 0xff, 0xdd,
+		0x09, 0x40, 0xff, 0xff, 0xe7, 0x15, 0x40, 0xff, 0xff, 0xd7, 0xf1, 0x40, 0xff, 0xff, 0xf2, 0xf1,
+		0x40, 0xff, 0xff, 0xda, 0xdf, 0x00, 0x8b, 0xff, 0xff, 0xd7, 0xb0, 0x40, 0x8b, 0xff, 0xff, 0xd3,
+		0xb5, 0x80, 0xff, 0x00, 0x0f, 0xef, 0x80, 0xff, 0xff, 0xde, 0x1c, 0x80, 0xff, 0x00, 0x26, 0x9f,
+		0x40, 0xff, 0xff, 0xcb, 0xfb, 0x00, 0xff, 0x00, 0x3b, 0x48, 0xc0, 0xff, 0xff, 0xf8, 0xb0, 0x00,
+		0xff, 0x00, 0x57, 0x6c, 0x80, 0x8b, 0xff, 0x00, 0x41, 0xd0, 0x40, 0x8b, 0xff, 0x00, 0x3a, 0x06,
+		0x40, 0xff, 0x00, 0x06, 0xf7, 0x80, 0xff, 0x00, 0x37, 0xe5, 0x40, 0xff, 0x00, 0x18, 0x60, 0x40,
+		0xff, 0x00, 0x2d, 0xdf, 0x80, 0xff, 0x00, 0x20, 0x26, 0x00, 0xff, 0x00, 0x3c, 0x7e, 0xc0, 0xff,
+		0x00, 0x37, 0x8c, 0x80, 0xff, 0x00, 0x1c, 0xc4, 0xc0, 0xff, 0x00, 0x34, 0x7d, 0x40, 0x8b, 0xff,
+		0x00, 0x37, 0x9c, 0x40, 0x8b, 0xff, 0x00, 0x2c, 0x44, 0x40, 0xff, 0xff, 0xe0, 0x26, 0x80, 0xff,
+		0x00, 0x13, 0x0e, 0xc0, 0xff, 0xff, 0xd6, 0x3e, 0x80, 0x08, 0xff, 0x00, 0x03, 0x11, 0xc0, 0xff,
+		0xff, 0xf9, 0x47, 0x00, 0xff, 0x00, 0x02, 0x6c, 0x80, 0xff, 0xff, 0xf8, 0x15, 0x80, 0xff, 0x00,
+		0x07, 0xd3, 0x40, 0xff, 0xff, 0xfa, 0xfb, 0x40, 0x08, 0xff, 0x00, 0x31, 0x30, 0xc0, 0xff, 0x00,
+		0x32, 0x0d, 0xc0, 0x05, 0xff, 0xff, 0xdc, 0x60, 0x40, 0xff, 0x00, 0x40, 0x91, 0xc0, 0xff, 0xff,
+		0xbb, 0x62, 0x00, 0xff, 0x00, 0x27, 0xdf, 0x40, 0xff, 0xff, 0xb3, 0x3b, 0x80, 0x8b, 0x08, 0x0b,
+		0xff, 0xff, 0xc5, 0x51, 0x00, 0xff, 0x00, 0x73, 0xa4, 0x40, 0xff, 0xfe, 0x05, 0x6b, 0x40, 0xff,
+		0xff, 0x85, 0x74, 0x40, 0xff, 0xff, 0xc5, 0x50, 0xc0, 0xff, 0x01, 0x41, 0xe6, 0x40, 0xff, 0x00,
+		0x39, 0xd2, 0x40, 0xff, 0xff, 0x7e, 0x8c, 0xc0, 0xff, 0x01, 0xfb, 0x71, 0xc0, 0xff, 0x00, 0x7b,
+		0x68, 0xc0, 0xff, 0x00, 0x3a, 0xaf, 0x00, 0x07, 0x0b, 0xff, 0xfd, 0x90, 0x0d, 0x00, 0xff, 0x01,
+		0x74, 0xd0, 0xc0, 0xff, 0x00, 0x3c, 0x69, 0x00, 0xff, 0xfe, 0xd3, 0xad, 0x40, 0xff, 0x02, 0x11,
+		0xe1, 0xc0, 0x07, 0x8b, 0xff, 0x00, 0x09, 0x09, 0x00, 0xff, 0x00, 0x02, 0x31, 0xc0, 0xff, 0x00,
+		0x03, 0x49, 0x80, 0xff, 0x00, 0x02, 0xf2, 0x40, 0xff, 0x00, 0x05, 0x9b, 0xc0, 0xff, 0x00, 0x01,
+		0x7a, 0x80, 0xff, 0x00, 0x02, 0xd0, 0x40, 0xff, 0x00, 0x03, 0x17, 0x40, 0xff, 0x00, 0x05, 0xce,
+		0x00, 0xff, 0xff, 0xfe, 0xeb, 0x80, 0xff, 0x00, 0x07, 0x1b, 0xc0, 0x08, 0x0b, 0xff, 0x00, 0x43,
+		0x50, 0x80, 0xff, 0x01, 0xea, 0x2f, 0x00, 0x06, 0xff, 0x01, 0x12, 0x6f, 0x00, 0xff, 0xfe, 0x14,
+		0xf4, 0x00, 0xff, 0x00, 0x37, 0x3b, 0x80, 0x8b, 0x8b, 0xff, 0x02, 0x56, 0x0f, 0x40, 0x05, 0x8b,
+		0xff, 0x00, 0x06, 0xf4, 0x00, 0xff, 0x00, 0x01, 0x97, 0x40, 0xff, 0x00, 0x02, 0x7c, 0x40, 0xff,
+		0x00, 0x02, 0x65, 0xc0, 0xff, 0x00, 0x04, 0x8f, 0x00, 0xff, 0x00, 0x01, 0x1e, 0x00, 0xff, 0x00,
+		0x02, 0x20, 0x40, 0xff, 0x00, 0x02, 0x99, 0x80, 0xff, 0x00, 0x04, 0xcf, 0x00, 0xff, 0xff, 0xff,
+		0x33, 0x00, 0xff, 0x00, 0x05, 0xd2, 0x40, 0x08, 0xff, 0xff, 0xb5, 0xc8, 0x00, 0xff, 0xfe, 0x31,
+		0x6e, 0x80, 0x06, 0xff, 0xfe, 0xfa, 0x83, 0x00, 0xff, 0x01, 0xcd, 0xb4, 0x80, 0xff, 0xff, 0xbb,
+		0xd2, 0x80, 0x8b, 0x05, 0x0b, 0x8b, 0xff, 0x00, 0x3a, 0x4a, 0xc0, 0xff, 0xff, 0xfb, 0xd3, 0x80,
+		0xff, 0x00, 0x4d, 0x68, 0xc0, 0xff, 0xff, 0xde, 0x04, 0x00, 0xff, 0x00, 0x42, 0x95, 0xc0, 0xff,
+		0xff, 0xd7, 0x23, 0x40, 0xff, 0x00, 0x50, 0x0e, 0xc0, 0xff, 0xff, 0xb9, 0x27, 0xc0, 0xff, 0x00,
+		0x25, 0x65, 0x00, 0xff, 0xff, 0xbc, 0x2d, 0x00, 0x8b, 0x08, 0xff, 0xff, 0xa3, 0x12, 0x80, 0xff,
+		0xff, 0x7c, 0xc1, 0x00, 0xff, 0xff, 0xb7, 0x68, 0x40, 0xff, 0xff, 0x0b, 0x1b, 0x40, 0xff, 0xff,
+		0x0b, 0x27, 0x80, 0xff, 0x00, 0x81, 0x6d, 0xc0, 0xff, 0xff, 0xb2, 0xd6, 0x00, 0xff, 0x00, 0x5f,
+		0x5e, 0xc0, 0x1f, 0xff, 0x00, 0x43, 0x43, 0x40, 0x8b, 0xff, 0x00, 0x47, 0xb9, 0xc0, 0xff, 0x00,
+		0x25, 0x84, 0x40, 0xff, 0x00, 0x29, 0x05, 0x00, 0xff, 0x00, 0x53, 0x02, 0x80, 0xff, 0x00, 0x21,
+		0x1a, 0x80, 0xff, 0x00, 0x42, 0xfe, 0x40, 0xff, 0x00, 0x03, 0xf4, 0x00, 0xff, 0x00, 0x4d, 0x84,
+		0x00, 0x8b, 0xff, 0x00, 0x36, 0xb9, 0x00, 0x08, 0x0b, 0xff, 0x00, 0x2c, 0x36, 0x00, 0x8b, 0xff,
+		0x00, 0x35, 0x49, 0x00, 0xff, 0xff, 0xe5, 0xb5, 0x00, 0xff, 0x00, 0x1d, 0x0a, 0x00, 0xff, 0xff,
+		0xb7, 0xc5, 0xc0, 0xff, 0x00, 0x15, 0x0f, 0x00, 0xff, 0xff, 0xcb, 0x9e, 0xc0, 0xff, 0x00, 0x03,
+		0x31, 0x40, 0xff, 0xff, 0xc4, 0x54, 0x40, 0x8b, 0xff, 0xff, 0xcb, 0x42, 0x80, 0x8b, 0xff, 0xff,
+		0xd7, 0x31, 0xc0, 0xff, 0xff, 0xfd, 0xa5, 0x00, 0xff, 0xff, 0xc0, 0x6d, 0xc0, 0xff, 0xff, 0xe6,
+		0x76, 0x80, 0xff, 0xff, 0xca, 0x4a, 0xc0, 0xff, 0xff, 0xe3, 0x2b, 0x00, 0xff, 0xff, 0xc3, 0x5b,
+		0x00, 0xff, 0xff, 0xcf, 0xb9, 0x40, 0xff, 0xff, 0xe8, 0x4d, 0xc0, 0xff, 0xff, 0xd6, 0x13, 0x00,
+		0x8b, 0x08, 0xff, 0xff, 0xb9, 0xe9, 0x80, 0xff, 0xff, 0xaa, 0x00, 0xc0, 0xff, 0x00, 0x40, 0xc8,
+		0x00, 0xff, 0x00, 0xc6, 0x26, 0x80, 0xff, 0x00, 0xb9, 0xc3, 0x40, 0xff, 0x00, 0x56, 0xc1, 0x00,
+		0xff, 0x00, 0x39, 0x0b, 0x00, 0xff, 0x00, 0x41, 0x78, 0xc0, 0x1f, 0x0b, 0xff, 0xfd, 0x90, 0xea,
+		0x00, 0xff, 0x00, 0x46, 0xc4, 0x40, 0xff, 0x01, 0x13, 0x4c, 0x00, 0xff, 0x00, 0x78, 0xd1, 0xc0,
+		0x07, 0xff, 0x00, 0x8a, 0x14, 0x80, 0xff, 0xfe, 0xec, 0xb4, 0x00, 0xff, 0x00, 0x4e, 0x88, 0x80,
+		0x8b, 0xff, 0xff, 0x6f, 0xe1, 0x00, 0xff, 0x01, 0x15, 0xe2, 0xc0, 0x05, 0xff, 0x00, 0x4b, 0x83,
+		0x00, 0xff, 0x00, 0x14, 0xa1, 0x00, 0xff, 0x00, 0x33, 0x79, 0x00, 0xff, 0x00, 0x47, 0x30, 0x80,
+		0x8b, 0xff, 0x00, 0x52, 0x7d, 0x40, 0x8b, 0xff, 0x00, 0x3e, 0x92, 0x00, 0xff, 0xff, 0xe1, 0x32,
+		0x00, 0xff, 0x00, 0x3a, 0x3d, 0x00, 0xff, 0xff, 0xc6, 0xa5, 0x40, 0xff, 0x00, 0x1d, 0x21, 0x00,
+		0xff, 0xff, 0xd8, 0x86, 0xc0, 0xff, 0x00, 0x14, 0x0c, 0x80, 0xff, 0xff, 0xd8, 0xa9, 0xc0, 0xff,
+		0x00, 0x00, 0xe8, 0x00, 0xff, 0xff, 0xd7, 0xba, 0x00, 0x8b, 0x08, 0x0b, 0xff, 0x00, 0x71, 0x0d,
+		0x80, 0x06, 0xff, 0x00, 0x1a, 0x08, 0x40, 0x8b, 0xff, 0x00, 0x19, 0x0c, 0x80, 0xff, 0xff, 0xff,
+		0x5d, 0x00, 0xff, 0x00, 0x19, 0x65, 0xc0, 0xff, 0xff, 0xf3, 0x42, 0x80, 0xff, 0x00, 0x26, 0xd7,
+		0xc0, 0xff, 0xff, 0xec, 0x83, 0xc0, 0xff, 0x00, 0x14, 0x2c, 0x00, 0xff, 0xff, 0xd8, 0x5b, 0x80,
+		0x8b, 0xff, 0xff, 0xd7, 0x70, 0xc0, 0x8b, 0xff, 0xff, 0xd8, 0x44, 0x00, 0xff, 0xff, 0xec, 0xb7,
+		0xc0, 0xff, 0xff, 0xda, 0xe0, 0x00, 0xff, 0xff, 0xdb, 0xe7, 0x00, 0xff, 0xff, 0xed, 0xbc, 0x80,
+		0xff, 0xff, 0xe7, 0xf9, 0xc0, 0xff, 0xff, 0xf3, 0xd8, 0x40, 0xff, 0xff, 0xe8, 0x3e, 0x80, 0xff,
+		0xff, 0xff, 0x6a, 0x40, 0xff, 0xff, 0xe7, 0x6f, 0x00, 0x8b, 0x08, 0xff, 0xff, 0x87, 0x2e, 0x40,
+		0x06, 0x0b, 0xff, 0xff, 0xd5, 0xcd, 0x00, 0xff, 0x00, 0x32, 0x23, 0x80, 0xff, 0xff, 0xc1, 0x50,
+		0xc0, 0xff, 0x00, 0x1b, 0x89, 0xc0, 0xff, 0xff, 0xbc, 0x13, 0xc0, 0x8b, 0xff, 0xff, 0x8f, 0x77,
+		0x80, 0x8b, 0xff, 0xff, 0xb2, 0xb5, 0x00, 0xff, 0xff, 0xb5, 0x8f, 0x00, 0x8b, 0xff, 0xff, 0xaa,
+		0xc8, 0x80, 0x8b, 0xff, 0xff, 0xdb, 0xab, 0x40, 0xff, 0x00, 0x0e, 0x42, 0x80, 0xff, 0xff, 0xd1,
+		0x28, 0x40, 0xff, 0x00, 0x33, 0xf3, 0xc0, 0xff, 0xff, 0xd9, 0xa3, 0xc0, 0xff, 0x00, 0x39, 0xb7,
+		0x40, 0xff, 0xff, 0xd5, 0x62, 0x80, 0xff, 0x00, 0x59, 0xf0, 0x80, 0xff, 0xff, 0xea, 0x70, 0x40,
+		0xff, 0x00, 0x2f, 0x17, 0x80, 0xff, 0xff, 0xe2, 0x7c, 0x40, 0xff, 0x00, 0x28, 0xde, 0x00, 0xff,
+		0xff, 0xe6, 0x62, 0x80, 0xff, 0x00, 0x0b, 0x69, 0x40, 0xff, 0xff, 0xdf, 0x74, 0x40, 0x8b, 0xff,
+		0xff, 0xe4, 0x22, 0x80, 0x8b, 0xff, 0xff, 0xc9, 0xc9, 0x40, 0xff, 0xff, 0xd2, 0x65, 0xc0, 0xff,
+		0xff, 0xc5, 0x2d, 0xc0, 0xff, 0xff, 0xa5, 0x8a, 0x00, 0x8b, 0x08, 0xff, 0xff, 0xbb, 0x99, 0xc0,
+		0x8b, 0xff, 0xff, 0xcb, 0x52, 0x40, 0xff, 0x00, 0x21, 0x73, 0xc0, 0xff, 0xff, 0xe4, 0x24, 0x00,
+		0xff, 0x00, 0x23, 0x48, 0xc0, 0xff, 0xff, 0xfc, 0xdf, 0x00, 0xff, 0x00, 0x03, 0xf6, 0x40, 0xff,
+		0x00, 0x00, 0x42, 0x40, 0xff, 0x00, 0x02, 0x87, 0x40, 0xff, 0x00, 0x00, 0x0e, 0x80, 0xff, 0x00,
+		0x04, 0x20, 0x40, 0xff, 0x00, 0x00, 0x05, 0xc0, 0xff, 0x00, 0x01, 0xa6, 0x80, 0xff, 0x00, 0x00,
+		0x38, 0x80, 0xff, 0x00, 0x05, 0x80, 0xc0, 0xff, 0xff, 0xfb, 0x38, 0x00, 0xff, 0x00, 0x02, 0x6d,
+		0x40, 0x08, 0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0xff, 0xb8, 0x5f, 0x00, 0x05, 0xff, 0x00, 0x31,
+		0x00, 0x40, 0xff, 0xff, 0xca, 0xa3, 0x40, 0xff, 0x00, 0x45, 0xc9, 0xc0, 0xff, 0xff, 0xe5, 0x0b,
+		0x40, 0xff, 0x00, 0x4c, 0xe3, 0xc0, 0x8b, 0xff, 0x00, 0x97, 0xa9, 0x00, 0x8b, 0xff, 0x00, 0x38,
+		0x04, 0xc0, 0xff, 0x00, 0x65, 0xa2, 0x00, 0x8b, 0xff, 0x00, 0x4e, 0x6b, 0x80, 0x8b, 0xff, 0x00,
+		0x20, 0x9b, 0x80, 0xff, 0xff, 0xf6, 0x98, 0x40, 0xff, 0x00, 0x2b, 0x84, 0x40, 0xff, 0xff, 0xd8,
+		0xff, 0x00, 0xff, 0x00, 0x24, 0xba, 0x80, 0xff, 0xff, 0xc9, 0xcc, 0xc0, 0xff, 0x00, 0x33, 0x0a,
+		0x40, 0xff, 0xff, 0xa8, 0x36, 0x00, 0xff, 0x00, 0x11, 0xb2, 0x00, 0xff, 0xff, 0xc6, 0xfc, 0x80,
+		0xff, 0x00, 0x21, 0x58, 0x80, 0xff, 0xff, 0xcb, 0xda, 0xc0, 0xff, 0x00, 0x1e, 0x7f, 0x00, 0xff,
+		0xff, 0xf4, 0x7a, 0x80, 0xff, 0x00, 0x24, 0xf6, 0x40, 0x8b, 0xff, 0x00, 0x19, 0x78, 0xc0, 0x8b,
+		0xff, 0x00, 0x2f, 0xc5, 0x80, 0xff, 0x00, 0x29, 0x33, 0x00, 0xff, 0x00, 0x2b, 0x90, 0x80, 0xff,
+		0x00, 0x47, 0x54, 0xc0, 0x8b, 0x08, 0xff, 0x00, 0x3a, 0x0b, 0xc0, 0x8b, 0xff, 0x00, 0x2c, 0xa0,
+		0xc0, 0xff, 0xff, 0xe5, 0x79, 0x80, 0xff, 0x00, 0x18, 0x22, 0x00, 0xff, 0xff, 0xdc, 0xcf, 0x80,
+		0xff, 0x00, 0x02, 0xa5, 0xc0, 0xff, 0xff, 0xfc, 0x24, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xff,
+		0xff, 0xfd, 0xea, 0x40, 0xff, 0x00, 0x00, 0x22, 0x00, 0xff, 0xff, 0xfc, 0x52, 0xc0, 0xff, 0x00,
+		0x00, 0x33, 0x00, 0xff, 0xff, 0xfa, 0x75, 0xc0, 0xff, 0x00, 0x02, 0xe1, 0x80, 0xff, 0xff, 0xfe,
+		0x06, 0x40, 0xff, 0x00, 0x02, 0x2f, 0xc0, 0xff, 0xff, 0xff, 0x56, 0x00, 0x08, 0x0b, 0xff, 0xff,
+		0xc1, 0x00, 0x40, 0xff, 0x00, 0xb0, 0xea, 0x40, 0xff, 0xfd, 0xce, 0x2f, 0xc0, 0xff, 0x00, 0x46,
+		0xc4, 0x00, 0xff, 0x02, 0x31, 0xd0, 0x40, 0xff, 0x00, 0xb7, 0xd1, 0xc0, 0xff, 0x00, 0x3e, 0xff,
+		0xc0, 0x07, 0x0b, 0xff, 0xfe, 0x67, 0xcd, 0x00, 0x8b, 0x07, 0x8b, 0xff, 0xff, 0xd3, 0xf4, 0x00,
+		0xff, 0x00, 0x01, 0x37, 0x80, 0xff, 0xff, 0xd5, 0x96, 0x40, 0xff, 0x00, 0x17, 0x11, 0xc0, 0xff,
+		0xff, 0xd5, 0x32, 0x80, 0xff, 0x00, 0x22, 0x88, 0x40, 0xff, 0xff, 0xbf, 0xee, 0x80, 0xff, 0x00,
+		0x45, 0x22, 0x80, 0xff, 0xff, 0xdf, 0x29, 0x80, 0xff, 0x00, 0x49, 0x86, 0x40, 0x8b, 0xff, 0x00,
+		0x48, 0x04, 0x40, 0x8b, 0xff, 0x00, 0x45, 0xfe, 0xc0, 0xff, 0x00, 0x20, 0x1a, 0x40, 0xff, 0x00,
+		0x23, 0x71, 0x00, 0xff, 0x00, 0x41, 0x51, 0x80, 0xff, 0x00, 0x17, 0x94, 0x80, 0xff, 0x00, 0x2b,
+		0x76, 0x00, 0xff, 0x00, 0x01, 0x5f, 0xc0, 0xff, 0x00, 0x2b, 0x2a, 0x80, 0x8b, 0xff, 0x00, 0x2d,
+		0x92, 0xc0, 0x08, 0xff, 0x01, 0x94, 0xbf, 0x40, 0xff, 0xff, 0xbd, 0x8c, 0x80, 0xff, 0xfe, 0x69,
+		0x87, 0x00, 0x07, 0x8b, 0xff, 0xff, 0xdf, 0xcd, 0xc0, 0xff, 0xff, 0xff, 0x54, 0x80, 0xff, 0xff,
+		0xe0, 0x95, 0x40, 0xff, 0xff, 0xf0, 0xad, 0x00, 0xff, 0xff, 0xe0, 0x4b, 0x40, 0xff, 0xff, 0xe8,
+		0xf8, 0xc0, 0xff, 0xff, 0xd0, 0x5b, 0x80, 0xff, 0xff, 0xd1, 0x14, 0x40, 0xff, 0xff, 0xe6, 0x9b,
+		0xc0, 0xff, 0xff, 0xcf, 0x5f, 0x80, 0x8b, 0xff, 0xff, 0xce, 0x95, 0x00, 0x8b, 0xff, 0xff, 0xd0,
+		0xf6, 0x40, 0xff, 0x00, 0x1a, 0x01, 0x00, 0xff, 0xff, 0xe9, 0x98, 0x00, 0xff, 0x00, 0x2f, 0xeb,
+		0x00, 0xff, 0xff, 0xf1, 0xa5, 0x00, 0xff, 0x00, 0x1e, 0xb4, 0x00, 0xff, 0xff, 0xff, 0x65, 0x00,
+		0xff, 0x00, 0x1e, 0x31, 0x80, 0x8b, 0xff, 0x00, 0x1e, 0xf2, 0x40, 0x08, 0xff, 0x01, 0x79, 0x21,
+		0x80, 0x07, 0x8b, 0xff, 0x00, 0x04, 0x8b, 0x40, 0xff, 0x00, 0x00, 0x41, 0x80, 0xff, 0x00, 0x03,
+		0x61, 0x40, 0xff, 0x00, 0x03, 0xb0, 0x80, 0xff, 0x00, 0x05, 0x30, 0x80, 0xff, 0x00, 0x02, 0xa4,
+		0x00, 0xff, 0x00, 0x03, 0xb6, 0x80, 0xff, 0x00, 0x03, 0xf1, 0x80, 0xff, 0x00, 0x04, 0x16, 0xc0,
+		0x8b, 0xff, 0x00, 0x05, 0xf7, 0xc0, 0x8b, 0xff, 0x00, 0x01, 0xbe, 0x80, 0xff, 0xff, 0xff, 0xa5,
+		0x80, 0xff, 0x00, 0x01, 0xb8, 0x00, 0xff, 0xff, 0xff, 0x51, 0x40, 0xff, 0x00, 0x01, 0x95, 0xc0,
+		0x08, 0x0b, 0xff, 0x00, 0xbf, 0x96, 0x40, 0xff, 0xfe, 0x86, 0x01, 0x80, 0x8b, 0xff, 0xff, 0x0a,
+		0x0b, 0x80, 0xff, 0x00, 0x4b, 0xf1, 0x80, 0x8b, 0x8b, 0xff, 0x00, 0xf5, 0xf4, 0x80, 0xff, 0x00,
+		0xb0, 0xea, 0x40, 0xff, 0x01, 0x79, 0x21, 0x80, 0xff, 0xff, 0xb5, 0xc8, 0x40, 0x8b, 0xff, 0xff,
+		0x75, 0xeb, 0x80, 0xff, 0xfe, 0xd1, 0xf3, 0x40, 0xff, 0xff, 0x67, 0x3f, 0xc0, 0xff, 0x01, 0x2e,
+		0xe9, 0xc0, 0x05, 0x0b, 0xff, 0xff, 0xc1, 0x00, 0x40, 0xff, 0x01, 0x2e, 0x0c, 0xc0, 0x07, 0xff,
+		0xfe, 0xc5, 0xde, 0x40, 0xff, 0xfe, 0x00, 0x3d, 0xc0, 0x8b, 0xff, 0xff, 0xce, 0xcf, 0x00, 0xff,
+		0x01, 0x9c, 0x83, 0xc0, 0x8b, 0x8b, 0xff, 0x00, 0x44, 0x2d, 0x80, 0x05, 0xff, 0xff, 0xf3, 0x8e,
+		0x00, 0xff, 0x00, 0x01, 0xd8, 0x80, 0xff, 0xff, 0xfc, 0x2b, 0x80, 0xff, 0xff, 0xf8, 0x1d, 0x00,
+		0xff, 0xff, 0xf2, 0x12, 0x00, 0x8b, 0x08, 0xff, 0xfe, 0xd9, 0xb7, 0x80, 0x8b, 0xff, 0x01, 0x34,
+		0x17, 0x40, 0xff, 0x02, 0x00, 0x9f, 0x00, 0xff, 0x00, 0x00, 0xdd, 0x00, 0xff, 0x00, 0x31, 0x31,
+		0x00, 0x05, 0x0b, 0xff, 0x00, 0x23, 0x62, 0x00, 0xff, 0xff, 0xd2, 0x42, 0xc0, 0x05, 0xff, 0x00,
+		0x25, 0x6b, 0x00, 0xff, 0x00, 0x27, 0x2c, 0x80, 0xff, 0x00, 0x33, 0x6e, 0xc0, 0xff, 0x00, 0x0b,
+		0xc5, 0x00, 0xff, 0x00, 0x2a, 0x36, 0x80, 0x8b, 0xff, 0x00, 0x36, 0x43, 0x00, 0x8b, 0xff, 0x00,
+		0x1a, 0xd3, 0x80, 0xff, 0xff, 0xe9, 0x34, 0x00, 0xff, 0x00, 0x0c, 0xe5, 0x40, 0xff, 0xff, 0xea,
+		0xd3, 0x40, 0xff, 0x00, 0x0f, 0x38, 0x80, 0xff, 0xff, 0xe7, 0x01, 0x00, 0xff, 0xff, 0xff, 0xa5,
+		0x80, 0xff, 0xff, 0xe2, 0x9b, 0x40, 0x8b, 0xff, 0xff, 0xe7, 0xca, 0x00, 0x08, 0xff, 0xff, 0xef,
+		0x9a, 0x40, 0xff, 0xff, 0xf1, 0x54, 0x40, 0x07, 0xff, 0xff, 0xbc, 0xb4, 0xc0, 0x8b, 0xff, 0xff,
+		0xb7, 0xf7, 0xc0, 0xff, 0x00, 0x00, 0xb4, 0x80, 0xff, 0xff, 0xc5, 0xe0, 0x40, 0xff, 0xff, 0xea,
+		0xa3, 0xc0, 0xff, 0xff, 0xb7, 0xf1, 0x00, 0xff, 0xff, 0xe5, 0x84, 0x80, 0xff, 0xff, 0xdf, 0x4d,
+		0x40, 0xff, 0xff, 0xca, 0x9a, 0xc0, 0x8b, 0xff, 0xff, 0xcd, 0x5b, 0x80, 0x8b, 0xff, 0xff, 0xbc,
+		0xfa, 0x40, 0xff, 0x00, 0x3a, 0x40, 0x40, 0xff, 0xff, 0xc1, 0xb8, 0xc0, 0xff, 0x00, 0x5f, 0x73,
+		0x00, 0x8b, 0xff, 0x00, 0x38, 0x1d, 0x40, 0x8b, 0xff, 0x00, 0x3a, 0x14, 0x80, 0xff, 0x00, 0x14,
+		0x6c, 0xc0, 0xff, 0x00, 0x31, 0xd8, 0xc0, 0xff, 0x00, 0x28, 0xd9, 0x80, 0x08, 0xff, 0xff, 0xcd,
+		0xf2, 0x40, 0xff, 0x00, 0x44, 0x2d, 0x40, 0xff, 0x01, 0x1b, 0x10, 0x80, 0x07, 0x8b, 0xff, 0x00,
+		0x25, 0x72, 0x00, 0xff, 0xff, 0xfe, 0xa7, 0xc0, 0xff, 0x00, 0x23, 0x5e, 0xc0, 0xff, 0xff, 0xea,
+		0xe9, 0xc0, 0xff, 0x00, 0x23, 0x24, 0x80, 0xff, 0xff, 0xe2, 0x04, 0xc0, 0xff, 0x00, 0x31, 0xf7,
+		0x80, 0xff, 0xff, 0xc6, 0x07, 0x00, 0xff, 0x00, 0x19, 0xf1, 0x00, 0xff, 0xff, 0xb9, 0x17, 0x40,
+		0x8b, 0xff, 0xff, 0xc2, 0x5e, 0xc0, 0x8b, 0xff, 0xff, 0xc5, 0x44, 0xc0, 0xff, 0xff, 0xec, 0x2c,
+		0xc0, 0xff, 0xff, 0xd5, 0x51, 0xc0, 0xff, 0xff, 0xd3, 0xea, 0x80, 0x08, 0x0b, 0xff, 0xff, 0xe1,
+		0xcb, 0x80, 0x07, 0x8b, 0xff, 0xff, 0xe8, 0x55, 0xc0, 0xff, 0xff, 0xff, 0xcd, 0x00, 0xff, 0xff,
+		0xe2, 0x5e, 0x40, 0xff, 0xff, 0xe1, 0x2e, 0x40, 0xff, 0xff, 0xdf, 0x3e, 0x80, 0xff, 0xff, 0xef,
+		0x66, 0xc0, 0xff, 0xff, 0xee, 0x5b, 0x80, 0xff, 0xff, 0xd4, 0x4f, 0xc0, 0xff, 0xff, 0xdb, 0xba,
+		0x80, 0xff, 0xff, 0xc4, 0x29, 0xc0, 0x8b, 0xff, 0xff, 0xc3, 0x6e, 0x80, 0x8b, 0xff, 0xff, 0xdc,
+		0x9b, 0x40, 0xff, 0x00, 0x26, 0x40, 0x00, 0x8b, 0xff, 0x00, 0x28, 0xd6, 0x40, 0x8b, 0xff, 0x00,
+		0x21, 0x2f, 0x80, 0xff, 0x00, 0x17, 0x4c, 0x80, 0xff, 0x00, 0x25, 0x4f, 0x80, 0xff, 0x00, 0x39,
+		0x47, 0x00, 0xff, 0x00, 0x0d, 0xac, 0x80, 0xff, 0x00, 0x29, 0x7e, 0x00, 0xff, 0x00, 0x09, 0xe7,
+		0xc0, 0xff, 0x00, 0x3d, 0x2a, 0xc0, 0xff, 0xff, 0xfd, 0x02, 0x80, 0xff, 0x00, 0x2f, 0x78, 0xc0,
+		0x8b, 0x08, 0x0b, 0xff, 0xff, 0xdc, 0x06, 0x80, 0xff, 0x00, 0x34, 0xbb, 0x40, 0xff, 0xff, 0xc2,
+		0x9c, 0x40, 0xff, 0x00, 0x1f, 0xde, 0x00, 0xff, 0xff, 0xb6, 0x88, 0xc0, 0x8b, 0x08, 0xff, 0xff,
+		0x79, 0xbd, 0x00, 0xff, 0xff, 0xa0, 0xa8, 0xc0, 0xff, 0xff, 0x9b, 0x55, 0x00, 0xff, 0xff, 0x76,
+		0xe5, 0x00, 0xff, 0xff, 0x76, 0x40, 0x00, 0xff, 0x00, 0x5f, 0xd5, 0xc0, 0xff, 0xff, 0x9a, 0x42,
+		0x40, 0xff, 0x00, 0x81, 0x38, 0x40, 0x1f, 0xff, 0x00, 0x3f, 0xc8, 0x00, 0x8b, 0xff, 0x00, 0x3d,
+		0x1f, 0xc0, 0xff, 0x00, 0x19, 0x87, 0x80, 0xff, 0x00, 0x2b, 0x91, 0x80, 0xff, 0x00, 0x2e, 0xf6,
+		0xc0, 0x08, 0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0x00, 0x30, 0x53, 0xc0, 0x05, 0xff, 0xff, 0xe1,
+		0x1c, 0xc0, 0x68, 0xff, 0xff, 0xd3, 0xa4, 0x80, 0xff, 0xff, 0xeb, 0xc0, 0x00, 0xff, 0xff, 0xd2,
+		0x36, 0xc0, 0x8b, 0x08, 0xff, 0xff, 0xa6, 0xfa, 0x00, 0xff, 0xff, 0xbc, 0x24, 0x40, 0xff, 0x00,
+		0x4a, 0x99, 0x40, 0xff, 0x00, 0x6a, 0xc2, 0x40, 0xff, 0x00, 0x68, 0x1d, 0x00, 0xff, 0x00, 0x42,
+		0xe9, 0xc0, 0xff, 0x00, 0x40, 0xfd, 0x80, 0xff, 0x00, 0x53, 0xf3, 0x00, 0x1f, 0xff, 0x00, 0x4e,
+		0x00, 0x40, 0x8b, 0xff, 0x00, 0x25, 0x83, 0xc0, 0xff, 0xff, 0xc9, 0x88, 0x40, 0xff, 0x00, 0x02,
+		0xa6, 0x00, 0xff, 0xff, 0xfa, 0xa4, 0x80, 0xff, 0x00, 0x03, 0xd1, 0x40, 0xff, 0xff, 0xf8, 0x48,
+		0x00, 0xff, 0xff, 0xfa, 0x90, 0x00, 0xff, 0xff, 0xf6, 0x9b, 0x40, 0xff, 0x00, 0x07, 0xeb, 0x00,
+		0xff, 0xff, 0xfa, 0x06, 0x80, 0x08, 0x0b, 0xff, 0xff, 0x92, 0xe2, 0x80, 0xff, 0xff, 0x9b, 0x0f,
+		0xc0, 0xff, 0xff, 0xb1, 0xf8, 0xc0, 0xff, 0xff, 0x59, 0x3a, 0xc0, 0xff, 0xff, 0x67, 0xc7, 0xc0,
+		0xff, 0x00, 0x5f, 0x46, 0xc0, 0xff, 0xff, 0xae, 0x8f, 0x00, 0xff, 0x00, 0x7c, 0x16, 0x80, 0x1f,
+		0xff, 0x00, 0x41, 0x35, 0x00, 0x8b, 0xff, 0x00, 0x3b, 0x3a, 0x40, 0xff, 0x00, 0x17, 0xdc, 0xc0,
+		0xff, 0x00, 0x27, 0x1d, 0x80, 0xff, 0x00, 0x2f, 0x07, 0x00, 0x08, 0xff, 0xff, 0xd8, 0x4d, 0x40,
+		0xff, 0x00, 0x26, 0xd5, 0xc0, 0x05, 0xff, 0xff, 0xe2, 0x39, 0x40, 0xff, 0xff, 0xde, 0xa6, 0xc0,
+		0xff, 0xff, 0xd4, 0xee, 0x00, 0xff, 0xff, 0xed, 0xf3, 0x00, 0xff, 0xff, 0xd2, 0x93, 0x40, 0x8b,
+		0xff, 0xff, 0xc2, 0xe1, 0x80, 0x8b, 0xff, 0xff, 0xa7, 0x83, 0x80, 0xff, 0x00, 0x21, 0xb2, 0x00,
+		0xff, 0xff, 0xfa, 0x90, 0x40, 0xff, 0x00, 0x88, 0xcc, 0x40, 0x08, 0xff, 0x01, 0x44, 0x3b, 0x00,
+		0x06, 0xff, 0x00, 0x02, 0xc5, 0x80, 0xff, 0x00, 0x1f, 0x63, 0x80, 0xff, 0xff, 0xfe, 0x8c, 0xc0,
+		0xff, 0x00, 0x1d, 0x57, 0x80, 0xff, 0xff, 0xfb, 0x83, 0x40, 0xff, 0x00, 0x1a, 0x85, 0x40, 0xff,
+		0xff, 0xeb, 0x3f, 0xc0, 0xff, 0x00, 0x7a, 0xa6, 0x00, 0xff, 0xff, 0xaa, 0xbc, 0x80, 0xff, 0x00,
+		0x27, 0xbe, 0x00, 0xff, 0xff, 0xb5, 0x1a, 0x00, 0x8b, 0x08, 0x0b, 0xff, 0x00, 0x0e, 0x3a, 0x80,
+		0xff, 0x00, 0x6b, 0xbe, 0xc0, 0xff, 0x00, 0x45, 0x89, 0xc0, 0xff, 0x00, 0x1f, 0x58, 0x00, 0xff,
+		0x00, 0x31, 0x07, 0x00, 0x8b, 0xff, 0x00, 0x4a, 0x0b, 0x00, 0x8b, 0xff, 0x00, 0x34, 0xde, 0x80,
+		0xff, 0xff, 0xbe, 0xfd, 0x80, 0xff, 0xff, 0xf7, 0x6b, 0x80, 0xff, 0xff, 0xb5, 0xeb, 0xc0, 0x08,
+		0x0b, 0xff, 0x00, 0x37, 0x5d, 0x40, 0xff, 0x00, 0x2d, 0x14, 0x80, 0xff, 0x00, 0x2d, 0x02, 0xc0,
+		0xff, 0x00, 0x37, 0x87, 0xc0, 0xff, 0x00, 0x37, 0x87, 0x00, 0xff, 0x00, 0x2d, 0x08, 0x40, 0xff,
+		0xff, 0xd2, 0xfc, 0xc0, 0xff, 0xff, 0xc8, 0xad, 0x00, 0xff, 0xff, 0xc8, 0xa3, 0xc0, 0xff, 0xff,
+		0xd2, 0xed, 0xc0, 0xff, 0xff, 0xd2, 0xfc, 0xc0, 0xff, 0xff, 0xc8, 0x79, 0x40, 0xff, 0xff, 0xc8,
+		0x77, 0x80, 0xff, 0xff, 0xd2, 0xf6, 0x00, 0xff, 0x00, 0x2d, 0x02, 0x00, 0xff, 0x00, 0x37, 0x53,
+		0xc0, 0x1e, 0x0b, 0xff, 0xff, 0xa5, 0x0c, 0x40, 0xff, 0xff, 0xb0, 0x30, 0xc0, 0xff, 0xff, 0xb7,
+		0xb9, 0xc0, 0xff, 0xff, 0xa6, 0xbb, 0x40, 0x1f, 0x8b, 0xff, 0xff, 0xce, 0x04, 0x80, 0xff, 0x00,
+		0x19, 0xac, 0x80, 0xff, 0xff, 0xd1, 0x81, 0x00, 0xff, 0x00, 0x29, 0xdd, 0x40, 0xff, 0xff, 0xe4,
+		0xc2, 0x40, 0xff, 0xff, 0xdf, 0x0a, 0x00, 0xff, 0xff, 0xe4, 0x0e, 0x00, 0xff, 0xff, 0xed, 0x3b,
+		0x00, 0xff, 0xff, 0xe1, 0x1f, 0x40, 0x8b, 0xff, 0xff, 0xe2, 0xa5, 0xc0, 0x8b, 0xff, 0xff, 0xec,
+		0xfa, 0x40, 0xff, 0x00, 0x07, 0xc8, 0x80, 0xff, 0xff, 0xe5, 0x4e, 0xc0, 0xff, 0x00, 0x1c, 0xdd,
+		0x00, 0xff, 0xff, 0xf0, 0xd5, 0x00, 0xff, 0xff, 0xce, 0xf7, 0x80, 0xff, 0xff, 0xe0, 0xb2, 0x80,
+		0xff, 0xff, 0xe6, 0xbc, 0x40, 0xff, 0xff, 0xde, 0x67, 0xc0, 0x8b, 0xff, 0xff, 0xdb, 0xb3, 0x40,
+		0x08, 0xff, 0xff, 0xce, 0x31, 0x40, 0xff, 0x00, 0x2e, 0x76, 0x00, 0xff, 0xff, 0xc5, 0x96, 0x40,
+		0xff, 0x00, 0xa0, 0x1c, 0xc0, 0xff, 0x00, 0x9a, 0xba, 0x80, 0xff, 0x00, 0x37, 0x7a, 0x80, 0xff,
+		0x00, 0x4e, 0x6b, 0x40, 0xff, 0x00, 0x3d, 0x46, 0xc0, 0x1e, 0x8b, 0xff, 0x00, 0x27, 0x8c, 0x80,
+		0xff, 0xff, 0xe9, 0x7d, 0xc0, 0xff, 0x00, 0x27, 0xec, 0x00, 0xff, 0xff, 0xcf, 0x79, 0x00, 0xff,
+		0x00, 0x13, 0xb4, 0x80, 0xff, 0xff, 0xd0, 0x4f, 0x00, 0xff, 0x00, 0x13, 0x5d, 0xc0, 0xff, 0xff,
+		0xc8, 0xd1, 0x00, 0xff, 0xff, 0xf9, 0x93, 0x80, 0xff, 0xff, 0xcc, 0x3a, 0xc0, 0x8b, 0xff, 0xff,
+		0xdd, 0xe4, 0x40, 0x8b, 0xff, 0xff, 0xea, 0x9a, 0xc0, 0xff, 0x00, 0x03, 0x12, 0x80, 0xff, 0xff,
+		0xf6, 0x42, 0x80, 0xff, 0x00, 0x02, 0xad, 0x40, 0xff, 0xff, 0xee, 0x80, 0x40, 0xff, 0x00, 0x04,
+		0xcf, 0x00, 0xff, 0xff, 0xf5, 0xd0, 0xc0, 0xff, 0x00, 0x0a, 0xc5, 0x80, 0x8b, 0xff, 0x00, 0x0e,
+		0x66, 0x40, 0x8b, 0xff, 0x00, 0x18, 0x2d, 0x40, 0xff, 0x00, 0x1c, 0x25, 0x40, 0xff, 0x00, 0x17,
+		0x34, 0x40, 0xff, 0x00, 0x04, 0x7d, 0x80, 0xff, 0x00, 0x03, 0xb4, 0x40, 0xff, 0x00, 0x12, 0x93,
+		0x80, 0xff, 0xff, 0xf9, 0x1d, 0x80, 0xff, 0x00, 0x13, 0xa7, 0x80, 0xff, 0xff, 0xfc, 0x7a, 0xc0,
+		0xff, 0x00, 0x13, 0xcf, 0xc0, 0x8b, 0x08, 0xff, 0x00, 0x5a, 0x7a, 0x00, 0xff, 0x00, 0x4a, 0x23,
+		0x00, 0xff, 0x00, 0x48, 0x2a, 0x80, 0xff, 0x00, 0x54, 0x53, 0xc0, 0x1f, 0x8b, 0xff, 0x00, 0x1b,
+		0xb1, 0x00, 0xff, 0xff, 0xf7, 0xdb, 0x80, 0xff, 0x00, 0x1a, 0xeb, 0xc0, 0xff, 0xff, 0xf0, 0xd7,
+		0x00, 0xff, 0x00, 0x16, 0xd1, 0x40, 0xff, 0x00, 0x18, 0x10, 0x40, 0xff, 0x00, 0x0e, 0x71, 0x40,
+		0xff, 0x00, 0x1b, 0x94, 0x40, 0xff, 0x00, 0x07, 0xa9, 0xc0, 0xff, 0x00, 0x1c, 0x26, 0x40, 0x8b,
+		0xff, 0x00, 0x08, 0xd5, 0x80, 0x8b, 0xff, 0x00, 0x08, 0xd1, 0x80, 0xff, 0xff, 0xff, 0x3e, 0xc0,
+		0xff, 0x00, 0x08, 0xb4, 0x80, 0xff, 0xff, 0xfe, 0x7f, 0x80, 0x08, 0xff, 0xff, 0xf7, 0x5e, 0x80,
+		0xff, 0x00, 0x3a, 0xaf, 0x40, 0x05, 0xff, 0xff, 0xd2, 0x0c, 0xc0, 0xff, 0x00, 0x03, 0x9f, 0x00,
+		0xff, 0xff, 0xd2, 0x70, 0x80, 0xff, 0xff, 0xf1, 0x72, 0x40, 0xff, 0xff, 0xdc, 0xa6, 0x80, 0xff,
+		0xff, 0xe2, 0x5f, 0x00, 0xff, 0xff, 0xe3, 0xd5, 0x40, 0xff, 0x00, 0x1c, 0x12, 0x40, 0xff, 0xff,
+		0xd9, 0x9e, 0x40, 0xff, 0x00, 0x0f, 0x8d, 0x40, 0xff, 0xff, 0xd6, 0x56, 0x40, 0x8b, 0x08, 0x0b,
+		0xff, 0x00, 0x11, 0x50, 0xc0, 0xff, 0xff, 0xfd, 0xc2, 0xc0, 0xff, 0x00, 0x18, 0x3e, 0x80, 0xff,
+		0xff, 0xfe, 0x09, 0x80, 0xff, 0x00, 0x22, 0xf5, 0xc0, 0xff, 0xff, 0xfe, 0xb4, 0x80, 0xff, 0x00,
+		0x21, 0xb7, 0x00, 0xff, 0xff, 0xfe, 0xc0, 0x40, 0xff, 0x00, 0x24, 0xdc, 0x00, 0xff, 0x00, 0x02,
+		0x89, 0x40, 0xff, 0x00, 0x1a, 0x35, 0x40, 0xff, 0xff, 0xfc, 0x0c, 0xc0, 0xff, 0x00, 0x2a, 0x5d,
+		0x40, 0xff, 0xff, 0xf9, 0x9d, 0x40, 0xff, 0x00, 0x0c, 0x26, 0x80, 0xff, 0xff, 0xe5, 0x56, 0xc0,
+		0x8b, 0xff, 0xff, 0xeb, 0xe2, 0x80, 0x8b, 0xff, 0xff, 0xec, 0x33, 0x40, 0xff, 0xff, 0xf4, 0xa0,
+		0x00, 0xff, 0xff, 0xe8, 0x18, 0x00, 0xff, 0xff, 0xe0, 0xa0, 0xc0, 0xff, 0xff, 0xef, 0x11, 0x80,
+		0xff, 0xff, 0xde, 0x86, 0x00, 0xff, 0xff, 0xed, 0xef, 0x40, 0xff, 0xff, 0xd9, 0x5d, 0xc0, 0xff,
+		0xff, 0xfe, 0x10, 0xc0, 0xff, 0xff, 0xe1, 0x6b, 0x80, 0x8b, 0xff, 0xff, 0xeb, 0x24, 0x00, 0x8b,
+		0xff, 0xff, 0xd9, 0x1f, 0x40, 0xff, 0x00, 0x01, 0x33, 0x00, 0xff, 0xff, 0xdd, 0x77, 0x00, 0xff,
+		0x00, 0x0d, 0xbb, 0x00, 0x08, 0xff, 0xff, 0xdb, 0x12, 0x40, 0xff, 0x00, 0x0e, 0xaf, 0x40, 0xff,
+		0xff, 0xf7, 0xe8, 0x80, 0xff, 0x00, 0x19, 0x23, 0x00, 0x8b, 0xff, 0x00, 0x0f, 0xf6, 0x80, 0x8b,
+		0xff, 0x00, 0x20, 0xd6, 0xc0, 0xff, 0x00, 0x1e, 0xa9, 0xc0, 0xff, 0x00, 0x17, 0xfe, 0x00, 0xff,
+		0x00, 0x1a, 0x40, 0x40, 0xff, 0x00, 0x0e, 0x6a, 0x40, 0x08, 0x0b, 0xff, 0xff, 0xc5, 0x51, 0x00,
+		0xff, 0x00, 0x6e, 0x76, 0xc0, 0xff, 0xfe, 0xab, 0x1d, 0x80, 0xff, 0xff, 0x8b, 0x7e, 0xc0, 0xff,
+		0xff, 0xc6, 0x2d, 0xc0, 0xff, 0x01, 0x28, 0x02, 0x40, 0xff, 0x00, 0x39, 0xd2, 0x40, 0xff, 0xff,
+		0x94, 0xfd, 0x00, 0xff, 0x01, 0x8f, 0x91, 0x80, 0x07, 0x0b, 0xff, 0xff, 0xe3, 0x5d, 0x40, 0xff,
+		0xff, 0xe8, 0xd6, 0x40, 0xff, 0xff, 0xe8, 0xed, 0x40, 0xff, 0xff, 0xe3, 0xb6, 0x80, 0xff, 0xff,
+		0xe3, 0xb8, 0x00, 0xff, 0x00, 0x17, 0x29, 0x00, 0xff, 0xff, 0xe8, 0xf0, 0x00, 0xff, 0x00, 0x1c,
+		0xa0, 0x80, 0xff, 0x00, 0x1c, 0xa5, 0x00, 0xff, 0x00, 0x17, 0x29, 0x00, 0xff, 0x00, 0x17, 0x12,
+		0x80, 0xff, 0x00, 0x1c, 0x47, 0x00, 0xff, 0x00, 0x1c, 0x4b, 0xc0, 0xff, 0xff, 0xe8, 0xd4, 0xc0,
+		0xff, 0x00, 0x17, 0x0f, 0x00, 0xff, 0xff, 0xe3, 0x60, 0x40, 0x1f, 0x0b, 0xff, 0xff, 0xc4, 0x74,
+		0x00, 0xff, 0x00, 0xaa, 0x02, 0xc0, 0xff, 0xfe, 0x84, 0x47, 0xc0, 0x07, 0x8b, 0xff, 0xff, 0xe7,
+		0x99, 0x40, 0xff, 0xff, 0xff, 0x91, 0x00, 0xff, 0xff, 0xe7, 0xfc, 0x40, 0xff, 0xff, 0xf4, 0xbf,
+		0x80, 0xff, 0xff, 0xe7, 0xb7, 0x80, 0xff, 0xff, 0xee, 0xc7, 0xc0, 0xff, 0xff, 0xda, 0xd7, 0x40,
+		0x67, 0xff, 0xff, 0xeb, 0x88, 0x40, 0xff, 0xff, 0xd9, 0x5c, 0x00, 0x8b, 0xff, 0xff, 0xc8, 0xc3,
+		0x00, 0x8b, 0xff, 0xff, 0xe2, 0x1d, 0x00, 0xff, 0x00, 0x27, 0x84, 0xc0, 0xff, 0xff, 0xfc, 0x51,
+		0x40, 0xff, 0x00, 0x06, 0x05, 0x00, 0xff, 0xff, 0xfb, 0xe6, 0x40, 0xff, 0x00, 0x06, 0xb3, 0xc0,
+		0xff, 0x00, 0x01, 0x97, 0xc0, 0xff, 0x00, 0x06, 0x80, 0x80, 0xff, 0xff, 0xf9, 0xc8, 0x40, 0xff,
+		0x00, 0x05, 0x22, 0x00, 0x08, 0xff, 0xff, 0xd1, 0x66, 0x00, 0xff, 0xff, 0xc1, 0xdd, 0x40, 0x05,
+		0xff, 0x00, 0x20, 0xb5, 0xc0, 0xff, 0xff, 0xd7, 0x6a, 0x40, 0xff, 0x00, 0x32, 0x27, 0x00, 0xff,
+		0xff, 0xe8, 0x91, 0x40, 0xff, 0x00, 0x38, 0xaf, 0x00, 0x8b, 0xff, 0x00, 0x41, 0x30, 0xc0, 0x8b,
+		0xff, 0x00, 0x3f, 0xe5, 0x40, 0xff, 0x00, 0x1e, 0xa8, 0x00, 0xff, 0x00, 0x1e, 0xf8, 0x40, 0xff,
+		0x00, 0x3c, 0xa6, 0x00, 0xff, 0x00, 0x13, 0x83, 0x00, 0xff, 0x00, 0x26, 0x35, 0xc0, 0xff, 0x00,
+		0x01, 0x0f, 0x40, 0xff, 0x00, 0x25, 0x78, 0xc0, 0x8b, 0xff, 0x00, 0x27, 0x6d, 0x00, 0x08, 0xff,
+		0x01, 0xa9, 0x75, 0x80, 0x07, 0x0b, 0xff, 0xff, 0xc6, 0x2e, 0x00, 0xff, 0x00, 0x81, 0x73, 0x40,
+		0xff, 0xfd, 0xdb, 0x21, 0xc0, 0xff, 0xff, 0x78, 0x82, 0x40, 0xff, 0xff, 0xc6, 0x2d, 0xc0, 0xff,
+		0x01, 0x56, 0x9c, 0x40, 0xff, 0x00, 0x39, 0xd2, 0x40, 0xff, 0xff, 0x79, 0x5f, 0x40, 0xff, 0x02,
+		0x5e, 0xb0, 0x40, 0x07, 0x0b, 0xff, 0x00, 0x49, 0x5b, 0x00, 0xff, 0x01, 0x07, 0x37, 0x00, 0x06,
+		0x8b, 0xff, 0x00, 0x1e, 0xc4, 0x80, 0xff, 0x00, 0x03, 0xb3, 0x00, 0xff, 0x00, 0x16, 0x59, 0x80,
+		0xff, 0x00, 0x13, 0x01, 0x00, 0xff, 0x00, 0x19, 0x52, 0xc0, 0xff, 0x00, 0x11, 0x6b, 0x00, 0xff,
+		0x00, 0x17, 0x35, 0xc0, 0xff, 0x00, 0x2b, 0xe7, 0x00, 0xff, 0x00, 0x28, 0x62, 0x00, 0xff, 0x00,
+		0x30, 0x4f, 0x40, 0x8b, 0xff, 0x00, 0x16, 0xed, 0x80, 0x8b, 0xff, 0x00, 0x16, 0x99, 0xc0, 0xff,
+		0xff, 0xf6, 0xae, 0x00, 0xff, 0x00, 0x10, 0x68, 0xc0, 0xff, 0xff, 0xec, 0x64, 0x80, 0xff, 0x00,
+		0x18, 0xb9, 0xc0, 0xff, 0xff, 0xe2, 0x74, 0x00, 0xff, 0x00, 0x00, 0x34, 0xc0, 0xff, 0xff, 0xd8,
+		0xcb, 0x00, 0x8b, 0xff, 0xff, 0xdf, 0xbb, 0x00, 0x08, 0xff, 0xfe, 0xec, 0xb4, 0x00, 0xff, 0x00,
+		0x46, 0xc4, 0x00, 0xff, 0x01, 0x15, 0x06, 0x00, 0x8b, 0x07, 0x8b, 0xff, 0x00, 0x23, 0xab, 0xc0,
+		0xff, 0xff, 0xff, 0xc4, 0x00, 0xff, 0x00, 0x25, 0xb2, 0x00, 0xff, 0xff, 0xef, 0xc0, 0x40, 0xff,
+		0x00, 0x24, 0xb9, 0x80, 0xff, 0xff, 0xe9, 0x41, 0x40, 0xff, 0x00, 0x33, 0x66, 0xc0, 0xff, 0xff,
+		0xd1, 0x2b, 0xc0, 0xff, 0x00, 0x1d, 0x3b, 0x80, 0xff, 0xff, 0xcb, 0xf0, 0xc0, 0x8b, 0xff, 0xff,
+		0xc2, 0x01, 0x40, 0x8b, 0xff, 0xff, 0xc7, 0xb0, 0xc0, 0xff, 0xff, 0xd7, 0x70, 0x40, 0xff, 0xff,
+		0xde, 0x74, 0x40, 0xff, 0xff, 0xcd, 0x14, 0xc0, 0x08, 0xff, 0x00, 0x50, 0x42, 0x80, 0xff, 0xff,
+		0xb6, 0xa5, 0x00, 0x07, 0x0b, 0xff, 0x00, 0x9d, 0xbd, 0x40, 0xff, 0xff, 0x9c, 0x71, 0x40, 0xff,
+		0x00, 0x52, 0xc7, 0xc0, 0xff, 0xff, 0x98, 0x2c, 0x00, 0xff, 0xff, 0x8b, 0x92, 0x80, 0xff, 0xff,
+		0x9c, 0x2f, 0x00, 0xff, 0xff, 0x9b, 0x25, 0x00, 0xff, 0xff, 0x72, 0xd8, 0xc0, 0xff, 0xff, 0x75,
+		0x04, 0x80, 0xff, 0x00, 0x62, 0xf8, 0x00, 0xff, 0xff, 0x9e, 0x05, 0x80, 0xff, 0x00, 0x73, 0x24,
+		0x40, 0xff, 0x00, 0x6c, 0x2f, 0x00, 0xff, 0x00, 0x61, 0x56, 0x00, 0xff, 0x00, 0x56, 0xfe, 0x80,
+		0xff, 0x00, 0x97, 0x74, 0xc0, 0x1e, 0x0b, 0xff, 0x00, 0x41, 0xe8, 0x40, 0xff, 0x00, 0x45, 0xef,
+		0xc0, 0xff, 0xff, 0xc7, 0x20, 0xc0, 0xff, 0xff, 0x82, 0x8e, 0x40, 0xff, 0xff, 0x8d, 0x02, 0xc0,
+		0xff, 0xff, 0xbe, 0x2b, 0x00, 0xff, 0xff, 0xc5, 0xa7, 0xc0, 0xff, 0xff, 0xbd, 0x51, 0x00, 0xff,
+		0xff, 0xb7, 0x31, 0x40, 0xff, 0xff, 0xbe, 0x2f, 0x40, 0xff, 0x00, 0x44, 0x60, 0x80, 0xff, 0x00,
+		0x70, 0xb1, 0x00, 0xff, 0x00, 0x6f, 0xfd, 0xc0, 0xff, 0x00, 0x41, 0x6c, 0x80, 0xff, 0x00, 0x3e,
+		0x97, 0x40, 0xff, 0x00, 0x45, 0xdf, 0x00, 0x1f, 0x0b, 0xff, 0x00, 0x28, 0x1a, 0x80, 0xff, 0x00,
+		0x60, 0xc6, 0x80, 0xff, 0xff, 0xeb, 0x09, 0x80, 0xff, 0xff, 0x5a, 0x30, 0x80, 0xff, 0xff, 0x6f,
+		0xec, 0xc0, 0xff, 0xff, 0xa1, 0x77, 0x40, 0xff, 0xff, 0xe8, 0xf4, 0x80, 0xff, 0xff, 0xd5, 0x34,
+		0x80, 0x1f, 0xff, 0xff, 0xd4, 0xac, 0x40, 0x8b, 0xff, 0xff, 0xd4, 0xe9, 0x40, 0xff, 0x00, 0x15,
+		0x76, 0xc0, 0xff, 0xff, 0xed, 0xf7, 0x00, 0xff, 0x00, 0x29, 0x8b, 0x80, 0xff, 0xff, 0xf2, 0x9f,
+		0x40, 0xff, 0x00, 0x1e, 0xd1, 0x80, 0xff, 0x00, 0x00, 0x49, 0x40, 0xff, 0x00, 0x25, 0xa4, 0x40,
+		0x8b, 0xff, 0x00, 0x42, 0x2b, 0xc0, 0x8b, 0xff, 0x00, 0x26, 0x89, 0x00, 0xff, 0x00, 0x02, 0x04,
+		0x00, 0xff, 0x00, 0x1b, 0xc9, 0xc0, 0xff, 0x00, 0x0a, 0x0f, 0x00, 0xff, 0x00, 0x17, 0xba, 0x00,
+		0xff, 0x00, 0x11, 0x65, 0x80, 0xff, 0x00, 0x29, 0x08, 0xc0, 0xff, 0x00, 0x2a, 0x7f, 0x80, 0xff,
+		0x00, 0x19, 0x2b, 0x80, 0xff, 0x00, 0x2e, 0x06, 0x40, 0x8b, 0x08, 0x0b, 0xff, 0xfe, 0x36, 0x9c,
+		0x00, 0xff, 0x00, 0x48, 0x7e, 0x00, 0xff, 0x00, 0xde, 0xa7, 0x80, 0x07, 0x8b, 0xff, 0x00, 0x1b,
+		0x91, 0x80, 0xff, 0x00, 0x01, 0x11, 0x40, 0xff, 0x00, 0x1e, 0x54, 0x00, 0xff, 0x00, 0x1f, 0x0e,
+		0x00, 0xff, 0x00, 0x31, 0x19, 0x80, 0xff, 0x00, 0x29, 0x83, 0x80, 0xff, 0x00, 0x41, 0xa2, 0x00,
+		0xff, 0x00, 0x36, 0x88, 0x00, 0xff, 0x00, 0x0b, 0x5e, 0x00, 0xff, 0x00, 0x20, 0x4d, 0x80, 0x8b,
+		0xff, 0x00, 0x26, 0x70, 0x40, 0x8b, 0xff, 0x00, 0x18, 0x2b, 0x00, 0xff, 0xff, 0xee, 0x2b, 0x00,
+		0xff, 0x00, 0x0c, 0xd3, 0x80, 0xff, 0xff, 0xef, 0x9d, 0x00, 0xff, 0x00, 0x06, 0x00, 0xc0, 0xff,
+		0xff, 0xf8, 0x54, 0xc0, 0xff, 0x00, 0x03, 0x47, 0x40, 0xff, 0xff, 0xf8, 0x17, 0xc0, 0xff, 0x00,
+		0x07, 0xac, 0xc0, 0xff, 0xff, 0xf8, 0xa9, 0x00, 0x08, 0xff, 0x00, 0x21, 0xa8, 0x40, 0xff, 0x00,
+		0x45, 0x0a, 0x40, 0x05, 0xff, 0xff, 0xe3, 0x42, 0x80, 0xff, 0x00, 0x1d, 0x70, 0xc0, 0xff, 0xff,
+		0xd5, 0xf0, 0x40, 0xff, 0x00, 0x14, 0x71, 0x80, 0xff, 0xff, 0xcc, 0xb0, 0x80, 0x8b, 0xff, 0xff,
+		0xbd, 0x42, 0xc0, 0x8b, 0xff, 0xff, 0xbc, 0x41, 0xc0, 0xff, 0xff, 0xde, 0x3d, 0x80, 0xff, 0xff,
+		0xe2, 0x14, 0x40, 0xff, 0xff, 0xbe, 0xaf, 0x40, 0x08, 0xff, 0x00, 0x02, 0x96, 0xc0, 0xff, 0x00,
+		0x58, 0x06, 0xc0, 0x05, 0x0b, 0xff, 0xff, 0xd5, 0xc8, 0xc0, 0xff, 0x00, 0x2e, 0x85, 0x40, 0xff,
+		0xff, 0xc3, 0x58, 0x80, 0xff, 0x00, 0x19, 0x1c, 0x80, 0xff, 0xff, 0xbc, 0x6c, 0x80, 0x8b, 0xff,
+		0xff, 0x95, 0xe5, 0x40, 0x8b, 0xff, 0xff, 0xba, 0x7c, 0x40, 0xff, 0xff, 0xc4, 0xb5, 0x80, 0x8b,
+		0xff, 0xff, 0xbb, 0xc3, 0x80, 0x8b, 0xff, 0xff, 0xb0, 0x3b, 0x00, 0xff, 0x00, 0x56, 0x81, 0x40,
+		0xff, 0xff, 0xe2, 0xef, 0x40, 0xff, 0x00, 0x18, 0xcc, 0x00, 0xff, 0xff, 0xf7, 0x09, 0x40, 0xff,
+		0x00, 0x26, 0xa3, 0x80, 0xff, 0xff, 0xf2, 0x08, 0x80, 0xff, 0x00, 0x32, 0x72, 0x00, 0xff, 0xff,
+		0xf3, 0xdd, 0x40, 0xff, 0x00, 0x21, 0xb3, 0x80, 0xff, 0xff, 0xf0, 0x3a, 0x00, 0xff, 0x00, 0x25,
+		0xb0, 0xc0, 0xff, 0xff, 0xee, 0x5b, 0x80, 0xff, 0x00, 0x07, 0xe5, 0x40, 0xff, 0xff, 0xe7, 0xf1,
+		0x00, 0x8b, 0xff, 0xff, 0xef, 0x7d, 0x80, 0x8b, 0xff, 0xff, 0xd5, 0x34, 0x80, 0xff, 0xff, 0xcb,
+		0xcf, 0x00, 0xff, 0xff, 0xe2, 0x83, 0x40, 0xff, 0xff, 0xbe, 0xbb, 0xc0, 0x8b, 0x08, 0xff, 0xff,
+		0xb1, 0xb0, 0x80, 0x8b, 0xff, 0xff, 0xcd, 0xd7, 0x00, 0xff, 0x00, 0x2f, 0x30, 0x80, 0xff, 0xff,
+		0xf1, 0x8b, 0x80, 0xff, 0x00, 0x10, 0x6e, 0x40, 0xff, 0xff, 0xfc, 0x98, 0x00, 0xff, 0x00, 0x03,
+		0xdf, 0xc0, 0xff, 0x00, 0x00, 0x71, 0xc0, 0xff, 0x00, 0x02, 0xd0, 0x80, 0xff, 0x00, 0x00, 0x2f,
+		0x40, 0xff, 0x00, 0x03, 0xff, 0xc0, 0xff, 0x00, 0x00, 0x10, 0x00, 0xff, 0x00, 0x01, 0x5f, 0x80,
+		0xff, 0x00, 0x00, 0x6f, 0xc0, 0xff, 0x00, 0x05, 0xba, 0x40, 0xff, 0xff, 0xfb, 0x12, 0xc0, 0xff,
+		0x00, 0x02, 0x4d, 0x80, 0x08, 0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0xff, 0xb8, 0x5f, 0x00, 0x05,
+		0xff, 0x00, 0x35, 0xa0, 0xc0, 0xff, 0xff, 0xce, 0x22, 0x40, 0xff, 0x00, 0x45, 0xd2, 0xc0, 0xff,
+		0xff, 0xe9, 0x5f, 0xc0, 0xff, 0x00, 0x45, 0x65, 0x80, 0x8b, 0xff, 0x00, 0x7c, 0xda, 0xc0, 0x8b,
+		0xff, 0x00, 0x41, 0x35, 0xc0, 0xff, 0x00, 0x49, 0xae, 0xc0, 0x8b, 0xff, 0x00, 0x44, 0xf5, 0x80,
+		0x8b, 0xff, 0x00, 0x1f, 0x9f, 0x00, 0x7e, 0xff, 0x00, 0x29, 0x55, 0x80, 0xff, 0xff, 0xc9, 0xf1,
+		0x40, 0xff, 0x00, 0x1e, 0x58, 0x40, 0xff, 0xff, 0xcc, 0x5f, 0xc0, 0xff, 0x00, 0x1c, 0xfa, 0x80,
+		0xff, 0xff, 0xb6, 0x6e, 0x40, 0xff, 0x00, 0x0a, 0x51, 0x00, 0xff, 0xff, 0xd5, 0x4c, 0x80, 0xff,
+		0x00, 0x14, 0xa2, 0xc0, 0xff, 0xff, 0xda, 0xae, 0x40, 0xff, 0x00, 0x12, 0x09, 0x40, 0xff, 0xff,
+		0xf8, 0x0f, 0x00, 0xff, 0x00, 0x16, 0x27, 0xc0, 0x8b, 0xff, 0x00, 0x0f, 0x59, 0x80, 0x8b, 0xff,
+		0x00, 0x24, 0xc3, 0x80, 0xff, 0x00, 0x2c, 0x9b, 0x00, 0xff, 0x00, 0x19, 0x9f, 0x00, 0xff, 0x00,
+		0x33, 0xa7, 0x00, 0x8b, 0x08, 0xff, 0x00, 0x41, 0x20, 0x80, 0x8b, 0xff, 0x00, 0x2c, 0x4d, 0xc0,
+		0xff, 0xff, 0xd7, 0xb5, 0x00, 0xff, 0x00, 0x11, 0x63, 0x80, 0xff, 0xff, 0xe9, 0x8f, 0x40, 0xff,
+		0x00, 0x02, 0xd1, 0x00, 0xff, 0xff, 0xfc, 0x5d, 0x40, 0xff, 0xff, 0xff, 0x58, 0x00, 0xff, 0xff,
+		0xfd, 0x99, 0xc0, 0xff, 0xff, 0xff, 0xfa, 0x00, 0xff, 0xff, 0xfc, 0x7c, 0xc0, 0xff, 0xff, 0xff,
+		0xf6, 0x00, 0xff, 0xff, 0xfa, 0x04, 0x80, 0xff, 0x00, 0x03, 0x7b, 0x00, 0xff, 0xff, 0xfe, 0x5c,
+		0x40, 0xff, 0x00, 0x01, 0xc4, 0x00, 0xff, 0xff, 0xff, 0x94, 0x80, 0x08, 0x0b, 0xff, 0xff, 0xf7,
+		0x5e, 0xc0, 0xff, 0xff, 0x85, 0x74, 0x40, 0xff, 0xff, 0x93, 0x43, 0x00, 0x8b, 0xff, 0xff, 0xff,
+		0x23, 0x40, 0xff, 0xff, 0xc5, 0x50, 0xc0, 0xff, 0x00, 0x6b, 0x03, 0x00, 0x8b, 0x05, 0xff, 0xff,
+		0xf9, 0x9f, 0xc0, 0xff, 0xff, 0xb1, 0xc6, 0xc0, 0xff, 0xff, 0xfc, 0xe2, 0x00, 0xff, 0xff, 0xb2,
+		0x3e, 0x80, 0x8b, 0xff, 0xff, 0xb2, 0x6a, 0x80, 0x8b, 0xff, 0xff, 0xd7, 0x03, 0xc0, 0xff, 0x00,
+		0x00, 0x5e, 0xc0, 0xff, 0xff, 0xd2, 0x17, 0x40, 0xff, 0x00, 0x1a, 0x96, 0xc0, 0xff, 0xff, 0xda,
+		0x89, 0x80, 0xff, 0x00, 0x15, 0xaa, 0x00, 0xff, 0xff, 0xe1, 0x79, 0x80, 0xff, 0x00, 0x23, 0xb4,
+		0x40, 0xff, 0xff, 0xed, 0xde, 0x80, 0xff, 0x00, 0x2e, 0xa9, 0x80, 0x8b, 0xff, 0x00, 0x36, 0x65,
+		0x80, 0x8b, 0xff, 0x00, 0x35, 0x00, 0x40, 0xff, 0x00, 0x16, 0xbd, 0xc0, 0xff, 0x00, 0x26, 0xa3,
+		0x00, 0xff, 0x00, 0x1c, 0x47, 0xc0, 0x08, 0xff, 0xff, 0xe9, 0x8f, 0xc0, 0xff, 0x00, 0x38, 0xf5,
+		0x40, 0x05, 0xff, 0xff, 0xd9, 0x3b, 0xc0, 0xff, 0xff, 0xe3, 0x2c, 0xc0, 0xff, 0xff, 0xdc, 0x92,
+		0x80, 0xff, 0xff, 0xf3, 0x1e, 0x80, 0xff, 0xff, 0xe3, 0xdd, 0x00, 0x8b, 0xff, 0xff, 0xdd, 0xe6,
+		0x00, 0x8b, 0xff, 0xff, 0xdc, 0x8c, 0x40, 0xff, 0x00, 0x12, 0xde, 0xc0, 0xff, 0xff, 0xf8, 0xb0,
+		0x40, 0xff, 0x00, 0x36, 0xdd, 0x00, 0xff, 0xff, 0xff, 0x76, 0xc0, 0xff, 0x00, 0x04, 0x05, 0x00,
+		0xff, 0xff, 0xfd, 0x99, 0xc0, 0xff, 0x00, 0x11, 0x94, 0x00, 0x8b, 0xff, 0x00, 0x42, 0x38, 0x80,
+		0x8b, 0xff, 0x00, 0x3b, 0xb7, 0x40, 0xff, 0x00, 0x02, 0xe5, 0x40, 0xff, 0x00, 0x3b, 0xa4, 0x80,
+		0xff, 0x00, 0x05, 0xc6, 0x00, 0xff, 0x00, 0x3b, 0x64, 0xc0, 0x08, 0xff, 0x00, 0x96, 0x29, 0x80,
+		0xff, 0x00, 0x3b, 0x8c, 0x00, 0xff, 0xff, 0x6a, 0xb3, 0x80, 0x06, 0x8b, 0x8b, 0xff, 0x00, 0x06,
+		0xe5, 0x40, 0xff, 0x00, 0x52, 0x49, 0x80, 0xff, 0x00, 0x04, 0xb3, 0x80, 0xff, 0x00, 0x19, 0x54,
+		0x40, 0xff, 0x00, 0x01, 0xfc, 0xc0, 0xff, 0x00, 0x0a, 0xb3, 0xc0, 0xff, 0x00, 0x07, 0x30, 0x00,
+		0xff, 0x00, 0x06, 0x2b, 0x80, 0xff, 0xff, 0xfc, 0x7d, 0x00, 0xff, 0x00, 0x0a, 0x23, 0xc0, 0x08,
+		0x0b, 0xff, 0xff, 0xff, 0x23, 0x00, 0xff, 0xff, 0x01, 0x6a, 0x40, 0x05, 0xff, 0xff, 0xff, 0xdd,
+		0x80, 0xff, 0xff, 0xd8, 0x37, 0x00, 0xff, 0x00, 0x00, 0x68, 0x80, 0xff, 0xff, 0xd7, 0xed, 0x80,
+		0xff, 0x00, 0x11, 0xd8, 0x80, 0xff, 0xff, 0xd7, 0xde, 0xc0, 0xff, 0x00, 0x1a, 0xaf, 0x40, 0xff,
+		0xff, 0xc3, 0xfe, 0x80, 0xff, 0x00, 0x37, 0xdd, 0x40, 0xff, 0xff, 0xde, 0xd1, 0x40, 0xff, 0x00,
+		0x3b, 0x6f, 0x80, 0x8b, 0xff, 0x00, 0x39, 0x4a, 0x40, 0x8b, 0xff, 0x00, 0x36, 0x07, 0x00, 0xff,
+		0x00, 0x1e, 0xb9, 0x80, 0xff, 0x00, 0x1d, 0xc4, 0x40, 0xff, 0x00, 0x32, 0x69, 0x80, 0x08, 0xff,
+		0xff, 0xff, 0x23, 0x00, 0xff, 0xff, 0xdd, 0x7a, 0xc0, 0x05, 0xff, 0xff, 0xff, 0xb5, 0x40, 0xff,
+		0xff, 0xf4, 0x58, 0x40, 0xff, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0xff, 0xf4, 0x0d, 0x40, 0xff, 0x00,
+		0x01, 0xe4, 0xc0, 0xff, 0xff, 0xf4, 0x38, 0x80, 0x08, 0xff, 0x00, 0x4b, 0xf1, 0xc0, 0x06, 0xff,
+		0xff, 0xfb, 0x9c, 0x80, 0xff, 0x00, 0x0d, 0xa7, 0x40, 0xff, 0xff, 0xff, 0x36, 0x00, 0xff, 0x00,
+		0x0e, 0x62, 0xc0, 0x8b, 0xff, 0x00, 0x0d, 0x62, 0x80, 0x08, 0xff, 0x01, 0x9f, 0x1a, 0x80, 0xff,
+		0xff, 0xb7, 0x82, 0x00, 0xff, 0xff, 0x04, 0xdd, 0xc0, 0x07, 0x8b, 0xff, 0xff, 0xdc, 0xd4, 0xc0,
+		0xff, 0xff, 0xfd, 0x46, 0x80, 0xff, 0xff, 0xe4, 0xdc, 0x40, 0xff, 0xff, 0xf0, 0xbc, 0x00, 0xff,
+		0xff, 0xe4, 0x1e, 0xc0, 0xff, 0xff, 0xeb, 0x10, 0x00, 0xff, 0xff, 0xd9, 0xc3, 0xc0, 0xff, 0xff,
+		0xd7, 0x64, 0xc0, 0xff, 0xff, 0xe2, 0x7e, 0xc0, 0xff, 0xff, 0xd3, 0xfe, 0x40, 0x8b, 0xff, 0xff,
+		0xdc, 0x3e, 0x40, 0x8b, 0xff, 0xff, 0xde, 0xa3, 0xc0, 0xff, 0x00, 0x13, 0xc4, 0xc0, 0xff, 0xff,
+		0xed, 0xcf, 0x00, 0xff, 0x00, 0x24, 0x1f, 0x40, 0xff, 0xff, 0xef, 0xc4, 0xc0, 0xff, 0x00, 0x20,
+		0x3a, 0xc0, 0xff, 0x00, 0x00, 0x1c, 0xc0, 0xff, 0x00, 0x23, 0xb8, 0x80, 0x8b, 0xff, 0x00, 0x1e,
+		0xa3, 0x00, 0x08, 0xff, 0x00, 0xfe, 0x95, 0xc0, 0x07, 0x0b, 0xff, 0x00, 0xb9, 0x8b, 0x80, 0xff,
+		0xfe, 0x39, 0x32, 0xc0, 0xff, 0xff, 0xf1, 0x54, 0x40, 0xff, 0xff, 0xde, 0x58, 0x00, 0x05, 0xff,
+		0xff, 0xf8, 0x14, 0x40, 0xff, 0xff, 0xed, 0xd4, 0x40, 0xff, 0xff, 0xf6, 0xdf, 0xc0, 0xff, 0xff,
+		0xec, 0x86, 0x80, 0xff, 0xff, 0xf1, 0x86, 0x40, 0xff, 0xff, 0xf0, 0x96, 0x00, 0xff, 0xff, 0xec,
+		0xfb, 0x40, 0xff, 0xff, 0xeb, 0xbf, 0x40, 0xff, 0xff, 0xe8, 0x88, 0x00, 0xff, 0xff, 0xf6, 0xa9,
+		0x00, 0xff, 0xff, 0xea, 0x9a, 0x40, 0x8b, 0xff, 0xff, 0xde, 0x23, 0x40, 0x8b, 0xff, 0xff, 0xee,
+		0xb8, 0x80, 0xff, 0x00, 0x16, 0xb4, 0x40, 0xff, 0xff, 0xfd, 0x75, 0x00, 0xff, 0x00, 0x04, 0xdf,
+		0x40, 0xff, 0xff, 0xfd, 0x6b, 0x00, 0xff, 0x00, 0x04, 0xf3, 0x00, 0xff, 0x00, 0x00, 0x82, 0x00,
+		0xff, 0x00, 0x06, 0xab, 0x40, 0xff, 0xff, 0xfa, 0x19, 0x80, 0xff, 0x00, 0x04, 0x9f, 0x80, 0x08,
+		0xff, 0xff, 0xda, 0xe4, 0x40, 0xff, 0xff, 0xbf, 0x46, 0x40, 0x05, 0xff, 0x00, 0x1a, 0x5d, 0x00,
+		0xff, 0xff, 0xe6, 0xc1, 0xc0, 0xff, 0x00, 0x23, 0x0e, 0xc0, 0xff, 0xff, 0xf3, 0x1d, 0xc0, 0xff,
+		0x00, 0x25, 0x8f, 0xc0, 0x8b, 0xff, 0x00, 0x29, 0x43, 0x00, 0x8b, 0xff, 0x00, 0x2a, 0xcd, 0xc0,
+		0xff, 0x00, 0x0f, 0x2d, 0x80, 0xff, 0x00, 0x1e, 0x71, 0x00, 0xff, 0x00, 0x22, 0x40, 0x00, 0xff,
+		0x00, 0x13, 0xf4, 0xc0, 0xff, 0x00, 0x16, 0x74, 0x40, 0xff, 0x00, 0x09, 0xa6, 0x00, 0xff, 0x00,
+		0x18, 0x18, 0x40, 0xff, 0x00, 0x09, 0xc3, 0xc0, 0xff, 0x00, 0x19, 0xdc, 0x80, 0x08, 0xff, 0x00,
+		0x8e, 0x65, 0x40, 0xff, 0x01, 0x79, 0x21, 0x80, 0x05, 0xff, 0x00, 0x10, 0x6d, 0x40, 0xff, 0x00,
+		0x2b, 0x81, 0x80, 0xff, 0x00, 0x0f, 0xe0, 0xc0, 0xff, 0x00, 0x2b, 0xde, 0x00, 0xff, 0x00, 0x0d,
+		0x6f, 0x00, 0xff, 0x00, 0x2c, 0xaa, 0x80, 0x08, 0xff, 0xff, 0xb4, 0xeb, 0x40, 0x06, 0xff, 0xff,
+		0xf8, 0x74, 0x00, 0xff, 0xff, 0xd6, 0x2c, 0x40, 0xff, 0xff, 0xf3, 0x04, 0x00, 0xff, 0xff, 0xd7,
+		0x7a, 0x80, 0xff, 0xff, 0xf2, 0x03, 0x00, 0xff, 0xff, 0xd8, 0xaa, 0x80, 0x08, 0xff, 0xff, 0xa8,
+		0xd6, 0x40, 0xff, 0xff, 0x0a, 0xe8, 0x80, 0xff, 0xff, 0x7a, 0x3c, 0x40, 0xff, 0x01, 0x50, 0x91,
+		0xc0, 0x05, 0xff, 0xff, 0xfe, 0xdf, 0x80, 0xff, 0x00, 0x02, 0xd6, 0x40, 0xff, 0xff, 0xff, 0x41,
+		0xc0, 0xff, 0x00, 0x02, 0x36, 0xc0, 0x8b, 0xff, 0x00, 0x02, 0xe9, 0x40, 0x8b, 0xff, 0x00, 0x07,
+		0x5c, 0x80, 0xff, 0x00, 0x05, 0x05, 0x40, 0xff, 0x00, 0x05, 0x06, 0xc0, 0xff, 0xff, 0xff, 0x70,
+		0x40, 0xff, 0x00, 0x08, 0xfe, 0x40, 0x08, 0x0b, 0xff, 0xff, 0xc1, 0x00, 0x40, 0xff, 0x01, 0x06,
+		0x5a, 0x40, 0x07, 0xff, 0xfe, 0xe4, 0xef, 0x80, 0xff, 0xfe, 0xa5, 0xf0, 0x00, 0x8b, 0xff, 0xff,
+		0xce, 0xcf, 0x00, 0xff, 0x01, 0x8f, 0x91, 0xc0, 0x8b, 0x8b, 0xff, 0x00, 0x44, 0x2d, 0x80, 0x05,
+		0xff, 0xff, 0xf3, 0x8e, 0x00, 0xff, 0x00, 0x01, 0xd8, 0x80, 0xff, 0xff, 0xfc, 0x2b, 0xc0, 0xff,
+		0xff, 0xf8, 0x1d, 0x00, 0xff, 0xff, 0xf2, 0x11, 0xc0, 0x8b, 0x08, 0xff, 0xfe, 0xf0, 0x27, 0xc0,
+		0x8b, 0xff, 0x01, 0x16, 0xbf, 0xc0, 0xff, 0x01, 0x5a, 0xed, 0x00, 0x8b, 0xff, 0x00, 0x31, 0x30,
+		0xc0, 0x05, 0x0b, 0xff, 0xff, 0xe3, 0x85, 0x80, 0xff, 0x00, 0x21, 0xa8, 0x40, 0xff, 0xff, 0x90,
+		0xac, 0x40, 0xff, 0xff, 0xbb, 0xd2, 0x80, 0xff, 0xff, 0x98, 0x70, 0x80, 0xff, 0x00, 0x46, 0xc4,
+		0x40, 0xff, 0xff, 0xdf, 0x34, 0xc0, 0xff, 0xff, 0xda, 0x07, 0x00, 0xff, 0x00, 0x7b, 0x68, 0xc0,
+		0xff, 0xff, 0x9e, 0x7b, 0x40, 0xff, 0x00, 0x15, 0x93, 0x40, 0x8b, 0x05, 0x0b, 0xff, 0xff, 0xda,
+		0x07, 0x00, 0xff, 0x00, 0x22, 0x85, 0x00, 0xff, 0xff, 0xae, 0xe0, 0xc0, 0xff, 0xff, 0x9a, 0x2a,
+		0x80, 0xff, 0xff, 0xb2, 0x54, 0x80, 0xff, 0x00, 0x66, 0xb2, 0x80, 0xff, 0xff, 0xd1, 0x66, 0x00,
+		0xff, 0xff, 0xdd, 0x7a, 0xc0, 0xff, 0x00, 0x6e, 0x76, 0xc0, 0xff, 0xff, 0x72, 0x78, 0x00, 0xff,
+		0x00, 0x15, 0x93, 0x40, 0x8b, 0x05, 0x0b, 0xff, 0x00, 0x84, 0x2e, 0x40, 0xff, 0x00, 0x6e, 0x12,
+		0x80, 0xff, 0x00, 0x70, 0xa9, 0x00, 0xff, 0x00, 0x8f, 0x1c, 0x80, 0xff, 0x00, 0x8e, 0xd4, 0x80,
+		0xff, 0xff, 0x92, 0x28, 0x00, 0xff, 0x00, 0x70, 0x68, 0x80, 0xff, 0xff, 0x7b, 0xfc, 0x80, 0xff,
+		0xff, 0x7b, 0x9f, 0x00, 0xff, 0xff, 0x91, 0xdc, 0xc0, 0xff, 0xff, 0x8f, 0x39, 0x40, 0xff, 0xff,
+		0x70, 0xc5, 0xc0, 0xff, 0xff, 0x71, 0x87, 0x40, 0xff, 0x00, 0x6d, 0xc5, 0x00, 0xff, 0xff, 0x8f,
+		0x77, 0x40, 0xff, 0x00, 0x84, 0x5a, 0x00, 0x1f, 0x0b, 0xff, 0x00, 0x78, 0x2e, 0x40, 0xff, 0x00,
+		0x5a, 0x5d, 0x80, 0xff, 0x00, 0x5d, 0x27, 0x40, 0xff, 0x00, 0x6b, 0x9e, 0xc0, 0xff, 0x00, 0x6b,
+		0x75, 0x80, 0xff, 0x00, 0x5a, 0x0d, 0x00, 0xff, 0xff, 0xa3, 0x19, 0x80, 0xff, 0xff, 0x88, 0x54,
+		0x80, 0xff, 0xff, 0x88, 0x03, 0x00, 0xff, 0xff, 0xa5, 0xaa, 0x80, 0xff, 0xff, 0xa3, 0x05, 0xc0,
+		0xff, 0xff, 0x94, 0x8d, 0x80, 0xff, 0xff, 0x94, 0x38, 0x00, 0xff, 0xff, 0xa6, 0x11, 0x40, 0xff,
+		0x00, 0x5d, 0x08, 0x40, 0xff, 0x00, 0x77, 0x2b, 0x80, 0x1e, 0x0b, 0xff, 0xff, 0xc9, 0xa1, 0x80,
+		0xff, 0x01, 0x5d, 0x83, 0xc0, 0xff, 0x00, 0x36, 0x5e, 0x80, 0x07, 0x0b, 0x8b, 0xff, 0xff, 0xe8,
+		0xb2, 0xc0, 0xff, 0x00, 0x9d, 0xed, 0xc0, 0xff, 0xff, 0x57, 0xb7, 0x40, 0xff, 0x00, 0x27, 0xb2,
+		0xc0, 0xff, 0x00, 0x27, 0xb2, 0x80, 0xff, 0xff, 0x80, 0x46, 0x80, 0xff, 0x00, 0x8b, 0xce, 0x80,
+		0xff, 0x00, 0x78, 0xd2, 0x00, 0xff, 0x00, 0x76, 0x3b, 0x00, 0xff, 0xff, 0xd9, 0x2a, 0x40, 0xff,
+		0x00, 0x29, 0x6c, 0x80, 0x05, 0x0b, 0xff, 0xff, 0xc7, 0xe7, 0x80, 0xff, 0x00, 0xfd, 0xb8, 0xc0,
+		0xff, 0x00, 0x38, 0x18, 0x80, 0x07, 0x0b, 0xff, 0xff, 0x68, 0x1c, 0x80, 0xff, 0x00, 0x93, 0x92,
+		0x80, 0xff, 0xff, 0xd9, 0x2a, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x80, 0xff, 0x00, 0x78, 0xd2, 0x00,
+		0xff, 0xff, 0x89, 0xc5, 0x00, 0xff, 0xff, 0x80, 0x46, 0xc0, 0xff, 0xff, 0x74, 0x31, 0x80, 0xff,
+		0x00, 0x27, 0xb2, 0x80, 0xff, 0xff, 0xd8, 0x4d, 0x80, 0xff, 0x00, 0x9d, 0xee, 0x00, 0xff, 0x00,
+		0xa8, 0x48, 0xc0, 0x05, 0x0b, 0xff, 0x00, 0x1b, 0xde, 0x00, 0xff, 0xff, 0xe9, 0x5d, 0x80, 0xff,
+		0x00, 0x16, 0xa3, 0x00, 0xff, 0xff, 0xe4, 0x22, 0x40, 0xff, 0xff, 0xe4, 0x22, 0x40, 0xff, 0xff,
+		0xe9, 0x5d, 0x40, 0xff, 0xff, 0xe9, 0x5d, 0x00, 0xff, 0xff, 0xe4, 0x22, 0x00, 0xff, 0xff, 0xe4,
+		0x22, 0x80, 0xff, 0x00, 0x16, 0xa3, 0x00, 0xff, 0xff, 0xe9, 0x5d, 0x80, 0xff, 0x00, 0x1b, 0xdd,
+		0xc0, 0xff, 0x00, 0x1b, 0xdd, 0x40, 0xff, 0x00, 0x16, 0xa2, 0xc0, 0xff, 0x00, 0x16, 0xa3, 0x00,
+		0xff, 0x00, 0x1b, 0xdd, 0x00, 0x1e, 0x0b, 0xff, 0x00, 0x1b, 0xee, 0x80, 0xff, 0xff, 0xe9, 0x81,
+		0x40, 0xff, 0x00, 0x16, 0x93, 0x00, 0xff, 0xff, 0xe4, 0x72, 0x40, 0xff, 0xff, 0xe4, 0x6c, 0x00,
+		0xff, 0xff, 0xe9, 0x84, 0x00, 0xff, 0xff, 0xe9, 0x69, 0x80, 0xff, 0xff, 0xe4, 0x15, 0x80, 0xff,
+		0xff, 0xe4, 0x13, 0x00, 0xff, 0x00, 0x16, 0x7e, 0x00, 0xff, 0xff, 0xe9, 0x6b, 0x80, 0xff, 0x00,
+		0x1b, 0x91, 0x80, 0xff, 0x00, 0x1b, 0x92, 0xc0, 0xff, 0x00, 0x16, 0x7a, 0x40, 0xff, 0x00, 0x16,
+		0x97, 0x80, 0xff, 0x00, 0x1b, 0xe9, 0x80, 0x1e, 0x0b, 0xff, 0xff, 0xd8, 0x4d, 0x40, 0xff, 0xff,
+		0xba, 0x18, 0xc0, 0xff, 0x00, 0xa9, 0x26, 0x00, 0xff, 0xff, 0xc2, 0xba, 0x00, 0xff, 0x00, 0x17,
+		0x4d, 0x00, 0xff, 0x00, 0x29, 0x6c, 0xc0, 0x05, 0x0b, 0xff, 0xff, 0x67, 0x3f, 0xc0, 0xff, 0xff,
+		0xa6, 0x3f, 0x80, 0xff, 0x00, 0x17, 0x4d, 0x40, 0xff, 0xff, 0xd6, 0x93, 0x40, 0xff, 0x00, 0xa9,
+		0x25, 0xc0, 0xff, 0x00, 0x3d, 0x46, 0x00, 0x05, 0x0b, 0xff, 0x00, 0x1c, 0x7a, 0x80, 0xff, 0xff,
+		0xde, 0x57, 0xc0, 0xff, 0x00, 0x6f, 0x53, 0xc0, 0xff, 0x00, 0x44, 0x2d, 0x80, 0xff, 0x00, 0x67,
+		0x8f, 0x80, 0xff, 0xff, 0xb9, 0x3b, 0xc0, 0xff, 0x00, 0x20, 0xcb, 0x40, 0xff, 0x00, 0x25, 0xf9,
+		0x00, 0xff, 0xff, 0x84, 0x97, 0x40, 0xff, 0x00, 0x61, 0x84, 0xc0, 0xff, 0xff, 0xea, 0x6c, 0xc0,
+		0x8b, 0x05, 0x0b, 0xff, 0x00, 0x17, 0xf5, 0x80, 0xff, 0x00, 0x26, 0xa6, 0x80, 0xff, 0x00, 0x0f,
+		0x02, 0x00, 0xff, 0x00, 0x16, 0xfe, 0xc0, 0xff, 0x00, 0x1a, 0x7c, 0x80, 0x8b, 0xff, 0x00, 0x2c,
+		0x0c, 0x40, 0x8b, 0xff, 0x00, 0x1b, 0x14, 0x80, 0xff, 0xff, 0xb4, 0x55, 0x80, 0xff, 0x00, 0x3a,
+		0x27, 0xc0, 0x8b, 0xff, 0x00, 0x24, 0xe2, 0x40, 0x8b, 0xff, 0x00, 0x1b, 0x3b, 0x40, 0xff, 0x00,
+		0x1b, 0xf3, 0x00, 0xff, 0x00, 0x22, 0x91, 0x80, 0xff, 0x00, 0x2b, 0x07, 0x80, 0x08, 0xff, 0xff,
+		0xda, 0xe4, 0x00, 0xff, 0x00, 0x27, 0xb2, 0xc0, 0x05, 0xff, 0xff, 0xea, 0x40, 0x80, 0xff, 0xff,
+		0xe2, 0xa6, 0x80, 0xff, 0xff, 0xf4, 0x4b, 0xc0, 0xff, 0xff, 0xe8, 0xa5, 0x40, 0xff, 0xff, 0xe7,
+		0x56, 0x00, 0x8b, 0xff, 0xff, 0xed, 0x58, 0x40, 0x8b, 0xff, 0xff, 0xf0, 0xfc, 0x00, 0xff, 0x00,
+		0x0e, 0xb6, 0x80, 0xff, 0xff, 0xef, 0xcb, 0x00, 0xff, 0x00, 0x10, 0xe4, 0x00, 0xff, 0xff, 0xf3,
+		0x26, 0x00, 0xff, 0x00, 0x0d, 0x64, 0x40, 0xff, 0xff, 0xe5, 0x27, 0x80, 0xff, 0x00, 0x1d, 0x83,
+		0xc0, 0xff, 0xff, 0xd7, 0x95, 0x40, 0x8b, 0xff, 0xff, 0xd9, 0x03, 0x80, 0x8b, 0xff, 0xff, 0xda,
+		0xe5, 0x80, 0xff, 0xff, 0xe4, 0x03, 0x40, 0xff, 0xff, 0xdb, 0x03, 0x00, 0xff, 0xff, 0xc5, 0x74,
+		0xc0, 0x08, 0x0b, 0xff, 0xfe, 0xf7, 0xec, 0x00, 0xff, 0xff, 0xcf, 0xac, 0x00, 0xff, 0xff, 0xc6,
+		0x2e, 0x00, 0xff, 0x00, 0x30, 0x54, 0x00, 0xff, 0xfe, 0xd1, 0xf3, 0x00, 0xff, 0x00, 0x7f, 0xb9,
+		0x40, 0x07, 0xff, 0x00, 0x2c, 0x35, 0xc0, 0x8b, 0xff, 0x00, 0x21, 0x58, 0x00, 0xff, 0x00, 0x02,
+		0xbb, 0x00, 0xff, 0x00, 0x23, 0x60, 0x40, 0xff, 0x00, 0x10, 0x78, 0x80, 0xff, 0x00, 0x5f, 0xe3,
+		0x40, 0xff, 0x00, 0x2c, 0xa5, 0x40, 0xff, 0x00, 0x33, 0x0b, 0x40, 0xff, 0x00, 0x77, 0x4c, 0x80,
+		0x8b, 0xff, 0x00, 0x84, 0xcf, 0xc0, 0x8b, 0xff, 0x00, 0x6a, 0x04, 0x00, 0xff, 0xff, 0xdf, 0xf4,
+		0x00, 0xff, 0x00, 0x6d, 0x72, 0x80, 0xff, 0xff, 0xb5, 0x01, 0x40, 0xff, 0x00, 0x37, 0x88, 0x40,
+		0xff, 0xff, 0xd4, 0x8f, 0xc0, 0xff, 0x00, 0x20, 0x2a, 0x40, 0xff, 0xff, 0xd4, 0xc0, 0x80, 0xff,
+		0x00, 0x04, 0xd5, 0x00, 0xff, 0xff, 0xc9, 0xf3, 0x00, 0x8b, 0x08, 0x0b, 0xff, 0x00, 0x68, 0x6c,
+		0x40, 0xff, 0x00, 0x39, 0xd2, 0x00, 0xff, 0xff, 0x97, 0x93, 0xc0, 0xff, 0x00, 0xcd, 0x65, 0x00,
+		0xff, 0x00, 0x46, 0xc4, 0x40, 0x06, 0xff, 0x00, 0x26, 0x84, 0xc0, 0x8b, 0xff, 0x00, 0x33, 0x40,
+		0x80, 0xff, 0xff, 0xfe, 0x51, 0x00, 0xff, 0x00, 0x2a, 0x90, 0x40, 0xff, 0xff, 0xc5, 0xb8, 0x00,
+		0xff, 0x00, 0x25, 0x87, 0x00, 0xff, 0xff, 0xcc, 0x9d, 0x80, 0xff, 0x00, 0x0f, 0x0a, 0x80, 0xff,
+		0xff, 0xb2, 0xd7, 0x80, 0x8b, 0xff, 0xff, 0xba, 0x8c, 0x40, 0x8b, 0xff, 0xff, 0x9d, 0x60, 0x40,
+		0xff, 0xff, 0xe0, 0x2c, 0x80, 0xff, 0xff, 0xab, 0x87, 0x00, 0xff, 0xff, 0xc3, 0xbd, 0x80, 0xff,
+		0xff, 0xd7, 0x53, 0xc0, 0xff, 0xff, 0xdc, 0xc3, 0xc0, 0xff, 0xff, 0xe8, 0x37, 0x80, 0xff, 0xff,
+		0xde, 0xce, 0x00, 0xff, 0xff, 0xfe, 0x11, 0x80, 0xff, 0xff, 0xdc, 0x65, 0x00, 0x8b, 0x08, 0xff,
+		0xff, 0xc4, 0x74, 0x00, 0x06, 0x0b, 0xff, 0xff, 0xc1, 0x00, 0x40, 0xff, 0xff, 0xd5, 0xb6, 0x80,
+		0xff, 0x00, 0x64, 0xf8, 0x80, 0xff, 0xff, 0x79, 0x5f, 0x40, 0xff, 0x00, 0x32, 0x0d, 0xc0, 0xff,
+		0x00, 0x1e, 0x34, 0x80, 0x05, 0x0b, 0xff, 0xff, 0xa7, 0xf9, 0x40, 0xff, 0xff, 0x6d, 0x4a, 0x40,
+		0xff, 0x00, 0x32, 0x0d, 0xc0, 0xff, 0xff, 0xe1, 0xcb, 0x80, 0xff, 0x00, 0x64, 0xf8, 0xc0, 0xff,
+		0x00, 0x86, 0xa0, 0xc0, 0x05, 0x0b, 0xff, 0x00, 0x25, 0xf9, 0x00, 0xff, 0xff, 0xdd, 0x7b, 0x00,
+		0xff, 0x00, 0x51, 0x1f, 0x40, 0xff, 0x00, 0x65, 0xd5, 0x80, 0xff, 0x00, 0x4d, 0xab, 0x80, 0xff,
+		0xff, 0x99, 0x4d, 0x80, 0xff, 0x00, 0x2e, 0x9a, 0x00, 0xff, 0x00, 0x22, 0x85, 0x40, 0xff, 0xff,
+		0x91, 0x89, 0x40, 0xff, 0x00, 0x8d, 0x88, 0x00, 0xff, 0xff, 0xea, 0x6c, 0xc0, 0x8b, 0x05, 0x0b,
+		0xff, 0x00, 0x1b, 0xde, 0x00, 0xff, 0xff, 0xe9, 0x5d, 0x80, 0xff, 0x00, 0x16, 0xa3, 0x00, 0xff,
+		0xff, 0xe4, 0x22, 0x40, 0xff, 0xff, 0xe4, 0x22, 0x40, 0xff, 0xff, 0xe9, 0x5d, 0x40, 0xff, 0xff,
+		0xe9, 0x5d, 0x00, 0xff, 0xff, 0xe4, 0x22, 0x40, 0xff, 0xff, 0xe4, 0x22, 0x40, 0xff, 0x00, 0x16,
+		0xa3, 0x00, 0xff, 0xff, 0xe9, 0x5d, 0xc0, 0xff, 0x00, 0x1b, 0xdd, 0xc0, 0xff, 0x00, 0x1b, 0xdd,
+		0x40, 0xff, 0x00, 0x16, 0xa2, 0xc0, 0xff, 0x00, 0x16, 0xa2, 0xc0, 0xff, 0x00, 0x1b, 0xdd, 0x00,
+		0x1e, 0x0b, 0xff, 0x00, 0x1b, 0xee, 0x40, 0xff, 0xff, 0xe9, 0x81, 0x40, 0xff, 0x00, 0x16, 0x93,
+		0x00, 0xff, 0xff, 0xe4, 0x72, 0x40, 0xff, 0xff, 0xe4, 0x6c, 0x00, 0xff, 0xff, 0xe9, 0x84, 0x00,
+		0xff, 0xff, 0xe9, 0x69, 0xc0, 0xff, 0xff, 0xe4, 0x15, 0x40, 0xff, 0xff, 0xe4, 0x13, 0x40, 0xff,
+		0x00, 0x16, 0x7e, 0x00, 0xff, 0xff, 0xe9, 0x6b, 0x80, 0xff, 0x00, 0x1b, 0x91, 0x80, 0xff, 0x00,
+		0x1b, 0x92, 0xc0, 0xff, 0x00, 0x16, 0x7a, 0x40, 0xff, 0x00, 0x16, 0x97, 0x40, 0xff, 0x00, 0x1b,
+		0xe9, 0xc0, 0x1e, 0x0b, 0xff, 0x00, 0x30, 0x30, 0x80, 0xff, 0xff, 0xd7, 0x72, 0x40, 0xff, 0x00,
+		0x27, 0xd7, 0xc0, 0xff, 0xff, 0xcc, 0xfe, 0xc0, 0xff, 0xff, 0xcd, 0x0a, 0x00, 0xff, 0xff, 0xd7,
+		0x7d, 0xc0, 0xff, 0xff, 0xd8, 0x2c, 0x80, 0xff, 0xff, 0xcf, 0xda, 0x40, 0xff, 0xff, 0xcf, 0xb3,
+		0xc0, 0xff, 0x00, 0x28, 0x96, 0x00, 0xff, 0xff, 0xd8, 0x2d, 0xc0, 0xff, 0x00, 0x32, 0xe5, 0x00,
+		0xff, 0x00, 0x33, 0x04, 0x40, 0xff, 0x00, 0x28, 0x88, 0x00, 0xff, 0x00, 0x27, 0xdc, 0x00, 0xff,
+		0x00, 0x30, 0x33, 0x80, 0x1e, 0x0b, 0xff, 0x00, 0x1a, 0x25, 0xc0, 0xff, 0x00, 0x13, 0x0f, 0x80,
+		0xff, 0x00, 0x13, 0xcc, 0x00, 0xff, 0x00, 0x16, 0x75, 0x00, 0xff, 0x00, 0x16, 0xb4, 0x80, 0xff,
+		0x00, 0x12, 0xba, 0xc0, 0xff, 0xff, 0xeb, 0xfe, 0x00, 0xff, 0xff, 0xe6, 0x51, 0x40, 0xff, 0xff,
+		0xe5, 0xe9, 0x00, 0xff, 0xff, 0xed, 0x03, 0x00, 0xff, 0xff, 0xec, 0x34, 0x00, 0xff, 0xff, 0xe9,
+		0x87, 0xc0, 0xff, 0xff, 0xe9, 0x3e, 0x80, 0xff, 0xff, 0xed, 0x43, 0x00, 0xff, 0x00, 0x14, 0x08,
+		0x80, 0xff, 0x00, 0x19, 0x99, 0x80, 0x1e, 0x0b, 0xff, 0xff, 0xcc, 0xd3, 0x80, 0xff, 0x00, 0x21,
+		0xe3, 0x00, 0xff, 0xff, 0xe0, 0x3e, 0x80, 0xff, 0x00, 0x23, 0x91, 0x80, 0xff, 0x00, 0x20, 0xe9,
+		0x40, 0xff, 0x00, 0x18, 0xa6, 0x80, 0xff, 0x00, 0x1a, 0xd2, 0x80, 0xff, 0x00, 0x1e, 0x34, 0x00,
+		0x1e, 0x8b, 0xff, 0x00, 0x1a, 0xe3, 0x80, 0xff, 0xff, 0xec, 0xf3, 0x40, 0xff, 0x00, 0x0b, 0x7f,
+		0x80, 0xff, 0xff, 0xf7, 0x2a, 0x40, 0xff, 0x00, 0x05, 0xe0, 0x40, 0xff, 0xff, 0xf7, 0x50, 0x00,
+		0xff, 0x00, 0x05, 0xc7, 0x40, 0xff, 0xff, 0xf1, 0x43, 0x40, 0xff, 0x00, 0x09, 0x35, 0x40, 0x8b,
+		0xff, 0x00, 0x14, 0x96, 0x40, 0x8b, 0xff, 0x00, 0x10, 0x8c, 0x80, 0xff, 0x00, 0x09, 0xec, 0x80,
+		0xff, 0x00, 0x11, 0x17, 0x40, 0xff, 0x00, 0x04, 0xe2, 0x40, 0xff, 0x00, 0x08, 0x05, 0xc0, 0xff,
+		0x00, 0x09, 0xc4, 0x80, 0xff, 0x00, 0x10, 0x0c, 0x40, 0xff, 0x00, 0x10, 0xcd, 0x40, 0xff, 0x00,
+		0x18, 0x55, 0x80, 0xff, 0x00, 0x17, 0xb7, 0x80, 0xff, 0x00, 0x15, 0xcf, 0xc0, 0x08, 0xff, 0xff,
+		0xdd, 0x7b, 0x00, 0xff, 0x00, 0x1e, 0x34, 0x80, 0x05, 0xff, 0xff, 0xba, 0x59, 0xc0, 0xff, 0xff,
+		0xb9, 0x48, 0x80, 0xff, 0xff, 0xdb, 0x5e, 0x40, 0xff, 0xff, 0xbe, 0xca, 0x00, 0x8b, 0xff, 0xff,
+		0xcb, 0xef, 0x80, 0x08, 0x0b, 0xff, 0xff, 0xdb, 0xc1, 0x00, 0xff, 0xff, 0xd2, 0x43, 0x00, 0x05,
+		0xff, 0x00, 0x27, 0xab, 0x00, 0xff, 0xff, 0xd0, 0x40, 0x80, 0xff, 0x00, 0x36, 0x93, 0x80, 0xff,
+		0xff, 0xe2, 0xed, 0x40, 0xff, 0x00, 0x36, 0x9f, 0x40, 0x8b, 0xff, 0x00, 0x3c, 0x6c, 0x80, 0x8b,
+		0xff, 0x00, 0x34, 0xe0, 0x40, 0xff, 0x00, 0x22, 0x64, 0xc0, 0xff, 0x00, 0x21, 0xd8, 0x00, 0xff,
+		0x00, 0x2d, 0xe1, 0x00, 0x08, 0xff, 0xff, 0xe3, 0x85, 0x40, 0xff, 0x00, 0x29, 0x6c, 0xc0, 0x05,
+		0xff, 0xff, 0xdd, 0xe2, 0x00, 0xff, 0xff, 0xd3, 0xdc, 0xc0, 0xff, 0xff, 0xd4, 0xff, 0x40, 0xff,
+		0xff, 0xe6, 0x3a, 0x80, 0xff, 0xff, 0xd6, 0x4d, 0x80, 0x8b, 0xff, 0xff, 0xce, 0x9b, 0x00, 0x8b,
+		0xff, 0xff, 0xd7, 0xbc, 0x40, 0xff, 0x00, 0x22, 0xb5, 0x80, 0xff, 0xff, 0xe9, 0x31, 0x40, 0xff,
+		0x00, 0x24, 0x10, 0x00, 0x08, 0x0b, 0xff, 0x00, 0x2e, 0x9a, 0x00, 0xff, 0xff, 0xe6, 0x1c, 0x40,
+		0xff, 0x01, 0x3a, 0x21, 0xc0, 0xff, 0x02, 0xa8, 0x0b, 0x40, 0xff, 0xff, 0xd0, 0x89, 0x00, 0xff,
+		0x00, 0x1a, 0xc0, 0xc0, 0x05, 0x0b, 0xff, 0xff, 0x5f, 0xd3, 0xc0, 0xff, 0xff, 0x32, 0xf3, 0x80,
+		0x8b, 0xff, 0xff, 0xe3, 0xb1, 0x80, 0xff, 0x00, 0x91, 0xac, 0xc0, 0x8b, 0x8b, 0xff, 0xff, 0xb1,
+		0xfc, 0x40, 0xff, 0x00, 0x2d, 0x91, 0x00, 0x8b, 0x8b, 0xff, 0x00, 0x4d, 0x53, 0x40, 0xff, 0x00,
+		0x32, 0x66, 0x40, 0x8b, 0x8b, 0xff, 0x00, 0x25, 0xf8, 0xc0, 0xff, 0xff, 0xcd, 0x99, 0xc0, 0x8b,
+		0x8b, 0xff, 0x00, 0xc4, 0x12, 0xc0, 0x05, 0x0b, 0xff, 0xff, 0x89, 0xf1, 0x00, 0xff, 0xff, 0xa2,
+		0x1b, 0x00, 0x07, 0x0b, 0xff, 0xff, 0xde, 0x2b, 0xc0, 0x8b, 0xff, 0xff, 0x96, 0x5e, 0x40, 0xff,
+		0xff, 0xc6, 0x01, 0x80, 0xff, 0x00, 0x0d, 0x1e, 0x00, 0xff, 0xff, 0xe7, 0x25, 0x80, 0xff, 0x00,
+		0x4c, 0xa2, 0x80, 0xff, 0x00, 0x13, 0x54, 0x80, 0x8b, 0xff, 0xff, 0x3b, 0x3c, 0xc0, 0xff, 0xff,
+		0xb0, 0x9a, 0x80, 0x8b, 0x8b, 0xff, 0xff, 0xd4, 0x81, 0x40, 0xff, 0x00, 0xcb, 0xab, 0x40, 0x8b,
+		0x8b, 0xff, 0x00, 0x2b, 0x7e, 0xc0, 0xff, 0xff, 0xb5, 0x6f, 0xc0, 0x8b, 0x05, 0x0b, 0xff, 0xff,
+		0x7c, 0xd3, 0x00, 0xff, 0xff, 0x83, 0xba, 0x40, 0xff, 0x00, 0x1f, 0xee, 0x40, 0xff, 0xff, 0xd6,
+		0x93, 0x80, 0xff, 0x00, 0x91, 0xd8, 0xc0, 0xff, 0x00, 0x64, 0xf8, 0x80, 0x05, 0x0b, 0xff, 0xff,
+		0x7c, 0xd3, 0x00, 0xff, 0xff, 0x83, 0xba, 0x40, 0xff, 0x00, 0x1f, 0xee, 0x40, 0xff, 0xff, 0xd6,
+		0x93, 0x80, 0xff, 0x00, 0x91, 0xd9, 0x00, 0xff, 0x00, 0x64, 0xf8, 0x80, 0x05, 0x0b, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+		0x00, 0x01, 0x01, 0x66, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0xf4, 0x00, 0x00, 0x01, 0xeb, 0x00, 0x00, 0x01, 0xe3, 0x00, 0x00, 0x01, 0xda, 0x00, 0x00,
+		0x01, 0xd2, 0x00, 0x00, 0x01, 0xc9, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0xb8, 0x00, 0x00,
+		0x01, 0xaf, 0x00, 0x00, 0x01, 0xa6, 0x00, 0x00, 0x01, 0x9e, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+		0x01, 0x8c, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x7b, 0x00, 0x00, 0x01, 0x73, 0x00, 0x00,
+		0x01, 0x6a, 0x00, 0x00, 0x01, 0x61, 0x00, 0x00, 0x01, 0x59, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
+		0x01, 0x47, 0x00, 0x00, 0x01, 0x3f, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00,
+		0x01, 0x25, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x00,
+		0x01, 0x02, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00,
+		0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0xb4, 0x01, 0xf4, 0x00, 0x6f, 0x01, 0xf4, 0x00, 0x19,
+		0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0xce,
+		0x01, 0xf4, 0x00, 0x8a, 0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x2c,
+		0x01, 0xf4, 0x00, 0xa4, 0x01, 0xf4, 0x00, 0x46, 0x01, 0xf4, 0x00, 0xb3, 0x01, 0xf4, 0x00, 0x3f,
+		0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x5b, 0x01, 0xf4, 0x00, 0x49, 0x01, 0xf4, 0x00, 0x45,
+		0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x3f, 0x01, 0xf4, 0x00, 0x43, 0x01, 0xf4, 0x00, 0x4e,
+		0x01, 0xf4, 0x00, 0x3c, 0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0xb3, 0x01, 0xf4, 0x00, 0xa4,
+		0x01, 0xf4, 0x00, 0x22, 0x01, 0xf4, 0x00, 0x2c, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x3f,
+		0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x28,
+		0x01, 0xf4, 0x00, 0x35, 0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x4d, 0x01, 0xf4, 0x00, 0x24,
+		0x01, 0xf4, 0x00, 0x36, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x2a,
+		0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x1d,
+		0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x33,
+		0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x19, 0x01, 0xf4, 0x00, 0x11,
+		0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x83,
+		0x01, 0xf4, 0x00, 0x3f, 0x01, 0xf4, 0x00, 0x52, 0x01, 0xf4, 0x00, 0x5d, 0x01, 0xf4, 0x00, 0x22,
+		0x01, 0xf4, 0x00, 0x8b, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x38,
+		0x01, 0xf4, 0x00, 0x2c, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x3e, 0x01, 0xf4, 0x00, 0x26,
+		0x01, 0xf4, 0x00, 0x45, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x42,
+		0x01, 0xf4, 0x00, 0x4e, 0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0x28,
+		0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x2a, 0x01, 0xf4, 0x00, 0x63, 0x01, 0xf4, 0x00, 0x38,
+		0x01, 0xf4, 0x00, 0x45, 0x01, 0xf4, 0x00, 0x3e, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x0f,
+		0x01, 0xf4, 0x00, 0x2f, 0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x34,
+		0x01, 0xf4, 0x00, 0xd8, 0x01, 0xf4, 0x00, 0x5c, 0x01, 0xf4, 0x00, 0x29, 0x00, 0xe0, 0x00, 0x00,
+		0x00, 0xd7, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00,
+		0x00, 0xb5, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00,
+		0x00, 0x92, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+		0x00, 0x70, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00,
+		0x00, 0x4d, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00,
+		0x00, 0x2b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00,
+		0xff, 0xe7, 0x00, 0x00, 0xff, 0xde, 0x00, 0x00, 0xff, 0xd5, 0x00, 0x00, 0xff, 0xcd, 0x00, 0x00,
+		0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0xb4, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x26,
+		0x01, 0xf4, 0x00, 0x20, 0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0x33, 0x01, 0xf4, 0x00, 0x40,
+		0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x0d, 0x01, 0xf4, 0x00, 0x4b, 0x01, 0xf4, 0x00, 0x43,
+		0x01, 0xf4, 0x00, 0x5b, 0x01, 0xf4, 0x00, 0x46, 0x01, 0xf4, 0x00, 0x0d, 0x01, 0xf4, 0x00, 0x7b,
+		0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x2c, 0x01, 0xf4, 0x00, 0x6f, 0x01, 0xf4, 0x00, 0x70,
+		0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x18, 0x01, 0xf4, 0x00, 0x3f, 0x01, 0xf4, 0x00, 0xb3,
+		0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x7b, 0x01, 0xf4, 0x00, 0x4b, 0x01, 0xf4, 0x00, 0x43,
+		0x01, 0xf4, 0x00, 0x09, 0x01, 0xf4, 0x00, 0x06, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x43,
+		0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x0e,
+		0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x04, 0x01, 0xf4, 0x00, 0x28,
+		0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x3a,
+		0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51,
+		0x01, 0xf4, 0x00, 0x1e, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x1d,
+		0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x54,
+		0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+		0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x37,
+		0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+		0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x38,
+		0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x30,
+		0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64,
+		0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
+		0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x46,
+		0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x3e, 0x01, 0xf4, 0x00, 0x3e, 0x01, 0xf4, 0x00, 0x3e,
+		0x01, 0xf4, 0x00, 0x3e, 0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x3c, 0x01, 0xf4, 0x00, 0x16,
+		0x01, 0xf4, 0x00, 0x2c, 0x01, 0xf4, 0x00, 0xa4, 0x01, 0xf4, 0x00, 0xb6, 0x01, 0xf4, 0x00, 0xb4,
+		0x01, 0xf4, 0x00, 0xcb, 0x01, 0xf4, 0x00, 0x85, 0x01, 0xf4, 0x00, 0x5a, 0x01, 0xf4, 0x00, 0x7b,
+		0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0xca, 0x01, 0xf4, 0x00, 0x70, 0x01, 0xf4, 0x00, 0x7d,
+		0x01, 0xf4, 0x00, 0xa4, 0x01, 0xf4, 0x00, 0x9d, 0x01, 0xf4, 0x01, 0x14, 0x01, 0xf4, 0x00, 0x85,
+		0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x90, 0x01, 0xf4, 0x00, 0x90, 0x01, 0xf4, 0x00, 0x71,
+		0x01, 0xf4, 0x00, 0x71, 0x01, 0xf4, 0x00, 0xa7, 0x01, 0xf4, 0x00, 0xac, 0x01, 0xf4, 0x00, 0x28,
+		0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0xd8, 0x01, 0xf4, 0x00, 0x06, 0x01, 0xf4, 0x00, 0x06,
+		0x01, 0xf4, 0x00, 0x0b, 0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x13, 0x01, 0xf4, 0x00, 0x42,
+		0x01, 0xf4, 0x00, 0x33, 0x01, 0xf4, 0x00, 0x33, 0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x32,
+		0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x42,
+		0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x3a,
+		0x01, 0xf4, 0x00, 0x35, 0x01, 0xf4, 0x00, 0x1e, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+		0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+		0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x38,
+		0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x3d, 0x01, 0xf4, 0x00, 0x4e,
+		0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x63,
+		0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x45,
+		0x01, 0xf4, 0x00, 0x3e, 0x01, 0xf4, 0x00, 0x3e, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x4e,
+		0x01, 0xf4, 0x00, 0x30, 0xff, 0xc4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x42, 0x00, 0x30, 0x00, 0x44,
+		0x00, 0xa4, 0x00, 0x4e, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x06, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x30,
+		0x00, 0x3e, 0x00, 0x26, 0x00, 0x65, 0x00, 0x65, 0x00, 0x4b, 0x00, 0x32, 0x00, 0x25, 0x00, 0x24,
+		0x00, 0x51, 0x00, 0x63, 0x00, 0x2c, 0x00, 0x32, 0x00, 0xaa, 0x00, 0x12, 0x00, 0x31, 0x00, 0x31,
+		0x00, 0x11, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x8e, 0x49, 0xbc,
+		0x00, 0x00, 0x00, 0x00, 0xc1, 0x59, 0x76, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xe9, 0x87, 0xd3,
+	};
+	const std::size_t InconsolataSize = sizeof( Inconsolata );
+}
+
+}//End of namespace wEngine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,43 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_EMBEDDED_FONTS_HPP
+#define W_EMBEDDED_FONTS_HPP
+
+#include <cstddef>
+
+/**
+ * @def WPLOT2D_EMBED_FONTS
+ * @brief Build option: define it (e.g. `-DWPLOT2D_EMBED_FONTS`) to compile the bundled fonts into the binary.
+ *
+ * GraphicsEntity then loads Courier and Inconsolata from memory: no executable path lookup,
+ * no file probing, and no dependency on the Resources/Fonts deployment layout.
+ * Without it, the fonts are read from Resources/Fonts at run time and the arrays are not compiled.
+ */
+#ifdef WPLOT2D_EMBED_FONTS
+
+namespace wEngine
+{
+
+	/**
+	 * @namespace wEngine::EmbeddedFonts
+	 * @brief Raw bytes of the fonts bundled with wPlot2D (see wEmbeddedFonts.cpp).
+	 */
+	namespace EmbeddedFonts
+	{
+		extern const unsigned char CourierPrimeCode[ ];		///< CourierPrimeCode.ttf
+		extern const std::size_t CourierPrimeCodeSize;		///< Size of CourierPrimeCode in bytes.
+
+		extern const unsigned char Inconsolata[ ];			///< Inconsolata.otf
+		extern const std::size_t InconsolataSize;			///< Size of Inconsolata in bytes.
+	}
+
+}//End of namespace wEngine
+
+#endif
+
+#endif
\ No newline at end of file
@@ -4,6 +4,7 @@
  */
 
 #include "wLineDrawer.hpp"
+#include <algorithm>
 #include <cmath>
 #include <numbers>
 
@@ -16,7 +17,34 @@ namespace wEngine
 +---------------------------------------------------------------------------------------------------------------------------------------------------+
 */
 
-float LineDrawer::drawLine( sf::RenderWindow& window, const sf::Vector2f& point1, const sf::Vector2f& point2,
+float LineDrawer::drawLine( sf::RenderTarget& window, const sf::Vector2f& point1, const sf::Vector2f& point2,
+	const sf::Color& color, float thickness, LineStyleComponent::LineStyle style, float dashLength,
+	float gapLength, float patternOffset )
+{
+	sf::VertexArray batch( sf::PrimitiveType::Triangles );
+	patternOffset = appendLine( batch, point1, point2, color, thickness, style, dashLength, gapLength, patternOffset );
+
+	if (batch.getVertexCount( ) > 0)
+	{
+		window.draw( batch );
+	}
+
+	return patternOffset;
+}
+
+void LineDrawer::drawPolylineRound( sf::RenderTarget& window, const std::vector< sf::Vector2f >& points, const sf::Color& color, float thickness,
+	LineStyleComponent::LineStyle style, float dashLength, float gapLength, unsigned int arcResolution )
+{
+	sf::VertexArray batch( sf::PrimitiveType::Triangles );
+	appendPolylineRound( batch, points, color, thickness, style, dashLength, gapLength, arcResolution );
+
+	if (batch.getVertexCount( ) > 0)
+	{
+		window.draw( batch );
+	}
+}
+
+float LineDrawer::appendLine( sf::VertexArray& batch, const sf::Vector2f& point1, const sf::Vector2f& point2,
 	const sf::Color& color, float thickness, LineStyleComponent::LineStyle style, float dashLength,
 	float gapLength, float patternOffset )
 {
@@ -34,18 +62,10 @@ float LineDrawer::drawLine( sf::RenderWindow& window, const sf::Vector2f& point1
 	// Perpendicular vector scaled by half the thickness -> used to build quads
 	sf::Vector2f offset = unitDir.perpendicular( ) * ( thickness / 2.0f );
 
-	// Case 1: Solid line -> draw the full quad once
+	// Case 1: Solid line -> emit the full quad once
 	if (style == LineStyleComponent::LineStyle::Solid)
 	{
-		// Simple rectangle strip for the full segment
-		sf::VertexArray quad( sf::PrimitiveType::TriangleStrip, 4) ;
-
-		quad[ 0 ] = sf::Vertex( point1 - offset, color );
-		quad[ 1 ] = sf::Vertex( point1 + offset, color );
-		quad[ 2 ] = sf::Vertex( point2 - offset, color );
-		quad[ 3 ] = sf::Vertex( point2 + offset, color );
-
-		window.draw( quad );
+		appendQuad( batch, point1, point2, offset, color );
 
 		return patternOffset; // no change, pattern not used
 	}
@@ -94,13 +114,8 @@ float LineDrawer::drawLine( sf::RenderWindow& window, const sf::Vector2f& point1
 		sf::Vector2f p1 = point1 + unitDir * segStart;
 		sf::Vector2f p2 = point1 + unitDir * segEnd;
 
-		// Draw this dash/dot as a quad (thick line segment)
-		sf::VertexArray quad( sf::PrimitiveType::TriangleStrip, 4 );
-		quad[ 0 ] = sf::Vertex( p1 - offset, color );
-		quad[ 1 ] = sf::Vertex( p1 + offset, color );
-		quad[ 2 ] = sf::Vertex( p2 - offset, color );
-		quad[ 3 ] = sf::Vertex( p2 + offset, color );
-		window.draw( quad );
+		// Emit this dash/dot as a quad (thick line segment)
+		appendQuad( batch, p1, p2, offset, color );
 
 		// Advance to the end of this drawn segment
 		traveled = segEnd;
@@ -110,7 +125,7 @@ float LineDrawer::drawLine( sf::RenderWindow& window, const sf::Vector2f& point1
 	return fmodf( patternOffset + length, patternLength );
 }
 
-void LineDrawer::drawPolylineRound( sf::RenderWindow& window, const std::vector< sf::Vector2f >& points, const sf::Color& color, float thickness,
+void LineDrawer::appendPolylineRound( sf::VertexArray& batch, const std::vector< sf::Vector2f >& points, const sf::Color& color, float thickness,
 	LineStyleComponent::LineStyle style, float dashLength, float gapLength, unsigned int arcResolution )
 {
 	// Early exit: a polyline requires at least two points
@@ -134,13 +149,13 @@ void LineDrawer::drawPolylineRound( sf::RenderWindow& window, const std::vector<
 			continue;
 		}
 
-		// --- Step 1: Draw the current segment ---
-		// Calls drawLine( ), which handles solid/dashed/dotted rendering.
-		// drawLine( ) returns the updated pattern offset, so the dash/dot
-		// pattern continues seamlessly into the next segment.
-		patternOffset = drawLine( window, p1, p2, color, thickness, style, dashLength, gapLength, patternOffset );
+		// --- Step 1: Emit the current segment ---
+		// appendLine( ) handles solid/dashed/dotted tessellation and returns
+		// the updated pattern offset, so the dash/dot pattern continues
+		// seamlessly into the next segment.
+		patternOffset = appendLine( batch, p1, p2, color, thickness, style, dashLength, gapLength, patternOffset );
 
-		// --- Step 2: Draw a round join (only for SOLID style) ---
+		// --- Step 2: Emit a round join (only for SOLID style) ---
 		// For dashed/dotted, round joins would look strange, so we skip them.
 		if (style == LineStyleComponent::LineStyle::Solid && i < points.size( ) - 2)
 		{
@@ -151,51 +166,250 @@ void LineDrawer::drawPolylineRound( sf::RenderWindow& window, const std::vector<
 			{
 				continue;
 			}
-			
-			// Compute normalized direction vectors of the two segments:
-			// dir1 = direction of [p1 -> p2]
-			// dir2 = direction of [p2 -> p3]
-			sf::Vector2f dir1 = (p2 - p1).normalized( );
-			sf::Vector2f dir2 = (p3 - p2).normalized( );
-
-			// Compute normals (perpendiculars) of the two directions
-			sf::Vector2f n1( -dir1.y, dir1.x );
-			sf::Vector2f n2( -dir2.y, dir2.x );
-
-			// Convert normals to angles (in radians)
-			float angle1 = std::atan2( n1.y, n1.x );
-			float angle2 = std::atan2( n2.y, n2.x );
-
-			// Ensure angles are in the correct order (no wrap-around issue)
-			if (angle2 < angle1)
+
+			appendRoundJoin( batch, p1, p2, p3, color, thickness, arcResolution );
+		}
+	}
+}
+
+std::optional< std::pair< sf::Vector2f, sf::Vector2f > > LineDrawer::clipSegment( const sf::Vector2f& point1, const sf::Vector2f& point2,
+	const sf::FloatRect& clipRect )
+{
+	if (!std::isfinite( point1.x ) || !std::isfinite( point1.y ) || !std::isfinite( point2.x ) || !std::isfinite( point2.y ))
+	{
+		return std::nullopt;
+	}
+
+	const double x1 = point1.x, y1 = point1.y;
+	const double dx = static_cast< double >( point2.x ) - x1;
+	const double dy = static_cast< double >( point2.y ) - y1;
+
+	// Edges in the order left, right, top, bottom
+	const double edge[ 4 ] = {
+		clipRect.position.x,
+		static_cast< double >( clipRect.position.x ) + clipRect.size.x,
+		clipRect.position.y,
+		static_cast< double >( clipRect.position.y ) + clipRect.size.y
+	};
+
+	// Liang–Barsky: each edge is a half-plane p * t <= q. Entering edges (p < 0) raise t0,
+	// leaving edges (p > 0) lower t1, and the segment is rejected once t0 > t1.
+	const double p[ 4 ] = { -dx, dx, -dy, dy };
+	const double q[ 4 ] = { x1 - edge[ 0 ], edge[ 1 ] - x1, y1 - edge[ 2 ], edge[ 3 ] - y1 };
+
+	double t0 = 0.0;
+	double t1 = 1.0;
+	int edge0 = -1;
+	int edge1 = -1;
+
+	for (int k = 0; k < 4; ++k)
+	{
+		// Parallel to this edge: either fully outside or unaffected by it
+		if (!(p[ k ] < 0.0) && !(p[ k ] > 0.0))
+		{
+			if (q[ k ] < 0.0)
 			{
-				angle2 += 2.0f * static_cast< float >( std::numbers::pi );
+				return std::nullopt;
 			}
+			continue;
+		}
 
-			// Subdivide the arc between n1 and n2 into 'arcResolution' steps
-			float step = (angle2 - angle1) / static_cast< float >( arcResolution );
+		const double t = q[ k ] / p[ k ];
+		if (p[ k ] < 0.0 && t > t0)
+		{
+			t0 = t;
+			edge0 = k;
+		}
+		else if (p[ k ] > 0.0 && t < t1)
+		{
+			t1 = t;
+			edge1 = k;
+		}
 
-			// Build the round join as a triangle fan centered on p2
-			sf::VertexArray arc( sf::PrimitiveType::Triangles );
-			for (unsigned int k = 0; k < arcResolution; ++k)
-			{
-				float a1 = angle1 + static_cast< float >( k ) * step;
-				float a2 = angle1 + (static_cast< float >( k ) + 1) * step;
+		if (t0 > t1)
+		{
+			return std::nullopt;
+		}
+	}
+
+	// An endpoint cut by an edge lies exactly on it; the other coordinate is interpolated
+	auto pointAt = [ & ]( double t, int k, const sf::Vector2f& unclipped )
+	{
+		if (k < 0)
+		{
+			return unclipped;
+		}
+
+		return k < 2
+			? sf::Vector2f( static_cast< float >( edge[ k ] ), static_cast< float >( y1 + dy * t ) )
+			: sf::Vector2f( static_cast< float >( x1 + dx * t ), static_cast< float >( edge[ k ] ) );
+	};
 
-				// Unit vectors along the arc
-				sf::Vector2f v1( std::cos( a1 ), std::sin( a1 ) );
-				sf::Vector2f v2( std::cos( a2 ), std::sin( a2 ) );
+	return std::make_pair( pointAt( t0, edge0, point1 ), pointAt( t1, edge1, point2 ) );
+}
+
+sf::FloatRect LineDrawer::getClipRect( const sf::RenderTarget& target, float margin )
+{
+	const sf::Vector2u size = target.getSize( );
+	const sf::Vector2f corner1 = target.mapPixelToCoords( sf::Vector2i( 0, 0 ) );
+	const sf::Vector2f corner2 = target.mapPixelToCoords( sf::Vector2i( static_cast< int >( size.x ), static_cast< int >( size.y ) ) );
+
+	const sf::Vector2f topLeft( std::min( corner1.x, corner2.x ) - margin, std::min( corner1.y, corner2.y ) - margin );
+	const sf::Vector2f bottomRight( std::max( corner1.x, corner2.x ) + margin, std::max( corner1.y, corner2.y ) + margin );
+
+	return sf::FloatRect( topLeft, bottomRight - topLeft );
+}
+
+float LineDrawer::appendClippedLine( sf::VertexArray& batch, const sf::Vector2f& point1, const sf::Vector2f& point2,
+	const sf::FloatRect& clipRect, const sf::Color& color, float thickness, LineStyleComponent::LineStyle style,
+	float dashLength, float gapLength, float patternOffset )
+{
+	if (point1 == point2)
+	{
+		return patternOffset;
+	}
+
+	// Non-finite segments cannot be clipped nor measured: skip them without touching the pattern
+	if (!std::isfinite( point1.x ) || !std::isfinite( point1.y ) || !std::isfinite( point2.x ) || !std::isfinite( point2.y ))
+	{
+		return patternOffset;
+	}
 
-				// Triangle = (center, arc point 1, arc point 2)
-				arc.append( sf::Vertex( p2, color ) );
-				arc.append( sf::Vertex( p2 + v1 * (thickness / 2.0f), color ) );
-				arc.append( sf::Vertex( p2 + v2 * (thickness / 2.0f), color ) );
+	// Distances in double: the length of a steep segment between finite float points may not fit in a float
+	auto distance = []( const sf::Vector2f& from, const sf::Vector2f& to )
+	{
+		return std::hypot( static_cast< double >( to.x ) - static_cast< double >( from.x ),
+			static_cast< double >( to.y ) - static_cast< double >( from.y ) );
+	};
+
+	const double length = distance( point1, point2 );
+
+	auto visible = clipSegment( point1, point2, clipRect );
+	if (visible && visible->first != visible->second)
+	{
+		// The pattern starts where the visible part starts, as if the whole segment had been drawn
+		const double hidden = distance( point1, visible->first );
+		float visibleOffset = advancePattern( patternOffset, hidden, thickness, style, dashLength, gapLength );
+		appendLine( batch, visible->first, visible->second, color, thickness, style, dashLength, gapLength, visibleOffset );
+	}
+
+	return advancePattern( patternOffset, length, thickness, style, dashLength, gapLength );
+}
+
+void LineDrawer::appendClippedPolylineRound( sf::VertexArray& batch, const std::vector< sf::Vector2f >& points, const sf::FloatRect& clipRect,
+	const sf::Color& color, float thickness, LineStyleComponent::LineStyle style, float dashLength, float gapLength, unsigned int arcResolution )
+{
+	if (points.size( ) < 2)
+	{
+		return;
+	}
+
+	auto isFinite = []( const sf::Vector2f& point ) { return std::isfinite( point.x ) && std::isfinite( point.y ); };
+
+	float patternOffset = 0.0f;
+
+	for (size_t i = 0; i < points.size( ) - 1; ++i)
+	{
+		const sf::Vector2f& p1 = points[ i ];
+		const sf::Vector2f& p2 = points[ i+1 ];
+
+		if (p1 == p2)
+		{
+			continue;
+		}
+
+		patternOffset = appendClippedLine( batch, p1, p2, clipRect, color, thickness, style, dashLength, gapLength, patternOffset );
+
+		// A join is only visible if its point is: joins outside the rectangle are skipped with the segments
+		if (style == LineStyleComponent::LineStyle::Solid && i < points.size( ) - 2 && clipRect.contains( p2 ))
+		{
+			const sf::Vector2f& p3 = points[ i+2 ];
+
+			if (p2 == p3 || !isFinite( p1 ) || !isFinite( p3 ))
+			{
+				continue;
 			}
 
-			// Render the arc
-			window.draw( arc );
+			appendRoundJoin( batch, p1, p2, p3, color, thickness, arcResolution );
 		}
 	}
 }
 
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+float LineDrawer::advancePattern( float patternOffset, double distance, float thickness,
+	LineStyleComponent::LineStyle style, float dashLength, float gapLength )
+{
+	if (style == LineStyleComponent::LineStyle::Solid)
+	{
+		return patternOffset;
+	}
+
+	double patternLength = (style == LineStyleComponent::LineStyle::Dashed)
+		? static_cast< double >( dashLength + gapLength )
+		: static_cast< double >( thickness + gapLength );
+
+	return static_cast< float >( std::fmod( static_cast< double >( patternOffset ) + distance, patternLength ) );
+}
+
+void LineDrawer::appendQuad( sf::VertexArray& batch, const sf::Vector2f& point1, const sf::Vector2f& point2,
+	const sf::Vector2f& offset, const sf::Color& color )
+{
+	// Two triangles covering the rectangle [point1 - offset, point2 + offset]
+	batch.append( sf::Vertex( point1 - offset, color ) );
+	batch.append( sf::Vertex( point1 + offset, color ) );
+	batch.append( sf::Vertex( point2 - offset, color ) );
+
+	batch.append( sf::Vertex( point1 + offset, color ) );
+	batch.append( sf::Vertex( point2 + offset, color ) );
+	batch.append( sf::Vertex( point2 - offset, color ) );
+}
+
+void LineDrawer::appendRoundJoin( sf::VertexArray& batch, const sf::Vector2f& p1, const sf::Vector2f& p2, const sf::Vector2f& p3,
+	const sf::Color& color, float thickness, unsigned int arcResolution )
+{
+	// Compute normalized direction vectors of the two segments:
+	// dir1 = direction of [p1 -> p2]
+	// dir2 = direction of [p2 -> p3]
+	sf::Vector2f dir1 = (p2 - p1).normalized( );
+	sf::Vector2f dir2 = (p3 - p2).normalized( );
+
+	// Compute normals (perpendiculars) of the two directions
+	sf::Vector2f n1( -dir1.y, dir1.x );
+	sf::Vector2f n2( -dir2.y, dir2.x );
+
+	// Convert normals to angles (in radians)
+	float angle1 = std::atan2( n1.y, n1.x );
+	float angle2 = std::atan2( n2.y, n2.x );
+
+	// Ensure angles are in the correct order (no wrap-around issue)
+	if (angle2 < angle1)
+	{
+		angle2 += 2.0f * static_cast< float >( std::numbers::pi );
+	}
+
+	// Subdivide the arc between n1 and n2 into 'arcResolution' steps
+	float step = (angle2 - angle1) / static_cast< float >( arcResolution );
+
+	// Build the round join as a triangle fan centered on p2
+	for (unsigned int k = 0; k < arcResolution; ++k)
+	{
+		float a1 = angle1 + static_cast< float >( k ) * step;
+		float a2 = angle1 + (static_cast< float >( k ) + 1) * step;
+
+		// Unit vectors along the arc
+		sf::Vector2f v1( std::cos( a1 ), std::sin( a1 ) );
+		sf::Vector2f v2( std::cos( a2 ), std::sin( a2 ) );
+
+		// Triangle = (center, arc point 1, arc point 2)
+		batch.append( sf::Vertex( p2, color ) );
+		batch.append( sf::Vertex( p2 + v1 * (thickness / 2.0f), color ) );
+		batch.append( sf::Vertex( p2 + v2 * (thickness / 2.0f), color ) );
+	}
+}
+
 }//End of namespace wEngine
\ No newline at end of file
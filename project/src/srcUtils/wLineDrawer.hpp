@@ -16,6 +16,9 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 
 #include "../srcComponents/wLineStyleComponent.hpp"
 
+#include <optional>
+#include <utility>
+
 namespace wEngine
 {
 
@@ -31,12 +34,20 @@ namespace wEngine
 	 * - Support for dashed and dotted patterns using configurable dash/gap lengths.
 	 * - Dash/dot continuity across multiple connected segments using a shared pattern offset.
 	 * - Optional round joins at corners of polylines (applied only when style == Solid).
+	 * - Batched tessellation: all quads, dashes and joins are written into a single
+	 *   triangle list so a whole curve is submitted with one draw call.
+	 * - Clipping (Liang–Barsky) against a rectangle before tessellation: only the visible part
+	 *   of each segment is turned into triangles, and off-screen segments emit nothing.
 	 *
 	 * ### Usage:
 	 * - Use drawLine( ) to render a single thick segment.
 	 * - Use drawPolylineRound( ) to render a sequence of connected points with optional round joins.
+	 * - Use appendLine( ) and appendPolylineRound( ) to accumulate several segments or polylines
+	 *   sharing the same style into one `sf::VertexArray`, then draw that array once.
 	 * - To maintain consistent dash/dot alignment across segments, pass the returned
 	 *   @p patternOffset from drawLine( ) into the next segment.
+	 * - Use getClipRect( ) with appendClippedLine( ) and appendClippedPolylineRound( ) to only
+	 *   tessellate what the render target shows.
 	 *
 	 *
 	 * @warning Round joins are currently only applied for `Solid` style. For dashed or dotted
@@ -78,15 +89,16 @@ namespace wEngine
 			 * 
 			 * @return Updated pattern offset after this segment (pass to next segment for continuity).
 			 */
-			static float drawLine( sf::RenderWindow& window, const sf::Vector2f& point1, const sf::Vector2f& point2,
+			static float drawLine( sf::RenderTarget& window, const sf::Vector2f& point1, const sf::Vector2f& point2,
 				const sf::Color& color, float thickness, LineStyleComponent::LineStyle style = LineStyleComponent::LineStyle::Solid,
 				float dashLength = 20.0f, float gapLength = 5.0f, float patternOffset = 0.0f );
 
 			/**
 			 * @brief Draws a polyline (sequence of connected line segments) with optional round joins.
 			 *
-			 * - Each segment [p1, p2] is rendered using drawLine( ), with pattern continuity preserved.
+			 * - Each segment [p1, p2] is tessellated like drawLine( ), with pattern continuity preserved.
 			 * - If style == Solid and a next segment exists: a circular arc is approximated using triangles to smooth the corner at [p2].
+			 * - The whole polyline is submitted with a single draw call.
 			 *
 			 * @param window		Render target.
 			 * @param points		List of polyline points (must contain at least 2).
@@ -99,9 +111,159 @@ namespace wEngine
 			 * 
 			 * @note For Dashed or Dotted styles, round joins are skipped.
 			 */
-			static void drawPolylineRound( sf::RenderWindow& window, const std::vector<sf::Vector2f>& points, const sf::Color& color,
+			static void drawPolylineRound( sf::RenderTarget& window, const std::vector<sf::Vector2f>& points, const sf::Color& color,
 				float thickness, LineStyleComponent::LineStyle style = LineStyleComponent::LineStyle::Solid, float dashLength = 20.0f,
 				float gapLength = 5.0f, unsigned int arcResolution = 12 );
+
+			/**
+			 * @brief Tessellates a single thick line segment into a triangle batch (no draw call).
+			 *
+			 * Same geometry and pattern rules as drawLine( ), but the resulting quads are appended
+			 * to @p batch as two triangles each instead of being drawn immediately.
+			 *
+			 * @param batch			Destination vertex array (primitive type must be `sf::PrimitiveType::Triangles`).
+			 * @param point1		First endpoint of the line.
+			 * @param point2		Second endpoint of the line.
+			 * @param color			Line color.
+			 * @param thickness		Line thickness in pixels.
+			 * @param style			Line style (Solid, Dashed, Dotted).
+			 * @param dashLength	Dash length (used if style == Dashed).
+			 * @param gapLength		Gap length between dashes or dots.
+			 * @param patternOffset	Initial offset within the dash/dot pattern.
+			 *
+			 * @return Updated pattern offset after this segment (pass to next segment for continuity).
+			 */
+			static float appendLine( sf::VertexArray& batch, const sf::Vector2f& point1, const sf::Vector2f& point2,
+				const sf::Color& color, float thickness, LineStyleComponent::LineStyle style = LineStyleComponent::LineStyle::Solid,
+				float dashLength = 20.0f, float gapLength = 5.0f, float patternOffset = 0.0f );
+
+			/**
+			 * @brief Tessellates a polyline (segments and round joins) into a triangle batch (no draw call).
+			 *
+			 * Same geometry rules as drawPolylineRound( ). Several polylines sharing the same style
+			 * can be appended to one batch and submitted with a single `window.draw( batch )`.
+			 *
+			 * @param batch			Destination vertex array (primitive type must be `sf::PrimitiveType::Triangles`).
+			 * @param points		List of polyline points (must contain at least 2).
+			 * @param color			Polyline color.
+			 * @param thickness		Line thickness in pixels.
+			 * @param style			Line style (Solid, Dashed, Dotted).
+			 * @param dashLength	Dash length (used if style == Dashed).
+			 * @param gapLength		Gap length between dashes or dots.
+			 * @param arcResolution	Number of triangles used to approximate each round join (higher = smoother).
+			 */
+			static void appendPolylineRound( sf::VertexArray& batch, const std::vector< sf::Vector2f >& points, const sf::Color& color,
+				float thickness, LineStyleComponent::LineStyle style = LineStyleComponent::LineStyle::Solid, float dashLength = 20.0f,
+				float gapLength = 5.0f, unsigned int arcResolution = 12 );
+
+			/**
+			 * @brief Clips a segment against a rectangle (Liang–Barsky).
+			 *
+			 * Computed in double precision, and clipped endpoints are snapped onto the edge they cross,
+			 * so segments with far off-screen endpoints (e.g. near a pole) are still cut accurately.
+			 *
+			 * @param point1	First endpoint of the segment.
+			 * @param point2	Second endpoint of the segment.
+			 * @param clipRect	Clipping rectangle.
+			 * @return Endpoints of the visible part (in the direction point1 -> point2), or std::nullopt
+			 *         if no part of the segment is inside @p clipRect (or an endpoint is not finite).
+			 */
+			static std::optional< std::pair< sf::Vector2f, sf::Vector2f > > clipSegment( const sf::Vector2f& point1, const sf::Vector2f& point2, const sf::FloatRect& clipRect );
+
+			/**
+			 * @brief Get the area shown by a render target, in the coordinates geometry is built in.
+			 *
+			 * @param target	Render target (its current view is used).
+			 * @param margin	Distance added on every side, so that line caps and joins lying just
+			 *                  outside the target are kept (typically the line thickness).
+			 * @return Clipping rectangle for appendClippedLine( ) and appendClippedPolylineRound( ).
+			 */
+			static sf::FloatRect getClipRect( const sf::RenderTarget& target, float margin );
+
+			/**
+			 * @brief Tessellates the part of a segment inside a clipping rectangle (no draw call).
+			 *
+			 * Same geometry and pattern rules as appendLine( ). The pattern is laid out along the full
+			 * segment, so dashes and dots do not slide when the clipping rectangle moves.
+			 *
+			 * @param batch			Destination vertex array (primitive type must be `sf::PrimitiveType::Triangles`).
+			 * @param point1		First endpoint of the line.
+			 * @param point2		Second endpoint of the line.
+			 * @param clipRect		Clipping rectangle (see getClipRect( )).
+			 * @param color			Line color.
+			 * @param thickness		Line thickness in pixels.
+			 * @param style			Line style (Solid, Dashed, Dotted).
+			 * @param dashLength	Dash length (used if style == Dashed).
+			 * @param gapLength		Gap length between dashes or dots.
+			 * @param patternOffset	Initial offset within the dash/dot pattern.
+			 *
+			 * @return Pattern offset at @p point2, whether the segment was visible or not.
+			 */
+			static float appendClippedLine( sf::VertexArray& batch, const sf::Vector2f& point1, const sf::Vector2f& point2,
+				const sf::FloatRect& clipRect, const sf::Color& color, float thickness,
+				LineStyleComponent::LineStyle style = LineStyleComponent::LineStyle::Solid,
+				float dashLength = 20.0f, float gapLength = 5.0f, float patternOffset = 0.0f );
+
+			/**
+			 * @brief Tessellates the part of a polyline inside a clipping rectangle (no draw call).
+			 *
+			 * Same geometry rules as appendPolylineRound( ). Each segment is clipped with
+			 * clipSegment( ), so the polyline is split cleanly where it leaves and re-enters
+			 * @p clipRect, and round joins are only emitted at points inside it. Segments with a
+			 * non-finite endpoint are skipped.
+			 *
+			 * @param batch			Destination vertex array (primitive type must be `sf::PrimitiveType::Triangles`).
+			 * @param points		List of polyline points (must contain at least 2).
+			 * @param clipRect		Clipping rectangle (see getClipRect( )).
+			 * @param color			Polyline color.
+			 * @param thickness		Line thickness in pixels.
+			 * @param style			Line style (Solid, Dashed, Dotted).
+			 * @param dashLength	Dash length (used if style == Dashed).
+			 * @param gapLength		Gap length between dashes or dots.
+			 * @param arcResolution	Number of triangles used to approximate each round join (higher = smoother).
+			 */
+			static void appendClippedPolylineRound( sf::VertexArray& batch, const std::vector< sf::Vector2f >& points,
+				const sf::FloatRect& clipRect, const sf::Color& color, float thickness,
+				LineStyleComponent::LineStyle style = LineStyleComponent::LineStyle::Solid, float dashLength = 20.0f,
+				float gapLength = 5.0f, unsigned int arcResolution = 12 );
+
+		private:
+			/**
+			 * @brief Moves a dash/dot pattern offset along a distance.
+			 * @param patternOffset	Current offset within the pattern.
+			 * @param distance		Distance traveled along the line.
+			 * @param thickness		Line thickness in pixels (dot length).
+			 * @param style			Line style (Solid leaves the offset unchanged).
+			 * @param dashLength	Dash length (used if style == Dashed).
+			 * @param gapLength		Gap length between dashes or dots.
+			 * @return Offset after @p distance.
+			 */
+			static float advancePattern( float patternOffset, double distance, float thickness,
+				LineStyleComponent::LineStyle style, float dashLength, float gapLength );
+
+			/**
+			 * @brief Appends the two triangles of a thick segment quad.
+			 * @param batch		Destination triangle list.
+			 * @param point1	Segment start.
+			 * @param point2	Segment end.
+			 * @param offset	Half-thickness normal vector.
+			 * @param color		Vertex color.
+			 */
+			static void appendQuad( sf::VertexArray& batch, const sf::Vector2f& point1, const sf::Vector2f& point2,
+				const sf::Vector2f& offset, const sf::Color& color );
+
+			/**
+			 * @brief Appends the triangle fan approximating a round join at @p p2.
+			 * @param batch			Destination triangle list.
+			 * @param p1			Start of the incoming segment.
+			 * @param p2			Join point.
+			 * @param p3			End of the outgoing segment.
+			 * @param color			Vertex color.
+			 * @param thickness		Line thickness in pixels.
+			 * @param arcResolution	Number of triangles in the fan.
+			 */
+			static void appendRoundJoin( sf::VertexArray& batch, const sf::Vector2f& p1, const sf::Vector2f& p2, const sf::Vector2f& p3,
+				const sf::Color& color, float thickness, unsigned int arcResolution );
 	};
 
 }//End of namespace wEngine
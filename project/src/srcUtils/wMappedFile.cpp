@@ -0,0 +1,153 @@
+/**
+ * @file wMappedFile.cpp
+ * @brief Implementation of the MappedFile class.
+ */
+
+#include "wMappedFile.hpp"
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#include <stdexcept>
+
+namespace wEngine
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Constructors and destructors.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+MappedFile::MappedFile( const std::string& path )
+:	mPath{ path },
+	mData{ nullptr },
+	mSize{ 0 }
+#if defined(_WIN32)
+	, mFileHandle{ nullptr },
+	mMappingHandle{ nullptr }
+#endif
+{
+#if defined(_WIN32)
+	HANDLE file = CreateFileA( path.c_str( ), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		throw std::runtime_error( "MappedFile: unable to open " + path );
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx( file, &fileSize ))
+	{
+		CloseHandle( file );
+		throw std::runtime_error( "MappedFile: unable to read the size of " + path );
+	}
+
+	mFileHandle = file;
+	mSize = static_cast< size_t >( fileSize.QuadPart );
+
+	if (mSize == 0)
+	{
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+	if (mapping == NULL)
+	{
+		CloseHandle( file );
+		throw std::runtime_error( "MappedFile: unable to map " + path );
+	}
+
+	void* view = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+	if (view == NULL)
+	{
+		CloseHandle( mapping );
+		CloseHandle( file );
+		throw std::runtime_error( "MappedFile: unable to map " + path );
+	}
+
+	mMappingHandle = mapping;
+	mData = static_cast< const std::byte* >( view );
+#else
+	int fd = open( path.c_str( ), O_RDONLY );
+	if (fd == -1)
+	{
+		throw std::runtime_error( "MappedFile: unable to open " + path );
+	}
+
+	struct stat info;
+	if (fstat( fd, &info ) == -1)
+	{
+		close( fd );
+		throw std::runtime_error( "MappedFile: unable to read the size of " + path );
+	}
+
+	mSize = static_cast< size_t >( info.st_size );
+
+	if (mSize > 0)
+	{
+		void* view = mmap( nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+		if (view == MAP_FAILED)
+		{
+			close( fd );
+			throw std::runtime_error( "MappedFile: unable to map " + path );
+		}
+
+		mData = static_cast< const std::byte* >( view );
+	}
+
+	// The mapping stays valid once the descriptor is closed.
+	close( fd );
+#endif
+}
+
+MappedFile::~MappedFile( )
+{
+#if defined(_WIN32)
+	if (mData)
+	{
+		UnmapViewOfFile( mData );
+	}
+	if (mMappingHandle)
+	{
+		CloseHandle( mMappingHandle );
+	}
+	if (mFileHandle)
+	{
+		CloseHandle( mFileHandle );
+	}
+#else
+	if (mData)
+	{
+		munmap( const_cast< std::byte* >( mData ), mSize );
+	}
+#endif
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods: accessors and mutators.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+const std::byte* MappedFile::data( ) const
+{
+	return mData;
+}
+
+size_t MappedFile::size( ) const
+{
+	return mSize;
+}
+
+const std::string& MappedFile::getPath( ) const
+{
+	return mPath;
+}
+
+}//End of namespace wEngine
\ No newline at end of file
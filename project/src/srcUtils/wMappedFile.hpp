@@ -0,0 +1,78 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_MAPPED_FILE_HPP
+#define W_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace wEngine
+{
+
+	/**
+	 * @class MappedFile
+	 * @brief Read-only memory mapping of a whole file (RAII).
+	 *
+	 * The file content is exposed as a byte range without being read into memory: pages are
+	 * loaded by the operating system on first access and can be evicted again under memory
+	 * pressure, so only the parts actually touched contribute to the resident set size.
+	 *
+	 * Uses `mmap` on POSIX systems and `CreateFileMapping` / `MapViewOfFile` on Windows.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class MappedFile
+	{
+		public:
+			/**
+			 * @brief Maps the given file read-only.
+			 * @param path Path to the file.
+			 * @throw std::runtime_error if the file cannot be opened or mapped.
+			 */
+			explicit MappedFile( const std::string& path );
+
+			MappedFile( const MappedFile& ) = delete;
+			MappedFile& operator=( const MappedFile& ) = delete;
+
+			/**
+			 * @brief Unmaps the file.
+			 */
+			~MappedFile( );
+
+			/**
+			 * @brief Returns the first byte of the mapping.
+			 * @return Pointer to the file content (nullptr for an empty file).
+			 */
+			[[nodiscard]] const std::byte* data( ) const;
+
+			/**
+			 * @brief Returns the size of the mapping.
+			 * @return File size in bytes.
+			 */
+			[[nodiscard]] size_t size( ) const;
+
+			/**
+			 * @brief Returns the path of the mapped file.
+			 * @return File path.
+			 */
+			[[nodiscard]] const std::string& getPath( ) const;
+		private:
+			std::string mPath;
+			const std::byte* mData;
+			size_t mSize;
+#if defined(_WIN32)
+			void* mFileHandle;
+			void* mMappingHandle;
+#endif
+	};
+
+}//End of namespace wEngine
+
+#endif
\ No newline at end of file
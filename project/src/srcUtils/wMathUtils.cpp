@@ -5,6 +5,8 @@
 
 #include "wMathUtils.hpp"
 
+#include <numbers>
+
 namespace wEngine
 {
 
@@ -36,4 +38,253 @@ std::vector< double > MathUtils::linspace( double start, double end, size_t nbPo
 	return tempVector;
 }
 
+double MathUtils::niceNumber( double value, bool round )
+{
+	if (!std::isfinite( value ) || value <= 0.0)
+	{
+		throw std::invalid_argument( "MathUtils::niceNumber error: value must be a positive finite number." );
+	}
+
+	double exponent = std::floor( std::log10( value ) );
+	double power = std::pow( 10.0, exponent );
+	double fraction = value / power;
+	double niceFraction;
+
+	if (round)
+	{
+		if (fraction < 1.5)			niceFraction = 1.0;
+		else if (fraction < 3.0)	niceFraction = 2.0;
+		else if (fraction < 7.0)	niceFraction = 5.0;
+		else						niceFraction = 10.0;
+	}
+	else
+	{
+		if (fraction <= 1.0)		niceFraction = 1.0;
+		else if (fraction <= 2.0)	niceFraction = 2.0;
+		else if (fraction <= 5.0)	niceFraction = 5.0;
+		else						niceFraction = 10.0;
+	}
+
+	return niceFraction * power;
+}
+
+double MathUtils::niceTickStep( double min, double max, size_t maxTicks )
+{
+	if (!std::isfinite( min ) || !std::isfinite( max ) || min >= max)
+	{
+		throw std::invalid_argument( "MathUtils::niceTickStep error: min must be < max and both must be finite." );
+	}
+
+	if (maxTicks < 2)
+	{
+		throw std::invalid_argument( "MathUtils::niceTickStep error: maxTicks must be >= 2." );
+	}
+
+	double range = niceNumber( max - min, false );
+	double step = niceNumber( range / static_cast< double >( maxTicks - 1 ), true );
+
+	// Rounding to the nearest nice number may overshoot the budget: move up to the next nice step.
+	while (std::floor( max / step ) - std::ceil( min / step ) + 1.0 > static_cast< double >( maxTicks ))
+	{
+		step = niceNumber( step * 1.01, false );
+	}
+
+	return step;
+}
+
+void MathUtils::adaptiveSample( const std::function< double( double ) >& evaluate, double start, double end,
+	size_t initialPoints, unsigned int maxDepth, double tolerance, sf::Vector2f scale,
+	std::vector< double >& xs, std::vector< double >& ys, ThreadPool* pool )
+{
+	if (tolerance <= 0.0)
+	{
+		throw std::invalid_argument( "MathUtils::adaptiveSample error: tolerance must be > 0." );
+	}
+
+	// Coarse grid (validates start < end and initialPoints >= 2).
+	std::vector< double > grid = linspace( start, end, initialPoints );
+
+	xs.clear( );
+	ys.clear( );
+	xs.reserve( grid.size( ) * 2 );
+	ys.reserve( grid.size( ) * 2 );
+
+	const double sx = static_cast< double >( scale.x );
+	const double sy = static_cast< double >( scale.y );
+	const double tolerance2 = tolerance * tolerance;
+
+	// Refinement budget: a few samples per pixel of domain width, never more than the hard cap.
+	const double pixelWidth = (end - start) * std::fabs( sx );
+	const double budgetLimit = std::min( AdaptiveSamplesPerPixel * pixelWidth, static_cast< double >( MaxAdaptiveSamples ) );
+	const std::ptrdiff_t budget = std::isfinite( budgetLimit )
+		? std::max( static_cast< std::ptrdiff_t >( budgetLimit ), static_cast< std::ptrdiff_t >( grid.size( ) ) )
+		: static_cast< std::ptrdiff_t >( grid.size( ) );
+
+	// Each coarse interval gets a fixed share (the remainder goes to the first ones), so the samples
+	// do not depend on the order in which the intervals are refined, serially or in parallel.
+	const size_t intervals = grid.size( ) - 1;
+	const std::ptrdiff_t share = budget / static_cast< std::ptrdiff_t >( intervals );
+	const std::ptrdiff_t extra = budget % static_cast< std::ptrdiff_t >( intervals );
+	auto intervalBudget = [ & ]( size_t i )
+	{
+		return share + (static_cast< std::ptrdiff_t >( i ) < extra ? 1 : 0);
+	};
+
+	if (pool == nullptr)
+	{
+		double a = grid.front( );
+		double fa = evaluate( a );
+		xs.push_back( a );
+		ys.push_back( fa );
+
+		for (size_t i = 1; i < grid.size( ); ++i)
+		{
+			const double b = grid[ i ];
+			const double fb = evaluate( b );
+
+			std::ptrdiff_t remaining = intervalBudget( i - 1 );
+			refineInterval( evaluate, a, fa, b, fb, 0, maxDepth, sx, sy, tolerance2, remaining, xs, ys );
+
+			xs.push_back( b );
+			ys.push_back( fb );
+
+			a = b;
+			fa = fb;
+		}
+		return;
+	}
+
+	// (1) Evaluate the coarse grid in parallel.
+	std::vector< double > gridValues( grid.size( ) );
+	pool->parallelFor( grid.size( ), [ & ]( size_t first, size_t last )
+	{
+		for (size_t i = first; i < last; ++i)
+		{
+			gridValues[ i ] = evaluate( grid[ i ] );
+		}
+	});
+
+	// (2) Refine each coarse interval into its own buffer, with its own share of the budget.
+	std::vector< std::vector< double > > innerX( intervals );
+	std::vector< std::vector< double > > innerY( intervals );
+	pool->parallelFor( intervals, [ & ]( size_t first, size_t last )
+	{
+		for (size_t i = first; i < last; ++i)
+		{
+			std::ptrdiff_t remaining = intervalBudget( i );
+			refineInterval( evaluate, grid[ i ], gridValues[ i ], grid[ i + 1 ], gridValues[ i + 1 ],
+				0, maxDepth, sx, sy, tolerance2, remaining, innerX[ i ], innerY[ i ] );
+		}
+	});
+
+	// (3) Concatenate in domain order.
+	xs.push_back( grid.front( ) );
+	ys.push_back( gridValues.front( ) );
+	for (size_t i = 0; i < intervals; ++i)
+	{
+		xs.insert( xs.end( ), innerX[ i ].begin( ), innerX[ i ].end( ) );
+		ys.insert( ys.end( ), innerY[ i ].begin( ), innerY[ i ].end( ) );
+		xs.push_back( grid[ i + 1 ] );
+		ys.push_back( gridValues[ i + 1 ] );
+	}
+}
+
+void MathUtils::transformPoints( std::span< const double > xs, std::span< const double > ys,
+	sf::Vector2f scale, float angleDegrees, sf::Vector2f offset, sf::Vector2f origin,
+	std::span< float > outX, std::span< float > outY )
+{
+	if (ys.size( ) != xs.size( ) || outX.size( ) != xs.size( ) || outY.size( ) != xs.size( ))
+	{
+		throw std::invalid_argument( "MathUtils::transformPoints error: all spans must have the same size." );
+	}
+
+	const float rad = angleDegrees * static_cast< float >( std::numbers::pi ) / 180.0f;
+	const float cosA = std::cos( rad );
+	const float sinA = std::sin( rad );
+
+	// Fold scale and rotation into one 2x2 matrix, and both translations into one vector.
+	const float m00 = scale.x * cosA;
+	const float m01 = scale.y * sinA;
+	const float m10 = scale.x * sinA;
+	const float m11 = -scale.y * cosA;
+	const float tx = origin.x + offset.x * scale.x;
+	const float ty = origin.y - offset.y * scale.y;
+
+	const size_t count = xs.size( );
+	const double* x = xs.data( );
+	const double* y = ys.data( );
+	float* rx = outX.data( );
+	float* ry = outY.data( );
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float fx = static_cast< float >( x[ i ] );
+		const float fy = static_cast< float >( y[ i ] );
+		rx[ i ] = tx + m00 * fx + m01 * fy;
+		ry[ i ] = ty + m10 * fx + m11 * fy;
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void MathUtils::refineInterval( const std::function< double( double ) >& evaluate, double a, double fa, double b, double fb,
+	unsigned int depth, unsigned int maxDepth, double sx, double sy, double tolerance2,
+	std::ptrdiff_t& budget, std::vector< double >& xs, std::vector< double >& ys )
+{
+	// Nothing left to resolve below one pixel, and the budget bounds noisy or oscillating functions.
+	if (depth >= maxDepth || std::fabs( (b - a) * sx ) < 1.0)
+	{
+		return;
+	}
+
+	if (budget <= 0)
+	{
+		return;
+	}
+	--budget;
+
+	const double m = 0.5 * (a + b);
+	const double fm = evaluate( m );
+
+	const bool validA = !std::isnan( fa );
+	const bool validM = !std::isnan( fm );
+	const bool validB = !std::isnan( fb );
+
+	bool split = false;
+	if (validA && validM && validB)
+	{
+		// Screen-space distance from the midpoint sample to the chord [(a, fa), (b, fb)].
+		const double cx = (b - a) * sx;
+		const double cy = (fb - fa) * sy;
+		const double px = (m - a) * sx;
+		const double py = (fm - fa) * sy;
+
+		const double cross = cx * py - cy * px;
+		const double chord2 = cx * cx + cy * cy;
+
+		split = cross * cross > tolerance2 * chord2;
+	}
+	else
+	{
+		// Mixed validity: keep refining towards the boundary of the drawable region.
+		split = validA || validM || validB;
+	}
+
+	if (!split)
+	{
+		xs.push_back( m );
+		ys.push_back( fm );
+		return;
+	}
+
+	refineInterval( evaluate, a, fa, m, fm, depth + 1, maxDepth, sx, sy, tolerance2, budget, xs, ys );
+	xs.push_back( m );
+	ys.push_back( fm );
+	refineInterval( evaluate, m, fm, b, fb, depth + 1, maxDepth, sx, sy, tolerance2, budget, xs, ys );
+}
+
 }//End of namespace wEngine
\ No newline at end of file
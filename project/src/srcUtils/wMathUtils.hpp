@@ -8,12 +8,17 @@ Copyright @ 2025 Wilfried Koch. All rights reserved.
 #ifndef W_MATH_UTILS_HPP
 #define W_MATH_UTILS_HPP
 
+#include "wThreadPool.hpp"
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wfloat-equal"
 #include <SFML/System/Vector2.hpp>
 #pragma GCC diagnostic pop
 
 #include <cmath>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 #include <algorithm>
 #include <stdexcept>
@@ -55,6 +60,356 @@ namespace wEngine
 			 *	@endcode
 			 */
 			[[nodiscard]] static std::vector< double > linspace( double start, double end, size_t nbPoints );
+
+			/**
+			 * @brief Rounds a positive value to a "nice" number: 1, 2 or 5 times a power of ten.
+			 *
+			 * Heckbert's nice numbers ("Nice Numbers for Graph Labels", Graphics Gems, 1990).
+			 *
+			 * @param value	Value to round (must be > 0 and finite).
+			 * @param round	If true, rounds to the nearest nice number; otherwise takes the smallest nice number >= value.
+			 * @return The nice number.
+			 * @throw std::invalid_argument if value is not a positive finite number.
+			 */
+			[[nodiscard]] static double niceNumber( double value, bool round );
+
+			/**
+			 * @brief Chooses a nice tick spacing for a range, with a bounded number of ticks.
+			 *
+			 * The spacing is a nice number (see niceNumber( )) chosen so that about @p maxTicks
+			 * multiples of it fall in [min, max], and never more than @p maxTicks.
+			 *
+			 * @param min		Range start.
+			 * @param max		Range end (must be > min).
+			 * @param maxTicks	Maximum number of ticks (must be >= 2).
+			 * @return Tick spacing.
+			 * @throw std::invalid_argument if min >= max, the range is not finite, or maxTicks < 2.
+			 *
+			 *	@code
+			 *		double step = MathUtils::niceTickStep( 0.0, 97.0, 10 );
+			 *		// step = 10.0
+			 *	@endcode
+			 */
+			[[nodiscard]] static double niceTickStep( double min, double max, size_t maxTicks );
+
+			/**
+			 * @brief Samples a function adaptively, refining where the curve bends on screen.
+			 *
+			 * The domain is first split into a coarse uniform grid of @p initialPoints samples. Each
+			 * interval [a, b] is then bisected recursively while the midpoint of the curve deviates
+			 * from the chord (a, f(a)) -> (b, f(b)) by more than @p tolerance pixels, once both axes
+			 * are scaled by @p scale. Flat regions therefore stay coarse while strongly curved regions
+			 * are refined up to @p maxDepth bisections.
+			 *
+			 * Refinement also stops when an interval is narrower than one pixel along x, and after
+			 * AdaptiveSamplesPerPixel extra samples per pixel of the domain width (at most
+			 * MaxAdaptiveSamples), so oscillating or noisy functions such as `sin( 1 / x )` near 0
+			 * cannot trigger an exponential number of evaluations. The budget is split evenly between
+			 * the coarse intervals before any refinement starts, so each interval gets a fixed share.
+			 *
+			 * The evaluator reports invalid samples (excluded intervals, NaN, Inf) by returning NaN.
+			 * An interval whose samples are partly valid and partly invalid is always refined (up to
+			 * @p maxDepth), so the curve stops as close as possible to a discontinuity.
+			 *
+			 * When @p pool is given, the coarse grid is evaluated in parallel and the coarse intervals
+			 * are refined concurrently, each into its own buffer; the buffers are then concatenated in
+			 * domain order. Since every interval owns its share of the budget, the output is identical
+			 * to the serial one. @p evaluate must then be safe to call from several threads at once.
+			 *
+			 * @param evaluate		Callable returning f(x), or NaN when x must not be drawn.
+			 * @param start			Domain start.
+			 * @param end			Domain end (must be > start).
+			 * @param initialPoints	Size of the coarse uniform grid (must be >= 2).
+			 * @param maxDepth		Maximum number of bisections per coarse interval.
+			 * @param tolerance		Maximum allowed midpoint-to-chord distance, in pixels (must be > 0).
+			 * @param scale			Pixels per logical unit along x and y.
+			 * @param xs			Output: sample abscissas in increasing order (cleared first).
+			 * @param ys			Output: matching ordinates (NaN for invalid samples).
+			 * @param pool			Optional thread pool for parallel evaluation (nullptr = serial).
+			 * @throw std::runtime_error if start >= end or initialPoints < 2.
+			 * @throw std::invalid_argument if tolerance <= 0.
+			 */
+			static void adaptiveSample( const std::function< double( double ) >& evaluate, double start, double end,
+				size_t initialPoints, unsigned int maxDepth, double tolerance, sf::Vector2f scale,
+				std::vector< double >& xs, std::vector< double >& ys, ThreadPool* pool = nullptr );
+
+			/**
+			 * @brief Maps logical points to pixel space on contiguous arrays (structure of arrays).
+			 *
+			 * For each i, the point (xs[i], ys[i]) is scaled (y inverted, SFML's y-axis grows
+			 * downward), rotated around the logical origin by @p angleDegrees, then translated by
+			 * @p offset (logical units, applied after rotation) and by @p origin (pixels):
+			 *
+			 *     px = xs[i] * scale.x          py = -ys[i] * scale.y
+			 *     outX[i] = origin.x + px * cos - py * sin + offset.x * scale.x
+			 *     outY[i] = origin.y + px * sin + py * cos - offset.y * scale.y
+			 *
+			 * The loop is branch-free over plain float arrays so the compiler can vectorize it.
+			 * NaN inputs propagate to the outputs.
+			 *
+			 * @param xs			Logical abscissas.
+			 * @param ys			Logical ordinates (same size as xs).
+			 * @param scale			Pixels per logical unit along x and y.
+			 * @param angleDegrees	Rotation angle in degrees.
+			 * @param offset		Logical offset applied after rotation.
+			 * @param origin		Pixel position of the logical origin.
+			 * @param outX			Output: pixel abscissas (same size as xs).
+			 * @param outY			Output: pixel ordinates (same size as xs).
+			 * @throw std::invalid_argument if the spans differ in size.
+			 */
+			static void transformPoints( std::span< const double > xs, std::span< const double > ys,
+				sf::Vector2f scale, float angleDegrees, sf::Vector2f offset, sf::Vector2f origin,
+				std::span< float > outX, std::span< float > outY );
+
+			/**
+			 * @brief M4 decimation: keeps the first, last, min and max point of every pixel column.
+			 *
+			 * The x-extent [x(0), x(count - 1)] is split into @p columns equal buckets. Consecutive
+			 * points falling in the same bucket are reduced to at most 4 points (first, last, lowest,
+			 * highest), so the rasterized polyline is visually identical while peaks are preserved.
+			 * Points must be sorted by increasing x: the extent is read from the first and last points.
+			 *
+			 * Points with a non-finite coordinate (missing values) are always kept, each on its own,
+			 * so that the breaks they produce in the polyline survive decimation. They are ignored
+			 * when computing the extent.
+			 *
+			 * @tparam PointAt	Callable returning the point at a given index (any type with .x and .y).
+			 * @param count		Number of points.
+			 * @param pointAt	Point accessor.
+			 * @param columns	Number of pixel columns covered by the data (> 0).
+			 * @return Indices of the kept points, in increasing order.
+			 */
+			template< typename PointAt >
+			[[nodiscard]] static std::vector< size_t > decimateM4( size_t count, PointAt&& pointAt, size_t columns )
+			{
+				std::vector< size_t > indices;
+				if (count == 0 || columns == 0)
+				{
+					return indices;
+				}
+
+				auto isMissing = [ & ]( size_t index )
+				{
+					const auto point = pointAt( index );
+					return !std::isfinite( static_cast< double >( point.x ) ) || !std::isfinite( static_cast< double >( point.y ) );
+				};
+
+				// Extent between the first and last points with a finite x.
+				size_t front = 0;
+				while (front < count && !std::isfinite( static_cast< double >( pointAt( front ).x ) ))
+				{
+					++front;
+				}
+				size_t back = count;
+				while (back > front && !std::isfinite( static_cast< double >( pointAt( back - 1 ).x ) ))
+				{
+					--back;
+				}
+
+				const double xMin = front < back ? static_cast< double >( pointAt( front ).x ) : 0.0;
+				const double xMax = front < back ? static_cast< double >( pointAt( back - 1 ).x ) : 0.0;
+				const double toColumn = xMax > xMin ? static_cast< double >( columns ) / (xMax - xMin) : 0.0;
+
+				// Only called on finite x, so the clamped value is always a valid column.
+				auto columnOf = [ & ]( double x )
+				{
+					double column = std::clamp( (x - xMin) * toColumn, 0.0, static_cast< double >( columns - 1 ) );
+					return static_cast< size_t >( column );
+				};
+
+				indices.reserve( std::min( count, columns * 4 ) );
+
+				size_t i = 0;
+				while (i < count)
+				{
+					if (isMissing( i ))
+					{
+						indices.push_back( i++ );
+						continue;
+					}
+
+					const auto firstPoint = pointAt( i );
+					const size_t column = columnOf( static_cast< double >( firstPoint.x ) );
+
+					size_t first = i, last = i, lowest = i, highest = i;
+					double minY = static_cast< double >( firstPoint.y );
+					double maxY = minY;
+
+					for (++i; i < count; ++i)
+					{
+						const auto point = pointAt( i );
+						if (isMissing( i ) || columnOf( static_cast< double >( point.x ) ) != column)
+						{
+							break;
+						}
+
+						const double y = static_cast< double >( point.y );
+						if (y < minY)
+						{
+							minY = y;
+							lowest = i;
+						}
+						if (y > maxY)
+						{
+							maxY = y;
+							highest = i;
+						}
+						last = i;
+					}
+
+					// Emit the (up to) 4 representatives in index order, without duplicates.
+					size_t kept[ 4 ] = { first, lowest, highest, last };
+					std::sort( kept, kept + 4 );
+					for (size_t k = 0; k < 4; ++k)
+					{
+						if (k == 0 || kept[ k ] != kept[ k - 1 ])
+						{
+							indices.push_back( kept[ k ] );
+						}
+					}
+				}
+
+				return indices;
+			}
+
+			/**
+			 * @brief Largest-Triangle-Three-Buckets decimation.
+			 *
+			 * Keeps the first and last points, splits the others into (threshold - 2) buckets and,
+			 * in each bucket, keeps the point forming the largest triangle with the previously kept
+			 * point and the average of the next bucket. Points are expected sorted by increasing x.
+			 *
+			 * As in decimateM4( ), points with a non-finite coordinate (missing values) are always
+			 * kept so that the breaks they produce survive decimation; they are skipped in the bucket
+			 * averages and triangle areas. The result may then hold more than @p threshold points.
+			 *
+			 * @tparam PointAt	Callable returning the point at a given index (any type with .x and .y).
+			 * @param count		Number of points.
+			 * @param pointAt	Point accessor.
+			 * @param threshold	Number of points to keep (every point is kept if threshold >= count or < 3).
+			 * @return Indices of the kept points, in increasing order.
+			 */
+			template< typename PointAt >
+			[[nodiscard]] static std::vector< size_t > decimateLTTB( size_t count, PointAt&& pointAt, size_t threshold )
+			{
+				std::vector< size_t > indices;
+				if (threshold >= count || threshold < 3)
+				{
+					indices.resize( count );
+					for (size_t i = 0; i < count; ++i)
+					{
+						indices[ i ] = i;
+					}
+					return indices;
+				}
+
+				auto isMissing = [ & ]( size_t index )
+				{
+					const auto point = pointAt( index );
+					return !std::isfinite( static_cast< double >( point.x ) ) || !std::isfinite( static_cast< double >( point.y ) );
+				};
+
+				indices.reserve( threshold );
+
+				const double bucketSize = static_cast< double >( count - 2 ) / static_cast< double >( threshold - 2 );
+				auto bucketStart = [ & ]( size_t bucket )
+				{
+					return std::min( static_cast< size_t >( static_cast< double >( bucket ) * bucketSize ) + 1, count - 1 );
+				};
+
+				// Last kept finite point (the triangle anchor), if any.
+				bool hasAnchor = !isMissing( 0 );
+				size_t previous = 0;
+				indices.push_back( 0 );
+
+				for (size_t bucket = 0; bucket < threshold - 2; ++bucket)
+				{
+					// Average of the finite points of the next bucket (the last point for the last bucket).
+					const size_t nextStart = bucketStart( bucket + 1 );
+					const size_t nextEnd = std::max( bucketStart( bucket + 2 ), nextStart + 1 );
+
+					double averageX = 0.0;
+					double averageY = 0.0;
+					size_t averageCount = 0;
+					for (size_t j = nextStart; j < nextEnd; ++j)
+					{
+						if (isMissing( j ))
+						{
+							continue;
+						}
+						const auto point = pointAt( j );
+						averageX += static_cast< double >( point.x );
+						averageY += static_cast< double >( point.y );
+						++averageCount;
+					}
+
+					const size_t start = bucketStart( bucket );
+					const size_t end = std::max( nextStart, start + 1 );
+
+					// Point of the current bucket with the largest triangle area; missing points are kept as they come.
+					// Without an anchor or a finite next bucket, every area is 0 and the first finite point wins.
+					const bool hasTriangle = hasAnchor && averageCount > 0;
+					double ax = 0.0;
+					double ay = 0.0;
+					if (hasTriangle)
+					{
+						const auto anchor = pointAt( previous );
+						ax = static_cast< double >( anchor.x );
+						ay = static_cast< double >( anchor.y );
+						averageX /= static_cast< double >( averageCount );
+						averageY /= static_cast< double >( averageCount );
+					}
+
+					const size_t bucketFirst = indices.size( );
+					double maxArea = -1.0;
+					size_t chosen = count;
+					for (size_t j = start; j < end; ++j)
+					{
+						if (isMissing( j ))
+						{
+							indices.push_back( j );
+							continue;
+						}
+
+						const auto point = pointAt( j );
+						const double area = hasTriangle
+							? std::fabs( (ax - averageX) * (static_cast< double >( point.y ) - ay)
+								- (ax - static_cast< double >( point.x )) * (averageY - ay) )
+							: 0.0;
+						if (area > maxArea)
+						{
+							maxArea = area;
+							chosen = j;
+						}
+					}
+
+					if (chosen < count)
+					{
+						// Insert the chosen point among the missing ones of this bucket, in index order.
+						auto position = std::lower_bound( indices.begin( ) + static_cast< std::ptrdiff_t >( bucketFirst ), indices.end( ), chosen );
+						indices.insert( position, chosen );
+						previous = chosen;
+						hasAnchor = true;
+					}
+				}
+
+				indices.push_back( count - 1 );
+
+				return indices;
+			}
+			static constexpr double AdaptiveSamplesPerPixel = 4.0;		// refinement budget per pixel of domain width
+			static constexpr std::ptrdiff_t MaxAdaptiveSamples = 1 << 20;	// hard cap on refinement samples per call
+
+		private:
+			/**
+			 * @brief Internal: recursively bisects [a, b] and appends every sample strictly inside it, in order.
+			 *
+			 * Stops at @p maxDepth, below one pixel along x, or once @p budget (remaining refinement
+			 * samples of this coarse interval) is spent.
+			 */
+			static void refineInterval( const std::function< double( double ) >& evaluate, double a, double fa, double b, double fb,
+				unsigned int depth, unsigned int maxDepth, double sx, double sy, double tolerance2,
+				std::ptrdiff_t& budget, std::vector< double >& xs, std::vector< double >& ys );
 	};
 
 }//End of namespace wEngine
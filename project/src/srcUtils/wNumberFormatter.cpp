@@ -0,0 +1,195 @@
+/**
+ * @file wNumberFormatter.cpp
+ * @brief Implementation of the NumberFormatter class.
+ */
+
+#include "wNumberFormatter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace wEngine
+{
+
+namespace
+{
+	// SI prefixes from yocto (1e-24) to yotta (1e24), one per power of 1000.
+	constexpr std::array< std::string_view, 17 > SIPrefixes = {
+		"y", "z", "a", "f", "p", "n", "\xC2\xB5", "m", "", "k", "M", "G", "T", "P", "E", "Z", "Y"
+	};
+
+	constexpr int MaxDecimalPlaces = 17;
+
+	// Appends a string to the buffer, truncating if it does not fit.
+	char* appendText( char* first, char* last, std::string_view text )
+	{
+		size_t count = std::min( text.size( ), static_cast< size_t >( last - first ) );
+		std::memcpy( first, text.data( ), count );
+		return first + count;
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Constructors and destructors.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+NumberFormatter::NumberFormatter( Notation notation )
+:	mNotation{ notation },
+	mCache{ },
+	mHits{ 0 },
+	mMisses{ 0 }
+{
+
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods: accessors and mutators.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+NumberFormatter::Notation NumberFormatter::getNotation( ) const
+{
+	return mNotation;
+}
+
+void NumberFormatter::setNotation( Notation notation )
+{
+	if (notation != mNotation)
+	{
+		mNotation = notation;
+		clearCache( );
+	}
+}
+
+size_t NumberFormatter::getCacheHits( ) const
+{
+	return mHits;
+}
+
+size_t NumberFormatter::getCacheMisses( ) const
+{
+	return mMisses;
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+std::string_view NumberFormatter::format( double value, int decimalPlaces )
+{
+	decimalPlaces = std::clamp( decimalPlaces, 0, MaxDecimalPlaces );
+
+	// Direct-mapped slot: mix the bits of the key so that neighbouring ticks spread over the cache.
+	std::uint64_t bits = std::bit_cast< std::uint64_t >( value );
+	std::uint64_t hash = bits ^ (static_cast< std::uint64_t >( decimalPlaces ) * 0x9E3779B97F4A7C15ull);
+	hash ^= hash >> 31;
+	hash *= 0xBF58476D1CE4E5B9ull;
+	hash ^= hash >> 29;
+
+	Entry& entry = mCache[ hash % CacheSize ];
+	if (entry.mDecimalPlaces == decimalPlaces && entry.mValueBits == bits)
+	{
+		++mHits;
+		return std::string_view( entry.mText.data( ), entry.mLength );
+	}
+
+	++mMisses;
+	std::string_view text = format( value, decimalPlaces, mNotation, entry.mText );
+	entry.mValueBits = bits;
+	entry.mDecimalPlaces = decimalPlaces;
+	entry.mLength = text.size( );
+	return text;
+}
+
+void NumberFormatter::clearCache( )
+{
+	for (auto& entry : mCache)
+	{
+		entry.mDecimalPlaces = -1;
+	}
+	mHits = 0;
+	mMisses = 0;
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+std::string_view NumberFormatter::format( double value, int decimalPlaces, Notation notation, Buffer& buffer )
+{
+	decimalPlaces = std::clamp( decimalPlaces, 0, MaxDecimalPlaces );
+
+	char* first = buffer.data( );
+	char* last = buffer.data( ) + buffer.size( );
+
+	if (std::isfinite( value ) && (notation == Notation::Engineering || notation == Notation::SI))
+	{
+		return formatEngineering( value, decimalPlaces, notation == Notation::SI, buffer );
+	}
+
+	std::chars_format style = (notation == Notation::Scientific) ? std::chars_format::scientific : std::chars_format::fixed;
+	auto result = std::to_chars( first, last, value, style, decimalPlaces );
+
+	// Very large values do not fit in fixed notation: fall back to scientific notation.
+	if (result.ec != std::errc( ))
+	{
+		result = std::to_chars( first, last, value, std::chars_format::scientific, decimalPlaces );
+	}
+
+	return std::string_view( first, static_cast< size_t >( result.ptr - first ) );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+std::string_view NumberFormatter::formatEngineering( double value, int decimalPlaces, bool withPrefix, Buffer& buffer )
+{
+	char* first = buffer.data( );
+	char* last = buffer.data( ) + buffer.size( );
+
+	int exponent = 0;
+	double mantissa = value;
+
+	if (std::fabs( value ) > 0.0)
+	{
+		exponent = static_cast< int >( std::floor( std::floor( std::log10( std::fabs( value ) ) ) / 3.0 ) ) * 3;
+		mantissa = value / std::pow( 10.0, exponent );
+
+		// Rounding to the requested digits can carry the mantissa up to 1000 (e.g. 999.96 with one decimal).
+		double rounding = std::pow( 10.0, decimalPlaces );
+		if (std::fabs( std::round( mantissa * rounding ) / rounding ) >= 1000.0)
+		{
+			exponent += 3;
+			mantissa /= 1000.0;
+		}
+	}
+
+	char* cursor = std::to_chars( first, last, mantissa, std::chars_format::fixed, decimalPlaces ).ptr;
+
+	if (withPrefix && exponent >= -24 && exponent <= 24)
+	{
+		cursor = appendText( cursor, last, SIPrefixes[ static_cast< size_t >( (exponent + 24) / 3 ) ] );
+	}
+	else if (exponent != 0)
+	{
+		cursor = appendText( cursor, last, "e" );
+		cursor = std::to_chars( cursor, last, exponent ).ptr;
+	}
+
+	return std::string_view( first, static_cast< size_t >( cursor - first ) );
+}
+
+} // namespace wEngine
\ No newline at end of file
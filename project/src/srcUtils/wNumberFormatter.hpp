@@ -0,0 +1,140 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_NUMBER_FORMATTER_HPP
+#define W_NUMBER_FORMATTER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace wEngine
+{
+
+	/**
+	 * @class NumberFormatter
+	 * @brief Allocation-free formatting of numeric labels, with a small cache of recent results.
+	 *
+	 * Numbers are written with `std::to_chars` into fixed-size buffers: no stream, no locale
+	 * and no heap allocation. Four notations are available:
+	 * - `Fixed`: `1234.5` (same output as `std::fixed` with `std::setprecision`).
+	 * - `Scientific`: `1.2e+03` (same output as `std::scientific`).
+	 * - `Engineering`: mantissa in [1, 1000) and an exponent multiple of 3, e.g. `1.2e3`.
+	 * - `SI`: engineering notation with an SI prefix instead of the exponent, e.g. `1.2k`, `4.7µ`
+	 *   (UTF-8). Values beyond the yocto/yotta range fall back to engineering notation.
+	 *
+	 * A formatter instance keeps a direct-mapped cache keyed by (value, decimal places), so that
+	 * an axis relabelling the same ticks does not format them again. The cache lives inside
+	 * the object and never allocates.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 *
+	 */
+	class NumberFormatter
+	{
+		public:
+			/**
+			 * @enum Notation
+			 * @brief Output notation of the formatted numbers.
+			 */
+			enum class Notation
+			{
+				Fixed,
+				Scientific,
+				Engineering,
+				SI
+			};
+
+			static constexpr size_t BufferSize = 64;
+			using Buffer = std::array< char, BufferSize >;
+
+			/**
+			 * @brief Constructs a formatter with an empty cache.
+			 * @param notation Output notation (Fixed by default).
+			 */
+			explicit NumberFormatter( Notation notation = Notation::Fixed );
+
+			/**
+			 * @brief Get the output notation.
+			 * @return Fixed, Scientific, Engineering or SI.
+			 */
+			[[nodiscard]] Notation getNotation( ) const;
+
+			/**
+			 * @brief Sets the output notation (clears the cache).
+			 * @param notation New notation.
+			 */
+			void setNotation( Notation notation );
+
+			/**
+			 * @brief Formats a value, reusing the cached text when available.
+			 *
+			 * @param value			Value to format.
+			 * @param decimalPlaces	Digits after the decimal point (clamped to [0, 17]).
+			 * @return View on the cached text, valid until the next call to format( ) or clearCache( ).
+			 */
+			std::string_view format( double value, int decimalPlaces );
+
+			/**
+			 * @brief Empties the cache.
+			 */
+			void clearCache( );
+
+			/**
+			 * @brief Get the number of format( ) calls answered from the cache.
+			 * @return Cache hits since construction or the last clearCache( ).
+			 */
+			[[nodiscard]] size_t getCacheHits( ) const;
+
+			/**
+			 * @brief Get the number of format( ) calls that had to format the value.
+			 * @return Cache misses since construction or the last clearCache( ).
+			 */
+			[[nodiscard]] size_t getCacheMisses( ) const;
+
+			/**
+			 * @brief Formats a value into a caller-provided buffer (no cache).
+			 *
+			 * @param value			Value to format.
+			 * @param decimalPlaces	Digits after the decimal point (clamped to [0, 17]).
+			 * @param notation		Output notation.
+			 * @param buffer		Destination buffer.
+			 * @return View on the text written into @p buffer.
+			 */
+			static std::string_view format( double value, int decimalPlaces, Notation notation, Buffer& buffer );
+
+		private:
+			/**
+			 * @struct Entry
+			 * @brief One slot of the direct-mapped cache.
+			 */
+			struct Entry
+			{
+				std::uint64_t mValueBits = 0;		// bit pattern of the value (exact key, no float comparison)
+				int mDecimalPlaces = -1;			// -1 marks an empty slot
+				size_t mLength = 0;
+				Buffer mText{ };
+			};
+
+			static constexpr size_t CacheSize = 128;
+
+			Notation mNotation;
+			std::array< Entry, CacheSize > mCache;
+			size_t mHits;
+			size_t mMisses;
+
+			/**
+			 * @brief Internal: writes the engineering or SI form of a finite value.
+			 */
+			static std::string_view formatEngineering( double value, int decimalPlaces, bool withPrefix, Buffer& buffer );
+	};
+
+} // namespace wEngine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,409 @@
+/**
+ * @file wPngEncoder.cpp
+ * @brief Implementation of the PngEncoder class.
+ */
+
+#include "wPngEncoder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+namespace wEngine
+{
+
+namespace
+{
+	/**
+	 * @brief LSB-first bit packer for deflate streams.
+	 */
+	class BitWriter
+	{
+		public:
+			explicit BitWriter( std::vector< std::uint8_t >& out ) : mOut{ out }, mBuffer{ 0 }, mCount{ 0 } { }
+
+			void write( std::uint32_t bits, int count )
+			{
+				mBuffer |= bits << mCount;
+				mCount += count;
+				while (mCount >= 8)
+				{
+					mOut.push_back( static_cast< std::uint8_t >( mBuffer & 0xFFu ) );
+					mBuffer >>= 8;
+					mCount -= 8;
+				}
+			}
+
+			// Huffman codes are defined MSB-first: reverse them before packing.
+			void writeCode( std::uint32_t code, int length )
+			{
+				std::uint32_t reversed = 0;
+				for (int i = 0; i < length; ++i)
+				{
+					reversed = (reversed << 1) | ((code >> i) & 1u);
+				}
+				write( reversed, length );
+			}
+
+			void alignToByte( )
+			{
+				if (mCount > 0)
+				{
+					write( 0, 8 - mCount );
+				}
+			}
+
+		private:
+			std::vector< std::uint8_t >& mOut;
+			std::uint32_t mBuffer;
+			int mCount;
+	};
+
+	constexpr std::array< std::uint16_t, 29 > LengthBase = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	constexpr std::array< std::uint8_t, 29 > LengthExtra = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	constexpr std::array< std::uint16_t, 30 > DistanceBase = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	constexpr std::array< std::uint8_t, 30 > DistanceExtra = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	/**
+	 * @brief Writes a literal/length symbol with the fixed Huffman code (RFC 1951, 3.2.6).
+	 */
+	void writeFixedSymbol( BitWriter& writer, std::uint32_t symbol )
+	{
+		if (symbol < 144)		writer.writeCode( 0x30u + symbol, 8 );
+		else if (symbol < 256)	writer.writeCode( 0x190u + (symbol - 144u), 9 );
+		else if (symbol < 280)	writer.writeCode( symbol - 256u, 7 );
+		else					writer.writeCode( 0xC0u + (symbol - 280u), 8 );
+	}
+
+	void writeMatch( BitWriter& writer, size_t length, size_t distance )
+	{
+		size_t code = LengthBase.size( ) - 1;
+		while (LengthBase[ code ] > length)
+		{
+			--code;
+		}
+		writeFixedSymbol( writer, static_cast< std::uint32_t >( 257 + code ) );
+		writer.write( static_cast< std::uint32_t >( length - LengthBase[ code ] ), LengthExtra[ code ] );
+
+		code = DistanceBase.size( ) - 1;
+		while (DistanceBase[ code ] > distance)
+		{
+			--code;
+		}
+		writer.writeCode( static_cast< std::uint32_t >( code ), 5 );
+		writer.write( static_cast< std::uint32_t >( distance - DistanceBase[ code ] ), DistanceExtra[ code ] );
+	}
+
+	std::uint8_t paethPredictor( int a, int b, int c )
+	{
+		int p = a + b - c;
+		int pa = std::abs( p - a );
+		int pb = std::abs( p - b );
+		int pc = std::abs( p - c );
+		if (pa <= pb && pa <= pc)
+		{
+			return static_cast< std::uint8_t >( a );
+		}
+		return static_cast< std::uint8_t >( pb <= pc ? b : c );
+	}
+
+	void writeUint32BE( std::vector< std::uint8_t >& out, std::uint32_t value )
+	{
+		out.push_back( static_cast< std::uint8_t >( value >> 24 ) );
+		out.push_back( static_cast< std::uint8_t >( value >> 16 ) );
+		out.push_back( static_cast< std::uint8_t >( value >> 8 ) );
+		out.push_back( static_cast< std::uint8_t >( value ) );
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+std::vector< std::uint8_t > PngEncoder::encode( const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, const PngOptions& options )
+{
+	if (!rgba || width == 0 || height == 0)
+	{
+		throw std::invalid_argument( "PngEncoder::encode( ): empty image." );
+	}
+	if (options.compressionLevel < 0 || options.compressionLevel > 9)
+	{
+		throw std::invalid_argument( "PngEncoder::encode( ): compression level must be in [0, 9]." );
+	}
+
+	std::vector< std::uint8_t > idat = compress( filterRows( rgba, width, height, options.filter ), options.compressionLevel );
+
+	std::vector< std::uint8_t > png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	png.reserve( idat.size( ) + 64 );
+
+	auto writeChunk = [ &png ]( const char* type, const std::vector< std::uint8_t >& data )
+	{
+		writeUint32BE( png, static_cast< std::uint32_t >( data.size( ) ) );
+		size_t typeStart = png.size( );
+		png.insert( png.end( ), type, type + 4 );
+		png.insert( png.end( ), data.begin( ), data.end( ) );
+		writeUint32BE( png, crc32( png.data( ) + typeStart, png.size( ) - typeStart, 0 ) );
+	};
+
+	std::vector< std::uint8_t > ihdr;
+	writeUint32BE( ihdr, width );
+	writeUint32BE( ihdr, height );
+	ihdr.insert( ihdr.end( ), { 8, 6, 0, 0, 0 } );	// 8-bit depth, RGBA, deflate, adaptive filtering, no interlace
+
+	writeChunk( "IHDR", ihdr );
+	writeChunk( "IDAT", idat );
+	writeChunk( "IEND", { } );
+
+	return png;
+}
+
+void PngEncoder::saveToFile( const std::string& path, const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, const PngOptions& options )
+{
+	std::vector< std::uint8_t > png = encode( rgba, width, height, options );
+
+	std::ofstream file( path, std::ios::binary );
+	if (!file || !file.write( reinterpret_cast< const char* >( png.data( ) ), static_cast< std::streamsize >( png.size( ) ) ))
+	{
+		throw std::runtime_error( "PngEncoder: unable to write " + path );
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+std::vector< std::uint8_t > PngEncoder::filterRows( const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, PngFilter filter )
+{
+	constexpr size_t bpp = 4;
+	const size_t rowSize = static_cast< size_t >( width ) * bpp;
+
+	std::vector< std::uint8_t > out( (rowSize + 1) * height );
+	std::vector< std::uint8_t > zeroRow( rowSize, 0 );
+
+	// Filter type t of row 'row' written to 'dst' (PNG specification, 9.2)
+	auto apply = [ & ]( int type, const std::uint8_t* row, const std::uint8_t* prior, std::uint8_t* dst )
+	{
+		for (size_t i = 0; i < rowSize; ++i)
+		{
+			int a = i >= bpp ? row[ i - bpp ] : 0;
+			int b = prior[ i ];
+			int c = i >= bpp ? prior[ i - bpp ] : 0;
+			int predicted = 0;
+			switch (type)
+			{
+				case 1: predicted = a; break;
+				case 2: predicted = b; break;
+				case 3: predicted = (a + b) / 2; break;
+				case 4: predicted = paethPredictor( a, b, c ); break;
+				default: break;
+			}
+			dst[ i ] = static_cast< std::uint8_t >( row[ i ] - predicted );
+		}
+	};
+
+	std::vector< std::uint8_t > candidate( rowSize );
+	for (std::uint32_t y = 0; y < height; ++y)
+	{
+		const std::uint8_t* row = rgba + y * rowSize;
+		const std::uint8_t* prior = y > 0 ? row - rowSize : zeroRow.data( );
+		std::uint8_t* dst = out.data( ) + y * (rowSize + 1);
+
+		int type = static_cast< int >( filter );
+		if (filter == PngFilter::Adaptive)
+		{
+			// Minimum sum of absolute differences heuristic (residuals read as signed bytes)
+			long bestScore = -1;
+			for (int t = 0; t <= 4; ++t)
+			{
+				apply( t, row, prior, candidate.data( ) );
+				long score = 0;
+				for (std::uint8_t value : candidate)
+				{
+					score += value < 128 ? value : 256 - value;
+				}
+				if (bestScore < 0 || score < bestScore)
+				{
+					bestScore = score;
+					type = t;
+				}
+			}
+		}
+
+		dst[ 0 ] = static_cast< std::uint8_t >( type );
+		apply( type, row, prior, dst + 1 );
+	}
+
+	return out;
+}
+
+std::vector< std::uint8_t > PngEncoder::compress( const std::vector< std::uint8_t >& data, int level )
+{
+	std::vector< std::uint8_t > out;
+	out.reserve( data.size( ) / 2 + 64 );
+
+	// zlib header: deflate, 32K window, FLEVEL hint matching the level (FCHECK makes it a multiple of 31)
+	out.push_back( 0x78 );
+	out.push_back( level <= 1 ? 0x01 : level <= 5 ? 0x5E : level == 6 ? 0x9C : 0xDA );
+
+	BitWriter writer( out );
+
+	if (level == 0)
+	{
+		// Stored blocks of at most 65535 bytes
+		size_t position = 0;
+		do
+		{
+			size_t length = std::min< size_t >( data.size( ) - position, 65535 );
+			bool last = position + length == data.size( );
+			writer.write( last ? 1u : 0u, 3 );
+			writer.alignToByte( );
+			writer.write( static_cast< std::uint32_t >( length ), 16 );
+			writer.write( static_cast< std::uint32_t >( ~length & 0xFFFFu ), 16 );
+			out.insert( out.end( ), data.begin( ) + static_cast< std::ptrdiff_t >( position ),
+				data.begin( ) + static_cast< std::ptrdiff_t >( position + length ) );
+			position += length;
+		}
+		while (position < data.size( ));
+	}
+	else
+	{
+		// Single fixed-Huffman block, greedy LZ77 over hash chains
+		constexpr size_t WindowSize = 32768;
+		constexpr size_t HashSize = 1 << 15;
+		constexpr size_t MinMatch = 3;
+		constexpr size_t MaxMatch = 258;
+		const size_t maxChain = size_t{ 1 } << (level + 1);
+		const size_t niceLength = level >= 8 ? MaxMatch : static_cast< size_t >( 8 * level + 8 );
+
+		std::vector< std::int64_t > head( HashSize, -1 );
+		std::vector< std::int64_t > previous( WindowSize, -1 );
+		auto hashAt = [ &data ]( size_t i )
+		{
+			std::uint32_t key = static_cast< std::uint32_t >( data[ i ] ) | (static_cast< std::uint32_t >( data[ i+1 ] ) << 8) | (static_cast< std::uint32_t >( data[ i+2 ] ) << 16);
+			return static_cast< size_t >( (key * 2654435761u) >> 17 ) & (HashSize - 1);
+		};
+		auto insert = [ & ]( size_t i )
+		{
+			size_t hash = hashAt( i );
+			previous[ i & (WindowSize - 1) ] = head[ hash ];
+			head[ hash ] = static_cast< std::int64_t >( i );
+		};
+
+		writer.write( 1, 1 );	// BFINAL
+		writer.write( 1, 2 );	// BTYPE = fixed Huffman
+
+		size_t i = 0;
+		while (i < data.size( ))
+		{
+			size_t bestLength = 0;
+			size_t bestDistance = 0;
+
+			if (i + MinMatch <= data.size( ))
+			{
+				const size_t limit = std::min( MaxMatch, data.size( ) - i );
+				std::int64_t candidate = head[ hashAt( i ) ];
+				for (size_t chain = 0; candidate >= 0 && chain < maxChain; ++chain)
+				{
+					size_t distance = i - static_cast< size_t >( candidate );
+					if (distance > WindowSize - 1)
+					{
+						break;
+					}
+
+					size_t length = 0;
+					const std::uint8_t* a = data.data( ) + candidate;
+					const std::uint8_t* b = data.data( ) + i;
+					while (length < limit && a[ length ] == b[ length ])
+					{
+						++length;
+					}
+
+					if (length > bestLength)
+					{
+						bestLength = length;
+						bestDistance = distance;
+						if (length >= niceLength)
+						{
+							break;
+						}
+					}
+					candidate = previous[ static_cast< size_t >( candidate ) & (WindowSize - 1) ];
+				}
+			}
+
+			if (bestLength >= MinMatch)
+			{
+				writeMatch( writer, bestLength, bestDistance );
+				for (size_t k = 0; k < bestLength; ++k, ++i)
+				{
+					if (i + MinMatch <= data.size( ))
+					{
+						insert( i );
+					}
+				}
+			}
+			else
+			{
+				writeFixedSymbol( writer, data[ i ] );
+				if (i + MinMatch <= data.size( ))
+				{
+					insert( i );
+				}
+				++i;
+			}
+		}
+
+		writeFixedSymbol( writer, 256 );	// end of block
+		writer.alignToByte( );
+	}
+
+	// Adler-32 of the uncompressed data, big-endian
+	std::uint32_t s1 = 1, s2 = 0;
+	for (size_t position = 0; position < data.size( ); )
+	{
+		size_t end = std::min( position + 5552, data.size( ) );
+		for (; position < end; ++position)
+		{
+			s1 += data[ position ];
+			s2 += s1;
+		}
+		s1 %= 65521;
+		s2 %= 65521;
+	}
+	writeUint32BE( out, (s2 << 16) | s1 );
+
+	return out;
+}
+
+std::uint32_t PngEncoder::crc32( const std::uint8_t* data, size_t size, std::uint32_t crc )
+{
+	static const std::array< std::uint32_t, 256 > table = [ ]( )
+	{
+		std::array< std::uint32_t, 256 > values{ };
+		for (std::uint32_t n = 0; n < 256; ++n)
+		{
+			std::uint32_t c = n;
+			for (int k = 0; k < 8; ++k)
+			{
+				c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			}
+			values[ n ] = c;
+		}
+		return values;
+	}( );
+
+	crc = ~crc;
+	for (size_t i = 0; i < size; ++i)
+	{
+		crc = table[ (crc ^ data[ i ]) & 0xFFu ] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+}//End of namespace wEngine
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_PNG_ENCODER_HPP
+#define W_PNG_ENCODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace wEngine
+{
+
+	/**
+	 * @enum PngFilter
+	 * @brief Row filter applied before compression (PNG specification, section 9).
+	 *
+	 * `Adaptive` picks, for every row, the filter with the smallest sum of absolute residuals:
+	 * the smallest files for a slightly higher cost. `None` is the fastest.
+	 */
+	enum class PngFilter
+	{
+		None,
+		Sub,
+		Up,
+		Average,
+		Paeth,
+		Adaptive
+	};
+
+	/**
+	 * @struct PngOptions
+	 * @brief Size/speed trade-off of PngEncoder.
+	 */
+	struct PngOptions
+	{
+		int compressionLevel = 6;				///< 0 (stored, fastest) to 9 (smallest).
+		PngFilter filter = PngFilter::Adaptive;	///< Row filter strategy.
+	};
+
+	/**
+	 * @class PngEncoder
+	 * @brief Self-contained, thread-safe RGBA8 PNG encoder.
+	 *
+	 * Rows are filtered according to PngOptions::filter, then compressed into a zlib stream:
+	 * stored blocks at level 0, otherwise LZ77 (hash chains whose depth grows with the level)
+	 * with the fixed Huffman codes of the deflate specification (RFC 1951).
+	 *
+	 * All methods are static and keep no shared state, so several images can be encoded
+	 * concurrently (see GraphicsEntity::saveToFileAsync( )).
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class PngEncoder
+	{
+		public:
+			/**
+			 * @brief Encodes an RGBA8 image into PNG bytes.
+			 * @param rgba		Pixels, row-major, 4 bytes per pixel (width * height * 4 bytes).
+			 * @param width		Image width in pixels (> 0).
+			 * @param height	Image height in pixels (> 0).
+			 * @param options	Compression level and filter strategy.
+			 * @return Complete PNG file contents.
+			 * @throws std::invalid_argument if the image is empty or the level is outside [0, 9].
+			 */
+			[[nodiscard]] static std::vector< std::uint8_t > encode( const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, const PngOptions& options = { } );
+
+			/**
+			 * @brief Encodes an RGBA8 image and writes it to a file.
+			 * @param path		Output file path.
+			 * @param rgba		Pixels, row-major, 4 bytes per pixel.
+			 * @param width		Image width in pixels (> 0).
+			 * @param height	Image height in pixels (> 0).
+			 * @param options	Compression level and filter strategy.
+			 * @throws std::invalid_argument on invalid arguments (see encode( )).
+			 * @throws std::runtime_error if the file cannot be written.
+			 */
+			static void saveToFile( const std::string& path, const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, const PngOptions& options = { } );
+
+		private:
+			/**
+			 * @brief Internal: prefixes every row with its filter type byte and filters it.
+			 */
+			[[nodiscard]] static std::vector< std::uint8_t > filterRows( const std::uint8_t* rgba, std::uint32_t width, std::uint32_t height, PngFilter filter );
+
+			/**
+			 * @brief Internal: wraps @p data into a zlib stream (RFC 1950) compressed at @p level.
+			 */
+			[[nodiscard]] static std::vector< std::uint8_t > compress( const std::vector< std::uint8_t >& data, int level );
+
+			/**
+			 * @brief Internal: CRC-32 of a PNG chunk (type + data).
+			 */
+			[[nodiscard]] static std::uint32_t crc32( const std::uint8_t* data, size_t size, std::uint32_t crc );
+	};
+
+}//End of namespace wEngine
+
+#endif
\ No newline at end of file
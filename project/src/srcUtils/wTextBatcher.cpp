@@ -0,0 +1,199 @@
+/**
+ * @file wTextBatcher.cpp
+ * @brief Implementation of the TextBatcher class.
+ */
+
+#include "wTextBatcher.hpp"
+
+#include <algorithm>
+
+namespace wEngine
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+sf::FloatRect TextBatcher::measure( const sf::Font& font, unsigned int characterSize, const sf::String& text )
+{
+	return layout( font, characterSize, text, sf::Vector2f( 0.0f, 0.0f ), sf::Color::White, nullptr );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+sf::FloatRect TextBatcher::append( const sf::Font& font, unsigned int characterSize, const sf::String& text, sf::Vector2f position, sf::Color color )
+{
+	Batch& batch = batchFor( font, characterSize );
+	sf::FloatRect bounds = layout( font, characterSize, text, position, color, &batch.mVertices );
+	bounds.position += position;
+	return bounds;
+}
+
+void TextBatcher::clear( )
+{
+	for (auto& batch : mBatches)
+	{
+		batch.mVertices.clear( );
+	}
+}
+
+void TextBatcher::draw( sf::RenderTarget& window ) const
+{
+	for (const auto& batch : mBatches)
+	{
+		if (batch.mVertices.empty( ))
+		{
+			continue;
+		}
+
+		// The atlas is fetched at draw time: loading new glyphs may have resized it since the layout.
+		sf::RenderStates states;
+		states.texture = &batch.mFont->getTexture( batch.mCharacterSize );
+		window.draw( batch.mVertices.data( ), batch.mVertices.size( ), sf::PrimitiveType::Triangles, states );
+	}
+}
+
+size_t TextBatcher::getVertexCount( ) const
+{
+	size_t count = 0;
+	for (const auto& batch : mBatches)
+	{
+		count += batch.mVertices.size( );
+	}
+	return count;
+}
+
+size_t TextBatcher::getDrawCallCount( ) const
+{
+	return static_cast< size_t >( std::count_if( mBatches.begin( ), mBatches.end( ),
+		[]( const Batch& batch ) { return !batch.mVertices.empty( ); } ) );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private static methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+sf::FloatRect TextBatcher::layout( const sf::Font& font, unsigned int characterSize, const sf::String& text,
+	sf::Vector2f position, sf::Color color, std::vector< sf::Vertex >* vertices )
+{
+	if (text.isEmpty( ))
+	{
+		return sf::FloatRect( );
+	}
+
+	const float whitespaceWidth = font.getGlyph( U' ', characterSize, false ).advance;
+	const float lineSpacing = font.getLineSpacing( characterSize );
+
+	// Same pen conventions as sf::Text: the first baseline sits one character size below the position.
+	float x = 0.0f;
+	float y = static_cast< float >( characterSize );
+
+	float minX = static_cast< float >( characterSize );
+	float minY = static_cast< float >( characterSize );
+	float maxX = 0.0f;
+	float maxY = 0.0f;
+
+	char32_t previous = 0;
+	for (char32_t current : text)
+	{
+		if (current == U'\r')
+		{
+			continue;
+		}
+
+		x += font.getKerning( previous, current, characterSize, false );
+		previous = current;
+
+		if (current == U' ' || current == U'\t' || current == U'\n')
+		{
+			minX = std::min( minX, x );
+			minY = std::min( minY, y );
+
+			if (current == U' ')
+			{
+				x += whitespaceWidth;
+			}
+			else if (current == U'\t')
+			{
+				x += whitespaceWidth * 4.0f;
+			}
+			else
+			{
+				y += lineSpacing;
+				x = 0.0f;
+			}
+
+			maxX = std::max( maxX, x );
+			maxY = std::max( maxY, y );
+			continue;
+		}
+
+		const sf::Glyph& glyph = font.getGlyph( current, characterSize, false );
+
+		const float left = glyph.bounds.position.x;
+		const float top = glyph.bounds.position.y;
+		const float right = left + glyph.bounds.size.x;
+		const float bottom = top + glyph.bounds.size.y;
+
+		if (vertices)
+		{
+			// One pixel of padding around each glyph, as sf::Text does, so smoothing does not clip the edges.
+			const float padding = 1.0f;
+
+			const float u1 = static_cast< float >( glyph.textureRect.position.x ) - padding;
+			const float v1 = static_cast< float >( glyph.textureRect.position.y ) - padding;
+			const float u2 = static_cast< float >( glyph.textureRect.position.x + glyph.textureRect.size.x ) + padding;
+			const float v2 = static_cast< float >( glyph.textureRect.position.y + glyph.textureRect.size.y ) + padding;
+
+			const sf::Vector2f pen = position + sf::Vector2f( x, y );
+			const sf::Vector2f topLeft = pen + sf::Vector2f( left - padding, top - padding );
+			const sf::Vector2f bottomRight = pen + sf::Vector2f( right + padding, bottom + padding );
+
+			vertices->push_back( { topLeft, color, { u1, v1 } } );
+			vertices->push_back( { { bottomRight.x, topLeft.y }, color, { u2, v1 } } );
+			vertices->push_back( { { topLeft.x, bottomRight.y }, color, { u1, v2 } } );
+			vertices->push_back( { { topLeft.x, bottomRight.y }, color, { u1, v2 } } );
+			vertices->push_back( { { bottomRight.x, topLeft.y }, color, { u2, v1 } } );
+			vertices->push_back( { bottomRight, color, { u2, v2 } } );
+		}
+
+		minX = std::min( minX, x + left );
+		maxX = std::max( maxX, x + right );
+		minY = std::min( minY, y + top );
+		maxY = std::max( maxY, y + bottom );
+
+		x += glyph.advance;
+	}
+
+	return sf::FloatRect( { minX, minY }, { maxX - minX, maxY - minY } );
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+TextBatcher::Batch& TextBatcher::batchFor( const sf::Font& font, unsigned int characterSize )
+{
+	for (auto& batch : mBatches)
+	{
+		if (batch.mFont == &font && batch.mCharacterSize == characterSize)
+		{
+			return batch;
+		}
+	}
+
+	mBatches.push_back( Batch{ &font, characterSize, { } } );
+	return mBatches.back( );
+}
+
+} // namespace wEngine
\ No newline at end of file
@@ -0,0 +1,130 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_TEXT_BATCHER_HPP
+#define W_TEXT_BATCHER_HPP
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#include <SFML/Graphics.hpp>
+#pragma GCC diagnostic pop
+
+#include <vector>
+
+namespace wEngine
+{
+
+	/**
+	 * @class TextBatcher
+	 * @brief Lays out many strings into shared vertex arrays drawn over the font glyph atlas.
+	 *
+	 * Every `sf::Text` is a separate draw call. The TextBatcher instead writes the glyph quads
+	 * of all appended strings into one triangle list per (font, character size) pair, textured
+	 * with the glyph atlas of that font (`sf::Font::getTexture( )`). Drawing the batcher therefore
+	 * issues one draw call per font and size, whatever the number of strings.
+	 *
+	 * The layout follows `sf::Text` for the regular style (kerning, spaces, tabs and line breaks),
+	 * so a string appended at a given position lands exactly where an `sf::Text` placed at that
+	 * position would be drawn, and measure( ) returns the same local bounds.
+	 *
+	 * ### Usage:
+	 * - Call clear( ) at the start of a frame (capacity is kept between frames).
+	 * - Use measure( ) to align strings, then append( ) them.
+	 * - Call draw( ) once.
+	 *
+	 * @note Fonts must remain valid until the batcher is cleared or drawn for the last time.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 *
+	 */
+	class TextBatcher
+	{
+		public:
+			/**
+			 * @brief Computes the local bounds of a string, as `sf::Text::getLocalBounds( )` would.
+			 *
+			 * @param font			Font used for the layout.
+			 * @param characterSize	Character size in pixels.
+			 * @param text			String to measure.
+			 * @return Bounds relative to the position the string would be appended at.
+			 */
+			static sf::FloatRect measure( const sf::Font& font, unsigned int characterSize, const sf::String& text );
+
+			/**
+			 * @brief Appends the glyph quads of a string to the batch of its font and size.
+			 *
+			 * @param font			Font used for the layout (its glyph atlas textures the batch).
+			 * @param characterSize	Character size in pixels.
+			 * @param text			String to lay out.
+			 * @param position		Position of the string (same meaning as `sf::Text::setPosition( )`).
+			 * @param color			Fill color of the glyphs.
+			 * @return Bounds of the appended string in target coordinates.
+			 */
+			sf::FloatRect append( const sf::Font& font, unsigned int characterSize, const sf::String& text, sf::Vector2f position, sf::Color color );
+
+			/**
+			 * @brief Removes every appended string (allocated capacity is kept).
+			 */
+			void clear( );
+
+			/**
+			 * @brief Draws every batch, one draw call per (font, character size) pair.
+			 * @param window Render target.
+			 */
+			void draw( sf::RenderTarget& window ) const;
+
+			/**
+			 * @brief Get the total number of vertices currently batched.
+			 * @return Six vertices per visible glyph.
+			 */
+			[[nodiscard]] size_t getVertexCount( ) const;
+
+			/**
+			 * @brief Get the number of draw calls the next draw( ) will issue.
+			 * @return Number of non-empty (font, character size) batches.
+			 */
+			[[nodiscard]] size_t getDrawCallCount( ) const;
+
+		private:
+			/**
+			 * @struct Batch
+			 * @brief Glyph quads sharing one glyph atlas texture.
+			 */
+			struct Batch
+			{
+				const sf::Font* mFont;
+				unsigned int mCharacterSize;
+				std::vector< sf::Vertex > mVertices;
+			};
+
+			std::vector< Batch > mBatches;
+
+			/**
+			 * @brief Internal: lays out a string, optionally emitting its glyph quads.
+			 *
+			 * @param font			Font used for the layout.
+			 * @param characterSize	Character size in pixels.
+			 * @param text			String to lay out.
+			 * @param position		Translation applied to the emitted vertices.
+			 * @param color			Fill color of the glyphs.
+			 * @param vertices		Destination of the quads (nullptr to only measure).
+			 * @return Local bounds of the string.
+			 */
+			static sf::FloatRect layout( const sf::Font& font, unsigned int characterSize, const sf::String& text,
+				sf::Vector2f position, sf::Color color, std::vector< sf::Vertex >* vertices );
+
+			/**
+			 * @brief Internal: returns the batch of a font and size, creating it if needed.
+			 */
+			Batch& batchFor( const sf::Font& font, unsigned int characterSize );
+	};
+
+} // namespace wEngine
+
+#endif
\ No newline at end of file
@@ -0,0 +1,143 @@
+/**
+ * @file wThreadPool.cpp
+ * @brief Implementation of the ThreadPool class.
+ */
+
+#include "wThreadPool.hpp"
+
+#include <algorithm>
+
+namespace wEngine
+{
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Constructors and destructors.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+ThreadPool::ThreadPool( unsigned int threadCount )
+:	mStopping{ false }
+{
+	if (threadCount == 0)
+	{
+		threadCount = std::max( 1u, std::thread::hardware_concurrency( ) );
+	}
+
+	mWorkers.reserve( threadCount );
+	for (unsigned int i = 0; i < threadCount; ++i)
+	{
+		mWorkers.emplace_back( [ this ]( ) { workerLoop( ); } );
+	}
+}
+
+ThreadPool::~ThreadPool( )
+{
+	{
+		std::lock_guard< std::mutex > lock( mMutex );
+		mStopping = true;
+	}
+	mCondition.notify_all( );
+
+	for (auto& worker : mWorkers)
+	{
+		worker.join( );
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Public methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+unsigned int ThreadPool::getThreadCount( ) const
+{
+	return static_cast< unsigned int >( mWorkers.size( ) );
+}
+
+void ThreadPool::parallelFor( size_t count, const std::function< void( size_t, size_t ) >& body )
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	const size_t chunks = std::min( count, static_cast< size_t >( getThreadCount( ) ) );
+	const size_t chunkSize = count / chunks;
+	const size_t remainder = count % chunks;
+
+	// Contiguous chunks: the first 'remainder' chunks get one extra index.
+	std::vector< std::future< void > > pending;
+	pending.reserve( chunks - 1 );
+
+	size_t begin = 0;
+	for (size_t c = 0; c < chunks - 1; ++c)
+	{
+		size_t end = begin + chunkSize + (c < remainder ? 1 : 0);
+		pending.push_back( submit( [ &body, begin, end ]( ) { body( begin, end ); } ) );
+		begin = end;
+	}
+
+	// The calling thread takes the last chunk instead of idling.
+	std::exception_ptr firstError;
+	try
+	{
+		body( begin, count );
+	}
+	catch (...)
+	{
+		firstError = std::current_exception( );
+	}
+
+	// Always wait for every chunk: 'body' must outlive all of them.
+	for (auto& future : pending)
+	{
+		try
+		{
+			future.get( );
+		}
+		catch (...)
+		{
+			if (!firstError)
+			{
+				firstError = std::current_exception( );
+			}
+		}
+	}
+
+	if (firstError)
+	{
+		std::rethrow_exception( firstError );
+	}
+}
+
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+-> Private methods.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+void ThreadPool::workerLoop( )
+{
+	while (true)
+	{
+		std::function< void( ) > task;
+		{
+			std::unique_lock< std::mutex > lock( mMutex );
+			mCondition.wait( lock, [ this ]( ) { return mStopping || !mTasks.empty( ); } );
+
+			if (mStopping && mTasks.empty( ))
+			{
+				return;
+			}
+
+			task = std::move( mTasks.front( ) );
+			mTasks.pop( );
+		}
+
+		task( );
+	}
+}
+
+}//End of namespace wEngine
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+Created by Wilfried Koch.
+Copyright @ 2025 Wilfried Koch. All rights reserved.
++---------------------------------------------------------------------------------------------------------------------------------------------------+
+*/
+
+#ifndef W_THREAD_POOL_HPP
+#define W_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace wEngine
+{
+
+	/**
+	 * @class ThreadPool
+	 * @brief Fixed-size pool of worker threads executing queued tasks.
+	 *
+	 * The pool starts its workers once at construction and keeps them alive until destruction,
+	 * so repeated parallel work (e.g. evaluating a function on every redraw) does not pay for
+	 * thread creation each time.
+	 *
+	 * ### Features:
+	 * - submit( ) queues any callable and returns a `std::future` for its result.
+	 * - parallelFor( ) splits an index range into contiguous chunks, runs them on the workers
+	 *   and on the calling thread, waits for completion and rethrows the first exception.
+	 *
+	 * @warning parallelFor( ) blocks until every chunk has run: do not call it from a task
+	 *          running on the same pool, or the pool may deadlock.
+	 *
+	 * @author Wilfried Koch
+	 * @copyright © 2025 Wilfried Koch. All rights reserved.
+	 * 
+	 */
+	class ThreadPool
+	{
+		public:
+			/**
+			 * @brief Starts the worker threads.
+			 * @param threadCount Number of workers (0 = `std::thread::hardware_concurrency( )`, at least 1).
+			 */
+			explicit ThreadPool( unsigned int threadCount = 0 );
+
+			ThreadPool( const ThreadPool& ) = delete;
+			ThreadPool& operator=( const ThreadPool& ) = delete;
+
+			/**
+			 * @brief Finishes the queued tasks, then stops and joins all workers.
+			 */
+			~ThreadPool( );
+
+			/**
+			 * @brief Returns the number of worker threads.
+			 * @return Worker count (>= 1).
+			 */
+			[[nodiscard]] unsigned int getThreadCount( ) const;
+
+			/**
+			 * @brief Queues a task for execution on a worker thread.
+			 * @tparam F Callable type taking no argument.
+			 * @param task Callable to run.
+			 * @return Future holding the task result (or the exception it threw).
+			 */
+			template< typename F >
+			[[nodiscard]] std::future< std::invoke_result_t< F > > submit( F&& task )
+			{
+				using Result = std::invoke_result_t< F >;
+
+				auto packaged = std::make_shared< std::packaged_task< Result( ) > >( std::forward< F >( task ) );
+				std::future< Result > future = packaged->get_future( );
+
+				{
+					std::lock_guard< std::mutex > lock( mMutex );
+					mTasks.emplace( [ packaged ]( ) { (*packaged)( ); } );
+				}
+				mCondition.notify_one( );
+
+				return future;
+			}
+
+			/**
+			 * @brief Runs @p body over [0, count) split into one contiguous chunk per thread.
+			 *
+			 * Each chunk receives a half-open range [begin, end). The calling thread processes the
+			 * last chunk itself, then waits for the others.
+			 *
+			 * @param count	Number of indices to process.
+			 * @param body	Callable invoked as body( begin, end ) for each chunk.
+			 * @throws Rethrows the first exception raised by a chunk, after all chunks finished.
+			 */
+			void parallelFor( size_t count, const std::function< void( size_t, size_t ) >& body );
+		private:
+			std::vector< std::thread > mWorkers;
+			std::queue< std::function< void( ) > > mTasks;
+			std::mutex mMutex;
+			std::condition_variable mCondition;
+			bool mStopping;
+
+			/**
+			 * @brief Worker main loop: pops and runs tasks until the pool stops.
+			 */
+			void workerLoop( );
+	};
+
+}//End of namespace wEngine
+
+#endif
\ No newline at end of file